@@ -0,0 +1,114 @@
+/*
+ *  bench_main.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "t_cose_bench.h"
+
+
+typedef int_fast32_t (bench_fun_t)(void);
+
+#define BENCH_ENTRY(bench_name)  {#bench_name, bench_name}
+
+typedef struct {
+    const char  *name;
+    bench_fun_t *bench_fun;
+} bench_entry;
+
+static const bench_entry s_benches[] = {
+    BENCH_ENTRY(warmup_bench),
+    BENCH_ENTRY(hash_bench),
+    BENCH_ENTRY(batch_bench),
+    BENCH_ENTRY(sign_bench),
+    BENCH_ENTRY(verify_bench),
+    BENCH_ENTRY(thread_bench),
+    BENCH_ENTRY(policy_bench),
+    BENCH_ENTRY(header_cache_bench),
+    BENCH_ENTRY(merkle_bench),
+    BENCH_ENTRY(hash_envelope_bench),
+    BENCH_ENTRY(cwt_template_bench),
+    BENCH_ENTRY(cwt_validate_bench),
+    BENCH_ENTRY(claims_index_bench),
+    BENCH_ENTRY(cddl_gen_bench),
+    BENCH_ENTRY(nested_bench),
+    BENCH_ENTRY(x5chain_bench),
+    BENCH_ENTRY(replay_bench),
+};
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+void bench_report(const char *name,
+                  size_t      bytes_per_op,
+                  uint64_t    ops,
+                  uint64_t    elapsed_ns)
+{
+    double ns_per_op = (double)elapsed_ns / (double)ops;
+
+    if(bytes_per_op) {
+        printf("  %-40s %10.0f ns/op %10.1f MB/s\n",
+               name,
+               ns_per_op,
+               (double)bytes_per_op * 1000.0 / ns_per_op);
+    } else {
+        printf("  %-40s %10.0f ns/op %10.0f op/s\n",
+               name,
+               ns_per_op,
+               1e9 / ns_per_op);
+    }
+}
+
+
+/*
+ * Runs all the benchmarks or just the ones named on the command line.
+ */
+int main(int argc, const char * argv[])
+{
+    size_t       i;
+    int          j;
+    int          selected;
+    int_fast32_t result;
+    int          failures = 0;
+
+    for(i = 0; i < sizeof(s_benches)/sizeof(s_benches[0]); i++) {
+        selected = argc < 2;
+        for(j = 1; j < argc; j++) {
+            if(!strcmp(argv[j], s_benches[i].name)) {
+                selected = 1;
+            }
+        }
+        if(!selected) {
+            continue;
+        }
+
+        printf("%s\n", s_benches[i].name);
+        result = s_benches[i].bench_fun();
+        if(result) {
+            printf("%s FAILED (returned %d)\n", s_benches[i].name, (int)result);
+            failures++;
+        }
+    }
+
+    return failures;
+}
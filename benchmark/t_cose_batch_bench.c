@@ -0,0 +1,253 @@
+/*
+ *  t_cose_batch_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose_crypto.h"
+#include "t_cose_util.h"
+#include "t_cose_standard_constants.h"
+#include "sha256.h"
+
+
+/* Small messages are where multi-buffer hashing helps */
+static const size_t batch_payload_sizes[] = {100, 256, 1024, 4096};
+
+#define BATCH_BENCH_MESSAGES 16
+
+static uint8_t batch_payloads[BATCH_BENCH_MESSAGES][4096];
+
+
+/* A typical ES256 protected header: {1: -7} */
+static const uint8_t batch_protected[] = {0xa1, 0x01, 0x26};
+
+
+/* Times the bundled SHA-256 hashing BATCH_BENCH_MESSAGES messages of
+ * len with the given number of lanes */
+static void bench_b_con_lanes(int lanes, size_t len)
+{
+    SHA256_CTX  ctx[BATCH_BENCH_MESSAGES];
+    SHA256_CTX *ctx_ptrs[BATCH_BENCH_MESSAGES];
+    const BYTE *data[BATCH_BENCH_MESSAGES];
+    size_t      lens[BATCH_BENCH_MESSAGES];
+    uint8_t     digests[BATCH_BENCH_MESSAGES][SHA256_BLOCK_SIZE];
+    BYTE       *digest_ptrs[BATCH_BENCH_MESSAGES];
+    uint64_t    start;
+    uint64_t    elapsed;
+    uint64_t    ops;
+    size_t      i;
+    char        name[64];
+
+    for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+        ctx_ptrs[i]    = &ctx[i];
+        data[i]        = batch_payloads[i];
+        lens[i]        = len;
+        digest_ptrs[i] = digests[i];
+    }
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+            sha256_init(&ctx[i]);
+        }
+        sha256_update_multi(ctx_ptrs, data, lens, BATCH_BENCH_MESSAGES);
+        sha256_final_multi(ctx_ptrs, digest_ptrs, BATCH_BENCH_MESSAGES);
+        ops += BATCH_BENCH_MESSAGES;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+
+    snprintf(name, sizeof(name), "b_con %2d lanes         %5zu bytes", lanes, len);
+    bench_report(name, len, ops, elapsed);
+}
+
+
+/* Times hashing the Sig_structure of each message with
+ * create_tbs_hash() one at a time or create_tbs_hash_batch() */
+static enum t_cose_err_t bench_tbs_hash(int batch, size_t len)
+{
+    struct t_cose_tbs_hash_item items[BATCH_BENCH_MESSAGES];
+    uint8_t                     hashes[BATCH_BENCH_MESSAGES][T_COSE_CRYPTO_SHA256_SIZE];
+    enum t_cose_err_t           result;
+    uint64_t                    start;
+    uint64_t                    elapsed;
+    uint64_t                    ops;
+    size_t                      i;
+    char                        name[64];
+
+    for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+        items[i].protected_parameters = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(batch_protected);
+        items[i].aad                  = NULL_Q_USEFUL_BUF_C;
+        items[i].payload              = (struct q_useful_buf_c){batch_payloads[i], len};
+        items[i].buffer_for_hash      = (struct q_useful_buf){hashes[i], sizeof(hashes[i])};
+    }
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(batch) {
+            result = create_tbs_hash_batch(T_COSE_ALGORITHM_ES256,
+                                           items,
+                                           BATCH_BENCH_MESSAGES);
+        } else {
+            for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+                result = create_tbs_hash(T_COSE_ALGORITHM_ES256,
+                                         items[i].protected_parameters,
+                                         items[i].aad,
+                                         items[i].payload,
+                                         items[i].buffer_for_hash,
+                                         &items[i].hash);
+                if(result) {
+                    break;
+                }
+            }
+        }
+        if(result) {
+            return result;
+        }
+        ops += BATCH_BENCH_MESSAGES;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+
+    snprintf(name, sizeof(name), "tbs hash %-13s %5zu bytes",
+             batch ? "batch" : "per-message", len);
+    bench_report(name, len, ops, elapsed);
+
+    return T_COSE_SUCCESS;
+}
+
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+/* Times signing and verifying with short-circuit signatures so the
+ * hashing and CBOR are all that's measured */
+static enum t_cose_err_t bench_sign_verify_batch(int batch, size_t len)
+{
+    static uint8_t                        outputs[BATCH_BENCH_MESSAGES][4096 + 200];
+    struct t_cose_sign1_sign_batch_item   sign_items[BATCH_BENCH_MESSAGES];
+    struct t_cose_sign1_verify_batch_item verify_items[BATCH_BENCH_MESSAGES];
+    struct t_cose_sign1_sign_ctx          sign_ctx;
+    struct t_cose_sign1_verify_ctx        verify_ctx;
+    struct q_useful_buf_c                 payload;
+    enum t_cose_err_t                     result;
+    uint64_t                              start;
+    uint64_t                              elapsed;
+    uint64_t                              ops;
+    size_t                                i;
+    char                                  name[64];
+
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+        sign_items[i].payload = (struct q_useful_buf_c){batch_payloads[i], len};
+        sign_items[i].aad     = NULL_Q_USEFUL_BUF_C;
+        sign_items[i].out_buf = (struct q_useful_buf){outputs[i], sizeof(outputs[i])};
+    }
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(batch) {
+            result = t_cose_sign1_sign_batch(&sign_ctx, sign_items, BATCH_BENCH_MESSAGES);
+            if(result) {
+                return result;
+            }
+            for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+                verify_items[i].cose_sign1 = sign_items[i].result;
+                verify_items[i].aad        = NULL_Q_USEFUL_BUF_C;
+            }
+            result = t_cose_sign1_verify_batch(&verify_ctx, verify_items, BATCH_BENCH_MESSAGES);
+        } else {
+            for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+                result = t_cose_sign1_sign(&sign_ctx,
+                                           sign_items[i].payload,
+                                           sign_items[i].out_buf,
+                                           &sign_items[i].result);
+                if(result) {
+                    break;
+                }
+                result = t_cose_sign1_verify(&verify_ctx,
+                                             sign_items[i].result,
+                                             &payload,
+                                             NULL);
+                if(result) {
+                    break;
+                }
+            }
+        }
+        if(result) {
+            return result;
+        }
+        ops += BATCH_BENCH_MESSAGES;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+
+    snprintf(name, sizeof(name), "sign+verify %-10s %5zu bytes",
+             batch ? "batch" : "one-by-one", len);
+    bench_report(name, len, ops, elapsed);
+
+    return T_COSE_SUCCESS;
+}
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t batch_bench(void)
+{
+    static const int  lane_counts[] = {1, 4, 8, 16};
+    size_t            i;
+    size_t            j;
+    size_t            s;
+    enum t_cose_err_t result;
+
+    for(i = 0; i < BATCH_BENCH_MESSAGES; i++) {
+        for(j = 0; j < sizeof(batch_payloads[i]); j++) {
+            batch_payloads[i][j] = (uint8_t)(i * 13 + j * 31);
+        }
+    }
+
+    for(s = 0; s < sizeof(batch_payload_sizes)/sizeof(batch_payload_sizes[0]); s++) {
+        for(i = 0; i < sizeof(lane_counts)/sizeof(lane_counts[0]); i++) {
+            if(sha256_set_mb_lanes(lane_counts[i])) {
+                continue;
+            }
+            bench_b_con_lanes(lane_counts[i], batch_payload_sizes[s]);
+        }
+    }
+    sha256_set_mb_lanes(0);
+    printf("  b_con auto uses %d lanes\n", sha256_get_mb_lanes());
+
+    /* Through the crypto adapter the library is built with */
+    for(s = 0; s < sizeof(batch_payload_sizes)/sizeof(batch_payload_sizes[0]); s++) {
+        result = bench_tbs_hash(0, batch_payload_sizes[s]);
+        if(result == T_COSE_SUCCESS) {
+            result = bench_tbs_hash(1, batch_payload_sizes[s]);
+        }
+        if(result) {
+            return (int_fast32_t)result;
+        }
+    }
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    for(s = 0; s < sizeof(batch_payload_sizes)/sizeof(batch_payload_sizes[0]); s++) {
+        result = bench_sign_verify_batch(0, batch_payload_sizes[s]);
+        if(result == T_COSE_SUCCESS) {
+            result = bench_sign_verify_batch(1, batch_payload_sizes[s]);
+        }
+        if(result) {
+            return (int_fast32_t)result;
+        }
+    }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+    return 0;
+}
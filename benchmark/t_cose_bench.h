@@ -0,0 +1,180 @@
+/*
+ *  t_cose_bench.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef t_cose_bench_h
+#define t_cose_bench_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/**
+ * \file t_cose_bench.h
+ *
+ * \brief Small harness for the throughput and latency benchmarks.
+ *
+ * Benchmarks are not tests. They don't check results beyond what is
+ * needed to know the thing being timed worked, and they are not run
+ * by ctest. Each benchmark function returns 0 on success or an error
+ * code and prints its results with bench_report().
+ */
+
+
+/* Monotonic time in nanoseconds */
+uint64_t bench_now_ns(void);
+
+
+/* Minimum time each measurement runs for, in nanoseconds */
+#define BENCH_MIN_NS  200000000ULL
+
+
+/**
+ * \brief Print one result line.
+ *
+ * \param[in] name            Name of what was measured.
+ * \param[in] bytes_per_op    Bytes processed per operation or 0 if
+ *                            throughput is not meaningful.
+ * \param[in] ops             Number of operations timed.
+ * \param[in] elapsed_ns      Total time for all \c ops.
+ */
+void bench_report(const char *name,
+                  size_t      bytes_per_op,
+                  uint64_t    ops,
+                  uint64_t    elapsed_ns);
+
+
+/*
+ * Latency of the first hash through the crypto adapter, of
+ * t_cose_warmup() and of small hashes before and after it. The first
+ * number is only right in a fresh process so this runs first.
+ */
+int_fast32_t warmup_bench(void);
+
+
+/*
+ * SHA-256, SHA-384 and SHA-512 throughput of each kernel in the
+ * bundled hash and through the crypto adapter.
+ */
+int_fast32_t hash_bench(void);
+
+
+/*
+ * Multi-buffer SHA-256 against one message at a time, in the bundled
+ * hash, for to-be-signed hashing and for batch sign/verify.
+ */
+int_fast32_t batch_bench(void);
+
+
+/*
+ * ES256 signing and verification latency of the built-in P-256
+ * engine, with and without a nonce pool, and through the crypto
+ * adapter of the configured provider.
+ */
+int_fast32_t sign_bench(void);
+
+
+/*
+ * ECDSA verification with the per-key table engine against
+ * OpenSSL's EVP_PKEY_verify() and through the crypto adapter with and
+ * without a key cache.
+ */
+int_fast32_t verify_bench(void);
+
+
+/*
+ * Aggregate signing throughput of 1, 2, 4 ... threads all using one
+ * key, with the key shared, with per-thread key replicas and with
+ * deterministic (RFC 6979) instead of random ECDSA nonces.
+ */
+int_fast32_t thread_bench(void);
+
+
+/*
+ * Rejection rate of forged ES256 messages with a 64 KB payload
+ * without a verification policy and with each of the policy checks
+ * that catch them before hashing.
+ */
+int_fast32_t policy_bench(void);
+
+
+/*
+ * Verification of small ES256 messages, short-circuit and real, with
+ * and without a protected header cache.
+ */
+int_fast32_t header_cache_bench(void);
+
+
+/*
+ * Cost per event of signing and verifying 100 B events one by one
+ * against one signature over a Merkle tree of 1024 of them with a
+ * receipt each.
+ */
+int_fast32_t merkle_bench(void);
+
+
+/*
+ * Hashing eight 8 MB files one by one and together with
+ * t_cose_hash_files(), and ES256 signing and verifying an 8 MB
+ * payload against a hash envelope of its hash.
+ */
+int_fast32_t hash_envelope_bench(void);
+
+
+/*
+ * Making CWT claims sets with QCBOR for each token and by setting the
+ * slots of a t_cose_cwt_template, alone and signed.
+ */
+int_fast32_t cwt_template_bench(void);
+
+
+/*
+ * Checking CWT claims alone and with ES256 verification, and
+ * rejecting expired CWTs with the claims checked after and before
+ * the signature.
+ */
+int_fast32_t cwt_validate_bench(void);
+
+
+/*
+ * Looking up 20 of 30 claims with QCBOR map searches and with a
+ * t_cose_claims_index.
+ */
+int_fast32_t claims_index_bench(void);
+
+
+/*
+ * Encoding and decoding CWT claims with the code generated from
+ * test/cddl/cwt_claims.cddl and with QCBOR by hand.
+ */
+int_fast32_t cddl_gen_bench(void);
+
+
+/*
+ * Verifying an EAT and the 8 ES256 submodule tokens in it serially
+ * and with t_cose_sign1_verifier_verify_nested() on a worker pool.
+ */
+int_fast32_t nested_bench(void);
+
+
+/*
+ * Verifying an ES256 token with the key known, with its certificate
+ * chain validated and with the chain from a t_cose_x5chain_cache.
+ */
+int_fast32_t x5chain_bench(void);
+
+
+/*
+ * Entering new tokens into a t_cose_replay_cache, checking replayed
+ * ones and all threads entering the same ones, for each thread count.
+ */
+int_fast32_t replay_bench(void);
+
+
+#endif /* t_cose_bench_h */
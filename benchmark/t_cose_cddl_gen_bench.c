@@ -0,0 +1,177 @@
+/*
+ *  t_cose_cddl_gen_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "t_cose_bench.h"
+#include "qcbor/qcbor_encode.h"
+#include "qcbor/qcbor_spiffy_decode.h"
+#include "t_cose/t_cose_common.h"
+#include "cddl/cwt_claims_gen.h"
+
+
+#define CDDL_BENCH_HW_LABEL -75000
+
+static const uint8_t cddl_bench_cti[16] = {
+    0x0b, 0x71, 0x5a, 0x3c, 0x91, 0x22, 0x7e, 0x04,
+    0xd8, 0x6f, 0x13, 0xa0, 0x47, 0xee, 0x29, 0xb5};
+
+
+/* The claims of RFC 8392 appendix A.1 with a hardware submodule */
+static void cddl_bench_claims(struct cwt_claims *claims)
+{
+    memset(claims, 0, sizeof(*claims));
+    claims->iss        = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://as.example.com");
+    claims->sub        = Q_USEFUL_BUF_FROM_SZ_LITERAL("erikw");
+    claims->aud        = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://light.example.com");
+    claims->exp        = 1444064944;
+    claims->nbf        = 1443944944;
+    claims->iat        = 1443944944;
+    claims->cti        = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cddl_bench_cti);
+    claims->hw.model   = Q_USEFUL_BUF_FROM_SZ_LITERAL("model-x");
+    claims->hw.version = 70000;
+    claims->hw.present = HW_CLAIMS_MODEL_PRESENT | HW_CLAIMS_VERSION_PRESENT;
+    claims->present    = CWT_CLAIMS_ISS_PRESENT | CWT_CLAIMS_SUB_PRESENT | CWT_CLAIMS_AUD_PRESENT |
+                         CWT_CLAIMS_EXP_PRESENT | CWT_CLAIMS_NBF_PRESENT | CWT_CLAIMS_IAT_PRESENT |
+                         CWT_CLAIMS_CTI_PRESENT | CWT_CLAIMS_HW_PRESENT;
+}
+
+
+/* The same claims encoded by hand with QCBOR */
+static int_fast32_t cddl_bench_qcbor_encode(const struct cwt_claims *claims,
+                                            struct q_useful_buf      buffer,
+                                            struct q_useful_buf_c   *payload)
+{
+    QCBOREncodeContext cbor_encode;
+
+    QCBOREncode_Init(&cbor_encode, buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddTextToMapN(&cbor_encode, 1, claims->iss);
+    QCBOREncode_AddTextToMapN(&cbor_encode, 2, claims->sub);
+    QCBOREncode_AddTextToMapN(&cbor_encode, 3, claims->aud);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 4, claims->exp);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 5, claims->nbf);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 6, claims->iat);
+    QCBOREncode_AddBytesToMapN(&cbor_encode, 7, claims->cti);
+    QCBOREncode_OpenMapInMapN(&cbor_encode, CDDL_BENCH_HW_LABEL);
+    QCBOREncode_AddTextToMapN(&cbor_encode, 1, claims->hw.model);
+    QCBOREncode_AddUInt64ToMapN(&cbor_encode, 2, claims->hw.version);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    return QCBOREncode_Finish(&cbor_encode, payload) ? 10 : 0;
+}
+
+
+/* The same claims decoded by hand with QCBOR spiffy decode */
+static int_fast32_t cddl_bench_qcbor_decode(struct q_useful_buf_c payload, struct cwt_claims *claims)
+{
+    QCBORDecodeContext decode_context;
+    int64_t            version;
+
+    memset(claims, 0, sizeof(*claims));
+    QCBORDecode_Init(&decode_context, payload, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterMap(&decode_context, NULL);
+    QCBORDecode_GetTextStringInMapN(&decode_context, 1, &claims->iss);
+    QCBORDecode_GetTextStringInMapN(&decode_context, 2, &claims->sub);
+    QCBORDecode_GetTextStringInMapN(&decode_context, 3, &claims->aud);
+    QCBORDecode_GetInt64InMapN(&decode_context, 4, &claims->exp);
+    QCBORDecode_GetInt64InMapN(&decode_context, 5, &claims->nbf);
+    QCBORDecode_GetInt64InMapN(&decode_context, 6, &claims->iat);
+    QCBORDecode_GetByteStringInMapN(&decode_context, 7, &claims->cti);
+    QCBORDecode_EnterMapFromMapN(&decode_context, CDDL_BENCH_HW_LABEL);
+    QCBORDecode_GetTextStringInMapN(&decode_context, 1, &claims->hw.model);
+    QCBORDecode_GetInt64InMapN(&decode_context, 2, &version);
+    QCBORDecode_ExitMap(&decode_context);
+    QCBORDecode_ExitMap(&decode_context);
+    if(QCBORDecode_Finish(&decode_context) || version < 0) {
+        return 20;
+    }
+    claims->hw.version = (uint64_t)version;
+    return 0;
+}
+
+
+/* Check what was decoded by either */
+static bool cddl_bench_same(const struct cwt_claims *a, const struct cwt_claims *b)
+{
+    return !q_useful_buf_compare(a->iss, b->iss) &&
+           !q_useful_buf_compare(a->sub, b->sub) &&
+           !q_useful_buf_compare(a->aud, b->aud) &&
+           !q_useful_buf_compare(a->cti, b->cti) &&
+           !q_useful_buf_compare(a->hw.model, b->hw.model) &&
+           a->exp == b->exp && a->nbf == b->nbf && a->iat == b->iat &&
+           a->hw.version == b->hw.version;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t cddl_gen_bench(void)
+{
+    static const char *names[] = {
+        "encode, QCBOR by hand",
+        "encode, generated",
+        "decode, QCBOR spiffy decode by hand",
+        "decode, generated"
+    };
+    struct cwt_claims     claims;
+    struct cwt_claims     decoded;
+    Q_USEFUL_BUF_MAKE_STACK_UB(qcbor_buffer, CWT_CLAIMS_MAX_SIZE);
+    Q_USEFUL_BUF_MAKE_STACK_UB(gen_buffer, CWT_CLAIMS_MAX_SIZE);
+    struct q_useful_buf_c qcbor_payload;
+    struct q_useful_buf_c gen_payload;
+    struct q_useful_buf_c payload;
+    int_fast32_t          result;
+    uint64_t              start;
+    uint64_t              elapsed;
+    uint64_t              ops;
+    int                   way;
+
+    cddl_bench_claims(&claims);
+
+    /* Both encode the same bytes and decode the same claims */
+    result = cddl_bench_qcbor_encode(&claims, qcbor_buffer, &qcbor_payload);
+    if(result) {
+        return result;
+    }
+    if(cwt_claims_encode(&claims, gen_buffer, &gen_payload) ||
+       q_useful_buf_compare(qcbor_payload, gen_payload)) {
+        return 1;
+    }
+    if(cwt_claims_decode(qcbor_payload, &decoded) || !cddl_bench_same(&claims, &decoded)) {
+        return 2;
+    }
+    result = cddl_bench_qcbor_decode(gen_payload, &decoded);
+    if(result || !cddl_bench_same(&claims, &decoded)) {
+        return 3;
+    }
+
+    for(way = 0; way < 4; way++) {
+        ops = 0;
+        start = bench_now_ns();
+        do {
+            switch(way) {
+            case 0:  result = cddl_bench_qcbor_encode(&claims, qcbor_buffer, &payload); break;
+            case 1:  result = cwt_claims_encode(&claims, gen_buffer, &payload) ? 30 : 0; break;
+            case 2:  result = cddl_bench_qcbor_decode(gen_payload, &decoded); break;
+            default: result = cwt_claims_decode(gen_payload, &decoded) ? 40 : 0; break;
+            }
+            if(result) {
+                return result;
+            }
+            ops++;
+            elapsed = bench_now_ns() - start;
+        } while(elapsed < BENCH_MIN_NS);
+        bench_report(names[way], 0, ops, elapsed);
+    }
+
+    return 0;
+}
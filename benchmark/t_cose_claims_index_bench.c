@@ -0,0 +1,207 @@
+/*
+ *  t_cose_claims_index_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "qcbor/qcbor_encode.h"
+#include "qcbor/qcbor_spiffy_decode.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_claims_index.h"
+
+
+/* Claims in the payload and how many of them a policy looks up */
+#define CLAIMS_INDEX_BENCH_CLAIMS  30
+#define CLAIMS_INDEX_BENCH_LOOKUPS 20
+
+/* The claims are -75000 - 2 * i. Odd ones are integers and even ones
+ * 16-byte strings. The lookups are spread over the map. */
+#define CLAIMS_INDEX_BENCH_LABEL(i) (-75000 - 2 * (int64_t)(i))
+
+static const uint8_t claims_index_bench_bytes[16] = {
+    0x0b, 0x71, 0x5a, 0x3c, 0x91, 0x22, 0x7e, 0x04,
+    0xd8, 0x6f, 0x13, 0xa0, 0x47, 0xee, 0x29, 0xb5};
+
+
+/* Which claim the nth lookup is for */
+static size_t claims_index_bench_claim(size_t n)
+{
+    return (n * 7) % CLAIMS_INDEX_BENCH_CLAIMS;
+}
+
+
+/* The lookups with QCBORDecode_GetXxxInMapN(), each a scan of the map */
+static int_fast32_t claims_index_bench_qcbor(struct q_useful_buf_c payload, int64_t *sum)
+{
+    QCBORDecodeContext    decode_context;
+    struct q_useful_buf_c string;
+    int64_t               value;
+    size_t                n;
+    size_t                claim;
+
+    QCBORDecode_Init(&decode_context, payload, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterMap(&decode_context, NULL);
+    for(n = 0; n < CLAIMS_INDEX_BENCH_LOOKUPS; n++) {
+        claim = claims_index_bench_claim(n);
+        if(claim % 2) {
+            QCBORDecode_GetInt64InMapN(&decode_context, CLAIMS_INDEX_BENCH_LABEL(claim), &value);
+            *sum += value;
+        } else {
+            QCBORDecode_GetByteStringInMapN(&decode_context, CLAIMS_INDEX_BENCH_LABEL(claim), &string);
+            *sum += (int64_t)string.len;
+        }
+    }
+    QCBORDecode_ExitMap(&decode_context);
+    return QCBORDecode_Finish(&decode_context) ? 10 : 0;
+}
+
+
+/* The same lookups with QCBORDecode_GetItemsInMap(), one scan */
+static int_fast32_t claims_index_bench_items(struct q_useful_buf_c payload, int64_t *sum)
+{
+    QCBORDecodeContext decode_context;
+    QCBORItem          items[CLAIMS_INDEX_BENCH_LOOKUPS + 1];
+    size_t             n;
+    size_t             claim;
+
+    for(n = 0; n < CLAIMS_INDEX_BENCH_LOOKUPS; n++) {
+        claim = claims_index_bench_claim(n);
+        items[n].label.int64 = CLAIMS_INDEX_BENCH_LABEL(claim);
+        items[n].uLabelType  = QCBOR_TYPE_INT64;
+        items[n].uDataType   = claim % 2 ? QCBOR_TYPE_INT64 : QCBOR_TYPE_BYTE_STRING;
+    }
+    items[CLAIMS_INDEX_BENCH_LOOKUPS].uLabelType = QCBOR_TYPE_NONE;
+
+    QCBORDecode_Init(&decode_context, payload, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterMap(&decode_context, NULL);
+    QCBORDecode_GetItemsInMap(&decode_context, items);
+    QCBORDecode_ExitMap(&decode_context);
+    if(QCBORDecode_Finish(&decode_context)) {
+        return 20;
+    }
+    for(n = 0; n < CLAIMS_INDEX_BENCH_LOOKUPS; n++) {
+        if(items[n].uDataType == QCBOR_TYPE_INT64) {
+            *sum += items[n].val.int64;
+        } else {
+            *sum += (int64_t)items[n].val.string.len;
+        }
+    }
+    return 0;
+}
+
+
+/* The same lookups with an index, made first if make_index */
+static int_fast32_t claims_index_bench_index(struct q_useful_buf_c       payload,
+                                             struct t_cose_claims_index *index,
+                                             bool                        make_index,
+                                             int64_t                    *sum)
+{
+    static struct t_cose_claims_index_entry entries[CLAIMS_INDEX_BENCH_CLAIMS];
+    struct q_useful_buf_c                   string;
+    int64_t                                 value;
+    size_t                                  n;
+    size_t                                  claim;
+    const struct t_cose_claims_index_entry *entry;
+
+    if(make_index &&
+       t_cose_claims_index_build(index, payload, entries, CLAIMS_INDEX_BENCH_CLAIMS)) {
+        return 30;
+    }
+    for(n = 0; n < CLAIMS_INDEX_BENCH_LOOKUPS; n++) {
+        claim = claims_index_bench_claim(n);
+        entry = t_cose_claims_index_find(index, NULL, CLAIMS_INDEX_BENCH_LABEL(claim));
+        if(claim % 2) {
+            if(t_cose_claims_index_get_int(index, entry, &value)) {
+                return 31;
+            }
+            *sum += value;
+        } else {
+            if(t_cose_claims_index_get_string(index, entry, &string)) {
+                return 32;
+            }
+            *sum += (int64_t)string.len;
+        }
+    }
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t claims_index_bench(void)
+{
+    static const char *names[] = {
+        "QCBOR GetXxxInMapN x 20",
+        "QCBOR GetItemsInMap",
+        "index build + find x 20",
+        "index find x 20 (prebuilt)"
+    };
+    QCBOREncodeContext         cbor_encode;
+    uint8_t                    payload_buffer[600];
+    struct q_useful_buf_c      payload;
+    struct t_cose_claims_index index;
+    int_fast32_t               result;
+    int64_t                    sum;
+    int64_t                    expected_sum;
+    uint64_t                   start;
+    uint64_t                   elapsed;
+    uint64_t                   ops;
+    size_t                     i;
+    int                        way;
+
+    QCBOREncode_Init(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY(payload_buffer));
+    QCBOREncode_OpenMap(&cbor_encode);
+    for(i = 0; i < CLAIMS_INDEX_BENCH_CLAIMS; i++) {
+        if(i % 2) {
+            QCBOREncode_AddInt64ToMapN(&cbor_encode, CLAIMS_INDEX_BENCH_LABEL(i), 1000000 + (int64_t)i);
+        } else {
+            QCBOREncode_AddBytesToMapN(&cbor_encode,
+                                       CLAIMS_INDEX_BENCH_LABEL(i),
+                                       Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(claims_index_bench_bytes));
+        }
+    }
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &payload)) {
+        return 1;
+    }
+
+    /* For the prebuilt runs */
+    sum = 0;
+    result = claims_index_bench_index(payload, &index, true, &sum);
+    if(result) {
+        return result;
+    }
+    expected_sum = sum;
+
+    for(way = 0; way < 4; way++) {
+        ops = 0;
+        start = bench_now_ns();
+        do {
+            sum = 0;
+            switch(way) {
+            case 0:  result = claims_index_bench_qcbor(payload, &sum); break;
+            case 1:  result = claims_index_bench_items(payload, &sum); break;
+            default: result = claims_index_bench_index(payload, &index, way == 2, &sum); break;
+            }
+            /* All four find the same values */
+            if(result == 0 && sum != expected_sum) {
+                result = 2;
+            }
+            if(result) {
+                return result;
+            }
+            ops++;
+            elapsed = bench_now_ns() - start;
+        } while(elapsed < BENCH_MIN_NS);
+        bench_report(names[way], 0, ops, elapsed);
+    }
+
+    return 0;
+}
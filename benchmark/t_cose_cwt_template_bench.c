@@ -0,0 +1,189 @@
+/*
+ *  t_cose_cwt_template_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "qcbor/qcbor_encode.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_cwt_template.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define CWT_TEMPLATE_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+/* A token lifetime of an hour from a fixed time */
+#define CWT_BENCH_IAT      1700000000
+#define CWT_BENCH_LIFETIME 3600
+
+static uint8_t cwt_bench_cti[16];
+
+
+/* The claims the template holds, encoded with QCBOR as the examples
+ * make payloads */
+static enum t_cose_err_t cwt_bench_qcbor(uint32_t               iat,
+                                         struct q_useful_buf    buffer,
+                                         struct q_useful_buf_c *payload)
+{
+    QCBOREncodeContext cbor_encode;
+
+    QCBOREncode_Init(&cbor_encode, buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_ISS, "https://issuer.example.com");
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_SUB, "device-12345");
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_AUD, "https://service.example.com");
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_EXP, iat + CWT_BENCH_LIFETIME);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_IAT, iat);
+    QCBOREncode_AddBytesToMapN(&cbor_encode,
+                               T_COSE_CWT_CLAIM_CTI,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cwt_bench_cti));
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, payload)) {
+        return T_COSE_ERR_CBOR_FORMATTING;
+    }
+
+    return T_COSE_SUCCESS;
+}
+
+
+/* Makes CWT payloads, and signs them if sign_ctx isn't NULL, until
+ * BENCH_MIN_NS has passed */
+static int_fast32_t cwt_bench_run(struct t_cose_sign1_sign_ctx *sign_ctx,
+                                  int                           use_template,
+                                  const char                   *name)
+{
+    struct t_cose_cwt_template tmpl;
+    uint8_t                    template_buffer[120];
+    uint8_t                    payload_buffer[120];
+    uint8_t                    message_buffer[300];
+    struct q_useful_buf_c      template_payload;
+    struct q_useful_buf_c      payload;
+    struct q_useful_buf_c      message;
+    size_t                     exp_slot;
+    size_t                     iat_slot;
+    size_t                     cti_slot;
+    enum t_cose_err_t          result;
+    uint64_t                   start;
+    uint64_t                   elapsed;
+    uint64_t                   ops;
+    uint32_t                   iat;
+
+    /* Once at start up */
+    t_cose_cwt_template_init(&tmpl, Q_USEFUL_BUF_FROM_BYTE_ARRAY(template_buffer));
+    t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_ISS, "https://issuer.example.com");
+    t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_SUB, "device-12345");
+    t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_AUD, "https://service.example.com");
+    exp_slot = t_cose_cwt_template_add_uint_slot(&tmpl, T_COSE_CWT_CLAIM_EXP);
+    iat_slot = t_cose_cwt_template_add_uint_slot(&tmpl, T_COSE_CWT_CLAIM_IAT);
+    cti_slot = t_cose_cwt_template_add_bstr_slot(&tmpl, T_COSE_CWT_CLAIM_CTI, sizeof(cwt_bench_cti));
+    result = t_cose_cwt_template_finish(&tmpl, &template_payload);
+    if(result) {
+        return 10 + (int_fast32_t)result;
+    }
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        /* Something different in each token */
+        iat = CWT_BENCH_IAT + (uint32_t)ops;
+        cwt_bench_cti[0] = (uint8_t)ops;
+
+        if(use_template) {
+            t_cose_cwt_template_set_uint(&tmpl, exp_slot, iat + CWT_BENCH_LIFETIME);
+            t_cose_cwt_template_set_uint(&tmpl, iat_slot, iat);
+            t_cose_cwt_template_set_bstr(&tmpl,
+                                         cti_slot,
+                                         Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cwt_bench_cti));
+            payload = template_payload;
+        } else {
+            result = cwt_bench_qcbor(iat, Q_USEFUL_BUF_FROM_BYTE_ARRAY(payload_buffer), &payload);
+            if(result) {
+                return 20 + (int_fast32_t)result;
+            }
+        }
+
+        if(sign_ctx != NULL) {
+            result = t_cose_sign1_sign(sign_ctx,
+                                       payload,
+                                       Q_USEFUL_BUF_FROM_BYTE_ARRAY(message_buffer),
+                                      &message);
+            if(result) {
+                return 30 + (int_fast32_t)result;
+            }
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(name, 0, ops, elapsed);
+
+    /* The two ways make the same bytes */
+    if(use_template &&
+       (cwt_bench_qcbor(iat, Q_USEFUL_BUF_FROM_BYTE_ARRAY(payload_buffer), &payload) ||
+        q_useful_buf_compare(payload, template_payload))) {
+        return 40;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t cwt_template_bench(void)
+{
+    int_fast32_t                 result;
+    struct t_cose_sign1_sign_ctx sign_ctx;
+#ifdef CWT_TEMPLATE_BENCH_ADAPTER
+    struct t_cose_key            key;
+#endif
+
+    result = cwt_bench_run(NULL, 0, "CWT claims, QCBOR encode");
+    if(result) {
+        return result;
+    }
+    result = cwt_bench_run(NULL, 1, "CWT claims, template");
+    if(result) {
+        return result;
+    }
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    /* No public key operation so CBOR and hashing are all there is */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = cwt_bench_run(&sign_ctx, 0, "short-circuit CWT, QCBOR encode");
+    if(result) {
+        return result;
+    }
+    result = cwt_bench_run(&sign_ctx, 1, "short-circuit CWT, template");
+    if(result) {
+        return result;
+    }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+#ifdef CWT_TEMPLATE_BENCH_ADAPTER
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        return 1;
+    }
+    t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+    result = cwt_bench_run(&sign_ctx, 0, "ES256 CWT, QCBOR encode");
+    if(!result) {
+        result = cwt_bench_run(&sign_ctx, 1, "ES256 CWT, template");
+    }
+    free_key_pair(key);
+#else
+    (void)sign_ctx;
+#endif /* CWT_TEMPLATE_BENCH_ADAPTER */
+
+    return result;
+}
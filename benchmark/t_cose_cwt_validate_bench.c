@@ -0,0 +1,170 @@
+/*
+ *  t_cose_cwt_validate_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "qcbor/qcbor_encode.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_cwt_claims.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define CWT_VALIDATE_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+/* The token is good for an hour from here */
+#define CWT_VALIDATE_BENCH_IAT 1700000000
+
+static const uint8_t cwt_validate_bench_cti[16] = {
+    0x0b, 0x71, 0x5a, 0x3c, 0x91, 0x22, 0x7e, 0x04,
+    0xd8, 0x6f, 0x13, 0xa0, 0x47, 0xee, 0x29, 0xb5};
+
+static int64_t cwt_validate_bench_now;
+
+static int64_t cwt_validate_bench_clock(void *clock_ctx)
+{
+    (void)clock_ctx;
+    return cwt_validate_bench_now;
+}
+
+
+/* Verifies and checks the CWT until BENCH_MIN_NS has passed, checking
+ * the result is the expected one each time */
+static int_fast32_t cwt_validate_bench_run(struct t_cose_sign1_verify_ctx     *verify_ctx,
+                                           struct q_useful_buf_c               cwt,
+                                           const struct t_cose_cwt_validation *validation,
+                                           enum t_cose_err_t                   expected,
+                                           const char                         *name)
+{
+    struct t_cose_cwt_claims claims;
+    enum t_cose_err_t        result;
+    uint64_t                 start;
+    uint64_t                 elapsed;
+    uint64_t                 ops;
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(verify_ctx != NULL) {
+            result = t_cose_sign1_verify_cwt(verify_ctx, cwt, validation, &claims, NULL);
+        } else {
+            result = t_cose_cwt_validate(validation, cwt, &claims);
+        }
+        if(result != expected) {
+            return 30 + (int_fast32_t)result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(name, 0, ops, elapsed);
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t cwt_validate_bench(void)
+{
+    int_fast32_t                   result;
+    QCBOREncodeContext             cbor_encode;
+    uint8_t                        claims_buffer[150];
+    struct q_useful_buf_c          claims;
+    struct t_cose_cwt_validation   validation;
+#ifdef CWT_VALIDATE_BENCH_ADAPTER
+    struct t_cose_key              key;
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    uint8_t                        cwt_buffer[300];
+    struct q_useful_buf_c          cwt;
+#endif
+
+    QCBOREncode_Init(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY(claims_buffer));
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_ISS, "https://issuer.example.com");
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_SUB, "device-12345");
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_AUD, "https://service.example.com");
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_EXP, CWT_VALIDATE_BENCH_IAT + 3600);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_IAT, CWT_VALIDATE_BENCH_IAT);
+    QCBOREncode_AddBytesToMapN(&cbor_encode,
+                               T_COSE_CWT_CLAIM_CTI,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cwt_validate_bench_cti));
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &claims)) {
+        return 1;
+    }
+
+    t_cose_cwt_validation_init(&validation, T_COSE_CWT_REQUIRE_EXP);
+    validation.issuer   = Q_USEFUL_BUF_FROM_SZ_LITERAL("https://issuer.example.com");
+    validation.audience = Q_USEFUL_BUF_FROM_SZ_LITERAL("https://service.example.com");
+    validation.clock    = cwt_validate_bench_clock;
+    cwt_validate_bench_now = CWT_VALIDATE_BENCH_IAT + 60;
+
+    result = cwt_validate_bench_run(NULL,
+                                    claims,
+                                    &validation,
+                                    T_COSE_SUCCESS,
+                                    "t_cose_cwt_validate()");
+    if(result) {
+        return result;
+    }
+
+#ifdef CWT_VALIDATE_BENCH_ADAPTER
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        return 2;
+    }
+    t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+    if(t_cose_sign1_sign(&sign_ctx, claims, Q_USEFUL_BUF_FROM_BYTE_ARRAY(cwt_buffer), &cwt)) {
+        result = 3;
+        goto Done;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key);
+
+    result = cwt_validate_bench_run(&verify_ctx,
+                                    cwt,
+                                    &validation,
+                                    T_COSE_SUCCESS,
+                                    "ES256 CWT verify and check");
+    if(result) {
+        goto Done;
+    }
+
+    /* A flood of expired tokens */
+    cwt_validate_bench_now = CWT_VALIDATE_BENCH_IAT + 7200;
+    result = cwt_validate_bench_run(&verify_ctx,
+                                    cwt,
+                                    &validation,
+                                    T_COSE_ERR_CWT_EXPIRED,
+                                    "ES256 expired CWT, claims after");
+    if(result) {
+        goto Done;
+    }
+    validation.option_flags |= T_COSE_CWT_CHECK_BEFORE_SIGNATURE;
+    result = cwt_validate_bench_run(&verify_ctx,
+                                    cwt,
+                                    &validation,
+                                    T_COSE_ERR_CWT_EXPIRED,
+                                    "ES256 expired CWT, claims before");
+
+Done:
+    free_key_pair(key);
+#else
+    printf("  (no signing in this crypto adapter)\n");
+#endif /* CWT_VALIDATE_BENCH_ADAPTER */
+
+    return result;
+}
@@ -0,0 +1,263 @@
+/*
+ *  t_cose_hash_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "t_cose_bench.h"
+#include "t_cose_crypto.h"
+#include "t_cose_standard_constants.h"
+#include "sha256.h"
+#include "sha512.h"
+
+
+static const size_t bench_sizes[] = {64, 1024, 16 * 1024, 1024 * 1024};
+
+
+/* Times the bundled SHA-256 with whatever kernel is selected */
+static void bench_b_con_sha256(const char *kernel_name,
+                               const uint8_t *data,
+                               size_t         len)
+{
+    SHA256_CTX ctx;
+    uint8_t    digest[SHA256_BLOCK_SIZE];
+    uint64_t   start;
+    uint64_t   elapsed;
+    uint64_t   ops;
+    char       name[64];
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        sha256_init(&ctx);
+        sha256_update(&ctx, data, len);
+        sha256_final(&ctx, digest);
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+
+    snprintf(name, sizeof(name), "b_con %-7s %7zu bytes", kernel_name, len);
+    bench_report(name, len, ops, elapsed);
+}
+
+
+/* Times the bundled SHA-512 or SHA-384 with whatever kernel is selected */
+static void bench_b_con_sha512(const char    *kernel_name,
+                               int            is_384,
+                               const uint8_t *data,
+                               size_t         len)
+{
+    SHA512_CTX ctx;
+    uint8_t    digest[SHA512_BLOCK_SIZE];
+    uint64_t   start;
+    uint64_t   elapsed;
+    uint64_t   ops;
+    char       name[64];
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(is_384) {
+            sha384_init(&ctx);
+            sha512_update(&ctx, data, len);
+            sha384_final(&ctx, digest);
+        } else {
+            sha512_init(&ctx);
+            sha512_update(&ctx, data, len);
+            sha512_final(&ctx, digest);
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+
+    snprintf(name, sizeof(name), "b_con %s %-7s %7zu bytes",
+             is_384 ? "sha384" : "sha512", kernel_name, len);
+    bench_report(name, len, ops, elapsed);
+}
+
+
+/* Times a hash through the crypto adapter the library is built with */
+static enum t_cose_err_t bench_adapter_hash(int32_t        cose_hash_alg_id,
+                                            const char    *hash_name,
+                                            const uint8_t *data,
+                                            size_t         len)
+{
+    struct t_cose_crypto_hash hash_ctx;
+    enum t_cose_err_t         result;
+    Q_USEFUL_BUF_MAKE_STACK_UB(buffer, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    struct q_useful_buf_c     hash;
+    uint64_t                  start;
+    uint64_t                  elapsed;
+    uint64_t                  ops;
+    char                      name[64];
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_crypto_hash_start(&hash_ctx, cose_hash_alg_id);
+        if(result) {
+            return result;
+        }
+        t_cose_crypto_hash_update(&hash_ctx, (struct q_useful_buf_c){data, len});
+        result = t_cose_crypto_hash_finish(&hash_ctx, buffer, &hash);
+        if(result) {
+            return result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+
+    snprintf(name, sizeof(name), "adapter %s  %7zu bytes", hash_name, len);
+    bench_report(name, len, ops, elapsed);
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t hash_bench(void)
+{
+    static const struct {
+        int         impl;
+        const char *name;
+    } kernels[] = {
+        {SHA256_IMPL_GENERIC, "generic"},
+        {SHA256_IMPL_AVX2,    "avx2"},
+        {SHA256_IMPL_SHANI,   "sha-ni"},
+    };
+    static const struct {
+        int         impl;
+        const char *name;
+    } kernels512[] = {
+        {SHA512_IMPL_GENERIC, "generic"},
+        {SHA512_IMPL_AVX2,    "avx2"},
+    };
+    static const struct {
+        int32_t     cose_hash_alg_id;
+        const char *name;
+    } adapter_hashes[] = {
+        {COSE_ALGORITHM_SHA_256, "sha256"},
+        {COSE_ALGORITHM_SHA_384, "sha384"},
+        {COSE_ALGORITHM_SHA_512, "sha512"},
+    };
+    uint8_t          *data;
+    size_t            i;
+    size_t            k;
+    size_t            max_size;
+    enum t_cose_err_t result;
+
+    max_size = bench_sizes[sizeof(bench_sizes)/sizeof(bench_sizes[0]) - 1];
+    data = malloc(max_size);
+    if(data == NULL) {
+        return -1;
+    }
+    for(i = 0; i < max_size; i++) {
+        data[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    result = T_COSE_SUCCESS;
+    for(k = 0; k < sizeof(kernels)/sizeof(kernels[0]); k++) {
+        if(sha256_set_impl(kernels[k].impl)) {
+            printf("  b_con %-7s not supported on this CPU\n", kernels[k].name);
+            continue;
+        }
+        for(i = 0; i < sizeof(bench_sizes)/sizeof(bench_sizes[0]); i++) {
+            bench_b_con_sha256(kernels[k].name, data, bench_sizes[i]);
+        }
+    }
+    sha256_set_impl(SHA256_IMPL_AUTO);
+
+    for(k = 0; k < sizeof(kernels512)/sizeof(kernels512[0]); k++) {
+        if(sha512_set_impl(kernels512[k].impl)) {
+            printf("  b_con sha512 %-7s not supported on this CPU\n", kernels512[k].name);
+            continue;
+        }
+        for(i = 0; i < sizeof(bench_sizes)/sizeof(bench_sizes[0]); i++) {
+            bench_b_con_sha512(kernels512[k].name, 0, data, bench_sizes[i]);
+        }
+        /* SHA-384 is the same compression function so one size is enough */
+        bench_b_con_sha512(kernels512[k].name, 1, data, 1024);
+    }
+    sha512_set_impl(SHA512_IMPL_AUTO);
+
+    /* With the OpenSSL or PSA adapter this is the comparison against
+     * that library */
+    for(k = 0; k < sizeof(adapter_hashes)/sizeof(adapter_hashes[0]); k++) {
+        for(i = 0; i < sizeof(bench_sizes)/sizeof(bench_sizes[0]); i++) {
+            result = bench_adapter_hash(adapter_hashes[k].cose_hash_alg_id,
+                                        adapter_hashes[k].name,
+                                        data,
+                                        bench_sizes[i]);
+            if(result) {
+                break;
+            }
+        }
+        if(result == T_COSE_ERR_UNSUPPORTED_HASH) {
+            printf("  adapter %s not supported\n", adapter_hashes[k].name);
+            result = T_COSE_SUCCESS;
+        }
+        if(result) {
+            break;
+        }
+    }
+
+    free(data);
+    return (int_fast32_t)result;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t warmup_bench(void)
+{
+    struct t_cose_crypto_hash hash_ctx;
+    enum t_cose_err_t         result;
+    Q_USEFUL_BUF_MAKE_STACK_UB(buffer, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    struct q_useful_buf_c     hash;
+    uint8_t                   data[64];
+    uint64_t                  start;
+    uint64_t                  elapsed;
+
+    memset(data, 0x5a, sizeof(data));
+
+    /* Only meaningful when nothing has used the crypto library yet,
+     * which is why this is the first benchmark */
+    start = bench_now_ns();
+    result = t_cose_crypto_hash_start(&hash_ctx, COSE_ALGORITHM_SHA_256);
+    if(result) {
+        return (int_fast32_t)result;
+    }
+    t_cose_crypto_hash_update(&hash_ctx, (struct q_useful_buf_c){data, sizeof(data)});
+    result = t_cose_crypto_hash_finish(&hash_ctx, buffer, &hash);
+    elapsed = bench_now_ns() - start;
+    if(result) {
+        return (int_fast32_t)result;
+    }
+    bench_report("first adapter sha256 (cold)", 0, 1, elapsed);
+
+    result = bench_adapter_hash(COSE_ALGORITHM_SHA_256, "sha256", data, sizeof(data));
+    if(result) {
+        return (int_fast32_t)result;
+    }
+
+    start = bench_now_ns();
+    result = t_cose_warmup(NULL);
+    elapsed = bench_now_ns() - start;
+    if(result) {
+        return (int_fast32_t)result;
+    }
+    bench_report("t_cose_warmup()", 0, 1, elapsed);
+
+    printf("  after t_cose_warmup():\n");
+    return (int_fast32_t)bench_adapter_hash(COSE_ALGORITHM_SHA_256, "sha256", data, sizeof(data));
+}
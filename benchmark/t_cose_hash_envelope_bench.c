@@ -0,0 +1,239 @@
+/*
+ *  t_cose_hash_envelope_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "t_cose_bench.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_hash_file.h"
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define HASH_ENVELOPE_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+/* Files hashed together, a multiple of the SIMD lanes */
+#define HASH_ENVELOPE_BENCH_FILES 8
+
+/* Big enough that hashing swamps the signature */
+#define HASH_ENVELOPE_BENCH_FILE_SIZE (8 * 1024 * 1024)
+
+static uint8_t hash_envelope_bench_payload[HASH_ENVELOPE_BENCH_FILE_SIZE];
+#ifdef HASH_ENVELOPE_BENCH_ADAPTER
+static uint8_t hash_envelope_bench_message[HASH_ENVELOPE_BENCH_FILE_SIZE + 300];
+#endif
+
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+
+/* Hashes the files until BENCH_MIN_NS has passed, all in one call or
+ * with a call for each */
+static int_fast32_t hash_envelope_bench_files(struct t_cose_hash_file_item *items,
+                                              size_t                        per_call,
+                                              const char                   *name)
+{
+    enum t_cose_err_t result;
+    uint64_t          start;
+    uint64_t          elapsed;
+    uint64_t          ops;
+    size_t            i;
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        for(i = 0; i < HASH_ENVELOPE_BENCH_FILES; i += per_call) {
+            result = t_cose_hash_files(T_COSE_ALGORITHM_SHA_256, &items[i], per_call);
+            if(result) {
+                return 10 + (int_fast32_t)result;
+            }
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(name,
+                 HASH_ENVELOPE_BENCH_FILES * (size_t)HASH_ENVELOPE_BENCH_FILE_SIZE,
+                 ops,
+                 elapsed);
+
+    return 0;
+}
+
+#endif /* T_COSE_DISABLE_HASH_FILE */
+
+
+#ifdef HASH_ENVELOPE_BENCH_ADAPTER
+
+/* Signs and verifies the 8 MB payload as it is, then a hash envelope
+ * of its hash */
+static int_fast32_t hash_envelope_bench_sign(struct t_cose_key key)
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct q_useful_buf_c          payload;
+    struct q_useful_buf_c          message;
+    struct q_useful_buf_c          payload_hash;
+    uint8_t                        hash_buffer[32];
+    enum t_cose_err_t              result;
+    uint64_t                       start;
+    uint64_t                       elapsed;
+    uint64_t                       ops;
+    int                            envelope;
+
+    payload = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(hash_envelope_bench_payload);
+
+    /* A hash of the payload to sign. What it is doesn't matter to
+     * the timing, only its size. */
+    memset(hash_buffer, 0x5a, sizeof(hash_buffer));
+    payload_hash = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(hash_buffer);
+
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key);
+
+    for(envelope = 0; envelope <= 1; envelope++) {
+        t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+        t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+        if(envelope) {
+            t_cose_sign1_set_hash_envelope(&sign_ctx, T_COSE_ALGORITHM_SHA_256, NULL);
+        }
+
+        ops = 0;
+        start = bench_now_ns();
+        do {
+            result = t_cose_sign1_sign(&sign_ctx,
+                                       envelope ? payload_hash : payload,
+                                       Q_USEFUL_BUF_FROM_BYTE_ARRAY(hash_envelope_bench_message),
+                                      &message);
+            if(result) {
+                return 20 + (int_fast32_t)result;
+            }
+            ops++;
+            elapsed = bench_now_ns() - start;
+        } while(elapsed < BENCH_MIN_NS);
+        bench_report(envelope ? "ES256 sign hash envelope" : "ES256 sign 8 MB payload",
+                     0,
+                     ops,
+                     elapsed);
+
+        ops = 0;
+        start = bench_now_ns();
+        do {
+            if(envelope) {
+                result = t_cose_sign1_verify_hash_envelope(&verify_ctx,
+                                                           message,
+                                                           T_COSE_ALGORITHM_SHA_256,
+                                                           payload_hash,
+                                                           NULL);
+            } else {
+                result = t_cose_sign1_verify(&verify_ctx, message, &payload, NULL);
+            }
+            if(result) {
+                return 30 + (int_fast32_t)result;
+            }
+            ops++;
+            elapsed = bench_now_ns() - start;
+        } while(elapsed < BENCH_MIN_NS);
+        bench_report(envelope ? "ES256 verify hash envelope" : "ES256 verify 8 MB payload",
+                     0,
+                     ops,
+                     elapsed);
+    }
+
+    return 0;
+}
+
+#endif /* HASH_ENVELOPE_BENCH_ADAPTER */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t hash_envelope_bench(void)
+{
+    int_fast32_t                 result = 0;
+#ifndef T_COSE_DISABLE_HASH_FILE
+    static uint8_t               hashes[HASH_ENVELOPE_BENCH_FILES][32];
+    static char                  paths[HASH_ENVELOPE_BENCH_FILES][40];
+    struct t_cose_hash_file_item items[HASH_ENVELOPE_BENCH_FILES];
+    size_t                       num_files;
+    int                          fd;
+#endif
+#ifdef HASH_ENVELOPE_BENCH_ADAPTER
+    struct t_cose_key            key;
+#endif
+    size_t                       i;
+
+    for(i = 0; i < sizeof(hash_envelope_bench_payload); i++) {
+        hash_envelope_bench_payload[i] = (uint8_t)(i * 31 + (i >> 12));
+    }
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+    for(num_files = 0; num_files < HASH_ENVELOPE_BENCH_FILES; num_files++) {
+        snprintf(paths[num_files], sizeof(paths[num_files]), "/tmp/t_cose_bench_XXXXXX");
+        fd = mkstemp(paths[num_files]);
+        if(fd < 0) {
+            result = 1;
+            goto Done;
+        }
+        hash_envelope_bench_payload[0] = (uint8_t)num_files;
+        if(write(fd,
+                 hash_envelope_bench_payload,
+                 sizeof(hash_envelope_bench_payload)) != (ssize_t)sizeof(hash_envelope_bench_payload)) {
+            close(fd);
+            unlink(paths[num_files]);
+            result = 2;
+            goto Done;
+        }
+        close(fd);
+        items[num_files].path            = paths[num_files];
+        items[num_files].buffer_for_hash = (struct q_useful_buf){hashes[num_files], sizeof(hashes[num_files])};
+    }
+
+    /* The files are in the page cache after being written, so this
+     * is the hashing, not the disk */
+    result = hash_envelope_bench_files(items, 1, "SHA-256 8 x 8 MB files one by one");
+    if(result) {
+        goto Done;
+    }
+    result = hash_envelope_bench_files(items,
+                                       HASH_ENVELOPE_BENCH_FILES,
+                                       "SHA-256 8 x 8 MB files together");
+    if(result) {
+        goto Done;
+    }
+#endif /* T_COSE_DISABLE_HASH_FILE */
+
+#ifdef HASH_ENVELOPE_BENCH_ADAPTER
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        result = 3;
+        goto Done;
+    }
+    result = hash_envelope_bench_sign(key);
+    free_key_pair(key);
+#else
+    printf("  (no signing in this crypto adapter)\n");
+#endif /* HASH_ENVELOPE_BENCH_ADAPTER */
+
+Done:
+#ifndef T_COSE_DISABLE_HASH_FILE
+    for(i = 0; i < num_files; i++) {
+        unlink(paths[i]);
+    }
+#endif
+    return result;
+}
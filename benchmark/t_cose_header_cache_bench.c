@@ -0,0 +1,131 @@
+/*
+ *  t_cose_header_cache_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define HEADER_CACHE_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+/* About the size of a small CWT */
+static const uint8_t header_cache_bench_payload[100] = {0xa1};
+
+static uint8_t header_cache_bench_message[300];
+
+
+/* Verifies the message until BENCH_MIN_NS has passed */
+static int_fast32_t header_cache_bench_verify(struct t_cose_sign1_verify_ctx *verify_ctx,
+                                              struct q_useful_buf_c           message,
+                                              const char                     *name)
+{
+    struct q_useful_buf_c payload;
+    enum t_cose_err_t     result;
+    uint64_t              start;
+    uint64_t              elapsed;
+    uint64_t              ops;
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_sign1_verify(verify_ctx, message, &payload, NULL);
+        if(result) {
+            return 30 + (int_fast32_t)result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(name, 0, ops, elapsed);
+
+    return 0;
+}
+
+
+/* Signs the payload and verifies it with and without a header cache */
+static int_fast32_t header_cache_bench_pair(uint32_t          sign_options,
+                                            uint32_t          verify_options,
+                                            struct t_cose_key key,
+                                            const char       *uncached_name,
+                                            const char       *cached_name)
+{
+    struct t_cose_sign1_sign_ctx     sign_ctx;
+    struct t_cose_sign1_verify_ctx   verify_ctx;
+    struct t_cose_header_cache       cache;
+    struct t_cose_header_cache_entry entries[4];
+    struct q_useful_buf_c            message;
+    int_fast32_t                     result;
+
+    t_cose_sign1_sign_init(&sign_ctx, sign_options, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+    if(t_cose_sign1_sign(&sign_ctx,
+                         Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(header_cache_bench_payload),
+                         Q_USEFUL_BUF_FROM_BYTE_ARRAY(header_cache_bench_message),
+                        &message)) {
+        return 10;
+    }
+
+    t_cose_sign1_verify_init(&verify_ctx, verify_options);
+    t_cose_sign1_set_verification_key(&verify_ctx, key);
+    result = header_cache_bench_verify(&verify_ctx, message, uncached_name);
+    if(result) {
+        return result;
+    }
+
+    t_cose_header_cache_init(&cache, entries, sizeof(entries) / sizeof(entries[0]));
+    t_cose_sign1_verify_set_header_cache(&verify_ctx, &cache);
+    result = header_cache_bench_verify(&verify_ctx, message, cached_name);
+    t_cose_header_cache_clear(&cache);
+
+    return result;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t header_cache_bench(void)
+{
+    int_fast32_t      result = 0;
+    struct t_cose_key key = T_COSE_NULL_KEY;
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    /* Only decoding and hashing, what the cache saves part of */
+    result = header_cache_bench_pair(T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                                     T_COSE_OPT_ALLOW_SHORT_CIRCUIT,
+                                     key,
+                                     "verify 100 B short-circuit, no cache",
+                                     "verify 100 B short-circuit, header cache");
+    if(result) {
+        return result;
+    }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+#ifdef HEADER_CACHE_BENCH_ADAPTER
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        return 20;
+    }
+    result = header_cache_bench_pair(0,
+                                     0,
+                                     key,
+                                     "verify 100 B ES256, no cache",
+                                     "verify 100 B ES256, header cache");
+    free_key_pair(key);
+#else
+    (void)key;
+#endif /* HEADER_CACHE_BENCH_ADAPTER */
+
+    return result;
+}
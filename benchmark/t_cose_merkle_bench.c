@@ -0,0 +1,194 @@
+/*
+ *  t_cose_merkle_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define MERKLE_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+/* Events per tree, for example a second of log entries */
+#define MERKLE_BENCH_EVENTS 1024
+
+/* About the size of a small log entry */
+#define MERKLE_BENCH_EVENT_SIZE 100
+
+static uint8_t merkle_bench_events[MERKLE_BENCH_EVENTS][MERKLE_BENCH_EVENT_SIZE];
+static struct q_useful_buf_c merkle_bench_payloads[MERKLE_BENCH_EVENTS];
+static uint8_t merkle_bench_tree[T_COSE_MERKLE_TREE_BUFFER_SIZE(MERKLE_BENCH_EVENTS)];
+static uint8_t merkle_bench_receipts[MERKLE_BENCH_EVENTS][600];
+static struct q_useful_buf_c merkle_bench_receipt[MERKLE_BENCH_EVENTS];
+
+
+/* Each event signed and verified on its own, then all of them in one
+ * tree with a receipt each. Times are per event. */
+static int_fast32_t merkle_bench_run(uint32_t          sign_options,
+                                     uint32_t          verify_options,
+                                     struct t_cose_key key,
+                                     const char       *names[4])
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_receipt_cache    cache;
+    struct t_cose_merkle_tree      tree;
+    uint8_t                        message_buffer[300];
+    uint8_t                        signed_root_buffer[300];
+    struct q_useful_buf_c          message;
+    struct q_useful_buf_c          payload;
+    enum t_cose_err_t              result;
+    uint64_t                       start;
+    uint64_t                       elapsed;
+    uint64_t                       ops;
+    size_t                         i;
+
+    t_cose_sign1_sign_init(&sign_ctx, sign_options, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+    t_cose_sign1_verify_init(&verify_ctx, verify_options);
+    t_cose_sign1_set_verification_key(&verify_ctx, key);
+
+    /* --- One signature per event --- */
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_sign1_sign(&sign_ctx,
+                                   merkle_bench_payloads[ops % MERKLE_BENCH_EVENTS],
+                                   Q_USEFUL_BUF_FROM_BYTE_ARRAY(message_buffer),
+                                  &message);
+        if(result) {
+            return 10 + (int_fast32_t)result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(names[0], 0, ops, elapsed);
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_sign1_verify(&verify_ctx, message, &payload, NULL);
+        if(result) {
+            return 20 + (int_fast32_t)result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(names[1], 0, ops, elapsed);
+
+    /* --- One signature per tree and a receipt per event --- */
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_sign1_sign_merkle(&sign_ctx,
+                                          merkle_bench_payloads,
+                                          MERKLE_BENCH_EVENTS,
+                                          Q_USEFUL_BUF_FROM_BYTE_ARRAY(merkle_bench_tree),
+                                          Q_USEFUL_BUF_FROM_BYTE_ARRAY(signed_root_buffer),
+                                         &tree);
+        if(result) {
+            return 30 + (int_fast32_t)result;
+        }
+        for(i = 0; i < MERKLE_BENCH_EVENTS; i++) {
+            result = t_cose_merkle_tree_receipt(&tree,
+                                                i,
+                                                Q_USEFUL_BUF_FROM_BYTE_ARRAY(merkle_bench_receipts[i]),
+                                               &merkle_bench_receipt[i]);
+            if(result) {
+                return 40 + (int_fast32_t)result;
+            }
+        }
+        ops += MERKLE_BENCH_EVENTS;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(names[2], 0, ops, elapsed);
+
+    /* The first receipt verifies the signed root, the rest hit the cache */
+    t_cose_receipt_cache_init(&cache);
+    t_cose_sign1_verify_set_receipt_cache(&verify_ctx, &cache);
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_sign1_verify_receipt(&verify_ctx,
+                                             merkle_bench_receipt[ops % MERKLE_BENCH_EVENTS],
+                                             merkle_bench_payloads[ops % MERKLE_BENCH_EVENTS],
+                                             NULL);
+        if(result) {
+            return 50 + (int_fast32_t)result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(names[3], 0, ops, elapsed);
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t merkle_bench(void)
+{
+    int_fast32_t      result = 0;
+    struct t_cose_key key = T_COSE_NULL_KEY;
+    size_t            i;
+
+    for(i = 0; i < MERKLE_BENCH_EVENTS; i++) {
+        merkle_bench_events[i][0] = (uint8_t)i;
+        merkle_bench_events[i][1] = (uint8_t)(i >> 8);
+        merkle_bench_payloads[i] = (struct q_useful_buf_c){merkle_bench_events[i],
+                                                           MERKLE_BENCH_EVENT_SIZE};
+    }
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    {
+        /* Only the hashing and encoding, what the tree adds */
+        const char *names[4] = {
+            "sign 100 B short-circuit, each",
+            "verify 100 B short-circuit, each",
+            "sign 100 B short-circuit, 1024-event tree",
+            "verify short-circuit receipt, cached"
+        };
+        result = merkle_bench_run(T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                                  T_COSE_OPT_ALLOW_SHORT_CIRCUIT,
+                                  key,
+                                  names);
+        if(result) {
+            return result;
+        }
+    }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+#ifdef MERKLE_BENCH_ADAPTER
+    {
+        const char *names[4] = {
+            "sign 100 B ES256, each",
+            "verify 100 B ES256, each",
+            "sign 100 B ES256, 1024-event tree",
+            "verify ES256 receipt, cached"
+        };
+        if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+            return 60;
+        }
+        result = merkle_bench_run(0, 0, key, names);
+        free_key_pair(key);
+    }
+#else
+    (void)key;
+#endif /* MERKLE_BENCH_ADAPTER */
+
+    return result;
+}
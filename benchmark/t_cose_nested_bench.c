@@ -0,0 +1,350 @@
+/*
+ *  t_cose_nested_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "t_cose_bench.h"
+#include "qcbor/qcbor_encode.h"
+#include "qcbor/qcbor_spiffy_decode.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_nested.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define NESTED_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+#ifdef NESTED_BENCH_ADAPTER
+
+/* Submodule tokens in the EAT, labeled 1 to NESTED_BENCH_SUBMODS */
+#define NESTED_BENCH_SUBMODS 8
+
+/* Most threads in the pool */
+#define NESTED_BENCH_MAX_THREADS 8
+
+/* An ES256 COSE_Sign1 of a small payload */
+#define NESTED_BENCH_TOKEN_SIZE 200
+
+static const uint8_t nested_bench_nonce[16] = {
+    0x0b, 0x71, 0x5a, 0x3c, 0x91, 0x22, 0x7e, 0x04,
+    0xd8, 0x6f, 0x13, 0xa0, 0x47, 0xee, 0x29, 0xb5};
+
+
+/* A worker pool that verifies the slices of one batch at a time */
+struct nested_bench_pool {
+    pthread_mutex_t                        lock;
+    pthread_cond_t                         work;
+    pthread_cond_t                         done;
+    pthread_t                              threads[NESTED_BENCH_MAX_THREADS];
+    int                                    num_threads;
+    int                                    next_slice;
+    int                                    pending;
+    uint64_t                               generation;
+    bool                                   stop;
+
+    /* The batch being verified */
+    const struct t_cose_sign1_verifier    *verifier;
+    struct t_cose_sign1_verify_batch_item *items;
+    size_t                                 num_items;
+};
+
+
+/* Verifies a slice of each batch it is woken for */
+static void *nested_bench_worker_main(void *arg)
+{
+    struct nested_bench_pool       *pool = arg;
+    struct t_cose_sign1_verify_call call;
+    uint64_t                        seen;
+    size_t                          first;
+    size_t                          end;
+    int                             slice;
+
+    t_cose_sign1_verify_call_init(&call, NULL_Q_USEFUL_BUF);
+    seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for(;;) {
+        while(pool->generation == seen && !pool->stop) {
+            pthread_cond_wait(&pool->work, &pool->lock);
+        }
+        if(pool->stop) {
+            break;
+        }
+        seen  = pool->generation;
+        slice = pool->next_slice++;
+        first = pool->num_items * (size_t)slice / (size_t)pool->num_threads;
+        end   = pool->num_items * (size_t)(slice + 1) / (size_t)pool->num_threads;
+        pthread_mutex_unlock(&pool->lock);
+
+        if(end > first) {
+            t_cose_sign1_verifier_verify_batch(pool->verifier, &call, &pool->items[first], end - first);
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        pool->pending--;
+        if(pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+
+/* The dispatch function in t_cose_nested_config for the pool */
+static enum t_cose_err_t
+nested_bench_dispatch(void                                  *dispatch_ctx,
+                      const struct t_cose_sign1_verifier    *verifier,
+                      struct t_cose_sign1_verify_batch_item *items,
+                      size_t                                 num_items)
+{
+    struct nested_bench_pool *pool = dispatch_ctx;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->verifier   = verifier;
+    pool->items      = items;
+    pool->num_items  = num_items;
+    pool->next_slice = 0;
+    pool->pending    = pool->num_threads;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work);
+    while(pool->pending > 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return T_COSE_SUCCESS;
+}
+
+
+static int_fast32_t nested_bench_pool_start(struct nested_bench_pool *pool, int num_threads)
+{
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->generation  = 0;
+    pool->stop        = false;
+    pool->num_threads = 0;
+    for(; pool->num_threads < num_threads; pool->num_threads++) {
+        if(pthread_create(&pool->threads[pool->num_threads], NULL, nested_bench_worker_main, pool)) {
+            fprintf(stderr, "pthread_create failed\n");
+            return 40;
+        }
+    }
+    return 0;
+}
+
+
+static void nested_bench_pool_stop(struct nested_bench_pool *pool)
+{
+    int i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+    for(i = 0; i < pool->num_threads; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+
+/* Verify the EAT, decode the submodules with QCBOR and verify each
+ * token in turn, as without t_cose_nested */
+static int_fast32_t nested_bench_serial(const struct t_cose_sign1_verifier *verifier,
+                                        struct q_useful_buf_c               eat)
+{
+    QCBORDecodeContext    decode_context;
+    struct q_useful_buf_c payload;
+    struct q_useful_buf_c tokens[NESTED_BENCH_SUBMODS];
+    struct q_useful_buf_c inner_payload;
+    int64_t               i;
+
+    if(t_cose_sign1_verifier_verify(verifier, NULL, eat, NULL_Q_USEFUL_BUF_C, &payload, NULL)) {
+        return 10;
+    }
+    QCBORDecode_Init(&decode_context, payload, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterMap(&decode_context, NULL);
+    QCBORDecode_EnterMapFromMapN(&decode_context, 266);
+    for(i = 0; i < NESTED_BENCH_SUBMODS; i++) {
+        QCBORDecode_GetByteStringInMapN(&decode_context, i + 1, &tokens[i]);
+    }
+    QCBORDecode_ExitMap(&decode_context);
+    QCBORDecode_ExitMap(&decode_context);
+    if(QCBORDecode_Finish(&decode_context)) {
+        return 11;
+    }
+    for(i = 0; i < NESTED_BENCH_SUBMODS; i++) {
+        if(t_cose_sign1_verifier_verify(verifier, NULL, tokens[i], NULL_Q_USEFUL_BUF_C, &inner_payload, NULL)) {
+            return 12;
+        }
+    }
+    return 0;
+}
+
+
+static int_fast32_t nested_bench_measure(const struct t_cose_sign1_verifier *verifier,
+                                         const struct t_cose_nested_config  *config,
+                                         struct q_useful_buf_c               eat,
+                                         const char                         *name)
+{
+    struct t_cose_nested_result results[NESTED_BENCH_SUBMODS + 1];
+    size_t                      num_results;
+    int_fast32_t                result;
+    uint64_t                    start;
+    uint64_t                    elapsed;
+    uint64_t                    ops;
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(config == NULL) {
+            result = nested_bench_serial(verifier, eat);
+        } else {
+            result = 0;
+            if(t_cose_sign1_verifier_verify_nested(verifier, NULL, eat, config,
+                                                   results, NESTED_BENCH_SUBMODS + 1,
+                                                   &num_results) ||
+               num_results != NESTED_BENCH_SUBMODS + 1) {
+                result = 20;
+            }
+        }
+        if(result) {
+            return result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(name, 0, ops, elapsed);
+
+    return 0;
+}
+
+#endif /* NESTED_BENCH_ADAPTER */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t nested_bench(void)
+{
+    int_fast32_t result = 0;
+
+#ifdef NESTED_BENCH_ADAPTER
+    static uint8_t                   token_buffers[NESTED_BENCH_SUBMODS][NESTED_BENCH_TOKEN_SIZE];
+    static uint8_t                   eat_buffer[NESTED_BENCH_SUBMODS * NESTED_BENCH_TOKEN_SIZE + 200];
+    static const struct t_cose_nested_label submods_path[] = {{266, {NULL, 0}}};
+    struct t_cose_sign1_sign_ctx     sign_ctx;
+    struct t_cose_sign1_verifier     verifier;
+    struct t_cose_nested_path        path;
+    struct t_cose_nested_config      config;
+    struct t_cose_claims_index_entry entries[NESTED_BENCH_SUBMODS + 4];
+    struct nested_bench_pool         pool;
+    struct t_cose_key                key;
+    QCBOREncodeContext               cbor_encode;
+    uint8_t                          payload_buffer[NESTED_BENCH_SUBMODS * NESTED_BENCH_TOKEN_SIZE + 100];
+    struct q_useful_buf_c            payload;
+    struct q_useful_buf_c            tokens[NESTED_BENCH_SUBMODS];
+    struct q_useful_buf_c            eat;
+    char                             name[64];
+    long                             cpus;
+    int                              max_threads;
+    int                              num_threads;
+    int64_t                          i;
+
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        return 1;
+    }
+    t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+
+    /* An EAT with a token for each submodule, all with the same key */
+    for(i = 0; i < NESTED_BENCH_SUBMODS; i++) {
+        QCBOREncode_Init(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY(payload_buffer));
+        QCBOREncode_OpenMap(&cbor_encode);
+        QCBOREncode_AddBytesToMapN(&cbor_encode, 10, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(nested_bench_nonce));
+        QCBOREncode_AddInt64ToMapN(&cbor_encode, -75000, i);
+        QCBOREncode_CloseMap(&cbor_encode);
+        if(QCBOREncode_Finish(&cbor_encode, &payload) ||
+           t_cose_sign1_sign(&sign_ctx, payload, Q_USEFUL_BUF_FROM_BYTE_ARRAY(token_buffers[i]), &tokens[i])) {
+            result = 2;
+            goto Done;
+        }
+    }
+    QCBOREncode_Init(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY(payload_buffer));
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddBytesToMapN(&cbor_encode, 10, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(nested_bench_nonce));
+    QCBOREncode_OpenMapInMapN(&cbor_encode, 266);
+    for(i = 0; i < NESTED_BENCH_SUBMODS; i++) {
+        QCBOREncode_AddBytesToMapN(&cbor_encode, i + 1, tokens[i]);
+    }
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &payload) ||
+       t_cose_sign1_sign(&sign_ctx, payload, Q_USEFUL_BUF_FROM_BYTE_ARRAY(eat_buffer), &eat)) {
+        result = 3;
+        goto Done;
+    }
+
+    t_cose_sign1_verifier_init(&verifier, 0);
+    t_cose_sign1_verifier_set_verification_key(&verifier, key);
+    path.labels     = submods_path;
+    path.num_labels = 1;
+    path.flags      = T_COSE_NESTED_EACH;
+    path.verifier   = &verifier;
+    t_cose_nested_config_init(&config, &path, 1, entries, NESTED_BENCH_SUBMODS + 4);
+
+    result = nested_bench_measure(&verifier, NULL, eat, "ES256 EAT + 8 serial, QCBOR");
+    if(result) {
+        goto Done;
+    }
+    result = nested_bench_measure(&verifier, &config, eat, "ES256 EAT + 8 nested, 1 thread");
+    if(result) {
+        goto Done;
+    }
+
+    /* At least 2 threads so the pool is run even on one CPU */
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("  (%ld CPUs online)\n", cpus);
+    max_threads = cpus > 2 ? (int)cpus : 2;
+    if(max_threads > NESTED_BENCH_MAX_THREADS) {
+        max_threads = NESTED_BENCH_MAX_THREADS;
+    }
+    for(num_threads = 2; num_threads <= max_threads; num_threads *= 2) {
+        result = nested_bench_pool_start(&pool, num_threads);
+        if(result == 0) {
+            config.dispatch     = nested_bench_dispatch;
+            config.dispatch_ctx = &pool;
+            snprintf(name, sizeof(name), "ES256 EAT + 8 nested, %d-thread pool", num_threads);
+            result = nested_bench_measure(&verifier, &config, eat, name);
+        }
+        nested_bench_pool_stop(&pool);
+        if(result) {
+            break;
+        }
+    }
+
+Done:
+    free_key_pair(key);
+#else
+    printf("  (no signing in this crypto adapter)\n");
+#endif /* NESTED_BENCH_ADAPTER */
+
+    return result;
+}
@@ -0,0 +1,154 @@
+/*
+ *  t_cose_policy_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define POLICY_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+#ifdef POLICY_BENCH_ADAPTER
+
+/* Big enough that hashing it is most of the cost of rejecting it */
+#define POLICY_BENCH_PAYLOAD_SIZE 65536
+
+/* What the policies allow, well under the forged messages */
+#define POLICY_BENCH_LIMIT 4096
+
+static uint8_t policy_bench_payload[POLICY_BENCH_PAYLOAD_SIZE];
+static uint8_t policy_bench_message[POLICY_BENCH_PAYLOAD_SIZE + 200];
+
+
+/* Verifies the forged message until BENCH_MIN_NS has passed,
+ * checking it is rejected with the expected error each time */
+static int_fast32_t policy_bench_reject(struct t_cose_sign1_verify_ctx *verify_ctx,
+                                        struct q_useful_buf_c           forged,
+                                        enum t_cose_err_t               expected,
+                                        const char                     *name)
+{
+    struct q_useful_buf_c payload;
+    enum t_cose_err_t     result;
+    uint64_t              start;
+    uint64_t              elapsed;
+    uint64_t              ops;
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_sign1_verify(verify_ctx, forged, &payload, NULL);
+        if(result != expected) {
+            return 30 + (int_fast32_t)result;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report(name, 0, ops, elapsed);
+
+    return 0;
+}
+
+#endif /* POLICY_BENCH_ADAPTER */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t policy_bench(void)
+{
+    int_fast32_t result = 0;
+
+#ifdef POLICY_BENCH_ADAPTER
+    static const struct t_cose_sign1_policy_alg eddsa_only[] = {
+        {T_COSE_ALGORITHM_EDDSA, 64}
+    };
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_policy     policy;
+    struct t_cose_key              key;
+    struct q_useful_buf_c          forged;
+    enum t_cose_err_t              err;
+
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        return 10;
+    }
+
+    /* A real message with one bit of the signature changed, as an
+     * attacker with no key would make */
+    t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+    err = t_cose_sign1_sign(&sign_ctx,
+                            Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(policy_bench_payload),
+                            Q_USEFUL_BUF_FROM_BYTE_ARRAY(policy_bench_message),
+                           &forged);
+    if(err) {
+        result = 11;
+        goto Done;
+    }
+    policy_bench_message[forged.len - 1] ^= 0x01;
+
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key);
+
+    /* Decoding, hashing 64 KB and the signature check */
+    result = policy_bench_reject(&verify_ctx,
+                                 forged,
+                                 T_COSE_ERR_SIG_VERIFY,
+                                 "reject forged 64 KB, no policy");
+    if(result) {
+        goto Done;
+    }
+
+    /* The rest are rejected before any hashing, from the cheapest
+     * check to the most expensive */
+    t_cose_sign1_policy_init(&policy);
+    t_cose_sign1_verify_set_policy(&verify_ctx, &policy);
+
+    policy.max_message_size = POLICY_BENCH_LIMIT;
+    result = policy_bench_reject(&verify_ctx,
+                                 forged,
+                                 T_COSE_ERR_POLICY_SIZE,
+                                 "reject forged 64 KB, message size");
+    if(result) {
+        goto Done;
+    }
+    t_cose_sign1_policy_init(&policy);
+
+    policy.algorithms     = eddsa_only;
+    policy.num_algorithms = sizeof(eddsa_only) / sizeof(eddsa_only[0]);
+    result = policy_bench_reject(&verify_ctx,
+                                 forged,
+                                 T_COSE_ERR_POLICY_ALGORITHM,
+                                 "reject forged 64 KB, algorithm");
+    if(result) {
+        goto Done;
+    }
+    t_cose_sign1_policy_init(&policy);
+
+    policy.max_payload_size = POLICY_BENCH_LIMIT;
+    result = policy_bench_reject(&verify_ctx,
+                                 forged,
+                                 T_COSE_ERR_POLICY_SIZE,
+                                 "reject forged 64 KB, payload size");
+
+Done:
+    free_key_pair(key);
+#else
+    printf("  (no verification in this crypto adapter)\n");
+#endif /* POLICY_BENCH_ADAPTER */
+
+    return result;
+}
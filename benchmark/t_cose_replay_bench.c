@@ -0,0 +1,237 @@
+/*
+ *  t_cose_replay_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "t_cose_bench.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_replay_cache.h"
+
+
+/* Most threads run at once */
+#define REPLAY_BENCH_MAX_THREADS 64
+
+/* Tokens entered in each measurement, split between the threads */
+#define REPLAY_BENCH_TOKENS (1U << 20)
+
+/* Tokens live up to a minute and are spread over it */
+#define REPLAY_BENCH_TTL     60
+#define REPLAY_BENCH_BUCKETS 4
+#define REPLAY_BENCH_NOW     1830297600
+
+
+/* The ways the threads use the cache */
+enum replay_bench_mode {
+    /* Each thread enters its own new tokens */
+    REPLAY_BENCH_INSERT,
+    /* Each thread checks the tokens it entered, which are replays */
+    REPLAY_BENCH_REPLAYED,
+    /* All threads enter the same new tokens at once */
+    REPLAY_BENCH_CONTENDED
+};
+
+/* What all the threads in one measurement share */
+struct replay_bench_run {
+    pthread_barrier_t           start;
+    struct t_cose_replay_cache *cache;
+    enum replay_bench_mode      mode;
+    uint32_t                    tokens_per_thread;
+};
+
+/* One thread's part of a measurement */
+struct replay_bench_worker {
+    pthread_t                thread;
+    struct replay_bench_run *run;
+    uint32_t                 index;
+    uint64_t                 accepted;
+    enum t_cose_err_t        result;
+};
+
+
+/* Checks this thread's tokens against the cache */
+static void *replay_bench_worker_main(void *arg)
+{
+    struct replay_bench_worker *worker = arg;
+    struct replay_bench_run    *run    = worker->run;
+    uint8_t                     cti[8];
+    enum t_cose_err_t           result;
+    uint32_t                    token;
+    uint32_t                    i;
+
+    worker->accepted = 0;
+    worker->result   = T_COSE_SUCCESS;
+
+    pthread_barrier_wait(&run->start);
+
+    for(i = 0; i < run->tokens_per_thread; i++) {
+        token = run->mode == REPLAY_BENCH_CONTENDED ? i : worker->index * run->tokens_per_thread + i;
+        cti[0] = 0xbe;
+        cti[1] = 0x4c;
+        cti[2] = 0x11;
+        cti[3] = 0x0a;
+        cti[4] = (uint8_t)(token >> 24);
+        cti[5] = (uint8_t)(token >> 16);
+        cti[6] = (uint8_t)(token >> 8);
+        cti[7] = (uint8_t)token;
+        result = t_cose_replay_cache_check(run->cache,
+                                           (struct q_useful_buf_c){cti, sizeof(cti)},
+                                           REPLAY_BENCH_NOW + 1 + token % REPLAY_BENCH_TTL,
+                                           REPLAY_BENCH_NOW);
+        if(result == T_COSE_SUCCESS) {
+            worker->accepted++;
+        } else if(result != T_COSE_ERR_CWT_REPLAYED) {
+            worker->result = result;
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+
+/* Runs num_threads threads over the cache and reports the total rate */
+static int_fast32_t replay_bench_measure(struct replay_bench_run *run,
+                                         int                      num_threads,
+                                         const char              *mode_name)
+{
+    static struct replay_bench_worker workers[REPLAY_BENCH_MAX_THREADS];
+    char                              name[64];
+    uint64_t                          start;
+    uint64_t                          elapsed;
+    uint64_t                          accepted;
+    uint64_t                          expected;
+    int_fast32_t                      result;
+    int                               i;
+
+    if(run->mode == REPLAY_BENCH_CONTENDED) {
+        run->tokens_per_thread = REPLAY_BENCH_TOKENS / REPLAY_BENCH_MAX_THREADS;
+    } else {
+        run->tokens_per_thread = REPLAY_BENCH_TOKENS / (uint32_t)num_threads;
+    }
+
+    if(pthread_barrier_init(&run->start, NULL, (unsigned)num_threads + 1)) {
+        return 20;
+    }
+    for(i = 0; i < num_threads; i++) {
+        workers[i].run   = run;
+        workers[i].index = (uint32_t)i;
+        if(pthread_create(&workers[i].thread, NULL, replay_bench_worker_main, &workers[i])) {
+            /* The barrier can't be released with fewer threads, so
+             * this is fatal */
+            fprintf(stderr, "pthread_create failed\n");
+            return 21;
+        }
+    }
+
+    pthread_barrier_wait(&run->start);
+    start = bench_now_ns();
+
+    result   = 0;
+    accepted = 0;
+    for(i = 0; i < num_threads; i++) {
+        pthread_join(workers[i].thread, NULL);
+        accepted += workers[i].accepted;
+        if(workers[i].result) {
+            result = 30 + (int_fast32_t)workers[i].result;
+        }
+    }
+    elapsed = bench_now_ns() - start;
+    pthread_barrier_destroy(&run->start);
+    if(result) {
+        return result;
+    }
+
+    /* Each new token is accepted exactly once however many threads
+     * check it */
+    switch(run->mode) {
+    case REPLAY_BENCH_INSERT:    expected = (uint64_t)run->tokens_per_thread * (uint64_t)num_threads; break;
+    case REPLAY_BENCH_REPLAYED:  expected = 0; break;
+    default:                     expected = run->tokens_per_thread; break;
+    }
+    if(accepted != expected) {
+        return 40;
+    }
+
+    snprintf(name, sizeof(name), "replay %-9s %2d thread%s",
+             mode_name,
+             num_threads,
+             num_threads == 1 ? " " : "s");
+    bench_report(name, 0, (uint64_t)run->tokens_per_thread * (uint64_t)num_threads, elapsed);
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t replay_bench(void)
+{
+    struct t_cose_replay_cache cache;
+    struct replay_bench_run    run;
+    uint64_t                  *slots;
+    size_t                     num_slots;
+    int_fast32_t               result;
+    long                       cpus;
+    int                        max_threads;
+    int                        num_threads;
+
+    /* Sized for all the tokens of a measurement being live at once */
+    num_slots = T_COSE_REPLAY_CACHE_SLOTS(REPLAY_BENCH_TOKENS / REPLAY_BENCH_TTL + 1,
+                                          REPLAY_BENCH_TTL);
+    slots = malloc(num_slots * sizeof(uint64_t));
+    if(slots == NULL) {
+        return 10;
+    }
+    run.cache = &cache;
+
+    /* Up to twice the CPUs, but at least 8 so there's contention to
+     * see even on a small machine */
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    max_threads = cpus > 4 ? (int)cpus * 2 : 8;
+    if(max_threads > REPLAY_BENCH_MAX_THREADS) {
+        max_threads = REPLAY_BENCH_MAX_THREADS;
+    }
+    printf("  (%ld CPUs online)\n", cpus);
+
+    result = 0;
+    for(num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        if(t_cose_replay_cache_init(&cache, slots, num_slots, REPLAY_BENCH_TTL, REPLAY_BENCH_BUCKETS)) {
+            result = 11;
+            break;
+        }
+        run.mode = REPLAY_BENCH_INSERT;
+        result = replay_bench_measure(&run, num_threads, "insert");
+        if(result) {
+            break;
+        }
+        run.mode = REPLAY_BENCH_REPLAYED;
+        result = replay_bench_measure(&run, num_threads, "replayed");
+        if(result) {
+            break;
+        }
+
+        if(t_cose_replay_cache_init(&cache, slots, num_slots, REPLAY_BENCH_TTL, REPLAY_BENCH_BUCKETS)) {
+            result = 12;
+            break;
+        }
+        run.mode = REPLAY_BENCH_CONTENDED;
+        result = replay_bench_measure(&run, num_threads, "contended");
+        if(result) {
+            break;
+        }
+    }
+
+    free(slots);
+
+    return result;
+}
@@ -0,0 +1,195 @@
+/*
+ *  t_cose_sign_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "t_cose_crypto.h"
+#include "t_cose_standard_constants.h"
+#include "p256.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define SIGN_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+/* The private scalar of the test keys in test/ */
+static const uint8_t sign_bench_private_key[] = {
+    0xd9, 0xb5, 0xe7, 0x1f, 0x77, 0x28, 0xbf, 0xe5,
+    0x63, 0xa9, 0xdc, 0x93, 0x75, 0x62, 0x27, 0x7e,
+    0x32, 0x7d, 0x98, 0xd9, 0x94, 0x80, 0xf3, 0xdc,
+    0x92, 0x41, 0xe5, 0x74, 0x2a, 0xc4, 0x58, 0x89
+};
+
+/* Any 32 bytes will do as the hash */
+static const uint8_t sign_bench_hash[32] = {
+    0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1,
+    0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+    0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+    0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf
+};
+
+
+/* Times the P-256 engine directly */
+static int_fast32_t bench_p256_engine(void)
+{
+    struct p256_key key;
+    uint8_t         sig[P256_SIGNATURE_SIZE];
+    uint64_t        start;
+    uint64_t        elapsed;
+    uint64_t        ops;
+
+    if(p256_key_from_private(&key, sign_bench_private_key)) {
+        return 1;
+    }
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(p256_sign(&key, sign_bench_hash, sizeof(sign_bench_hash), sig)) {
+            return 2;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report("p256 sign", 0, ops, elapsed);
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(p256_verify(&key, sign_bench_hash, sizeof(sign_bench_hash), sig)) {
+            return 3;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report("p256 verify", 0, ops, elapsed);
+
+#ifdef P256_HAVE_NONCE_POOL
+    {
+        static struct p256_nonce_slot slots[256];
+        struct p256_nonce_pool        pool;
+        uint64_t                      fill_ns;
+        uint64_t                      fill_ops;
+        size_t                        i;
+
+        if(p256_nonce_pool_init(&pool, slots, 256)) {
+            return 4;
+        }
+        p256_key_set_nonce_pool(&key, &pool);
+
+        /* Only the signing is timed. The pool is refilled outside
+         * the timing, which is what a background thread would do. */
+        ops      = 0;
+        elapsed  = 0;
+        fill_ops = 0;
+        fill_ns  = 0;
+        do {
+            start = bench_now_ns();
+            fill_ops += p256_nonce_pool_fill(&pool, 256);
+            fill_ns += bench_now_ns() - start;
+
+            start = bench_now_ns();
+            for(i = 0; i < 256; i++) {
+                if(p256_sign(&key, sign_bench_hash, sizeof(sign_bench_hash), sig)) {
+                    return 5;
+                }
+            }
+            elapsed += bench_now_ns() - start;
+            ops += 256;
+        } while(elapsed < BENCH_MIN_NS && fill_ns < 10 * BENCH_MIN_NS);
+        bench_report("p256 sign from nonce pool", 0, ops, elapsed);
+        bench_report("p256 nonce pool fill (per nonce)", 0, fill_ops, fill_ns);
+
+        p256_nonce_pool_wipe(&pool);
+    }
+#endif /* P256_HAVE_NONCE_POOL */
+
+    p256_key_wipe(&key);
+
+    return 0;
+}
+
+
+#ifdef SIGN_BENCH_ADAPTER
+/* Times ES256 through the crypto adapter of the configured provider */
+static int_fast32_t bench_adapter_es256(void)
+{
+    struct t_cose_key     key;
+    uint8_t               sig_buf[T_COSE_EC_P256_SIG_SIZE];
+    struct q_useful_buf_c sig;
+    struct q_useful_buf_c hash = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(sign_bench_hash);
+    enum t_cose_err_t     result;
+    uint64_t              start;
+    uint64_t              elapsed;
+    uint64_t              ops;
+
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        return 10;
+    }
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_crypto_sign(T_COSE_ALGORITHM_ES256,
+                                    key,
+                                    hash,
+                                    Q_USEFUL_BUF_FROM_BYTE_ARRAY(sig_buf),
+                                    &sig);
+        if(result) {
+            goto Done;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report("adapter ES256 sign", 0, ops, elapsed);
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        result = t_cose_crypto_verify(T_COSE_ALGORITHM_ES256,
+                                      key,
+                                      NULL_Q_USEFUL_BUF_C,
+                                      hash,
+                                      sig);
+        if(result) {
+            goto Done;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report("adapter ES256 verify", 0, ops, elapsed);
+
+Done:
+    free_key_pair(key);
+    return result;
+}
+#endif /* SIGN_BENCH_ADAPTER */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t sign_bench(void)
+{
+    int_fast32_t result;
+
+    result = bench_p256_engine();
+    if(result) {
+        return result;
+    }
+
+#ifdef SIGN_BENCH_ADAPTER
+    result = bench_adapter_es256();
+#endif
+
+    return result;
+}
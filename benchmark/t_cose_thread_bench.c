@@ -0,0 +1,294 @@
+/*
+ *  t_cose_thread_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "t_cose_bench.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose_crypto.h"
+#include "t_cose_standard_constants.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define THREAD_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+#ifdef THREAD_BENCH_ADAPTER
+
+/* Most threads run at once */
+#define THREAD_BENCH_MAX_THREADS 64
+
+/* Big enough for RSA keys up to 4096 bits */
+#define THREAD_BENCH_SIG_SIZE 512
+
+/* A COSE_Sign1 of thread_bench_hash */
+#define THREAD_BENCH_COSE_SIZE (THREAD_BENCH_SIG_SIZE + 64)
+
+/* Any 32 bytes will do as the hash */
+static const uint8_t thread_bench_hash[32] = {
+    0x5d, 0x41, 0x40, 0x2a, 0xbc, 0x4b, 0x2a, 0x76,
+    0xb9, 0x71, 0x9d, 0x91, 0x10, 0x17, 0xc5, 0x92,
+    0x28, 0xb4, 0x6e, 0xd3, 0xc2, 0x01, 0x0d, 0x55,
+    0x1c, 0x3b, 0x4f, 0x83, 0xe8, 0x3a, 0x35, 0x9a
+};
+
+/* What all the threads in one measurement share */
+struct thread_bench_run {
+    pthread_barrier_t start;
+    int32_t           cose_alg;
+    struct t_cose_key key;
+    bool              replicas;
+    bool              deterministic;
+
+    /* If not NULL, whole COSE_Sign1 messages are made with this one
+     * configuration by all the threads */
+    const struct t_cose_sign1_signer *signer;
+};
+
+/* One thread's part of a measurement */
+struct thread_bench_worker {
+    pthread_t                thread;
+    struct thread_bench_run *run;
+    uint64_t                 ops;
+    enum t_cose_err_t        result;
+};
+
+
+/* Signs with the shared key until BENCH_MIN_NS has passed */
+static void *thread_bench_worker_main(void *arg)
+{
+    struct thread_bench_worker *worker = arg;
+    struct thread_bench_run    *run    = worker->run;
+    uint8_t                     sig_buf[THREAD_BENCH_COSE_SIZE];
+    struct q_useful_buf_c       sig;
+    struct q_useful_buf_c       hash = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(thread_bench_hash);
+    uint64_t                    start;
+
+    worker->ops    = 0;
+    worker->result = T_COSE_SUCCESS;
+
+    if(run->replicas) {
+        worker->result = t_cose_set_thread_key_replicas(true);
+    }
+    pthread_barrier_wait(&run->start);
+    if(worker->result) {
+        return NULL;
+    }
+
+    start = bench_now_ns();
+    do {
+        if(run->signer != NULL) {
+            worker->result = t_cose_sign1_signer_sign(run->signer,
+                                                      NULL,
+                                                      NULL_Q_USEFUL_BUF_C,
+                                                      hash,
+                                                      Q_USEFUL_BUF_FROM_BYTE_ARRAY(sig_buf),
+                                                      &sig);
+        } else if(run->deterministic) {
+            worker->result = t_cose_crypto_sign_deterministic(run->cose_alg,
+                                                              run->key,
+                                                              hash,
+                                                              Q_USEFUL_BUF_FROM_BYTE_ARRAY(sig_buf),
+                                                              &sig);
+        } else {
+            worker->result = t_cose_crypto_sign(run->cose_alg,
+                                                run->key,
+                                                hash,
+                                                Q_USEFUL_BUF_FROM_BYTE_ARRAY(sig_buf),
+                                                &sig);
+        }
+        if(worker->result) {
+            break;
+        }
+        worker->ops++;
+    } while(bench_now_ns() - start < BENCH_MIN_NS);
+
+    /* Releases the replica and its reference to the shared key */
+    if(run->replicas) {
+        t_cose_set_thread_key_replicas(false);
+    }
+
+    return NULL;
+}
+
+
+/* Runs num_threads signing threads and reports the total rate */
+static int_fast32_t thread_bench_measure(struct thread_bench_run *run,
+                                         const char              *alg_name,
+                                         int                      num_threads,
+                                         const char              *mode)
+{
+    static struct thread_bench_worker workers[THREAD_BENCH_MAX_THREADS];
+    char                              name[64];
+    uint64_t                          start;
+    uint64_t                          elapsed;
+    uint64_t                          ops;
+    int_fast32_t                      result;
+    int                               started;
+    int                               i;
+
+    if(pthread_barrier_init(&run->start, NULL, (unsigned)num_threads + 1)) {
+        return 20;
+    }
+
+    result = 0;
+    for(started = 0; started < num_threads; started++) {
+        workers[started].run = run;
+        if(pthread_create(&workers[started].thread,
+                          NULL,
+                          thread_bench_worker_main,
+                          &workers[started])) {
+            /* The barrier can't be released with fewer threads, so
+             * this is fatal */
+            fprintf(stderr, "pthread_create failed\n");
+            return 21;
+        }
+    }
+
+    pthread_barrier_wait(&run->start);
+    start = bench_now_ns();
+
+    ops = 0;
+    for(i = 0; i < started; i++) {
+        pthread_join(workers[i].thread, NULL);
+        ops += workers[i].ops;
+        if(workers[i].result) {
+            result = 30 + (int_fast32_t)workers[i].result;
+        }
+    }
+    elapsed = bench_now_ns() - start;
+    pthread_barrier_destroy(&run->start);
+
+    if(result == 0) {
+        /* The ns/op column is the aggregate so op/s is the total
+         * throughput of all the threads */
+        snprintf(name, sizeof(name), "%s sign %2d thread%s, %s",
+                 alg_name,
+                 num_threads,
+                 num_threads == 1 ? " " : "s",
+                 mode);
+        bench_report(name, 0, ops, elapsed);
+    }
+
+    return result;
+}
+
+
+/* Each thread count with the shared key, with replicas, for ECDSA
+ * with RFC 6979 nonces that don't use the random number generator
+ * and making whole COSE_Sign1 messages with one shared signer */
+static int_fast32_t thread_bench_alg(int32_t cose_alg, const char *alg_name)
+{
+    struct thread_bench_run    run;
+    struct t_cose_sign1_signer signer;
+    uint8_t                    sig_buf[THREAD_BENCH_SIG_SIZE];
+    struct q_useful_buf_c      sig;
+    struct q_useful_buf_c      hash = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(thread_bench_hash);
+    bool                       have_deterministic;
+    int_fast32_t               result;
+    long                       cpus;
+    int                        max_threads;
+    int                        num_threads;
+
+    if(make_key_pair(cose_alg, &run.key)) {
+        return 10;
+    }
+    run.cose_alg = cose_alg;
+    run.signer   = NULL;
+
+    if(t_cose_sign1_signer_init(&signer, 0, cose_alg)) {
+        free_key_pair(run.key);
+        return 11;
+    }
+    t_cose_sign1_signer_set_signing_key(&signer, run.key, NULL_Q_USEFUL_BUF_C);
+
+    have_deterministic = false;
+    if(t_cose_algorithm_is_ecdsa(cose_alg)) {
+        have_deterministic =
+            t_cose_crypto_sign_deterministic(cose_alg,
+                                             run.key,
+                                             hash,
+                                             Q_USEFUL_BUF_FROM_BYTE_ARRAY(sig_buf),
+                                             &sig) == T_COSE_SUCCESS;
+        if(!have_deterministic) {
+            printf("  (no deterministic ECDSA in this crypto adapter)\n");
+        }
+    }
+
+    /* Up to twice the CPUs, but at least 8 so there's contention to
+     * see even on a small machine */
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    max_threads = cpus > 4 ? (int)cpus * 2 : 8;
+    if(max_threads > THREAD_BENCH_MAX_THREADS) {
+        max_threads = THREAD_BENCH_MAX_THREADS;
+    }
+    printf("  (%ld CPUs online)\n", cpus);
+
+    result = 0;
+    for(num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        run.replicas      = false;
+        run.deterministic = false;
+        result = thread_bench_measure(&run, alg_name, num_threads, "shared key");
+        if(result) {
+            break;
+        }
+        run.replicas = true;
+        result = thread_bench_measure(&run, alg_name, num_threads, "replicas");
+        if(result) {
+            break;
+        }
+        if(have_deterministic) {
+            run.replicas      = false;
+            run.deterministic = true;
+            result = thread_bench_measure(&run, alg_name, num_threads, "RFC 6979 nonce");
+            if(result) {
+                break;
+            }
+        }
+        run.replicas      = false;
+        run.deterministic = false;
+        run.signer        = &signer;
+        result = thread_bench_measure(&run, alg_name, num_threads, "shared signer");
+        run.signer        = NULL;
+        if(result) {
+            break;
+        }
+    }
+
+    free_key_pair(run.key);
+
+    return result;
+}
+
+#endif /* THREAD_BENCH_ADAPTER */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t thread_bench(void)
+{
+    int_fast32_t result = 0;
+
+#ifdef THREAD_BENCH_ADAPTER
+    result = thread_bench_alg(T_COSE_ALGORITHM_ES256, "ES256");
+    if(result == 0 && t_cose_is_algorithm_supported(T_COSE_ALGORITHM_PS256)) {
+        result = thread_bench_alg(T_COSE_ALGORITHM_PS256, "PS256");
+    }
+#else
+    printf("  (no signing in this crypto adapter)\n");
+#endif /* THREAD_BENCH_ADAPTER */
+
+    return result;
+}
@@ -0,0 +1,301 @@
+/*
+ *  t_cose_verify_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "t_cose_crypto.h"
+#include "t_cose_standard_constants.h"
+#include "ecv.h"
+#include "p256.h"
+
+#if defined(T_COSE_USE_OPENSSL_CRYPTO) || defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define VERIFY_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+#include <openssl/evp.h>
+#include <openssl/ec.h>
+#include <openssl/core_names.h>
+#endif
+
+
+/* Any 48 bytes will do as the hash. The first 32 are used for P-256. */
+static const uint8_t verify_bench_hash[48] = {
+    0x9a, 0x90, 0x83, 0x50, 0x5b, 0xc9, 0x22, 0x76, 0xae, 0xc4, 0xbe, 0x31, 0x26, 0x96, 0xef, 0x7b,
+    0xf3, 0xbf, 0x60, 0x3f, 0x4b, 0xbd, 0x38, 0x11, 0x96, 0xa0, 0x29, 0xf3, 0x40, 0x58, 0x53, 0x12,
+    0x31, 0x3b, 0xca, 0x4a, 0x9b, 0x5b, 0x89, 0x0e, 0xfe, 0xe4, 0x2c, 0x77, 0xb1, 0xee, 0x25, 0xfe
+};
+
+
+/* Times loading a key and verifying with it */
+static int_fast32_t bench_ecv(const char    *curve_name,
+                              int            curve,
+                              const uint8_t *point,
+                              size_t         point_len,
+                              const uint8_t *signature,
+                              size_t         signature_len)
+{
+    static struct ecv_key key;
+    char                  name[64];
+    uint64_t              start;
+    uint64_t              elapsed;
+    uint64_t              ops;
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(ecv_key_init(&key, curve, point, point_len)) {
+            return 1;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    snprintf(name, sizeof(name), "ecv %s key load (cache miss)", curve_name);
+    bench_report(name, 0, ops, elapsed);
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(ecv_verify(&key, verify_bench_hash, signature_len / 2, signature, signature_len)) {
+            return 2;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    snprintf(name, sizeof(name), "ecv %s verify", curve_name);
+    bench_report(name, 0, ops, elapsed);
+
+    return 0;
+}
+
+
+/* Times the engine on P-256 with a key and signature from the P-256
+ * engine, which is here with every crypto provider. p256_verify() is
+ * timed too for comparison. */
+static int_fast32_t bench_ecv_p256(void)
+{
+    static const uint8_t private_key[P256_PRIVATE_KEY_SIZE] = {
+        0xd9, 0xb5, 0xe7, 0x1f, 0x77, 0x28, 0xbf, 0xe5, 0x63, 0xa9, 0xdc, 0x93, 0x75, 0x62, 0x27, 0x7e,
+        0x32, 0x7d, 0x98, 0xd9, 0x94, 0x80, 0xf3, 0xdc, 0x92, 0x41, 0xe5, 0x74, 0x2a, 0xc4, 0x58, 0x89
+    };
+    struct p256_key key;
+    uint8_t         point[P256_PUBLIC_KEY_SIZE];
+    uint8_t         signature[P256_SIGNATURE_SIZE];
+    int_fast32_t    result;
+    uint64_t        start;
+    uint64_t        elapsed;
+    uint64_t        ops;
+
+    if(p256_key_from_private(&key, private_key)) {
+        return 10;
+    }
+    p256_key_public(&key, point);
+    if(p256_sign(&key, verify_bench_hash, 32, signature)) {
+        result = 11;
+        goto Done;
+    }
+
+    result = bench_ecv("P-256", ECV_P256, point, sizeof(point), signature, sizeof(signature));
+    if(result) {
+        result += 10;
+        goto Done;
+    }
+
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(p256_verify(&key, verify_bench_hash, 32, signature)) {
+            result = 13;
+            goto Done;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report("p256 verify", 0, ops, elapsed);
+
+Done:
+    p256_key_wipe(&key);
+    return result;
+}
+
+
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+/* Times the engine against EVP_PKEY_verify() with a new OpenSSL key */
+static int_fast32_t bench_ecv_vs_openssl(const char *curve_name, int curve)
+{
+    EVP_PKEY      *pkey;
+    EVP_PKEY_CTX  *ctx = NULL;
+    ECDSA_SIG     *ecdsa_sig = NULL;
+    const uint8_t *der_ptr;
+    uint8_t        der_sig[T_COSE_MAX_ECDSA_SIG_SIZE + 16];
+    size_t         der_sig_len;
+    uint8_t        point[ECV_MAX_PUBLIC_KEY_SIZE];
+    size_t         point_len;
+    uint8_t        signature[T_COSE_MAX_ECDSA_SIG_SIZE];
+    size_t         size;
+    char           name[64];
+    int_fast32_t   result;
+    uint64_t       start;
+    uint64_t       elapsed;
+    uint64_t       ops;
+
+    size = curve == ECV_P256 ? 32 : 48;
+
+    pkey = EVP_EC_gen(curve == ECV_P256 ? "P-256" : "P-384");
+    if(pkey == NULL) {
+        return 20;
+    }
+    ctx = EVP_PKEY_CTX_new(pkey, NULL);
+    der_sig_len = sizeof(der_sig);
+    if(ctx == NULL ||
+       EVP_PKEY_sign_init(ctx) != 1 ||
+       EVP_PKEY_sign(ctx, der_sig, &der_sig_len, verify_bench_hash, size) != 1 ||
+       EVP_PKEY_get_octet_string_param(pkey, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY,
+                                       point, sizeof(point), &point_len) != 1) {
+        result = 21;
+        goto Done;
+    }
+
+    /* The engine takes the COSE format, r || s */
+    der_ptr = der_sig;
+    ecdsa_sig = d2i_ECDSA_SIG(NULL, &der_ptr, (long)der_sig_len);
+    if(ecdsa_sig == NULL ||
+       BN_bn2binpad(ECDSA_SIG_get0_r(ecdsa_sig), signature, (int)size) < 0 ||
+       BN_bn2binpad(ECDSA_SIG_get0_s(ecdsa_sig), signature + size, (int)size) < 0) {
+        result = 22;
+        goto Done;
+    }
+
+    result = bench_ecv(curve_name, curve, point, point_len, signature, 2 * size);
+    if(result) {
+        result += 20;
+        goto Done;
+    }
+
+    if(EVP_PKEY_verify_init(ctx) != 1) {
+        result = 25;
+        goto Done;
+    }
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(EVP_PKEY_verify(ctx, der_sig, der_sig_len, verify_bench_hash, size) != 1) {
+            result = 26;
+            goto Done;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    snprintf(name, sizeof(name), "EVP_PKEY_verify %s", curve_name);
+    bench_report(name, 0, ops, elapsed);
+
+Done:
+    ECDSA_SIG_free(ecdsa_sig);
+    EVP_PKEY_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    return result;
+}
+#endif /* T_COSE_USE_OPENSSL_CRYPTO */
+
+
+#ifdef VERIFY_BENCH_ADAPTER
+/* Times t_cose_crypto_verify() without and then with a key cache
+ * for this thread */
+static int_fast32_t bench_adapter(const char *alg_name, int32_t cose_algorithm_id)
+{
+    static struct ecv_cache_entry entries[ECV_CACHE_WAYS];
+    struct ecv_cache              cache;
+    struct t_cose_key             key;
+    MakeUsefulBufOnStack(         sig_buf, T_COSE_MAX_ECDSA_SIG_SIZE);
+    struct q_useful_buf_c         sig;
+    struct q_useful_buf_c         hash;
+    const struct q_useful_buf_c   kid = Q_USEFUL_BUF_FROM_SZ_LITERAL("bench-kid");
+    char                          name[64];
+    enum t_cose_err_t             result;
+    int                           use_cache;
+    uint64_t                      start;
+    uint64_t                      elapsed;
+    uint64_t                      ops;
+
+    hash.ptr = verify_bench_hash;
+    hash.len = cose_algorithm_id == T_COSE_ALGORITHM_ES256 ? 32 : 48;
+
+    if(ecv_cache_init(&cache, entries, ECV_CACHE_WAYS)) {
+        return 30;
+    }
+    if(make_key_pair(cose_algorithm_id, &key)) {
+        return 31;
+    }
+    result = t_cose_crypto_sign(cose_algorithm_id, key, hash, sig_buf, &sig);
+    if(result) {
+        goto Done;
+    }
+
+    for(use_cache = 0; use_cache < 2; use_cache++) {
+        ecv_set_thread_cache(use_cache ? &cache : NULL);
+        ops = 0;
+        start = bench_now_ns();
+        do {
+            result = t_cose_crypto_verify(cose_algorithm_id, key, kid, hash, sig);
+            if(result) {
+                goto Done;
+            }
+            ops++;
+            elapsed = bench_now_ns() - start;
+        } while(elapsed < BENCH_MIN_NS);
+        snprintf(name, sizeof(name), "adapter %s verify%s",
+                 alg_name, use_cache ? " with key cache" : "");
+        bench_report(name, 0, ops, elapsed);
+    }
+
+Done:
+    ecv_set_thread_cache(NULL);
+    free_key_pair(key);
+    return result;
+}
+#endif /* VERIFY_BENCH_ADAPTER */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t verify_bench(void)
+{
+    int_fast32_t result;
+
+    result = bench_ecv_p256();
+    if(result) {
+        return result;
+    }
+
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+    result = bench_ecv_vs_openssl("P-256", ECV_P256);
+    if(result) {
+        return result;
+    }
+    result = bench_ecv_vs_openssl("P-384", ECV_P384);
+    if(result) {
+        return result;
+    }
+#endif
+
+#ifdef VERIFY_BENCH_ADAPTER
+    result = bench_adapter("ES256", T_COSE_ALGORITHM_ES256);
+    if(result) {
+        return result;
+    }
+#if defined(T_COSE_USE_OPENSSL_CRYPTO) && !defined(T_COSE_DISABLE_ES384)
+    result = bench_adapter("ES384", T_COSE_ALGORITHM_ES384);
+#endif
+#endif
+
+    return result;
+}
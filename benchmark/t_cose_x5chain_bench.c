@@ -0,0 +1,185 @@
+/*
+ *  t_cose_x5chain_bench.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdio.h>
+#include "t_cose_bench.h"
+#include "qcbor/qcbor_encode.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_x5chain.h"
+
+#if defined(T_COSE_USE_PSA_CRYPTO) || defined(T_COSE_USE_OPENSSL_CRYPTO) || \
+    defined(T_COSE_USE_BUILTIN_CRYPTO)
+#define X5CHAIN_BENCH_ADAPTER
+#include "t_cose_make_test_pub_key.h"
+#include "t_cose_x5chain_test_certs.h"
+#endif
+
+
+#ifdef X5CHAIN_BENCH_ADAPTER
+
+/* January 2028, when the test certificates are good */
+static int64_t x5chain_bench_clock(void *clock_ctx)
+{
+    (void)clock_ctx;
+    return 1830297600;
+}
+
+
+/* Sign a small payload with the device key and put the chain to the
+ * test root in the unprotected parameters */
+static int_fast32_t x5chain_bench_token(struct t_cose_key      key,
+                                        struct q_useful_buf    buffer,
+                                        struct q_useful_buf_c *signed_cose,
+                                        struct q_useful_buf    x5chain_buffer,
+                                        struct q_useful_buf_c *x5chain_cose)
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_parsed     parsed;
+    QCBOREncodeContext             cbor_encode;
+
+    t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+    if(t_cose_sign1_sign(&sign_ctx, Q_USEFUL_BUF_FROM_SZ_LITERAL("reading: 21.5 C"), buffer, signed_cose)) {
+        return 10;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    if(t_cose_sign1_parse(&verify_ctx, *signed_cose, &parsed)) {
+        return 20;
+    }
+
+    QCBOREncode_Init(&cbor_encode, x5chain_buffer);
+    QCBOREncode_OpenArray(&cbor_encode);
+    QCBOREncode_AddBytes(&cbor_encode, parsed.protected_parameters);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_OpenArrayInMapN(&cbor_encode, 33);
+    QCBOREncode_AddBytes(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_device));
+    QCBOREncode_AddBytes(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_intermediate));
+    QCBOREncode_CloseArray(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_AddBytes(&cbor_encode, parsed.payload);
+    QCBOREncode_AddBytes(&cbor_encode, parsed.signature);
+    QCBOREncode_CloseArray(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, x5chain_cose)) {
+        return 30;
+    }
+
+    return 0;
+}
+
+#endif /* X5CHAIN_BENCH_ADAPTER */
+
+
+/*
+ * Public function, see t_cose_bench.h
+ */
+int_fast32_t x5chain_bench(void)
+{
+    int_fast32_t result = 0;
+#ifdef X5CHAIN_BENCH_ADAPTER
+    const struct q_useful_buf_c       root = {x5chain_test_root, sizeof(x5chain_test_root)};
+    struct t_cose_x5chain_cache       cache;
+    struct t_cose_x5chain_cache_entry entries[4];
+    struct t_cose_sign1_verify_ctx    verify_ctx;
+    struct t_cose_key                 key;
+    uint8_t                           signed_buffer[200];
+    uint8_t                           x5chain_buffer[1200];
+    struct q_useful_buf_c             signed_cose;
+    struct q_useful_buf_c             x5chain_cose;
+    struct q_useful_buf_c             payload;
+    enum t_cose_err_t                 err;
+    uint64_t                          start;
+    uint64_t                          elapsed;
+    uint64_t                          ops;
+
+    err = t_cose_x5chain_cache_init(&cache, entries, 4, &root, 1);
+    t_cose_x5chain_cache_free(&cache);
+    if(err == T_COSE_ERR_X5CHAIN_UNSUPPORTED) {
+        printf("  (no certificate chain validation in this crypto adapter)\n");
+        return 0;
+    }
+    if(err) {
+        return 1;
+    }
+
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &key)) {
+        return 2;
+    }
+    result = x5chain_bench_token(key,
+                                 Q_USEFUL_BUF_FROM_BYTE_ARRAY(signed_buffer),
+                                 &signed_cose,
+                                 Q_USEFUL_BUF_FROM_BYTE_ARRAY(x5chain_buffer),
+                                 &x5chain_cose);
+    if(result) {
+        goto Done;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+
+    /* --- The key known ahead, for comparison --- */
+    t_cose_sign1_set_verification_key(&verify_ctx, key);
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        if(t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL)) {
+            result = 40;
+            goto Done;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report("verify ES256, key known", 0, ops, elapsed);
+
+    /* --- A new cache each time so the chain is validated --- */
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        t_cose_x5chain_cache_init(&cache, entries, 4, &root, 1);
+        cache.clock = x5chain_bench_clock;
+        err = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, x5chain_cose,
+                                          NULL_Q_USEFUL_BUF_C, &payload, NULL);
+        t_cose_x5chain_cache_free(&cache);
+        if(err) {
+            result = 50 + (int_fast32_t)err;
+            goto Done;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    bench_report("verify ES256 x5chain, new cache each", 0, ops, elapsed);
+
+    /* --- The chain from the cache --- */
+    t_cose_x5chain_cache_init(&cache, entries, 4, &root, 1);
+    cache.clock = x5chain_bench_clock;
+    ops = 0;
+    start = bench_now_ns();
+    do {
+        err = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, x5chain_cose,
+                                          NULL_Q_USEFUL_BUF_C, &payload, NULL);
+        if(err) {
+            t_cose_x5chain_cache_free(&cache);
+            result = 60 + (int_fast32_t)err;
+            goto Done;
+        }
+        ops++;
+        elapsed = bench_now_ns() - start;
+    } while(elapsed < BENCH_MIN_NS);
+    t_cose_x5chain_cache_free(&cache);
+    bench_report("verify ES256 x5chain, cached", 0, ops, elapsed);
+
+Done:
+    free_key_pair(key);
+#else
+    printf("  (no signing in this crypto adapter)\n");
+#endif /* X5CHAIN_BENCH_ADAPTER */
+
+    return result;
+}
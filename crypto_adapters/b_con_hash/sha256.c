@@ -13,6 +13,10 @@
 
  * Copyright  Laurence Lundblade 2020 for addition of casts so it
               compiles without warnings with pendantic compilers settings.
+
+ * Copyright  Laurence Lundblade 2022 for block-at-a-time processing
+              straight from the input and the x86 SHA-NI and AVX2
+              kernels selected at run time.
 *********************************************************************/
 
 /*************************** HEADER FILES ***************************/
@@ -20,6 +24,15 @@
 #include <memory.h>
 #include "sha256.h"
 
+// The x86 kernels need GCC or clang for the target attribute and
+// <cpuid.h>. Define SHA256_NO_X86_ACCEL to leave them out.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(SHA256_NO_X86_ACCEL)
+#define SHA256_X86_ACCEL
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 /****************************** MACROS ******************************/
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
 #define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
@@ -44,49 +57,355 @@ static const WORD k[64] = {
 };
 
 /*********************** FUNCTION DEFINITIONS ***********************/
-void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+
+/* A kernel runs the compression function over nblocks consecutive
+ * 64-byte blocks, updating state in place. */
+typedef void (*sha256_blocks_fn)(WORD state[8], const BYTE *data, size_t nblocks);
+
+static void sha256_blocks_generic(WORD state[8], const BYTE *data, size_t nblocks)
 {
 	WORD a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-	for (i = 0, j = 0; i < 16; ++i, j += 4)
-		m[i] = (WORD)((data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]));
-	for ( ; i < 64; ++i)
-		m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-	a = ctx->state[0];
-	b = ctx->state[1];
-	c = ctx->state[2];
-	d = ctx->state[3];
-	e = ctx->state[4];
-	f = ctx->state[5];
-	g = ctx->state[6];
-	h = ctx->state[7];
-
-	for (i = 0; i < 64; ++i) {
-		t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-		t2 = EP0(a) + MAJ(a,b,c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + t1;
-		d = c;
-		c = b;
-		b = a;
-		a = t1 + t2;
-	}
-
-	ctx->state[0] += a;
-	ctx->state[1] += b;
-	ctx->state[2] += c;
-	ctx->state[3] += d;
-	ctx->state[4] += e;
-	ctx->state[5] += f;
-	ctx->state[6] += g;
-	ctx->state[7] += h;
+	for ( ; nblocks > 0; nblocks--, data += 64) {
+		for (i = 0, j = 0; i < 16; ++i, j += 4)
+			m[i] = (WORD)((data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]));
+		for ( ; i < 64; ++i)
+			m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 64; ++i) {
+			t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
+			t2 = EP0(a) + MAJ(a,b,c);
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+	}
+}
+
+#ifdef SHA256_X86_ACCEL
+
+/* SHA-NI kernel. The state is kept in the ABEF/CDGH register layout
+ * that sha256rnds2 wants for the whole run of blocks. Each iteration
+ * of the inner loop does four rounds and, from the fifth group on,
+ * computes the next four message schedule words with
+ * sha256msg1/sha256msg2. */
+__attribute__((target("sha,sse4.1")))
+static void sha256_blocks_shani(WORD state[8], const BYTE *data, size_t nblocks)
+{
+	const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1, abef_save, cdgh_save, tmp, msg, w[4];
+	int i;
+
+	tmp    = _mm_loadu_si128((const __m128i *)&state[0]);
+	state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+	tmp    = _mm_shuffle_epi32(tmp, 0xB1);          /* CDAB */
+	state1 = _mm_shuffle_epi32(state1, 0x1B);       /* EFGH */
+	state0 = _mm_alignr_epi8(tmp, state1, 8);       /* ABEF */
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);    /* CDGH */
+
+	for ( ; nblocks > 0; nblocks--, data += 64) {
+		abef_save = state0;
+		cdgh_save = state1;
+
+		for (i = 0; i < 16; i++) {
+			if (i < 4) {
+				w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), bswap);
+			} else {
+				/* W[t-16] + s0(W[t-15]) + W[t-7] + s1(W[t-2]) */
+				tmp = _mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]);
+				tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4));
+				w[i & 3] = _mm_sha256msg2_epu32(tmp, w[(i + 3) & 3]);
+			}
+			msg    = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i *)&k[4 * i]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg    = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+		}
+
+		state0 = _mm_add_epi32(state0, abef_save);
+		state1 = _mm_add_epi32(state1, cdgh_save);
+	}
+
+	tmp    = _mm_shuffle_epi32(state0, 0x1B);       /* FEBA */
+	state1 = _mm_shuffle_epi32(state1, 0xB1);       /* DCHG */
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);    /* DCBA */
+	state1 = _mm_alignr_epi8(state1, tmp, 8);       /* ABEF */
+
+	_mm_storeu_si128((__m128i *)&state[0], state0);
+	_mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+/* 32-bit lane-wise rotate right and the two small sigmas for AVX2 */
+#define V_ROTR(x,n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define V_SIG0(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,7), V_ROTR(x,18)), _mm256_srli_epi32((x), 3))
+#define V_SIG1(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,17), V_ROTR(x,19)), _mm256_srli_epi32((x), 10))
+
+/* The round for the AVX2 kernel with W[i] + K[i] precomputed. The
+ * working variables are rotated by renaming in the macro arguments
+ * rather than by moving them. */
+#define RND(a,b,c,d,e,f,g,h,wk) do { \
+	WORD t1_ = (h) + EP1(e) + CH(e,f,g) + (wk); \
+	(d) += t1_; \
+	(h) = t1_ + EP0(a) + MAJ(a,b,c); \
+	} while (0)
+
+static void sha256_rounds_wk(WORD state[8], const WORD wk[64])
+{
+	WORD a = state[0], b = state[1], c = state[2], d = state[3];
+	WORD e = state[4], f = state[5], g = state[6], h = state[7];
+	int i;
+
+	for (i = 0; i < 64; i += 8) {
+		RND(a,b,c,d,e,f,g,h, wk[i + 0]);
+		RND(h,a,b,c,d,e,f,g, wk[i + 1]);
+		RND(g,h,a,b,c,d,e,f, wk[i + 2]);
+		RND(f,g,h,a,b,c,d,e, wk[i + 3]);
+		RND(e,f,g,h,a,b,c,d, wk[i + 4]);
+		RND(d,e,f,g,h,a,b,c, wk[i + 5]);
+		RND(c,d,e,f,g,h,a,b, wk[i + 6]);
+		RND(b,c,d,e,f,g,h,a, wk[i + 7]);
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+	state[5] += f;
+	state[6] += g;
+	state[7] += h;
+}
+
+/* AVX2 kernel. The message schedule for two blocks is computed at
+ * once, one block in each 128-bit lane, four words at a time. The
+ * rounds themselves are inherently serial so they stay scalar and
+ * consume the precomputed W + K. A trailing odd block goes through
+ * the generic kernel. */
+__attribute__((target("avx2")))
+static void sha256_blocks_avx2(WORD state[8], const BYTE *data, size_t nblocks)
+{
+	const __m256i bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+	                                        0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m256i x[4], t, s;
+	WORD wk[2][64];
+	int i;
+
+	for ( ; nblocks >= 2; nblocks -= 2, data += 128) {
+		for (i = 0; i < 16; i++) {
+			if (i < 4) {
+				x[i] = _mm256_inserti128_si256(
+				           _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(data + 16 * i))),
+				           _mm_loadu_si128((const __m128i *)(data + 64 + 16 * i)), 1);
+				x[i] = _mm256_shuffle_epi8(x[i], bswap);
+			} else {
+				/* W[t-16] + s0(W[t-15]) + W[t-7] */
+				t = _mm256_add_epi32(x[i & 3], V_SIG0(_mm256_alignr_epi8(x[(i + 1) & 3], x[i & 3], 4)));
+				t = _mm256_add_epi32(t, _mm256_alignr_epi8(x[(i + 3) & 3], x[(i + 2) & 3], 4));
+				/* + s1(W[t-2]) for the low two words, which come from the previous group */
+				s = V_SIG1(_mm256_shuffle_epi32(x[(i + 3) & 3], 0xFE));
+				t = _mm256_add_epi32(t, _mm256_and_si256(s, _mm256_set_epi32(0, 0, -1, -1, 0, 0, -1, -1)));
+				/* + s1(W[t-2]) for the high two words, which are the low two just computed */
+				s = V_SIG1(_mm256_shuffle_epi32(t, 0x40));
+				x[i & 3] = _mm256_add_epi32(t, _mm256_and_si256(s, _mm256_set_epi32(-1, -1, 0, 0, -1, -1, 0, 0)));
+			}
+			t = _mm256_add_epi32(x[i & 3], _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&k[4 * i])));
+			_mm_storeu_si128((__m128i *)&wk[0][4 * i], _mm256_castsi256_si128(t));
+			_mm_storeu_si128((__m128i *)&wk[1][4 * i], _mm256_extracti128_si256(t, 1));
+		}
+		sha256_rounds_wk(state, wk[0]);
+		sha256_rounds_wk(state, wk[1]);
+	}
+
+	if (nblocks)
+		sha256_blocks_generic(state, data, nblocks);
+}
+
+static int sha256_cpu_has_shani(void)
+{
+	unsigned int a, b, c, d;
+
+	if (!__get_cpuid(1, &a, &b, &c, &d) || !(c & bit_SSSE3) || !(c & bit_SSE4_1))
+		return 0;
+	if (__get_cpuid_max(0, NULL) < 7)
+		return 0;
+	__cpuid_count(7, 0, a, b, c, d);
+	return (b >> 29) & 1;
+}
+
+static int sha256_cpu_has_avx2(void)
+{
+	unsigned int a, b, c, d, xcr0_lo, xcr0_hi;
+
+	if (!__get_cpuid(1, &a, &b, &c, &d))
+		return 0;
+	/* OSXSAVE and AVX, then check the OS saves the YMM state */
+	if (!(c & (1u << 27)) || !(c & (1u << 28)))
+		return 0;
+	__asm__ ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+	(void)xcr0_hi;
+	if ((xcr0_lo & 6) != 6)
+		return 0;
+	if (__get_cpuid_max(0, NULL) < 7)
+		return 0;
+	__cpuid_count(7, 0, a, b, c, d);
+	return (b >> 5) & 1;
+}
+
+static int sha256_cpu_has_avx512f(void)
+{
+	unsigned int a, b, c, d, xcr0_lo, xcr0_hi;
+
+	if (!sha256_cpu_has_avx2())
+		return 0;
+	/* The OS must also save the opmask and ZMM state */
+	__asm__ ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+	(void)xcr0_hi;
+	if ((xcr0_lo & 0xE6) != 0xE6)
+		return 0;
+	__cpuid_count(7, 0, a, b, c, d);
+	return (b >> 16) & 1;
+}
+
+/* Multi-buffer kernels. Each runs one block from each of LANES
+ * independent messages through the compression function, one
+ * message per 32-bit vector lane. The state is transposed so that
+ * st[i][lane] is word i of that lane's state. The body is the
+ * generic round written with GCC vector extensions so the same code
+ * serves SSE2, AVX2 and AVX-512. Rotates are spelled as shifts; the
+ * compiler turns them into vprord where AVX-512 has it. */
+#define SHA256_MB_KERNEL(name, lanes, isa)                                     \
+typedef WORD name##_v __attribute__((vector_size(4 * (lanes))));               \
+__attribute__((target(isa)))                                                   \
+static void name(WORD st[8][SHA256_MAX_LANES], const BYTE *const blocks[])     \
+{                                                                              \
+	name##_v a, b, c, d, e, f, g, h, s[8], t1, t2, w[16];                  \
+	const BYTE *p;                                                         \
+	int i, l;                                                              \
+                                                                               \
+	for (i = 0; i < 8; i++)                                                \
+		memcpy(&s[i], st[i], sizeof(s[i]));                            \
+	for (i = 0; i < 16; i++) {                                             \
+		for (l = 0; l < (lanes); l++) {                                \
+			p = blocks[l] + 4 * i;                                 \
+			w[i][l] = ((WORD)p[0] << 24) | ((WORD)p[1] << 16) |    \
+			          ((WORD)p[2] << 8) | (WORD)p[3];              \
+		}                                                              \
+	}                                                                      \
+	a = s[0]; b = s[1]; c = s[2]; d = s[3];                                \
+	e = s[4]; f = s[5]; g = s[6]; h = s[7];                                \
+	for (i = 0; i < 64; i++) {                                             \
+		if (i >= 16)                                                   \
+			w[i & 15] += SIG1(w[(i - 2) & 15]) + w[(i - 7) & 15] + \
+			             SIG0(w[(i - 15) & 15]);                   \
+		t1 = h + EP1(e) + CH(e,f,g) + k[i] + w[i & 15];                \
+		t2 = EP0(a) + MAJ(a,b,c);                                      \
+		h = g; g = f; f = e; e = d + t1;                               \
+		d = c; c = b; b = a; a = t1 + t2;                              \
+	}                                                                      \
+	s[0] += a; s[1] += b; s[2] += c; s[3] += d;                            \
+	s[4] += e; s[5] += f; s[6] += g; s[7] += h;                            \
+	for (i = 0; i < 8; i++)                                                \
+		memcpy(st[i], &s[i], sizeof(s[i]));                            \
+}
+
+SHA256_MB_KERNEL(sha256_mb_x4_sse2, 4, "sse2")
+SHA256_MB_KERNEL(sha256_mb_x8_avx2, 8, "avx2")
+SHA256_MB_KERNEL(sha256_mb_x16_avx512, 16, "avx512f")
+
+#endif /* SHA256_X86_ACCEL */
+
+/* The kernel in use. Written once on first use (or by
+ * sha256_set_impl()). A race between threads here is benign since
+ * they all compute and store the same value. */
+static sha256_blocks_fn sha256_blocks;
+static int sha256_impl_in_use;
+
+static int sha256_impl_supported(int impl)
+{
+	switch (impl) {
+	case SHA256_IMPL_GENERIC:
+		return 1;
+#ifdef SHA256_X86_ACCEL
+	case SHA256_IMPL_AVX2:
+		return sha256_cpu_has_avx2();
+	case SHA256_IMPL_SHANI:
+		return sha256_cpu_has_shani();
+#endif
+	default:
+		return 0;
+	}
+}
+
+int sha256_set_impl(int impl)
+{
+	if (impl == SHA256_IMPL_AUTO) {
+		if (sha256_impl_supported(SHA256_IMPL_SHANI))
+			impl = SHA256_IMPL_SHANI;
+		else if (sha256_impl_supported(SHA256_IMPL_AVX2))
+			impl = SHA256_IMPL_AVX2;
+		else
+			impl = SHA256_IMPL_GENERIC;
+	}
+	if (!sha256_impl_supported(impl))
+		return -1;
+
+	switch (impl) {
+#ifdef SHA256_X86_ACCEL
+	case SHA256_IMPL_SHANI:
+		sha256_blocks = sha256_blocks_shani;
+		break;
+	case SHA256_IMPL_AVX2:
+		sha256_blocks = sha256_blocks_avx2;
+		break;
+#endif
+	default:
+		sha256_blocks = sha256_blocks_generic;
+		break;
+	}
+	sha256_impl_in_use = impl;
+	return 0;
+}
+
+int sha256_get_impl(void)
+{
+	if (sha256_blocks == NULL)
+		sha256_set_impl(SHA256_IMPL_AUTO);
+	return sha256_impl_in_use;
+}
+
+void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+{
+	sha256_blocks(ctx->state, data, 1);
 }
 
 void sha256_init(SHA256_CTX *ctx)
 {
+	if (sha256_blocks == NULL)
+		sha256_set_impl(SHA256_IMPL_AUTO);
+
 	ctx->datalen = 0;
 	ctx->bitlen = 0;
 	ctx->state[0] = 0x6a09e667;
@@ -101,40 +420,63 @@ void sha256_init(SHA256_CTX *ctx)
 
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD i;
+	size_t fill, nblocks;
 
-	for (i = 0; i < len; ++i) {
-		ctx->data[ctx->datalen] = data[i];
-		ctx->datalen++;
-		if (ctx->datalen == 64) {
-			sha256_transform(ctx, ctx->data);
-			ctx->bitlen += 512;
-			ctx->datalen = 0;
+	// Top up a partially filled block first.
+	if (ctx->datalen > 0) {
+		fill = 64 - ctx->datalen;
+		if (len < fill) {
+			memcpy(ctx->data + ctx->datalen, data, len);
+			ctx->datalen += (WORD)len;
+			return;
 		}
+		memcpy(ctx->data + ctx->datalen, data, fill);
+		sha256_transform(ctx, ctx->data);
+		ctx->bitlen += 512;
+		ctx->datalen = 0;
+		data += fill;
+		len -= fill;
+	}
+
+	// Whole blocks are hashed straight out of the caller's buffer.
+	nblocks = len / 64;
+	if (nblocks > 0) {
+		sha256_blocks(ctx->state, data, nblocks);
+		ctx->bitlen += (unsigned long long)nblocks * 512;
+		data += nblocks * 64;
+		len -= nblocks * 64;
+	}
+
+	// Keep the tail for next time.
+	if (len > 0) {
+		memcpy(ctx->data, data, len);
+		ctx->datalen = (WORD)len;
 	}
 }
 
-void sha256_final(SHA256_CTX *ctx, BYTE hash[])
+// Pads the buffered tail. Returns 1 if the padding spilled into a
+// block that must be transformed before the length block, in which
+// case the caller transforms ctx->data and then zeroes its first 56
+// bytes.
+static int sha256_pad(SHA256_CTX *ctx)
 {
 	WORD i;
 
 	i = ctx->datalen;
-
-	// Pad whatever data is left in the buffer.
+	ctx->data[i++] = 0x80;
 	if (ctx->datalen < 56) {
-		ctx->data[i++] = 0x80;
 		while (i < 56)
 			ctx->data[i++] = 0x00;
+		return 0;
 	}
-	else {
-		ctx->data[i++] = 0x80;
-		while (i < 64)
-			ctx->data[i++] = 0x00;
-		sha256_transform(ctx, ctx->data);
-		memset(ctx->data, 0, 56);
-	}
+	while (i < 64)
+		ctx->data[i++] = 0x00;
+	return 1;
+}
 
-	// Append to the padding the total message's length in bits and transform.
+// Appends to the padding the total message's length in bits.
+static void sha256_pad_length(SHA256_CTX *ctx)
+{
 	ctx->bitlen += ctx->datalen * 8;
 	ctx->data[63] = (BYTE)(ctx->bitlen);
 	ctx->data[62] = (BYTE)(ctx->bitlen >> 8);
@@ -144,10 +486,14 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 	ctx->data[58] = (BYTE)(ctx->bitlen >> 40);
 	ctx->data[57] = (BYTE)(ctx->bitlen >> 48);
 	ctx->data[56] = (BYTE)(ctx->bitlen >> 56);
-	sha256_transform(ctx, ctx->data);
+}
+
+// Since this implementation uses little endian byte ordering and SHA uses big endian,
+// reverse all the bytes when copying the final state to the output hash.
+static void sha256_output(const SHA256_CTX *ctx, BYTE hash[])
+{
+	WORD i;
 
-	// Since this implementation uses little endian byte ordering and SHA uses big endian,
-	// reverse all the bytes when copying the final state to the output hash.
 	for (i = 0; i < 4; ++i) {
 		hash[i]      = (ctx->state[0] >> (24 - i * 8)) & 0x000000ff;
 		hash[i + 4]  = (ctx->state[1] >> (24 - i * 8)) & 0x000000ff;
@@ -159,3 +505,207 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 		hash[i + 28] = (ctx->state[7] >> (24 - i * 8)) & 0x000000ff;
 	}
 }
+
+void sha256_final(SHA256_CTX *ctx, BYTE hash[])
+{
+	// Pad whatever data is left in the buffer.
+	if (sha256_pad(ctx)) {
+		sha256_transform(ctx, ctx->data);
+		memset(ctx->data, 0, 56);
+	}
+
+	sha256_pad_length(ctx);
+	sha256_transform(ctx, ctx->data);
+
+	sha256_output(ctx, hash);
+}
+
+/************************** MULTI-BUFFER ****************************/
+
+// Lane count of the widest multi-buffer kernel to use. 1 means run
+// the messages one at a time through the single-buffer kernel.
+static int sha256_mb_max_lanes;
+
+static int sha256_mb_lanes_supported(int lanes)
+{
+	switch (lanes) {
+	case 1:
+		return 1;
+#ifdef SHA256_X86_ACCEL
+	case 4:
+		return 1;
+	case 8:
+		return sha256_cpu_has_avx2();
+	case 16:
+		return sha256_cpu_has_avx512f();
+#endif
+	default:
+		return 0;
+	}
+}
+
+int sha256_set_mb_lanes(int lanes)
+{
+	if (lanes == 0) {
+		// SHA-NI does one message faster than AVX2 does eight, so
+		// on CPUs that have it only AVX-512 is worth using.
+		if (sha256_mb_lanes_supported(16))
+			lanes = 16;
+		else if (sha256_get_impl() == SHA256_IMPL_SHANI)
+			lanes = 1;
+		else if (sha256_mb_lanes_supported(8))
+			lanes = 8;
+		else if (sha256_mb_lanes_supported(4))
+			lanes = 4;
+		else
+			lanes = 1;
+	}
+	if (!sha256_mb_lanes_supported(lanes))
+		return -1;
+	sha256_mb_max_lanes = lanes;
+	return 0;
+}
+
+int sha256_get_mb_lanes(void)
+{
+	if (sha256_mb_max_lanes == 0)
+		sha256_set_mb_lanes(0);
+	return sha256_mb_max_lanes;
+}
+
+// Transforms one block for each of n contexts. blocks[i] is the
+// block for ctx[i]. Runs of lanes go through the widest kernel
+// allowed. Unused lanes of a kernel get a copy of the first block
+// and their result is dropped, so a kernel run is only worth it if
+// enough lanes are filled. With the portable single-buffer kernel
+// any two messages are; a short tail goes through the narrowest
+// kernel that covers it. SHA-NI is faster per message than any
+// multi-buffer kernel with more than a quarter of its lanes empty,
+// so then it gets the leftovers.
+static void sha256_transform_multi(SHA256_CTX *ctx[], const BYTE *blocks[], size_t n)
+{
+#ifdef SHA256_X86_ACCEL
+	WORD st[8][SHA256_MAX_LANES];
+	const BYTE *lane_blocks[SHA256_MAX_LANES];
+	size_t lanes, min_fill, i, j;
+	int max_lanes, shani, w;
+
+	max_lanes = sha256_get_mb_lanes();
+	shani = sha256_impl_in_use == SHA256_IMPL_SHANI;
+	min_fill = shani ? (size_t)max_lanes * 3 / 4 : 2;
+
+	while (max_lanes > 1 && n >= min_fill) {
+		lanes = (size_t)max_lanes;
+		while (!shani && lanes > 4 && lanes / 2 >= n)
+			lanes /= 2;
+		j = lanes > n ? n : lanes;
+
+		for (i = 0; i < lanes; i++) {
+			lane_blocks[i] = blocks[i < j ? i : 0];
+			for (w = 0; w < 8; w++)
+				st[w][i] = ctx[i < j ? i : 0]->state[w];
+		}
+		if (lanes == 16)
+			sha256_mb_x16_avx512(st, lane_blocks);
+		else if (lanes == 8)
+			sha256_mb_x8_avx2(st, lane_blocks);
+		else
+			sha256_mb_x4_sse2(st, lane_blocks);
+		for (i = 0; i < j; i++) {
+			for (w = 0; w < 8; w++)
+				ctx[i]->state[w] = st[w][i];
+		}
+
+		ctx += j;
+		blocks += j;
+		n -= j;
+	}
+#endif
+	for ( ; n > 0; n--, ctx++, blocks++)
+		sha256_transform(*ctx, *blocks);
+}
+
+void sha256_update_multi(SHA256_CTX *ctx[], const BYTE *data[], const size_t len[], size_t n)
+{
+	SHA256_CTX *active[SHA256_MAX_LANES];
+	const BYTE *blocks[SHA256_MAX_LANES];
+	const BYTE *p[SHA256_MAX_LANES];
+	size_t rem[SHA256_MAX_LANES];
+	size_t group, i, m, take;
+
+	for ( ; n > 0; n -= group, ctx += group, data += group, len += group) {
+		group = n < SHA256_MAX_LANES ? n : SHA256_MAX_LANES;
+		for (i = 0; i < group; i++) {
+			p[i] = data[i];
+			rem[i] = len[i];
+		}
+
+		for (;;) {
+			// Find the next block for each message that has one. It
+			// comes from the caller's buffer when it can and from
+			// ctx->data when it straddles two updates.
+			m = 0;
+			for (i = 0; i < group; i++) {
+				if (ctx[i]->datalen > 0 || rem[i] < 64) {
+					take = 64 - ctx[i]->datalen;
+					if (take > rem[i])
+						take = rem[i];
+					memcpy(ctx[i]->data + ctx[i]->datalen, p[i], take);
+					ctx[i]->datalen += (WORD)take;
+					p[i] += take;
+					rem[i] -= take;
+					if (ctx[i]->datalen < 64)
+						continue;
+					blocks[m] = ctx[i]->data;
+				} else {
+					blocks[m] = p[i];
+					p[i] += 64;
+					rem[i] -= 64;
+				}
+				active[m++] = ctx[i];
+			}
+			if (m == 0)
+				break;
+
+			sha256_transform_multi(active, blocks, m);
+			for (i = 0; i < m; i++) {
+				active[i]->bitlen += 512;
+				if (blocks[i] == active[i]->data)
+					active[i]->datalen = 0;
+			}
+		}
+	}
+}
+
+void sha256_final_multi(SHA256_CTX *ctx[], BYTE *hash[], size_t n)
+{
+	SHA256_CTX *active[SHA256_MAX_LANES];
+	const BYTE *blocks[SHA256_MAX_LANES];
+	size_t group, i, m;
+
+	for ( ; n > 0; n -= group, ctx += group, hash += group) {
+		group = n < SHA256_MAX_LANES ? n : SHA256_MAX_LANES;
+
+		// Messages whose padding spills into a second block
+		m = 0;
+		for (i = 0; i < group; i++) {
+			if (sha256_pad(ctx[i])) {
+				blocks[m] = ctx[i]->data;
+				active[m++] = ctx[i];
+			}
+		}
+		sha256_transform_multi(active, blocks, m);
+		for (i = 0; i < m; i++)
+			memset(active[i]->data, 0, 56);
+
+		// The length block for all of them
+		for (i = 0; i < group; i++) {
+			sha256_pad_length(ctx[i]);
+			blocks[i] = ctx[i]->data;
+		}
+		sha256_transform_multi(ctx, blocks, group);
+
+		for (i = 0; i < group; i++)
+			sha256_output(ctx[i], hash[i]);
+	}
+}
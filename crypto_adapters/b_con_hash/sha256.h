@@ -15,6 +15,16 @@
 /****************************** MACROS ******************************/
 #define SHA256_BLOCK_SIZE 32            // SHA256 outputs a 32 byte digest
 
+// Compression function implementations for sha256_set_impl()
+#define SHA256_IMPL_AUTO    0           // Fastest supported by this CPU
+#define SHA256_IMPL_GENERIC 1           // Portable C
+#define SHA256_IMPL_AVX2    2           // x86 AVX2 message schedule
+#define SHA256_IMPL_SHANI   3           // x86 SHA extensions
+
+// Most messages sha256_update_multi() and sha256_final_multi() run
+// through the compression function together
+#define SHA256_MAX_LANES    16
+
 /**************************** DATA TYPES ****************************/
 typedef unsigned char BYTE;             // 8-bit byte
 typedef unsigned int  WORD;             // 32-bit word, change to "long" for 16-bit machines
@@ -31,4 +41,27 @@ void sha256_init(SHA256_CTX *ctx);
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len);
 void sha256_final(SHA256_CTX *ctx, BYTE hash[]);
 
+// The implementation is selected by CPUID on first use. These are
+// mainly for testing and benchmarking. sha256_set_impl() returns 0 on
+// success and -1 if the implementation isn't available on this CPU
+// or in this build. It isn't thread safe with hashing in progress.
+int sha256_set_impl(int impl);
+int sha256_get_impl(void);
+
+// Multi-buffer hashing. These update or finish n independent
+// contexts at once, running up to 4, 8 or 16 of them through the
+// compression function together in SSE2, AVX2 or AVX-512 lanes. The
+// results are the same as calling sha256_update() and sha256_final()
+// on each. data[i], len[i] and hash[i] go with ctx[i]. Any n works;
+// they are done in groups of SHA256_MAX_LANES.
+void sha256_update_multi(SHA256_CTX *ctx[], const BYTE *data[], const size_t len[], size_t n);
+void sha256_final_multi(SHA256_CTX *ctx[], BYTE *hash[], size_t n);
+
+// Lanes of the widest multi-buffer kernel to use: 1, 4, 8 or 16, or 0
+// to choose by CPU. 1 means no multi-buffer kernel; the messages take
+// turns in the single-buffer kernel. sha256_set_mb_lanes() returns -1
+// if the CPU or build doesn't have that kernel.
+int sha256_set_mb_lanes(int lanes);
+int sha256_get_mb_lanes(void);
+
 #endif   // SHA256_H
@@ -0,0 +1,414 @@
+/*********************************************************************
+* Filename:   sha512.c
+* Copyright:  Laurence Lundblade 2022
+* Disclaimer: This code is presented "as is" without any guarantees.
+* Details:    Implementation of the SHA-512 and SHA-384 hashing
+              algorithms, laid out like sha256.c alongside it.
+              Algorithm specification can be found here:
+               * http://csrc.nist.gov/publications/fips/fips180-2/fips180-2withchangenotice.pdf
+              Input words are loaded 64 bits at a time and the
+              message schedule is kept in a rolling 16-word window.
+              On x86 with AVX2 the message schedule for two blocks is
+              computed together in vector registers.
+*********************************************************************/
+
+/*************************** HEADER FILES ***************************/
+#include <stdlib.h>
+#include <memory.h>
+#include "sha512.h"
+
+// Same switch as sha256.c. Define SHA256_NO_X86_ACCEL to leave out
+// the x86 kernel.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(SHA256_NO_X86_ACCEL)
+#define SHA512_X86_ACCEL
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+/****************************** MACROS ******************************/
+#define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (64-(b))))
+
+#define CH(x,y,z) (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define EP0(x) (ROTRIGHT(x,28) ^ ROTRIGHT(x,34) ^ ROTRIGHT(x,39))
+#define EP1(x) (ROTRIGHT(x,14) ^ ROTRIGHT(x,18) ^ ROTRIGHT(x,41))
+#define SIG0(x) (ROTRIGHT(x,1) ^ ROTRIGHT(x,8) ^ ((x) >> 7))
+#define SIG1(x) (ROTRIGHT(x,19) ^ ROTRIGHT(x,61) ^ ((x) >> 6))
+
+/* One round with W[i] + K[i] already added. The working variables are
+ * rotated by renaming in the macro arguments rather than by moving
+ * them. */
+#define RND(a,b,c,d,e,f,g,h,wk) do { \
+	WORD64 t1_ = (h) + EP1(e) + CH(e,f,g) + (wk); \
+	(d) += t1_; \
+	(h) = t1_ + EP0(a) + MAJ(a,b,c); \
+	} while (0)
+
+/**************************** VARIABLES *****************************/
+static const WORD64 k[80] = {
+	0x428a2f98d728ae22ULL,0x7137449123ef65cdULL,0xb5c0fbcfec4d3b2fULL,0xe9b5dba58189dbbcULL,
+	0x3956c25bf348b538ULL,0x59f111f1b605d019ULL,0x923f82a4af194f9bULL,0xab1c5ed5da6d8118ULL,
+	0xd807aa98a3030242ULL,0x12835b0145706fbeULL,0x243185be4ee4b28cULL,0x550c7dc3d5ffb4e2ULL,
+	0x72be5d74f27b896fULL,0x80deb1fe3b1696b1ULL,0x9bdc06a725c71235ULL,0xc19bf174cf692694ULL,
+	0xe49b69c19ef14ad2ULL,0xefbe4786384f25e3ULL,0x0fc19dc68b8cd5b5ULL,0x240ca1cc77ac9c65ULL,
+	0x2de92c6f592b0275ULL,0x4a7484aa6ea6e483ULL,0x5cb0a9dcbd41fbd4ULL,0x76f988da831153b5ULL,
+	0x983e5152ee66dfabULL,0xa831c66d2db43210ULL,0xb00327c898fb213fULL,0xbf597fc7beef0ee4ULL,
+	0xc6e00bf33da88fc2ULL,0xd5a79147930aa725ULL,0x06ca6351e003826fULL,0x142929670a0e6e70ULL,
+	0x27b70a8546d22ffcULL,0x2e1b21385c26c926ULL,0x4d2c6dfc5ac42aedULL,0x53380d139d95b3dfULL,
+	0x650a73548baf63deULL,0x766a0abb3c77b2a8ULL,0x81c2c92e47edaee6ULL,0x92722c851482353bULL,
+	0xa2bfe8a14cf10364ULL,0xa81a664bbc423001ULL,0xc24b8b70d0f89791ULL,0xc76c51a30654be30ULL,
+	0xd192e819d6ef5218ULL,0xd69906245565a910ULL,0xf40e35855771202aULL,0x106aa07032bbd1b8ULL,
+	0x19a4c116b8d2d0c8ULL,0x1e376c085141ab53ULL,0x2748774cdf8eeb99ULL,0x34b0bcb5e19b48a8ULL,
+	0x391c0cb3c5c95a63ULL,0x4ed8aa4ae3418acbULL,0x5b9cca4f7763e373ULL,0x682e6ff3d6b2b8a3ULL,
+	0x748f82ee5defb2fcULL,0x78a5636f43172f60ULL,0x84c87814a1f0ab72ULL,0x8cc702081a6439ecULL,
+	0x90befffa23631e28ULL,0xa4506cebde82bde9ULL,0xbef9a3f7b2c67915ULL,0xc67178f2e372532bULL,
+	0xca273eceea26619cULL,0xd186b8c721c0c207ULL,0xeada7dd6cde0eb1eULL,0xf57d4f7fee6ed178ULL,
+	0x06f067aa72176fbaULL,0x0a637dc5a2c898a6ULL,0x113f9804bef90daeULL,0x1b710b35131c471bULL,
+	0x28db77f523047d84ULL,0x32caab7b40c72493ULL,0x3c9ebe0a15c9bebcULL,0x431d67c49c100d4cULL,
+	0x4cc5d4becb3e42b6ULL,0x597f299cfc657e2aULL,0x5fcb6fab3ad6faecULL,0x6c44198c4a475817ULL,
+};
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+
+/* Big-endian 64-bit load, one word at a time rather than byte by byte */
+static WORD64 load_be64(const BYTE *p)
+{
+	WORD64 v;
+
+	memcpy(&v, p, 8);
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	v = __builtin_bswap64(v);
+#elif !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+	{
+		const BYTE *b = p;
+		v = ((WORD64)b[0] << 56) | ((WORD64)b[1] << 48) | ((WORD64)b[2] << 40) | ((WORD64)b[3] << 32) |
+		    ((WORD64)b[4] << 24) | ((WORD64)b[5] << 16) | ((WORD64)b[6] << 8)  | ((WORD64)b[7]);
+	}
+#endif
+	return v;
+}
+
+/* A kernel runs the compression function over nblocks consecutive
+ * 128-byte blocks, updating state in place. */
+typedef void (*sha512_blocks_fn)(WORD64 state[8], const BYTE *data, size_t nblocks);
+
+/* Message schedule word j >= 16 computed in place in the 16-word
+ * window. With the loop unrolled by 16, j & 15 is a constant so the
+ * window stays in registers. */
+#define SCHED(j) (w[(j) & 15] += SIG1(w[((j) - 2) & 15]) + w[((j) - 7) & 15] + SIG0(w[((j) - 15) & 15]))
+#define W(j) (i == 0 ? w[(j) & 15] : SCHED(j))
+
+static void sha512_blocks_generic(WORD64 state[8], const BYTE *data, size_t nblocks)
+{
+	WORD64 a, b, c, d, e, f, g, h, w[16];
+	int i;
+
+	for ( ; nblocks > 0; nblocks--, data += 128) {
+		for (i = 0; i < 16; ++i)
+			w[i] = load_be64(data + 8 * i);
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 80; i += 16) {
+			RND(a,b,c,d,e,f,g,h, W(0)  + k[i + 0]);
+			RND(h,a,b,c,d,e,f,g, W(1)  + k[i + 1]);
+			RND(g,h,a,b,c,d,e,f, W(2)  + k[i + 2]);
+			RND(f,g,h,a,b,c,d,e, W(3)  + k[i + 3]);
+			RND(e,f,g,h,a,b,c,d, W(4)  + k[i + 4]);
+			RND(d,e,f,g,h,a,b,c, W(5)  + k[i + 5]);
+			RND(c,d,e,f,g,h,a,b, W(6)  + k[i + 6]);
+			RND(b,c,d,e,f,g,h,a, W(7)  + k[i + 7]);
+			RND(a,b,c,d,e,f,g,h, W(8)  + k[i + 8]);
+			RND(h,a,b,c,d,e,f,g, W(9)  + k[i + 9]);
+			RND(g,h,a,b,c,d,e,f, W(10) + k[i + 10]);
+			RND(f,g,h,a,b,c,d,e, W(11) + k[i + 11]);
+			RND(e,f,g,h,a,b,c,d, W(12) + k[i + 12]);
+			RND(d,e,f,g,h,a,b,c, W(13) + k[i + 13]);
+			RND(c,d,e,f,g,h,a,b, W(14) + k[i + 14]);
+			RND(b,c,d,e,f,g,h,a, W(15) + k[i + 15]);
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+	}
+}
+
+#ifdef SHA512_X86_ACCEL
+
+__attribute__((target("bmi2")))
+static inline void sha512_rounds_wk(WORD64 state[8], const WORD64 wk[80])
+{
+	WORD64 a = state[0], b = state[1], c = state[2], d = state[3];
+	WORD64 e = state[4], f = state[5], g = state[6], h = state[7];
+	int i;
+
+	for (i = 0; i < 80; i += 8) {
+		RND(a,b,c,d,e,f,g,h, wk[i + 0]);
+		RND(h,a,b,c,d,e,f,g, wk[i + 1]);
+		RND(g,h,a,b,c,d,e,f, wk[i + 2]);
+		RND(f,g,h,a,b,c,d,e, wk[i + 3]);
+		RND(e,f,g,h,a,b,c,d, wk[i + 4]);
+		RND(d,e,f,g,h,a,b,c, wk[i + 5]);
+		RND(c,d,e,f,g,h,a,b, wk[i + 6]);
+		RND(b,c,d,e,f,g,h,a, wk[i + 7]);
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+	state[5] += f;
+	state[6] += g;
+	state[7] += h;
+}
+
+/* 64-bit lane-wise rotate right and the two small sigmas for AVX2 */
+#define V_ROTR(x,n) _mm256_or_si256(_mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+#define V_SIG0(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,1), V_ROTR(x,8)), _mm256_srli_epi64((x), 7))
+#define V_SIG1(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,19), V_ROTR(x,61)), _mm256_srli_epi64((x), 6))
+
+/* AVX2 kernel. The message schedule for two blocks is computed at
+ * once, one block in each 128-bit lane, two words at a time. Unlike
+ * SHA-256, a pair of new words only depends on W[t-2] and W[t-1]
+ * from the previous pair, so there is no dependency inside a vector.
+ * The rounds stay scalar and consume the precomputed W + K, built
+ * with BMI2 so the rotates are rorx. A trailing odd block goes
+ * through the generic kernel. */
+__attribute__((target("avx2,bmi2")))
+static void sha512_blocks_avx2(WORD64 state[8], const BYTE *data, size_t nblocks)
+{
+	const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL,
+	                                        0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+	__m256i x[8], t;
+	WORD64 wk[2][80];
+	int i;
+
+	for ( ; nblocks >= 2; nblocks -= 2, data += 256) {
+		for (i = 0; i < 40; i++) {
+			if (i < 8) {
+				x[i] = _mm256_inserti128_si256(
+				           _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(data + 16 * i))),
+				           _mm_loadu_si128((const __m128i *)(data + 128 + 16 * i)), 1);
+				x[i] = _mm256_shuffle_epi8(x[i], bswap);
+			} else {
+				/* W[t-16] + s0(W[t-15]) + W[t-7] + s1(W[t-2]) */
+				t = _mm256_add_epi64(x[i & 7], V_SIG0(_mm256_alignr_epi8(x[(i + 1) & 7], x[i & 7], 8)));
+				t = _mm256_add_epi64(t, _mm256_alignr_epi8(x[(i + 5) & 7], x[(i + 4) & 7], 8));
+				x[i & 7] = _mm256_add_epi64(t, V_SIG1(x[(i + 7) & 7]));
+			}
+			t = _mm256_add_epi64(x[i & 7], _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&k[2 * i])));
+			_mm_storeu_si128((__m128i *)&wk[0][2 * i], _mm256_castsi256_si128(t));
+			_mm_storeu_si128((__m128i *)&wk[1][2 * i], _mm256_extracti128_si256(t, 1));
+		}
+		sha512_rounds_wk(state, wk[0]);
+		sha512_rounds_wk(state, wk[1]);
+	}
+
+	if (nblocks)
+		sha512_blocks_generic(state, data, nblocks);
+}
+
+static int sha512_cpu_has_avx2(void)
+{
+	unsigned int a, b, c, d, xcr0_lo, xcr0_hi;
+
+	if (!__get_cpuid(1, &a, &b, &c, &d))
+		return 0;
+	/* OSXSAVE and AVX, then check the OS saves the YMM state */
+	if (!(c & (1u << 27)) || !(c & (1u << 28)))
+		return 0;
+	__asm__ ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+	(void)xcr0_hi;
+	if ((xcr0_lo & 6) != 6)
+		return 0;
+	if (__get_cpuid_max(0, NULL) < 7)
+		return 0;
+	__cpuid_count(7, 0, a, b, c, d);
+	/* AVX2 and BMI2, which the kernel also uses for rorx in the rounds */
+	return ((b >> 5) & 1) && ((b >> 8) & 1);
+}
+
+#endif /* SHA512_X86_ACCEL */
+
+/* The kernel in use. Written once on first use (or by
+ * sha512_set_impl()). A race between threads here is benign since
+ * they all compute and store the same value. */
+static sha512_blocks_fn sha512_blocks;
+static int sha512_impl_in_use;
+
+static int sha512_impl_supported(int impl)
+{
+	switch (impl) {
+	case SHA512_IMPL_GENERIC:
+		return 1;
+#ifdef SHA512_X86_ACCEL
+	case SHA512_IMPL_AVX2:
+		return sha512_cpu_has_avx2();
+#endif
+	default:
+		return 0;
+	}
+}
+
+int sha512_set_impl(int impl)
+{
+	if (impl == SHA512_IMPL_AUTO) {
+		if (sha512_impl_supported(SHA512_IMPL_AVX2))
+			impl = SHA512_IMPL_AVX2;
+		else
+			impl = SHA512_IMPL_GENERIC;
+	}
+	if (!sha512_impl_supported(impl))
+		return -1;
+
+	switch (impl) {
+#ifdef SHA512_X86_ACCEL
+	case SHA512_IMPL_AVX2:
+		sha512_blocks = sha512_blocks_avx2;
+		break;
+#endif
+	default:
+		sha512_blocks = sha512_blocks_generic;
+		break;
+	}
+	sha512_impl_in_use = impl;
+	return 0;
+}
+
+int sha512_get_impl(void)
+{
+	if (sha512_blocks == NULL)
+		sha512_set_impl(SHA512_IMPL_AUTO);
+	return sha512_impl_in_use;
+}
+
+static void sha512_init_state(SHA512_CTX *ctx, const WORD64 iv[8])
+{
+	if (sha512_blocks == NULL)
+		sha512_set_impl(SHA512_IMPL_AUTO);
+
+	ctx->datalen = 0;
+	ctx->bitlen = 0;
+	memcpy(ctx->state, iv, sizeof(ctx->state));
+}
+
+void sha384_init(SHA512_CTX *ctx)
+{
+	static const WORD64 iv[8] = {
+		0xcbbb9d5dc1059ed8ULL,
+		0x629a292a367cd507ULL,
+		0x9159015a3070dd17ULL,
+		0x152fecd8f70e5939ULL,
+		0x67332667ffc00b31ULL,
+		0x8eb44a8768581511ULL,
+		0xdb0c2e0d64f98fa7ULL,
+		0x47b5481dbefa4fa4ULL,
+	};
+
+	sha512_init_state(ctx, iv);
+}
+
+void sha512_init(SHA512_CTX *ctx)
+{
+	static const WORD64 iv[8] = {
+		0x6a09e667f3bcc908ULL,
+		0xbb67ae8584caa73bULL,
+		0x3c6ef372fe94f82bULL,
+		0xa54ff53a5f1d36f1ULL,
+		0x510e527fade682d1ULL,
+		0x9b05688c2b3e6c1fULL,
+		0x1f83d9abfb41bd6bULL,
+		0x5be0cd19137e2179ULL,
+	};
+
+	sha512_init_state(ctx, iv);
+}
+
+void sha512_update(SHA512_CTX *ctx, const BYTE data[], size_t len)
+{
+	size_t fill, nblocks;
+
+	// Top up a partially filled block first.
+	if (ctx->datalen > 0) {
+		fill = 128 - ctx->datalen;
+		if (len < fill) {
+			memcpy(ctx->data + ctx->datalen, data, len);
+			ctx->datalen += (unsigned int)len;
+			return;
+		}
+		memcpy(ctx->data + ctx->datalen, data, fill);
+		sha512_blocks(ctx->state, ctx->data, 1);
+		ctx->bitlen += 1024;
+		ctx->datalen = 0;
+		data += fill;
+		len -= fill;
+	}
+
+	// Whole blocks are hashed straight out of the caller's buffer.
+	nblocks = len / 128;
+	if (nblocks > 0) {
+		sha512_blocks(ctx->state, data, nblocks);
+		ctx->bitlen += (unsigned long long)nblocks * 1024;
+		data += nblocks * 128;
+		len -= nblocks * 128;
+	}
+
+	// Keep the tail for next time.
+	if (len > 0) {
+		memcpy(ctx->data, data, len);
+		ctx->datalen = (unsigned int)len;
+	}
+}
+
+// Pads the buffered tail, appends the length and runs the last one or
+// two blocks, then writes the first out_words words of the state.
+static void sha512_finish(SHA512_CTX *ctx, BYTE hash[], int out_words)
+{
+	unsigned int i;
+	int j;
+
+	i = ctx->datalen;
+	ctx->data[i++] = 0x80;
+	if (ctx->datalen >= 112) {
+		memset(ctx->data + i, 0, 128 - i);
+		sha512_blocks(ctx->state, ctx->data, 1);
+		i = 0;
+	}
+	memset(ctx->data + i, 0, 120 - i);
+
+	// Append the total message's length in bits. The top 64 bits of
+	// the 128-bit length field were zeroed above.
+	ctx->bitlen += (unsigned long long)ctx->datalen * 8;
+	for (j = 0; j < 8; j++)
+		ctx->data[127 - j] = (BYTE)(ctx->bitlen >> (8 * j));
+	sha512_blocks(ctx->state, ctx->data, 1);
+
+	// SHA uses big endian, so reverse the bytes of each word.
+	for (j = 0; j < out_words * 8; j++)
+		hash[j] = (BYTE)(ctx->state[j / 8] >> (56 - 8 * (j % 8)));
+}
+
+void sha384_final(SHA512_CTX *ctx, BYTE hash[])
+{
+	sha512_finish(ctx, hash, 6);
+}
+
+void sha512_final(SHA512_CTX *ctx, BYTE hash[])
+{
+	sha512_finish(ctx, hash, 8);
+}
@@ -0,0 +1,51 @@
+/*********************************************************************
+* Filename:   sha512.h
+* Copyright:  Laurence Lundblade 2022
+* Disclaimer: This code is presented "as is" without any guarantees.
+* Details:    Defines the API for the corresponding SHA-512 and
+              SHA-384 implementation. It follows sha256.h.
+*********************************************************************/
+
+#ifndef SHA512_H
+#define SHA512_H
+
+/*************************** HEADER FILES ***************************/
+#include <stddef.h>
+#include "sha256.h"                     // For BYTE
+
+/****************************** MACROS ******************************/
+#define SHA384_BLOCK_SIZE 48            // SHA384 outputs a 48 byte digest
+#define SHA512_BLOCK_SIZE 64            // SHA512 outputs a 64 byte digest
+
+// Compression function implementations for sha512_set_impl()
+#define SHA512_IMPL_AUTO    0           // Fastest supported by this CPU
+#define SHA512_IMPL_GENERIC 1           // Portable C
+#define SHA512_IMPL_AVX2    2           // x86 AVX2 message schedule, BMI2 rounds
+
+/**************************** DATA TYPES ****************************/
+typedef unsigned long long WORD64;      // 64-bit word
+
+typedef struct {
+	BYTE data[128];
+	unsigned int datalen;
+	unsigned long long bitlen;      // Low half of the 128-bit length; the high half is always 0
+	WORD64 state[8];
+} SHA512_CTX;
+
+/*********************** FUNCTION DECLARATIONS **********************/
+// SHA-384 is SHA-512 with a different initial state and the output
+// truncated, so both use SHA512_CTX and sha512_update().
+void sha384_init(SHA512_CTX *ctx);
+void sha512_init(SHA512_CTX *ctx);
+void sha512_update(SHA512_CTX *ctx, const BYTE data[], size_t len);
+void sha384_final(SHA512_CTX *ctx, BYTE hash[]);
+void sha512_final(SHA512_CTX *ctx, BYTE hash[]);
+
+// The implementation is selected by CPUID on first use. These are
+// mainly for testing and benchmarking. sha512_set_impl() returns 0 on
+// success and -1 if the implementation isn't available on this CPU
+// or in this build. It isn't thread safe with hashing in progress.
+int sha512_set_impl(int impl);
+int sha512_get_impl(void);
+
+#endif   // SHA512_H
@@ -0,0 +1,1280 @@
+/*
+ * ecv.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "ecv.h"
+#include <string.h>
+
+#include "ecv_table.h"
+
+/* The compilers turn the x86 carry intrinsics into adc and sbb
+ * chains, which they don't reliably do for the portable C
+ * below. This is about a third off a verification. */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(ECV_NO_X86_INTRINSICS)
+#define ECV_X86_CARRY
+#include <x86intrin.h>
+#endif
+
+
+/*
+ * Field elements mod p and scalars mod n are 64-bit limbs, least
+ * significant first, four for P-256 and six for P-384. Arrays are
+ * always ECV_MAX_LIMBS long and only the first limbs of the curve
+ * are used. Field elements are always in Montgomery form (times
+ * 2^(64 * limbs) mod p) and fully reduced, so equal values have equal
+ * limbs. Scalars are in normal form except where noted.
+ *
+ * Everything here works on public values only and branches freely.
+ */
+
+
+/* Width of the wNAF for G. ecv_table.h has 2^(7 - 2) odd multiples. */
+#define ECV_G_WINDOW  7
+#define ECV_G_POINTS  32
+
+/* Width of the wNAF for Q. ECV_Q_POINTS is 2^(5 - 2). */
+#define ECV_Q_WINDOW  5
+
+/* The most bits in one of the ECV_SPLITS pieces of a scalar */
+#define ECV_MAX_SPLIT_BITS 96
+
+
+/* ---- 64-bit limb primitives ---- */
+
+#if defined(__SIZEOF_INT128__) && !defined(ECV_NO_INT128)
+__extension__ typedef unsigned __int128 ecv_uint128;
+
+/* Returns the low half of a * b + c + d and puts the high half in *hi */
+static inline uint64_t mac64(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t *hi)
+{
+    ecv_uint128 t = (ecv_uint128)a * b + c + d;
+
+    *hi = (uint64_t)(t >> 64);
+    return (uint64_t)t;
+}
+#else
+static inline uint64_t mac64(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t *hi)
+{
+    uint64_t p0, p1, p2, p3, mid, lo;
+
+    p0 = (a & 0xffffffff) * (b & 0xffffffff);
+    p1 = (a & 0xffffffff) * (b >> 32);
+    p2 = (a >> 32) * (b & 0xffffffff);
+    p3 = (a >> 32) * (b >> 32);
+
+    mid = (p0 >> 32) + (p1 & 0xffffffff) + (p2 & 0xffffffff);
+    lo  = (p0 & 0xffffffff) | (mid << 32);
+    p3 += (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+
+    lo += c;
+    p3 += lo < c;
+    lo += d;
+    p3 += lo < d;
+
+    *hi = p3;
+    return lo;
+}
+#endif
+
+
+#ifdef ECV_X86_CARRY
+/* a + b + carry_in; carry in and out are 0 or 1 */
+static inline uint64_t adc64(uint64_t a, uint64_t b, uint64_t carry_in, uint64_t *carry_out)
+{
+    unsigned long long s;
+
+    *carry_out = _addcarry_u64((unsigned char)carry_in, a, b, &s);
+    return s;
+}
+
+
+/* a - b - borrow_in; borrow in and out are 0 or 1 */
+static inline uint64_t sbb64(uint64_t a, uint64_t b, uint64_t borrow_in, uint64_t *borrow_out)
+{
+    unsigned long long d;
+
+    *borrow_out = _subborrow_u64((unsigned char)borrow_in, a, b, &d);
+    return d;
+}
+#else
+/* a + b + carry_in; carry in and out are 0 or 1 */
+static inline uint64_t adc64(uint64_t a, uint64_t b, uint64_t carry_in, uint64_t *carry_out)
+{
+    uint64_t s = a + carry_in;
+    uint64_t c = s < carry_in;
+
+    s += b;
+    *carry_out = c | (s < b);
+    return s;
+}
+
+
+/* a - b - borrow_in; borrow in and out are 0 or 1 */
+static inline uint64_t sbb64(uint64_t a, uint64_t b, uint64_t borrow_in, uint64_t *borrow_out)
+{
+    uint64_t d = a - b;
+    uint64_t c = a < b;
+
+    *borrow_out = c | (d < borrow_in);
+    return d - borrow_in;
+}
+#endif /* ECV_X86_CARRY */
+
+
+/* ---- Multi-precision arithmetic ---- */
+
+static inline int is_zero(const uint64_t *a, int n)
+{
+    uint64_t z = 0;
+    int      i;
+
+    for(i = 0; i < n; i++) {
+        z |= a[i];
+    }
+    return z == 0;
+}
+
+
+static inline int is_one(const uint64_t *a, int n)
+{
+    return a[0] == 1 && is_zero(a + 1, n - 1);
+}
+
+
+static inline int is_equal(const uint64_t *a, const uint64_t *b, int n)
+{
+    return memcmp(a, b, (size_t)n * sizeof(uint64_t)) == 0;
+}
+
+
+/* 1 if a < m, otherwise 0 */
+static inline int less_than(const uint64_t *a, const uint64_t *m, int n)
+{
+    uint64_t borrow = 0;
+    int      i;
+
+    for(i = 0; i < n; i++) {
+        (void)sbb64(a[i], m[i], borrow, &borrow);
+    }
+    return (int)borrow;
+}
+
+
+/* r = a + b mod m. r may alias a or b. */
+static inline void mod_add(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, int n)
+{
+    uint64_t t[ECV_MAX_LIMBS];
+    uint64_t carry = 0;
+    uint64_t borrow = 0;
+    int      i;
+
+    for(i = 0; i < n; i++) {
+        r[i] = adc64(a[i], b[i], carry, &carry);
+    }
+    for(i = 0; i < n; i++) {
+        t[i] = sbb64(r[i], m[i], borrow, &borrow);
+    }
+    if(carry || !borrow) {
+        memcpy(r, t, (size_t)n * sizeof(uint64_t));
+    }
+}
+
+
+/* r = a - b mod m. r may alias a or b. */
+static inline void mod_sub(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, int n)
+{
+    uint64_t borrow = 0;
+    uint64_t carry = 0;
+    int      i;
+
+    for(i = 0; i < n; i++) {
+        r[i] = sbb64(a[i], b[i], borrow, &borrow);
+    }
+    if(borrow) {
+        for(i = 0; i < n; i++) {
+            r[i] = adc64(r[i], m[i], carry, &carry);
+        }
+    }
+}
+
+
+/*
+ * r = a * b / 2^(64 * n) mod m by word-by-word Montgomery
+ * multiplication (CIOS). a and b must be less than m. r may alias a
+ * or b. This is inlined into wrappers with a constant n so the loops
+ * unroll.
+ */
+static inline void mont_mul(uint64_t       *r,
+                            const uint64_t *a,
+                            const uint64_t *b,
+                            const uint64_t *m,
+                            uint64_t        m0inv,
+                            int             n)
+{
+    uint64_t t[ECV_MAX_LIMBS + 2];
+    uint64_t s[ECV_MAX_LIMBS];
+    uint64_t c, u, borrow;
+    int      i, j;
+
+    for(j = 0; j <= n; j++) {
+        t[j] = 0;
+    }
+    for(i = 0; i < n; i++) {
+        c = 0;
+        for(j = 0; j < n; j++) {
+            t[j] = mac64(a[i], b[j], t[j], c, &c);
+        }
+        t[n] = adc64(t[n], c, 0, &t[n + 1]);
+
+        u = t[0] * m0inv;
+        (void)mac64(u, m[0], t[0], 0, &c);
+        for(j = 1; j < n; j++) {
+            t[j - 1] = mac64(u, m[j], t[j], c, &c);
+        }
+        t[n - 1] = adc64(t[n], c, 0, &c);
+        t[n] = t[n + 1] + c;
+    }
+
+    /* The result is less than 2m, so subtract m once if it's >= m */
+    borrow = 0;
+    for(j = 0; j < n; j++) {
+        s[j] = sbb64(t[j], m[j], borrow, &borrow);
+    }
+    (void)sbb64(t[n], 0, borrow, &borrow);
+    memcpy(r, borrow ? t : s, (size_t)n * sizeof(uint64_t));
+}
+
+
+/* ---- Curve constants ---- */
+
+static const uint64_t p256_p[ECV_MAX_LIMBS] = {
+    0xffffffffffffffffULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL
+};
+static const uint64_t p256_n[ECV_MAX_LIMBS] = {
+    0xf3b9cac2fc632551ULL, 0xbce6faada7179e84ULL, 0xffffffffffffffffULL, 0xffffffff00000000ULL
+};
+#define P256_N_M0INV 0xccd1c8aaee00bc4fULL /* -n^-1 mod 2^64 */
+static const uint64_t p256_rr_p[ECV_MAX_LIMBS] = { /* 2^512 mod p */
+    0x0000000000000003ULL, 0xfffffffbffffffffULL, 0xfffffffffffffffeULL, 0x00000004fffffffdULL
+};
+static const uint64_t p256_rr_n[ECV_MAX_LIMBS] = { /* 2^512 mod n */
+    0x83244c95be79eea2ULL, 0x4699799c49bd6fa6ULL, 0x2845b2392b6bec59ULL, 0x66e12d94f3d95620ULL
+};
+static const uint64_t p256_one_p[ECV_MAX_LIMBS] = { /* 2^256 mod p */
+    0x0000000000000001ULL, 0xffffffff00000000ULL, 0xffffffffffffffffULL, 0x00000000fffffffeULL
+};
+static const uint64_t p256_one_n[ECV_MAX_LIMBS] = { /* 2^256 mod n */
+    0x0c46353d039cdaafULL, 0x4319055258e8617bULL, 0x0000000000000000ULL, 0x00000000ffffffffULL
+};
+static const uint64_t p256_b[ECV_MAX_LIMBS] = { /* Montgomery form */
+    0xd89cdf6229c4bddfULL, 0xacf005cd78843090ULL, 0xe5a220abf7212ed6ULL, 0xdc30061d04874834ULL
+};
+static const uint64_t p256_p_minus_2[ECV_MAX_LIMBS] = {
+    0xfffffffffffffffdULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL
+};
+static const uint64_t p256_n_minus_2[ECV_MAX_LIMBS] = {
+    0xf3b9cac2fc63254fULL, 0xbce6faada7179e84ULL, 0xffffffffffffffffULL, 0xffffffff00000000ULL
+};
+
+static const uint64_t p384_p[ECV_MAX_LIMBS] = {
+    0x00000000ffffffffULL, 0xffffffff00000000ULL, 0xfffffffffffffffeULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+#define P384_P_M0INV 0x0000000100000001ULL /* -p^-1 mod 2^64 */
+static const uint64_t p384_n[ECV_MAX_LIMBS] = {
+    0xecec196accc52973ULL, 0x581a0db248b0a77aULL, 0xc7634d81f4372ddfULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+#define P384_N_M0INV 0x6ed46089e88fdc45ULL /* -n^-1 mod 2^64 */
+static const uint64_t p384_rr_p[ECV_MAX_LIMBS] = { /* 2^768 mod p */
+    0xfffffffe00000001ULL, 0x0000000200000000ULL, 0xfffffffe00000000ULL,
+    0x0000000200000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL
+};
+static const uint64_t p384_rr_n[ECV_MAX_LIMBS] = { /* 2^768 mod n */
+    0x2d319b2419b409a9ULL, 0xff3d81e5df1aa419ULL, 0xbc3e483afcb82947ULL,
+    0xd40d49174aab1cc5ULL, 0x3fb05b7a28266895ULL, 0x0c84ee012b39bf21ULL
+};
+static const uint64_t p384_one_p[ECV_MAX_LIMBS] = { /* 2^384 mod p */
+    0xffffffff00000001ULL, 0x00000000ffffffffULL, 0x0000000000000001ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+};
+static const uint64_t p384_one_n[ECV_MAX_LIMBS] = { /* 2^384 mod n */
+    0x1313e695333ad68dULL, 0xa7e5f24db74f5885ULL, 0x389cb27e0bc8d220ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+};
+static const uint64_t p384_b[ECV_MAX_LIMBS] = { /* Montgomery form */
+    0x081188719d412dccULL, 0xf729add87a4c32ecULL, 0x77f2209b1920022eULL,
+    0xe3374bee94938ae2ULL, 0xb62b21f41f022094ULL, 0xcd08114b604fbff9ULL
+};
+static const uint64_t p384_p_minus_2[ECV_MAX_LIMBS] = {
+    0x00000000fffffffdULL, 0xffffffff00000000ULL, 0xfffffffffffffffeULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+static const uint64_t p384_n_minus_2[ECV_MAX_LIMBS] = {
+    0xecec196accc52971ULL, 0x581a0db248b0a77aULL, 0xc7634d81f4372ddfULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+
+
+/*
+ * P-256 field multiplication. The full product then Montgomery
+ * reduction using the shape of p: -p^-1 mod 2^64 is 1 so the
+ * multiplier is just the low limb, and p[0] + p[1] * 2^64 = 2^96 - 1
+ * so only p[3] needs a multiply.
+ */
+static void p256_fe_mul(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+    uint64_t t[8];
+    uint64_t s[4];
+    uint64_t c, hi, lo, u, top, borrow;
+    int      i, j;
+
+    t[0] = mac64(a[0], b[0], 0, 0, &c);
+    t[1] = mac64(a[0], b[1], 0, c, &c);
+    t[2] = mac64(a[0], b[2], 0, c, &c);
+    t[3] = mac64(a[0], b[3], 0, c, &c);
+    t[4] = c;
+    for(i = 1; i < 4; i++) {
+        t[i]     = mac64(a[i], b[0], t[i], 0, &c);
+        t[i + 1] = mac64(a[i], b[1], t[i + 1], c, &c);
+        t[i + 2] = mac64(a[i], b[2], t[i + 2], c, &c);
+        t[i + 3] = mac64(a[i], b[3], t[i + 3], c, &c);
+        t[i + 4] = c;
+    }
+
+    top = 0;
+    for(i = 0; i < 4; i++) {
+        u = t[i];
+        t[i + 1] = adc64(t[i + 1], u << 32, 0, &c);
+        t[i + 2] = adc64(t[i + 2], u >> 32, c, &c);
+        lo = mac64(u, 0xffffffff00000001ULL, 0, 0, &hi);
+        t[i + 3] = adc64(t[i + 3], lo, c, &c);
+        t[i + 4] = adc64(t[i + 4], hi, c, &c);
+        for(j = i + 5; j < 8; j++) {
+            t[j] = adc64(t[j], 0, c, &c);
+        }
+        top += c;
+    }
+
+    borrow = 0;
+    for(i = 0; i < 4; i++) {
+        s[i] = sbb64(t[i + 4], p256_p[i], borrow, &borrow);
+    }
+    (void)sbb64(top, 0, borrow, &borrow);
+    memcpy(r, borrow ? &t[4] : s, 4 * sizeof(uint64_t));
+}
+
+static void p256_sc_mul(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+    mont_mul(r, a, b, p256_n, P256_N_M0INV, 4);
+}
+
+static void p384_fe_mul(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+    mont_mul(r, a, b, p384_p, P384_P_M0INV, 6);
+}
+
+static void p384_sc_mul(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+    mont_mul(r, a, b, p384_n, P384_N_M0INV, 6);
+}
+
+
+typedef void (ecv_mul_fn)(uint64_t *r, const uint64_t *a, const uint64_t *b);
+
+struct ecv_curve {
+    int             limbs;
+    size_t          bytes;      /* Size of a coordinate or scalar */
+    int             split_bits; /* Bits in each of the ECV_SPLITS pieces */
+    const uint64_t *p;
+    const uint64_t *n;
+    const uint64_t *rr_p;
+    const uint64_t *rr_n;
+    const uint64_t *one_p;
+    const uint64_t *one_n;
+    const uint64_t *b;
+    const uint64_t *p_minus_2;
+    const uint64_t *n_minus_2;
+    ecv_mul_fn     *fe_mul;
+    ecv_mul_fn     *sc_mul;
+    const uint64_t *g_table;    /* [ECV_SPLITS][ECV_G_POINTS][2 * limbs] */
+};
+
+static const struct ecv_curve ecv_p256 = {
+    4, 32, 64,
+    p256_p, p256_n, p256_rr_p, p256_rr_n, p256_one_p, p256_one_n,
+    p256_b, p256_p_minus_2, p256_n_minus_2,
+    p256_fe_mul, p256_sc_mul,
+    &ecv_p256_g_table[0][0][0]
+};
+
+static const struct ecv_curve ecv_p384 = {
+    6, 48, 96,
+    p384_p, p384_n, p384_rr_p, p384_rr_n, p384_one_p, p384_one_n,
+    p384_b, p384_p_minus_2, p384_n_minus_2,
+    p384_fe_mul, p384_sc_mul,
+    &ecv_p384_g_table[0][0][0]
+};
+
+static const struct ecv_curve *curve_for(int curve)
+{
+    switch(curve) {
+    case ECV_P256: return &ecv_p256;
+    case ECV_P384: return &ecv_p384;
+    default:       return NULL;
+    }
+}
+
+
+/* ---- Field and scalar helpers ---- */
+
+static inline void fe_add(const struct ecv_curve *c, uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+    mod_add(r, a, b, c->p, c->limbs);
+}
+
+static inline void fe_sub(const struct ecv_curve *c, uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+    mod_sub(r, a, b, c->p, c->limbs);
+}
+
+
+/*
+ * r = a^e in Montgomery form with 4-bit fixed windows, where a is in
+ * Montgomery form and mul is the Montgomery multiplication for the
+ * modulus. Used for inversion by Fermat's little theorem.
+ */
+static void mod_pow(const struct ecv_curve *c,
+                    ecv_mul_fn             *mul,
+                    uint64_t               *r,
+                    const uint64_t         *a,
+                    const uint64_t         *e,
+                    const uint64_t         *one)
+{
+    uint64_t table[16][ECV_MAX_LIMBS];
+    uint64_t acc[ECV_MAX_LIMBS];
+    unsigned digit;
+    int      i;
+
+    memcpy(table[1], a, sizeof(table[1]));
+    for(i = 2; i < 16; i++) {
+        mul(table[i], table[i - 1], a);
+    }
+
+    memcpy(acc, one, sizeof(acc));
+    for(i = c->limbs * 16 - 1; i >= 0; i--) {
+        mul(acc, acc, acc);
+        mul(acc, acc, acc);
+        mul(acc, acc, acc);
+        mul(acc, acc, acc);
+        digit = (unsigned)(e[i / 16] >> ((i % 16) * 4)) & 0xf;
+        if(digit) {
+            mul(acc, acc, table[digit]);
+        }
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+
+/* r = a / 2 mod m for odd m */
+static inline void mod_half(uint64_t *r, const uint64_t *a, const uint64_t *m, int n)
+{
+    uint64_t carry = 0;
+    int      i;
+
+    if(a[0] & 1) {
+        for(i = 0; i < n; i++) {
+            r[i] = adc64(a[i], m[i], carry, &carry);
+        }
+    } else {
+        memcpy(r, a, (size_t)n * sizeof(uint64_t));
+    }
+    for(i = 0; i < n - 1; i++) {
+        r[i] = (r[i] >> 1) | (r[i + 1] << 63);
+    }
+    r[n - 1] = (r[n - 1] >> 1) | (carry << 63);
+}
+
+
+/* Shifts a right one bit */
+static inline void shift_right(uint64_t *a, int n)
+{
+    int i;
+
+    for(i = 0; i < n - 1; i++) {
+        a[i] = (a[i] >> 1) | (a[i + 1] << 63);
+    }
+    a[n - 1] >>= 1;
+}
+
+
+/*
+ * r = a^-1 mod n in normal form for 0 < a < n by the binary extended
+ * Euclidean algorithm. Its running time depends on a, which is fine
+ * here because a is part of the signature. It is several times
+ * faster than Fermat's little theorem.
+ */
+static void sc_inv(const struct ecv_curve *c, uint64_t *r, const uint64_t *a)
+{
+    uint64_t  u[ECV_MAX_LIMBS];
+    uint64_t  v[ECV_MAX_LIMBS];
+    uint64_t  x1[ECV_MAX_LIMBS];
+    uint64_t  x2[ECV_MAX_LIMBS];
+    const int n = c->limbs;
+
+    memcpy(u, a, sizeof(u));
+    memcpy(v, c->n, sizeof(v));
+    memset(x1, 0, sizeof(x1));
+    memset(x2, 0, sizeof(x2));
+    x1[0] = 1;
+
+    /* Invariants: x1 * a = u and x2 * a = v mod n */
+    while(!is_one(u, n) && !is_one(v, n)) {
+        while(!(u[0] & 1)) {
+            shift_right(u, n);
+            mod_half(x1, x1, c->n, n);
+        }
+        while(!(v[0] & 1)) {
+            shift_right(v, n);
+            mod_half(x2, x2, c->n, n);
+        }
+        if(less_than(u, v, n)) {
+            mod_sub(v, v, u, c->n, n);
+            mod_sub(x2, x2, x1, c->n, n);
+        } else {
+            mod_sub(u, u, v, c->n, n);
+            mod_sub(x1, x1, x2, c->n, n);
+        }
+    }
+    memcpy(r, is_one(u, n) ? x1 : x2, sizeof(x1));
+}
+
+
+/* Big-endian bytes to limbs */
+static void bytes_to_limbs(uint64_t *r, const uint8_t *bytes, int n)
+{
+    int i;
+    int j;
+
+    for(i = 0; i < n; i++) {
+        r[n - 1 - i] = 0;
+        for(j = 0; j < 8; j++) {
+            r[n - 1 - i] = (r[n - 1 - i] << 8) | bytes[i * 8 + j];
+        }
+    }
+}
+
+
+/* Converts a hash to a scalar as ECDSA does: the leftmost bits
+ * reduced mod n. Both curves are a whole number of bytes. */
+static void hash_to_scalar(const struct ecv_curve *c,
+                           uint64_t               *e,
+                           const uint8_t          *hash,
+                           size_t                  hash_len)
+{
+    uint8_t padded[ECV_MAX_LIMBS * 8];
+
+    if(hash_len >= c->bytes) {
+        memcpy(padded, hash, c->bytes);
+    } else {
+        memset(padded, 0, c->bytes - hash_len);
+        memcpy(padded + c->bytes - hash_len, hash, hash_len);
+    }
+    bytes_to_limbs(e, padded, c->limbs);
+    if(!less_than(e, c->n, c->limbs)) {
+        mod_sub(e, e, c->n, c->n, c->limbs);
+    }
+}
+
+
+/* ---- Points ---- */
+
+/* A point in Jacobian coordinates: (x / z^2, y / z^3) */
+struct ecv_point {
+    uint64_t x[ECV_MAX_LIMBS];
+    uint64_t y[ECV_MAX_LIMBS];
+    uint64_t z[ECV_MAX_LIMBS];
+    int      infinity;
+};
+
+
+/*
+ * r = 2 * a. The "dbl-2001-b" formulas for a = -3, 3M + 5S. r may
+ * alias a. There are no points of order 2 on these curves so y is
+ * never zero.
+ */
+static void point_double(const struct ecv_curve *c, struct ecv_point *r, const struct ecv_point *a)
+{
+    uint64_t delta[ECV_MAX_LIMBS];
+    uint64_t gamma[ECV_MAX_LIMBS];
+    uint64_t beta[ECV_MAX_LIMBS];
+    uint64_t alpha[ECV_MAX_LIMBS];
+    uint64_t t1[ECV_MAX_LIMBS];
+    uint64_t t2[ECV_MAX_LIMBS];
+
+    if(a->infinity) {
+        r->infinity = 1;
+        return;
+    }
+
+    c->fe_mul(delta, a->z, a->z);
+    c->fe_mul(gamma, a->y, a->y);
+    c->fe_mul(beta, a->x, gamma);
+
+    /* alpha = 3 * (x - delta) * (x + delta) */
+    fe_sub(c, t1, a->x, delta);
+    fe_add(c, t2, a->x, delta);
+    c->fe_mul(t1, t1, t2);
+    fe_add(c, alpha, t1, t1);
+    fe_add(c, alpha, alpha, t1);
+
+    /* z3 = (y + z)^2 - gamma - delta */
+    fe_add(c, t1, a->y, a->z);
+    c->fe_mul(t1, t1, t1);
+    fe_sub(c, t1, t1, gamma);
+    fe_sub(c, r->z, t1, delta);
+
+    /* x3 = alpha^2 - 8 * beta */
+    fe_add(c, beta, beta, beta);
+    fe_add(c, beta, beta, beta);
+    fe_add(c, t2, beta, beta);
+    c->fe_mul(t1, alpha, alpha);
+    fe_sub(c, r->x, t1, t2);
+
+    /* y3 = alpha * (4 * beta - x3) - 8 * gamma^2 */
+    fe_sub(c, t1, beta, r->x);
+    c->fe_mul(t1, alpha, t1);
+    c->fe_mul(gamma, gamma, gamma);
+    fe_add(c, gamma, gamma, gamma);
+    fe_add(c, gamma, gamma, gamma);
+    fe_add(c, gamma, gamma, gamma);
+    fe_sub(c, r->y, t1, gamma);
+
+    r->infinity = 0;
+}
+
+
+
+
+/*
+ * r = a + (x2, y2) or a - (x2, y2) if negate. (x2, y2) is affine.
+ * The "madd-2007-bl" formulas, 7M + 4S. r may alias a.
+ */
+static void point_add_affine(const struct ecv_curve *c,
+                             struct ecv_point       *r,
+                             const struct ecv_point *a,
+                             const uint64_t         *x2,
+                             const uint64_t         *y2,
+                             int                     negate)
+{
+    uint64_t  y[ECV_MAX_LIMBS];
+    uint64_t  z1z1[ECV_MAX_LIMBS];
+    uint64_t  u2[ECV_MAX_LIMBS];
+    uint64_t  s2[ECV_MAX_LIMBS];
+    uint64_t  h[ECV_MAX_LIMBS];
+    uint64_t  hh[ECV_MAX_LIMBS];
+    uint64_t  i4[ECV_MAX_LIMBS];
+    uint64_t  j[ECV_MAX_LIMBS];
+    uint64_t  rr[ECV_MAX_LIMBS];
+    uint64_t  v[ECV_MAX_LIMBS];
+    uint64_t  y1j[ECV_MAX_LIMBS];
+    uint64_t  t[ECV_MAX_LIMBS];
+    const int n = c->limbs;
+
+    /* y2 is never zero as there are no points of order 2. x2 and y2
+     * may be in a table with only n limbs per coordinate so no more
+     * than that is read. */
+    if(negate) {
+        mod_sub(y, c->p, y2, c->p, n);
+    } else {
+        memcpy(y, y2, (size_t)n * sizeof(uint64_t));
+    }
+
+    if(a->infinity) {
+        memcpy(r->x, x2, (size_t)n * sizeof(uint64_t));
+        memcpy(r->y, y, sizeof(r->y));
+        memcpy(r->z, c->one_p, sizeof(r->z));
+        r->infinity = 0;
+        return;
+    }
+
+    c->fe_mul(z1z1, a->z, a->z);
+    c->fe_mul(u2, x2, z1z1);
+    c->fe_mul(s2, a->z, z1z1);
+    c->fe_mul(s2, y, s2);
+    fe_sub(c, h, u2, a->x);
+    fe_sub(c, rr, s2, a->y);
+
+    if(is_zero(h, n)) {
+        if(is_zero(rr, n)) {
+            point_double(c, r, a);
+        } else {
+            r->infinity = 1;
+        }
+        return;
+    }
+
+    c->fe_mul(hh, h, h);
+    fe_add(c, i4, hh, hh);
+    fe_add(c, i4, i4, i4);
+    c->fe_mul(j, h, i4);
+    fe_add(c, rr, rr, rr);
+    c->fe_mul(v, a->x, i4);
+    c->fe_mul(y1j, a->y, j);
+    fe_add(c, y1j, y1j, y1j);
+
+    /* z3 = (z1 + h)^2 - z1z1 - hh */
+    fe_add(c, t, a->z, h);
+    c->fe_mul(t, t, t);
+    fe_sub(c, t, t, z1z1);
+    fe_sub(c, r->z, t, hh);
+
+    /* x3 = rr^2 - j - 2 * v */
+    c->fe_mul(t, rr, rr);
+    fe_sub(c, t, t, j);
+    fe_sub(c, t, t, v);
+    fe_sub(c, r->x, t, v);
+
+    /* y3 = rr * (v - x3) - 2 * y1 * j */
+    fe_sub(c, t, v, r->x);
+    c->fe_mul(t, rr, t);
+    fe_sub(c, r->y, t, y1j);
+
+    r->infinity = 0;
+}
+
+
+/*
+ * r = a + b, both Jacobian. The "add-2007-bl" formulas, 11M + 5S.
+ * r may alias a or b. Only used to make key tables.
+ */
+static void point_add(const struct ecv_curve *c,
+                      struct ecv_point       *r,
+                      const struct ecv_point *a,
+                      const struct ecv_point *b)
+{
+    uint64_t  z1z1[ECV_MAX_LIMBS];
+    uint64_t  z2z2[ECV_MAX_LIMBS];
+    uint64_t  u1[ECV_MAX_LIMBS];
+    uint64_t  u2[ECV_MAX_LIMBS];
+    uint64_t  s1[ECV_MAX_LIMBS];
+    uint64_t  s2[ECV_MAX_LIMBS];
+    uint64_t  h[ECV_MAX_LIMBS];
+    uint64_t  i4[ECV_MAX_LIMBS];
+    uint64_t  j[ECV_MAX_LIMBS];
+    uint64_t  rr[ECV_MAX_LIMBS];
+    uint64_t  v[ECV_MAX_LIMBS];
+    uint64_t  t[ECV_MAX_LIMBS];
+    const int n = c->limbs;
+
+    if(a->infinity) {
+        *r = *b;
+        return;
+    }
+    if(b->infinity) {
+        *r = *a;
+        return;
+    }
+
+    c->fe_mul(z1z1, a->z, a->z);
+    c->fe_mul(z2z2, b->z, b->z);
+    c->fe_mul(u1, a->x, z2z2);
+    c->fe_mul(u2, b->x, z1z1);
+    c->fe_mul(s1, b->z, z2z2);
+    c->fe_mul(s1, a->y, s1);
+    c->fe_mul(s2, a->z, z1z1);
+    c->fe_mul(s2, b->y, s2);
+    fe_sub(c, h, u2, u1);
+    fe_sub(c, rr, s2, s1);
+
+    if(is_zero(h, n)) {
+        if(is_zero(rr, n)) {
+            point_double(c, r, a);
+        } else {
+            r->infinity = 1;
+        }
+        return;
+    }
+
+    fe_add(c, i4, h, h);
+    c->fe_mul(i4, i4, i4);
+    c->fe_mul(j, h, i4);
+    fe_add(c, rr, rr, rr);
+    c->fe_mul(v, u1, i4);
+
+    /* z3 = ((z1 + z2)^2 - z1z1 - z2z2) * h */
+    fe_add(c, t, a->z, b->z);
+    c->fe_mul(t, t, t);
+    fe_sub(c, t, t, z1z1);
+    fe_sub(c, t, t, z2z2);
+    c->fe_mul(r->z, t, h);
+
+    /* x3 = rr^2 - j - 2 * v */
+    c->fe_mul(t, rr, rr);
+    fe_sub(c, t, t, j);
+    fe_sub(c, t, t, v);
+    fe_sub(c, r->x, t, v);
+
+    /* y3 = rr * (v - x3) - 2 * s1 * j */
+    c->fe_mul(s1, s1, j);
+    fe_add(c, s1, s1, s1);
+    fe_sub(c, t, v, r->x);
+    c->fe_mul(t, rr, t);
+    fe_sub(c, r->y, t, s1);
+
+    r->infinity = 0;
+}
+
+
+/*
+ * Converts the points in a key table under construction to affine
+ * with one inversion (Montgomery's trick). None may be infinity.
+ */
+static void table_to_affine(const struct ecv_curve *c,
+                            struct ecv_key         *key,
+                            const struct ecv_point  points[ECV_SPLITS * ECV_Q_POINTS])
+{
+    uint64_t prefix[ECV_SPLITS * ECV_Q_POINTS][ECV_MAX_LIMBS];
+    uint64_t inverse[ECV_MAX_LIMBS];
+    uint64_t z_inverse[ECV_MAX_LIMBS];
+    uint64_t z_inverse2[ECV_MAX_LIMBS];
+    int      i;
+
+    memcpy(prefix[0], points[0].z, sizeof(prefix[0]));
+    for(i = 1; i < ECV_SPLITS * ECV_Q_POINTS; i++) {
+        c->fe_mul(prefix[i], prefix[i - 1], points[i].z);
+    }
+
+    mod_pow(c, c->fe_mul, inverse, prefix[ECV_SPLITS * ECV_Q_POINTS - 1], c->p_minus_2, c->one_p);
+
+    for(i = ECV_SPLITS * ECV_Q_POINTS - 1; i >= 0; i--) {
+        if(i > 0) {
+            c->fe_mul(z_inverse, inverse, prefix[i - 1]);
+            c->fe_mul(inverse, inverse, points[i].z);
+        } else {
+            memcpy(z_inverse, inverse, sizeof(z_inverse));
+        }
+        c->fe_mul(z_inverse2, z_inverse, z_inverse);
+        c->fe_mul(key->table[i / ECV_Q_POINTS][i % ECV_Q_POINTS][0], points[i].x, z_inverse2);
+        c->fe_mul(z_inverse2, z_inverse2, z_inverse);
+        c->fe_mul(key->table[i / ECV_Q_POINTS][i % ECV_Q_POINTS][1], points[i].y, z_inverse2);
+    }
+}
+
+
+/* ---- Double-scalar multiplication ---- */
+
+/*
+ * Width-w NAF of the up to 96-bit value (lo, hi). digits must be
+ * zeroed and have room for ECV_MAX_SPLIT_BITS + 1. Returns the number
+ * of digits.
+ */
+static int wnaf(int8_t *digits, uint64_t lo, uint64_t hi, int w)
+{
+    const uint64_t mask = ((uint64_t)1 << w) - 1;
+    int64_t        d;
+    int            len = 0;
+
+    while(lo | hi) {
+        if(lo & 1) {
+            d = (int64_t)(lo & mask);
+            if(d >= ((int64_t)1 << (w - 1))) {
+                d -= (int64_t)1 << w;
+            }
+            /* Subtract d so the next w - 1 bits are zero */
+            if(d > 0) {
+                hi -= lo < (uint64_t)d;
+                lo -= (uint64_t)d;
+            } else {
+                lo += (uint64_t)-d;
+                hi += lo < (uint64_t)-d;
+            }
+            digits[len] = (int8_t)d;
+        }
+        len++;
+        lo = (lo >> 1) | (hi << 63);
+        hi >>= 1;
+    }
+    return len;
+}
+
+
+/* Bits [start, start + count) of k, count up to 96 */
+static void scalar_bits(const uint64_t *k, int start, int count, uint64_t *lo, uint64_t *hi)
+{
+    uint64_t w[3];
+    int      limb  = start / 64;
+    int      shift = start % 64;
+    int      i;
+
+    for(i = 0; i < 3; i++) {
+        w[i] = limb + i < ECV_MAX_LIMBS ? k[limb + i] : 0;
+    }
+    if(shift) {
+        w[0] = (w[0] >> shift) | (w[1] << (64 - shift));
+        w[1] = (w[1] >> shift) | (w[2] << (64 - shift));
+    }
+    if(count < 64) {
+        *lo = w[0] & (((uint64_t)1 << count) - 1);
+        *hi = 0;
+    } else {
+        *lo = w[0];
+        *hi = count > 64 ? w[1] & (((uint64_t)1 << (count - 64)) - 1) : 0;
+    }
+}
+
+
+/*
+ * r = u1 * G + u2 * Q. Each scalar is split into ECV_SPLITS pieces
+ * of split_bits, piece j being multiplied by 2^(split_bits * j) * G
+ * or * Q, whose odd multiples are in the tables. All the pieces are
+ * in wNAF and are done in one pass, so there are only split_bits
+ * doublings.
+ */
+static void double_mult(const struct ecv_curve *c,
+                        struct ecv_point       *r,
+                        const struct ecv_key   *key,
+                        const uint64_t         *u1,
+                        const uint64_t         *u2)
+{
+    int8_t          naf[2][ECV_SPLITS][ECV_MAX_SPLIT_BITS + 1];
+    uint64_t        lo, hi;
+    const uint64_t *g;
+    int             len;
+    int             top = 0;
+    int             i, j, d;
+
+    memset(naf, 0, sizeof(naf));
+    for(j = 0; j < ECV_SPLITS; j++) {
+        scalar_bits(u1, j * c->split_bits, c->split_bits, &lo, &hi);
+        len = wnaf(naf[0][j], lo, hi, ECV_G_WINDOW);
+        top = len > top ? len : top;
+        scalar_bits(u2, j * c->split_bits, c->split_bits, &lo, &hi);
+        len = wnaf(naf[1][j], lo, hi, ECV_Q_WINDOW);
+        top = len > top ? len : top;
+    }
+
+    r->infinity = 1;
+    for(i = top - 1; i >= 0; i--) {
+        point_double(c, r, r);
+        for(j = 0; j < ECV_SPLITS; j++) {
+            d = naf[0][j][i];
+            if(d) {
+                g = c->g_table + ((size_t)j * ECV_G_POINTS + (size_t)((d < 0 ? -d : d) >> 1)) * 2 * (size_t)c->limbs;
+                point_add_affine(c, r, r, g, g + c->limbs, d < 0);
+            }
+            d = naf[1][j][i];
+            if(d) {
+                g = key->table[j][(d < 0 ? -d : d) >> 1][0];
+                point_add_affine(c, r, r, g, key->table[j][(d < 0 ? -d : d) >> 1][1], d < 0);
+            }
+        }
+    }
+}
+
+
+/* ---- Public functions ---- */
+
+/*
+ * Public function, see ecv.h
+ */
+int ecv_key_init(struct ecv_key *key,
+                 int             curve,
+                 const uint8_t  *point,
+                 size_t          point_len)
+{
+    const struct ecv_curve *c = curve_for(curve);
+    struct ecv_point        points[ECV_SPLITS * ECV_Q_POINTS];
+    struct ecv_point        base;
+    struct ecv_point        twice;
+    uint64_t                lhs[ECV_MAX_LIMBS];
+    uint64_t                rhs[ECV_MAX_LIMBS];
+    uint64_t                t[ECV_MAX_LIMBS];
+    int                     n;
+    int                     i, j;
+
+    if(c == NULL) {
+        return ECV_ERR_UNSUPPORTED_CURVE;
+    }
+    n = c->limbs;
+
+    if(point_len != 1 + 2 * c->bytes || point[0] != 0x04) {
+        return ECV_ERR_INVALID_KEY;
+    }
+
+    memset(&base, 0, sizeof(base));
+    bytes_to_limbs(base.x, point + 1, n);
+    bytes_to_limbs(base.y, point + 1 + c->bytes, n);
+    if(!less_than(base.x, c->p, n) || !less_than(base.y, c->p, n)) {
+        return ECV_ERR_INVALID_KEY;
+    }
+    c->fe_mul(base.x, base.x, c->rr_p);
+    c->fe_mul(base.y, base.y, c->rr_p);
+    memcpy(base.z, c->one_p, sizeof(base.z));
+
+    /* y^2 = x^3 - 3x + b. The curves have prime order so any point on
+     * them other than infinity is a valid public key. */
+    c->fe_mul(lhs, base.y, base.y);
+    c->fe_mul(rhs, base.x, base.x);
+    c->fe_mul(rhs, rhs, base.x);
+    fe_add(c, t, base.x, base.x);
+    fe_add(c, t, t, base.x);
+    fe_sub(c, rhs, rhs, t);
+    fe_add(c, rhs, rhs, c->b);
+    if(!is_equal(lhs, rhs, n)) {
+        return ECV_ERR_INVALID_KEY;
+    }
+
+    /* The odd multiples of 2^(split_bits * j) * Q. None of them is
+     * infinity or needs the special cases in point_add() as they are
+     * all smaller multiples of Q than the order. */
+    for(j = 0; j < ECV_SPLITS; j++) {
+        if(j > 0) {
+            for(i = 0; i < c->split_bits; i++) {
+                point_double(c, &base, &base);
+            }
+        }
+        point_double(c, &twice, &base);
+        points[j * ECV_Q_POINTS] = base;
+        for(i = 1; i < ECV_Q_POINTS; i++) {
+            point_add(c, &points[j * ECV_Q_POINTS + i], &points[j * ECV_Q_POINTS + i - 1], &twice);
+        }
+    }
+
+    memset(key, 0, sizeof(*key));
+    table_to_affine(c, key, points);
+    key->curve = curve;
+
+    return ECV_SUCCESS;
+}
+
+
+/*
+ * Public function, see ecv.h
+ */
+int ecv_verify(const struct ecv_key *key,
+               const uint8_t        *hash,
+               size_t                hash_len,
+               const uint8_t        *signature,
+               size_t                signature_len)
+{
+    const struct ecv_curve *c = curve_for(key->curve);
+    struct ecv_point        point;
+    uint64_t                r[ECV_MAX_LIMBS];
+    uint64_t                s[ECV_MAX_LIMBS];
+    uint64_t                e[ECV_MAX_LIMBS];
+    uint64_t                w[ECV_MAX_LIMBS];
+    uint64_t                u1[ECV_MAX_LIMBS];
+    uint64_t                u2[ECV_MAX_LIMBS];
+    uint64_t                zz[ECV_MAX_LIMBS];
+    uint64_t                t[ECV_MAX_LIMBS];
+    uint64_t                carry;
+    int                     n;
+    int                     i;
+
+    if(c == NULL) {
+        return ECV_ERR_INVALID_ARG;
+    }
+    n = c->limbs;
+
+    if(signature_len != 2 * c->bytes) {
+        return ECV_ERR_BAD_SIGNATURE;
+    }
+    memset(r, 0, sizeof(r));
+    memset(s, 0, sizeof(s));
+    bytes_to_limbs(r, signature, n);
+    bytes_to_limbs(s, signature + c->bytes, n);
+    if(is_zero(r, n) || !less_than(r, c->n, n) ||
+       is_zero(s, n) || !less_than(s, c->n, n)) {
+        return ECV_ERR_BAD_SIGNATURE;
+    }
+
+    memset(e, 0, sizeof(e));
+    hash_to_scalar(c, e, hash, hash_len);
+
+    /* w = s^-1 in Montgomery form. Multiplying a normal-form value by
+     * it gives a normal-form product. */
+    sc_inv(c, w, s);
+    c->sc_mul(w, w, c->rr_n);
+    memset(u1, 0, sizeof(u1));
+    memset(u2, 0, sizeof(u2));
+    c->sc_mul(u1, e, w);
+    c->sc_mul(u2, r, w);
+
+    double_mult(c, &point, key, u1, u2);
+    if(point.infinity) {
+        return ECV_ERR_BAD_SIGNATURE;
+    }
+
+    /* The x coordinate is point.x / z^2 mod p and must equal r mod
+     * n. Rather than invert z, check r * z^2 == point.x and, if r + n
+     * is still less than p, (r + n) * z^2 == point.x. */
+    c->fe_mul(zz, point.z, point.z);
+    c->fe_mul(t, r, c->rr_p);
+    c->fe_mul(t, t, zz);
+    if(is_equal(t, point.x, n)) {
+        return ECV_SUCCESS;
+    }
+
+    carry = 0;
+    for(i = 0; i < n; i++) {
+        r[i] = adc64(r[i], c->n[i], carry, &carry);
+    }
+    if(carry || !less_than(r, c->p, n)) {
+        return ECV_ERR_BAD_SIGNATURE;
+    }
+    c->fe_mul(t, r, c->rr_p);
+    c->fe_mul(t, t, zz);
+    if(is_equal(t, point.x, n)) {
+        return ECV_SUCCESS;
+    }
+
+    return ECV_ERR_BAD_SIGNATURE;
+}
+
+
+/* ---- Key cache ---- */
+
+/* FNV-1a, to pick the cache set */
+static uint64_t index_hash(const uint8_t *data, size_t len)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    while(len--) {
+        h ^= *data++;
+        h *= 0x100000001b3ULL;
+    }
+    return h ^ (h >> 32);
+}
+
+
+/*
+ * Public function, see ecv.h
+ */
+int ecv_cache_init(struct ecv_cache       *cache,
+                   struct ecv_cache_entry *entries,
+                   size_t                  num_entries)
+{
+    size_t sets = num_entries / ECV_CACHE_WAYS;
+
+    if(sets == 0 || num_entries % ECV_CACHE_WAYS || (sets & (sets - 1))) {
+        return ECV_ERR_INVALID_ARG;
+    }
+
+    cache->entries  = entries;
+    cache->set_mask = sets - 1;
+    ecv_cache_clear(cache);
+
+    return ECV_SUCCESS;
+}
+
+
+/*
+ * Public function, see ecv.h
+ */
+void ecv_cache_clear(struct ecv_cache *cache)
+{
+    size_t i;
+
+    for(i = 0; i < (cache->set_mask + 1) * ECV_CACHE_WAYS; i++) {
+        cache->entries[i].last_use  = 0;
+        cache->entries[i].point_len = 0;
+        cache->entries[i].key.curve = 0;
+    }
+    cache->clock  = 0;
+    cache->hits   = 0;
+    cache->misses = 0;
+}
+
+
+/*
+ * Public function, see ecv.h
+ */
+int ecv_cache_get(struct ecv_cache      *cache,
+                  int                    curve,
+                  const uint8_t         *kid,
+                  size_t                 kid_len,
+                  const uint8_t         *point,
+                  size_t                 point_len,
+                  const struct ecv_key **key)
+{
+    struct ecv_cache_entry *set;
+    struct ecv_cache_entry *victim;
+    uint64_t                h;
+    int                     result;
+    int                     i;
+
+    if(point_len > ECV_MAX_PUBLIC_KEY_SIZE) {
+        return ECV_ERR_INVALID_KEY;
+    }
+
+    h = kid_len ? index_hash(kid, kid_len) : index_hash(point, point_len);
+    set = &cache->entries[(h & cache->set_mask) * ECV_CACHE_WAYS];
+
+    cache->clock++;
+    victim = &set[0];
+    for(i = 0; i < ECV_CACHE_WAYS; i++) {
+        if(set[i].last_use &&
+           set[i].key.curve == curve &&
+           set[i].point_len == point_len &&
+           !memcmp(set[i].point, point, point_len)) {
+            set[i].last_use = cache->clock;
+            cache->hits++;
+            *key = &set[i].key;
+            return ECV_SUCCESS;
+        }
+        if(set[i].last_use < victim->last_use) {
+            victim = &set[i];
+        }
+    }
+
+    cache->misses++;
+    victim->last_use = 0;
+    result = ecv_key_init(&victim->key, curve, point, point_len);
+    if(result != ECV_SUCCESS) {
+        victim->key.curve = 0;
+        return result;
+    }
+    memcpy(victim->point, point, point_len);
+    victim->point_len = point_len;
+    victim->last_use  = cache->clock;
+    *key = &victim->key;
+
+    return ECV_SUCCESS;
+}
+
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define ECV_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define ECV_THREAD_LOCAL __thread
+#else
+#define ECV_THREAD_LOCAL
+#endif
+
+static ECV_THREAD_LOCAL struct ecv_cache *thread_cache = NULL;
+
+
+/*
+ * Public function, see ecv.h
+ */
+void ecv_set_thread_cache(struct ecv_cache *cache)
+{
+    thread_cache = cache;
+}
+
+
+/*
+ * Public function, see ecv.h
+ */
+struct ecv_cache *ecv_thread_cache(void)
+{
+    return thread_cache;
+}
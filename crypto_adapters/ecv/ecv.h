@@ -0,0 +1,242 @@
+/*
+ * ecv.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef __ECV_H__
+#define __ECV_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * \file ecv.h
+ *
+ * \brief Fast ECDSA verification on P-256 and P-384 for long-lived
+ * public keys.
+ *
+ * This is a verify-only engine for servers that check many
+ * signatures against a modest set of keys that don't change
+ * often. It has no dependency on any other crypto library and doesn't
+ * use the heap.
+ *
+ * Most of the cost of an ECDSA verification is u1 * G + u2 * Q. This
+ * computes it with both scalars split into four pieces, each
+ * recoded in wNAF, and all eight processed together in one
+ * Shamir/Straus loop. That needs odd multiples of 2^(L * j) * G and
+ * 2^(L * j) * Q for each piece j, where L is a quarter of the curve
+ * size. The ones for G are a fixed table (ecv_table.h). The ones for
+ * Q are computed once when a key is loaded into a \ref ecv_key, which
+ * costs about as much as two verifications. With them, a verification
+ * needs only a quarter of the doublings of the textbook method.
+ *
+ * Nothing here is constant time, as verification only involves
+ * public values. Do not use it with secret data.
+ *
+ * A \ref ecv_cache holds a fixed number of loaded keys, found by the
+ * kid of the message and checked against the actual public key, so
+ * the crypto adapters can use it without the caller managing \ref
+ * ecv_key objects. Each thread can install its own cache with
+ * ecv_set_thread_cache().
+ */
+
+
+/* Return values. All are zero or negative. */
+#define ECV_SUCCESS                0
+#define ECV_ERR_INVALID_KEY       -1 /* Public point is malformed or not on the curve */
+#define ECV_ERR_BAD_SIGNATURE     -2 /* Malformed or doesn't verify */
+#define ECV_ERR_UNSUPPORTED_CURVE -3
+#define ECV_ERR_INVALID_ARG       -4
+
+
+/* Curve identifiers */
+#define ECV_P256 1
+#define ECV_P384 2
+
+
+#define ECV_P256_PUBLIC_KEY_SIZE  65 /* Uncompressed: 0x04 || x || y */
+#define ECV_P384_PUBLIC_KEY_SIZE  97
+#define ECV_MAX_PUBLIC_KEY_SIZE   ECV_P384_PUBLIC_KEY_SIZE
+
+
+/* Sizing of the per-key table. Internal, but needed for the struct. */
+#define ECV_MAX_LIMBS  6 /* 64-bit limbs in a P-384 field element */
+#define ECV_SPLITS     4 /* Pieces each scalar is split into */
+#define ECV_Q_POINTS   8 /* Odd multiples per piece, for width-5 wNAF */
+
+
+/**
+ * A public key loaded for verification. Treat the members as
+ * opaque. It is about 3KB and can be copied and shared read-only
+ * between threads.
+ */
+struct ecv_key {
+    int      curve; /* ECV_P256 or ECV_P384 */
+    uint64_t table[ECV_SPLITS][ECV_Q_POINTS][2][ECV_MAX_LIMBS];
+};
+
+
+/**
+ * \brief Load a public key.
+ *
+ * \param[out] key        The key to initialize.
+ * \param[in] curve       \ref ECV_P256 or \ref ECV_P384.
+ * \param[in] point       Uncompressed point, 0x04 || x || y.
+ * \param[in] point_len   Length of \c point.
+ *
+ * \retval ECV_SUCCESS
+ * \retval ECV_ERR_INVALID_KEY
+ *         The point is the wrong size or not on the curve.
+ * \retval ECV_ERR_UNSUPPORTED_CURVE
+ *
+ * This validates the point and computes its table of multiples.
+ */
+int ecv_key_init(struct ecv_key *key,
+                 int             curve,
+                 const uint8_t  *point,
+                 size_t          point_len);
+
+
+/**
+ * \brief Verify an ECDSA signature.
+ *
+ * \param[in] key            A key from ecv_key_init().
+ * \param[in] hash           The hash that was signed.
+ * \param[in] hash_len       Length of \c hash.
+ * \param[in] signature      r || s, big-endian, each the size of the
+ *                           curve.
+ * \param[in] signature_len  Length of \c signature.
+ *
+ * \retval ECV_SUCCESS
+ * \retval ECV_ERR_BAD_SIGNATURE
+ *
+ * A hash longer than the curve is truncated as ECDSA specifies.
+ */
+int ecv_verify(const struct ecv_key *key,
+               const uint8_t        *hash,
+               size_t                hash_len,
+               const uint8_t        *signature,
+               size_t                signature_len);
+
+
+/* Entries in a cache set. A kid maps to one set. */
+#define ECV_CACHE_WAYS 4
+
+
+/**
+ * One cached key. Treat as opaque.
+ */
+struct ecv_cache_entry {
+    uint64_t       last_use; /* 0 if empty */
+    size_t         point_len;
+    uint8_t        point[ECV_MAX_PUBLIC_KEY_SIZE];
+    struct ecv_key key;
+};
+
+
+/**
+ * A set-associative cache of loaded keys, indexed by kid.
+ *
+ * The kid only says where to look. An entry is used only if its
+ * public key is byte-for-byte the one being verified with, so a
+ * message can't get itself verified with a different key by
+ * claiming another key's kid. When there's no kid the public key
+ * itself is the index. The least recently used entry in a set is
+ * replaced when the set is full.
+ *
+ * Lookups modify the cache, so a cache must only be used by one
+ * thread at a time. Give each thread its own.
+ */
+struct ecv_cache {
+    struct ecv_cache_entry *entries;
+    size_t                  set_mask;
+    uint64_t                clock;
+    uint64_t                hits;
+    uint64_t                misses;
+};
+
+
+/**
+ * \brief Initialize a key cache.
+ *
+ * \param[out] cache        The cache to initialize.
+ * \param[in] entries       Storage for the entries. It must stay
+ *                          valid as long as the cache is used.
+ * \param[in] num_entries   Number of entries. Must be \ref
+ *                          ECV_CACHE_WAYS times a power of two.
+ *
+ * \retval ECV_SUCCESS
+ * \retval ECV_ERR_INVALID_ARG
+ *
+ * The cache starts empty.
+ */
+int ecv_cache_init(struct ecv_cache       *cache,
+                   struct ecv_cache_entry *entries,
+                   size_t                  num_entries);
+
+
+/**
+ * \brief Find or load a key.
+ *
+ * \param[in] cache       The cache.
+ * \param[in] curve       \ref ECV_P256 or \ref ECV_P384.
+ * \param[in] kid         The kid or \c NULL.
+ * \param[in] kid_len     Length of \c kid; 0 if there's none.
+ * \param[in] point       Uncompressed public key, 0x04 || x || y.
+ * \param[in] point_len   Length of \c point.
+ * \param[out] key        The loaded key. Valid until the next call
+ *                        on this cache.
+ *
+ * \retval ECV_SUCCESS
+ * \retval ECV_ERR_INVALID_KEY
+ * \retval ECV_ERR_UNSUPPORTED_CURVE
+ */
+int ecv_cache_get(struct ecv_cache      *cache,
+                  int                    curve,
+                  const uint8_t         *kid,
+                  size_t                 kid_len,
+                  const uint8_t         *point,
+                  size_t                 point_len,
+                  const struct ecv_key **key);
+
+
+/**
+ * \brief Empty a key cache and reset its counters.
+ */
+void ecv_cache_clear(struct ecv_cache *cache);
+
+
+/**
+ * \brief Install a key cache for the calling thread.
+ *
+ * \param[in] cache  The cache or \c NULL to not use one.
+ *
+ * The crypto adapters verify ES256 and ES384 through this thread's
+ * cache when there is one. Without a cache they use their usual
+ * implementation. If the compiler has no thread-local storage this
+ * is one global setting.
+ */
+void ecv_set_thread_cache(struct ecv_cache *cache);
+
+
+/**
+ * \brief The calling thread's key cache or \c NULL.
+ */
+struct ecv_cache *ecv_thread_cache(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ECV_H__ */
@@ -0,0 +1,547 @@
+/*
+ * ecv_table.h -- Generated by gen_ecv_table.py. Do not edit.
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ *
+ * ecv_xxx_g_table[j][i] is (2 * i + 1) * 2^(L * j) * G in affine
+ * coordinates, x then y, Montgomery form, little-endian limbs.
+ * L is 64 for P-256 and 96 for P-384.
+ */
+
+static const uint64_t ecv_p256_g_table[4][32][8] = {
+  {
+    {0x79e730d418a9143cULL, 0x75ba95fc5fedb601ULL, 0x79fb732b77622510ULL, 0x18905f76a53755c6ULL,
+     0xddf25357ce95560aULL, 0x8b4ab8e4ba19e45cULL, 0xd2e88688dd21f325ULL, 0x8571ff1825885d85ULL},
+    {0xffac3f904eebc127ULL, 0xb027f84a087d81fbULL, 0x66ad77dd87cbbc98ULL, 0x26936a3fb6ff747eULL,
+     0xb04c5c1fc983a7ebULL, 0x583e47ad0861fe1aULL, 0x788208311a2ee98eULL, 0xd5f06a29e587cc07ULL},
+    {0xbe1b8aaec45c61f5ULL, 0x90ec649a94b9537dULL, 0x941cb5aad076c20cULL, 0xc9079605890523c8ULL,
+     0xeb309b4ae7ba4f10ULL, 0x73c568efe5eb882bULL, 0x3540a9877e7a1f68ULL, 0x73a076bb2dd1e916ULL},
+    {0x0746354ea0173b4fULL, 0x2bd20213d23c00f7ULL, 0xf43eaab50c23bb08ULL, 0x13ba5119c3123e03ULL,
+     0x2847d0303f5b9d4dULL, 0x6742f2f25da67bddULL, 0xef933bdc77c94195ULL, 0xeaedd9156e240867ULL},
+    {0x75c96e8f264e20e8ULL, 0xabe6bfed59a7a841ULL, 0x2cc09c0444c8eb00ULL, 0xe05b3080f0c4e16bULL,
+     0x1eb7777aa45f3314ULL, 0x56af7bedce5d45e3ULL, 0x2b6e019a88b12f1aULL, 0x086659cdfd835f9bULL},
+    {0xea7d260a6245e404ULL, 0x9de407956e7fdfe0ULL, 0x1ff3a4158dac1ab5ULL, 0x3e7090f1649c9073ULL,
+     0x1a7685612b944e88ULL, 0x250f939ee57f61c8ULL, 0x0c0daa891ead643dULL, 0x68930023e125b88eULL},
+    {0xccc425634b2ed709ULL, 0x0e356769856fd30dULL, 0xbcbcd43f559e9811ULL, 0x738477ac5395b759ULL,
+     0x35752b90c00ee17fULL, 0x68748390742ed2e3ULL, 0x7cd06422bd1f5bc1ULL, 0xfbc08769c9e7b797ULL},
+    {0x72bcd8b7bc60055bULL, 0x03cc23ee56e27e4bULL, 0xee337424e4819370ULL, 0xe2aa0e430ad3da09ULL,
+     0x40b8524f6383c45dULL, 0xd766355442a41b25ULL, 0x64efa6de778a4797ULL, 0x2042170a7079adf4ULL},
+    {0x97091dcbd53c5c9dULL, 0xf17624b6ac0a177bULL, 0xb0f139752cfe2dffULL, 0xc1a35c0a6c7a574eULL,
+     0x227d314693e79987ULL, 0x0575bf30e89cb80eULL, 0x2f4e247f0d1883bbULL, 0xebd512263274c3d0ULL},
+    {0xfea912baa5659ae8ULL, 0x68363aba25e1a16eULL, 0xb8842277752c41acULL, 0xfe545c282897c3fcULL,
+     0x2d36e9e7dc4c696bULL, 0x5806244afba977c5ULL, 0x85665e9be39508c1ULL, 0xf720ee256d12597bULL},
+    {0x562e4cecc135b208ULL, 0x74e1b2654783f47dULL, 0x6d2a506c5a3f3b30ULL, 0xecead9f4c16762fcULL,
+     0xf29dd4b2e286e5b9ULL, 0x1b0fadc083bb3c61ULL, 0x7a75023e7fac29a4ULL, 0xc086d5f1c9477fa3ULL},
+    {0xf4f876532de45068ULL, 0x37c7a7e89e2e1f6eULL, 0xd0825fa2a3584069ULL, 0xaf2cea7c1727bf42ULL,
+     0x0360a4fb9e4785a9ULL, 0xe5fda49c27299f4aULL, 0x48068e1371ac2f71ULL, 0x83d0687b9077666fULL},
+    {0xa4a319acd837879fULL, 0x6fc1b49eed6b67b0ULL, 0xe395993332f1f3afULL, 0x966742eb65432a2eULL,
+     0x4b8dc9feb4966228ULL, 0x96cc631243f43950ULL, 0x12068859c9b731eeULL, 0x7b948dc356f79968ULL},
+    {0x042c2af497e2feb4ULL, 0xd36a42d7aebf7313ULL, 0x49d2c9eb084ffdd7ULL, 0x9f8aa54b2ef7c76aULL,
+     0x9200b7ba09895e70ULL, 0x3bd0c66fddb7fb58ULL, 0x2d97d10878eb4cbbULL, 0x2d431068d84bde31ULL},
+    {0x5e5db46acb66e132ULL, 0xf1be963a0d925880ULL, 0x944a70270317b9e2ULL, 0xe266f95948603d48ULL,
+     0x98db66735c208899ULL, 0x90472447a2fb18a3ULL, 0x8a966939777c619fULL, 0x3798142a2a3be21bULL},
+    {0xe2f73c696755ff89ULL, 0xdd3cf7e7473017e6ULL, 0x8ef5689d3cf7600dULL, 0x948dc4f8b1fc87b4ULL,
+     0xd9e9fe814ea53299ULL, 0x2d921ca298eb6028ULL, 0xfaecedfd0c9803fcULL, 0xf38ae8914d7b4745ULL},
+    {0x871514560f664534ULL, 0x85ceae7c4b68f103ULL, 0xac09c4ae65578ab9ULL, 0x33ec6868f044b10cULL,
+     0x6ac4832b3a8ec1f1ULL, 0x5509d1285847d5efULL, 0xf909604f763f1574ULL, 0xb16c4303c32f63c4ULL},
+    {0xfd16847fdec67ef5ULL, 0x742ee464233e76b7ULL, 0x0b8e4134efc2b4c8ULL, 0xca640b8642a3e521ULL,
+     0x653a01908ceb6aa9ULL, 0x313c300c547852d5ULL, 0x24e4ab126b237af7ULL, 0x2ba901628bb47af8ULL},
+    {0x00467bc58cce08b5ULL, 0xb636458c7f178d55ULL, 0xc5748baea677d806ULL, 0x2763a387dfa394ebULL,
+     0xa12b448a7d3cebb6ULL, 0xe7adda3e6f20d850ULL, 0xf63ebce51558462cULL, 0x58b36143620088a8ULL},
+    {0xa9d89488a059c142ULL, 0x6f5ae714ff0b9346ULL, 0x068f237d16fb3664ULL, 0x5853e4c4363186acULL,
+     0xe2d87d2363c52f98ULL, 0x2ec4a76681828876ULL, 0x47b864fae14e7b1cULL, 0x0c0bc0e569192408ULL},
+    {0x624d60492ed22e91ULL, 0x6fdfe0b56f072822ULL, 0xeeca111539ce2271ULL, 0x98100a4fdb01614fULL,
+     0xb6b0daa2a35c628fULL, 0xb6f94d2ec87e9a47ULL, 0xc67732591d57d9ceULL, 0xf70bfeec03884a7bULL},
+    {0x4ff23ffd248a7d06ULL, 0x80c5bfb4878873faULL, 0xb7d9ad9005745981ULL, 0x179c85db3db01994ULL,
+     0xba41b06261a6966cULL, 0x4d82d052eadce5a8ULL, 0x9e91cd3ba5e6a318ULL, 0x47795f4f95b2dda0ULL},
+    {0x1ee426ccd5cd79bfULL, 0x0032940b946c6e18ULL, 0x1b1e8ae057477f58ULL, 0xe94f7d346d823278ULL,
+     0xc747cb96782ba21aULL, 0xc5254469f72b33a5ULL, 0x772ef6dec7f80c81ULL, 0xd73acbfe2cd9e6b5ULL},
+    {0x283c7513caa76097ULL, 0x0a624fa936c83906ULL, 0x6b20afec715af2c7ULL, 0x4b969974eba78bfdULL,
+     0x220755ccd921d60eULL, 0x9b944e107baeca13ULL, 0x04819d515ded93d4ULL, 0x9bbff86e6dddfd27ULL},
+    {0x21950b421ff6acd3ULL, 0xffe7048453dc6909ULL, 0xff4cd0b228766127ULL, 0xabdbe6084fb7db2bULL,
+     0x837c92285e1109e8ULL, 0x26147d27f4645b5aULL, 0x4d78f592f7818ed8ULL, 0xd394077ef247fa36ULL},
+    {0x508cec1c3b3f64c9ULL, 0xe20bc0ba1e5edf3fULL, 0xda1deb852f4318d4ULL, 0xd20ebe0d5c3fa443ULL,
+     0x370b4ea773241ea3ULL, 0x61f1511c5e1a5f65ULL, 0x99a5e23d82681c62ULL, 0xd731e383a2f54c2dULL},
+    {0x97359638546c4d8dULL, 0x5f9c3fc492f24679ULL, 0x912e8beda8c8acd9ULL, 0xec3a318d306634b0ULL,
+     0x80167f41c31cb264ULL, 0x3db82f6f522113f2ULL, 0xb155bcd2dcafe197ULL, 0xfba1da5943465283ULL},
+    {0x258bbbf9e7305683ULL, 0x31eea5bf07ef5be6ULL, 0x0deb0e4a46c814c1ULL, 0x5cee8449a7b730ddULL,
+     0xeab495c5a0182bdeULL, 0xee759f879e27a6b4ULL, 0xc2cf6a6880e518caULL, 0x25e8013ff14cf3f4ULL},
+    {0x3ec832e77acaca28ULL, 0x1bfeea57c7385b29ULL, 0x068212e3fd1eaf38ULL, 0xc13298306acf8cccULL,
+     0xb909f2db2aac9e59ULL, 0x5748060db661782aULL, 0xc5ab2632c79b7a01ULL, 0xda44c6c600017626ULL},
+    {0x69d44ed65c46aa8eULL, 0x2100d5d3a8d063d1ULL, 0xcb9727eaa2d17c36ULL, 0x4c2bab1b8add53b7ULL,
+     0xa084e90c15426704ULL, 0x778afcd3a837ebeaULL, 0x6651f7017ce477f8ULL, 0xa062499846fb7a8bULL},
+    {0x3667eb1a7f4c04ccULL, 0x59556621a9404f84ULL, 0x71cdf6537eceb50aULL, 0x994a44a69b8335faULL,
+     0xd7faf819dbeb9b69ULL, 0x473c5680eed4350dULL, 0xb6658466da44bba2ULL, 0x0d1bc780872bdbf3ULL},
+    {0xb8d3d9319ff91fe5ULL, 0x039c4800f0518eedULL, 0x95c376329182cb26ULL, 0x0763a43482fc568dULL,
+     0x707c04d5383e76baULL, 0xac98b930824e8197ULL, 0x92bf7c8f91230de0ULL, 0x90876a0140959b70ULL}
+  },
+  {
+    {0x4f922fc516a0d2bbULL, 0x0d5cc16c1a623499ULL, 0x9241cf3a57c62c8bULL, 0x2f5e6961fd1b667fULL,
+     0x5c15c70bf5a01797ULL, 0x3d20b44d60956192ULL, 0x04911b37071fdb52ULL, 0xf648f9168d6f0f7bULL},
+    {0x4090914bb5def996ULL, 0x1cb69c83233dd1e7ULL, 0xc1e9c1d39b3d5e76ULL, 0x1f3338edfccf6012ULL,
+     0xb1e95d0d2f5378a8ULL, 0xacf4c2c72f00cd21ULL, 0x6e984240eb5fe290ULL, 0xd66c038d248088aeULL},
+    {0xd4992b30614c0900ULL, 0xda98d121bd00c24bULL, 0x7f534dc87ec4bfa1ULL, 0x4a5ff67437dc34bcULL,
+     0x68c196b81d7ea1d7ULL, 0x38cf289380a6d208ULL, 0xfd56cd09e3cbbd6eULL, 0xec72e27e4205a5b6ULL},
+    {0xe8b97932b88756ddULL, 0xed4e8652f17e3e61ULL, 0xc2dd14993ee1c4a4ULL, 0xc0aaee17597f8c0eULL,
+     0x15c4edb96c168af3ULL, 0x6563c7bfb39ae875ULL, 0xadfadb6f20adb436ULL, 0xad55e8c99a042ac0ULL},
+    {0x65c29219909523c8ULL, 0xa62f648fa3a1c741ULL, 0x88598d4f60c9e55aULL, 0xbce9141b0e4f347aULL,
+     0x9af97d8435f9b988ULL, 0x0210da62320475b6ULL, 0x3c076e229191476cULL, 0x7520dbd944fc7834ULL},
+    {0x664300b07850ec06ULL, 0xac5a38b97d3a10cfULL, 0x9233188de34ab39dULL, 0xe77057e45072cbb9ULL,
+     0xbcf0c042b59e78dfULL, 0x4cfc91e81d97de52ULL, 0x4661a26c3ee0ca4aULL, 0x5620a4c1fb8507bcULL},
+    {0x84b9ca1504b6c5a0ULL, 0x35216f3918f0e3a3ULL, 0x3ec2d2bcbd986c00ULL, 0x8bf546d9d19228feULL,
+     0xd1c655a44cd623c3ULL, 0x366ce718502b8e5aULL, 0x2cfc84b4eea0bfe7ULL, 0xe01d5ceecf443e8eULL},
+    {0xa75feacabe063f64ULL, 0x9b392f43bce47a09ULL, 0xd42415091ad07acaULL, 0x4b0c591b8d26cd0fULL,
+     0x2d42ddfd92f1169aULL, 0x63aeb1ac4cbf2392ULL, 0x1de9e8770691a2afULL, 0xebe79af7d98021daULL},
+    {0x66917ce63b5f1cc4ULL, 0x37ae52eace872e62ULL, 0xbb087b722905f244ULL, 0x120770861e6af74fULL,
+     0x4b644e491058edeaULL, 0x827510e3b638ca1dULL, 0x8cf2b7046038591cULL, 0xffc8b47afe635063ULL},
+    {0x7677408d6dfafed3ULL, 0x33a0165339661588ULL, 0x3c9c15ec0b726fa0ULL, 0x090cfd936c9b56daULL,
+     0xe34f4baea3c40af5ULL, 0x3469eadbd21129f1ULL, 0xcc51674a1e207ce8ULL, 0x1e293b24c83b1ef9ULL},
+    {0x796d3a85825808bdULL, 0x51dc3cb73fd6e902ULL, 0x643c768a916219d1ULL, 0x36cd7685a2ad7d32ULL,
+     0xe3db9d05b22922a4ULL, 0x6494c87edba29660ULL, 0xf0ac91dfbcd2ebc7ULL, 0x4deb57a045107f8dULL},
+    {0xb6c69ac82094cec3ULL, 0x9976fb88403b770cULL, 0x1dea026c4859590dULL, 0xb6acbb468562d1fdULL,
+     0x7cd6c46144569d85ULL, 0xc3190a3697f0891dULL, 0xc6f5319548d5a17dULL, 0x7d919966d749abc8ULL},
+    {0xb53b7de561906373ULL, 0x858dbadeeb999595ULL, 0x8cbb47b2a59e5c36ULL, 0x660318b3dcf4e842ULL,
+     0xbd161ccd12ba4b7aULL, 0xf399daabf8c8282aULL, 0x1587633aeeb2130dULL, 0xa465311ada38dd7dULL},
+    {0x2dae9082be7cf3a6ULL, 0xcc86ba92bc967274ULL, 0xf28a2ce8aea0a8a9ULL, 0x404ca6d96ee988b3ULL,
+     0xfd7e9c5d005921b8ULL, 0xf56297f144e79bf9ULL, 0xa163b4600d75ddc2ULL, 0x30b23616a1f2be87ULL},
+    {0x0064d8585499fb32ULL, 0x7b67bad977a8aeb7ULL, 0x1d3eb9772d08eec5ULL, 0x5fc047a6cbabae1dULL,
+     0x0577d159e54a64bbULL, 0x8862201bc43497e4ULL, 0xad6b4e282ce0608dULL, 0x8b687b7d0b167aacULL},
+    {0xe9f9669cda94951eULL, 0x4b6af58d66b8d418ULL, 0xfa32107417d426a4ULL, 0xc78e66a99dde6027ULL,
+     0x0516c0834a53b964ULL, 0xfc659d38ff602330ULL, 0x0ab55e5c58c5c897ULL, 0x985099b2838bc5dfULL},
+    {0xe7a935fa1684cb3bULL, 0x571650b5a7d7e69dULL, 0x6ba9ffa40328c168ULL, 0xac43f6bc7e46f358ULL,
+     0x54f75e567cb6a779ULL, 0x4e4e2cc8c61320deULL, 0xb94258bc2b8903d0ULL, 0xc7f32d57ceecabe0ULL},
+    {0x445b86ea02a3260aULL, 0x8c51d6428d689babULL, 0x183334d65588904cULL, 0xf8a3b84d479d6422ULL,
+     0x581acfa0f0833d00ULL, 0xc50827bc3b567d2dULL, 0x2c935e6daddcf73eULL, 0x2a645f7704dd19f2ULL},
+    {0x0ca5d25bf8e71ce2ULL, 0x204edc4a062685daULL, 0x06fe407d87678ec2ULL, 0xd16936a07defa39aULL,
+     0x3b108d84af3d16d0ULL, 0xf2e9616d0305cad0ULL, 0xbc9537e6f27bed97ULL, 0x71c2d699ebc9f45cULL},
+    {0x203bdd84cdcd3a85ULL, 0x1107b901ade3ccfaULL, 0xa7da89e95533159dULL, 0x8d834005860e8c64ULL,
+     0x914bc0eb2a7638f7ULL, 0xc66ce0a6620e8606ULL, 0x11ef98c2e6c12dc0ULL, 0x25666b1d7780fc0eULL},
+    {0x6667e89f4ded8a4fULL, 0xa59161abc36a7795ULL, 0x1c96f6f9331ccf94ULL, 0xf2727e879a686d49ULL,
+     0x0f94894bb841295fULL, 0xb0fe8f744a0503d1ULL, 0x60c581c7ef407926ULL, 0x1980c8e13edb7e1cULL},
+    {0x47948c84c5de1a41ULL, 0xd595d14a48959688ULL, 0x3bfca4be86ff21c9ULL, 0xb5ff59b86a4191caULL,
+     0xced1dd1d65094c86ULL, 0xd57b86559dc9d001ULL, 0xbcac6fa3486e51d7ULL, 0x8e97e2637b774c1bULL},
+    {0xe82eb003e35dca85ULL, 0xfd0000fa31e39180ULL, 0xbca90f746735f378ULL, 0xe6aa783158c943edULL,
+     0x0e94ecd5b6a438d7ULL, 0xc02b60faf9a5f114ULL, 0x4063568b8b1611ebULL, 0x1398bdc1272509ecULL},
+    {0xbdf4e7049970f46eULL, 0x70e220288dadbd1aULL, 0x2b86c97fb1223d26ULL, 0x042ad22ecf62f51aULL,
+     0x72944339ba2ed2e9ULL, 0x0ba0d10ef94fa61dULL, 0x3f86164194e68f15ULL, 0x1312a74acb86c545ULL},
+    {0x640ebf5d5b8d354aULL, 0xa5f3a8fdb396ff64ULL, 0xd53f041d8378ed81ULL, 0x1969d61bc1234ad2ULL,
+     0x16d7acffeb68bde2ULL, 0x63767a68f23e9368ULL, 0x937a533c38928d95ULL, 0xee2190bbbeb0f1f2ULL},
+    {0xb6860c9a73a4aafbULL, 0xb2f996290488870dULL, 0x16ef6232572d9e25ULL, 0x5b9eb1bad1383389ULL,
+     0xabf713a7ed8d77f8ULL, 0xd2b4a2e9e2b69e64ULL, 0xa1a22cfd6d6f17c2ULL, 0x4bfd6f992d604511ULL},
+    {0xfe550021bc84c625ULL, 0x8d7169986d45e4a3ULL, 0xa09c6ded4c0c66b7ULL, 0xe32313aeb9e1d547ULL,
+     0x8ce775b4d1e8e0b9ULL, 0xa899f9102654dd15ULL, 0x7c38aa066cc8b2a9ULL, 0xe6ebb291d6ce6cc0ULL},
+    {0x5963df62a6991216ULL, 0x4c17f72246996010ULL, 0x131dc2b840477722ULL, 0x78bf50b0d1765a75ULL,
+     0x360afd587ceaca12ULL, 0xebc55dbb139cd470ULL, 0x9083e27e4c05541cULL, 0xc10057a3b873d757ULL},
+    {0x440009c3deed7769ULL, 0xde2fa58a14fd8a44ULL, 0x509e7df35b627596ULL, 0x3d76a87cc3bb07a7ULL,
+     0x8018fee5b8ef000aULL, 0x71ce33e9823fd4b6ULL, 0x3a1cac37469c0bb1ULL, 0x92fe7aeaf3eec8eeULL},
+    {0x37ad0eb8de64e568ULL, 0x4ac669bca1e3e20eULL, 0x240d0ac22ce944edULL, 0xd532039a3c1b28fbULL,
+     0xa2bb899a23acba6cULL, 0xd472af671af937e1ULL, 0x04478f7b8851e753ULL, 0x74030eef5ea05307ULL},
+    {0x2246ad76c1d68c31ULL, 0x9126202b0d5c4677ULL, 0x5f40de81638882dcULL, 0xb131988ca3253a7fULL,
+     0x766f1897ba9ae0a8ULL, 0xf0e01dd41d8b5fefULL, 0x03e28ce3ed7b12c8ULL, 0x44b3a2be1fd20e1eULL},
+    {0xd4c8e8e5f2a5f247ULL, 0x42ffd816c2c7c979ULL, 0x89e1485211093d1aULL, 0x98f44a4613871ebbULL,
+     0x374849964b032e2dULL, 0x28a430f445995a61ULL, 0xf2f9acbad5be16b6ULL, 0xac98a5402d8e02aaULL}
+  },
+  {
+    {0x62a8c244bfe20925ULL, 0x91c19ac38fdce867ULL, 0x5a96a5d5dd387063ULL, 0x61d587d421d324f6ULL,
+     0xe87673a2a37173eaULL, 0x2384800853778b65ULL, 0x10f8441e05bab43eULL, 0xfa11fe124621efbeULL},
+    {0xc0f734a3b2335834ULL, 0x9526205a90ef6860ULL, 0xcb8be71704e2bb0dULL, 0x2418871e02f383faULL,
+     0xd71776814082c157ULL, 0xcc914ad029c20073ULL, 0xf186c1ebe587e728ULL, 0x6fdb3c2261bcd5fdULL},
+    {0xcc7c4c1c2cf9d7c1ULL, 0x1320886aee95e5abULL, 0xbb7b9056beae170cULL, 0xc8a5b250dbc0d662ULL,
+     0x4ed81432c11d2303ULL, 0x7da669121f03769fULL, 0x3ac7a5fd84539828ULL, 0x14dada943bccdd02ULL},
+    {0x51b90651cbae2f70ULL, 0xefc4bc0593aaa8ebULL, 0x8ecd8689dd1df499ULL, 0x1aee99a822f367a5ULL,
+     0x95d485b9ae8274c5ULL, 0x6c14d4457d30b39cULL, 0xbafea90bbcc1ef81ULL, 0x7c5f317aa459a2edULL},
+    {0x410dc6a90deeaf52ULL, 0xb003fb024c641c15ULL, 0x1384978c5bc504c4ULL, 0x37640487864a6a77ULL,
+     0x05991bc6222a77daULL, 0x62260a575e47eb11ULL, 0xc7af6613f21b432cULL, 0x22f3acc9ab4953e9ULL},
+    {0x0d0942770c24efc8ULL, 0x0349fd04bef737a4ULL, 0x6d1c9dd2514cdd28ULL, 0x29c135ff30da9521ULL,
+     0xea6e4508f78b0b6fULL, 0x176f5dd2678c143cULL, 0x081484184be21e65ULL, 0x27f7525ce7df38c4ULL},
+    {0x9faaccf5e4652f1dULL, 0xbd6fdd2ad56157b2ULL, 0xa4f4fb1f6261ec50ULL, 0x244e55ad476bcd52ULL,
+     0x881c9305047d320bULL, 0x1ca983d56181263fULL, 0x354e9a44278fb8eeULL, 0xad2dbc0f396e4964ULL},
+    {0xfce0176788a2ffe4ULL, 0xdc506a3528e169a5ULL, 0x0ea108617af9c93aULL, 0x1ed2436103fa0e08ULL,
+     0x96eaaa92a3d694e7ULL, 0xc0f43b4def50bc74ULL, 0xce6aa58c64114db4ULL, 0x8218e8ea7c000fd4ULL},
+    {0xd1ffd160deb58b9bULL, 0x78492428c007273cULL, 0x47c908048ef06073ULL, 0x746cd0dfe48c659eULL,
+     0xbd7e8e109d47055bULL, 0xe070967e39711c04ULL, 0x3d8869c99c9444f6ULL, 0x6c67ccc834ac85fcULL},
+    {0x8a42d8b087b05be1ULL, 0xef00df8d3e4e1456ULL, 0x148cc8e8fbfc8cd2ULL, 0x0288ae4c4878804fULL,
+     0x44e669a73b4f6872ULL, 0xa4a8dbd4aab53c5bULL, 0x843fa963c9660052ULL, 0x128e2d2571c05dd2ULL},
+    {0x3ea86174a9f1b59bULL, 0xc747ea076a9a8845ULL, 0x733710b5ab242123ULL, 0x6381b546d386a60cULL,
+     0xba0e286366a44904ULL, 0x770f618de9db556cULL, 0x39e567f828fb198dULL, 0xb5f1bef040147ee8ULL},
+    {0x1adee1d516391617ULL, 0x962d9184a3315fd9ULL, 0x91c229750c805d59ULL, 0x4575eaf2cd9a1877ULL,
+     0x83fef163451831b9ULL, 0x829d6bdd6f09e30fULL, 0x9379272dcc6b4e6aULL, 0xd7a049bd95fbee4aULL},
+    {0x695f70da44ae09c6ULL, 0x79793892bb99de1dULL, 0xde269352f696b429ULL, 0xe37ea97f8104c825ULL,
+     0x3166cac6b0e72e63ULL, 0xa82e633ca03ba670ULL, 0x1106e3843e505667ULL, 0xc2994f3dffb788b6ULL},
+    {0xd36a5ab37c53073bULL, 0xc44a9940ebdc7e35ULL, 0x7dd86c8bf3ded136ULL, 0x9fe9879fd5a0eb14ULL,
+     0xa210726c9b99bf9cULL, 0x3faf4456861036afULL, 0x1661f1c9615d091aULL, 0x2c63f630911551bcULL},
+    {0x232974230554f94fULL, 0x4f445a380f3a7618ULL, 0xb9fb40bee4abefd6ULL, 0xfbf3eaf9c15eb07cULL,
+     0xed469c23aca0c8b3ULL, 0xc5209f68846e3f8fULL, 0x33d51d13d75da468ULL, 0x9406e10a3d5c6e29ULL},
+    {0xb9a44b1f5c6cad21ULL, 0xaa9947751ee60a83ULL, 0xc89af3858c390401ULL, 0xef1e450b8dd51056ULL,
+     0x5f5f069879ac84d1ULL, 0x68d82982ef57b1afULL, 0x31f1d90f50849555ULL, 0xff9577e57d9fc8f6ULL},
+    {0xaeebc5c0b430d6a1ULL, 0x39b87a13dc3a9c04ULL, 0xf0c445252db4a631ULL, 0xe32d95482c66fcf6ULL,
+     0x16f11bafb17849c4ULL, 0xdd1c76615eca71f7ULL, 0x4389ad2e32e6c944ULL, 0x727c11a5889a06bbULL},
+    {0xe18806fd60b3258cULL, 0xb7d2926b1364df47ULL, 0xe208300fa107ce99ULL, 0x8d2f29fe7918df0eULL,
+     0x0b012d77a1244f4cULL, 0xf01076f4213a11cfULL, 0x8e623223181c559dULL, 0x9df196ee995a281dULL},
+    {0xfaa821383a721940ULL, 0xdd70f54dd0008b83ULL, 0x00decb507d32a52dULL, 0x04563529cdd87deaULL,
+     0xb0e7e2a2db81643dULL, 0x445f4c383a6fef50ULL, 0x5c0ef211df694ae1ULL, 0xa5a8fead923d0f1cULL},
+    {0xbc0e08b0325b2601ULL, 0xae9e4c6105815b7aULL, 0x07f664faf944a4a1ULL, 0x0ad19d29288f83b3ULL,
+     0x8615cd677232c458ULL, 0x98edff6e9038e7d1ULL, 0x082e0c4395a4dfccULL, 0x336267afeceee00eULL},
+    {0xc88ad4452a29bfdeULL, 0x3072ebfa998368b7ULL, 0xa754cbf7f5384692ULL, 0x85f7e16906b13146ULL,
+     0x42a7095f6a549fbeULL, 0xef44edf91f7f1f42ULL, 0xbea2989737b0c863ULL, 0x13b096d87a1e7fc3ULL},
+    {0x51add77ce2a3a251ULL, 0x840ca1384d8476adULL, 0x08d01d26f6096478ULL, 0x10d501a532f1662bULL,
+     0xc8d63f811165a955ULL, 0x587aa2e34095046aULL, 0x759506c617af9000ULL, 0xd6201fe4a32ab8d2ULL},
+    {0x7c52500cfc8c9bbdULL, 0x635563381534d9f7ULL, 0xf55f38cbfd52c990ULL, 0xc585ae85058f52e7ULL,
+     0xb710a28bf9f19a01ULL, 0x891861bdf0273ca4ULL, 0x38a7aa2b034b0b7cULL, 0xa2ecead52a809fb1ULL},
+    {0xdf62817ab3b32fbcULL, 0x616d74b0964670d4ULL, 0xa37bc6270e26020bULL, 0xda46d655b7d40bdaULL,
+     0x2840f155b5773f84ULL, 0xbb633777897774b6ULL, 0x59ff1df79a1ed3faULL, 0xf7011ee2bac571f9ULL},
+    {0xd612951861535bb0ULL, 0xbf14364016f6a954ULL, 0x3e0931eedde18024ULL, 0x79d791c8139441c0ULL,
+     0xba4fe7ecb67b8269ULL, 0x7f30d848224b96c1ULL, 0xa7e0a6abf0341068ULL, 0x78db42c37198ea2dULL},
+    {0x13354044185ce776ULL, 0x109a6e059ff0100cULL, 0xafa3b61b03144cb1ULL, 0x4e4c814585265586ULL,
+     0xa8dafd33edb35364ULL, 0x6691781bfd2606beULL, 0x2e06a9786182f5ccULL, 0x588784ebe77faeecULL},
+    {0xc773f525606f8f04ULL, 0x75ae4a4b41b0a5bbULL, 0xb2aa058eaf7df93cULL, 0xf15bea4feafed676ULL,
+     0xd2967b236a3c4fd7ULL, 0xa698628090e30e7fULL, 0xf1b5166d316418bdULL, 0x5748682e1c13cb29ULL},
+    {0xe7b11babfff3605bULL, 0xdbce1b74cbac080fULL, 0xa0be39bd6535f082ULL, 0x2b6501805f826684ULL,
+     0xf90cea2400f5244fULL, 0xe279f2fadd244a1cULL, 0xd3fca77c9421c3aeULL, 0xe66bc7ee81a5210aULL},
+    {0x114085dac40c6461ULL, 0xaf78cb47f47d41b8ULL, 0x7a9ae851755b0adbULL, 0x8d2e8c66a0600b6dULL,
+     0x5fb19045389758c0ULL, 0xfa6e2cdabe7c91b2ULL, 0x6472a432663983a2ULL, 0xc9370829e0e19363ULL},
+    {0xd335856ec50bf2ffULL, 0x89b42295dfa708c2ULL, 0x5dfb42241b201b4eULL, 0x6c94d6b94eecbf9cULL,
+     0xabe5a47a7a634097ULL, 0xf3d53b1643febecfULL, 0xff18619faca9846eULL, 0x80ad8629a4066177ULL},
+    {0xc1203418f8a144b7ULL, 0xb3413f808378f901ULL, 0xf6badea161857095ULL, 0xcd2816c2b2e93efeULL,
+     0x6a8303ea174a0ee6ULL, 0x98b62f29150b28b6ULL, 0x68071bbc9c2a05b6ULL, 0xcfcf41a39f00e36eULL},
+    {0xcaf564f234d6bc29ULL, 0x9e9a6507f3c8edb0ULL, 0x2fb889edd4e5502eULL, 0xb70d4ceb6cc9d8edULL,
+     0x0de25356b020f740ULL, 0xa68d9263d11fe5e6ULL, 0xe86400679d85dd77ULL, 0xa95dfa7dec2c8c8dULL}
+  },
+  {
+    {0x56f8410ef4f8b16aULL, 0x97241afec47b266aULL, 0x0a406b8e6d9c87c1ULL, 0x803f3e02cd42ab1bULL,
+     0x7f0309a804dbec69ULL, 0xa83b85f73bbad05fULL, 0xc6097273ad8e197fULL, 0xc097440e5067adc1ULL},
+    {0x266344a43794f8dcULL, 0xdcca923a483c5c36ULL, 0x2d6b6bbf3f9d10a0ULL, 0xb320c5ca81d9bdf3ULL,
+     0x620e28ff47b50a95ULL, 0x933e3b01cef03371ULL, 0xf081bf8599100153ULL, 0x183be9a0c3a8c8d6ULL},
+    {0x25470fabe085116bULL, 0x04a4337587285310ULL, 0x4e39187ee2bfd52fULL, 0x36166b447d9ebc74ULL,
+     0x92ad433cfd4b322cULL, 0x726aa817ba79ab51ULL, 0xf96eacd8c1db15ebULL, 0xfaf71e910476be63ULL},
+    {0x72cfd2e949dee168ULL, 0x1ae052233e2af239ULL, 0x009e75be1d94066aULL, 0x6cca31c738abf413ULL,
+     0xb50bd61d9bc49908ULL, 0x4a9b4a8cf5e2bc1eULL, 0xeb6cc5f7946f83acULL, 0x27da93fcebffab28ULL},
+    {0x3ce519ef76257c51ULL, 0x6f5818d318d477e7ULL, 0xab022e037963edc0ULL, 0xf0403a898bd1f5f3ULL,
+     0xe43b8da0496033caULL, 0x0994e10ea1cfdd72ULL, 0xb1ec6d20ba73c0e2ULL, 0x0329c9ecb6bcfad1ULL},
+    {0xbdec338e3318d2d4ULL, 0x733dd7bbbe8de963ULL, 0x61bcc3baa2c47ebdULL, 0xa821ad1935efcbdeULL,
+     0x91ac668c024cdd5cULL, 0x7ba558e4c1cdfa49ULL, 0x491d4ce0908fb4daULL, 0x7ba869f9f685bde8ULL},
+    {0xed1b5ec279f464baULL, 0x2d65e42c47d72e26ULL, 0x8198e5749e67f926ULL, 0x4106673834747e44ULL,
+     0x4637acc1e37e5447ULL, 0x02cbc9ecf3e15822ULL, 0x58a8e98e805aa83cULL, 0x73facd6e5595e800ULL},
+    {0x468ff80338330507ULL, 0x06f34ddf4037a53eULL, 0x70cd1a408d6993a4ULL, 0xf85a159743e5c022ULL,
+     0x396fc9c2c125a67dULL, 0x03b7bebf1064bfcbULL, 0x7c444592a9806dcbULL, 0x1b02614b4487cd54ULL},
+    {0xb47b60f70de21bb6ULL, 0x64acae4fdcd836caULL, 0x3375ea6dc744ce63ULL, 0xb764265fb047955bULL,
+     0xc68a5d4c9841c2c3ULL, 0x60e98fd7cf454f60ULL, 0xc701fbe2756aea0cULL, 0x09c8885eaab21c79ULL},
+    {0x45bb810869d2d46cULL, 0xe47c8b3968c8365aULL, 0xf3b87663267551bdULL, 0x1590768f5b67547aULL,
+     0x371c1db2fb2ed3ffULL, 0xe316691917a59440ULL, 0x03c0d178df242c14ULL, 0x40c93fceed862ac1ULL},
+    {0x1286da692bc982d6ULL, 0x5f6d80f27bdae7e3ULL, 0x3d9c5647a6f064fbULL, 0xfdc8e6a1d74c1540ULL,
+     0x97da48c6d68b135aULL, 0xc2097979d66dbfffULL, 0x0296adb9ea20531dULL, 0xa333730d4ab2c8f0ULL},
+    {0x0eb3565429847fedULL, 0xfdc142860a673dd0ULL, 0x721b36278b62dd0bULL, 0x105a293e711a5771ULL,
+     0xdf001cce7f761927ULL, 0xf7b681b011d04c7dULL, 0x16dff792a3ac1996ULL, 0x580c120b0fc4ae30ULL},
+    {0x31ea3d4f7ee8d0bcULL, 0x3832f22a0f42c3dcULL, 0xc661061a1a87a2f4ULL, 0x0978c9f64b45576bULL,
+     0xb7abac3c6dfb5fd2ULL, 0x27f36a00b7e01b90ULL, 0x68f733cde9429e36ULL, 0x953a4681dcbfe8cbULL},
+    {0xbfb7c41067fe1eafULL, 0xa2073c6a6929a785ULL, 0x6f2536f4a75fdb79ULL, 0x859ad26d809bca69ULL,
+     0x06f2c0693b197e7bULL, 0x656ad9f48ec0a573ULL, 0xe7c7901f9a4d0262ULL, 0xbec29443b938602bULL},
+    {0x6e2d1cb3dd9c90c1ULL, 0x28f82d5a7990579eULL, 0x90e189cd06226195ULL, 0xbd2939df19b0dc74ULL,
+     0x18b18505c0917177ULL, 0xeed5470d3117d9c4ULL, 0x39ef92eb6c893ca0ULL, 0x4533ef8244a41940ULL},
+    {0xcaee9dec34943ddaULL, 0x8e50e98e8b4b6782ULL, 0x24358ea591ea3a1fULL, 0x71c4c827a9e1c194ULL,
+     0xa38baa5d09bb7a94ULL, 0xfb4ab4c057b58f9cULL, 0x4a01065e24e0ee19ULL, 0xb9cf805107b877bfULL},
+    {0xd38c1ce0a2980d5eULL, 0x8b84cca4541face7ULL, 0x93298136dbd8d05dULL, 0x582708d03f85c85aULL,
+     0x6545eec7282960e4ULL, 0x92e184aebaadec07ULL, 0x05452564fd27a20fULL, 0x79d4668abddce6ebULL},
+    {0xe312623a7002114fULL, 0xb888b637e047686bULL, 0x23b2c270cbac91bdULL, 0xb50b31884dbfe02dULL,
+     0x8335ce43de97eef6ULL, 0x6a4e65502bac193aULL, 0xf2b35aac3101f720ULL, 0x5b2c88d5379a2015ULL},
+    {0x52b513616aca06bdULL, 0x8d19b893cdf16560ULL, 0x06b28179c3b438cdULL, 0xde1ef747cd1819e4ULL,
+     0xbc6cc43b5f557985ULL, 0xa277e11f61e0142aULL, 0x58890f1e429cc392ULL, 0x28d17dbfe5fc8f5eULL},
+    {0x556df61a29a8f7cbULL, 0x5cf554dfd14ab27aULL, 0x243f933ba755b886ULL, 0xa4d0b06ff2d4ce87ULL,
+     0xa745eb8d2c0f1d39ULL, 0xc228747aea3047a5ULL, 0xced774c41d2cecc0ULL, 0x54a55c3a774fb01aULL},
+    {0x182c3f0e6be95db0ULL, 0x8c5ab38cae065c62ULL, 0xcce8294ebe23abacULL, 0xed5b65c47d0add6dULL,
+     0xbce57d78cc9494caULL, 0x76f75c717f435877ULL, 0xb3084b2eb06560a9ULL, 0x67216bc850b55981ULL},
+    {0x49c9fd92557de68bULL, 0x357aa44fc3151b7aULL, 0xd36286d11e4aebd0ULL, 0x84562cd736a51203ULL,
+     0x42a57e7c3cacc002ULL, 0x794a47751b1e25a3ULL, 0x2c2ab68cac0d4356ULL, 0xececb6addb31afdcULL},
+    {0x3b49e489100c0410ULL, 0x8831d3992adc2b29ULL, 0xb6726cd1247a8116ULL, 0x83a71a59d1d56d8eULL,
+     0x82ade2fe5cd333e9ULL, 0x3b087ef83ea11f1aULL, 0x17b96ca66ce879ceULL, 0xc2f74a971871dc43ULL},
+    {0x081ca6f0eafc7b2cULL, 0x1ba047a38c48703fULL, 0xe84865046663accfULL, 0xde1f97568d43689cULL,
+     0xf5373e1d5bc19f75ULL, 0x4e48c493d64b0a54ULL, 0x0c43f4e25807dbf6ULL, 0x73bef15167778c36ULL},
+    {0x9d5322e89e9bba53ULL, 0xdd7c9ceb989ff350ULL, 0xd76147eadab0d7b3ULL, 0x8e45b1c6d7a9a9a1ULL,
+     0x8f896a91d4f10c10ULL, 0x999a73c54068de06ULL, 0x84a9d0839cf0a779ULL, 0x4d7cc7689f608ab2ULL},
+    {0x1833ccddaee93c82ULL, 0x6a05ef7b9f35f20fULL, 0xc538dac9ae413bc2ULL, 0x1e74f4658b4784bdULL,
+     0xccb2bc4a49ffd544ULL, 0x9b88183d2b17ae88ULL, 0x96037a136e43824fULL, 0xbbb61441480bf3dfULL},
+    {0x9b0785c6c7e1070fULL, 0xec112f53cbf561e5ULL, 0xc93511e37fab3464ULL, 0x9e6dc4da9de8e0c2ULL,
+     0x7733c425e206b4eeULL, 0xb8b254ef50cedf29ULL, 0xfaee4bbbd50ad285ULL, 0x216e76d58c4eb6cfULL},
+    {0x9d6a28641d51f254ULL, 0x26c5062a0c2822c3ULL, 0xd74ebba8334bf4eeULL, 0x6e5446eb0b8f7305ULL,
+     0x5988ae8eb629beccULL, 0x71e576d0a1de7d1dULL, 0x15e39592a8873970ULL, 0x2b1f9a9342ecc74eULL},
+    {0xcbdb70727c519bf9ULL, 0x112986bbcaaf48e6ULL, 0x64d4c6d1a13baf3cULL, 0x85ccf6f7a065e77eULL,
+     0x183be337749beaedULL, 0xb3703096cba6c9b1ULL, 0x1edf81f0e42b8afeULL, 0xf04ed594ccb73ad7ULL},
+    {0xfa954ebc38491e9fULL, 0xf75a5808d32f0b03ULL, 0x196d4a828083b9d3ULL, 0x92d5a0be5e8dc9feULL,
+     0x4a507ae9aea628baULL, 0xeea5861e11a02fb5ULL, 0xa033b84fd23ec8f7ULL, 0x1a68c36ec60f11d5ULL},
+    {0xdb2478fd9410a756ULL, 0xd106aefe3a53a1e6ULL, 0x1f4c940d14286333ULL, 0x6a98659d04950958ULL,
+     0x3232a1c6a6bbe060ULL, 0x19ad132ca5e7ca9bULL, 0x3c9c13ef800fae29ULL, 0x9b0d9068b8660f49ULL},
+    {0x1e7f043795c53027ULL, 0x5221e5c0da9a3806ULL, 0xf297d8e379d9385fULL, 0x4d69e95f78ba697eULL,
+     0xdda936cee76d13c1ULL, 0xd9a5790a485b12f5ULL, 0xeab84add51efbfd0ULL, 0xc9a3ee9ca9f44aa4ULL}
+  }
+};
+
+static const uint64_t ecv_p384_g_table[4][32][12] = {
+  {
+    {0x3dd0756649c0b528ULL, 0x20e378e2a0d6ce38ULL, 0x879c3afc541b4d6eULL, 0x6454868459a30effULL, 0x812ff723614ede2bULL, 0x4d3aadc2299e1513ULL,
+     0x23043dad4b03a4feULL, 0xa1bfa8bf7bb4a9acULL, 0x8bade7562e83b050ULL, 0xc6c3521968f4ffd9ULL, 0xdd8002263969a840ULL, 0x2b78abc25a15c5e9ULL},
+    {0x05e4dbe6c1dc4073ULL, 0xc54ea9fff04f779cULL, 0x6b2034e9a170ccf0ULL, 0x3a48d732d51c6c3eULL, 0xe36f7e2d263aa470ULL, 0xd283fe68e7c1c3acULL,
+     0x7e284821c04ee157ULL, 0x92d789a77ae0e36dULL, 0x132663c04ef67446ULL, 0x68012d5ad2e1d0b4ULL, 0xf6db68b15102b339ULL, 0x465465fc983292afULL},
+    {0xbb595eba68f1f0dfULL, 0xc185c0cbcc873466ULL, 0x7f1eb1b5293c703bULL, 0x60db2cf5aacc05e6ULL, 0xc676b987e2e8e4c6ULL, 0xe1bb26b11d178ffbULL,
+     0x2b694ba07073fa21ULL, 0x22c16e2e72f34566ULL, 0x80b61b3101c35b99ULL, 0x4b237faf982c0411ULL, 0xe6c5944024de236dULL, 0x4db1c9d6e209e4a3ULL},
+    {0xdf13b9d17d69222bULL, 0x4ce6415f874774b1ULL, 0x731edcf8211faa95ULL, 0x5f4215d1659753edULL, 0xf893db589db2df55ULL, 0x932c9f811c89025bULL,
+     0x0996b2207706a61eULL, 0x135349d5a8641c79ULL, 0x65aad76f50130844ULL, 0x0ff37c0401fff780ULL, 0xf57f238e693b0706ULL, 0xd90a16b6af6c9b3eULL},
+    {0x2f5d200e2353b92fULL, 0xe35d87293fd7e4f9ULL, 0x26094833a96d745dULL, 0xdc351dc13cbfff3fULL, 0x26d464c6dad54d6aULL, 0x5cab1d1d53636c6aULL,
+     0xf2813072b18ec0b0ULL, 0x3777e270d742aa2fULL, 0x27f061c7033ca7c2ULL, 0xa6ecaccc68ead0d8ULL, 0x7d9429f4ee69a754ULL, 0xe770633431e8f5c6ULL},
+    {0xc7708b19b68b8c7dULL, 0x4532077c44377abaULL, 0x0dcc67706cdad64fULL, 0x01b8bf56147b6602ULL, 0xf8d89885f0561d79ULL, 0x9c19e9fc7ba9c437ULL,
+     0x764eb146bdc4ba25ULL, 0x604fe46bac144b83ULL, 0x3ce813298a77e780ULL, 0x2e070f36fe9e682eULL, 0x41821d0c3a53287aULL, 0x9aa62f9f3533f918ULL},
+    {0x9b7aeb7e75ccbdfbULL, 0xb25e28c5f6749a95ULL, 0x8a7a8e4633b7d4aeULL, 0xdb5203a8d9c1bd56ULL, 0xd2657265ed22df97ULL, 0xb51c56e18cf23c94ULL,
+     0xf4d394596c3d812dULL, 0xd8e88f1a87cae0c2ULL, 0x789a2a48cf4d0fe3ULL, 0xb7feac2dfec38d60ULL, 0x81fdbd1c3b490ec3ULL, 0x4617adb7cc6979e1ULL},
+    {0x446ad8884709f4a9ULL, 0x2b7210e2ec3dabd8ULL, 0x83ccf19550e07b34ULL, 0x59500917789b3075ULL, 0x0fc01fd4eb085993ULL, 0xfb62d26f4903026bULL,
+     0x2309cc9d6fe989bbULL, 0x61609cbd144bd586ULL, 0x4b23d3a0de06610cULL, 0xdddc2866d898f470ULL, 0x8733fc41400c5797ULL, 0x5a68c6fed0bc2716ULL},
+    {0x8903e1304b4a3cd0ULL, 0x3ea4ea4c8ff1f43eULL, 0xe6fc3f2af655a10dULL, 0x7be3737d524ffefcULL, 0x9f6928555330455eULL, 0x524f166ee475ce70ULL,
+     0x3fcc69cd6c12f055ULL, 0x4e23b6ffd5b9c0daULL, 0x49ce6993336bf183ULL, 0xf87d6d854a54504aULL, 0x25eb5df1b3c2677aULL, 0xac37986f55b164c9ULL},
+    {0x82a2ed4abaa84c08ULL, 0x22c4cc5f41a8c912ULL, 0xca109c3b154aad5eULL, 0x23891298fc38538eULL, 0xb3b6639c539802aeULL, 0xfa0f1f450390d706ULL,
+     0x46b78e5db0dc21d0ULL, 0xa8c72d3cc3da2eacULL, 0x9170b3786ff2f643ULL, 0x3f5a799bb67f30c3ULL, 0x15d1dc778264b672ULL, 0xa1d47b23e9577764ULL},
+    {0x08265e510422ce2fULL, 0x88e0d496dd2f9e21ULL, 0x30128aa06177f75dULL, 0x2e59ab62bd9ebe69ULL, 0x1b1a0f6c5df0e537ULL, 0xab16c626dac012b5ULL,
+     0x8014214b008c5de7ULL, 0xaa740a9e38f17beaULL, 0x262ebb498a149098ULL, 0xb454111e8527cd59ULL, 0x266ad15aacea5817ULL, 0x21824f411353ccbaULL},
+    {0xd1b4e74d12e3683bULL, 0x990ed20b569b8ef6ULL, 0xb9d3dd25429c0a18ULL, 0x1c75b8ab2a351783ULL, 0x61e4ca2b905432f0ULL, 0x80826a69eea8f224ULL,
+     0x7fc33a6bec52abadULL, 0x0bcca3f0a65e4813ULL, 0x7ad8a132a527cebeULL, 0xf0138950eaf22c7eULL, 0x282d2437566718c1ULL, 0x9dfccb0de2212559ULL},
+    {0x1e93722758ce3b83ULL, 0xbb280dfa3cb3fb36ULL, 0x57d0f3d2e2be174aULL, 0x9bd51b99208abe1eULL, 0x3809ab50de248024ULL, 0xc29c6e2ca5bb7331ULL,
+     0x9944fd2e61124f05ULL, 0x83ccbc4e9009e391ULL, 0x01628f059424a3ccULL, 0xd6a2f51dea8e4344ULL, 0xda3e1a3d4cebc96eULL, 0x1fe6fb42e97809dcULL},
+    {0xa04482d2467d66e4ULL, 0xcf1912934d78291dULL, 0x8e0d4168482396f9ULL, 0x7228e2d5d18f14d0ULL, 0x2f7e8d509c6a58feULL, 0xe8ca780e373e5aecULL,
+     0x42aad1d61b68e9f8ULL, 0x58a6d7f569e2f8f4ULL, 0xd779adfe31da1beaULL, 0x7d26540638c85a85ULL, 0x67e67195d44d3cdfULL, 0x17820a0bc5134ed7ULL},
+    {0x019d6ac5d3021470ULL, 0x25846b66780443d6ULL, 0xce3c15ed55c97647ULL, 0x3dc22d490e3feb0fULL, 0x2065b7cba7df26e4ULL, 0xc8b00ae8187cea1fULL,
+     0x1a5284a0865dded3ULL, 0x293c164920c83de2ULL, 0xab178d26cce851b3ULL, 0x8e6db10b404505fbULL, 0xf6f57e7190c82033ULL, 0x1d2a1c015977f16cULL},
+    {0xa39c89317c8906a4ULL, 0xb6e7ecdd9e821ee6ULL, 0x2ecf8340f0df4fe6ULL, 0xd42f7dc953c14965ULL, 0x1afb51a3e3ba8285ULL, 0x6c07c4040a3305d1ULL,
+     0xdab83288127fc1daULL, 0xbc0a699b374c4b08ULL, 0x402a9bab42eb20ddULL, 0xd7dd464f045a7a1cULL, 0x5b3d0d6d36beecc4ULL, 0x475a3e756398a19dULL},
+    {0x61333a382fb3ba63ULL, 0xdf330d9d5b943c86ULL, 0xbbc7c7ee955ef3afULL, 0xda631fc160f09efbULL, 0x68af622641d5c400ULL, 0xcc9e97a46c833e9dULL,
+     0x7fd73e8e3a625e76ULL, 0x13bf6124c209e55eULL, 0x08467cea48b90b91ULL, 0x8a416eb9bb6f0abaULL, 0x6fcc93a1b8c31072ULL, 0xa7fd2b619057dad7ULL},
+    {0x58a5b5433720ec9bULL, 0xbb3800d52d7c2fb4ULL, 0x4a508620dde6bd0aULL, 0x65f16273a02583fdULL, 0x832bd8e34fc78523ULL, 0xd6149f75e9417bc6ULL,
+     0xfeb026e93deeb52aULL, 0x0ce18088a55e0956ULL, 0x50018998988092a2ULL, 0x22f19fab28f35eeeULL, 0xac8a877f52ccd35cULL, 0xb13a8ad830e23f26ULL},
+    {0x0202d57de44f61a3ULL, 0x4027704bb5630ef2ULL, 0xa129e2dff5b54a5dULL, 0xacb60a7597482b86ULL, 0x9261ede87ef27114ULL, 0x1eba28f3defc58b5ULL,
+     0x6c91c0c98be5589eULL, 0x2f1643d514594beeULL, 0x2ea912435d2ca034ULL, 0xb50649a894047d1fULL, 0x284fcbb5638ca337ULL, 0xfa0e07b7fe85bf85ULL},
+    {0x7d894f80506e0e42ULL, 0xd984244a8e3d2c46ULL, 0x6d7edf642b7f006fULL, 0x36a1cd6dde9b6230ULL, 0xc9985040b76c0665ULL, 0x587df4d6b89b1fc2ULL,
+     0x4c0638476a71ae7aULL, 0x7b2b0ab3e8294747ULL, 0x345c553ab53153b8ULL, 0xb646e453436d9fe2ULL, 0x1a95355f1cd60340ULL, 0x2d7bc128074968fbULL},
+    {0xad148e87bca6d14cULL, 0x41dfd24d456a201eULL, 0x73a82933a80d68f3ULL, 0x89746c8d852ca035ULL, 0xe3bc778895fd71aeULL, 0x8764cd2cda92245dULL,
+     0xa2fe2c4782eb23e2ULL, 0x5ac762e00f3c9d6eULL, 0x57860ce121646f31ULL, 0xbdc9d6c34f9f589aULL, 0x679952c7d193272eULL, 0x82ea702eeb18f1c5ULL},
+    {0x37fa935500846d44ULL, 0x09112fc50578bc8cULL, 0xdad9f5b239c4943dULL, 0x7314f5f0416dbd86ULL, 0x5cf095a901fefb56ULL, 0x35178bad22dab393ULL,
+     0xcf79fc1b36baf1a7ULL, 0x1b7ee42d749e5498ULL, 0xbce78aa9ede314bbULL, 0xaaf8e0f6bd0628dfULL, 0xa974b09415cbf948ULL, 0x8f3f1f63c9632b78ULL},
+    {0xd4c411564fddda5bULL, 0xd4af65c673ad9112ULL, 0xffe8e0bb39eb8f59ULL, 0xb0040c0e8d6fcf13ULL, 0x99e1c0c61f2bb599ULL, 0x9c94c858b2ac3405ULL,
+     0x8f8878d76eeed85dULL, 0x62b2f54351fcca3fULL, 0xeb3b44a9e5b56918ULL, 0x16f96676b7234e93ULL, 0x17477722bd2af19eULL, 0x42eb2979db83a485ULL},
+    {0x6f888f7df0c668caULL, 0x65c788785f0dc66cULL, 0xbfb185125f5b07a0ULL, 0x780abff7d878acd0ULL, 0x504f21b1570cf950ULL, 0xea5b37c5da233371ULL,
+     0x487ae8bd22437ed1ULL, 0x9c701758249cf9b7ULL, 0xf86562a898fb34ffULL, 0xdfeea1a265e0fc91ULL, 0xeef006912e20fc23ULL, 0xac9dfec7dfa72a8bULL},
+    {0xfa5c3aef697136c6ULL, 0x8ea5af63a5ea6fb8ULL, 0xa669156542e365a4ULL, 0x47c56c115b6e3386ULL, 0x1197832bcea03f56ULL, 0x0b470bb250e4ea9eULL,
+     0x3113c74313b25712ULL, 0x8d6c174ed2497d48ULL, 0xfc4486ee49c9ebe8ULL, 0x2487edd57f82bdd3ULL, 0x771e64415b57be2fULL, 0x2d1cc518e28b2bdbULL},
+    {0x2c4ccac72070ac8dULL, 0x1947c0caec4a22b8ULL, 0xa5e0fb598c5a78d9ULL, 0x464ae8d241a84de7ULL, 0x3dba16e9daaabc27ULL, 0x16634a504f35cb3cULL,
+     0xadc18bf9b16ec84fULL, 0x324d067e7359dd35ULL, 0xdaeac0c3570543f0ULL, 0x0b2240003c887d36ULL, 0xc69489e2373f1a0dULL, 0x518b047dcbaa0d97ULL},
+    {0x3b1bddc6fbde49efULL, 0xdaed7c268a0915ccULL, 0x0b0110610f0422a2ULL, 0xcf485c74a7c54b16ULL, 0x642ec4e615c3aae2ULL, 0xa8ba8f10e0f383eaULL,
+     0x2a2054b495618501ULL, 0xebec6442089efa8bULL, 0x5786a19a4e2fa83eULL, 0xd2c71ad139069963ULL, 0xadc93d9a481765e2ULL, 0xedf2e3eb7ecc9485ULL},
+    {0xbcab5f60069f3367ULL, 0xfd6622bc1718ec3cULL, 0xa4fb7867e3a142d6ULL, 0x6078d8bf085faeb3ULL, 0xfa5cbfda60f4554fULL, 0xb3fcd5d1690cd408ULL,
+     0x4ebdee7d281f7884ULL, 0x82af23aa180a63a7ULL, 0x8de3107c3d079f61ULL, 0x17c6b5cbbe2334f8ULL, 0x6a91e73997d0fa06ULL, 0x7460257314ceeed4ULL},
+    {0xb14ba61cf97f865cULL, 0x73bae4c1694b8b0dULL, 0xa14967dfac4bbf62ULL, 0x1e9dd1509bf446e0ULL, 0xc052f3eb1c99ceefULL, 0x814d7fa07a78c189ULL,
+     0xa101a483ab74b05dULL, 0x7788c258a1737b65ULL, 0x0d60bab7e809a13cULL, 0x8f427bc473c81d5bULL, 0xd2e130552952c1fcULL, 0x0a823b9a4b26df63ULL},
+    {0xaf467ce227bf64c9ULL, 0xdfca6897f929974cULL, 0x64473b595c322738ULL, 0x96a917cf1ed0e315ULL, 0x3703435b0de64db9ULL, 0x9ba039679267b646ULL,
+     0xdf0c2aae3a522fbeULL, 0x41bdb741b335eff0ULL, 0xaccf2edd7b059703ULL, 0x6fb34b3028463cceULL, 0x96d9ba0bd9e3ca19ULL, 0xff336f12504655c1ULL},
+    {0x48da1fd3fc60a6e0ULL, 0x54fb5a34222241e8ULL, 0x6035e34f772ae080ULL, 0x5ff77ff2332982d0ULL, 0x2366467300fe51fdULL, 0xc93ea049ef6ba006ULL,
+     0x6640f1177d381266ULL, 0x394d32cd6ae9f4acULL, 0xe6a7885370d303ebULL, 0x0dda19ffe5275767ULL, 0xb0a6c77201466d23ULL, 0xc4cc11451fc69829ULL},
+    {0xc5c0e6d7aaed89c0ULL, 0x6ce8ead6149a1896ULL, 0x7a50f7458c949f8fULL, 0xcd7e35f76e2b71aaULL, 0xf6159e519a049f7aULL, 0x1c9bf0b0f1e52d1eULL,
+     0x3bb6c1f518202c80ULL, 0x8d3a5f621ecd7b1aULL, 0x3bb034e888d17f19ULL, 0xdc89bd4997d4048dULL, 0xf5af7b8e3735df22ULL, 0x52bb3712a0a689e8ULL}
+  },
+  {
+    {0x24480c57f26feef9ULL, 0xc31a26943a0e1240ULL, 0x735002c3273e2bc7ULL, 0x8c42e9c53ef1ed4cULL, 0x028babf67f4948e8ULL, 0x6a502f438a978632ULL,
+     0xf5f13a46b74536feULL, 0x1d218babd8a9f0ebULL, 0x30f36bcc37232768ULL, 0xc5317b31576e8c18ULL, 0xef1d57a69bbcb766ULL, 0x917c4930b3e3d4dcULL},
+    {0x318feb4c22319bfbULL, 0xfd0a1331a1ee9625ULL, 0x1e4a786d5b238661ULL, 0x88e04305a722c591ULL, 0x38eb062af406cb01ULL, 0x21caa381e7216364ULL,
+     0x450c1d29f0e1f665ULL, 0x369af7bf207a1320ULL, 0xfe46a53a6f6c0680ULL, 0x4553199a25eac032ULL, 0x41fa659affc49722ULL, 0xfb9e0c73bbcb7a29ULL},
+    {0xa4bfe1515bd11a42ULL, 0x38920da20ea6729bULL, 0x41e28260a0ee708fULL, 0xff4fdff4abc9d5f5ULL, 0x6ed92241ffaae99eULL, 0x6075ce0dc04fe4d9ULL,
+     0xf10a173e5db066f5ULL, 0xa2edee12e75ef129ULL, 0xd2a0823f8ed02e85ULL, 0xffa78cf42e522dc1ULL, 0x07041e4600c939fdULL, 0x3369357f3a9a8bbaULL},
+    {0x0e935934fd5d084cULL, 0x7cd4992a9121a6e0ULL, 0xab773dba8e15d863ULL, 0x9cea4a51cab64644ULL, 0x516754d72efff061ULL, 0xd8af89dacd3a36a4ULL,
+     0xc7d352ac4615774eULL, 0xd1bb914b21ae0d27ULL, 0x8a8aed979199938eULL, 0xeb06789acd6f3495ULL, 0xc51d7766775f93eeULL, 0x7eb6909f0a8af851ULL},
+    {0x4e0ee07d5601372bULL, 0x22067004277071aeULL, 0xb7c0947adb611822ULL, 0x0c890b17b836eb90ULL, 0x99bdb977b2c6177bULL, 0x64c60f944e04aabeULL,
+     0x875810cd5eecd182ULL, 0x66822d84875602f6ULL, 0xcd4b6d85d7e1914fULL, 0x46a4ebc42f2fa580ULL, 0xd4741ea8e0af11d6ULL, 0x70d64a3181238cf9ULL},
+    {0xf2ef682072003c04ULL, 0x627b8095e34ff1afULL, 0xdd00cb34ca23be89ULL, 0xe19d30e9e738d179ULL, 0x44feed7853b55da9ULL, 0x20380e9bdc3ee8eeULL,
+     0xf42be18f5d62dc68ULL, 0x407fa31b10b7feefULL, 0x362433eb7c25bc6fULL, 0xe292a4a4c864e045ULL, 0x5ecd7f8022841295ULL, 0x08b637ea32e118a7ULL},
+    {0x54f7b89895b6dee6ULL, 0x0dfde1345921f846ULL, 0xd3a18dcd63520e4eULL, 0x46bbd27bec276da8ULL, 0x981442a19f547286ULL, 0xc83cd6db5bc53393ULL,
+     0xec43325eb7898f04ULL, 0x1b9ca04e347da37aULL, 0x3119be87068b8c58ULL, 0x66041c29f272b77bULL, 0xfd0593f2548b165eULL, 0x0167e36c5340278dULL},
+    {0x62033f1c278d7e9bULL, 0x399b7adfc9bfb27aULL, 0xf00abd43b7c62fbaULL, 0x28cbb4e5a88ca2b9ULL, 0x943abe9440405b39ULL, 0x47875050fac3ff45ULL,
+     0x44db1743e35280f0ULL, 0x5a8d5b022dcc4892ULL, 0x8a564967a041bb50ULL, 0xc592661846bc9d15ULL, 0xa0ba607373a2f7bbULL, 0x9596dae1e66a0f3fULL},
+    {0xf8f71bd2a4ba58c6ULL, 0x7641b4085a4d153aULL, 0x26a0970402014761ULL, 0x9207af107c4a13f5ULL, 0xa6f7b3745a2632edULL, 0x20203309ec62cb7eULL,
+     0xdf21cb52c1352426ULL, 0xbe6e93b9510d10b0ULL, 0xb2a9dd62489527b3ULL, 0xaedd3b572409c15fULL, 0x4a3ec63ab1338fd9ULL, 0x94835c9183288659ULL},
+    {0xfd4688256e9b7084ULL, 0xd0a2fa6a6d3dd8a3ULL, 0xcf723bc90f2c348dULL, 0x9c16b768dd1a0af6ULL, 0x2c141bdc280a820fULL, 0x042c25ab8a819901ULL,
+     0xe4a34c3667742148ULL, 0xc483a361dfa83a33ULL, 0x3f246270bbc3143bULL, 0xd4a424b7a7dc5c39ULL, 0xfd021868749d341cULL, 0x59690623882d39adULL},
+    {0x2e3eeaf2065a3e1cULL, 0x670d0e01f927a61aULL, 0xfe98e455073356c8ULL, 0x8a73a1228dcb897cULL, 0xe4a82c1f02c04709ULL, 0xcbe20c8fd54f8187ULL,
+     0x7fbd619b24008706ULL, 0xd46074deb3b0ec95ULL, 0xfe063ae940f97000ULL, 0x313c895156e3a338ULL, 0x98ce0e34c9a359bbULL, 0x8c0008e9d1493e47ULL},
+    {0x36933d33abd30eb3ULL, 0x1bf08f97b47a241cULL, 0xacd63c1cce9a0032ULL, 0x785a5364be843fcdULL, 0xfda32442ce437355ULL, 0x26a8243ebae8e63eULL,
+     0x7e3cbbeab1dc5dbfULL, 0x3dda1d36143b94cdULL, 0xb33bfeb0daed7d5fULL, 0xa52720731b340c17ULL, 0xe80531b4187b1f4aULL, 0x71b9953fd5282f6cULL},
+    {0xc59a218c5d0df8cdULL, 0xd976f1041f841eabULL, 0xe9bd95032d1db448ULL, 0xfc8816eab42a49b8ULL, 0xf76dcaefecdcd665ULL, 0x8c3c27da62aacff4ULL,
+     0x95d0c61bece85ac8ULL, 0x61e644b791eca6d8ULL, 0xed5e396326be6e9aULL, 0x53a2d9890f2ada4eULL, 0xcaf9ea92176c3586ULL, 0xab2d358c56d730cdULL},
+    {0x8fd9b96c77ee492bULL, 0x405a68146abe66f2ULL, 0x8168b1c6872793faULL, 0xe991fa04520ef7d1ULL, 0xb07d515164132f17ULL, 0x0ecce193bb74da12ULL,
+     0xe288af27a9bf19b8ULL, 0x8ab59ffe94405304ULL, 0xf0bef99d46f8f333ULL, 0x4fba77373a04959aULL, 0xd6f9aa1204e302bdULL, 0xb476f2a644ffc7a9ULL},
+    {0x2bf965a0e534f633ULL, 0x0f11dea3e08e3cacULL, 0x0d0b276de3b79552ULL, 0xd58da088af63e8acULL, 0xfc4374905a937737ULL, 0x72cf47a7c3b3d74fULL,
+     0x4d3fa3326ad14311ULL, 0xf7ac508b8d386cc7ULL, 0xe40dfbeb828ebf03ULL, 0x5ed5b392c619addaULL, 0x0a7257bb711a3401ULL, 0xd607bee9c1651c7aULL},
+    {0x341f44849637acc1ULL, 0xbccb15495906061eULL, 0x6a48f0dd6df1f51aULL, 0xb915a50bc0582ccdULL, 0xa3cca3014ad3bbb1ULL, 0xcca4855f54ea7074ULL,
+     0x5daac46bb26e9f59ULL, 0x83ab8accde719995ULL, 0xd639e50b40364b08ULL, 0x41d9b5831972036eULL, 0x1ee2e99ad0db2b9cULL, 0xe89a7f6cb220cc31ULL},
+    {0x851a226926332e87ULL, 0x86304fbaa07ddb3cULL, 0xe99a9c77ce0f15c4ULL, 0x13e6432c0f762e29ULL, 0x970d62a23f070890ULL, 0xbc3ec545568943c4ULL,
+     0x01513de4072e7d6fULL, 0x52829abe2aff5826ULL, 0x0627e638d95b7753ULL, 0x74e31aace0585ed7ULL, 0x648bb0a0b90ace45ULL, 0x9b5600b3640166d1ULL},
+    {0xc015b8d9a27c7c38ULL, 0x826101f97c17792fULL, 0x1d04a7dc5ddfbfe7ULL, 0xdf8fe13a16ddec37ULL, 0x454d9883ec9bfa64ULL, 0xc71fb2dc95b76676ULL,
+     0x0385003d59a893eeULL, 0xea002919a3bae30dULL, 0xcb83a4d34e763313ULL, 0xda830a920543762cULL, 0xccbd7d8575247452ULL, 0xb1b9f6fefaa7684dULL},
+    {0xe5a546c46c774c3aULL, 0x4d699f02d39a9f44ULL, 0xadee8947b00df280ULL, 0xe6d2a2b9c220fc6eULL, 0xc628f268cd4f3dc5ULL, 0x16867c03303f22cfULL,
+     0xd324b039cbb7d49aULL, 0x861ee67c7153dc85ULL, 0xd3708f7ad6face69ULL, 0x4ecb18cad5c747f1ULL, 0x219ffbe74a891535ULL, 0xfb392be9def03698ULL},
+    {0x879468859833bf8dULL, 0xc896eaf3296c251eULL, 0x567e2607009c0011ULL, 0x5a12d7b330e0b997ULL, 0x42013011f11bb783ULL, 0xe826ca8c5ae379deULL,
+     0xcc07425ca72503e8ULL, 0x6a6cf5129b2c1f28ULL, 0xe8a0f002112f248dULL, 0x3f5acdc220cb5ac1ULL, 0x73d107ffbfeb0997ULL, 0x3dbb5ce619785401ULL},
+    {0xe103ecf7b443a30aULL, 0x952ace4b0152c910ULL, 0x1f82fa93c7186fd1ULL, 0x74e3ed87173d98adULL, 0xd7592ca7ac653ea7ULL, 0x93517074420238f4ULL,
+     0x5b6ac59a7f30e3f9ULL, 0x3a7fea396a36218dULL, 0x39b46c4fcf725a71ULL, 0xb793ac8b292451b0ULL, 0xdcda27fc7cb924c8ULL, 0x8ad6a3494e7f7b9fULL},
+    {0x1fae415cd7000a98ULL, 0x9d85cfc5d8548abdULL, 0x27c9e15dc3a0fa02ULL, 0xcd19e4af1d8a12a3ULL, 0xcdc63f63f0a66c7eULL, 0xcd12cf08afb80360ULL,
+     0xb2f0754c068922f0ULL, 0x2303ef235b936deeULL, 0x742478c7da1bada2ULL, 0xdf32f409318489adULL, 0xc9300664d0bf5873ULL, 0x37487aedd47d8228ULL},
+    {0x6e92359b72794f2bULL, 0x4691d1ba981f8597ULL, 0x7682dfa1b72af34fULL, 0xea2fd50b3caa97e7ULL, 0xe2fe294fbe164aacULL, 0xb09a55ddf21c7588ULL,
+     0x1eb75cdf454421dcULL, 0x6a5119ea4ca239f9ULL, 0x7456f26da5602275ULL, 0x2ccde65d664727c0ULL, 0x9d279505ba4a59e0ULL, 0x07322c5428687f7bULL},
+    {0x63540e48315212f8ULL, 0x6bbd23e0828eaaaaULL, 0x9e8d2e862709a245ULL, 0x051ec4ac7beffcabULL, 0xe328c3953febffe6ULL, 0x7f00fd27fde46fa1ULL,
+     0x6f4c6c2aeea4835eULL, 0xff0aff6ab70af262ULL, 0x82bb90440ca5a30dULL, 0x50317ca0ab736947ULL, 0x092b64e3985aca12ULL, 0x9677300937e533bdULL},
+    {0x973b5e8d8a06ea1bULL, 0xdb1285a7ca8567b5ULL, 0xbb9670ad9f54920cULL, 0xfdea73318562ef3eULL, 0xa0e426a74b62bff1ULL, 0xa598023fed6cf769ULL,
+     0x5e81d7e6cc41e07eULL, 0xa6a743a444ff4ba8ULL, 0xb1cb6d53026d3bcbULL, 0xd60e8af6ff307362ULL, 0xee03dbcae6efbef9ULL, 0x383cd89a91cc5dd3ULL},
+    {0xbcae944c51312428ULL, 0x01b18ecade59d3eaULL, 0xac258c4205b19bc1ULL, 0xcf52ddc6e1eb7b5dULL, 0xa1aab03ba481e47eULL, 0x42002fca313c0736ULL,
+     0x8bbc936040acf1f7ULL, 0xdb4c200713c665c6ULL, 0x3eadcab2088cf6d9ULL, 0x04595bdc19dc6e8bULL, 0x5dbdc08bb1ee7cf2ULL, 0x8461c976177a7badULL},
+    {0xdcecf700fc989969ULL, 0xab59a6af7a1b65aeULL, 0xa8766f85c2b1833dULL, 0x87f681b1ad22eb29ULL, 0x94b26fe5569bcce8ULL, 0x3146ed7fffc6d4fcULL,
+     0x920a4d88c04656c5ULL, 0x28f08866a8cde567ULL, 0x7054c4f41159d162ULL, 0x98c39810cdf7c4bbULL, 0x80bdb661cb2a4f98ULL, 0x8dac1fada2b8a2a4ULL},
+    {0x568a419526ddbae6ULL, 0xcaea00706a25e7b1ULL, 0xfaa819b10d30624aULL, 0xad7d43688581881cULL, 0xc9113bf0106f297cULL, 0xa9364667c4901bb2ULL,
+     0xfef986c7661b5756ULL, 0x3898823971af3b6eULL, 0x5f278a07d85b8823ULL, 0x36e98cb52b967114ULL, 0xa8ff1ca627c75bbaULL, 0xab108ccefbf9cbf6ULL},
+    {0xe2abc3b4d4624293ULL, 0x847b5f5b835ff401ULL, 0xbdb661958b4c54f7ULL, 0x7756dbe97f817e4eULL, 0x9b526e98b0b02139ULL, 0xc7966676243b4b1bULL,
+     0xe173bab06c3fa54eULL, 0xfa7b45b2eb30d87cULL, 0x7fabfe8013dd2b48ULL, 0x8f9bab8123abd5d2ULL, 0x6b873e3889fe4566ULL, 0x847b8dc71e12a69fULL},
+    {0xdbd2a2f3118efe74ULL, 0x8af5d72b1038f21fULL, 0x358628fe7d46b44aULL, 0xa230330f98b2267fULL, 0xba8e72cb952b638fULL, 0xe62864dceb9b420cULL,
+     0x79dea1adb5654f82ULL, 0x976b5daeeefb0ed2ULL, 0xcf54e1c64e97c7dbULL, 0x88b3bbf24375d24dULL, 0x387ab302e34f3d67ULL, 0xbb9c3467355cc80aULL},
+    {0x7ef8250adf222411ULL, 0xe1011fa1f1705042ULL, 0xf48e1e4915a9665bULL, 0x55de6fa8506c31feULL, 0x587cef3237feb623ULL, 0x1c54cf817dbc395cULL,
+     0x3de4c7c881c87ab0ULL, 0x0490de40bbe3a56fULL, 0x56e4372d40d523b6ULL, 0xa9616cbe3b4352dbULL, 0xdf1e0fc733add8c0ULL, 0x54c5962c1327ea95ULL},
+    {0x24c6b6724b256378ULL, 0xc58ab814ba597052ULL, 0xfb1ee167bca2694eULL, 0x5a5e11c723ad0d03ULL, 0x8c6d2ab9fa7e5617ULL, 0x0363faca6b85e6abULL,
+     0x3246b73a9b50564aULL, 0xc3505f19c456a0b5ULL, 0x6bf5da6630556462ULL, 0xbc1061f1a83722b3ULL, 0xb87783ea71f9aef6ULL, 0x956c97bf4b527c9aULL}
+  },
+  {
+    {0x378205de2f9fbe67ULL, 0xc4afcb837f728e44ULL, 0xdbcec06c682e00f1ULL, 0xf2a145c3114d5423ULL, 0xa01d98747a52463eULL, 0xfc0935b17d717b0aULL,
+     0x9653bc4fd4d01f95ULL, 0x9aa83ea89560ad34ULL, 0xf77943dcaf8e3f3fULL, 0x70774a10e86fe16eULL, 0x6b62e6f1bf9ffdcfULL, 0x8a72f39e588745c9ULL},
+    {0xae10069e808dc4b1ULL, 0x64df30e18fb3ba73ULL, 0xbbe4caf27ebaad0bULL, 0x5907bf373dd6119cULL, 0x0a723dff9dfceefeULL, 0x59bff4ddf7cffc7eULL,
+     0x7bc95fa26a6f43c2ULL, 0x9001d1d53ca0e2b3ULL, 0x316a7ecd27b3335bULL, 0xbf08e6727b8d7d49ULL, 0x4b209f93c619058fULL, 0x4c0ca01e59d8f9eaULL},
+    {0x34590975ed424438ULL, 0x7c03ce744d11a200ULL, 0xcc939a286ec406eeULL, 0x8d214276fee5454dULL, 0x66a0e1a56b257f70ULL, 0x93761a8a006fb85eULL,
+     0xc44f9df2aa70b65aULL, 0x1dac524f91d9e2e8ULL, 0x5894a8224fca1a81ULL, 0x8586e418f3ed85bfULL, 0xd494dfb202899b5bULL, 0x7ea9f222ecb8e371ULL},
+    {0xefca7f7ba6c53c1bULL, 0xcb4bb33c524457a0ULL, 0xc9eab87fe57d08dfULL, 0x48c01c2a7d9a1967ULL, 0x11c97ed97dc27492ULL, 0xd8c644861cf1f639ULL,
+     0x541f8c0d8156576cULL, 0xdf5c8dff2384e299ULL, 0x9806935ba6be190dULL, 0xec6c5de764494b4eULL, 0xf04e2d4cb83c00b6ULL, 0x379af438c0b84f15ULL},
+    {0x941134bbe5faddf8ULL, 0x211b3ed996b16dbeULL, 0x4ef0655cc344367aULL, 0x4b6308427293deb9ULL, 0xafd911af5ea7f0bcULL, 0x6bb4d3bcf21e5957ULL,
+     0x7c99ddc240c0d43eULL, 0x75dae60afd07610aULL, 0xe6f9531a0377d66aULL, 0xcb9a8037e4890176ULL, 0x3c8f4b0972dcd77cULL, 0x820b21848837e34dULL},
+    {0x3ff4efe13eed22afULL, 0xd13021e7723ba845ULL, 0x513120d0a7b5f0f8ULL, 0xee67c079da534d87ULL, 0x7fa3e19ab512175eULL, 0x14ed4af4c3b73cfbULL,
+     0x8fe345c3b2cc8287ULL, 0x20c19a55bf4c5331ULL, 0x52c11852e3a8d1edULL, 0x3afe2791d495344dULL, 0xdf1fb43ae0e0f34bULL, 0x4360bd179a549162ULL},
+    {0x2e613a44195d5eb9ULL, 0xe779731baa4cfa01ULL, 0xa722b2b522e25a03ULL, 0x1d5cf443bb638b1fULL, 0x641665fe2d2a16c5ULL, 0x83086a5aa7b3b23eULL,
+     0x6d58cc3168470250ULL, 0x12593caf82900e21ULL, 0x151a1b94ab808471ULL, 0x8e628aca767067d3ULL, 0x2ebfd96ca6a089afULL, 0x3984e8e2a831ade8ULL},
+    {0xf634f0313ebc453cULL, 0x22249e7eb40cb97bULL, 0x0ee2375bba748de0ULL, 0xa4f20574e3718502ULL, 0x03d2e6a177a91e79ULL, 0x3e8882306ce30e34ULL,
+     0x455bceea7ffc5783ULL, 0x6e8e2260d061c521ULL, 0xa93c60e2f6904c4eULL, 0x6a374fe87d7c4f11ULL, 0xcd2aafa02e18a779ULL, 0xb44f66cefd3bc024ULL},
+    {0x4f4f652f3684ba0dULL, 0x1020168588a2de5bULL, 0x19fe3dbc738442e8ULL, 0x4c246d692cce3234ULL, 0x7adbd2237db307a3ULL, 0x5acb971143901704ULL,
+     0x4e6dc2093185087dULL, 0x2d920c66c4359803ULL, 0x7cd192471e7ee5aeULL, 0xb652fa85ac5f13ceULL, 0xf5cd767241d65a38ULL, 0xfbb2077943aa1601ULL},
+    {0xda08dc4053f669e9ULL, 0x025ea0f05eb9a71cULL, 0xcba2f5474380863aULL, 0x23ff33f8c0413964ULL, 0x9404418e858230d3ULL, 0x9cb38239336b666cULL,
+     0x807f91b1ed7d192cULL, 0xeb26da973796bb3aULL, 0xdafa6be4cff54ec9ULL, 0xbecd3e1b71a10946ULL, 0x9b17655d1eaa3c1eULL, 0xa0f14e2522bd1c43ULL},
+    {0x49556f49626ce069ULL, 0x4c74e93b8d09248dULL, 0xc2eab92ca2284824ULL, 0xfa4f00765ada9cc3ULL, 0x3a64d1fba9f3516cULL, 0x661490183129526cULL,
+     0xadb68cb5f3e8f8d8ULL, 0x736a35f8dc7dcb9cULL, 0x82f3579cecd7b74cULL, 0x7b4907a93f58e442ULL, 0x8624faa8866ba50fULL, 0x520612556096c64bULL},
+    {0xe36edc1508d3ef64ULL, 0x36e8e9a13d41baf8ULL, 0xa267ac7b0262e66dULL, 0x78ba8cf8904678dcULL, 0x626c4ee30b242bfbULL, 0xc722c30523e8df06ULL,
+     0x258c63d446bdbd01ULL, 0x1473eb7e39478fbdULL, 0xd2b14ced3950fd8cULL, 0xf4d81266234450eaULL, 0xeb285a1638f1aab6ULL, 0x41b90fcbd4f5fc4cULL},
+    {0x2b81611297b7dfe8ULL, 0x5e062a13e3e066ceULL, 0x2964bc5a7532418eULL, 0x7422038396599b7fULL, 0xa0b07e054cc5f35dULL, 0xdd21372e7e6dfcd3ULL,
+     0x27330b878899a4b8ULL, 0xcfdeca1583c509caULL, 0x6dfedb0e30f80e44ULL, 0x7306ed9e2a7a8805ULL, 0xbef44895a72af6b3ULL, 0xca2e509e56ce65d0ULL},
+    {0xbe9b29991cbea89eULL, 0x67accada39ec1d1aULL, 0x42a91a3f9cbd00fdULL, 0x03300e71cbf9148fULL, 0x055af00138ee502cULL, 0x4fbcae2f54d904ffULL,
+     0x9e2789c539ece664ULL, 0xf5392a37eda80c56ULL, 0x87b21d0d75079f8cULL, 0x7f0138669ac72edcULL, 0xd36acccf6376562cULL, 0x0228b27f0242b14aULL},
+    {0x69d31ea04a843d2bULL, 0x5238b958abc97191ULL, 0xa03ba0de3319b354ULL, 0x97a037375bb1530dULL, 0xc6d02d5e20ed062aULL, 0x5ddd77b70aa3603cULL,
+     0x33af6b266ed2443cULL, 0x5e85aed8d31773a3ULL, 0x062e40cf0b8b3a80ULL, 0xac06b54c40db3be2ULL, 0xf38738ba1b800d36ULL, 0x548360d6991d652dULL},
+    {0x5d723d1de1a6b4f2ULL, 0x053a35a614c9bc4eULL, 0xe79cbf9949ea2352ULL, 0x68e995373831e3eeULL, 0x4a8ae80736901b6bULL, 0x97a767736cf9225eULL,
+     0x9d50a0712be5fca6ULL, 0x11e3897eddc7ef22ULL, 0xa047f99016de0088ULL, 0x5d7a4934383484ccULL, 0x35a3f34580e55fb5ULL, 0x1df83af03d682c6dULL},
+    {0x00f497fc8f584f98ULL, 0x4b8f333c203b92ffULL, 0x411ae74206b0e0a5ULL, 0xe13246f8835d842dULL, 0x9e25044ca6de8773ULL, 0x322429749171c5a3ULL,
+     0x88f3d333d6376693ULL, 0x4b6fd73cf9b993a7ULL, 0xc09a263273625b64ULL, 0xea7db319d2fea33eULL, 0xde794466ca5d9811ULL, 0x0301cd72db389529ULL},
+    {0x1897853709f5810aULL, 0xe3e8eba4c6cda864ULL, 0x02d81a84d2381c95ULL, 0x2894f2944f43c3edULL, 0xbf6dd59078f6a434ULL, 0xcc10ddba6dba74e8ULL,
+     0x9886e574c0376f70ULL, 0x97bde2de373657a1ULL, 0xde06f3c8565fe562ULL, 0x2f50be5a42bf8f9bULL, 0xa3cc755fe4527769ULL, 0x7d080273ecbe74ccULL},
+    {0x452143390555b93aULL, 0x9696104803c594b5ULL, 0x6daa1e67d2e3b110ULL, 0x02e172aebe12c427ULL, 0xed3167ecaaf59403ULL, 0xd3d657c447d3cdc8ULL,
+     0xa6db0b4c02ccca1eULL, 0x6c43277fa11e805cULL, 0x769d1ac2421d9a48ULL, 0x4f93a0c27abcae1cULL, 0xb000c182e7d518dcULL, 0x4078664d23532b10ULL},
+    {0x6abf1b35b9cd6e5eULL, 0xd8ec084e2e30d3c3ULL, 0x1dae6903191bb6e4ULL, 0x10ae8b4030b07624ULL, 0x4839be48412529a7ULL, 0xc0edd714c9194e82ULL,
+     0xd45eaa5ff5d3b3f8ULL, 0xa79809e3832e22e2ULL, 0x788236bbc8f44765ULL, 0xccd2d3bf8d67ce10ULL, 0xd4487b64f99c4a39ULL, 0x28d8028559260c27ULL},
+    {0x861d2a9507949a47ULL, 0x0feb850c9bd83474ULL, 0xc2639724d6aea7b1ULL, 0x44f9638611184ef7ULL, 0x9c8f0c78e74dc1e4ULL, 0x10c4ed6adbbd6a1fULL,
+     0xe7e44210ac5fe5b1ULL, 0x540d092f8de76a8aULL, 0x4494c9218ceb6528ULL, 0x86ada9f0989bf720ULL, 0x0873b635cc1366e5ULL, 0x9560bdd1d0d79c39ULL},
+    {0xb9bab8029f0293b1ULL, 0xce125ccc9028e985ULL, 0x88671f230e3ccab8ULL, 0xc334e66681056ef6ULL, 0x5fc6c9eab72e7b2dULL, 0x908165e7f11d44e9ULL,
+     0xfe6d323eb6b5aa8bULL, 0x10dcd5064efcce27ULL, 0x5f52b47117d6fc5aULL, 0x3f8b6f181201990dULL, 0x77be3fa97ed98390ULL, 0xcb8741180acba1d6ULL},
+    {0x668cb690922c58b8ULL, 0xd9b7be1bb991c85fULL, 0xd22de50353118251ULL, 0x64ed221d30e3ce85ULL, 0x70d6fc4e6edeeb09ULL, 0xb7df2388d87f22b8ULL,
+     0xb744ce126ac31241ULL, 0x59655263e6c3df19ULL, 0xae5dcc34059d3de5ULL, 0x724c02c151d7e7f5ULL, 0xbb89fe1a80fd09d1ULL, 0x96aa8696625b8616ULL},
+    {0xc74ae061bdf6022fULL, 0xb1de20f1a1fb22d0ULL, 0x0f7be756a812b92cULL, 0x9d3261ab9ae540bbULL, 0x6ffe478f31ca6aa1ULL, 0x2a65d7245c4b84ddULL,
+     0x1140b22404e596bcULL, 0x097f4287b3b4c6deULL, 0x71804a3d836a1f1cULL, 0xb65e734966a904cdULL, 0x2c6da0f31db4ba5dULL, 0xe3f0fd8d47fdc9aeULL},
+    {0xafdff35591644e4bULL, 0xf1773225e4970cc9ULL, 0x026fc08a9a5251a5ULL, 0xa2c5d9a6c90dcdcbULL, 0x74c42a673cea32b2ULL, 0x8a954b086cbf3250ULL,
+     0xf00b1aedd5673003ULL, 0x37ee491a700cb536ULL, 0x1417f689772a7e4bULL, 0x8e3d3a9e13696584ULL, 0x5ebaacdcf9a1f316ULL, 0x7219dea927ec2c2dULL},
+    {0x0f3a1bc51aa7e176ULL, 0xcc4241677433f275ULL, 0xf0e47b72e38f4227ULL, 0xf245f68b946ba175ULL, 0xb87c009f778d5833ULL, 0xee1317034b5f6f1bULL,
+     0x6719a0a00d7d3f2cULL, 0x68141227fb775c00ULL, 0x7637e1b9764587feULL, 0xab6c747118ae1684ULL, 0x34b52bdf4d9a3afcULL, 0x95c658361ac2e8c8ULL},
+    {0x9045d0776831d26aULL, 0x4c63ea63ca85d15eULL, 0x4db96bd3a4663ef9ULL, 0x169f15ee8e898642ULL, 0xe912d06c7267a1d7ULL, 0x9e9996c2c2fd1ec2ULL,
+     0xd6d7ce7cbe808085ULL, 0xf3435d6421b1d371ULL, 0xa5d2c5acaee005a4ULL, 0x9cd7c949e688748bULL, 0x389561749f53ba56ULL, 0x8b3db047404b6404ULL},
+    {0xf888764acb13c90eULL, 0xd23a8b80b6beb8caULL, 0x2b6c85ec9411c1bfULL, 0x88bd8c2de8441c3eULL, 0x6f337dbcece8d871ULL, 0x050c5f2e13671d1dULL,
+     0x600e8748d6789a99ULL, 0x8148e76bafff3e4aULL, 0x32531eb9729c235fULL, 0x28a761647b5a847cULL, 0xd14a2abcf327ec74ULL, 0x0fa34a7c7cc90c01ULL},
+    {0xa25340764b6629acULL, 0xbe60a164c7340f0eULL, 0x06914ea4e7992abcULL, 0x282704e1bfd9eb7cULL, 0x2a819ffd15451ec6ULL, 0xc8de387788f85ee4ULL,
+     0x957275e719b7f911ULL, 0x2e08b1db907e79f3ULL, 0xa312609d9a7f820cULL, 0x0132c2a7fa9b68e4ULL, 0x8cc80caa4ebffec8ULL, 0x4821834a70ee89c3ULL},
+    {0x834cf05b3cb73886ULL, 0xa58e15a68906e909ULL, 0x00454bad39906a91ULL, 0xd45046a38dc70d4eULL, 0x7f7cfdf5330b0bddULL, 0x0bfae8fe22b63cddULL,
+     0xde00e285a745a345ULL, 0x263de830c2b9ad9fULL, 0x59a4c22b78044616ULL, 0x6f2a21d88a4178c5ULL, 0xb378bc5a1db98bd8ULL, 0xa0121e8b0c325d3cULL},
+    {0xf544323fc684c8cbULL, 0xf08b74d596be0a0eULL, 0x1d27121c0937958eULL, 0x474dcd67e58d1c2cULL, 0x7bed255f540e40a7ULL, 0xed98d4bfc6b1c033ULL,
+     0x309c9cf905de9aeaULL, 0x9bf4766387130168ULL, 0xda50bd30f2701d25ULL, 0x95c336d8f8076b5fULL, 0x400b72f8eefb7d91ULL, 0xc7a9b0dcf85d0e0bULL},
+    {0x18a9f0476b0ae309ULL, 0x25670a6a08c0f650ULL, 0xe06832a3c1574273ULL, 0x833c3f608f7994f9ULL, 0xc787bae8f5de65adULL, 0x8c089e016785489cULL,
+     0x9b0dc39bbfa6e2eaULL, 0x20e2d436ed1f1f29ULL, 0xaf129462bd4a0977ULL, 0xb005b347a931cfb3ULL, 0x042a82c69fd66634ULL, 0x8e7eebca855d3f36ULL}
+  },
+  {
+    {0x070d34e116973cf4ULL, 0x20aee08b7e4f34f7ULL, 0x269af9b95eb8ad29ULL, 0xdde0a036a6a45ddaULL, 0xa18b528e63df41e0ULL, 0x03cc71b2a260df2aULL,
+     0x24a6770aa06b1dd7ULL, 0x5bfa9c119d2675d3ULL, 0x73c1e2a196844432ULL, 0x3660558d131a6cf0ULL, 0xb0289c832ee79454ULL, 0xa6aefb01c6d8ddcdULL},
+    {0x68550299845e12c9ULL, 0x979b5406361d027fULL, 0xf601d2b4a8e92e70ULL, 0xfd02799f0cc9fca9ULL, 0x89f99ca013bc2e96ULL, 0x22a12c0bff9db9b8ULL,
+     0x6ae7084a32efcea8ULL, 0x5ddd3ee9a24b9376ULL, 0x394d92a4e0945e8fULL, 0xddab6752ecea36f6ULL, 0x650b74d60d18a069ULL, 0x37f91cebad650860ULL},
+    {0xa804b2f089ef2489ULL, 0x06a2a805fb22f7d6ULL, 0x31baf4fd353970beULL, 0x3481c8b712854a91ULL, 0xb0424eecf3971398ULL, 0x748ef3820f4ed94aULL,
+     0x92b74ad026722164ULL, 0x23f71d5831b1302fULL, 0x6741b28070a5f0c9ULL, 0x46c12cfb9f5101caULL, 0xe7014d7901d0f81eULL, 0x129bd87ad758c288ULL},
+    {0x58805ca8d2eaf294ULL, 0x910d085ed7d5abb8ULL, 0xf9cbc9a1349cfecfULL, 0x67bc7b417800a980ULL, 0xe7e6dbc0f6847e9dULL, 0x7a0f22c4af379c48ULL,
+     0x80b6fc04b1d2822fULL, 0xa1cae656d8517a70ULL, 0xd2d11ed14e9dc24bULL, 0x48d74f173fab87e6ULL, 0x1feca5af50c630aeULL, 0x263e04cc62d0620aULL},
+    {0x23c14c43d8f6e236ULL, 0xb14be0d28ee39386ULL, 0xd3c55814262dd390ULL, 0xa1b40401e1f23d0bULL, 0x1377b07c61534375ULL, 0xfe4e3eb116f6d95eULL,
+     0x17b1af0040b4386cULL, 0x2dc657a837ca3851ULL, 0x6862ca92ef976731ULL, 0x9f0c380ba4118d3bULL, 0x23bf793977c1aa94ULL, 0xaadee0612bc27d4bULL},
+    {0xb87d5ce2722f405fULL, 0x24d1f993d7c6a322ULL, 0x09d837291e0d8113ULL, 0x70b5cdbf89a6cbc3ULL, 0xdfb3ee16fb2c9607ULL, 0xf0acc1163465c7c6ULL,
+     0x10cef4b707e6659bULL, 0xc280c4331fde9940ULL, 0xc8b5e9819a2d3f25ULL, 0xc36faa763f7f68c1ULL, 0x17878bfa8d54e281ULL, 0x8fda8b359c42c5a2ULL},
+    {0x7d8ddca252aa7ff2ULL, 0x0985e47d6953b9a2ULL, 0xed328993dfff63ccULL, 0xbfeca5327cfa6ee5ULL, 0x7535a871b1e6a010ULL, 0xb0052764303c2ec5ULL,
+     0xd39c72102fedb0daULL, 0x7ee2b384e1001505ULL, 0xb638a1b1c82a7e1cULL, 0x1b94a47b4573fd7dULL, 0xef2bca7792cb2b88ULL, 0x49ad6e97a75b21efULL},
+    {0x1b403c4f1470433eULL, 0x6f8cb19257e53eecULL, 0x87b5b93df0cce4f5ULL, 0xfefaa5008c566f77ULL, 0xf6aa8066db71517bULL, 0x9f01b036d67f5952ULL,
+     0x9524306faaeb40dfULL, 0x5cb2e8e1421350a6ULL, 0xa57d05ea3d69040cULL, 0xd0ff12a1b9bbdcd8ULL, 0xed64d3259e3e19bbULL, 0x29509c0fed0a490dULL},
+    {0xc29fb53e118a0c7dULL, 0xea7a1017193b834cULL, 0x678072a2cec93ecbULL, 0x9054d6b72475dedfULL, 0x4a7d477342ee616cULL, 0x05cec7f8680f8a43ULL,
+     0x39c491d496915870ULL, 0xe07a2b1d8746edeeULL, 0x1d8ed3c83566e7fcULL, 0xc7d744e5e002298bULL, 0x8a0acec99c0e6388ULL, 0xb2daac39ebf48fe3ULL},
+    {0x8ffda4643672507aULL, 0x76301be7dd91327aULL, 0x42720bb0958860bfULL, 0xedc0b8945ad4f455ULL, 0x2fb553201bfbeb4dULL, 0x22a425bda1c6494dULL,
+     0xfb927a85de0e7f52ULL, 0xb84a82cf49a4b6a1ULL, 0x8afd0546b640fe0fULL, 0x23b78fbed2fc15cbULL, 0xeab469c26742a49fULL, 0x308e453fe277c7cdULL},
+    {0x1ec7f2410828d35fULL, 0xd94c2a926ccae554ULL, 0xdf4227273c36ecedULL, 0x2facd6d89fa6582bULL, 0xed43247ed349d3beULL, 0x1d59d55d1db6fcc6ULL,
+     0x2b5074b1ee1bea38ULL, 0x025496aac9c21a8fULL, 0x57dd7fa1d1d817edULL, 0x57b5572aead03124ULL, 0xdc024be87314616dULL, 0x5bb5b23c10f6e38eULL},
+    {0x747b6b6ddecaf88eULL, 0x1a32f8ba368cc7caULL, 0x52a3a00f60d84fd7ULL, 0x60052af507adacf7ULL, 0x8b7bf25650b8de16ULL, 0xb8b2acf8194926baULL,
+     0x4bda72c81d1ef524ULL, 0xe350f73288993f96ULL, 0x63fee4e2e08c5d39ULL, 0x1f2cd9cd5db46904ULL, 0xbf11ac311668d3bcULL, 0x8eaa064371d721aeULL},
+    {0x9dd54056514e343aULL, 0x8d9116dff12aa25fULL, 0x5322ec38e3397844ULL, 0xe1843921571036a1ULL, 0x2cde0a48650beb19ULL, 0x41ad4a7e4f259728ULL,
+     0xf314fceeee6448b2ULL, 0x80006b2aff0e81f5ULL, 0xb5ee5524d51d229aULL, 0xeba6d733128e900bULL, 0x79278cb8030f391aULL, 0xb24bcd63a9a5f9fbULL},
+    {0xe4ff888f820a13b5ULL, 0x7cd18b3eaf1bfbbbULL, 0x3fb7f681bd4e4dd5ULL, 0xaba364c287d46c40ULL, 0x44e209ab659b3498ULL, 0x5e071a272dde85c1ULL,
+     0x8a029b1fb969c790ULL, 0x51bab9f0c6fd1c22ULL, 0x9ee9b047b83eb0c1ULL, 0xda0b39439e5b2c35ULL, 0x0cb30625f20ca425ULL, 0x8e4dbd013d25c2c9ULL},
+    {0x37579c3eb954b7a4ULL, 0xf0291f8f3f2ea608ULL, 0xde68104f90a85ed2ULL, 0x6a35fea9e1088788ULL, 0xe8d5517470d15d00ULL, 0x0bc72de552467f90ULL,
+     0x2ded3293297be2b8ULL, 0x76c53e5761ddc65bULL, 0xae4b2b5015562d6aULL, 0xfe7cdd329e0aeb79ULL, 0x98ef4c518dd474ecULL, 0xfca56ffb0076b23aULL},
+    {0x5c6448f70d00b29aULL, 0xaa134b87124cd55dULL, 0xc2c6b269d94b72d9ULL, 0x0f0dd472412f76d8ULL, 0xb4cf3c1873f6571aULL, 0x6aed00218b9218ffULL,
+     0xa55b74eaa0c9dde9ULL, 0x59b952125b4c8fccULL, 0xbc9873ea4ddc367bULL, 0x26b369ba0fd30421ULL, 0x71763a45e446f4fcULL, 0x67e800edaff54707ULL},
+    {0xe033daefd5a89943ULL, 0x67c9b548188dbedbULL, 0x868303abb8747e42ULL, 0x729b7a9e77312d96ULL, 0x0c0d9167b93e21e4ULL, 0x4d0f217714810764ULL,
+     0x67e44da004740d00ULL, 0xc4ca818618ea09a6ULL, 0xd71ee204522b7dceULL, 0xab5c85894d8bb50fULL, 0xb763ae0326a4b70fULL, 0x5d4c1773e1994a84ULL},
+    {0x96ba92c0031b74e9ULL, 0x831ce7c1d123eddcULL, 0xb2ffb2003c0078a5ULL, 0xdd5972cb4fd0d649ULL, 0x4223f82107dad83aULL, 0xe60a28a098b0f449ULL,
+     0x9b7bf367f7efcd24ULL, 0xeac2694b4fe364e7ULL, 0xd554bfbd49126327ULL, 0x7334b1965f73babfULL, 0x905695b13351fb30ULL, 0x6fb668b0a9f0900bULL},
+    {0xcfafc92c03f6f1b8ULL, 0xcf78efca9211d455ULL, 0x6c61975813d429e5ULL, 0xd2a7041afac4fafcULL, 0x481af0d7210f5a9bULL, 0xc250158672395686ULL,
+     0x14030869f0d5a9fdULL, 0xa1bbd02e2ba976d9ULL, 0xa3e75a702eea5689ULL, 0xecad50cc94f95fa6ULL, 0xee3a1b2553318033ULL, 0xbc9c1b8cf2c34cfbULL},
+    {0xead6164dd0d6c728ULL, 0xf588222e287dbb53ULL, 0xed8773eb226900dfULL, 0xecdddc8fa61f4f30ULL, 0xeb2df42a689ebec2ULL, 0x470b21c867bf2324ULL,
+     0x7e5e07d174e61aafULL, 0x12e658088216fe8dULL, 0x3f8c5fad88ed3afbULL, 0x7b26d5ddfabe64d2ULL, 0xa8ea82292c9677faULL, 0x4056e75f45cd4332ULL},
+    {0x1389742321a73d15ULL, 0xdcc0993cf495706bULL, 0x00da5e1a5a10ef8bULL, 0xc5dd7e7efb3375baULL, 0x4ae31a8cb02eef0aULL, 0xf6efd563220af80fULL,
+     0x269c8a1384fc44f9ULL, 0x0b3963730da9f27dULL, 0x630723d1ada2f003ULL, 0x966276cf34553f9bULL, 0x149be81a026dac21ULL, 0xa0e1bf62a2172d3eULL},
+    {0x93b548b2e4d389deULL, 0x4fe4ce90764cc6aeULL, 0x77008d6553c22eebULL, 0x644f7cea2709a307ULL, 0x3b0e2019c63658abULL, 0x359c4fc780161d93ULL,
+     0xf207e9046b0ebda1ULL, 0x8e5b6af7974af5abULL, 0xb1e94a7cec502ed9ULL, 0x37f2aad79bd9bb14ULL, 0xe1a9093f014399cfULL, 0x1fcafbaf449d5785ULL},
+    {0x0c81f7fa061d420eULL, 0x8cc6f2b565969c29ULL, 0xc1bc48a24dc4623aULL, 0x5b0ee775473400b6ULL, 0x086b1423624e4148ULL, 0x00e475bacd4ec954ULL,
+     0x7dd3e60bf0c22a61ULL, 0x482c940b4c2fe6d6ULL, 0xbb6ff1af905089c8ULL, 0x84cad1b7725c8966ULL, 0x14a6adbff412b9c0ULL, 0x3be574f431dd4a1aULL},
+    {0xae05eb624dea0be5ULL, 0x06a1fb57e1b9c9aeULL, 0xa53161d9b6cdba28ULL, 0x8b507d00bea1c180ULL, 0xa2b994ee30ff628eULL, 0x352d6e5271b9c5d2ULL,
+     0xaf96aeeb91e22811ULL, 0x1db6642473453a1dULL, 0xe22471e9288688c9ULL, 0x3a287e0b1dd8795aULL, 0xa9619e3e29b64472ULL, 0xbf487a363beb86ffULL},
+    {0x3b650be88b3336e2ULL, 0x3f65a5a11c985b68ULL, 0x8e444bf7132cebc5ULL, 0xb0e08b9964ab3bd6ULL, 0x14a3a5a599f2c520ULL, 0x364d3bef8e64eeb5ULL,
+     0x712ed8a642cc27d9ULL, 0x507ef18ee9726ae7ULL, 0x36cc87f7a2e0c118ULL, 0x064498ecd32dfbb4ULL, 0x0fa9e8a6c414a167ULL, 0x6c53612a2617f17dULL},
+    {0x5e95b282102b57dbULL, 0x15022ecc0b205417ULL, 0xa8e0c53e1fcaadadULL, 0xffe7ab0f07647dc6ULL, 0x0651bdfecefd2cddULL, 0xcbe36daa5a4cce6aULL,
+     0xa10164495db3249dULL, 0xf2f4d54060e80b3bULL, 0x0e942ccaff0cc862ULL, 0x465cdcf8ce878606ULL, 0xf6fe78525274c080ULL, 0x51044c96412518c8ULL},
+    {0x5e6796d4684150a4ULL, 0xfe9dcc6bed3bb9c3ULL, 0x8964663608460efaULL, 0x15ac766dc599e907ULL, 0x8d9ff46c3aa1ccb7ULL, 0x4db95a94ca8aad65ULL,
+     0x2bee16d1a201d7eeULL, 0x14c3a1e89f32ff36ULL, 0xfe90bb411d821001ULL, 0x61617a4e2ff1b7d3ULL, 0x4b78b002a4d3d81dULL, 0x47e6f8d2a57c9d6fULL},
+    {0x32569bf82fc7c47bULL, 0xc18a81df77e93fb3ULL, 0xbe4293b9bca0d191ULL, 0xde504b3316836363ULL, 0xf47876ccee20c433ULL, 0x5201f3922c50b155ULL,
+     0x078f58eb5c4f8d93ULL, 0x0329931ae6034b83ULL, 0xbcd436442532b1b9ULL, 0xbad89a04f09a2d57ULL, 0x79dd14c0828c82f2ULL, 0xf38ae2270ea65a01ULL},
+    {0x337fd83c4ce9ba66ULL, 0x2dbe82ebb1ea75e8ULL, 0xce776cb84eccbbcbULL, 0xb79e4e825552f4e0ULL, 0x613f861d97e6ebddULL, 0x979701f07f7d5a70ULL,
+     0x63ffb98f9f9b2f43ULL, 0x2a38e49eadcaa507ULL, 0x4023df80b0b68e3bULL, 0xa3e7c6f9f10485c8ULL, 0xbb7efa240d86a100ULL, 0xa9a98dc63f91d963ULL},
+    {0x139634a8fb419bebULL, 0x017d6c0100447e23ULL, 0x5f7fd641dcce6faeULL, 0xdf398f853cea368fULL, 0x8a269a69dc278586ULL, 0x5fc31c6815d65bbfULL,
+     0x4a36d394c15d8f09ULL, 0x3c813d5c20488519ULL, 0xb6cf3482e37ac8cbULL, 0x4adeb6ab5157b6d6ULL, 0x738c818e1c446de6ULL, 0x5e883d1641c0a3cbULL},
+    {0xa5c6179cb40ad245ULL, 0xc2894fe99262101cULL, 0xe0371697579a6220ULL, 0x0f8185b4ff7b778bULL, 0xbe21e671be6fb383ULL, 0x1e287fb2749a428bULL,
+     0xbaafc31a89c43321ULL, 0x405eca179125150cULL, 0x813c22471d262ca7ULL, 0x0fcbc4c307b41134ULL, 0x1f75d2746008a16bULL, 0xb0be757685b2ec84ULL},
+    {0x35c91e4e8c94df4bULL, 0xde62f00a49c1b9aaULL, 0xf9c9e9090797c373ULL, 0xd92caefe748715dbULL, 0xc8f5ddb2cb45a6c8ULL, 0xb9201182bfeb9a12ULL,
+     0x50e6daedc49b14a8ULL, 0x843892ddb9182bf0ULL, 0x8be7b5db5c67feb3ULL, 0x7d9c9262850d0ba2ULL, 0x94f070fb6430b5a8ULL, 0xf3be86e82d7e9124ULL}
+  }
+};
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+#
+# gen_ecv_table.py -- Generates ecv_table.h for ecv.c
+#
+# Copyright 2022, Laurence Lundblade
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# See BSD-3-Clause license in README.md
+#
+# Run as:
+#
+#   python3 gen_ecv_table.py > ecv_table.h
+#
+# For each curve, entry [j][i] is the affine point
+# (2 * i + 1) * 2^(L * j) * G where L is a quarter of the bit size of
+# the curve. x and y are in Montgomery form (times 2^(64 * limbs) mod
+# p) as little-endian 64-bit limbs. These are the odd multiples a
+# width-7 wNAF needs for each of the four pieces a scalar is split
+# into.
+
+CURVES = [
+    ("p256", 4,
+     2**256 - 2**224 + 2**192 + 2**96 - 1,
+     0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5),
+    ("p384", 6,
+     2**384 - 2**128 - 2**96 + 2**32 - 1,
+     0xAA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7,
+     0x3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F),
+]
+
+SPLITS = 4
+POINTS = 32
+
+
+def add(p, a, b):
+    if a is None:
+        return b
+    if a[0] == b[0]:
+        if (a[1] + b[1]) % p == 0:
+            return None
+        slope = (3 * a[0] * a[0] - 3) * pow(2 * a[1], p - 2, p) % p
+    else:
+        slope = (b[1] - a[1]) * pow(b[0] - a[0], p - 2, p) % p
+    x = (slope * slope - a[0] - b[0]) % p
+    return (x, (slope * (a[0] - x) - a[1]) % p)
+
+
+def limbs(p, n, v):
+    v = v * 2**(64 * n) % p
+    return ", ".join("0x%016xULL" % ((v >> (64 * i)) & (2**64 - 1))
+                     for i in range(n))
+
+
+def main():
+    print("/*")
+    print(" * ecv_table.h -- Generated by gen_ecv_table.py. Do not edit.")
+    print(" *")
+    print(" * Copyright 2022, Laurence Lundblade")
+    print(" *")
+    print(" * SPDX-License-Identifier: BSD-3-Clause")
+    print(" *")
+    print(" * See BSD-3-Clause license in README.md")
+    print(" *")
+    print(" * ecv_xxx_g_table[j][i] is (2 * i + 1) * 2^(L * j) * G in affine")
+    print(" * coordinates, x then y, Montgomery form, little-endian limbs.")
+    print(" * L is 64 for P-256 and 96 for P-384.")
+    print(" */")
+    for name, n, p, gx, gy in CURVES:
+        split_bits = 64 * n // SPLITS
+        print()
+        print("static const uint64_t ecv_%s_g_table[%d][%d][%d] = {"
+              % (name, SPLITS, POINTS, 2 * n))
+        base = (gx, gy)
+        for j in range(SPLITS):
+            print("  {")
+            double = add(p, base, base)
+            point = base
+            for i in range(POINTS):
+                print("    {%s," % limbs(p, n, point[0]))
+                print("     %s}%s" % (limbs(p, n, point[1]),
+                                      "," if i < POINTS - 1 else ""))
+                point = add(p, point, double)
+            print("  }%s" % ("," if j < SPLITS - 1 else ""))
+            for _ in range(split_bits):
+                base = add(p, base, base)
+        print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+#
+# gen_p256_table.py -- Generates p256_table.h for p256.c
+#
+# Copyright 2022, Laurence Lundblade
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# See BSD-3-Clause license in README.md
+#
+# Run as:
+#
+#   python3 gen_p256_table.py > p256_table.h
+#
+# Entry [i][j] is the affine point (j + 1) * 2^(5 * i) * G with x and y
+# in Montgomery form (times 2^256 mod p) as four little-endian 64-bit
+# limbs each. There's one row of 16 for each of the 52 signed 5-bit
+# windows of a scalar.
+
+P = 2**256 - 2**224 + 2**192 + 2**96 - 1
+GX = 0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+GY = 0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+
+WINDOWS = 52
+WINDOW_BITS = 5
+ENTRIES = 16
+
+
+def add(a, b):
+    if a is None:
+        return b
+    if a[0] == b[0]:
+        if (a[1] + b[1]) % P == 0:
+            return None
+        slope = (3 * a[0] * a[0] - 3) * pow(2 * a[1], P - 2, P) % P
+    else:
+        slope = (b[1] - a[1]) * pow(b[0] - a[0], P - 2, P) % P
+    x = (slope * slope - a[0] - b[0]) % P
+    return (x, (slope * (a[0] - x) - a[1]) % P)
+
+
+def limbs(v):
+    v = v * 2**256 % P
+    return ", ".join("0x%016xULL" % ((v >> (64 * i)) & (2**64 - 1))
+                     for i in range(4))
+
+
+def main():
+    print("/*")
+    print(" * p256_table.h -- Generated by gen_p256_table.py. Do not edit.")
+    print(" *")
+    print(" * Copyright 2022, Laurence Lundblade")
+    print(" *")
+    print(" * SPDX-License-Identifier: BSD-3-Clause")
+    print(" *")
+    print(" * See BSD-3-Clause license in README.md")
+    print(" *")
+    print(" * p256_base_table[i][j] is (j + 1) * 2^(%d * i) * G in affine"
+          % WINDOW_BITS)
+    print(" * coordinates, x then y, Montgomery form, little-endian limbs.")
+    print(" */")
+    print()
+    print("static const uint64_t p256_base_table[%d][%d][8] = {"
+          % (WINDOWS, ENTRIES))
+    base = (GX, GY)
+    for i in range(WINDOWS):
+        print("  {")
+        point = None
+        for j in range(ENTRIES):
+            point = add(point, base)
+            print("    {%s," % limbs(point[0]))
+            print("     %s}%s" % (limbs(point[1]),
+                                  "," if j < ENTRIES - 1 else ""))
+        print("  }%s" % ("," if i < WINDOWS - 1 else ""))
+        for _ in range(WINDOW_BITS):
+            base = add(base, base)
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,1599 @@
+/*
+ * p256.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "p256.h"
+#include <string.h>
+
+#ifndef P256_NO_OS_RANDOM
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/random.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || \
+      defined(__OpenBSD__) || defined(__NetBSD__)
+#include <stdlib.h>
+#else
+#define P256_NO_OS_RANDOM
+#endif
+#endif /* P256_NO_OS_RANDOM */
+
+#include "p256_table.h"
+
+
+/*
+ * Field elements mod p and scalars mod n are four 64-bit limbs, least
+ * significant first. Field elements are always in Montgomery form
+ * (times 2^256 mod p). Scalars are in normal form except where noted.
+ *
+ * Nothing here branches on or indexes memory with secret data except
+ * where noted for verification, which only uses public values.
+ */
+
+
+/* ---- 64-bit limb primitives ---- */
+
+#if defined(__SIZEOF_INT128__) && !defined(P256_NO_INT128)
+__extension__ typedef unsigned __int128 p256_uint128;
+
+/* Returns the low half of a * b + c + d and puts the high half in *hi */
+static inline uint64_t mac64(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t *hi)
+{
+    p256_uint128 t = (p256_uint128)a * b + c + d;
+
+    *hi = (uint64_t)(t >> 64);
+    return (uint64_t)t;
+}
+#else
+static inline uint64_t mac64(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t *hi)
+{
+    uint64_t p0, p1, p2, p3, mid, lo;
+
+    p0 = (a & 0xffffffff) * (b & 0xffffffff);
+    p1 = (a & 0xffffffff) * (b >> 32);
+    p2 = (a >> 32) * (b & 0xffffffff);
+    p3 = (a >> 32) * (b >> 32);
+
+    mid = (p0 >> 32) + (p1 & 0xffffffff) + (p2 & 0xffffffff);
+    lo  = (p0 & 0xffffffff) | (mid << 32);
+    p3 += (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+
+    lo += c;
+    p3 += lo < c;
+    lo += d;
+    p3 += lo < d;
+
+    *hi = p3;
+    return lo;
+}
+#endif
+
+
+/* a + b + carry_in; carry in and out are 0 or 1 */
+static inline uint64_t adc64(uint64_t a, uint64_t b, uint64_t carry_in, uint64_t *carry_out)
+{
+    uint64_t s = a + carry_in;
+    uint64_t c = s < carry_in;
+
+    s += b;
+    *carry_out = c | (s < b);
+    return s;
+}
+
+
+/* a - b - borrow_in; borrow in and out are 0 or 1 */
+static inline uint64_t sbb64(uint64_t a, uint64_t b, uint64_t borrow_in, uint64_t *borrow_out)
+{
+    uint64_t d = a - b;
+    uint64_t c = a < b;
+
+    *borrow_out = c | (d < borrow_in);
+    return d - borrow_in;
+}
+
+
+/* ---- Multi-precision arithmetic mod a 256-bit modulus ---- */
+
+static const uint64_t p256_p[4] = {
+    0xffffffffffffffffULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL
+};
+
+static const uint64_t p256_n[4] = {
+    0xf3b9cac2fc632551ULL, 0xbce6faada7179e84ULL, 0xffffffffffffffffULL, 0xffffffff00000000ULL
+};
+
+/* -n^-1 mod 2^64 for Montgomery reduction */
+#define P256_N_M0INV 0xccd1c8aaee00bc4fULL
+
+/* 2^512 mod p and mod n, to convert into Montgomery form */
+static const uint64_t p256_rr_p[4] = {
+    0x0000000000000003ULL, 0xfffffffbffffffffULL, 0xfffffffffffffffeULL, 0x00000004fffffffdULL
+};
+
+static const uint64_t p256_rr_n[4] = {
+    0x83244c95be79eea2ULL, 0x4699799c49bd6fa6ULL, 0x2845b2392b6bec59ULL, 0x66e12d94f3d95620ULL
+};
+
+/* 1 in Montgomery form, 2^256 mod p and mod n */
+static const uint64_t p256_one_p[4] = {
+    0x0000000000000001ULL, 0xffffffff00000000ULL, 0xffffffffffffffffULL, 0x00000000fffffffeULL
+};
+
+static const uint64_t p256_one_n[4] = {
+    0x0c46353d039cdaafULL, 0x4319055258e8617bULL, 0x0000000000000000ULL, 0x00000000ffffffffULL
+};
+
+/* The curve constant b in Montgomery form */
+static const uint64_t p256_b[4] = {
+    0xd89cdf6229c4bddfULL, 0xacf005cd78843090ULL, 0xe5a220abf7212ed6ULL, 0xdc30061d04874834ULL
+};
+
+/* Exponents for inversion by Fermat's little theorem */
+static const uint64_t p256_p_minus_2[4] = {
+    0xfffffffffffffffdULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL
+};
+
+static const uint64_t p256_n_minus_2[4] = {
+    0xf3b9cac2fc63254fULL, 0xbce6faada7179e84ULL, 0xffffffffffffffffULL, 0xffffffff00000000ULL
+};
+
+static const uint64_t p256_plain_one[4] = {1, 0, 0, 0};
+
+static const uint64_t p256_zero[4] = {0, 0, 0, 0};
+
+
+/* Selects a where mask is all ones and leaves r where it is zero */
+static inline void cmov(uint64_t r[4], const uint64_t a[4], uint64_t mask)
+{
+    int i;
+
+    for(i = 0; i < 4; i++) {
+        r[i] = (r[i] & ~mask) | (a[i] & mask);
+    }
+}
+
+
+/* All ones if a is zero, otherwise zero */
+static inline uint64_t is_zero_mask(const uint64_t a[4])
+{
+    uint64_t z = a[0] | a[1] | a[2] | a[3];
+
+    return ((z | (0 - z)) >> 63) - 1;
+}
+
+
+/* 1 if a < m, otherwise 0 */
+static inline uint64_t less_than(const uint64_t a[4], const uint64_t m[4])
+{
+    uint64_t borrow = 0;
+    int      i;
+
+    for(i = 0; i < 4; i++) {
+        (void)sbb64(a[i], m[i], borrow, &borrow);
+    }
+    return borrow;
+}
+
+
+/* r = a mod m for a < 2m */
+static inline void reduce_once(uint64_t r[4], const uint64_t a[4], const uint64_t m[4])
+{
+    uint64_t t[4];
+    uint64_t borrow = 0;
+    int      i;
+
+    for(i = 0; i < 4; i++) {
+        t[i] = sbb64(a[i], m[i], borrow, &borrow);
+    }
+    for(i = 0; i < 4; i++) {
+        r[i] = a[i];
+    }
+    cmov(r, t, borrow - 1);
+}
+
+
+/* r = a + b mod m */
+static inline void mod_add(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4])
+{
+    uint64_t t[4];
+    uint64_t s[4];
+    uint64_t carry = 0;
+    uint64_t borrow = 0;
+    int      i;
+
+    for(i = 0; i < 4; i++) {
+        t[i] = adc64(a[i], b[i], carry, &carry);
+    }
+    for(i = 0; i < 4; i++) {
+        s[i] = sbb64(t[i], m[i], borrow, &borrow);
+    }
+    /* Keep t only if there was no carry out and subtracting m borrowed */
+    (void)sbb64(carry, 0, borrow, &borrow);
+    for(i = 0; i < 4; i++) {
+        r[i] = s[i];
+    }
+    cmov(r, t, 0 - borrow);
+}
+
+
+/* r = a - b mod m */
+static inline void mod_sub(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4])
+{
+    uint64_t mask;
+    uint64_t borrow = 0;
+    uint64_t carry = 0;
+    int      i;
+
+    for(i = 0; i < 4; i++) {
+        r[i] = sbb64(a[i], b[i], borrow, &borrow);
+    }
+    mask = 0 - borrow;
+    for(i = 0; i < 4; i++) {
+        r[i] = adc64(r[i], m[i] & mask, carry, &carry);
+    }
+}
+
+
+/*
+ * r = a * b / 2^256 mod m by word-by-word Montgomery multiplication
+ * (CIOS). a and b must be less than m. r may alias a or b.
+ */
+static void mont_mul(uint64_t       r[4],
+                     const uint64_t a[4],
+                     const uint64_t b[4],
+                     const uint64_t m[4],
+                     uint64_t       m0inv)
+{
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5;
+    uint64_t c, u, borrow;
+    uint64_t s[4];
+    uint64_t t[4];
+    int      i;
+
+    for(i = 0; i < 4; i++) {
+        t0 = mac64(a[i], b[0], t0, 0, &c);
+        t1 = mac64(a[i], b[1], t1, c, &c);
+        t2 = mac64(a[i], b[2], t2, c, &c);
+        t3 = mac64(a[i], b[3], t3, c, &c);
+        t4 = adc64(t4, c, 0, &t5);
+
+        u = t0 * m0inv;
+        (void)mac64(u, m[0], t0, 0, &c);
+        t0 = mac64(u, m[1], t1, c, &c);
+        t1 = mac64(u, m[2], t2, c, &c);
+        t2 = mac64(u, m[3], t3, c, &c);
+        t3 = adc64(t4, c, 0, &c);
+        t4 = t5 + c;
+    }
+
+    /* The result is less than 2m, so subtract m once if it's >= m */
+    t[0] = t0; t[1] = t1; t[2] = t2; t[3] = t3;
+    borrow = 0;
+    for(i = 0; i < 4; i++) {
+        s[i] = sbb64(t[i], m[i], borrow, &borrow);
+    }
+    (void)sbb64(t4, 0, borrow, &borrow);
+    for(i = 0; i < 4; i++) {
+        r[i] = s[i];
+    }
+    cmov(r, t, 0 - borrow);
+}
+
+
+/*
+ * r = a^e in Montgomery form, where a is in Montgomery form. The
+ * exponent is public so this branches on it.
+ */
+static void mont_pow(uint64_t       r[4],
+                     const uint64_t a[4],
+                     const uint64_t e[4],
+                     const uint64_t m[4],
+                     uint64_t       m0inv,
+                     const uint64_t one[4])
+{
+    uint64_t acc[4];
+    int      i;
+
+    memcpy(acc, one, sizeof(acc));
+    for(i = 255; i >= 0; i--) {
+        mont_mul(acc, acc, acc, m, m0inv);
+        if((e[i / 64] >> (i % 64)) & 1) {
+            mont_mul(acc, acc, a, m, m0inv);
+        }
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+
+/* ---- Field mod p ---- */
+
+/*
+ * r = a * b / 2^256 mod p. The full product then Montgomery reduction
+ * using the shape of p: -p^-1 mod 2^64 is 1 so the multiplier is just
+ * the low limb, and p[0] + p[1] * 2^64 = 2^96 - 1 so only p[3] needs
+ * a multiply.
+ */
+static void fe_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    uint64_t t[8];
+    uint64_t s[4];
+    uint64_t c, hi, lo, u, top, borrow;
+    int      i, j;
+
+    /* 512-bit product */
+    t[0] = mac64(a[0], b[0], 0, 0, &c);
+    t[1] = mac64(a[0], b[1], 0, c, &c);
+    t[2] = mac64(a[0], b[2], 0, c, &c);
+    t[3] = mac64(a[0], b[3], 0, c, &c);
+    t[4] = c;
+    for(i = 1; i < 4; i++) {
+        t[i]     = mac64(a[i], b[0], t[i], 0, &c);
+        t[i + 1] = mac64(a[i], b[1], t[i + 1], c, &c);
+        t[i + 2] = mac64(a[i], b[2], t[i + 2], c, &c);
+        t[i + 3] = mac64(a[i], b[3], t[i + 3], c, &c);
+        t[i + 4] = c;
+    }
+
+    top = 0;
+    for(i = 0; i < 4; i++) {
+        u = t[i];
+        t[i + 1] = adc64(t[i + 1], u << 32, 0, &c);
+        t[i + 2] = adc64(t[i + 2], u >> 32, c, &c);
+        lo = mac64(u, 0xffffffff00000001ULL, 0, 0, &hi);
+        t[i + 3] = adc64(t[i + 3], lo, c, &c);
+        t[i + 4] = adc64(t[i + 4], hi, c, &c);
+        for(j = i + 5; j < 8; j++) {
+            t[j] = adc64(t[j], 0, c, &c);
+        }
+        top += c;
+    }
+
+    borrow = 0;
+    for(i = 0; i < 4; i++) {
+        s[i] = sbb64(t[i + 4], p256_p[i], borrow, &borrow);
+    }
+    (void)sbb64(top, 0, borrow, &borrow);
+    for(i = 0; i < 4; i++) {
+        r[i] = s[i];
+    }
+    cmov(r, &t[4], 0 - borrow);
+}
+
+static inline void fe_add(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mod_add(r, a, b, p256_p);
+}
+
+static inline void fe_sub(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mod_sub(r, a, b, p256_p);
+}
+
+/* r = a^(p - 2) = a^-1. The exponent is public so this branches on it. */
+static void fe_inv(uint64_t r[4], const uint64_t a[4])
+{
+    uint64_t acc[4];
+    int      i;
+
+    memcpy(acc, p256_one_p, sizeof(acc));
+    for(i = 255; i >= 0; i--) {
+        fe_mul(acc, acc, acc);
+        if((p256_p_minus_2[i / 64] >> (i % 64)) & 1) {
+            fe_mul(acc, acc, a);
+        }
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+
+/* ---- Scalars mod n ---- */
+
+static inline void sc_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mont_mul(r, a, b, p256_n, P256_N_M0INV);
+}
+
+/* r = a^-1 in Montgomery form for a in Montgomery form */
+static inline void sc_inv(uint64_t r[4], const uint64_t a[4])
+{
+    mont_pow(r, a, p256_n_minus_2, p256_n, P256_N_M0INV, p256_one_n);
+}
+
+
+/* ---- Encoding ---- */
+
+static void bytes_to_limbs(uint64_t r[4], const uint8_t *bytes)
+{
+    int i;
+    int j;
+
+    for(i = 0; i < 4; i++) {
+        r[3 - i] = 0;
+        for(j = 0; j < 8; j++) {
+            r[3 - i] = (r[3 - i] << 8) | bytes[i * 8 + j];
+        }
+    }
+}
+
+static void limbs_to_bytes(uint8_t *bytes, const uint64_t a[4])
+{
+    int i;
+    int j;
+
+    for(i = 0; i < 4; i++) {
+        for(j = 0; j < 8; j++) {
+            bytes[i * 8 + j] = (uint8_t)(a[3 - i] >> (56 - 8 * j));
+        }
+    }
+}
+
+
+/* Converts a hash to a scalar as ECDSA does: the leftmost 256 bits
+ * reduced mod n */
+static void hash_to_scalar(uint64_t e[4], const uint8_t *hash, size_t hash_len)
+{
+    uint8_t padded[32];
+
+    if(hash_len >= sizeof(padded)) {
+        memcpy(padded, hash, sizeof(padded));
+    } else {
+        memset(padded, 0, sizeof(padded) - hash_len);
+        memcpy(padded + sizeof(padded) - hash_len, hash, hash_len);
+    }
+    bytes_to_limbs(e, padded);
+    reduce_once(e, e, p256_n);
+}
+
+
+/* Zeroing that the compiler won't drop */
+static void wipe(void *buf, size_t len)
+{
+    volatile uint8_t *p = (volatile uint8_t *)buf;
+
+    while(len--) {
+        *p++ = 0;
+    }
+}
+
+
+/* ---- Points ---- */
+
+/* Projective (X : Y : Z) with x = X/Z and y = Y/Z. The identity is
+ * (0 : 1 : 0). */
+struct p256_point {
+    uint64_t x[4];
+    uint64_t y[4];
+    uint64_t z[4];
+};
+
+
+static void point_set_identity(struct p256_point *r)
+{
+    memset(r->x, 0, sizeof(r->x));
+    memcpy(r->y, p256_one_p, sizeof(r->y));
+    memset(r->z, 0, sizeof(r->z));
+}
+
+
+static void point_cmov(struct p256_point *r, const struct p256_point *a, uint64_t mask)
+{
+    cmov(r->x, a->x, mask);
+    cmov(r->y, a->y, mask);
+    cmov(r->z, a->z, mask);
+}
+
+
+/*
+ * r = a + b. Algorithm 4 of Renes, Costello and Batina, "Complete
+ * addition formulas for prime order elliptic curves", 2015, for
+ * a = -3. Works for all inputs including doubling and the identity.
+ */
+static void point_add(struct p256_point       *r,
+                      const struct p256_point *a,
+                      const struct p256_point *b)
+{
+    uint64_t t0[4], t1[4], t2[4], t3[4], t4[4];
+    uint64_t x3[4], y3[4], z3[4];
+
+    fe_mul(t0, a->x, b->x);
+    fe_mul(t1, a->y, b->y);
+    fe_mul(t2, a->z, b->z);
+    fe_add(t3, a->x, a->y);
+    fe_add(t4, b->x, b->y);
+    fe_mul(t3, t3, t4);
+    fe_add(t4, t0, t1);
+    fe_sub(t3, t3, t4);
+    fe_add(t4, a->y, a->z);
+    fe_add(x3, b->y, b->z);
+    fe_mul(t4, t4, x3);
+    fe_add(x3, t1, t2);
+    fe_sub(t4, t4, x3);
+    fe_add(x3, a->x, a->z);
+    fe_add(y3, b->x, b->z);
+    fe_mul(x3, x3, y3);
+    fe_add(y3, t0, t2);
+    fe_sub(y3, x3, y3);
+    fe_mul(z3, p256_b, t2);
+    fe_sub(x3, y3, z3);
+    fe_add(z3, x3, x3);
+    fe_add(x3, x3, z3);
+    fe_sub(z3, t1, x3);
+    fe_add(x3, t1, x3);
+    fe_mul(y3, p256_b, y3);
+    fe_add(t1, t2, t2);
+    fe_add(t2, t1, t2);
+    fe_sub(y3, y3, t2);
+    fe_sub(y3, y3, t0);
+    fe_add(t1, y3, y3);
+    fe_add(y3, t1, y3);
+    fe_add(t1, t0, t0);
+    fe_add(t0, t1, t0);
+    fe_sub(t0, t0, t2);
+    fe_mul(t1, t4, y3);
+    fe_mul(t2, t0, y3);
+    fe_mul(y3, x3, z3);
+    fe_add(y3, y3, t2);
+    fe_mul(x3, t3, x3);
+    fe_sub(x3, x3, t1);
+    fe_mul(z3, t4, z3);
+    fe_mul(t1, t3, t0);
+    fe_add(z3, z3, t1);
+
+    memcpy(r->x, x3, sizeof(x3));
+    memcpy(r->y, y3, sizeof(y3));
+    memcpy(r->z, z3, sizeof(z3));
+}
+
+
+/*
+ * r = a + (bx, by) where the second point is affine and not the
+ * identity. Algorithm 5 of Renes, Costello and Batina.
+ */
+static void point_add_affine(struct p256_point       *r,
+                             const struct p256_point *a,
+                             const uint64_t           bx[4],
+                             const uint64_t           by[4])
+{
+    uint64_t t0[4], t1[4], t2[4], t3[4], t4[4];
+    uint64_t x3[4], y3[4], z3[4];
+
+    fe_mul(t0, a->x, bx);
+    fe_mul(t1, a->y, by);
+    fe_add(t3, bx, by);
+    fe_add(t4, a->x, a->y);
+    fe_mul(t3, t3, t4);
+    fe_add(t4, t0, t1);
+    fe_sub(t3, t3, t4);
+    fe_mul(t4, by, a->z);
+    fe_add(t4, t4, a->y);
+    fe_mul(y3, bx, a->z);
+    fe_add(y3, y3, a->x);
+    fe_mul(z3, p256_b, a->z);
+    fe_sub(x3, y3, z3);
+    fe_add(z3, x3, x3);
+    fe_add(x3, x3, z3);
+    fe_sub(z3, t1, x3);
+    fe_add(x3, t1, x3);
+    fe_mul(y3, p256_b, y3);
+    fe_add(t1, a->z, a->z);
+    fe_add(t2, t1, a->z);
+    fe_sub(y3, y3, t2);
+    fe_sub(y3, y3, t0);
+    fe_add(t1, y3, y3);
+    fe_add(y3, t1, y3);
+    fe_add(t1, t0, t0);
+    fe_add(t0, t1, t0);
+    fe_sub(t0, t0, t2);
+    fe_mul(t1, t4, y3);
+    fe_mul(t2, t0, y3);
+    fe_mul(y3, x3, z3);
+    fe_add(y3, y3, t2);
+    fe_mul(x3, t3, x3);
+    fe_sub(x3, x3, t1);
+    fe_mul(z3, t4, z3);
+    fe_mul(t1, t3, t0);
+    fe_add(z3, z3, t1);
+
+    memcpy(r->x, x3, sizeof(x3));
+    memcpy(r->y, y3, sizeof(y3));
+    memcpy(r->z, z3, sizeof(z3));
+}
+
+
+/* r = 2a. Algorithm 6 of Renes, Costello and Batina. */
+static void point_double(struct p256_point *r, const struct p256_point *a)
+{
+    uint64_t t0[4], t1[4], t2[4], t3[4];
+    uint64_t x3[4], y3[4], z3[4];
+
+    fe_mul(t0, a->x, a->x);
+    fe_mul(t1, a->y, a->y);
+    fe_mul(t2, a->z, a->z);
+    fe_mul(t3, a->x, a->y);
+    fe_add(t3, t3, t3);
+    fe_mul(z3, a->x, a->z);
+    fe_add(z3, z3, z3);
+    fe_mul(y3, p256_b, t2);
+    fe_sub(y3, y3, z3);
+    fe_add(x3, y3, y3);
+    fe_add(y3, x3, y3);
+    fe_sub(x3, t1, y3);
+    fe_add(y3, t1, y3);
+    fe_mul(y3, x3, y3);
+    fe_mul(x3, x3, t3);
+    fe_add(t3, t2, t2);
+    fe_add(t2, t2, t3);
+    fe_mul(z3, p256_b, z3);
+    fe_sub(z3, z3, t2);
+    fe_sub(z3, z3, t0);
+    fe_add(t3, z3, z3);
+    fe_add(z3, z3, t3);
+    fe_add(t3, t0, t0);
+    fe_add(t0, t3, t0);
+    fe_sub(t0, t0, t2);
+    fe_mul(t0, t0, z3);
+    fe_add(y3, y3, t0);
+    fe_mul(t0, a->y, a->z);
+    fe_add(t0, t0, t0);
+    fe_mul(z3, t0, z3);
+    fe_sub(x3, x3, z3);
+    fe_mul(z3, t0, t1);
+    fe_add(z3, z3, z3);
+    fe_add(z3, z3, z3);
+
+    memcpy(r->x, x3, sizeof(x3));
+    memcpy(r->y, y3, sizeof(y3));
+    memcpy(r->z, z3, sizeof(z3));
+}
+
+
+/* Affine coordinates in Montgomery form. The identity gives (0, 0). */
+static void point_to_affine(uint64_t x[4], uint64_t y[4], const struct p256_point *a)
+{
+    uint64_t z_inverse[4];
+
+    fe_inv(z_inverse, a->z);
+    fe_mul(x, a->x, z_inverse);
+    fe_mul(y, a->y, z_inverse);
+}
+
+
+/*
+ * Signed 5-bit window recoding (Booth). in is the 5 bits of the
+ * window plus the top bit of the window below. Returns the magnitude
+ * of the digit, 0 to 16, shifted left one with the sign in bit 0.
+ */
+static inline unsigned booth_recode_w5(unsigned in)
+{
+    unsigned s, d;
+
+    s = ~((in >> 5) - 1);
+    d = (1 << 6) - in - 1;
+    d = (d & s) | (in & ~s);
+    d = (d >> 1) + (d & 1);
+
+    return (d << 1) + (s & 1);
+}
+
+
+/* Copies out entry digit - 1 of a table row, or zeros for digit 0,
+ * reading every entry */
+static void table_select(uint64_t out[8], const uint64_t row[16][8], unsigned digit)
+{
+    uint64_t mask;
+    uint64_t diff;
+    int      i;
+    int      j;
+
+    memset(out, 0, 8 * sizeof(uint64_t));
+    for(i = 0; i < 16; i++) {
+        diff = (uint64_t)((unsigned)(i + 1) ^ digit);
+        mask = ((diff | (0 - diff)) >> 63) - 1;
+        for(j = 0; j < 8; j++) {
+            out[j] |= row[i][j] & mask;
+        }
+    }
+}
+
+
+/*
+ * r = k * G in constant time. k is a scalar in normal form, less than
+ * n. With signed 5-bit digits k = sum(d_i * 2^(5i)) and the table has
+ * 1..16 times 2^(5i) * G for each i, so this is 52 additions and no
+ * doublings.
+ */
+static void base_mult(struct p256_point *r, const uint64_t k[4])
+{
+    struct p256_point acc;
+    struct p256_point sum;
+    uint64_t          entry[8];
+    uint64_t          neg_y[4];
+    uint8_t           bytes[34];
+    unsigned          window;
+    unsigned          digit;
+    unsigned          offset;
+    int               i;
+
+    for(i = 0; i < 32; i++) {
+        bytes[i] = (uint8_t)(k[i / 8] >> (8 * (i % 8)));
+    }
+    bytes[32] = bytes[33] = 0;
+
+    point_set_identity(&acc);
+    for(i = 0; i < 52; i++) {
+        if(i == 0) {
+            window = (bytes[0] << 1) & 0x3f;
+        } else {
+            offset = (unsigned)(5 * i - 1);
+            window = ((bytes[offset / 8] | (unsigned)bytes[offset / 8 + 1] << 8)
+                       >> (offset % 8)) & 0x3f;
+        }
+        digit = booth_recode_w5(window);
+
+        table_select(entry, p256_base_table[i], digit >> 1);
+        fe_sub(neg_y, p256_zero, &entry[4]);
+        cmov(&entry[4], neg_y, 0 - (uint64_t)(digit & 1));
+
+        point_add_affine(&sum, &acc, &entry[0], &entry[4]);
+        /* A zero digit selected no point; keep acc */
+        point_cmov(&acc, &sum, 0 - (((uint64_t)0 - (digit >> 1)) >> 63));
+    }
+
+    *r = acc;
+    wipe(bytes, sizeof(bytes));
+    wipe(entry, sizeof(entry));
+    wipe(&acc, sizeof(acc));
+    wipe(&sum, sizeof(sum));
+}
+
+
+/*
+ * r = k * (x, y) with 4-bit fixed windows. Not constant time; only
+ * for verification.
+ */
+static void var_mult(struct p256_point *r,
+                     const uint64_t     k[4],
+                     const uint64_t     x[4],
+                     const uint64_t     y[4])
+{
+    struct p256_point table[16];
+    struct p256_point acc;
+    unsigned          nibble;
+    int               i;
+
+    point_set_identity(&table[0]);
+    memcpy(table[1].x, x, sizeof(table[1].x));
+    memcpy(table[1].y, y, sizeof(table[1].y));
+    memcpy(table[1].z, p256_one_p, sizeof(table[1].z));
+    for(i = 2; i < 16; i++) {
+        point_add(&table[i], &table[i - 1], &table[1]);
+    }
+
+    point_set_identity(&acc);
+    for(i = 63; i >= 0; i--) {
+        point_double(&acc, &acc);
+        point_double(&acc, &acc);
+        point_double(&acc, &acc);
+        point_double(&acc, &acc);
+        nibble = (unsigned)(k[i / 16] >> (4 * (i % 16))) & 0xf;
+        if(nibble) {
+            point_add(&acc, &acc, &table[nibble]);
+        }
+    }
+    *r = acc;
+}
+
+
+/* ---- Random numbers ---- */
+
+#ifndef P256_NO_OS_RANDOM
+static int os_random(void *context, uint8_t *buf, size_t len)
+{
+    (void)context;
+
+#if defined(__linux__)
+    ssize_t got;
+
+    while(len > 0) {
+        got = getrandom(buf, len, 0);
+        if(got < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        buf += got;
+        len -= (size_t)got;
+    }
+#else
+    arc4random_buf(buf, len);
+#endif
+    return 0;
+}
+
+static p256_random_fn *random_source = os_random;
+#else
+static p256_random_fn *random_source = NULL;
+#endif /* P256_NO_OS_RANDOM */
+
+static void *random_context = NULL;
+
+
+/*
+ * Public function, see p256.h
+ */
+void p256_set_random(p256_random_fn *random_fn, void *context)
+{
+#ifndef P256_NO_OS_RANDOM
+    if(random_fn == NULL) {
+        random_fn = os_random;
+    }
+#endif
+    random_source  = random_fn;
+    random_context = context;
+}
+
+
+/* ---- Nonces ---- */
+
+/*
+ * From the nonce k computes r = x(k * G) mod n and k^-1 in Montgomery
+ * form. Returns P256_ERR_INVALID_ARG in the negligibly likely case
+ * that r is 0.
+ */
+static int nonce_from_k(const uint64_t k[4], uint64_t k_inverse[4], uint64_t r[4])
+{
+    struct p256_point kg;
+    uint64_t          x[4];
+    uint64_t          y[4];
+    uint64_t          k_mont[4];
+    int               result;
+
+    base_mult(&kg, k);
+    point_to_affine(x, y, &kg);
+    fe_mul(x, x, p256_plain_one);
+    reduce_once(r, x, p256_n);
+
+    sc_mul(k_mont, k, p256_rr_n);
+    sc_inv(k_inverse, k_mont);
+
+    result = is_zero_mask(r) ? P256_ERR_INVALID_ARG : P256_SUCCESS;
+
+    wipe(&kg, sizeof(kg));
+    wipe(x, sizeof(x));
+    wipe(k_mont, sizeof(k_mont));
+
+    return result;
+}
+
+
+/* Makes a new random nonce */
+static int make_nonce(uint64_t k_inverse[4], uint64_t r[4])
+{
+    uint8_t  k_bytes[32];
+    uint64_t k[4];
+    int      result;
+
+    if(random_source == NULL) {
+        return P256_ERR_RANDOM;
+    }
+
+    do {
+        if(random_source(random_context, k_bytes, sizeof(k_bytes))) {
+            result = P256_ERR_RANDOM;
+            break;
+        }
+        bytes_to_limbs(k, k_bytes);
+        /* Rejection sampling for 1 <= k < n. Fails about 1 in 2^32. */
+        if(is_zero_mask(k) || !less_than(k, p256_n)) {
+            result = P256_ERR_INVALID_ARG;
+            continue;
+        }
+        result = nonce_from_k(k, k_inverse, r);
+    } while(result == P256_ERR_INVALID_ARG);
+
+    wipe(k_bytes, sizeof(k_bytes));
+    wipe(k, sizeof(k));
+
+    return result;
+}
+
+
+#ifdef P256_HAVE_NONCE_POOL
+
+/* The pool is Dmitry Vyukov's bounded multi-producer, multi-consumer
+ * queue. Each slot's sequence number says whether it is ready to be
+ * filled (equal to the fill position) or taken (one more than the
+ * take position). */
+
+static int nonce_pool_put(struct p256_nonce_pool *pool,
+                          const uint64_t          k_inverse[4],
+                          const uint64_t          r[4])
+{
+    struct p256_nonce_slot *slot;
+    size_t                  position;
+    size_t                  sequence;
+    ptrdiff_t               diff;
+
+    position = __atomic_load_n(&pool->fill_position, __ATOMIC_RELAXED);
+    for(;;) {
+        slot = &pool->slots[position & pool->mask];
+        sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        diff = (ptrdiff_t)(sequence - position);
+        if(diff == 0) {
+            if(__atomic_compare_exchange_n(&pool->fill_position,
+                                           &position,
+                                           position + 1,
+                                           1,
+                                           __ATOMIC_RELAXED,
+                                           __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if(diff < 0) {
+            return -1; /* Full */
+        } else {
+            position = __atomic_load_n(&pool->fill_position, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(slot->k_inverse, k_inverse, sizeof(slot->k_inverse));
+    memcpy(slot->r, r, sizeof(slot->r));
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+
+static int nonce_pool_take(struct p256_nonce_pool *pool,
+                           uint64_t                k_inverse[4],
+                           uint64_t                r[4])
+{
+    struct p256_nonce_slot *slot;
+    size_t                  position;
+    size_t                  sequence;
+    ptrdiff_t               diff;
+
+    position = __atomic_load_n(&pool->take_position, __ATOMIC_RELAXED);
+    for(;;) {
+        slot = &pool->slots[position & pool->mask];
+        sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        diff = (ptrdiff_t)(sequence - (position + 1));
+        if(diff == 0) {
+            if(__atomic_compare_exchange_n(&pool->take_position,
+                                           &position,
+                                           position + 1,
+                                           1,
+                                           __ATOMIC_RELAXED,
+                                           __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if(diff < 0) {
+            return -1; /* Empty */
+        } else {
+            position = __atomic_load_n(&pool->take_position, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(k_inverse, slot->k_inverse, sizeof(slot->k_inverse));
+    memcpy(r, slot->r, sizeof(slot->r));
+    wipe(slot->k_inverse, sizeof(slot->k_inverse));
+    wipe(slot->r, sizeof(slot->r));
+    __atomic_store_n(&slot->sequence, position + pool->mask + 1, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+int p256_nonce_pool_init(struct p256_nonce_pool *pool,
+                         struct p256_nonce_slot *slots,
+                         size_t                  num_slots)
+{
+    size_t i;
+
+    if(num_slots < 2 || (num_slots & (num_slots - 1)) != 0) {
+        return P256_ERR_INVALID_ARG;
+    }
+
+    for(i = 0; i < num_slots; i++) {
+        memset(&slots[i], 0, sizeof(slots[i]));
+        slots[i].sequence = i;
+    }
+    pool->slots         = slots;
+    pool->mask          = num_slots - 1;
+    pool->fill_position = 0;
+    pool->take_position = 0;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    return P256_SUCCESS;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+size_t p256_nonce_pool_fill(struct p256_nonce_pool *pool, size_t max_add)
+{
+    uint64_t k_inverse[4];
+    uint64_t r[4];
+    size_t   added;
+
+    for(added = 0; added < max_add; added++) {
+        if(p256_nonce_pool_count(pool) > pool->mask) {
+            break;
+        }
+        if(make_nonce(k_inverse, r)) {
+            break;
+        }
+        if(nonce_pool_put(pool, k_inverse, r)) {
+            break; /* Another thread filled it */
+        }
+    }
+
+    wipe(k_inverse, sizeof(k_inverse));
+    wipe(r, sizeof(r));
+
+    return added;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+size_t p256_nonce_pool_count(const struct p256_nonce_pool *pool)
+{
+    size_t taken  = __atomic_load_n(&pool->take_position, __ATOMIC_RELAXED);
+    size_t filled = __atomic_load_n(&pool->fill_position, __ATOMIC_RELAXED);
+
+    return filled > taken ? filled - taken : 0;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+void p256_nonce_pool_wipe(struct p256_nonce_pool *pool)
+{
+    uint64_t k_inverse[4];
+    uint64_t r[4];
+
+    while(nonce_pool_take(pool, k_inverse, r) == 0) {
+    }
+    wipe(k_inverse, sizeof(k_inverse));
+    wipe(r, sizeof(r));
+}
+
+#endif /* P256_HAVE_NONCE_POOL */
+
+
+/* ---- Deterministic nonces (RFC 6979) ---- */
+
+/* A small SHA-256 just for HMAC_DRBG so the engine still needs no
+ * other library. It is only ever run over the private key, the hash
+ * and the DRBG state, which are all fixed size, so speed doesn't
+ * matter. */
+
+struct rfc6979_sha256 {
+    uint32_t h[8];
+    uint8_t  block[64];
+    size_t   block_len;
+    uint64_t total_len;
+};
+
+static const uint32_t rfc6979_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define RFC6979_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void rfc6979_sha256_block(struct rfc6979_sha256 *ctx)
+{
+    uint32_t w[64];
+    uint32_t a, b, c, d, e, f, g, h;
+    uint32_t t1;
+    uint32_t t2;
+    int      i;
+
+    for(i = 0; i < 16; i++) {
+        w[i] = (uint32_t)ctx->block[i * 4] << 24 |
+               (uint32_t)ctx->block[i * 4 + 1] << 16 |
+               (uint32_t)ctx->block[i * 4 + 2] << 8 |
+               (uint32_t)ctx->block[i * 4 + 3];
+    }
+    for(; i < 64; i++) {
+        w[i] = w[i - 16] + w[i - 7] +
+               (RFC6979_ROTR(w[i - 15], 7) ^ RFC6979_ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3)) +
+               (RFC6979_ROTR(w[i - 2], 17) ^ RFC6979_ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10));
+    }
+
+    a = ctx->h[0]; b = ctx->h[1]; c = ctx->h[2]; d = ctx->h[3];
+    e = ctx->h[4]; f = ctx->h[5]; g = ctx->h[6]; h = ctx->h[7];
+    for(i = 0; i < 64; i++) {
+        t1 = h + (RFC6979_ROTR(e, 6) ^ RFC6979_ROTR(e, 11) ^ RFC6979_ROTR(e, 25)) +
+             ((e & f) ^ (~e & g)) + rfc6979_sha256_k[i] + w[i];
+        t2 = (RFC6979_ROTR(a, 2) ^ RFC6979_ROTR(a, 13) ^ RFC6979_ROTR(a, 22)) +
+             ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    ctx->h[0] += a; ctx->h[1] += b; ctx->h[2] += c; ctx->h[3] += d;
+    ctx->h[4] += e; ctx->h[5] += f; ctx->h[6] += g; ctx->h[7] += h;
+
+    wipe(w, sizeof(w));
+}
+
+static void rfc6979_sha256_init(struct rfc6979_sha256 *ctx)
+{
+    static const uint32_t iv[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+
+    memcpy(ctx->h, iv, sizeof(iv));
+    ctx->block_len = 0;
+    ctx->total_len = 0;
+}
+
+static void rfc6979_sha256_update(struct rfc6979_sha256 *ctx, const uint8_t *data, size_t len)
+{
+    ctx->total_len += len;
+    while(len--) {
+        ctx->block[ctx->block_len++] = *data++;
+        if(ctx->block_len == sizeof(ctx->block)) {
+            rfc6979_sha256_block(ctx);
+            ctx->block_len = 0;
+        }
+    }
+}
+
+static void rfc6979_sha256_finish(struct rfc6979_sha256 *ctx, uint8_t digest[32])
+{
+    uint64_t bit_len = ctx->total_len * 8;
+    uint8_t  pad     = 0x80;
+    int      i;
+
+    rfc6979_sha256_update(ctx, &pad, 1);
+    pad = 0;
+    while(ctx->block_len != 56) {
+        rfc6979_sha256_update(ctx, &pad, 1);
+    }
+    for(i = 0; i < 8; i++) {
+        ctx->block[56 + i] = (uint8_t)(bit_len >> (56 - 8 * i));
+    }
+    rfc6979_sha256_block(ctx);
+
+    for(i = 0; i < 32; i++) {
+        digest[i] = (uint8_t)(ctx->h[i / 4] >> (24 - 8 * (i % 4)));
+    }
+    wipe(ctx, sizeof(*ctx));
+}
+
+
+/* HMAC-SHA-256 with a 32-byte key, fed in pieces */
+struct rfc6979_hmac {
+    struct rfc6979_sha256 inner;
+    uint8_t               key[32];
+};
+
+static void rfc6979_hmac_start(struct rfc6979_hmac *ctx, const uint8_t key[32])
+{
+    uint8_t pad[64];
+    size_t  i;
+
+    memcpy(ctx->key, key, sizeof(ctx->key));
+    memset(pad, 0x36, sizeof(pad));
+    for(i = 0; i < sizeof(ctx->key); i++) {
+        pad[i] ^= key[i];
+    }
+    rfc6979_sha256_init(&ctx->inner);
+    rfc6979_sha256_update(&ctx->inner, pad, sizeof(pad));
+    wipe(pad, sizeof(pad));
+}
+
+static void rfc6979_hmac_update(struct rfc6979_hmac *ctx, const uint8_t *data, size_t len)
+{
+    rfc6979_sha256_update(&ctx->inner, data, len);
+}
+
+static void rfc6979_hmac_finish(struct rfc6979_hmac *ctx, uint8_t mac[32])
+{
+    struct rfc6979_sha256 outer;
+    uint8_t               pad[64];
+    uint8_t               inner_digest[32];
+    size_t                i;
+
+    rfc6979_sha256_finish(&ctx->inner, inner_digest);
+
+    memset(pad, 0x5c, sizeof(pad));
+    for(i = 0; i < sizeof(ctx->key); i++) {
+        pad[i] ^= ctx->key[i];
+    }
+    rfc6979_sha256_init(&outer);
+    rfc6979_sha256_update(&outer, pad, sizeof(pad));
+    rfc6979_sha256_update(&outer, inner_digest, sizeof(inner_digest));
+    rfc6979_sha256_finish(&outer, mac);
+
+    wipe(pad, sizeof(pad));
+    wipe(inner_digest, sizeof(inner_digest));
+    wipe(ctx, sizeof(*ctx));
+}
+
+
+/* The HMAC_DRBG of RFC 6979 section 3.2 */
+struct rfc6979_drbg {
+    uint8_t k[32];
+    uint8_t v[32];
+};
+
+/* K = HMAC_K(V || separator || x || h1), V = HMAC_K(V). Without x the
+ * separator is 0x00 and there's nothing else, as in step h.3. */
+static void rfc6979_drbg_update(struct rfc6979_drbg *drbg,
+                                uint8_t              separator,
+                                const uint8_t       *x,
+                                const uint8_t       *h1)
+{
+    struct rfc6979_hmac hmac;
+
+    rfc6979_hmac_start(&hmac, drbg->k);
+    rfc6979_hmac_update(&hmac, drbg->v, sizeof(drbg->v));
+    rfc6979_hmac_update(&hmac, &separator, 1);
+    if(x != NULL) {
+        rfc6979_hmac_update(&hmac, x, 32);
+        rfc6979_hmac_update(&hmac, h1, 32);
+    }
+    rfc6979_hmac_finish(&hmac, drbg->k);
+
+    rfc6979_hmac_start(&hmac, drbg->k);
+    rfc6979_hmac_update(&hmac, drbg->v, sizeof(drbg->v));
+    rfc6979_hmac_finish(&hmac, drbg->v);
+}
+
+/* Steps b through g, seeding with the private key and the hash */
+static void rfc6979_drbg_init(struct rfc6979_drbg *drbg,
+                              const uint8_t        x[32],
+                              const uint8_t        h1[32])
+{
+    memset(drbg->v, 0x01, sizeof(drbg->v));
+    memset(drbg->k, 0x00, sizeof(drbg->k));
+    rfc6979_drbg_update(drbg, 0x00, x, h1);
+    rfc6979_drbg_update(drbg, 0x01, x, h1);
+}
+
+/* Step h: the next candidate k. Since qlen is hlen one V is T. The
+ * caller checks 1 <= k < n and calls rfc6979_drbg_update() to move
+ * on if it isn't usable. */
+static void rfc6979_drbg_next(struct rfc6979_drbg *drbg, uint64_t k[4])
+{
+    struct rfc6979_hmac hmac;
+
+    rfc6979_hmac_start(&hmac, drbg->k);
+    rfc6979_hmac_update(&hmac, drbg->v, sizeof(drbg->v));
+    rfc6979_hmac_finish(&hmac, drbg->v);
+    bytes_to_limbs(k, drbg->v);
+}
+
+
+/* ---- Keys ---- */
+
+/*
+ * Public function, see p256.h
+ */
+int p256_key_from_private(struct p256_key *key, const uint8_t *private_scalar)
+{
+    struct p256_point q;
+    uint64_t          d[4];
+    int               result;
+
+    memset(key, 0, sizeof(*key));
+
+    bytes_to_limbs(d, private_scalar);
+    if(is_zero_mask(d) || !less_than(d, p256_n)) {
+        result = P256_ERR_INVALID_KEY;
+        goto Done;
+    }
+
+    base_mult(&q, d);
+    point_to_affine(key->x, key->y, &q);
+    sc_mul(key->d, d, p256_rr_n);
+    key->has_private = 1;
+    result = P256_SUCCESS;
+
+Done:
+    wipe(d, sizeof(d));
+    wipe(&q, sizeof(q));
+    return result;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+int p256_key_from_public(struct p256_key *key, const uint8_t *point)
+{
+    uint64_t lhs[4];
+    uint64_t rhs[4];
+    uint64_t t[4];
+
+    memset(key, 0, sizeof(*key));
+
+    if(point[0] != 0x04) {
+        return P256_ERR_INVALID_KEY;
+    }
+    bytes_to_limbs(key->x, point + 1);
+    bytes_to_limbs(key->y, point + 33);
+    if(!less_than(key->x, p256_p) || !less_than(key->y, p256_p)) {
+        return P256_ERR_INVALID_KEY;
+    }
+    fe_mul(key->x, key->x, p256_rr_p);
+    fe_mul(key->y, key->y, p256_rr_p);
+
+    /* y^2 = x^3 - 3x + b */
+    fe_mul(lhs, key->y, key->y);
+    fe_mul(rhs, key->x, key->x);
+    fe_mul(rhs, rhs, key->x);
+    fe_add(t, key->x, key->x);
+    fe_add(t, t, key->x);
+    fe_sub(rhs, rhs, t);
+    fe_add(rhs, rhs, p256_b);
+    if(memcmp(lhs, rhs, sizeof(lhs))) {
+        memset(key, 0, sizeof(*key));
+        return P256_ERR_INVALID_KEY;
+    }
+
+    return P256_SUCCESS;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+void p256_key_public(const struct p256_key *key, uint8_t *point)
+{
+    uint64_t t[4];
+
+    point[0] = 0x04;
+    fe_mul(t, key->x, p256_plain_one);
+    limbs_to_bytes(point + 1, t);
+    fe_mul(t, key->y, p256_plain_one);
+    limbs_to_bytes(point + 33, t);
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+void p256_key_wipe(struct p256_key *key)
+{
+    wipe(key, sizeof(*key));
+}
+
+
+/* ---- ECDSA ---- */
+
+/*
+ * s = k^-1 * (e + r * d) mod n. Returns P256_ERR_INVALID_ARG in the
+ * negligibly likely case s is 0 so the caller can use another nonce.
+ */
+static int sign_with_nonce(const struct p256_key *key,
+                           const uint8_t         *hash,
+                           size_t                 hash_len,
+                           const uint64_t         k_inverse[4],
+                           const uint64_t         r[4],
+                           uint8_t               *signature)
+{
+    uint64_t e[4];
+    uint64_t t[4];
+    uint64_t s[4];
+    int      result;
+
+    hash_to_scalar(e, hash, hash_len);
+    sc_mul(t, r, key->d);        /* d is Montgomery so this is r * d */
+    mod_add(t, t, e, p256_n);
+    sc_mul(s, k_inverse, t);     /* As is k^-1 */
+
+    if(is_zero_mask(s)) {
+        result = P256_ERR_INVALID_ARG;
+    } else {
+        limbs_to_bytes(signature, r);
+        limbs_to_bytes(signature + 32, s);
+        result = P256_SUCCESS;
+    }
+
+    wipe(t, sizeof(t));
+    wipe(s, sizeof(s));
+
+    return result;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+int p256_sign(const struct p256_key *key,
+              const uint8_t         *hash,
+              size_t                 hash_len,
+              uint8_t               *signature)
+{
+    uint64_t k_inverse[4];
+    uint64_t r[4];
+    int      result;
+
+    if(!key->has_private) {
+        return P256_ERR_NO_PRIVATE_KEY;
+    }
+
+    do {
+#ifdef P256_HAVE_NONCE_POOL
+        if(key->nonce_pool != NULL &&
+           nonce_pool_take(key->nonce_pool, k_inverse, r) == 0) {
+            result = P256_SUCCESS;
+        } else
+#endif
+        {
+            result = make_nonce(k_inverse, r);
+        }
+        if(result != P256_SUCCESS) {
+            break;
+        }
+        result = sign_with_nonce(key, hash, hash_len, k_inverse, r, signature);
+    } while(result == P256_ERR_INVALID_ARG);
+
+    wipe(k_inverse, sizeof(k_inverse));
+    wipe(r, sizeof(r));
+
+    return result;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+int p256_sign_with_nonce(const struct p256_key *key,
+                         const uint8_t         *hash,
+                         size_t                 hash_len,
+                         const uint8_t         *k,
+                         uint8_t               *signature)
+{
+    uint64_t k_limbs[4];
+    uint64_t k_inverse[4];
+    uint64_t r[4];
+    int      result;
+
+    if(!key->has_private) {
+        return P256_ERR_NO_PRIVATE_KEY;
+    }
+
+    bytes_to_limbs(k_limbs, k);
+    if(is_zero_mask(k_limbs) || !less_than(k_limbs, p256_n)) {
+        result = P256_ERR_INVALID_ARG;
+        goto Done;
+    }
+    result = nonce_from_k(k_limbs, k_inverse, r);
+    if(result == P256_SUCCESS) {
+        result = sign_with_nonce(key, hash, hash_len, k_inverse, r, signature);
+    }
+
+Done:
+    wipe(k_limbs, sizeof(k_limbs));
+    wipe(k_inverse, sizeof(k_inverse));
+    return result;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+int p256_sign_deterministic(const struct p256_key *key,
+                            const uint8_t         *hash,
+                            size_t                 hash_len,
+                            uint8_t               *signature)
+{
+    struct rfc6979_drbg drbg;
+    uint8_t             x[32];
+    uint8_t             h1[32];
+    uint64_t            t[4];
+    uint64_t            k[4];
+    uint64_t            k_inverse[4];
+    uint64_t            r[4];
+    int                 result;
+
+    if(!key->has_private) {
+        return P256_ERR_NO_PRIVATE_KEY;
+    }
+
+    /* int2octets(x) and bits2octets(h1). The hash is reduced just as
+     * ECDSA reduces it. */
+    sc_mul(t, key->d, p256_plain_one);
+    limbs_to_bytes(x, t);
+    hash_to_scalar(t, hash, hash_len);
+    limbs_to_bytes(h1, t);
+
+    rfc6979_drbg_init(&drbg, x, h1);
+    for(;;) {
+        rfc6979_drbg_next(&drbg, k);
+        /* Out of range or r or s of 0 are all negligibly likely and
+         * all mean moving on to the next candidate */
+        if(!is_zero_mask(k) && less_than(k, p256_n)) {
+            result = nonce_from_k(k, k_inverse, r);
+            if(result == P256_SUCCESS) {
+                result = sign_with_nonce(key, hash, hash_len, k_inverse, r, signature);
+            }
+            if(result != P256_ERR_INVALID_ARG) {
+                break;
+            }
+        }
+        rfc6979_drbg_update(&drbg, 0x00, NULL, NULL);
+    }
+
+    wipe(&drbg, sizeof(drbg));
+    wipe(x, sizeof(x));
+    wipe(t, sizeof(t));
+    wipe(k, sizeof(k));
+    wipe(k_inverse, sizeof(k_inverse));
+
+    return result;
+}
+
+
+/*
+ * Public function, see p256.h
+ */
+int p256_verify(const struct p256_key *key,
+                const uint8_t         *hash,
+                size_t                 hash_len,
+                const uint8_t         *signature)
+{
+    struct p256_point u1g;
+    struct p256_point u2q;
+    uint64_t          r[4];
+    uint64_t          s[4];
+    uint64_t          e[4];
+    uint64_t          w[4];
+    uint64_t          u1[4];
+    uint64_t          u2[4];
+    uint64_t          x[4];
+    uint64_t          y[4];
+
+    bytes_to_limbs(r, signature);
+    bytes_to_limbs(s, signature + 32);
+    if(is_zero_mask(r) || !less_than(r, p256_n) ||
+       is_zero_mask(s) || !less_than(s, p256_n)) {
+        return P256_ERR_BAD_SIGNATURE;
+    }
+
+    hash_to_scalar(e, hash, hash_len);
+
+    /* w = s^-1 in Montgomery form, so these products are normal form */
+    sc_mul(w, s, p256_rr_n);
+    sc_inv(w, w);
+    sc_mul(u1, e, w);
+    sc_mul(u2, r, w);
+
+    base_mult(&u1g, u1);
+    var_mult(&u2q, u2, key->x, key->y);
+    point_add(&u1g, &u1g, &u2q);
+    if(is_zero_mask(u1g.z)) {
+        return P256_ERR_BAD_SIGNATURE;
+    }
+
+    point_to_affine(x, y, &u1g);
+    fe_mul(x, x, p256_plain_one);
+    reduce_once(x, x, p256_n);
+
+    return memcmp(x, r, sizeof(x)) ? P256_ERR_BAD_SIGNATURE : P256_SUCCESS;
+}
@@ -0,0 +1,321 @@
+/*
+ * p256.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef __P256_H__
+#define __P256_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * \file p256.h
+ *
+ * \brief Self-contained ECDSA on NIST P-256 (secp256r1).
+ *
+ * This is the signing engine behind the built-in crypto adapter,
+ * t_cose_builtin_crypto.c. It has no dependency on any other crypto
+ * library and doesn't use the heap.
+ *
+ * Everything that touches the private key or the per-signature nonce
+ * is constant time: the fixed-base multiplication k * G uses signed
+ * 5-bit windows and a precomputed table of 52 x 16 multiples of G
+ * (p256_table.h) read in full for each lookup, the point formulas are
+ * the complete ones of Renes, Costello and Batina so there are no
+ * special cases, and inversions are by Fermat's little theorem.
+ * Verification uses only public values and is not constant time.
+ *
+ * Most of the cost of an ECDSA signature is making the nonce k and
+ * computing k * G and k^-1. None of that depends on the key or the
+ * message, so it can be done ahead of time. A \ref p256_nonce_pool
+ * holds (k^-1, r) pairs made by p256_nonce_pool_fill(), typically in
+ * a background thread, and a signing key with a pool attached takes
+ * one pair per signature. The signature is then two modular
+ * multiplications and an addition. A pool is only available when
+ * built with GCC or clang because it needs atomics.
+ *
+ * Random numbers come from the operating system (getrandom() on
+ * Linux, arc4random_buf() on the BSDs and macOS) unless
+ * p256_set_random() installs something else. Define
+ * P256_NO_OS_RANDOM on other platforms. p256_sign_deterministic()
+ * needs no random numbers at all.
+ */
+
+
+/* Return values. All are zero or negative. */
+#define P256_SUCCESS             0
+#define P256_ERR_INVALID_KEY    -1 /* Bad private scalar or public point */
+#define P256_ERR_NO_PRIVATE_KEY -2 /* Signing with a public-only key */
+#define P256_ERR_RANDOM         -3 /* The random number source failed */
+#define P256_ERR_BAD_SIGNATURE  -4 /* Malformed or doesn't verify */
+#define P256_ERR_INVALID_ARG    -5
+
+
+#define P256_PRIVATE_KEY_SIZE      32
+#define P256_PUBLIC_KEY_SIZE       65 /* Uncompressed: 0x04 || x || y */
+#define P256_SIGNATURE_SIZE        64 /* r || s, big-endian */
+
+
+#if defined(__GNUC__) || defined(__clang__)
+#define P256_HAVE_NONCE_POOL
+#endif
+
+
+#ifdef P256_HAVE_NONCE_POOL
+/**
+ * One precomputed nonce. Treat as opaque.
+ */
+struct p256_nonce_slot {
+    size_t   sequence;
+    uint64_t k_inverse[4]; /* Montgomery form mod n */
+    uint64_t r[4];
+};
+
+
+/**
+ * A bounded lock-free queue of precomputed nonces. Any number of
+ * threads may fill it and any number may sign from it. Treat the
+ * members as opaque.
+ *
+ * Each nonce is handed out exactly once and wiped from the pool when
+ * taken. A pool must not be copied, and a filled pool must not be
+ * used in both a parent and a child after fork() because both would
+ * sign with the same nonces, which reveals the private key. Call
+ * p256_nonce_pool_wipe() in the child.
+ */
+struct p256_nonce_pool {
+    struct p256_nonce_slot *slots;
+    size_t                  mask;
+    size_t                  fill_position;
+    size_t                  take_position;
+};
+#endif /* P256_HAVE_NONCE_POOL */
+
+
+/**
+ * A P-256 key pair or public key. Treat the members as opaque.
+ */
+struct p256_key {
+    uint64_t                d[4];  /* Montgomery form mod n; 0 if public only */
+    uint64_t                x[4];  /* Affine, Montgomery form mod p */
+    uint64_t                y[4];
+    int                     has_private;
+#ifdef P256_HAVE_NONCE_POOL
+    struct p256_nonce_pool *nonce_pool;
+#endif
+};
+
+
+/**
+ * \brief Signature of a random number source.
+ *
+ * \param[in] context  The context given to p256_set_random().
+ * \param[out] buf     Where to put the random bytes.
+ * \param[in] len      Number of bytes wanted.
+ *
+ * \return 0 on success. Anything else fails the operation.
+ *
+ * It must be safe to call from any thread that signs or fills a pool.
+ */
+typedef int (p256_random_fn)(void *context, uint8_t *buf, size_t len);
+
+
+/**
+ * \brief Replace the random number source.
+ *
+ * \param[in] random_fn  The new source or \c NULL for the default.
+ * \param[in] context    Passed to \c random_fn.
+ *
+ * This is global and not thread safe with signing in progress.
+ */
+void p256_set_random(p256_random_fn *random_fn, void *context);
+
+
+/**
+ * \brief Make a key pair from a private scalar.
+ *
+ * \param[out] key            The key to initialize.
+ * \param[in] private_scalar  32-byte big-endian private scalar.
+ *
+ * \retval P256_ERR_INVALID_KEY  The scalar is 0 or not less than
+ *                               the group order.
+ */
+int p256_key_from_private(struct p256_key *key, const uint8_t *private_scalar);
+
+
+/**
+ * \brief Make a public key.
+ *
+ * \param[out] key    The key to initialize.
+ * \param[in] point   The public key as an uncompressed point,
+ *                    \ref P256_PUBLIC_KEY_SIZE bytes.
+ *
+ * \retval P256_ERR_INVALID_KEY  The point isn't on the curve.
+ */
+int p256_key_from_public(struct p256_key *key, const uint8_t *point);
+
+
+/**
+ * \brief Output the public key of a key.
+ *
+ * \param[in] key     The key.
+ * \param[out] point  \ref P256_PUBLIC_KEY_SIZE bytes for the
+ *                    uncompressed point.
+ */
+void p256_key_public(const struct p256_key *key, uint8_t *point);
+
+
+/**
+ * \brief Zero a key, including the private scalar.
+ */
+void p256_key_wipe(struct p256_key *key);
+
+
+/**
+ * \brief ECDSA sign a hash.
+ *
+ * \param[in] key        A key with a private scalar.
+ * \param[in] hash       The hash to sign.
+ * \param[in] hash_len   Length of \c hash. Hashes longer than 32
+ *                       bytes are truncated as ECDSA specifies.
+ * \param[out] signature \ref P256_SIGNATURE_SIZE bytes for r || s.
+ *
+ * If the key has a nonce pool and it isn't empty, the nonce comes
+ * from it. Otherwise one is made here.
+ */
+int p256_sign(const struct p256_key *key,
+              const uint8_t         *hash,
+              size_t                 hash_len,
+              uint8_t               *signature);
+
+
+/**
+ * \brief ECDSA sign with a given nonce.
+ *
+ * \param[in] key        A key with a private scalar.
+ * \param[in] hash       The hash to sign.
+ * \param[in] hash_len   Length of \c hash.
+ * \param[in] k          32-byte big-endian nonce.
+ * \param[out] signature \ref P256_SIGNATURE_SIZE bytes for r || s.
+ *
+ * This is for known-answer tests. A nonce that is ever reused or is
+ * at all predictable reveals the private key.
+ */
+int p256_sign_with_nonce(const struct p256_key *key,
+                         const uint8_t         *hash,
+                         size_t                 hash_len,
+                         const uint8_t         *k,
+                         uint8_t               *signature);
+
+
+/**
+ * \brief Deterministic ECDSA sign a hash (RFC 6979).
+ *
+ * \param[in] key        A key with a private scalar.
+ * \param[in] hash       The hash to sign.
+ * \param[in] hash_len   Length of \c hash.
+ * \param[out] signature \ref P256_SIGNATURE_SIZE bytes for r || s.
+ *
+ * The nonce is derived from the private key and the hash with the
+ * HMAC-SHA-256 DRBG of RFC 6979, so the same key and hash always give
+ * the same signature. No random numbers are used, so there is no
+ * call to the random source and it works with P256_NO_OS_RANDOM. A
+ * nonce pool attached to the key is not used. This costs about the
+ * same as p256_sign() without a pool.
+ */
+int p256_sign_deterministic(const struct p256_key *key,
+                            const uint8_t         *hash,
+                            size_t                 hash_len,
+                            uint8_t               *signature);
+
+
+/**
+ * \brief ECDSA verify.
+ *
+ * \param[in] key        The public key.
+ * \param[in] hash       The hash that was signed.
+ * \param[in] hash_len   Length of \c hash.
+ * \param[in] signature  \ref P256_SIGNATURE_SIZE bytes of r || s.
+ *
+ * \retval P256_ERR_BAD_SIGNATURE  The signature doesn't verify.
+ */
+int p256_verify(const struct p256_key *key,
+                const uint8_t         *hash,
+                size_t                 hash_len,
+                const uint8_t         *signature);
+
+
+#ifdef P256_HAVE_NONCE_POOL
+/**
+ * \brief Initialize a nonce pool.
+ *
+ * \param[out] pool      The pool to initialize.
+ * \param[in] slots      Storage for the nonces. It must stay valid
+ *                       as long as the pool is used.
+ * \param[in] num_slots  Number of slots. Must be a power of two.
+ *
+ * The pool starts empty.
+ */
+int p256_nonce_pool_init(struct p256_nonce_pool *pool,
+                         struct p256_nonce_slot *slots,
+                         size_t                  num_slots);
+
+
+/**
+ * \brief Add nonces to a pool.
+ *
+ * \param[in] pool     The pool.
+ * \param[in] max_add  The most to add.
+ *
+ * \return The number added. Less than \c max_add if the pool filled
+ *         up or the random source failed.
+ *
+ * Each nonce costs about as much as a signature without a pool. This
+ * is meant to be called from a background thread or idle loop.
+ */
+size_t p256_nonce_pool_fill(struct p256_nonce_pool *pool, size_t max_add);
+
+
+/**
+ * \brief Approximate number of nonces in a pool.
+ */
+size_t p256_nonce_pool_count(const struct p256_nonce_pool *pool);
+
+
+/**
+ * \brief Discard and zero all nonces in a pool.
+ *
+ * Not thread safe with filling or signing.
+ */
+void p256_nonce_pool_wipe(struct p256_nonce_pool *pool);
+
+
+/**
+ * \brief Attach a pool to a key or detach it with \c NULL.
+ *
+ * One pool can be shared by any number of keys.
+ */
+static inline void p256_key_set_nonce_pool(struct p256_key        *key,
+                                           struct p256_nonce_pool *pool)
+{
+    key->nonce_pool = pool;
+}
+#endif /* P256_HAVE_NONCE_POOL */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __P256_H__ */
@@ -0,0 +1,1783 @@
+/*
+ * p256_table.h -- Generated by gen_p256_table.py. Do not edit.
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ *
+ * p256_base_table[i][j] is (j + 1) * 2^(5 * i) * G in affine
+ * coordinates, x then y, Montgomery form, little-endian limbs.
+ */
+
+static const uint64_t p256_base_table[52][16][8] = {
+  {
+    {0x79e730d418a9143cULL, 0x75ba95fc5fedb601ULL, 0x79fb732b77622510ULL, 0x18905f76a53755c6ULL,
+     0xddf25357ce95560aULL, 0x8b4ab8e4ba19e45cULL, 0xd2e88688dd21f325ULL, 0x8571ff1825885d85ULL},
+    {0x850046d410ddd64dULL, 0xaa6ae3c1a433827dULL, 0x732205038d1490d9ULL, 0xf6bb32e43dcf3a3bULL,
+     0x2f3648d361bee1a5ULL, 0x152cd7cbeb236ff8ULL, 0x19a8fb0e92042dbeULL, 0x78c577510a5b8a3bULL},
+    {0xffac3f904eebc127ULL, 0xb027f84a087d81fbULL, 0x66ad77dd87cbbc98ULL, 0x26936a3fb6ff747eULL,
+     0xb04c5c1fc983a7ebULL, 0x583e47ad0861fe1aULL, 0x788208311a2ee98eULL, 0xd5f06a29e587cc07ULL},
+    {0x74b0b50d46918dccULL, 0x4650a6edc623c173ULL, 0x0cdaacace8100af2ULL, 0x577362f541b0176bULL,
+     0x2d96f24ce4cbaba6ULL, 0x17628471fad6f447ULL, 0x6b6c36dee5ddd22eULL, 0x84b14c394c5ab863ULL},
+    {0xbe1b8aaec45c61f5ULL, 0x90ec649a94b9537dULL, 0x941cb5aad076c20cULL, 0xc9079605890523c8ULL,
+     0xeb309b4ae7ba4f10ULL, 0x73c568efe5eb882bULL, 0x3540a9877e7a1f68ULL, 0x73a076bb2dd1e916ULL},
+    {0x403947373e77664aULL, 0x55ae744f346cee3eULL, 0xd50a961a5b17a3adULL, 0x13074b5954213673ULL,
+     0x93d36220d377e44bULL, 0x299c2b53adff14b5ULL, 0xf424d44cef639f11ULL, 0xa4c9916d4a07f75fULL},
+    {0x0746354ea0173b4fULL, 0x2bd20213d23c00f7ULL, 0xf43eaab50c23bb08ULL, 0x13ba5119c3123e03ULL,
+     0x2847d0303f5b9d4dULL, 0x6742f2f25da67bddULL, 0xef933bdc77c94195ULL, 0xeaedd9156e240867ULL},
+    {0x27f14cd19499a78fULL, 0x462ab5c56f9b3455ULL, 0x8f90f02af02cfc6bULL, 0xb763891eb265230dULL,
+     0xf59da3a9532d4977ULL, 0x21e3327dcf9eba15ULL, 0x123c7b84be60bbf0ULL, 0x56ec12f27706df76ULL},
+    {0x75c96e8f264e20e8ULL, 0xabe6bfed59a7a841ULL, 0x2cc09c0444c8eb00ULL, 0xe05b3080f0c4e16bULL,
+     0x1eb7777aa45f3314ULL, 0x56af7bedce5d45e3ULL, 0x2b6e019a88b12f1aULL, 0x086659cdfd835f9bULL},
+    {0x2c18dbd19dc21ec8ULL, 0x98f9868a0fcf8139ULL, 0x737d2cd648250b49ULL, 0xcc61c94724b3428fULL,
+     0x0c2b407880dd9e76ULL, 0xc43a8991383fbe08ULL, 0x5f7d2d65779be5d2ULL, 0x78719a54eb3b4ab5ULL},
+    {0xea7d260a6245e404ULL, 0x9de407956e7fdfe0ULL, 0x1ff3a4158dac1ab5ULL, 0x3e7090f1649c9073ULL,
+     0x1a7685612b944e88ULL, 0x250f939ee57f61c8ULL, 0x0c0daa891ead643dULL, 0x68930023e125b88eULL},
+    {0x04b71aa7d2697768ULL, 0xabdedef5ca345a33ULL, 0x2409d29dee37385eULL, 0x4ee1df77cb83e156ULL,
+     0x0cac12d91cbb5b43ULL, 0x170ed2f6ca895637ULL, 0x28228cfa8ade6d66ULL, 0x7ff57c9553238acaULL},
+    {0xccc425634b2ed709ULL, 0x0e356769856fd30dULL, 0xbcbcd43f559e9811ULL, 0x738477ac5395b759ULL,
+     0x35752b90c00ee17fULL, 0x68748390742ed2e3ULL, 0x7cd06422bd1f5bc1ULL, 0xfbc08769c9e7b797ULL},
+    {0xa242a35bb0cf664aULL, 0x126e48f77f9707e3ULL, 0x1717bf54c6832660ULL, 0xfaae7332fd12c72eULL,
+     0x27b52db7995d586bULL, 0xbe29569e832237c2ULL, 0xe8e4193e2a65e7dbULL, 0x152706dc2eaa1bbbULL},
+    {0x72bcd8b7bc60055bULL, 0x03cc23ee56e27e4bULL, 0xee337424e4819370ULL, 0xe2aa0e430ad3da09ULL,
+     0x40b8524f6383c45dULL, 0xd766355442a41b25ULL, 0x64efa6de778a4797ULL, 0x2042170a7079adf4ULL},
+    {0x808b0b650bc6fb80ULL, 0x5882e0753ffe2e6bULL, 0xd5ef2f7c2c83f549ULL, 0x54d63c809103b723ULL,
+     0xf2f11bd652a23f9bULL, 0x3670c3194b0b6587ULL, 0x55c4623bb1580e9eULL, 0x64edf7b201efe220ULL}
+  },
+  {
+    {0xd8c5fccfc5e3a3d8ULL, 0xbefd904c4079dfbfULL, 0xbc6d6a58fead0197ULL, 0x39227077695532a4ULL,
+     0x09e23e6ddbef42f5ULL, 0x7e449b64480a9908ULL, 0x7b969c1aad9a2e40ULL, 0x6231d7929591c2a4ULL},
+    {0xdb6d96f305968b80ULL, 0x380a0913089f73b9ULL, 0x7da70b83c2c61e01ULL, 0x95fb8394569b38c7ULL,
+     0x9a3c651280edfe2fULL, 0x8f726bb98faeaf82ULL, 0x8010a4a078424bf8ULL, 0x296720440e844970ULL},
+    {0x802b8d2333e12b70ULL, 0x6d490a4b19dd329bULL, 0x14f356cc6abc354dULL, 0x11eddf7fd0a0da0dULL,
+     0x1e208328d87fd1d8ULL, 0xfd2f4f8cfd025813ULL, 0x03b48cc47c29bca2ULL, 0x3f2a78b3241a2b71ULL},
+    {0x63c5cb817a2ad62aULL, 0x7ef2b6b9ac62ff54ULL, 0x3749bba4b3ad9db5ULL, 0xad311f2c46d5a617ULL,
+     0xb77a8087c2ff3b6dULL, 0xb46feaf3367834ffULL, 0xf8aa266d75d6b138ULL, 0xfa38d320ec008188ULL},
+    {0xc04afa1ae3451a09ULL, 0x7cc69103bc117423ULL, 0x876be3aa51cf56eeULL, 0xe7577d57ad844a25ULL,
+     0x266fed8cdb77f341ULL, 0xcfa258dc23ae4a2aULL, 0x53a7a98cda782760ULL, 0x04b48868ceaf7d4aULL},
+    {0xc0f2affc4e6916c6ULL, 0x6fb94957811842daULL, 0x6034bcb624b4d157ULL, 0xde2efdc7992efb90ULL,
+     0xd66f7eceac793c87ULL, 0x02f026267dc6fdcdULL, 0x90d3235c9aa1c501ULL, 0xf6e494962b4666f0ULL},
+    {0x082736d19c0859c3ULL, 0x89ea5516b269386aULL, 0xf25071871aa87b33ULL, 0xe9d82f5f704e8236ULL,
+     0x7834612442e855f5ULL, 0x209f50fe395e00d8ULL, 0xcd9e03aae6e7e62bULL, 0xb4b4959e5e5be37bULL},
+    {0x486d8ffa696946fcULL, 0x50fbc6d8b9cba56dULL, 0x7e3d423e90f35a15ULL, 0x7c3da195c0dd962cULL,
+     0xe673fdb03cfd5d8bULL, 0x0704b7c2889dfca5ULL, 0xf6ce581ff52305aaULL, 0x399d49eb914d5e53ULL},
+    {0x7966afbb10e6d950ULL, 0x37e4a4c4e2bf970aULL, 0x23d0c8559d54ca2aULL, 0x13d62865fee39a10ULL,
+     0x15f53c38d3bd15e9ULL, 0x014b8bed84a80bccULL, 0x10674c77bfd8f608ULL, 0x4dfab986c93fbfefULL},
+    {0x24c97c367b92d453ULL, 0xd2c271a2249a26c0ULL, 0x60eb4b2b89d14a39ULL, 0x1198de20432e8005ULL,
+     0x9eabea75799b80d9ULL, 0xab6e0c2b8f826ae5ULL, 0xca004eedd10061ecULL, 0x31a9f439e99c4fd8ULL},
+    {0x734c8b75b5498a7cULL, 0xaeccad8a29f64c2dULL, 0x95dd54fa295b1677ULL, 0x383902a0b4c54968ULL,
+     0x78cb276feb9d33a9ULL, 0x00aedca1af552869ULL, 0xa01d14594c5c1630ULL, 0xfeba17067cf7d50dULL},
+    {0x380a496d6ec293cdULL, 0x733dbda78e7051f5ULL, 0x037e388db849140aULL, 0xee4b32b05946dbf6ULL,
+     0xb1c4fda9cae368d1ULL, 0x5001a7b0fdb0b2f3ULL, 0x6df593742e3ac46eULL, 0x4af675f239b3e656ULL},
+    {0x1a1fffdcc01b0a46ULL, 0x07ad675f83f843c2ULL, 0xbcec2d076738e81aULL, 0x910aec75aa8b7da8ULL,
+     0x13b4d740a4509ba7ULL, 0x057010734c7b8216ULL, 0x3d75c8f71591f1e5ULL, 0x134c1b6f0dfe1d90ULL},
+    {0xb20e7c44d67826ebULL, 0x1212d3cfac379637ULL, 0x614f67877de03a5dULL, 0x7538a2fc802baa26ULL,
+     0x133c37a19d252415ULL, 0x7db390506eb4b587ULL, 0x5d40d7574c49d1d9ULL, 0xf1126b99a801c4baULL},
+    {0x39a7aeb9c56729fcULL, 0x21a59448e7a8bd85ULL, 0xd7c6da5d049d10c6ULL, 0x93a4c4a8c5197afbULL,
+     0xd185539c25933861ULL, 0x4994bcba27494d9dULL, 0xef033de14ce7bfa9ULL, 0x22e9b000321f9236ULL},
+    {0x44e3811039949296ULL, 0x5b63827b361db1b5ULL, 0x3e5323ed206eaff5ULL, 0x942370d2c21f4290ULL,
+     0xf2caaf2ee0d985a1ULL, 0x192cc64b7239846dULL, 0x7c0b8f47ae6312f8ULL, 0x7dc61f9196620108ULL}
+  },
+  {
+    {0x4f7081e144cc3addULL, 0xd5ffa1d687be82cfULL, 0x89890b6c0edd6472ULL, 0xada26e1a3ed17863ULL,
+     0x276f271563483caaULL, 0xe6924cd92f6077fdULL, 0x05a7fe980a466e3cULL, 0xf1c794b0b1902d1fULL},
+    {0x3d2b24b9eb7926b8ULL, 0xbff88cb3cdbe5509ULL, 0xd0f399afe4dd640bULL, 0x3c5fe1302f76ed45ULL,
+     0x6f3562f43764fb3dULL, 0x7b5af3183151b62dULL, 0xd5bd0bc7d79ce5f3ULL, 0xfdaf6b20ec66890fULL},
+    {0x32027fe891e5d7d3ULL, 0xf14b7d1773a07678ULL, 0xf88497b3c0dfdd61ULL, 0xf7c2eec02a8c4f48ULL,
+     0xaa5573f43756e621ULL, 0xc013a2401825b948ULL, 0x1c03b34563878572ULL, 0xa0472bea653a4184ULL},
+    {0x6772b0e5ab4b35a2ULL, 0x1d8b6001f5eeaacfULL, 0x728f7ce4795b9580ULL, 0x4a20ed2a41fb81daULL,
+     0x9f685cd44fec01e6ULL, 0x3ed7ddcca7ff50adULL, 0x460fd2640c2d97fdULL, 0x3a241426eb82f4f9ULL},
+    {0x29ae2cf983dfedc9ULL, 0xf84371348d87631aULL, 0xaf5717117429c8d2ULL, 0x18d15867146d9272ULL,
+     0x83053ecf69769bb7ULL, 0xc55eb856c479ab82ULL, 0x5ef7791c21b0f4b2ULL, 0xaa5956ba3d491525ULL},
+    {0x84cfbfa1c5c5ea50ULL, 0xd3baf14c67960681ULL, 0x263984030dd50942ULL, 0xe4b7839c4716a663ULL,
+     0xd5f1f794e7de6dc0ULL, 0x5cd0f4d4622aa7ceULL, 0x5295f3f159acfeecULL, 0x8d933552953e0607ULL},
+    {0xe652533b3cef0d7dULL, 0xd94f7b182bbb4381ULL, 0x838752be0e80f500ULL, 0x8e6e24889e9c9bfbULL,
+     0xc975169716caca6aULL, 0x866c49d838531ad9ULL, 0xc917e2397151ade1ULL, 0x2d016ec16037c407ULL},
+    {0x80009862d5d721d5ULL, 0x0c3357a35bd3a182ULL, 0x27f3a83b7aa2cda4ULL, 0xb58ae74ef6f83085ULL,
+     0x2a911a812e6dad6bULL, 0xde286051f43d6c5bULL, 0x4bdccc41f996c4d8ULL, 0xe7312ec00ae1e24eULL},
+    {0x903f6e3960e913afULL, 0xb2b58bee98bf140dULL, 0x9deff025354890b8ULL, 0x155810068d2e924eULL,
+     0xb5755db493c95e5bULL, 0x3fac42f0dae20eb8ULL, 0x9377c8c109b6d8e0ULL, 0xa43e2b46ab47ceffULL},
+    {0x5f57b2fbfacfa459ULL, 0x874b1498c1b5aa6bULL, 0xb9e89acac4db2092ULL, 0x1362bf8ddf4381daULL,
+     0x25d76830b76328a0ULL, 0x38188b7098572ae4ULL, 0xb43e941429132f7dULL, 0x7895a29f22dd42c9ULL},
+    {0xcbde78dd5e22cbb2ULL, 0xf449c85b76bb4391ULL, 0x4289f357b6a4273bULL, 0x9fce23fd48e84a19ULL,
+     0xcfc32730939eb3b4ULL, 0x8b3d982c16c32280ULL, 0x5ac234bad5f1346cULL, 0x781954b470769fc9ULL},
+    {0x6faf68feaae6ee70ULL, 0x78f4cc155602b0c9ULL, 0x7e3321a86e94052aULL, 0x2fb3a0d6734d5d80ULL,
+     0xf3b98f3bb25a43baULL, 0x30bf803119ee2951ULL, 0x7ffee43321b0612aULL, 0x12f775e42eb821d0ULL},
+    {0x4fdff805f57209b5ULL, 0x9bd65ac3f952ac8dULL, 0x02a3abd3c7969a6fULL, 0x1359927ef523775fULL,
+     0xe09b463f88d2e861ULL, 0x661d2199623287c3ULL, 0x821e64495a70eb7aULL, 0x0afbbb1dd67dc684ULL},
+    {0x7418e3d3acff89f9ULL, 0x227f16aed852251fULL, 0xdd5bc6e4eb84658bULL, 0xf066b9c8f90a9f7eULL,
+     0xc2369071800a7f87ULL, 0x383ddc0d5a72862aULL, 0x5b48465d8a776da5ULL, 0x3d82f64f5e2d8318ULL},
+    {0x5852104b87453b28ULL, 0x073e8128b387344dULL, 0x300e78e4817cfc08ULL, 0x3a82ed4799362088ULL,
+     0xe222304c88de46a4ULL, 0x666c94fd57fadf4aULL, 0x40b2d08ea0c8e108ULL, 0x4b2955b909e050faULL},
+    {0xf8d112e76e6485b3ULL, 0x4d3e24db771c52f8ULL, 0x48e3ee41684a2f6dULL, 0x7161957d21d95551ULL,
+     0x19631283cdb12a6cULL, 0xbf3fa8822e50e164ULL, 0xf6254b633166cc73ULL, 0x3aefa7aeaee8cc38ULL}
+  },
+  {
+    {0x79b0fe623b36f9fdULL, 0x26543b23fde19fc0ULL, 0x136e64a0958482efULL, 0x23f637719b095825ULL,
+     0x14cfd596b6a1142eULL, 0x5ea6aac6335aac0bULL, 0x86a0e8bdf3081dd5ULL, 0x5fb89d79003dc12aULL},
+    {0x0f0165fce3779ee3ULL, 0xe00e7f9dbd495d9eULL, 0x1fa4efa220284e7aULL, 0x4564bade47ac6219ULL,
+     0x90e6312ac4708e8eULL, 0x4f5725fba71e9adfULL, 0xe95f55ae3d684b9fULL, 0x47f7ccb11e94b415ULL},
+    {0xda3a77e5522e6b69ULL, 0x69c908c3bbcd6c18ULL, 0x1f1b9e48d924fd56ULL, 0x37c64e36aa4bb3f7ULL,
+     0x5a4fdbdfee478d7dULL, 0xba75c8bc0193f7a0ULL, 0x84bc1e8456cd16dfULL, 0x1fb08f0846fad151ULL},
+    {0x3617890361a341c1ULL, 0x3604dc600cfd6142ULL, 0x022295eb8533316cULL, 0x3dbde4ac44af2922ULL,
+     0x898afc5d1c7eef69ULL, 0x58896805d14f4fa1ULL, 0x05002160203c21caULL, 0x6f0d1f3040ef730bULL},
+    {0x48201b4b12cfe297ULL, 0x3eee129c292f74e5ULL, 0xe1fe114ec9e874e8ULL, 0x899b055c92c5fc41ULL,
+     0x4e477a643a39c8cfULL, 0x82f09efe78963cc9ULL, 0x6fd3fd8fd333f863ULL, 0x85132b2adc949c63ULL},
+    {0xbd9b8b1dbe7a2af3ULL, 0xec51caa94fb74a72ULL, 0xb9937a4b63879697ULL, 0x7c9a9d20ec2687d5ULL,
+     0x1773e44f6ef5f014ULL, 0x8abcf412e90c6900ULL, 0x387bd0228142161eULL, 0x50393755fcb6ff2aULL},
+    {0x766e072232398baaULL, 0x205fee425cfca031ULL, 0xa49f53417a029cf2ULL, 0xa88c68b84023890dULL,
+     0xbc2750417337aaa8ULL, 0x9ed364ad0eb384f4ULL, 0xe0816f8529aba92fULL, 0x2e9e194104e38a88ULL},
+    {0xfabf770977f7195aULL, 0x8ec86167adeb838fULL, 0xea1285a8bb4f012dULL, 0xd68835039a3eab3fULL,
+     0xee5d24f8309004c2ULL, 0xa96e4b7613ffe95eULL, 0x0cdffe12bd223ea4ULL, 0x8f5c2ee5b6739a53ULL},
+    {0xecace1dda1887395ULL, 0x40960f36932a65deULL, 0x9611ff5c3aa95529ULL, 0xc58215b07c1e5a36ULL,
+     0xd48c9b58f0e1a524ULL, 0xb406856bf590dfb8ULL, 0xc7605e049cd95662ULL, 0x0dd036eea33ecf82ULL},
+    {0x3d61333959145a65ULL, 0xcd9bc368fa406337ULL, 0x82d11be32d8a52a0ULL, 0xf6877b2797a1c590ULL,
+     0x837a819bf5cbdb25ULL, 0x2a4fd1d8de090249ULL, 0x622a7de774990e5fULL, 0x840fa5a07945511bULL},
+    {0xfe2893277946d3f9ULL, 0xe132bd2407472273ULL, 0xeeeb510c1eb6ae86ULL, 0x777708c5f0595067ULL,
+     0x18e2c8cd1297029eULL, 0x2c61095cbbf9305eULL, 0xe466c2586b85d6d9ULL, 0x8ac06c36da1ea530ULL},
+    {0xe58e90b36b0cf82eULL, 0x6438d2462615b5e7ULL, 0x07b1f8fc669c145aULL, 0xb0d8b2da36f1e1cbULL,
+     0x54d5dadbd9184c4dULL, 0x3dbb18d5f93d9976ULL, 0x0a3e0f56d1147d47ULL, 0x2afa8c8da0a48609ULL},
+    {0x871239ad653ae326ULL, 0x14bcf72aa74cbb43ULL, 0x8737650e20d4c083ULL, 0x3df86536110ed4afULL,
+     0xd2d86fe7b53ca555ULL, 0x688cb00dabd5d538ULL, 0xcf81bda31ad38468ULL, 0x7ccfe3ccf01167b6ULL},
+    {0x26e08c07e3533d77ULL, 0xd7222e6a2e341c99ULL, 0x9d60ec3d8d2dc4edULL, 0xbdfe0d8f7c476cf8ULL,
+     0x1fe59ab61d056605ULL, 0xa9ea9df686a8551fULL, 0x8489941e47fb8d8cULL, 0xfeb874eb4a7f1b10ULL},
+    {0x61fc181060a71676ULL, 0xe852d1a8f66a8ad1ULL, 0x172bbd656417231eULL, 0x0d6de7bd3babb11fULL,
+     0x6fde6f88c8e347f8ULL, 0x1c5875479bd99cc3ULL, 0x78e54ed034076950ULL, 0x97f0f334796e83baULL},
+    {0xed406aa9bd763802ULL, 0xc21486a065303da1ULL, 0x61ae291ec7e62ec4ULL, 0x622a0492df99333eULL,
+     0x7fd80c9dbb7a8ee0ULL, 0xdc2ed3bc6c01aedbULL, 0x35c35a1208be74ecULL, 0xd540cb1a469f671fULL}
+  },
+  {
+    {0xa7a8746a584c5e20ULL, 0x267e4ea1b9dc7035ULL, 0x593a15cfb9548c9bULL, 0x5e6e21354bd012f3ULL,
+     0xdf31cc6a8c8f936eULL, 0x8af84d04b5c241dcULL, 0x63990a6f345efb86ULL, 0x6fef4e61b9b962cbULL},
+    {0xf6368f0925722608ULL, 0x131260db131cf5c6ULL, 0x40eb353bfab4f7acULL, 0x85c7888037eee829ULL,
+     0x4c1581ffc3bdf24eULL, 0x5bff75cbf5c3c5a8ULL, 0x35e8c83fa14e6f40ULL, 0xb81d1c0f0295e0caULL},
+    {0xf2efe23d442a8ad1ULL, 0xc3816a7d06b9c164ULL, 0xa9df2d8bdc0aa5e5ULL, 0x191ae46f120a8e65ULL,
+     0x83667f8700611c5bULL, 0x83171ed7ff109948ULL, 0x33a2ecf8ca695952ULL, 0xfa4a73eef48d1a13ULL},
+    {0xfcde7cc8f43a730fULL, 0xe89b6f3c33ab590eULL, 0xc823f529ad03240bULL, 0x82b79afe98bea5dbULL,
+     0x568f2856962fe5deULL, 0x0c590adb60c591f3ULL, 0x1fc74a144a28a858ULL, 0x3b662498b3203f4cULL},
+    {0x48fc4ed082dd1b6aULL, 0x5783a13867b703afULL, 0x2463cb9a005d6aaaULL, 0xd31ec55c706ecd43ULL,
+     0x9f8ed33f8e9a7641ULL, 0x625453ed098d9e7aULL, 0xa3beade4ec887493ULL, 0x442b80505a795566ULL},
+    {0x91e3cf0d6c39765aULL, 0xa2db3acdac3cca0bULL, 0x288f2f08cb953b50ULL, 0x2414582ccf43cf1aULL,
+     0x8dec8bbc60eee9a8ULL, 0x54c79f02729aa042ULL, 0xd81cd5ec6532f5d5ULL, 0xa672303acf82e15fULL},
+    {0x46df582d3bfab839ULL, 0x92474e042f8adadeULL, 0x36a7766a147a1bc3ULL, 0xb6940f540dc0f979ULL,
+     0x44738ef2f2759f25ULL, 0x9dd95789a719f4c6ULL, 0x2859b7f40750c345ULL, 0x5e788bf2b22180d5ULL},
+    {0x376aafa8719c0563ULL, 0xcd8ad2dcbc5fc79fULL, 0x303fdb9fcb750cd3ULL, 0x14ff052f4418b08eULL,
+     0xf75084cf3e2d6520ULL, 0x7ebdf0f8144ed509ULL, 0xf43bf0f2d3f25b98ULL, 0x86ad71cfa354d837ULL},
+    {0xa839c9fdfd67ca25ULL, 0x023e626860f2015cULL, 0x2414a7930e7b2a65ULL, 0x92dbe372b13edcbbULL,
+     0xf64981ee64c2200fULL, 0x94fb9cdf8446f2f3ULL, 0x01411a6a3f1367bbULL, 0x7985c1915a1e8331ULL},
+    {0xb827fe9226f43572ULL, 0xdfd3ab5b5d824758ULL, 0x315dd23a539094c1ULL, 0x85c0e37a66623d68ULL,
+     0x575c79727be19ae0ULL, 0x616a3396df0d36b5ULL, 0xa1ebb3c826b1ff7eULL, 0x635b9485140ad453ULL},
+    {0xc8123c6037e2efeaULL, 0x8d49b502034a96f6ULL, 0x466a346b973e4a95ULL, 0xf176b5bab7de00ffULL,
+     0x1c58fa3b82dfa945ULL, 0x2eb27a9609e429aeULL, 0x57c67a67a12b187cULL, 0xb155ba82e2298bbaULL},
+    {0x92bf3cdada430c0bULL, 0x4702850e3a96dac6ULL, 0xc91cf0a515ac326aULL, 0x95de4f49ab8c25e4ULL,
+     0xb01bad09e265c17cULL, 0x24e45464087b3881ULL, 0xd43e583ce1fac5caULL, 0xe17cb3186ead97a6ULL},
+    {0xf1a542073d99bcfaULL, 0x59db703ce8becf6dULL, 0x2e455142d2459569ULL, 0xb0ee5143a901b910ULL,
+     0xfc05d451e26d994fULL, 0x7a6062b41360caafULL, 0xdf1ded5f4fa639b1ULL, 0xaf930348d335b8b0ULL},
+    {0x6cc3924374dcec46ULL, 0x33cfc02d54c2b73fULL, 0x82917844f26cd99cULL, 0x8819dd95d1773f89ULL,
+     0x09572aa60871f427ULL, 0x8e0cf365f6f01c34ULL, 0x7fa52988bff1f5afULL, 0x4eb357eae75e8e50ULL},
+    {0x3d8f248a21fd0861ULL, 0xade3bd649bd5a4b6ULL, 0xcb56c953c2e2a6bfULL, 0x699cd2b5287d6c5fULL,
+     0xdebce1be47d05e8fULL, 0x1a4fbb13a8f53732ULL, 0x97163beaa5852b08ULL, 0x92c49e6ceec6987aULL},
+    {0xd9d0c8c4868af75dULL, 0xd7325cff45c8c7eaULL, 0xab471996cc81ecb0ULL, 0xff5d55f3611824edULL,
+     0xbe3145411977a0eeULL, 0x5085c4c5722038c6ULL, 0x2d5335bff94bb495ULL, 0x894ad8a6c8e2a082ULL}
+  },
+  {
+    {0x540234b22c11bb37ULL, 0x2d0366dded4c74a3ULL, 0xf9a968daeec5f25dULL, 0x3660106867b63142ULL,
+     0x07cd6d2c68d7b6d4ULL, 0xa8f74f090c842942ULL, 0xe27514047768b1eeULL, 0x4b5f7e89fe62aee4ULL},
+    {0xf2369f0b879fbbedULL, 0x0ff0ae86da9d1869ULL, 0x5251d75956766f45ULL, 0x4984d8c02be8d0fcULL,
+     0x7ecc95a6d21008f0ULL, 0x29bd54a03a1a1c49ULL, 0xab9828c5d26c50f3ULL, 0x32c0087c51d0d251ULL},
+    {0x47feeb6662b5f3afULL, 0xcefab5610abb3734ULL, 0x449de60e19f35cb1ULL, 0x39f8db14157f0eb9ULL,
+     0xffaecc5b3c61bfd6ULL, 0xa5a4d41d41216703ULL, 0x7f8fabed224e1cc2ULL, 0x0d5a8186871ad953ULL},
+    {0x190d8ea601799a52ULL, 0xa20cec41b86d2952ULL, 0x3062ffb27fff2a7cULL, 0x741b32e579f19d37ULL,
+     0xf80d81814eb57d47ULL, 0x7a2d0ed416aef06bULL, 0x09735fb01cecb588ULL, 0x1641caaac6061f5bULL},
+    {0xae2ad171656e8c3aULL, 0xc0e2a4631acd0705ULL, 0x006f6a8aa0b6055cULL, 0xaf4513d72b65a26eULL,
+     0x3f549e14d616d5bcULL, 0x64ee395571253b1fULL, 0xe8b10bc1b8ce243aULL, 0xbcbeace5913a4e77ULL},
+    {0x68d32256f779d6a7ULL, 0x20423b4d19e7284eULL, 0xde19aa1b38f3b153ULL, 0x73d0b6c28444f703ULL,
+     0x666161489c64e6a3ULL, 0x99587c3737256224ULL, 0x6f5277fe61331563ULL, 0x7174ad4aa656502eULL},
+    {0xec1ffc920133918dULL, 0x15d9bf5eb2c9ef97ULL, 0x7885b542fc6cbb9aULL, 0x8abe64535720cf5dULL,
+     0x4e715dced4ec68abULL, 0x57a67614279c24a3ULL, 0x788ed52a31bb61cfULL, 0xaba82444f437a003ULL},
+    {0x7f99824f20151427ULL, 0x206828b692430206ULL, 0xaa9097d7e1112357ULL, 0xacf9a2f209e414ecULL,
+     0xdbdac9da27915356ULL, 0x7e0734b7001efee3ULL, 0x54fab5bbd2b288e2ULL, 0x4c630fc4f62dd09cULL},
+    {0x6d883e66bd70a5e1ULL, 0x9bd884c1d05de713ULL, 0x48d9d445d4d8487dULL, 0x8440cd8b0eeae405ULL,
+     0xa3cd0f293d26f83eULL, 0x3fd9453022a3c5e4ULL, 0x63a078663ffa2ca7ULL, 0xbfeadd2900d4a097ULL},
+    {0x13aea559d68432baULL, 0x940043fbd33915dbULL, 0x476c7c94e2e8da08ULL, 0x6b1630c4443065bbULL,
+     0xd6d8546d19f06c75ULL, 0x7e1e98c22eb35abdULL, 0x751c9310f0157d8eULL, 0xdef84327f6fa6075ULL},
+    {0x765b993c3a7a4e0eULL, 0xfb8f4aef9d79d314ULL, 0x5ea2c50e2a19eb24ULL, 0x925016e5b891bc8cULL,
+     0x8f70afdc3ad1ece7ULL, 0x0abba84cf08fabe2ULL, 0x0a9922c815f6132bULL, 0x6c0213735d076d77ULL},
+    {0x00af2615a4453961ULL, 0x1705494b993d112cULL, 0x0032e12aa1cdd652ULL, 0x0ebfa612046d9cb3ULL,
+     0x9f03a9f31b63728cULL, 0x8f3618a2de022b05ULL, 0xd5b24d903e77c5c9ULL, 0x837838a372acb77cULL},
+    {0xfe65cbd98fceb047ULL, 0xde872ef53f8b11a1ULL, 0x9aba0d3d8fec802fULL, 0x139f1d329a9f381dULL,
+     0x0721aed9c587958dULL, 0x066a015cb9f6a7daULL, 0x059ec4e3ed5d9d06ULL, 0x144285716cbaca1fULL},
+    {0x66fe0fffe298cdf5ULL, 0x3f61bea47b2e51b6ULL, 0x7d372117bad3afa4ULL, 0x6521a09cef656e2fULL,
+     0xb3b8c966e8a58fe7ULL, 0x25203a115a47ebc7ULL, 0xfe81588d5c4be573ULL, 0x6132e2f31f49a03cULL},
+    {0xec1ab0130f8c2c99ULL, 0x60e8968ff17725c2ULL, 0xe1a4a593940a980bULL, 0x15ed15b020e9ccb1ULL,
+     0x77d754cc64a00becULL, 0x90d09c3341687382ULL, 0x294fe02dc31fb651ULL, 0x8372cd1a1c94ae53ULL},
+    {0x8537107a1ac2703bULL, 0xb49258d86bc857b5ULL, 0x57df14debcdaccd1ULL, 0x24ab68d7c4ae8529ULL,
+     0x7ed8b5d4734e59d0ULL, 0x5f8740c8c495cc80ULL, 0x84aedd5a291db9b3ULL, 0x80b360f84fb995beULL}
+  },
+  {
+    {0x55d5c68da61a76faULL, 0x598b441dca1554dcULL, 0xd39923b9773b279cULL, 0x33331d3c36bf9efcULL,
+     0x2d4c848e298de399ULL, 0xcfdb8e77a1a27f56ULL, 0x94c855ea57b8ab70ULL, 0xdcdb9dae6f7879baULL},
+    {0x4c4f07367f636a38ULL, 0x9f943fb70e76d5cbULL, 0xb03510baa8b68b8bULL, 0xc246780a9ed07a1fULL,
+     0x3c0514156d549fc2ULL, 0xc2953f31607781caULL, 0x955e2c69d8d95413ULL, 0xb300fadc7bd282e3ULL},
+    {0xa14b1163c27901b4ULL, 0xfd9236e0899b8bf3ULL, 0x42b091eccbc6da0aULL, 0xbb1dac6f5ad1d297ULL,
+     0x80e61d53a91cf76eULL, 0x4110a412d31f1ee7ULL, 0x2d87c3ba13efcf77ULL, 0x1f374bb4df450d76ULL},
+    {0x202886024147519aULL, 0xd0981eac26b372f0ULL, 0xa9d4a7caa785ebc8ULL, 0xd953c50ddbdf58e9ULL,
+     0x9d6361ccfd590f8fULL, 0x72e9626b44e6c917ULL, 0x7fd9611022eb64cfULL, 0x863ebb7e9eb288f3ULL},
+    {0x15e10a0a097e4403ULL, 0xcb3d0a8619854665ULL, 0x88d8e211d67d4826ULL, 0xb39af66e0b9d2839ULL,
+     0xa5f94588bd475ca8ULL, 0xe06b7966c077b80bULL, 0xfedb1485da27c26cULL, 0xd290d33afe0fd5e0ULL},
+    {0x686202f31306583dULL, 0x05b10da0437c622eULL, 0xbf9aaa0f076a7bc8ULL, 0x25e94efb8f8f4e43ULL,
+     0x8a35c9b7fa3dc26dULL, 0xe0e5fb9396ff03c5ULL, 0xa77e3843ebc394ceULL, 0xcede65958361de60ULL},
+    {0xbf9075090c22b540ULL, 0x2cde42aab7c267d4ULL, 0xba18f9ed5ab0d693ULL, 0x3ba62aa66e4660d9ULL,
+     0xb24bf97bab9ea96aULL, 0x5d039642e3b60e32ULL, 0x4e6a45067c4d9bd5ULL, 0x666c5b9e7ed4a6a4ULL},
+    {0x877b7cf5678a31b0ULL, 0xd50301ae3998b620ULL, 0x734257c5c00fb396ULL, 0xf9fb18a004e672a6ULL,
+     0xff8bd8ebe8758851ULL, 0x1e64e4c65d99ba44ULL, 0x4b8eaedf7dfd93b7ULL, 0xba2f2a9804e76b8cULL},
+    {0xae02a2f09b56ddbdULL, 0x1339b5ac8a2f1cf3ULL, 0xf2b569c7839dff0dULL, 0xb0b9e864fee9a43dULL,
+     0x4ff8ca4177bb064eULL, 0x145a2812fd249f63ULL, 0x3ab7beacf86f689aULL, 0x9bafec2701d35f5eULL},
+    {0xbba23fddae57c7b7ULL, 0x345342f21b932522ULL, 0xfd9c80fe556d4aa3ULL, 0xa03907ba6525bb61ULL,
+     0x38b010e1ff218933ULL, 0xc066b654aa52117bULL, 0x8e14192094f2e6eaULL, 0x66a27dca0d32f2b2ULL},
+    {0xb2e6b121fbabbe92ULL, 0x281850fbe1330076ULL, 0x093581ec97890015ULL, 0x69b1dded75ff77f5ULL,
+     0x7cf0b18fab105105ULL, 0x953ced31a89ccfefULL, 0x3151f85feb914009ULL, 0x3c9f1b8788ed48adULL},
+    {0xa18f07e0e90fb21eULL, 0x00fd2b80bba7fca1ULL, 0x20387f2795cd67b5ULL, 0x5b89a4e7d39707f7ULL,
+     0x8f83ad3f894407ceULL, 0xa0025b946c226132ULL, 0xc79563c7f906c13bULL, 0x5f548f314e7bb025ULL},
+    {0xff7589494fde0c1fULL, 0xbf8a1abee5b6ec20ULL, 0x702278fb87e1db6cULL, 0xc447ad7a35ed658fULL,
+     0x48d4aa3803d0ccf2ULL, 0x80acb338819a7c03ULL, 0x9bc7c89e6e17ceccULL, 0x46736b8b03be1d82ULL},
+    {0x2126f742d43b5eaaULL, 0x054a0766dfa59b85ULL, 0x9d0d5e36126bfd45ULL, 0xa1f8fbd7384f8a8fULL,
+     0x317680f5d563fcccULL, 0x48ca5055f280a928ULL, 0xe00b81b227b578cfULL, 0x10aad9182994a514ULL},
+    {0xe63f301f358bcdc0ULL, 0x07689e990a9d47f8ULL, 0x1f689e2f4f43d43aULL, 0x4d542a1690920904ULL,
+     0xaea293d59ca0a707ULL, 0xd061fe458ac68065ULL, 0x1033bf1b0090008cULL, 0x29749558c08a6db6ULL},
+    {0x0ee6d3a7c35d8794ULL, 0x042e65580356bae5ULL, 0x9f59698d643322fdULL, 0x9379ae1550a61967ULL,
+     0x64b9ae62fcc9981eULL, 0xaed3d6316d2934c6ULL, 0x2454b3025e4e65ebULL, 0xab09f647f9950428ULL}
+  },
+  {
+    {0xb2083a1222248accULL, 0x1f6ec0ef3264e366ULL, 0x5659b7045afdee28ULL, 0x7a823a40e6430bb5ULL,
+     0x24592a04e1900a79ULL, 0xcde09d4ac9ee6576ULL, 0x52b6463f4b5ea54aULL, 0x1efe9ed3d3ca65a7ULL},
+    {0xe27a6dbe305406ddULL, 0x8eb7dc7fdd5d1957ULL, 0xf54a6876387d4d8fULL, 0x9c479409c7762de4ULL,
+     0xbe4d5b5d99b30778ULL, 0x25380c566e793682ULL, 0x602d37f3dac740e3ULL, 0x140deabe1566e4aeULL},
+    {0x4481d067afd32acfULL, 0xd8f0fccae1f71ccfULL, 0xd208dd0cb596f2daULL, 0xd049d7309aad93f9ULL,
+     0xc79f263d42ab580eULL, 0x09411bb123f707b4ULL, 0x8cfde1ff835e0edaULL, 0x7270749090f03402ULL},
+    {0xeaee6126c49a861eULL, 0x024f3b65e14f0d06ULL, 0x51a3f1e8c69bfc17ULL, 0xc3c3a8e9a7686381ULL,
+     0x3400752cb103d4c8ULL, 0x02bc46139218b36bULL, 0xc67f75eb7651504aULL, 0xd6848b56d02aebfaULL},
+    {0xbd9802e6c30fa92bULL, 0x5a70d96d9a552784ULL, 0x9085c4ea3f83169bULL, 0xfa9423bb06908228ULL,
+     0x2ffebe12fe97a5b9ULL, 0x85da604971b99118ULL, 0x9cbc2f7f63178846ULL, 0xfd96bc709153218eULL},
+    {0x958381db1782269bULL, 0xae34bf792597e550ULL, 0xbb5c60645f385153ULL, 0x6f0e96afe3088048ULL,
+     0xbf6a021577884456ULL, 0xb3b5688c69310ea7ULL, 0x17c9429504fad2deULL, 0xe020f0e517896d4dULL},
+    {0x730ba0ab0976505fULL, 0x567f6813095e2ec5ULL, 0x470620106331ab71ULL, 0x72cfa97741d22b9fULL,
+     0x33e55ead8a2373daULL, 0xa8d0d5f47ba45a68ULL, 0xba1d8f9c03029d15ULL, 0x8f34f1ccfc55b9f3ULL},
+    {0xcca4428dbbe5a1a9ULL, 0x8187fd5f3126bd67ULL, 0x0036973a48105826ULL, 0xa39b6663b8bd61a0ULL,
+     0x6d42deef2d65a808ULL, 0x4969044f94636b19ULL, 0xf611ee47dd5d564cULL, 0x7b2f3a49d2873077ULL},
+    {0x94157d45300eb294ULL, 0x2b2a656e169c1494ULL, 0xc000dd76d3a47aa9ULL, 0xa2864e4fa6243ea4ULL,
+     0x82716c47db89842eULL, 0x12dfd7d761479fb7ULL, 0x3b9a2c56e0b2f6dcULL, 0x46be862ad7f85d67ULL},
+    {0x03b0d8dd0f82b214ULL, 0x460c34f9f103cbc6ULL, 0xf32e5c0318d79e19ULL, 0x8b8888baa84117f8ULL,
+     0x8f3c37dcc0722677ULL, 0x10d21be91c1c0f27ULL, 0xd47c8468e0f7a0c6ULL, 0x9bf02213adecc0e0ULL},
+    {0x0baa7d1242b48b99ULL, 0x1bcb665d48424096ULL, 0x8b847cd6ebfb5cfbULL, 0x87c2ae569ad4d10dULL,
+     0xf1cbb1220de36726ULL, 0xe7043c683fdfbd21ULL, 0x4bd0826a4e79d460ULL, 0x11f5e5984bd1a2cbULL},
+    {0x97554160b7fe7b6eULL, 0x7d16189a400a3fb2ULL, 0xd73e9beae328ca1eULL, 0x0dd04b97e793d8ccULL,
+     0xa9c83c9b506db8ccULL, 0x5cd47aaecf38814cULL, 0x26fc430db64b45e6ULL, 0x079b5499d818ea84ULL},
+    {0xebb01102c1c24a3bULL, 0xca24e5681c161c1aULL, 0x103eea6936f00a4aULL, 0x9ad76ee876176c7bULL,
+     0x97451fc2538e0ff7ULL, 0x94f898096604b3b0ULL, 0x6311436e3249cfd7ULL, 0x27b4a7bd41224f69ULL},
+    {0x03b5d21ae0ac2941ULL, 0x279b0254c2d31937ULL, 0x3307c052cac992d0ULL, 0x6aa7cb92efa8b1f3ULL,
+     0x5a1825800d37c7a5ULL, 0x13380c37342d5422ULL, 0x92ac2d66d5d2ef92ULL, 0x035a70c9030c63c6ULL},
+    {0xc16025dd4ce4f152ULL, 0x1f419a71f9df7c06ULL, 0x6d5b221491e4bb14ULL, 0xfc43c6cc839fb4ceULL,
+     0x49f06591925d6b2dULL, 0x4b37d9d362186598ULL, 0x8c54a971d01b1629ULL, 0xe1a9c29f51d50e05ULL},
+    {0x5109b78571ba1861ULL, 0x48b22d5cd0c8f93dULL, 0xe8fa84a78633bb93ULL, 0x53fba6ba5aebbd08ULL,
+     0x7ff27df3e5eea7d8ULL, 0x521c879668ca7158ULL, 0xb9d5133bce6f1a05ULL, 0x2d50cd53fd0ebee4ULL}
+  },
+  {
+    {0x889f6d65533ef217ULL, 0x7158c7e4c3ca2e87ULL, 0xfb670dfbdc2b4167ULL, 0x75910a01844c257fULL,
+     0xf336bf07cf88577dULL, 0x22245250e45e2aceULL, 0x2ed92e8d7ca23d85ULL, 0x29f8be4c2b812f58ULL},
+    {0xfbb9b2452133ffd9ULL, 0x39a8b2f1830f1a20ULL, 0x484bc97dd5a1f52aULL, 0xd6aebf56a40eddf8ULL,
+     0x32257acb76ccdac6ULL, 0xaf4d36ec1586ff27ULL, 0x8eaa8863f8de7dd1ULL, 0x0045d5cf88647c16ULL},
+    {0xc51e414351facc61ULL, 0xbaf2647de68a25bcULL, 0x8f5271a00ff872edULL, 0x8f32ef993d2d9659ULL,
+     0xca12488c7593cbd4ULL, 0xed266c5d02b82fabULL, 0x0a2f78ad14eb3f16ULL, 0xc34049484d47afe3ULL},
+    {0xa6f3d574c005979dULL, 0xc2072b426a40e350ULL, 0xfca5c1568de2ecf9ULL, 0xa8c8bf5ba515344eULL,
+     0x97aee555114df14aULL, 0xd4374a4dfdc5ec6bULL, 0x754cc28f2ca85418ULL, 0x71cb9e27d3c41f78ULL},
+    {0x09c1670209470496ULL, 0xa489a5edebd23815ULL, 0xc4dde4648edd4398ULL, 0x3ca7b94a80111696ULL,
+     0x3c385d682ad636a4ULL, 0x6702702508dc5f1eULL, 0x0c1965deafa21943ULL, 0x18666e16610be69eULL},
+    {0x6792fd350369c8e1ULL, 0x9271aa62b9dc843bULL, 0x8711a4b14d02e2abULL, 0x02b2a3e27ee1a383ULL,
+     0xb226e35f0e2b379bULL, 0x3d3de39cd652ab25ULL, 0xaca6d4c93b560106ULL, 0xeced0cf4c95bd877ULL},
+    {0x45beb4ca2a604b3bULL, 0x56f651843a616762ULL, 0xf52f5a70978b806eULL, 0x7aa3978711dc4480ULL,
+     0xe13fac2a0e01fabcULL, 0x7c6ee8a5237d99f9ULL, 0x251384ee05211ffeULL, 0x4ff6976d1bc9d3ebULL},
+    {0x8910507903605c39ULL, 0xf0843d9ea142c96cULL, 0xf374493416923684ULL, 0x732caa2ffa0a2893ULL,
+     0xb2e8c27061160170ULL, 0xc32788cc437fbaa3ULL, 0x39cd818ea6eda3acULL, 0xe2e942399e2b2e07ULL},
+    {0xdde0492316e043a2ULL, 0x98a452611dd3d209ULL, 0xeaf9f61bd431ebe8ULL, 0x00919f4dbaf56abdULL,
+     0xe42417db6d8774b1ULL, 0x5fc5279c58e0e309ULL, 0x64aa40613adf81eaULL, 0xef419edabc627c7fULL},
+    {0x3919759239ef620fULL, 0x9d47284074fa29c4ULL, 0x4e428fa39d416d83ULL, 0xd1a7c25129f30269ULL,
+     0x46076e1cd746218fULL, 0xf3ad6ee8110d967eULL, 0xfbb5f434a00ae61fULL, 0x3cd2c01980d4c929ULL},
+    {0xfa24d0537a4af00fULL, 0x3f938926ca294614ULL, 0x0d700c183982182eULL, 0x801334434cc59947ULL,
+     0xf0397106ec87c925ULL, 0x62bd59fc0ed6665cULL, 0xe8414348c7cca8b5ULL, 0x574c76209f9f0a30ULL},
+    {0x6967d39b0260e52aULL, 0xd42585cc90653325ULL, 0x0d9bd60521ca7954ULL, 0x4fa2087781ed57b3ULL,
+     0x60c1eff8e34a0bbeULL, 0x56b0040c84f6ef64ULL, 0x28be2b24b1af8483ULL, 0xb2278163f5531614ULL},
+    {0x95be42e2bb8b6a07ULL, 0x64be74eeca23f86aULL, 0xa73d74fd154ce470ULL, 0x1c2d2857d8dc076aULL,
+     0xb1fa1c575a887868ULL, 0x38df8e0b3de64818ULL, 0xd88e52f9c34e8967ULL, 0x274b4f018b4cc76cULL},
+    {0x59c81ec2c11c208bULL, 0x240207da4e3a7234ULL, 0x4957eb80f4a089d8ULL, 0xc86960bc2137a072ULL,
+     0xde1154fd7f1a932cULL, 0xb517fe74d3f2fa17ULL, 0x2d5d94557111c0ebULL, 0x2aa3378980929d36ULL},
+    {0x3f5c05b4f8b7559dULL, 0x0be4c7acfae29200ULL, 0xdd6d3ef756532accULL, 0xf6c3ed87eea7a285ULL,
+     0xe463b0a8f46ec59bULL, 0x531d9b14ecea6c83ULL, 0x3d6bdbafc2dc836bULL, 0x3ee501e92ab27f0bULL},
+    {0x8df275455922ac1cULL, 0xa7b3ef5ca52b3f63ULL, 0x8e77b21471de57c4ULL, 0x31682c10834c008bULL,
+     0xc76824f04bd55d31ULL, 0xb6d1c08617b61c71ULL, 0x31db0903c2a5089dULL, 0x9c092172184e5d3fULL}
+  },
+  {
+    {0x5ace5035ea6c3997ULL, 0x54259aaac2610befULL, 0xef18bb3f3c80dd39ULL, 0x6910b95b5fc3fa39ULL,
+     0xfce2f51043e09aeeULL, 0xced56c9fa7675665ULL, 0x10e265acd872db61ULL, 0x6982812eae9fce69ULL},
+    {0xb8fa3d931341ed7aULL, 0x4223272ca7b59d49ULL, 0x3dcb194783b8c4a4ULL, 0x4e413c01ed1302e4ULL,
+     0x6d999127e17e44ceULL, 0xee86bf7533b3adfbULL, 0xf6902fe625aa96caULL, 0xb73540e4e5aae47dULL},
+    {0xcc50ef6c872b4a60ULL, 0xab2a34a44613521bULL, 0x39c5c190983e15d1ULL, 0x61dde5df59905512ULL,
+     0xe417f6219f2275f3ULL, 0x0750c8b6451d894bULL, 0x75b04ab978b0bdaaULL, 0x3bfd9fd4458589bdULL},
+    {0xaafcbfabaf95894cULL, 0x7b9bdc07276b2241ULL, 0xeaf983625bdda48bULL, 0x5977faf2a3fcb4dfULL,
+     0xbed042ef052c4b5bULL, 0x9fe87f71067591f0ULL, 0xc89c73ca22f24ec7ULL, 0x7d37fa9ee64a9f1bULL},
+    {0xbd78148045ee2f40ULL, 0x75e354af416b60cfULL, 0xde0b58a18d49a8c4ULL, 0xe40e94e2fa359536ULL,
+     0xbd4fa59f62accd76ULL, 0x05cf466a8c762837ULL, 0xb5abda99448c277bULL, 0x5a9e01bf48b13740ULL},
+    {0xb51e55e6f2606a82ULL, 0xe25f706190f2fb57ULL, 0xacef6c2ab1a4e37cULL, 0x864e359d5dcf2706ULL,
+     0x479e6b187ce57316ULL, 0x2cab25003a96b23dULL, 0xed4898628ef16df7ULL, 0x2056538cef3758b5ULL},
+    {0xef69a0c3d41d3bd3ULL, 0xb533b8c907a26bdeULL, 0xe2801d97db2edf9fULL, 0xdc4a8269e1877af0ULL,
+     0x6c1c58513d590dbeULL, 0x84632f6bee4e9357ULL, 0xd36d36b779b33374ULL, 0xb46833e39bbca2e6ULL},
+    {0xcc7a64880a750c0fULL, 0x39bacfe34e548e83ULL, 0x3d418c760c110f05ULL, 0x3e4daa4cb1f11588ULL,
+     0x2733e7b55ffc69ffULL, 0x46f147bc92053127ULL, 0x885b2434d722df94ULL, 0x6a444f65e6fc6b7cULL},
+    {0x008be4bb346ac9cbULL, 0x2e6cb02429811bb2ULL, 0xa6ccc747f41540c1ULL, 0xf119334efbf6de47ULL,
+     0x4e6bffe9cc97fe6eULL, 0x7f4b578bf3d82883ULL, 0x459db722753dd1c7ULL, 0x05843cd82066b495ULL},
+    {0x7cb88cd5dbf2af33ULL, 0xded9566eaf6b0eabULL, 0xd1caf5488e40d844ULL, 0x3ae59bd67ce1f67fULL,
+     0xacf4ad33dd82429eULL, 0xcc7ebd2bbc4467c7ULL, 0xf4f6e95de783d011ULL, 0x5197e39116e92db7ULL},
+    {0xd4f2031885e7a4afULL, 0x291bf9a0f7a6878dULL, 0xadd8b6eebd051913ULL, 0x174f5124f36be034ULL,
+     0x2ac3364527f60189ULL, 0xd8902eed8b37ec73ULL, 0x546166a11cfdb42eULL, 0x31c4e3b807076421ULL},
+    {0x7de29dfdbc6ebdfbULL, 0xa1ee450589de549bULL, 0xfd7181aa3ef26a64ULL, 0x003179eedf2f3980ULL,
+     0x1bce4d30fd71bc78ULL, 0xeb842b14be86a583ULL, 0xe00125dc5eb85711ULL, 0x9f586983ff11f405ULL},
+    {0x5b5a089eb833eccbULL, 0xc1b3077a7bc51c79ULL, 0xe581157f9fbe0e93ULL, 0xab487d695b29b172ULL,
+     0xc72551082222f24bULL, 0x338cd22cf6dd35dfULL, 0x92010e6f5fc24afeULL, 0xf8298f15681d46edULL},
+    {0x2ce7f723042389edULL, 0xdf7de0d5a54b1972ULL, 0xb8ea2e142c251d75ULL, 0xd22a4d37f4e8e8c8ULL,
+     0xe99958566c29c8bcULL, 0x9fefdbfe1d1e201eULL, 0xb97d946edac885c9ULL, 0xf6ea9767d38eac70ULL},
+    {0x9aaca8e974e75a2eULL, 0xcda6fc1eadac968fULL, 0x3f6651bf46306befULL, 0xc7445e4ecb2ed7f9ULL,
+     0x584a12d8d1571ac1ULL, 0x684846c4daf3a679ULL, 0xcfc622a9863fbc43ULL, 0x2f9e101dea6814f2ULL},
+    {0x7a1a465ac3f16ea8ULL, 0x115a461db2f1d11cULL, 0x4767dd956c68a172ULL, 0x3392f2ebd13a4698ULL,
+     0xc7a99ccde526cdc7ULL, 0x8e537fdc22292b81ULL, 0x76d8cf69a6d39198ULL, 0xffc5ff432446852dULL}
+  },
+  {
+    {0x97b14f7ea90567e6ULL, 0x513257b7b6ae5cb7ULL, 0x85454a3c9f10903dULL, 0xd8d2c9ad69bc3724ULL,
+     0x38da93246b29cb44ULL, 0xb540a21d77c8cbacULL, 0x9bbfe43501918e42ULL, 0xfffa707a56c3614eULL},
+    {0x56c2e05b1cb76219ULL, 0x0ec0bf9171567e7eULL, 0xe7076f8661c4c910ULL, 0xd67b085bbabc04d9ULL,
+     0x9fb904595e93a96aULL, 0x7526c1eafbdc249aULL, 0x0d44d367ecdd0bb7ULL, 0x953999179dc0d695ULL},
+    {0x2ccbc583a4c506ecULL, 0x957ed188d1acfe97ULL, 0x8baed83312f1aea2ULL, 0xef2a6cb48325362dULL,
+     0x130dde428e195c43ULL, 0xc842025a0e6050c6ULL, 0x2da972a708686a5dULL, 0xb52999a1e508b4a8ULL},
+    {0x83f49167ceca9754ULL, 0x426d2cf64b7939a0ULL, 0x2555e355723fd0bfULL, 0xa96e6d06c4f144e2ULL,
+     0x4768a8dd87880e61ULL, 0x15543815e508e4d5ULL, 0x09d7e772b1b65e15ULL, 0x63439dd6ac302fa0ULL},
+    {0xb11df8e1698e04ccULL, 0x877be203169005c8ULL, 0x32749e8c4f3c6179ULL, 0x2dbc9d0a7853fc05ULL,
+     0x187d4f939454d937ULL, 0xe682ce9db4800e1bULL, 0xa9129ad8165e68e8ULL, 0x0fe29735be7f785bULL},
+    {0x31019ccf3a4434b4ULL, 0xa34581111a7954dcULL, 0xa9dac80de34972a7ULL, 0xb043d05474f6b8ddULL,
+     0x021c319e11137b1aULL, 0x00a754ceed5cc03fULL, 0x0aa2c794cbea5ad4ULL, 0x093e67f470c015b6ULL},
+    {0x20ac0351d598d710ULL, 0x272c4166cb3a4da4ULL, 0xdb82fe1aca71de1fULL, 0x746e79f2d8f54b0fULL,
+     0x6e7fc7364b573e9bULL, 0x75d03f46fd4b5040ULL, 0x5c1cc36d0b98d87bULL, 0x513ba3f11f472da1ULL},
+    {0x859d3145983c38b5ULL, 0xb14f176c637abc8bULL, 0x2793fb9dcaff7be6ULL, 0xebe5a55f35a66a5aULL,
+     0x7cec1dcd9f87dc59ULL, 0x7c595cd3fbdbf560ULL, 0x5b543b2226eb3257ULL, 0x69080646c4c935fdULL},
+    {0xdca3b70678a6513bULL, 0x92ea4a2a9edb1943ULL, 0x02642216db6e2dd8ULL, 0x9b45d0b49fd57894ULL,
+     0x114e70dbc69d11aeULL, 0x1477dd194c57595fULL, 0xbc2208b4ec77c272ULL, 0x95c5b4d7db68f59cULL},
+    {0xfe541fa47ea67c77ULL, 0x952bd2afe3ea810cULL, 0x791fef568d01d374ULL, 0xa3a1c6210f11336eULL,
+     0x5ad0d5a9c7ec6d79ULL, 0xff7038af3225c342ULL, 0x003c6689bc69601bULL, 0x25059bc745e8747dULL},
+    {0x9a75c80676cb2566ULL, 0x8f76acb1b24892d9ULL, 0x7ae7b9cc1f08fe45ULL, 0x19ef73296a4907d8ULL,
+     0x2db4ab715f228bf0ULL, 0xf3cdea39817032d7ULL, 0x0b1f482edcabe3c0ULL, 0x3baf76b4bb86325cULL},
+    {0x6aac688eadd70482ULL, 0x708de92a7b4a4e8aULL, 0x75b6dd73758a6eefULL, 0xea4bf352725b3c43ULL,
+     0x10041f2c87912868ULL, 0xb1b1be95ef09297aULL, 0x19ae23c5a9f3860aULL, 0xc4f0f839515dcf4bULL},
+    {0xc71e27bf8538a5c6ULL, 0x195c63dd89abff17ULL, 0xfd3152851b71e3daULL, 0x9cbdfda7fa680fa0ULL,
+     0x9db876ca849d7eabULL, 0xebe2764b3c273271ULL, 0x663357e3f208dceaULL, 0x8c5bd833565b1b70ULL},
+    {0x75900d7c2fa4f126ULL, 0x08a3b8655c99a232ULL, 0x2478b6bfdb25e0c3ULL, 0x482cc2c271db2edfULL,
+     0x37df7e645f321bb8ULL, 0x8a93821b9a8005b4ULL, 0x3fa2f10ccc8c1958ULL, 0x0d3322182c269d0aULL},
+    {0xba5514df3fd165e8ULL, 0x499fd6a9061f8811ULL, 0x72cd1fe0bfef9f00ULL, 0x120a4bb979ad7e8aULL,
+     0xf2ffd0955f4a5ac5ULL, 0xcfd174f195a7a2f0ULL, 0xd42301ba9d17baf1ULL, 0xd2fa487a77f22089ULL},
+    {0xb93452381d531696ULL, 0x57201c0088cdde69ULL, 0xdde922519a86afc7ULL, 0xe3043895bd35cea8ULL,
+     0x7608c1e18555970dULL, 0x8267dfa92535935eULL, 0xd4c60a57322ea38bULL, 0xe0bf7977804ef8b5ULL}
+  },
+  {
+    {0x6233ea68c094dbb5ULL, 0xb77d062ed968d410ULL, 0x3e719bbc58b3002dULL, 0x68e7dd3d3dc49d58ULL,
+     0x8d825740013a5e58ULL, 0x213117473c9e3c1bULL, 0x0cb0a2a77c99b6abULL, 0x5c48a3b3c2f888f2ULL},
+    {0xc7913e91991724f3ULL, 0x5eda799c39cbd686ULL, 0xddb595c763d4fc1eULL, 0x6b63b80bac4fed54ULL,
+     0x6ea0fc697e5fb516ULL, 0x737708bad0f1c964ULL, 0x9628745f11a92ca5ULL, 0x61f379589a86967aULL},
+    {0x5320fd610979e6b3ULL, 0x1d0bd3e593d40723ULL, 0x0ac006fcaa80baccULL, 0xb1d9c60ed2002515ULL,
+     0x610e7ed0af780b92ULL, 0xf5bf446e80a9ce31ULL, 0x441c011d3c20b54bULL, 0x77f76da1191596c3ULL},
+    {0x9af39b2caa665072ULL, 0x78322fa4efd324efULL, 0x3d153394c327bd31ULL, 0x81d5f2713129dab0ULL,
+     0xc72e0c42f48027f5ULL, 0xaa40cdbc8536e717ULL, 0xf45a657a2d369d0fULL, 0xb03bbfc4ea7f74e6ULL},
+    {0x7a04d5429b6a42eaULL, 0xfa597e853daf41b9ULL, 0x4c58ec27726b0b89ULL, 0xed8eb16a030d43deULL,
+     0x65e1e5e1ec9dcf57ULL, 0xb7a770c1697cff81ULL, 0x1e6d918f9f6e2b22ULL, 0x7c277a9ac64e82b7ULL},
+    {0x46a8c4180d738dedULL, 0x6f1a5bb0e0de5729ULL, 0xf10230b98ba81675ULL, 0x32c6f30c112b33d4ULL,
+     0x7559129dd8fffb62ULL, 0x6a281b47b459bf05ULL, 0x77c1bd3afa3b6776ULL, 0x0709b3807829973aULL},
+    {0x0875e0c1da36cb47ULL, 0xfdf5b7cb1e0210f0ULL, 0x7e0c7e4d3a3787c8ULL, 0xf043f5262b1c741fULL,
+     0x76df1b006d74d72dULL, 0x0514df7338b45ba9ULL, 0xaecf7c3e0a6b797aULL, 0x5e30b285ddeaac39ULL},
+    {0x8c26b232a3326505ULL, 0x38d69272ee1d41bfULL, 0x0459453effe32afaULL, 0xce8143ad7cb3ea87ULL,
+     0x932ec1fa7e6ab666ULL, 0x6cd2d23022286264ULL, 0x459a46fe6736f8edULL, 0x50bf0d009eca85bbULL},
+    {0x15c78f7d605238a5ULL, 0xe9d87842448496abULL, 0xcfcf75d0d210acc1ULL, 0x2948f2295c8c14e2ULL,
+     0xe81fd76de8daf0cbULL, 0xd02d11e4a03be800ULL, 0x0c4df3518778d30cULL, 0x3482bc96965139cbULL},
+    {0x0b825852877a21ecULL, 0x300414a70f537a94ULL, 0x3f1cba4021a9a6a2ULL, 0x50824eee76943c00ULL,
+     0xa0dbfcecf83cba5dULL, 0xf953814893b4f3c0ULL, 0x6174416248f24dd7ULL, 0x5322d64de4fb09ddULL},
+    {0x56b6cf278a448bbcULL, 0x0ca898dfc85251daULL, 0x9082cad836e79b24ULL, 0x2e7b9ed31a8e51a7ULL,
+     0xdc7d318a43e1c802ULL, 0x4750e523cbf8689dULL, 0x9887a072f0071b1aULL, 0x52090f87814bfdc1ULL},
+    {0x574473843d9325f3ULL, 0xa9bef2d0f371cb84ULL, 0x77d2188ba61e36c5ULL, 0xbbd6a7d7c602df72ULL,
+     0xba3aa9028f61bc0bULL, 0xf49085ed6ed0b6a1ULL, 0x8bc625d6ae6e8298ULL, 0x832b0b1da2e9c01dULL},
+    {0x5bebf2196196bc6eULL, 0x0e66736bef097efdULL, 0x1128f3b8ea87293aULL, 0x2998e4056addfcdeULL,
+     0x55cc31b85d16c961ULL, 0x87a434e12418f056ULL, 0x2e94aaccdc9fe819ULL, 0x94a486c1a56490c6ULL},
+    {0xa337c447f1f0ced1ULL, 0x800cc7939492dd2bULL, 0x4b93151dbea08efaULL, 0x820cf3f8de0a741eULL,
+     0xff1982dc1c0f7d13ULL, 0xef92196084dde6caULL, 0x1ad7d97245f96ee3ULL, 0x319c8dbe29dea0c7ULL},
+    {0x1ff2385bde259ec8ULL, 0xf6b0836a30f67b0dULL, 0x04cc65b006661cffULL, 0x467e6358d4230f5cULL,
+     0xce468c802dbed3d3ULL, 0x7b984262f1920da6ULL, 0x34d257421537479fULL, 0x5c8aa88c87bb8de1ULL},
+    {0xd3ea38717b82b99bULL, 0x75922d4d470eb624ULL, 0x8f66ec543b95d466ULL, 0x66e673ccbee1e346ULL,
+     0x6afe67c4b5f2b89aULL, 0x3de9c1e6290e5cd3ULL, 0x8c278bb6310a2adaULL, 0x420fa3840bdb323bULL}
+  },
+  {
+    {0x646f96796424c49bULL, 0xf888dfe867c241c9ULL, 0xe12d4b9324f68b49ULL, 0x9a6b62d8a571df20ULL,
+     0x81b4b26d179483cbULL, 0x666f96329511fae2ULL, 0xd281b3e4d53aa51fULL, 0x7f96a7657f3dbd16ULL},
+    {0x8553d37c051af62bULL, 0xe9a998eb0bf94496ULL, 0xe0844f9fb0d59aa1ULL, 0x983fd558e6afb813ULL,
+     0x9670c0ca65d69804ULL, 0x732b22de6ea5ff2dULL, 0xd7640ba95fd8623bULL, 0x9f619163a6351782ULL},
+    {0xf167b4e0bdefdd4fULL, 0x69958465f366e401ULL, 0x5aa368aba73bbec0ULL, 0x121487097b240c21ULL,
+     0x378c323318969006ULL, 0xcb4d73cee1fe53d1ULL, 0x5f50a80e130c4361ULL, 0xd67f59517ef5212bULL},
+    {0x332f81088cad38c0ULL, 0x471b7e906bd68ae2ULL, 0x56ac3fb20d8e27a3ULL, 0xb54660db136b4b0dULL,
+     0x123a1e11a6fd8de4ULL, 0x44dbffeaa37799efULL, 0x4540b977ce6ac17cULL, 0x495173a8af60acefULL},
+    {0xeb4437434573eab0ULL, 0x11570dfbd1ac6031ULL, 0xf7d9b45b44dd9afdULL, 0xb8066add22067231ULL,
+     0x15f92ad8f8a3f0b4ULL, 0x9e0e4899e0ace2a2ULL, 0xbdcd0aadfab38b80ULL, 0x46506ae917020052ULL},
+    {0x429a69f78fca399dULL, 0xfe9e27d20207bb63ULL, 0xec655ed68788f582ULL, 0xa426d748adb75f6eULL,
+     0x18695c02ca81c66dULL, 0x84fb8d27a531d425ULL, 0x3a3a8956deff48baULL, 0xaf1d0d56766d2247ULL},
+    {0x5a059565352c4b5cULL, 0x49261531590bc3e2ULL, 0x809f7521f66f9f5fULL, 0x2baef6bfc70a4a9bULL,
+     0xe7e6fa6509ed3561ULL, 0x11370233984b230cULL, 0x2151659bd04cdc69ULL, 0xbdb83c63f007d416ULL},
+    {0x9ebb284d391c2a82ULL, 0xbcdd4863158308e8ULL, 0x006f16ec83f1edcaULL, 0xa13e2c37695dc6c8ULL,
+     0x2ab756f04a057a87ULL, 0xa8765500a6b48f98ULL, 0x4252face68651c44ULL, 0xa52b540be1765e02ULL},
+    {0xcb35a1a85ca37ff0ULL, 0xe1a04f1ccd2f1c8fULL, 0x238816ce15a26112ULL, 0xe206a111095b177eULL,
+     0x3c10b6048a424149ULL, 0xc6a3f56774752cfbULL, 0xbf16a37a47f1dbb8ULL, 0x7c372f9ad31a3dfbULL},
+    {0x122d05b5c20b4d2aULL, 0xff659cf50c662a67ULL, 0xed57c128e8ffc9e9ULL, 0x0fbb15859e987683ULL,
+     0xadd70df247319a2bULL, 0x4b98baba374be470ULL, 0xf03d747356a7b307ULL, 0x342e696e3efebf30ULL},
+    {0xf84b48f7864ac537ULL, 0x04713409a6940d3dULL, 0x014db22d6174c7aeULL, 0xc73a1c438c213034ULL,
+     0x18ac4ea5ffdd93ecULL, 0x724fc7576102783eULL, 0x9fe13fcc91c3e83fULL, 0x92a8c2c8f08f0bf5ULL},
+    {0x7f2e22fd8f67f6deULL, 0xab018833d8693177ULL, 0x266d1db6863eca95ULL, 0x6bb7732b31b5ef2bULL,
+     0x4fa927c6915f80ceULL, 0x6fa1d6d25f90efd8ULL, 0x7bd75de8456b48adULL, 0xd2cb507a845b6429ULL},
+    {0xa72cf82ae255d7ecULL, 0x52025c23a460e204ULL, 0x10ae542d7d5b0a44ULL, 0xa85143109305aedaULL,
+     0x958315f5a14bbfe8ULL, 0x3f361826385365feULL, 0xc2b3a36b66d95040ULL, 0x12c7b3347cf4eda2ULL},
+    {0xa545b4d1e744119dULL, 0x4c93b169829a71e7ULL, 0x2dbb908c6117fcbfULL, 0x4dc97320b35a3d85ULL,
+     0x94c04f856bf88105ULL, 0x452e1bce1b51bc1fULL, 0x0c41ff50b3013af3ULL, 0xf07af445224d7e24ULL},
+    {0xbdb9e57ca3d24f6aULL, 0x8a8246d7f345a763ULL, 0x73bd2a6d98cfbb5fULL, 0x1dd8e85e86ed04dbULL,
+     0x76f2da42c01f420bULL, 0x7ef0547364407bc7ULL, 0x7e98ba7faff548f5ULL, 0x6b7afbeefd30b64aULL},
+    {0x4f922fc516a0d2bbULL, 0x0d5cc16c1a623499ULL, 0x9241cf3a57c62c8bULL, 0x2f5e6961fd1b667fULL,
+     0x5c15c70bf5a01797ULL, 0x3d20b44d60956192ULL, 0x04911b37071fdb52ULL, 0xf648f9168d6f0f7bULL}
+  },
+  {
+    {0x027cc8b8fac61d9aULL, 0x7d25e062e3c6fe8aULL, 0xe08805bfe5bff503ULL, 0x13271e6c6ff632f7ULL,
+     0x55dca6c0232f76a5ULL, 0x8957c32d701ef426ULL, 0xee728bcba10a5178ULL, 0x5ea60411b62c5173ULL},
+    {0x9ad5462bb4d8bc50ULL, 0x181c0b16a9195770ULL, 0xebd4fe1c78412a68ULL, 0xae0341bcc0dff48cULL,
+     0xb6bc45cf7003e866ULL, 0xf11a6dea8a24a41bULL, 0x5407151ad04c24c2ULL, 0x62c9d27dda5b7b68ULL},
+    {0x32865719a8afd30bULL, 0x867983288a826dceULL, 0xdf04e891c4a8fbe0ULL, 0xbb6b6e1bebf56ad3ULL,
+     0x0a695b11471f1ff0ULL, 0xd76c3389be15baf0ULL, 0x018edb95be96c43eULL, 0xf2beaaf490794158ULL},
+    {0x0a50b12e523b8bf6ULL, 0x8009eb5b8f910c1bULL, 0xf535af824a167588ULL, 0x0f835f9cfb2a2abdULL,
+     0xf59b29312afceb62ULL, 0xc797df2a169d383fULL, 0xeb3f5fb066ac02b0ULL, 0x029d4c6fdaa2d0caULL},
+    {0x87a7ebd1e0a1b12aULL, 0x1e4ef88d770ba95fULL, 0x8c33345cdc2ae9cbULL, 0xcecf127601cc8403ULL,
+     0x687c012e1b39b80fULL, 0xfd90d0ad35c33ba4ULL, 0xa3ef5a675c9661c2ULL, 0x368fc88ee017429eULL},
+    {0xb82226052b7ce542ULL, 0xe6d4ce997472bde1ULL, 0x53e16ebe09d2f4daULL, 0x180ff42e53b92b2eULL,
+     0xc59bcc022c34a1c6ULL, 0x3803d6f9422c46c2ULL, 0x18aff74f5c14a8a2ULL, 0x55aebf8010a08b28ULL},
+    {0xb956970e2fdd23ccULL, 0xb80288bc5682e971ULL, 0xe6e6d91e9ae86ebcULL, 0x0564c83f8c9f1939ULL,
+     0x551932a239560368ULL, 0xe893752b049c28e2ULL, 0x0b03cee5a6a158c3ULL, 0xe12d656b04964263ULL},
+    {0x58af2010f5b343bcULL, 0x0f2e400af2f142feULL, 0x3483bfdea85f4bdfULL, 0xf0b1d09303bfeaa9ULL,
+     0x2ea01b95c7081603ULL, 0xe943e4c93dba1097ULL, 0x47be92adb438f3a6ULL, 0x00bb7742e5bf6636ULL},
+    {0x4ed714576be5f7deULL, 0xd93006f8c2263c9eULL, 0xe073694ccacacb36ULL, 0x2ff7a5b43ae118abULL,
+     0x3cce53f1cd871236ULL, 0xf156a39dc2aa6d52ULL, 0x9cc5f271b198d76dULL, 0xbc615b6f81383d39ULL},
+    {0x137a4fb486df2a61ULL, 0xa1ed9c07ecf7b4a2ULL, 0xb2e460e27bd042ffULL, 0xb7f5e2fa5f62f5ecULL,
+     0x7aa6ec6bcc2423b7ULL, 0x75ce0a7fba63eea7ULL, 0x67a45fb1f250a6e1ULL, 0x93bc919ce53cdc9fULL},
+    {0x67930af231f63950ULL, 0xa77797c114caa2c9ULL, 0x526e80ee27ac7e62ULL, 0xe1e6e62658b28aecULL,
+     0x636178b0b3c9fef0ULL, 0xaf7752e06d5f90beULL, 0x94ecaf18eece51cfULL, 0x2864d0edca806e1fULL},
+    {0xec2fccaaddce3345ULL, 0x2a6811b7012a4350ULL, 0x96760ff1ac598bdcULL, 0x054d652ad1bf4128ULL,
+     0x0a1151d492a21005ULL, 0xad7f397133110fdfULL, 0x8c95928c1960100fULL, 0x6c91c8257bf03362ULL},
+    {0x17785b7799eb6df0ULL, 0x26c3cc517386b779ULL, 0x345ed9886417a48eULL, 0xe990b4e407d6ef31ULL,
+     0x0f456b7e2586abbaULL, 0x239ca6a559c96e9aULL, 0xe327459ce2eb4206ULL, 0x3a4c3313a002b90aULL},
+    {0x19e6125dec3f1decULL, 0x07b1f040911178daULL, 0xd93ededa904a6738ULL, 0x55187a5a0bebedcdULL,
+     0xf7d04722eb329d41ULL, 0xf449099ef170b391ULL, 0xfd317a69ca99f828ULL, 0x50c3db2b34a4976dULL},
+    {0x3806b69b92222f1fULL, 0x5a2459ca6cf7ae70ULL, 0x6789f69ca85217eeULL, 0x5f232b5ee3dc85acULL,
+     0x660e3ec548e9e516ULL, 0x124b4e473197eb31ULL, 0x10a0cb13aafcca23ULL, 0x7bd63ba48213224fULL},
+    {0xb674481b7bfe7178ULL, 0x4e1debae65405868ULL, 0x061b2821c48c867dULL, 0x69c15b35513b30eaULL,
+     0x3b4a166636871088ULL, 0xe5e29f5d1220b1ffULL, 0x4b82bb35233d9f4dULL, 0x4e07633318cdc675ULL}
+  },
+  {
+    {0x0d53f5c7a3e6fcedULL, 0xe8cbbdd5f45fbdebULL, 0xf85c01df13339a70ULL, 0x0ff71880142ceb81ULL,
+     0x4c4e8774bd70437aULL, 0x5fb32891ba0bda6aULL, 0x1cdbebd2f18bd26eULL, 0x2f9526f103a9d522ULL},
+    {0x40ce305192c4d684ULL, 0x8b04d7257612efcdULL, 0xb9dcda366f9cae20ULL, 0x0edc4d24f058856cULL,
+     0x64f2e6bf85427900ULL, 0x3de81295dc09dfeaULL, 0xd41b4487379bf26cULL, 0x50b62c6d6df135a9ULL},
+    {0xd4f8e3b4c72dfe67ULL, 0xc416b0f690e19fdfULL, 0x18b9098d4c13bd35ULL, 0xac11118a15b8cb9eULL,
+     0xf598a318f0062841ULL, 0xbfe0602f89f356f4ULL, 0x7ae3637e30177a0cULL, 0x3409774761136537ULL},
+    {0x0db2fb5ed005832aULL, 0x5f5efd3b91042e4fULL, 0x8c4ffdc6ed70f8caULL, 0xe4645d0bb52da9ccULL,
+     0x9596f58bc9001d1fULL, 0x52c8f0bc4e117205ULL, 0xfd4aa0d2e398a084ULL, 0x815bfe3a104f49deULL},
+    {0x97e5443f23885e5fULL, 0xf72f8f99e8433aabULL, 0xbd00b154e4d4e604ULL, 0xd0b35e6ae5e173ffULL,
+     0x57b2a0489164722dULL, 0x3e3c665b88761ec8ULL, 0x6bdd13973da83832ULL, 0x3c8b1a1e73dafe3bULL},
+    {0x4497ace654317cacULL, 0xbe600ab9521771b3ULL, 0xb42e409eb0dfe8b8ULL, 0x386a67d73942310fULL,
+     0x25548d8d4431cc28ULL, 0xa7cff142985dc524ULL, 0x4d60f5a193c4be32ULL, 0x83ebd5c8d071c6e1ULL},
+    {0xba3a80a7b1fd2b0bULL, 0x9b3ad3965bec33e8ULL, 0xb3868d6179743fb3ULL, 0xcfd169fcfdb462faULL,
+     0xd3b499d79ce0a6afULL, 0x55dc1cf1e42d3ff8ULL, 0x04fb9e6cc6c3e1b2ULL, 0x47e6961d6f69a474ULL},
+    {0x54eb3acce548b37bULL, 0xb38e754284d40549ULL, 0x8c3daa517b341b4fULL, 0x2f6928ec690bf7faULL,
+     0x0496b32386ce6c41ULL, 0x01be1c5510adadcdULL, 0xc04e67e74bb5faf9ULL, 0x3cbaf678e15c9985ULL},
+    {0x8cd1214550ca4247ULL, 0xba1aa47ae7dd30aaULL, 0x2f81ddf1e58fee24ULL, 0x03452936eec9b0e8ULL,
+     0x8bdc3b81243aea96ULL, 0x9a2919af15c3d0e5ULL, 0x9ea640ec10948361ULL, 0x5ac86d5b6e0bcccfULL},
+    {0xf892d918c36cf440ULL, 0xaed3e837c939719cULL, 0xb07b08d2c0218b64ULL, 0x6f1bcbbace9790ddULL,
+     0x4a84d6ed60919b8eULL, 0xd89007918ac1f9ebULL, 0xf84941aa0dd5daefULL, 0xb22fe40a67fd62c5ULL},
+    {0x97e15ba2157f2db3ULL, 0xbda2fc8f8e28ca9cULL, 0x5d050da437b9f454ULL, 0x3d57eb572379d72eULL,
+     0xe9b5eba2fb5ee997ULL, 0x01648ca2e11538caULL, 0x32bb76f6f6327974ULL, 0x338f14b8ff3f4bb7ULL},
+    {0x524d226ad7ab9a2dULL, 0x9c00090d7dfae958ULL, 0x0ba5f5398751d8c2ULL, 0x8afcbcdd3ab8262dULL,
+     0x57392729e99d043bULL, 0xef51263baebc943aULL, 0x9feace9320862935ULL, 0x639efc03b06c817bULL},
+    {0x1fe054b366b4be7aULL, 0x3f25a9de84a37a1eULL, 0xf39ef1ad78d75cd9ULL, 0xd7b58f495062c1b5ULL,
+     0x6f74f9a9ff563436ULL, 0xf718ff29e8af51e7ULL, 0x5234d31315e97fecULL, 0xb6a8e2b1292f1c0aULL},
+    {0xa7f53aa8327720c1ULL, 0x956ca322ba092cc8ULL, 0x8f03d64a28746c4dULL, 0x51fe178266d0d392ULL,
+     0xd19b34db3c832c80ULL, 0x60dccc5c6da2e3b4ULL, 0x245dd62e0a104cccULL, 0xa7ab1de1620b21fdULL},
+    {0xb293ae0b3893d123ULL, 0xf7b75783b15ee71cULL, 0x5aa3c61442a9468bULL, 0xd686123cdb15d744ULL,
+     0x8c616891a7ab4116ULL, 0x6fcd72c8a4e6a459ULL, 0xac21911077e5fad7ULL, 0xfb6a20e7704fa46bULL},
+    {0xe839be7d341d81dcULL, 0xcddb688932148379ULL, 0xda6211a1f7026eadULL, 0xf3b2575ff4d1cc5eULL,
+     0x40cfc8f6a7a73ae6ULL, 0x83879a5e61d5b483ULL, 0xc5acb1ed41a50ebcULL, 0x59a60cc83c07d8faULL}
+  },
+  {
+    {0x439530b665c7322dULL, 0xcf12cc01b3c1b3fbULL, 0xc70b01860172f685ULL, 0xb915ee221b58391dULL,
+     0x9afdf03ba317db24ULL, 0x87dec65917b8ffc4ULL, 0x7f46597be4d3d050ULL, 0x80a1c1ed006500e7ULL},
+    {0x3e22a7b397acf4ecULL, 0x0426c4005ea8b640ULL, 0x5e3295a64e969285ULL, 0x22aabc59a6a45670ULL,
+     0xb929714c5f5942bcULL, 0x9a6168bdfa3182edULL, 0x2216a665104152baULL, 0x46908d03b6926368ULL},
+    {0x52cb8ac6c2babcc1ULL, 0x4748d448fe81ae8dULL, 0x5844f03f80f1a711ULL, 0x3db784b2f8df4ac4ULL,
+     0xad918f122df1fe36ULL, 0xe40f25b9f33cc7c0ULL, 0x4700d0e73b5e5555ULL, 0x5c28fa08b03326f9ULL},
+    {0xa9f5d8745a1251fbULL, 0x967747a8c72725c7ULL, 0x195c33e531ffe89eULL, 0x609d210fe964935eULL,
+     0xcafd6ca82fe12227ULL, 0xaf9b5b960426469dULL, 0x2e9ee04c5693183cULL, 0x1084a333c8146fefULL},
+    {0x56dab1c8321a518cULL, 0xfd4439a68bce226fULL, 0xe0b30d194facb9faULL, 0xb5052f307583571bULL,
+     0x1442641012afd476ULL, 0xd02e417203fe624aULL, 0xfc394f65531c92e6ULL, 0x16d4bf5ad4bc0b52ULL},
+    {0xce06b88210395755ULL, 0x117ce6345ec1df80ULL, 0xfefae513eff55e96ULL, 0xcf36cba6fd7fed1eULL,
+     0x7340eca9a40ebf88ULL, 0xe6ec1bcfb3d37e12ULL, 0xca51b64e86bbf9ffULL, 0x4e0dbb588b40e05eULL},
+    {0x120ad0bf5f8b8a84ULL, 0xbfa00f36866f3edeULL, 0xa8c6064ec30ebc2cULL, 0xc39e40b823001e3bULL,
+     0x9614f7cde7b1cbabULL, 0xcd4420c704a56284ULL, 0x8446a8f316857a19ULL, 0x519b93b1e6f706cbULL},
+    {0x96649933aed1d1f7ULL, 0x566eaff350563090ULL, 0x345057f0ad2e39cfULL, 0x148ff65b1f832124ULL,
+     0x042e89d4cf94cf0dULL, 0x319bec84520c58b3ULL, 0x2a2676265361aa0dULL, 0xc86fa3028fbc87adULL},
+    {0x3805e5b80863b664ULL, 0x8be7ac6b3cabdb53ULL, 0x9f7d70505dfeff91ULL, 0x7dea8bd095896206ULL,
+     0x28005a3b410e3c4eULL, 0x24a4f0e9bc603ebfULL, 0xcc4fd5ae4aec15d2ULL, 0x4dc253f80f96641dULL},
+    {0x359d7b9c7ea2ee34ULL, 0x3fd0d94c09cc3a71ULL, 0xbb53c31c3a1ea37aULL, 0x533425facf818c87ULL,
+     0x7cd199c3810156e0ULL, 0x0ea020e430c16448ULL, 0xe557ba094a642542ULL, 0xe657e7e79465f5eaULL},
+    {0xea723ad1fbc82439ULL, 0xc726868bf896e9fdULL, 0xd97c913c511c33ffULL, 0x8a3fa8e2e2114231ULL,
+     0x2a6c0e5608445b3eULL, 0x2c4cd884f8d098d3ULL, 0x7bf51faf2fea77d4ULL, 0x709f208a7b1c4f71ULL},
+    {0xfc83d2ab5c8b06d5ULL, 0xb1a785a2fe4eac46ULL, 0xb99315bc846f7779ULL, 0xcf31d816ef9ea505ULL,
+     0x2391fe6a15d7dc85ULL, 0x2f132b04b4016b33ULL, 0x29547fe3181cb4c7ULL, 0xdb66d8a6650155a1ULL},
+    {0x5b9e4843f45aac50ULL, 0xc31e042e91eaaad0ULL, 0x6e8c0b345a54eea0ULL, 0xf0437b94962c7a57ULL,
+     0xe4531ce8fe1d348bULL, 0xe1489378e3786432ULL, 0xd5e19c4a3f510d38ULL, 0x4df3f016ce348b00ULL},
+    {0x59cd0e8b593d070fULL, 0x437575165255625dULL, 0x551fdda75b7a0399ULL, 0x7bb6e6b02dec1eebULL,
+     0x729bb662334c0922ULL, 0x3df631df0cf41b79ULL, 0x01abf3c578f32402ULL, 0xfcb4666c9cd33c88ULL},
+    {0xb805b445735e843cULL, 0x2a8e890d97379134ULL, 0xebc7c10c52ab9f87ULL, 0xcbb5e1ecb80a92b6ULL,
+     0xd6ada2d9dc2c4efeULL, 0xfccf504eae8cc7bdULL, 0x650115acb2418a74ULL, 0x8dd90e06c52bd80cULL},
+    {0x6b66d7e1adc1696fULL, 0x98ebe5930acd72d0ULL, 0x65f24550cc1b7435ULL, 0xce231393b4b9a5ecULL,
+     0x234a22d4db067df9ULL, 0x98dda095caff9b00ULL, 0x1bbc75a06100c9c1ULL, 0x1560a9c8939cf695ULL}
+  },
+  {
+    {0xe4050f1cf1c367caULL, 0x9bc85a9bc90fbc7dULL, 0xa373c4a2e1a11032ULL, 0xb64232b7ad0393a9ULL,
+     0xf5577eb0167dad29ULL, 0x1604f30194b78ab2ULL, 0x0baa94afe829348bULL, 0x77fbd8dd41654342ULL},
+    {0x31f14802fcf0a7fdULL, 0x42fd07895488b01eULL, 0x71d78d6d9952b498ULL, 0x8eb572d907ac5201ULL,
+     0xe0a2a44c4d194a88ULL, 0xd2b63fd9ba017e66ULL, 0x78efc6c8f888aefcULL, 0xb76f6bda4a881a11ULL},
+    {0xa2f7932c68af43eeULL, 0x5502468e703d00bdULL, 0xe5dc978f2fb061f5ULL, 0xc9a1904a28c815adULL,
+     0xd3af538d470c56a4ULL, 0x159abc5f193d8cedULL, 0x2a37245f20108ef3ULL, 0xfa17081e223f7178ULL},
+    {0x1fe2a9b2b4b4b67cULL, 0xc1d10df0e8020604ULL, 0x9d64abfcbc8058d8ULL, 0x8943b9b2712a0fbbULL,
+     0x90eed9143b3def04ULL, 0x85ab3aa24ce775ffULL, 0x605fd4ca7bbc9040ULL, 0x8b34a564e2c75dfbULL},
+    {0x5c18acf88e2f7d90ULL, 0xfdbf33d777be32cdULL, 0x0a085cd7d2eb5ee9ULL, 0x2d702cfbb3201115ULL,
+     0xb6e0ebdb85c88ce8ULL, 0x23a3ce3c1e01d617ULL, 0x3041618e567333acULL, 0x9dd0fd8f157edb6bULL},
+    {0xb2b2610798fa7aaaULL, 0x41209ee4f073aa4eULL, 0xf1570359f2d6b19bULL, 0xcbe6868cfc577cafULL,
+     0x186c4bdc32c04dd3ULL, 0xa6c35faecfeee397ULL, 0xb4a1b312f086c0cfULL, 0xe0a5ccc6d9461fe2ULL},
+    {0x516ff3a36fa6110cULL, 0x74fb1eb1fb93561fULL, 0x6c0c90478457522bULL, 0xcfd321046bb8bdc6ULL,
+     0x2d6884a2cc80ad57ULL, 0x7c27fc3586a9b637ULL, 0x3461baedadf4e8cdULL, 0x1d56251a617242f0ULL},
+    {0xb84011a9431dd80eULL, 0xeb7c7cca73306cd9ULL, 0x20fadd29d1b3b730ULL, 0x83858b5bfe37b3d3ULL,
+     0xbf4cd193b6251d5cULL, 0x1cca1fd31352d952ULL, 0xc66157a490fbc051ULL, 0x7990a63889b98636ULL},
+    {0x892c81a321175ec1ULL, 0x9159a505ee018109ULL, 0xc70130532d8be316ULL, 0x76060c21426fa2e5ULL,
+     0x074d2dfc6b6f0f22ULL, 0x9725fc64ca01a671ULL, 0x3f6679b92770bd8eULL, 0x8fe6604fd7c9b3feULL},
+    {0xce711154b6e00a84ULL, 0xd9fe7e4224890e60ULL, 0xd10bc6c34560988fULL, 0xbdc2ef526859b004ULL,
+     0xdcf0d868d5c890eeULL, 0x893115e6119c47dcULL, 0xe97966fbee714567ULL, 0x117813355c85aa53ULL},
+    {0x71d530cc73204349ULL, 0xc9df473d94a0679cULL, 0xc572f0014261e031ULL, 0x9786b71f22f135feULL,
+     0xed6505fa6b64e56fULL, 0xe2fb48e905219c46ULL, 0x0dbec45bedf53d71ULL, 0xd7d782f2c589f406ULL},
+    {0x350fb66b73ed0966ULL, 0x968e4b082886032bULL, 0x5a16ed6e88390493ULL, 0x0a83ce84a121edbeULL,
+     0x7c86fc10a3d9cda0ULL, 0x5a40a6d595ce67fbULL, 0x6cb8cda7f937dbf6ULL, 0x95b44768651f6283ULL},
+    {0x06513c8a446cd7f4ULL, 0x158c423b906d52a6ULL, 0x71503261c423866cULL, 0x4b96f57093c148eeULL,
+     0x5daf9cc7239a8523ULL, 0x611b597695ac4b8bULL, 0xde3981db724bf7f6ULL, 0x7e7d0f7867afc443ULL},
+    {0x984f101ed6fc3837ULL, 0x340bf99f5e1b3a09ULL, 0xbb96036f06942626ULL, 0x7bc878ab0c7da618ULL,
+     0xb37416441c6fb035ULL, 0xc65bd5aea182fe9fULL, 0x1b9c2fb86cc7a67aULL, 0x8d1b19af5ce68d7dULL},
+    {0x3d1ab80c8ce59954ULL, 0x742c5a9478222ac0ULL, 0x3ddacbf894f878ddULL, 0xfc085117e7d54a99ULL,
+     0xfb0f1dfa21e38ec2ULL, 0x1c7b59cb16f4ff7fULL, 0x988752397ea888feULL, 0x705d270cb10dc889ULL},
+    {0xe5aa692a87dec0e1ULL, 0x010ded8df7b39d00ULL, 0x7b1b80c854cfa0b5ULL, 0x66beb876a0f8ea28ULL,
+     0x50d7f5313476cd0eULL, 0xa63d0e65b08d3949ULL, 0x1a09eea953479fc6ULL, 0x82ae9891f499e742ULL}
+  },
+  {
+    {0xab58b9105ca7d866ULL, 0x582967e23adb3b34ULL, 0x89ae4447cceac0bcULL, 0x919c667c7bf56af5ULL,
+     0x9aec17b160f5dcd7ULL, 0xec697b9fddcaadbcULL, 0x0b98f341463467f5ULL, 0xb187f1f7a967132fULL},
+    {0xeb5ddcb6ec7fae9fULL, 0x995f2714efb66e5aULL, 0xdee95d8e69445d52ULL, 0x1b6c2d4609e27620ULL,
+     0x32621c318129d716ULL, 0xb03909f10958c1aaULL, 0x8c468ef91af4af63ULL, 0x162c429ffba5cdf6ULL},
+    {0xe8cb5eef9c053df7ULL, 0x8de25b37b300ea6fULL, 0xdb03fa92c849cffbULL, 0x242e43a7e84169bbULL,
+     0xe4fa51f4dd6f958eULL, 0x6925a77ff4445a8dULL, 0xe6e72a50e90d8949ULL, 0xc66648e32b1f6390ULL},
+    {0x6c3b96f31711ebecULL, 0x2da40f1fce98fdc4ULL, 0xb99774d357b4411fULL, 0x87c8bdf415b65bb6ULL,
+     0xda3a89e3c2eef12dULL, 0xde95bb9b3c7471f3ULL, 0x600f225bd812c594ULL, 0x54907c5d2b75a56bULL},
+    {0x699e4d2945c1dd53ULL, 0xcadc5898231debb5ULL, 0xdf49fcc7a77f00e0ULL, 0x93057bbfa73e5a0eULL,
+     0x2f8b7ecd027a4cd1ULL, 0x114734b3c614011aULL, 0xe7a01db767677c68ULL, 0x89d9be5e7e273f4fULL},
+    {0xe0deee5931fba239ULL, 0xf47424d398bd91d1ULL, 0x0f8886f4071a3c1dULL, 0x3f7d41e8a819233bULL,
+     0x708623c2cf6eb998ULL, 0x86bb49af609a287fULL, 0x942bb24963c90762ULL, 0x0ef6eea555a9654bULL},
+    {0x4add4a2e649d4e57ULL, 0xcd53a2b01917526eULL, 0xc526233020b44ac4ULL, 0x4028746abaa2c31dULL,
+     0x5131839064291d4cULL, 0xbf48f151ee5ad909ULL, 0xcce57f597b185681ULL, 0x7c3ac1b04854d442ULL},
+    {0xa80d1db6f79588c0ULL, 0xfa52fc69b55768ccULL, 0x0b4df1ae7f54438aULL, 0x0cadd1a7f9b46a4fULL,
+     0xb40ea6b31803dd6fULL, 0x488e4fa555eaae35ULL, 0x9f047d55382e4e16ULL, 0xc9b5b7e02f6e0c98ULL},
+    {0xc19972d0b611c24bULL, 0x1d468e6560a8f351ULL, 0xeb7580697bcf6421ULL, 0xec9dd0ee88fbc491ULL,
+     0x5b59d2bf956c2e32ULL, 0x73dc6864dcddf94eULL, 0xfd5e2321bcee7665ULL, 0xa7b4f8ef5e9a06c4ULL},
+    {0x03cc8f17cf41c6e8ULL, 0xf1f03c2a037b925cULL, 0xc39c19cc66d2427cULL, 0x823d24ba7b6c18e4ULL,
+     0x32ef9013901f0b4fULL, 0x684360f1f8941c2eULL, 0x0ebaff522c28092eULL, 0x7891e4e3256c932fULL},
+    {0x174e8f82d8d38a9bULL, 0x2e97c600e7de1391ULL, 0xc5709850a1c175ddULL, 0x969041a032ae5035ULL,
+     0xcbfd533b76a2086bULL, 0xd6bba71bd7c2e8feULL, 0xb2d58ee6099dfb67ULL, 0x3a8b342d064a85d9ULL},
+    {0xf83cbf0502f40d9aULL, 0x4681c4682c318a4dULL, 0x985756180e9c2674ULL, 0xbe79d0461847092eULL,
+     0xaf1e480a78bd01e0ULL, 0x6dd359e472a51db9ULL, 0x62ce3821e3afbab6ULL, 0xc5cee5b617733199ULL},
+    {0x671ed8fc3b922bf8ULL, 0xe4d8c0a04c29b133ULL, 0x87eb12393b6e99c4ULL, 0xaff3974c8793bebaULL,
+     0x037494052c18df9bULL, 0xc5c3a29391007139ULL, 0x6a77234fe37a0b95ULL, 0x02c29a21b661c96bULL},
+    {0x5a52fe2e34d74e31ULL, 0xa352c3103bf79ab6ULL, 0x97ff6c5aabfeeb8fULL, 0xbfbe8feff5c97305ULL,
+     0xd6081ce6a7904608ULL, 0x1f812f3ac4fca249ULL, 0x9b24bc9ab9e5e200ULL, 0x91022c6738012ee8ULL},
+    {0x184de7d7cc5f4394ULL, 0xb5551b5c4536e142ULL, 0x2e89b212d34aa60aULL, 0x14a96feaf50051d5ULL,
+     0x4e21ef740d12bb0bULL, 0xc522f02060b9677eULL, 0x8b12e4672df7731dULL, 0x39f803827b326d31ULL},
+    {0xc12738b67c4a658aULL, 0xb3c4763940e72182ULL, 0x3b77be468798e44fULL, 0xdc047df217a7f85fULL,
+     0x2439d4c55e59d92dULL, 0xcedca475e8e64d8dULL, 0xa724cd0d87ca9b16ULL, 0x35e4fd59a5540dfeULL}
+  },
+  {
+    {0x9894344f3a29467aULL, 0xde81e949c51eba6dULL, 0xdaea066ba5e5c2f2ULL, 0x3fc8a61408c8c7b3ULL,
+     0x7adff88f06d0de9fULL, 0xbbc11cf53b75ce0aULL, 0x9fbb7accfbbc87d5ULL, 0xa1458e267badfde2ULL},
+    {0x1cb43668e039c256ULL, 0x5f26fb8b7c17fd5dULL, 0xeee426af79aa062bULL, 0x072002d0d78fbf04ULL,
+     0x4c9ca237e84fb7e3ULL, 0xb401d8a10c82133dULL, 0xaaa525926d7e4181ULL, 0xe943083373dbb152ULL},
+    {0x2f5fad1e6ee7c983ULL, 0xeb0f9d7cb41328f5ULL, 0x9ba68b441d78d5f7ULL, 0xa06b3b9e35bc726fULL,
+     0xa2550255593e1ff1ULL, 0x552dd43ddfbec115ULL, 0x2c48a7abbba8f046ULL, 0xd4fc56a3ad0bf133ULL},
+    {0xf92dda31be24319aULL, 0x03f7d28be095a8e7ULL, 0xa52fe84098782185ULL, 0x276ddafe29c24dbcULL,
+     0x80cd54961d7a64ebULL, 0xe43608897f1dbe42ULL, 0x2f81a8778438d2d5ULL, 0x7e4d52a885169036ULL},
+    {0x62f21cefba04b5d1ULL, 0x9a442707224c7352ULL, 0xbf07966c33c6171fULL, 0xdb7ba8911e0816b0ULL,
+     0x306fea59033745a9ULL, 0x2aacf7e0c0a78f67ULL, 0xb5aa3883ad251bf9ULL, 0x345aede926bd7086ULL},
+    {0x19e3d5b11d59715dULL, 0xc7eaa762d788983eULL, 0xe5a730b0abf1f248ULL, 0xfbab8084fae3fd83ULL,
+     0x65e50d2153765b2fULL, 0xbdd4e083fa127f3dULL, 0x9cf3c074397b1b10ULL, 0x59f8090cb1b59fd3ULL},
+    {0xdc1de17d98119f10ULL, 0x74353c5d488c36a6ULL, 0x14aaf33a3d8e23dfULL, 0x31e075c078baf593ULL,
+     0x0f7ca03a46d1ca3cULL, 0x99c5e3ac47b660c7ULL, 0x70d0241388fe2e59ULL, 0x2e9a6be12a7ec005ULL},
+    {0x7b15fd9d615faa8fULL, 0x8fa1eb40968554edULL, 0x7bb4447e7aa44882ULL, 0x2bb2d0d1029fff32ULL,
+     0x075e2a646caa6d2fULL, 0x8eb879de22e7351bULL, 0xbcd5624e9a506c62ULL, 0x218eaef0a87e24dcULL},
+    {0xac449695241fbd6fULL, 0x67c9b170081c1223ULL, 0x16868f21b56aac6fULL, 0x34bd8fa3f8bcb721ULL,
+     0x06b6bd33b6691c76ULL, 0x6c924766381a7973ULL, 0x6a12444ca54078dbULL, 0xd02e91a96d1051ccULL},
+    {0x37e5684744ddfa35ULL, 0x9ccfc5c5dab3f747ULL, 0x9ac1df3f1ee96cf4ULL, 0x0c0571a13b480b8fULL,
+     0x2fbeb3d54b3a7b3cULL, 0x35c036695dcdbb99ULL, 0x52a0f5dcb2415b3aULL, 0xd57759b44413ed9aULL},
+    {0x077379c00b33d3f8ULL, 0x421883c67064e409ULL, 0x2d0873d76c29c8f6ULL, 0xbfa433a3d274c0c8ULL,
+     0x56dc778f23a5891eULL, 0xd663bf6535e2de04ULL, 0x488fdb485db517ceULL, 0x00bba55e19b226c2ULL},
+    {0x1fe647d83d30a2c5ULL, 0x0857f77ef78a81dcULL, 0x11d5a334131a4a9bULL, 0xc0a94af929d393f5ULL,
+     0xbc3a5c0bdaa6ec1aULL, 0xba9fe49388d2d7edULL, 0xbb4335b4bb614797ULL, 0x991c4d6872f83533ULL},
+    {0xedbbeee78a058fb6ULL, 0xb9d19ddcfb09121aULL, 0xa41bb45bd34dddceULL, 0x2dbc80b900964bc4ULL,
+     0x4ed9137d1d6cb654ULL, 0x1b9016db483d01c5ULL, 0x5fc501bc6528e22eULL, 0xb2d2f8816cad646bULL},
+    {0x53258c28d2f01cb3ULL, 0x93d6eaa3d75db0b1ULL, 0x419a2b0de87d0db4ULL, 0xa1e48f03d8fe8493ULL,
+     0xf747faf6c508b23aULL, 0xf137571a35d53549ULL, 0x9f5e58e2fcf9b838ULL, 0xc7186ceea7fd3cf5ULL},
+    {0x5e76fb2f286bad39ULL, 0xbad9efe39dcad1e2ULL, 0x60e75190edc7e904ULL, 0x6a6f063e0fecb5a5ULL,
+     0x5150ed85aed8acc3ULL, 0xb56ccfbc6d20af6cULL, 0x7e0d1e982c69dbfaULL, 0xabf5628a7c7e10a9ULL},
+    {0x77b868cee978a1d3ULL, 0xe3a68b337ab92d04ULL, 0x5102979487a5b862ULL, 0x5f0606c33a61d41dULL,
+     0x2814be276f9326f1ULL, 0x2f521c14c6fe3c2eULL, 0x17464d7dacdf7351ULL, 0x10f5f9d3777f7e44ULL}
+  },
+  {
+    {0xb06b1244c5f95cd8ULL, 0xda8c8af0f4ab95f4ULL, 0x1bae59c2b9e5836dULL, 0x07d51e7e3acffffcULL,
+     0x01e15e6ac2ccbcdaULL, 0x3bc1923f8528c3e0ULL, 0x43324577a49fead4ULL, 0x61a1b8842aa7a711ULL},
+    {0x4fe7ee31b0e63d34ULL, 0xf4600572a9e54fabULL, 0xc0493334d5e7b5a4ULL, 0x8589fb9206d54831ULL,
+     0xaa70f5cc6583553aULL, 0x0879094ae25649e5ULL, 0xcc90450710044652ULL, 0xebb0696d02541c4fULL},
+    {0x172a5247d95ea168ULL, 0x1758fada2970764aULL, 0xac803a511d978169ULL, 0x299cfe2ede77e01bULL,
+     0x652a1e17b0a98927ULL, 0x2e26e1d120014495ULL, 0x7ae0af9f7175b56aULL, 0xc2e22a80d64b9f95ULL},
+    {0x758c1a3ea2dee7a6ULL, 0xdcde2f3c734b2284ULL, 0xaba445d24eaba6adULL, 0x35aaf66876cee0a7ULL,
+     0x7e0b04a9e5aa049aULL, 0xe74083ad91103e84ULL, 0xbeb183ce40afecc3ULL, 0x6b89de9fea043f7aULL},
+    {0xafbfb1eda4f7e665ULL, 0x403cce6aa23df8e7ULL, 0xb49cc83f1312c2f4ULL, 0xe1cc2366771a9c34ULL,
+     0x7ab6a6c0db92faacULL, 0xacd15e0dec3befe1ULL, 0x7f8ed988583a0f36ULL, 0x1821de7705f9be09ULL},
+    {0xb99f0e0399375235ULL, 0x7614c847b9917970ULL, 0xfec93ce9524ec067ULL, 0xe40e7bf89b122520ULL,
+     0xb5670631ee4c4774ULL, 0x6f03847a3b04914cULL, 0xc96e9429dc9dd226ULL, 0x43489b6c8c57c1f8ULL},
+    {0x7b9722a5c5f26464ULL, 0xca4c3dfba442809aULL, 0x7d10986723644810ULL, 0x9e4951723c924f82ULL,
+     0xef4a6968a2c5bc14ULL, 0x750eac4f68de6b7aULL, 0x4e01884d52a2cbb5ULL, 0xac40830af4a5f446ULL},
+    {0x0e299d23fe67ba66ULL, 0x9145076093cf2f34ULL, 0xf45b5ea997fcf913ULL, 0x5be008438bd7dddaULL,
+     0x358c3e05d53ff04dULL, 0xbf7ccdc35de91ef7ULL, 0xad684dbfb69ec1a0ULL, 0x367e7cf2801fd997ULL},
+    {0x8c54f1076103adf8ULL, 0x2d813d6cbe8e9810ULL, 0xb1466fa85fbd3c9bULL, 0x68c65d2240e1ca76ULL,
+     0xb81baa40255f9164ULL, 0x5b34c3eed1a864b2ULL, 0x3602209b122ca141ULL, 0xe7d7248e885badebULL},
+    {0x46ffd227cc2338fbULL, 0x89ff6fa990e26153ULL, 0xbe570779331a0076ULL, 0x43d241c506e1f3afULL,
+     0xfdcdb97dde9b62a3ULL, 0x6a06e984a0ae30eaULL, 0xc9bf16804fbddf7dULL, 0x170471a2d36163c4ULL},
+    {0xfd23e207a6469d43ULL, 0xcb9f5f112f753a85ULL, 0xde2625d4fbb5ca72ULL, 0x82e4e54ab7b1c78bULL,
+     0x2cd0ca5378b9e814ULL, 0xfcd44051125b817aULL, 0xb68f719f30cfd965ULL, 0x31644719d848a974ULL},
+    {0xff5ba8ae3113655eULL, 0xfa2c6e2b57b83180ULL, 0x1c48271977e0eabeULL, 0xf9f3c555337fea97ULL,
+     0x340f7022a42581cbULL, 0xe1de0bc218f710e3ULL, 0xee640adef62e5aa8ULL, 0x16b2389149428940ULL},
+    {0x5045738f25f653f5ULL, 0xe42b8cb83764f635ULL, 0xb4f89406dc11ffc3ULL, 0x99593144b6b3e4aaULL,
+     0x81c849f3c9740052ULL, 0x2c9cf4c155ffc48bULL, 0x6299e52177f67a49ULL, 0x5869f6e3c00c6c62ULL},
+    {0x361619e455950cc3ULL, 0xc71d665c56b66bb8ULL, 0xea034b34afac6d84ULL, 0xa987f832e5e4c7e3ULL,
+     0xa07427727a79a6a7ULL, 0x56e5d017e26d6c23ULL, 0x7e50b97638167e10ULL, 0xaa6c81efe88aa84eULL},
+    {0xb84186f75fe01576ULL, 0x446e276cdea51395ULL, 0xf3c5ef8105f3f8d4ULL, 0x3d7f7df674f7f142ULL,
+     0x7c69b565f9ef1656ULL, 0x87efa4247c414ef6ULL, 0xeb7e620d3d292060ULL, 0x50b1de346eec21aeULL},
+    {0x0ca1f3b7b0dc8595ULL, 0x27de46089f1d9f2eULL, 0x1af3bf39badd82a7ULL, 0x79356a7965862448ULL,
+     0xc0602345f5f9a052ULL, 0x1a8b0f89139a42f9ULL, 0xb53eee42844d40fcULL, 0x93b0bfe54e5b6368ULL}
+  },
+  {
+    {0x0f893a5dc8de610bULL, 0xe8c515fb67e223ceULL, 0x7774bfa64ead6dc5ULL, 0x89d20f95925c728fULL,
+     0x7a1e0966098583ceULL, 0xa2eedb9493f2a7d7ULL, 0x1b2820974c304d4aULL, 0x0842e3dac077282dULL},
+    {0xa1010e9d74cd06ffULL, 0x9c17c7dfaca3eeacULL, 0x74c86cd38063aa2bULL, 0x8595c4b3734614ffULL,
+     0xa3de00ca990f62ccULL, 0xd9bed213ca0c3be5ULL, 0x7886078adf8ce9f5ULL, 0xddb27ce35cd44444ULL},
+    {0x5a3097befc15aa1eULL, 0x40d12548b54b0745ULL, 0x5bad4706519a5f12ULL, 0xed03f717a439dee6ULL,
+     0x0794bb6c4a02c499ULL, 0xf725083dcffe71d2ULL, 0x2cad75190f3adcafULL, 0x7f68ea1c43729310ULL},
+    {0x9c7c581d26ee8382ULL, 0xcf17dcc5359d638eULL, 0xee8273abb728ae3dULL, 0x1d112926f821f047ULL,
+     0x1149847750491a74ULL, 0x687fa761fde0dfb9ULL, 0x2c2580227ea435abULL, 0x6b8bdb9491ce7e3fULL},
+    {0x9c806d8af7f91d0fULL, 0x3b61b0f1a82a5728ULL, 0x4640032d94d76754ULL, 0x273eb5de47d834c6ULL,
+     0x2988abf77b4e4d53ULL, 0xb7ce66bfde401777ULL, 0x9fba6b32715071b3ULL, 0x82413c24ad3a1a98ULL},
+    {0x75537b7e3cc8ac85ULL, 0x8d725f57dd02753bULL, 0xfd05ff64b737df2fULL, 0x55fe8712f6d2531dULL,
+     0x57ce04a96ab6b01cULL, 0x69a02a897cd93724ULL, 0x4f82ac35cf86699bULL, 0x8242d3ad9cb4b232ULL},
+    {0x69c435269be47be0ULL, 0x323b7dd8cb28fea1ULL, 0xfa5538ba3a6c67e5ULL, 0xef921d701d378e46ULL,
+     0xf92961fc3c4b880eULL, 0x3f6f914e98940a67ULL, 0xa990eb0afef0ff39ULL, 0xa6c2920ff0eeff9cULL},
+    {0xb23a03a553fb2b56ULL, 0x6ce141e74e057f78ULL, 0x796525c389e490d9ULL, 0x0bc95725a31a7e75ULL,
+     0x1ec567911220fd06ULL, 0x716e3a3c408b0bd6ULL, 0x31cd6bf7e8ebeba9ULL, 0xa7326ca6bee6b670ULL},
+    {0x70b63d32343bf1a9ULL, 0x8fd3bd2837d1a6b1ULL, 0x0454879c316865b4ULL, 0xee959ff6c458efa2ULL,
+     0x0461dcf89706dc3fULL, 0x737db0e2164e4b2eULL, 0x092626802f8843c8ULL, 0x54498bbc7745e6f6ULL},
+    {0x5341352b5acf6e10ULL, 0xc50343fdafe652c3ULL, 0x4af3792d18577a7fULL, 0xe1a4c617af16823dULL,
+     0x9b26d0cd33425d0aULL, 0x306399ed9b7bc47fULL, 0x2a792f33706bb20bULL, 0x3121961498111055ULL},
+    {0x4c1f428cd5f30851ULL, 0x94dfed272a4f6630ULL, 0x4df53772fc5d48a4ULL, 0xdd2d5a2f933260ceULL,
+     0x574115bdd44cc7a5ULL, 0x4ba6b20dbd12533aULL, 0x30e93cb8243057c9ULL, 0x794c486a14de320eULL},
+    {0x6095355699f241d7ULL, 0xee4adbd7001a349dULL, 0x0b35bf6aaa89e491ULL, 0x7f0076f4136f7546ULL,
+     0xd19a18ba9264da3dULL, 0x6eb2d2cd62a7a28bULL, 0xcdba941f8761c971ULL, 0x1550518ba3be4a5dULL},
+    {0xc232d97302f1cd1eULL, 0xce87eacb1dd212a4ULL, 0x6e4c8c73e69802f7ULL, 0x12ef02901fffddbdULL,
+     0x941ec74e1bcea6e2ULL, 0xd0b540243cb92cbbULL, 0x809fb9d47e8f9d05ULL, 0x3bf16159f2992aaeULL},
+    {0xb2497007eafbb1e1ULL, 0xd75c9ce6e75b7a93ULL, 0x3558352defb68d78ULL, 0xa2f26699223f6396ULL,
+     0xeb911ecfe469b17aULL, 0x62545779e72d3ec2ULL, 0x8ea47de782cb113fULL, 0xebe4b0864e1fa98dULL},
+    {0xbdb8e675b055cb40ULL, 0x898f8e7b977b5167ULL, 0xecc65651b82fb863ULL, 0x565448146d88f01fULL,
+     0xb0928e95263a75a9ULL, 0xcfb6836f1a22fcdaULL, 0x651d14db3f3bd37cULL, 0x1d3837fbb6ad4664ULL},
+    {0x20d3c982cf7d62d2ULL, 0x1f36e29d23ba8150ULL, 0x48ae0bf092763f9eULL, 0x7a527e6b1d3a7007ULL,
+     0xb4a89097581a85e3ULL, 0x1f1a520fdc158be5ULL, 0xf98db37d167d726eULL, 0x8802786e1113e862ULL}
+  },
+  {
+    {0xefb2149e36f09ab0ULL, 0x03f163ca4a10bb5bULL, 0xd029704506e20998ULL, 0x56f0af001b5a3babULL,
+     0x7af4cfec70880e0dULL, 0x7332a66fbe3d913fULL, 0x32e6c84a7eceb4bdULL, 0xedc4a79a9c228f55ULL},
+    {0xc37c7dd0c55c4496ULL, 0xa6a9635725bbabd2ULL, 0x5b7e63f2add7f363ULL, 0x9dce37822e73f1dfULL,
+     0xe1e5a16ab2b91f71ULL, 0xe44898235ba0163cULL, 0xf2759c32f6e515adULL, 0xa5e2f1f88615eecfULL},
+    {0x74519be7abded551ULL, 0x03d358b8c8b74410ULL, 0x4d00b10b0e10d9a9ULL, 0x6392b0b128da52b7ULL,
+     0x6744a2980b75c904ULL, 0xc305b0aea8f7f96cULL, 0x042e421d182cf932ULL, 0xf6fc5d509e4636caULL},
+    {0x795847c9d64cc78cULL, 0x6c50621b9b6cb27bULL, 0x07099bf8df8022abULL, 0x48f862ebc04eda1dULL,
+     0xd12732ede1603c16ULL, 0x19a80e0f5c9a9450ULL, 0xe2257f54b429b4fcULL, 0x66d3b2c645460515ULL},
+    {0x6ca4f87e822e37beULL, 0x73f237b4253bda4eULL, 0xf747f3a241190aebULL, 0xf06fa36f804cf284ULL,
+     0x0a6bbb6efc621c12ULL, 0x5d624b6440b80ec6ULL, 0x4b0724257ba556f3ULL, 0x7fa0c3543e2d20a8ULL},
+    {0xe921fa31e3229d41ULL, 0xa929c65294531bd4ULL, 0x84156027a6d38209ULL, 0xf3d69f736bdb97bdULL,
+     0x8906d19a16833631ULL, 0x68a34c2e03d51be3ULL, 0xcb59583b0e511cd8ULL, 0x99ce6bfdfdc132a8ULL},
+    {0x3facdaaaffcdb463ULL, 0x658bbc1a34a38b08ULL, 0x12a801f8f1a9078dULL, 0x1567bcf96ab855deULL,
+     0xe08498e03572359bULL, 0xcf0353e58659e68bULL, 0xbb86e9c87d23807cULL, 0xbc08728d2198e8a2ULL},
+    {0x8de2b7bc453cadd6ULL, 0x203900a7bc0bc1f8ULL, 0xbcd86e47a6abd3afULL, 0x911cac128502effbULL,
+     0x2d550242ec965469ULL, 0x0e9f769229e0017eULL, 0x633f078f65979885ULL, 0xfb87d4494cf751efULL},
+    {0xe1790e4bfc25419aULL, 0x364672034bff3cfdULL, 0xc8db638625b6e83fULL, 0x6cc69f236cad6fd2ULL,
+     0x0219e45a6bc68bb9ULL, 0xe43d79b6297f7334ULL, 0x7d445368465dc97cULL, 0x4b9eea322a0b949aULL},
+    {0x1b96c6ba6102d021ULL, 0xeaafac782f4461eaULL, 0xd4b85c41c49f19a8ULL, 0x275c28e4cf538875ULL,
+     0x35451a9ddd2e54e0ULL, 0x6991adb50605618bULL, 0x5b8b4bcd7b36cd24ULL, 0x372a4f8c56f37216ULL},
+    {0xc890bd73a6a5da60ULL, 0x6f083da0dc4c9ff0ULL, 0xf4e14d94f0536e57ULL, 0xf9ee1edaaaec8243ULL,
+     0x571241ec8bdcf8e7ULL, 0xa5db82710b041e26ULL, 0x9a0b9a99e3fff040ULL, 0xcaaf21dd7c271202ULL},
+    {0xb4e2b2e14f0dd2e8ULL, 0xe77e7c4f0a377ac7ULL, 0x69202c3f0d7a2198ULL, 0xf759b7ff28200eb8ULL,
+     0xc87526eddcfe314eULL, 0xeb84c52453d5cf99ULL, 0xb1b52ace515138b6ULL, 0x5aa7ff8c23fca3f4ULL},
+    {0xff0b13c3b9791a26ULL, 0x960022dacdd58b16ULL, 0xdbd55c9257aad2deULL, 0x3baaaaa3f30fe619ULL,
+     0x9a4b23460d881efdULL, 0x506416c046325e2aULL, 0x91381e76035c18d4ULL, 0xb3bb68bef27817b0ULL},
+    {0x15bfb8bf5116f937ULL, 0x7c64a586c1268943ULL, 0x71e25cc38419a2c8ULL, 0x9fd6b0c48335f463ULL,
+     0x4bf0ba3ce8ee0e0eULL, 0x6f6fba60298c21faULL, 0x57d57b39ae66bee0ULL, 0x292d513022672544ULL},
+    {0xf451105dbab093b3ULL, 0x012f59b902839986ULL, 0x8a9158023474a89cULL, 0x048c919c2de03e97ULL,
+     0xc476a2b591071cd5ULL, 0x791ed89a034970a5ULL, 0x89bd9042e1b7994bULL, 0x8eaf5179a1057ffdULL},
+    {0x6066e2a2d551ee10ULL, 0x87a8f1d8727e09a6ULL, 0x00d08bab2c01148dULL, 0x6da8e4f1424f33feULL,
+     0x466d17f0cf9a4e71ULL, 0xff5020103bf5cb19ULL, 0xdccf97d8d062ecc0ULL, 0x80c0d9af81d80ac4ULL}
+  },
+  {
+    {0x98857ceb1bf4581cULL, 0xe635e186aca7b166ULL, 0x278ddd22659722acULL, 0xa0903c4c1db68007ULL,
+     0x366e458948f21402ULL, 0x31b49c14b96abda2ULL, 0x329c4b09e0403190ULL, 0x97197ca3d29f43feULL},
+    {0x03e2de1cf3480d4aULL, 0xf0d8edc7bc8acf1aULL, 0xf23e330368295a9cULL, 0xfadd5f68c546a97dULL,
+     0x895597ad96f8acb1ULL, 0xbddd49d5671bdae2ULL, 0x16fcd52821dd43f4ULL, 0xa5a454126619141aULL},
+    {0xfa32c79f439f29cfULL, 0x7bf321c04dd82a3bULL, 0xff127f54eaa2c1b1ULL, 0xa8365f2df35e9618ULL,
+     0x852d29024d0ef8ddULL, 0x395ce2c159228c4aULL, 0xb69f44e8215afed3ULL, 0x16c1f898b27458e3ULL},
+    {0x8ce9b6bfc360e25aULL, 0xe6425195075a1a78ULL, 0x9dc756a8481732f4ULL, 0x83c0440f5432b57aULL,
+     0xc670b3f1d720281fULL, 0x2205910ed135e051ULL, 0xded14b0edb052be7ULL, 0x697b3d27c568ea39ULL},
+    {0xdef29005dc453233ULL, 0xc208c47a2fac4bcfULL, 0x6057a3feac3d55acULL, 0x1723725d902c1207ULL,
+     0x9c31c62733eb0fecULL, 0x4913ccdbbb3c63bbULL, 0x113e542b07305838ULL, 0x9d48e72a310c2d97ULL},
+    {0x54424ec4d9bbeb3dULL, 0x34ceafe3d7b2921cULL, 0x5e68022e296d37c5ULL, 0xa28e0a2b359f16b0ULL,
+     0xfdd82dd9bc3f9d73ULL, 0x6939a8f9baf3e1ffULL, 0x55cff45c31736dc4ULL, 0x910f56427892e8e7ULL},
+    {0xde09b349dfe39260ULL, 0x984612f773549093ULL, 0x7cede28167853b02ULL, 0x7d809bb429d17703ULL,
+     0x450b6bfb2756c4f0ULL, 0xc59ff9ba93f02b80ULL, 0x3e69545720ad9561ULL, 0x0c7cf0be3331e2c7ULL},
+    {0x2e599b9afb3ff9edULL, 0x28c2e0ab17f6515cULL, 0x1cbee4fd474da449ULL, 0x071279a44f364452ULL,
+     0x97abff6601fbe855ULL, 0x3ee394e85fda51c4ULL, 0x190385f667597c0bULL, 0x6e9fccc6a27ee34bULL},
+    {0xced2d419362fb228ULL, 0x894637c206aa0be4ULL, 0x7a4fc55eb294b197ULL, 0xd9cbac1cfd4ca1e8ULL,
+     0x068b74800ccdb6ceULL, 0xca4c556580dfaa49ULL, 0xe835382176033b78ULL, 0x35db7525c5ce98a7ULL},
+    {0x8cf5927274fd1997ULL, 0x987d2031ffadeb58ULL, 0x5647c6c3d4db260cULL, 0xf08bb13b985543beULL,
+     0x566eeb1056fad695ULL, 0x39e17dde68334cc7ULL, 0x8a97b3bb7ddd1db2ULL, 0xf91199d8c1c5a300ULL},
+    {0x402fa437bdc47fe4ULL, 0x35bd25234f3751f0ULL, 0x8c2281b7cf57d485ULL, 0x50083ea58f607cb6ULL,
+     0x6f41e480df6d730dULL, 0x1164e47e91bb06a2ULL, 0xd9040c22391fb48aULL, 0xe12df251da23dda7ULL},
+    {0x0b89de9314092ebbULL, 0xf17256bd428e240cULL, 0xcf89a7f393d2f064ULL, 0x4f57841ee1ed3b14ULL,
+     0x4ee14405e708d855ULL, 0x856aae7203f1c3d0ULL, 0xc8e5424fbdd7eed5ULL, 0x3333e4ef73ab4270ULL},
+    {0xf9cf2b5148f835b1ULL, 0x4a70faf32adaaba8ULL, 0xa0d2e24fed7beadeULL, 0x2b1e4e6715f04032ULL,
+     0xeadbc0b91fb3ceeeULL, 0xb817b0863a54b0b4ULL, 0x14a787257fd4a188ULL, 0xff13304623482e60ULL},
+    {0x312012ec4efe42dcULL, 0x7251b2c2c664b2bcULL, 0x996c2e6b798f9cb9ULL, 0x3543376a3b8f3465ULL,
+     0x337ae8416fbfb6a9ULL, 0xe0893a840cb91a03ULL, 0x53744e9d7b02d855ULL, 0x7e673186206d473fULL},
+    {0x9509996f3ef143dbULL, 0x9cf1e82e399378bcULL, 0xb59cd09b0b8ccc89ULL, 0x64b4a2fc52cda6beULL,
+     0xd3bda8b31bcd55dfULL, 0xfec4e87d2507cb37ULL, 0x3d48a85eb610e49bULL, 0x02fbe1bd1f9cc445ULL},
+    {0x3bc77adedda492f8ULL, 0xc11a3aea78297205ULL, 0x5e89a3e734931b4cULL, 0x17512e2e9f5694bbULL,
+     0x5dc349f3177bf8b6ULL, 0x232ea4ba08c7ff3eULL, 0x9c4f9d16f511145dULL, 0xccf109a333b379c3ULL}
+  },
+  {
+    {0x60e2857080eb24a9ULL, 0x7bedfb4d488e0cfdULL, 0x721ebbd7c259cdb8ULL, 0x0b0da855bc6390a9ULL,
+     0x2b4d04dbde314c70ULL, 0xcdbf1fbc6c32e846ULL, 0x33833eabb162fc9eULL, 0x9939b48bb0dd3ab7ULL},
+    {0x96892c1f711b0eb9ULL, 0xb905f2c8780ab954ULL, 0xace26309a20792dbULL, 0xec8ac9b30684e126ULL,
+     0x486ad8b6b40a2447ULL, 0x60121fc19fe3fb24ULL, 0x5626fccf1a8e3b3fULL, 0x4e5686226ad1f394ULL},
+    {0x5cfbbb22236f4a98ULL, 0x0b0c59e9066800bbULL, 0x4ac69a8f5a9a7774ULL, 0x2b33f804d6bec948ULL,
+     0xb372929532e6c466ULL, 0x68956d0f4e599c73ULL, 0xa47a249f155c31ccULL, 0x24d80f0de1ce284eULL},
+    {0x5a4b46c64a8a3d62ULL, 0x8469c4d0247743d2ULL, 0x2bb3a13d88f7e433ULL, 0x62b23a1001be5849ULL,
+     0xe83596b4a63d1a4cULL, 0x454e7fea7d183f3eULL, 0x643fce6117afb01cULL, 0x4e65e5e61c4c3638ULL},
+    {0xb7e830e3dc09508bULL, 0xfaf6d2cf74317655ULL, 0x72606cebdf690355ULL, 0x48bb92b3d0c3ded6ULL,
+     0x65b754845c7cf892ULL, 0xf6cd7ac9d5d5f01fULL, 0xc2c30a5996401d69ULL, 0x91268650ed921878ULL},
+    {0xe5db77176add8545ULL, 0x1b71cb6672c49b66ULL, 0xd856073968421d77ULL, 0x03840fe883e3afeaULL,
+     0xb391dad51ec69977ULL, 0xae243fb9307f6726ULL, 0xc88ac87be8ca160cULL, 0x5174cced4ce355f4ULL},
+    {0x752067f8ff81578eULL, 0x786221509045447dULL, 0xc0c22fcf0505aa6fULL, 0x1030f0a66bed1c77ULL,
+     0x31f29f151f0bd739ULL, 0x2d7989c7e6debe85ULL, 0x5c070e728e677e98ULL, 0x0a817bd306e81fd5ULL},
+    {0xc1e17eb6cbc613e5ULL, 0x33131d55497ea61cULL, 0x2f69d39eaf7eded5ULL, 0x73c2f434de6af11bULL,
+     0x4ca52493a4a375faULL, 0x5f06787cb833c5c2ULL, 0x814e091f3e6e71cfULL, 0x76451f578b746666ULL},
+    {0x01c7e082e1539388ULL, 0xfd286f30759a9c6bULL, 0x94581041176bacfbULL, 0xe580f07c3bc3de53ULL,
+     0xdcdb6f75884d772fULL, 0xd75c3bb840bb9d4fULL, 0xdc6c2e4edb083011ULL, 0xe18789a2cd9c298dULL},
+    {0x5ee6ab8495fe1347ULL, 0xab0f6c396f24503cULL, 0x807e3ffb4486dd6bULL, 0xf00b6c748002fef5ULL,
+     0x48bff9a6a7862999ULL, 0x85e5a06cbed89e26ULL, 0x86d311af3d8419ebULL, 0x24f3ad7834733f16ULL},
+    {0x5e20551311820d44ULL, 0x0c651bcc86c4473aULL, 0x1d230c2b9bd80eefULL, 0x042c4a1207515be5ULL,
+     0x42517ca0bfe9e284ULL, 0xe8f605782369827aULL, 0x184f04f01638699dULL, 0x174618edf2bc6d05ULL},
+    {0x5e3e03fc6c68d687ULL, 0x3e732c3d1ff052c7ULL, 0xf2d0efa66ed16e7aULL, 0x63d92b26b65bb746ULL,
+     0xffcd82badd44867cULL, 0xa71b4a9ef8c081b8ULL, 0x6c1676a7736c8785ULL, 0xbe2c06169d8932d0ULL},
+    {0x7bfa1a4b9eca1c9fULL, 0x960bc1dc8ce5e535ULL, 0xe267d9f317eec30aULL, 0x06fb89ef6c257d38ULL,
+     0x2328999ad364a26dULL, 0x69b794cb26eaab58ULL, 0xad28ab1fb85ba596ULL, 0x05dcbff356d0aa94ULL},
+    {0x53376d282bcffbc4ULL, 0x708817a706eadb7aULL, 0x6ff50e05cd35ae69ULL, 0x63b5fb7574bc7fdeULL,
+     0x71c9e953e7fe08c4ULL, 0xb4d8bfd4f583ca18ULL, 0xde8d788245e81c5cULL, 0xa5f5e93ce0474138ULL},
+    {0x426c160f293c9f31ULL, 0x8eb56333e864d7a7ULL, 0xbe1164023ebbba30ULL, 0x64c2bae32fd5a302ULL,
+     0x800601e1265aff7bULL, 0x52d8a88066fd4b14ULL, 0x5aba20e746075a9cULL, 0xdaa32bf87e1234c6ULL},
+    {0x80f9bdef694db7e0ULL, 0xedca8787b9fcddc6ULL, 0x51981c3403b8dce1ULL, 0x4274dcf170e10ba1ULL,
+     0xf72743b86def6d1aULL, 0xd25b1670ebdb1866ULL, 0xc4491e8c050c6f58ULL, 0x2be2b2ab87fbd7f5ULL}
+  },
+  {
+    {0x3e0e5c9dd111f8ecULL, 0xbcc33f8db7c4e760ULL, 0x702f9a91bd392a51ULL, 0x7da4a795c132e92dULL,
+     0x1a0b0ae30bb1151bULL, 0x54febac802e32251ULL, 0xea3a5082694e9e78ULL, 0xe58ffec1e4fe40b8ULL},
+    {0xfbb8349d29c4120bULL, 0x9f94391fc0d0d915ULL, 0xc4074fa75410ba51ULL, 0xa66adbf6150a5911ULL,
+     0xc164543c34bfca38ULL, 0xe0f27560b9e1ccfcULL, 0x99da0f53e820219cULL, 0xe8234498c6b4997aULL},
+    {0x7b23c513516e19e4ULL, 0x56e2e847c5c4d593ULL, 0x9f727d735ce71ef6ULL, 0x5b6304a6f79a44c5ULL,
+     0x6638a7363ab7e433ULL, 0x1adea470fe742f83ULL, 0xe054b8545b7fc19fULL, 0xf935381aba1d0698ULL},
+    {0xb5504f9d918e4936ULL, 0x65035ef6b2513982ULL, 0x0553a0c26f4d9cb9ULL, 0x6cb10d56bea85509ULL,
+     0x48d957b7a242da11ULL, 0x16a4d3dd672b7268ULL, 0x3d7e637c8502a96bULL, 0x27c7032b730d463bULL},
+    {0x55366b7d5846426fULL, 0xe7d09e89247d441dULL, 0x510b404d736fbf48ULL, 0x7fa003d0e784bd7dULL,
+     0x25f7614f17fd9596ULL, 0x49e0e0a135cb98dbULL, 0x2c65957b2e83a76aULL, 0x5d40da8dcddbe0f8ULL},
+    {0x37f68bb4a595939dULL, 0x0355647928740217ULL, 0x8e740e7c84ad7612ULL, 0xd89bc8439044695fULL,
+     0xf7f3da5d85a9184dULL, 0x562563bb9fc0b074ULL, 0x06d2e6aaf88a888eULL, 0x612d8643161fbe7cULL},
+    {0x9fb3bba354530bb2ULL, 0xbde3ef77cb0869eaULL, 0x89bc90460b431163ULL, 0x4d03d7d2e4819a35ULL,
+     0x33ae4f9e43b6a782ULL, 0x216db3079c88a686ULL, 0x91dd88e000ffedd9ULL, 0xb280da9f12bd4840ULL},
+    {0x458f86913e538cd7ULL, 0xa7001f6c8e08ad53ULL, 0x52b8c6e6bf5d15ffULL, 0x548234a4011215ddULL,
+     0xff5a9d2d3d5b4045ULL, 0xb0ffeeb64a904190ULL, 0x55a3aca448607f8bULL, 0x8cbd665c30a0672aULL},
+    {0xa37f3573f37f5937ULL, 0xeb0f6c7dd1e4fca5ULL, 0x2965a554ac8ab0fcULL, 0x17fbf56c274676acULL,
+     0x2e2f6bd9acf7d720ULL, 0x41fc8f8810224766ULL, 0x517a14b385d53befULL, 0xdae327a57d76a7d1ULL},
+    {0x515d5c891f5f82dcULL, 0x9a7f67d76361079eULL, 0xa8da81e311a35330ULL, 0xe44990c44b18be1bULL,
+     0xc7d5ed95af103e59ULL, 0xece8aba78dac9261ULL, 0xbe82b0999394b8d3ULL, 0x6830f09a16adfe83ULL},
+    {0x43c41ac194d7d9b1ULL, 0x5bafdd82c82e7f17ULL, 0xdf0614c15fda0fcaULL, 0x74b043a7a8ae37adULL,
+     0x3ba6afa19e71734cULL, 0x15d5437e9c450f2eULL, 0x4a5883fe67e242b1ULL, 0x5143bdc22c1953c2ULL},
+    {0xa2a9ce7c6b53f5f9ULL, 0x642465951b176d99ULL, 0xb1298d36b95c081bULL, 0x53505bb81d9a9ee6ULL,
+     0x3f6f9e61f2ba70b0ULL, 0xd07e16c98afad453ULL, 0x9f1694bbe7eb4a6aULL, 0xdfebced93cb0bc8eULL},
+    {0xc676d7f2b1f3390bULL, 0x9f7a1b8ca5b61272ULL, 0x4ebebfc9c2e127a9ULL, 0x4602500c5dd997bfULL,
+     0x7f09771c4711230fULL, 0x058eb37c020f09c1ULL, 0xab693d4bfee5e38bULL, 0x9289eb1f4653cbc0ULL},
+    {0xa44d2b391770f5a7ULL, 0xe4d4d7910e44eb82ULL, 0x42e69d1e3f69712aULL, 0xbf11c4d6ac6a820eULL,
+     0xb5e7f3e542c4224cULL, 0xd6b4e81c449d941cULL, 0x5d72bd165450e878ULL, 0x6a61e28aee25ac54ULL},
+    {0x54da9dc7ab952578ULL, 0xb5423df226e84d0bULL, 0xa8b64eeb9b872042ULL, 0xac2057825990f6dfULL,
+     0x4ff696eb21f4c77aULL, 0x1a79c3e4aab273afULL, 0x29bc922e9436b3f1ULL, 0xff807ef8d6d9a27aULL},
+    {0xc7f3a8f833f6746cULL, 0x21e46f65fea990caULL, 0x915fd5c5caddb0a9ULL, 0xbd41f01678614555ULL,
+     0x346f4434426ffb58ULL, 0x8055943614dbc204ULL, 0xf3dd20fe5a969b7fULL, 0x9d59e956e899a39aULL}
+  },
+  {
+    {0x3c2f0ba9b733aa5fULL, 0xdece47cbf05af235ULL, 0xf8e3f715a2ac82a5ULL, 0xc97ba6412203f18aULL,
+     0xc3af550409c11060ULL, 0x56ea2c0546af512dULL, 0xfac28daff3f28146ULL, 0x87fab43a959ef494ULL},
+    {0x09891641d4c5105fULL, 0x1ae80f8e6d7fbd65ULL, 0x9d67225fbee6bdb0ULL, 0x3b433b597fc4d860ULL,
+     0x44e66db693e85638ULL, 0xf7b59252e3e9862fULL, 0xdb785157665c32ecULL, 0x702fefd7ae362f50ULL},
+    {0xfe756a5c97290293ULL, 0xbf04a19cd388acbfULL, 0xfbbbb9cf5e916bdaULL, 0xf489527391f93becULL,
+     0xdee07ec32a5923d7ULL, 0xc7bc949bfde0c370ULL, 0xbd5121750419d8fcULL, 0x54f5d4763fdcc93fULL},
+    {0x3754475d0fefb0c3ULL, 0xd48fb56b46d7c35dULL, 0xa070b633363798a4ULL, 0xae89f3d28fdb98e6ULL,
+     0x970b89c86363d14cULL, 0x8981752167abd27dULL, 0x9bf7d47444d5a021ULL, 0xb3083bafcac72aeeULL},
+    {0x0acda2ffcc5e62e9ULL, 0x3b8b7d755edb02a4ULL, 0xa700741c66120c76ULL, 0xf77e847f7d974064ULL,
+     0x0d310678a5e3d464ULL, 0xde68b1f346bf35a3ULL, 0xcae83028d32f9043ULL, 0x724e4717517cb0cbULL},
+    {0x389741debe949a44ULL, 0x638e9388546a4fa5ULL, 0x3fe6419ca0047bdcULL, 0x7047f648aaea57caULL,
+     0x54e48a9041fbab17ULL, 0xda8e0b28576bdba2ULL, 0xe807eebcc72afddcULL, 0x07d3336df42577bfULL},
+    {0xfae8563b4f3011dbULL, 0xda33776536610c03ULL, 0xad4f6f2a6381af0bULL, 0xc277984cd95378ecULL,
+     0x5ab0a10c5751d2b2ULL, 0x70a18bb97a4bf3f4ULL, 0x38d07ad4eae3caf3ULL, 0xe8ef552fec430361ULL},
+    {0x62a8c244bfe20925ULL, 0x91c19ac38fdce867ULL, 0x5a96a5d5dd387063ULL, 0x61d587d421d324f6ULL,
+     0xe87673a2a37173eaULL, 0x2384800853778b65ULL, 0x10f8441e05bab43eULL, 0xfa11fe124621efbeULL},
+    {0xedd0389a8391d54bULL, 0xdac74c08c8afe546ULL, 0x8525a4ad5be60bbdULL, 0x2419ac9690ad7b87ULL,
+     0x078a3a0277eee51bULL, 0xe86ecf367239768dULL, 0xcb0a259d8fd48035ULL, 0x94db43cb9d29ca5bULL},
+    {0x047b772e81685d7bULL, 0x23f27d81bf34a976ULL, 0xc27608e2915f48efULL, 0x3b0b43faa521d5c3ULL,
+     0x7613fb2663ca7284ULL, 0x7f5729b41d4db837ULL, 0x87b14898583b526bULL, 0x00b732a6bbadd3d1ULL},
+    {0x4fffa25b90f8550aULL, 0x254db3d31c8dae9dULL, 0x58cef963c1fbb232ULL, 0xad1cb481a4bfdf0fULL,
+     0x84d26ea1958773c2ULL, 0x58622664010114f1ULL, 0xeadb3a87f051e67eULL, 0xf3185722b69e45c6ULL},
+    {0x8e02f4262048e396ULL, 0x436b50b6383d9de4ULL, 0xf78d3481471e85adULL, 0x8b01ea6ad005c8d6ULL,
+     0xd3c7afee97015c07ULL, 0x46cdf1a94e3ba2aeULL, 0x7a42e50183d3a1d2ULL, 0xd54b5268b541dff4ULL},
+    {0xe120c4f948a48e22ULL, 0xf24977eed0335a96ULL, 0x9af3442336151c7bULL, 0xe2815a7fd36648d8ULL,
+     0xb4d2deba66e0a6b2ULL, 0x783a84cf817515e8ULL, 0x78424c0bff3ff24aULL, 0x12dd1bb638e1c5d9ULL},
+    {0x3f24cf304e23e9bcULL, 0x4387f816126e3624ULL, 0x26a46a033b0b6d61ULL, 0xaf1bc8458b2d777cULL,
+     0x25c401ba527de79cULL, 0x0e1346d44261bbb6ULL, 0x4b96c44b287b4bc7ULL, 0x658493c75254562fULL},
+    {0xfcb0e9d8fdd41d98ULL, 0x8be980c1bcc7c7fbULL, 0xa72e86506f8fa4d9ULL, 0x356b14ad748cb88dULL,
+     0xfd9fccefea6178f2ULL, 0xc84a620d78bb0e35ULL, 0xbc75367c62f391a9ULL, 0x6a83a5c623100c05ULL},
+    {0x23f949feb8a24a20ULL, 0x17ebfed1f52ca53fULL, 0x9b691bbebcfb4853ULL, 0x5617ff6b6278a05dULL,
+     0x241b34c5e3c99ebdULL, 0xfc64242e1784156aULL, 0x4206482f695d67dfULL, 0xb967ce0eee27c011ULL}
+  },
+  {
+    {0xb4480f0441c23fa3ULL, 0xb4712eb0c1989a2eULL, 0x3ccbba0f93a29ca7ULL, 0x6e205c14d619428cULL,
+     0x90db7957b3641686ULL, 0x0432691d45ac8b4eULL, 0x07a759acf64e0350ULL, 0x0514d89c9c972517ULL},
+    {0xe3b22c6bc4fe3c39ULL, 0xba4a81536c7bebdfULL, 0xf23ab6b725693459ULL, 0x53bc377014922b11ULL,
+     0x4645c8ab5afc60dbULL, 0xaa02235520b9f2a3ULL, 0x52a2954cce0fc507ULL, 0x8c2731bb7ce1c2e7ULL},
+    {0x5066efb6d9790ed6ULL, 0xa77a0cbca6aa793bULL, 0x1a915f3c223e042eULL, 0x1c5def0469c5874bULL,
+     0x0e83007873b6c1daULL, 0x55cf85d2fcd8557aULL, 0x0f7c7c760460f3b1ULL, 0x87052acb46e58063ULL},
+    {0x6a7091c2e48fb889ULL, 0x26882c137b8a9d06ULL, 0xa24986631b82a0e2ULL, 0x844ed7363518152dULL,
+     0x282f476fd86e27c7ULL, 0xa04edaca04afefdcULL, 0x8b256ebc6119e34dULL, 0x56a413e90787d78bULL},
+    {0x16eab6a20d645fd6ULL, 0x632cbd8df61d3148ULL, 0xcc1bf7cf62079ae9ULL, 0x257ee5c7f33eccbbULL,
+     0xbf6b34a81680ac73ULL, 0xaa084e8872c77aa0ULL, 0x7b5a864e05a0a1d1ULL, 0x0641f6db359a1b16ULL},
+    {0xf01d095dc8385050ULL, 0x0d54a5d5df4b441cULL, 0x2a37ccb40927706aULL, 0xdf008f5445d7eb7eULL,
+     0x74eb34f35bf716c7ULL, 0x57a65b58641bd6caULL, 0xef345e4835e6fa02ULL, 0x191f913b88342a09ULL},
+    {0x1554d46da670ff1dULL, 0x24833d88cb97a1ccULL, 0x8fa6ab3cded97493ULL, 0x215e037189926498ULL,
+     0x549bd592e56d74ffULL, 0x58a8caf543b5e1ecULL, 0x3c6087a323e93cb9ULL, 0x8b0549875648b83cULL},
+    {0x82ee061d5a74be50ULL, 0xe41781c4dea16ff5ULL, 0xe0b0c81e99bfc8a2ULL, 0x624f4d690b547e2dULL,
+     0x3a83545dbdcc9ae4ULL, 0x2573dbb6409b1e8eULL, 0x482960c4a6c93539ULL, 0xf01059ad5ae18798ULL},
+    {0xc431a238013ff83bULL, 0x7c0018b2fad69d08ULL, 0x99aeb52a4c9589eaULL, 0x121f41ab9b1cf19fULL,
+     0x0cfbbcbaef0f5958ULL, 0x8deb3aeb7be8fbdcULL, 0x12b954081f15aa31ULL, 0x5acc09b34c0c06fdULL},
+    {0x775cbfa86d518ffbULL, 0xdecee1f6930f124bULL, 0x9a402804f5e81d0fULL, 0x0e8225c52a0eeb2fULL,
+     0x884a5d39fee9e867ULL, 0x9540428ffb505454ULL, 0xb2bf2e20107a70d1ULL, 0xd9917c3ba010b2aaULL},
+    {0xa98f42fa3d843d53ULL, 0x33777cc613ef927aULL, 0xc440cdbecb84ca74ULL, 0x8c22f9631dc7c5ddULL,
+     0x4bc82b70c8d94708ULL, 0x7e0b43fcc814364fULL, 0x286d4e2486f59b7eULL, 0x1abc895e4d6bf4c4ULL},
+    {0x38151e274d559d96ULL, 0x4f18c0d3b8db6c01ULL, 0x49a3aa836f9921afULL, 0xdbeab27b8c046029ULL,
+     0x242b9eaa7040bf3bULL, 0x39c479e51614b091ULL, 0x338ede2b0e4baf5dULL, 0x5bb192b7f0a53945ULL},
+    {0x896d572337e440d7ULL, 0x685c5fd9ade23f68ULL, 0xb5b1a26dc2c64918ULL, 0xb9390e30dad6580cULL,
+     0x87911c4e7dee5b9bULL, 0xb90c5053deb04f6eULL, 0x37b942a18f065aa6ULL, 0x34acdf2a1ca0928dULL},
+    {0x733b64d39de40ca3ULL, 0x1d4b6d6fd2f3857eULL, 0xbe2be8e9b2ed92f7ULL, 0x64ca7047b77da248ULL,
+     0xc65dae9b8da99315ULL, 0x9c1451750fc698a4ULL, 0x8a296b94ff958c27ULL, 0x38684e0843950097ULL},
+    {0x7872e34b3390ff23ULL, 0x968ce4abde7d18efULL, 0x9b4a745e627fe7b1ULL, 0x9607b0a0caff3e2aULL,
+     0x1b05818eeb40e3a5ULL, 0x6ac62204c0fa8d7aULL, 0xb5b9058571ed4809ULL, 0xb2432ef0f7cb65f2ULL},
+    {0x715c9f973112795fULL, 0xe8244437984e6ee1ULL, 0x55cb4858ecb66bcdULL, 0x7c136735abaffbeeULL,
+     0x546615955dbec38eULL, 0x51c0782c388ad153ULL, 0x9ba4c53ac6e0952fULL, 0x27e6782a1b21dfa8ULL}
+  },
+  {
+    {0xfeb09740e2c2bf15ULL, 0x627a2205a9e99704ULL, 0xec8d73d0c2fbc565ULL, 0x223eed8fc20c8de8ULL,
+     0x1ee32583a8363b49ULL, 0x1a0b6cb9c9c2b0a6ULL, 0x49f7c3d290dbc85cULL, 0xa8dfbb971ef4c1acULL},
+    {0xc16c236e846e364fULL, 0x7f33527cdea50ca0ULL, 0xc48107750926b86dULL, 0x6c2a36090598e70cULL,
+     0xa6755e52f024e924ULL, 0xe0fa07a49db4afcaULL, 0x15c3ce7d66831790ULL, 0x5b4ef350a6cbb0d6ULL},
+    {0x42806b2da6dc1d29ULL, 0xd3030009f871e144ULL, 0xa1feb333aaf49276ULL, 0xb5583b9ec70bc04bULL,
+     0x1db0be7895695f20ULL, 0xfc84181189d012b5ULL, 0x6409f27205f61643ULL, 0x40d34174d5883128ULL},
+    {0x05214c050f15dde9ULL, 0xa47a76a80d5f2b82ULL, 0xbb254d3062e82b62ULL, 0x11a05fe03ec955eeULL,
+     0x7eaff46e9d529b36ULL, 0x55ab13018f9e3df6ULL, 0xc463e37199317698ULL, 0xfd251438ccda47adULL},
+    {0x8c3c669c72ba075bULL, 0x89f78b55ba469015ULL, 0x5706aade3e9f8ba8ULL, 0x6d8bd565b32d7ed7ULL,
+     0x25f4e63b805f08d6ULL, 0x7f48200dc3bcc1b5ULL, 0x4e801968b025d847ULL, 0x74afac0487cbe0a8ULL},
+    {0xe2a37598a9d82abfULL, 0x5f188ccbe6c170f5ULL, 0x816822005066b087ULL, 0xda22c212c7155adaULL,
+     0x151e5d3afbddb479ULL, 0x4b606b846d715b99ULL, 0x4a73b54bf997cb2eULL, 0x9a1bfe433ecd8b66ULL},
+    {0x79732522cccc18adULL, 0xaadf3f8df1a6e027ULL, 0xf7382c9317c2354dULL, 0x5ce1680cd818b689ULL,
+     0x359ebbfcd9ecbee9ULL, 0x4330689c1cae62acULL, 0xb55ce5b4c51ac38aULL, 0x7921dfeafe238ee8ULL},
+    {0xe13122f3dbfb894eULL, 0xbe9b79f6ce274b18ULL, 0x85a49de5ca58aadfULL, 0x2495775811487351ULL,
+     0x111def61bb939099ULL, 0x1d6a974a26d13694ULL, 0x4474b4ced3fc253bULL, 0x3a1485e64c5db15eULL},
+    {0x65994ddb0f5f27caULL, 0xe85461fba80d59ffULL, 0xff05481a66601023ULL, 0xc665427afc9ebbfbULL,
+     0xb0571a697587fd52ULL, 0x935289f88d49efceULL, 0x61becc60ea420688ULL, 0xb22639d913a786afULL},
+    {0x5afddab61430c9abULL, 0x0bdd41d32238e997ULL, 0xf0947430418042aeULL, 0x71f9addacdddc4cbULL,
+     0x7090c016c52dd907ULL, 0xd9bdf44d29e2047fULL, 0xe6f1fe801b1011a6ULL, 0xb63accbcd9acdc78ULL},
+    {0x264c76680448087cULL, 0xac30903f71432daeULL, 0x3851b26600f9bf47ULL, 0x400ed3116cdd6d03ULL,
+     0x045e79fef8fd2424ULL, 0xfdfd974afa6da98bULL, 0x45c9f6410c1e673aULL, 0x76f2e7335b2c5168ULL},
+    {0x7817acab4baef62eULL, 0x9f5a2202a85b91e8ULL, 0x9666ebe66ce57610ULL, 0x32ad31f3f73bfe03ULL,
+     0x628330a425bcf4d6ULL, 0xea950593515056e6ULL, 0x59811c89e1332156ULL, 0xc89cf1fe8c11b2d7ULL},
+    {0x889e5acbc46d7ce1ULL, 0x9a515bb78b085877ULL, 0xfac1a03d0b7a5050ULL, 0x7d3e738af2926035ULL,
+     0x861cc2ce2a6cb0ebULL, 0x6f2e29558f7adc79ULL, 0x61c4d45133016376ULL, 0xd9fd2c805ad59090ULL},
+    {0x0ad7337ac0b7eff3ULL, 0x8552225ec5e48b3cULL, 0xe6f78b0c73f13a5fULL, 0x5e70062e82349cbeULL,
+     0x6b8d5048e7073969ULL, 0x392d2a29c33cb3d2ULL, 0xee4f727c4ecaa20fULL, 0xa068c99e2ccde707ULL},
+    {0x1888d65861a023efULL, 0x1d72aab4b9e5246eULL, 0xa9a26348e5563ec0ULL, 0xa0971963c3439a43ULL,
+     0x567dd54badb9b5b7ULL, 0x73fac1a1c45a524bULL, 0x8fe97ef7fe38e608ULL, 0x608748d23f384f48ULL},
+    {0xebde86ec1ed66f18ULL, 0x225d906bd61fce43ULL, 0x5cab07d6e8bed74dULL, 0x16e4617f27855ab7ULL,
+     0x6568aaddb2fbc3ddULL, 0xedb5484f8aeddf5bULL, 0x878f20e86dcf2fadULL, 0x3516497c615f5699ULL}
+  },
+  {
+    {0xef0a3fecfa181e69ULL, 0x9ea02f8130d69a98ULL, 0xb2e9cf8e66eab95dULL, 0x520f2beb24720021ULL,
+     0x621c540a1df84361ULL, 0x1203772171fa6d5dULL, 0x6e3c7b510ff5f6ffULL, 0x817a069babb2bef3ULL},
+    {0x83572fb6b294cda6ULL, 0x6ce9bf75b9039f34ULL, 0x20e012f0095cbb21ULL, 0xa0aecc1bd063f0daULL,
+     0x57c21c3af02909e5ULL, 0xc7d59ecf48ce9cdcULL, 0x2732b8448ae336f8ULL, 0x056e37233f4f85f4ULL},
+    {0x8a10b53189e800caULL, 0x50fe0c17145208fdULL, 0x9e43c0d3b714ba37ULL, 0x427d200e34189accULL,
+     0x05dee24fe616e2c0ULL, 0x9c25f4c8ee1854c1ULL, 0x4d3222a58f342a73ULL, 0x0807804fa027c952ULL},
+    {0xc222653a4f0d56f3ULL, 0x961e4047ca28b805ULL, 0x2c03f8b04a73434bULL, 0x4c966787ab712a19ULL,
+     0xcc196c42864fee42ULL, 0xc1be93da5b0ece5cULL, 0xa87d9f22c131c159ULL, 0x2bb6d593dce45655ULL},
+    {0x22c49ec9b809b7ceULL, 0x8a41486be2c72c2cULL, 0x813b9420fea0bf36ULL, 0xb3d36ee9a66dac69ULL,
+     0x6fddc08a328cc987ULL, 0x0a3bcd2c3a326461ULL, 0x7103c49dd810dbbaULL, 0xf9d81a284b78a4c4ULL},
+    {0x3de865ade4d55941ULL, 0xdedafa5e30384087ULL, 0x6f414abb4ef18b9bULL, 0x9ee9ea42faee5268ULL,
+     0x260faa1637a55a4aULL, 0xeb19a514015f93b9ULL, 0x51d7ebd29e9c3598ULL, 0x523fc56d1932178eULL},
+    {0x501d070cb98fe684ULL, 0xd60fbe9a124a1458ULL, 0xa45761c892bc6b3fULL, 0xf5384858fe6f27cbULL,
+     0x4b0271f7b59e763bULL, 0x3d4606a95b5a8e5eULL, 0x1eda5d9b05a48292ULL, 0xda7731d0e6fec446ULL},
+    {0xa3e3369390d45871ULL, 0xe976404006166d8dULL, 0xb5c3368289a90403ULL, 0x4bd1798372f1d637ULL,
+     0xa616679ed5d2c53aULL, 0x5ec4bcd8fdcf3b87ULL, 0xae6d7613b66a694eULL, 0x7460fc76e3fc27e5ULL},
+    {0x70469b8295caabeeULL, 0xde024ca5889501e3ULL, 0x6bdadc06076ed265ULL, 0x0cb1236b5a0ef8b2ULL,
+     0x4065ddbf0972ebf9ULL, 0xf1dd387522aca432ULL, 0xa88b97cf744aff76ULL, 0xd1359afdfe8e3d24ULL},
+    {0x52a3ba2b91502cf3ULL, 0x2c3832a8084db75dULL, 0x04a12dddde30b1c9ULL, 0x7802eabce31fd60cULL,
+     0x33707327a37fddabULL, 0x65d6f2abfaafa973ULL, 0x3525c5b811e6f91aULL, 0x76aeb0c95f46530bULL},
+    {0xe8815ff62f93a675ULL, 0xa6ec968405f48679ULL, 0x6dcbb556358ae884ULL, 0x0af61472e19e3873ULL,
+     0x72334372a5f696beULL, 0xc65e57ea6f22fb70ULL, 0x268da30c946cea90ULL, 0x136a8a8765681b2aULL},
+    {0xad5e81dc0f9f44d4ULL, 0xf09a69602c46585aULL, 0xd1649164c447d1b1ULL, 0x3b4b36c8879dc8b1ULL,
+     0x20d4177b3b6b234cULL, 0x096a25051730d9d0ULL, 0x0611b9b8ef80531dULL, 0xba904b3b64bb495dULL},
+    {0x1192d9d493a3147aULL, 0x9f30a5dc9a565545ULL, 0x90b1f9cb6ef07212ULL, 0x299585460d87fc13ULL,
+     0xd3323effc17db9baULL, 0xcb18548ccb1644a8ULL, 0x18a306d44f49ffbcULL, 0x28d658f14c2e8684ULL},
+    {0x44ba60cda99f8c71ULL, 0x67b7abdb4bf742ffULL, 0x66310f9c914b3f99ULL, 0xae430a32f412c161ULL,
+     0x1e6776d388ace52fULL, 0x4bc0fa2452d7067dULL, 0x03c286aa8f07cd1bULL, 0x4cb8f38ca985b2c1ULL},
+    {0x83ccbe808c3bff36ULL, 0x005a0bd25263e575ULL, 0x460d7dda259bdcd1ULL, 0x4a1c5642fa5cab6bULL,
+     0x2b7bdbb99fe4fc88ULL, 0x09418e28cc97bbb5ULL, 0xd8274fb4a12321aeULL, 0xb137007d5c87b64eULL},
+    {0x80531fe1c63c4962ULL, 0x50541e89981fdb25ULL, 0xdc1291a1fd4c2b6bULL, 0xc0693a17a6df4fcaULL,
+     0xb2c4604e0117f203ULL, 0x245f19630a99b8d0ULL, 0xaedc20aac6212c44ULL, 0xb1ed4e56520f52a8ULL}
+  },
+  {
+    {0xb5560fb6700a1acdULL, 0xe823fd73fd999681ULL, 0xda915d1f6cb4e1baULL, 0x0d0301186ebe00a3ULL,
+     0x744fb0c989fca8cdULL, 0x970d01dbf9da0e0bULL, 0x0ad8c5647931d76fULL, 0xb15737bff659b96aULL},
+    {0xa12b384ece53c2d0ULL, 0x779d897d5e4606daULL, 0xa53e47b073ec12b0ULL, 0x462dbbba5756f1adULL,
+     0x69fe09f2cafe37b6ULL, 0x273d1ebfecce2e17ULL, 0x8ac1d5383cf607fdULL, 0x8035f7ff12e10c25ULL},
+    {0xca442d5a2093c22aULL, 0xebd0bd31d5703aedULL, 0x308f2afd653287b6ULL, 0x9bb88bac0d1bc8baULL,
+     0xfbaf853875c1e3b2ULL, 0xbd2ac950ca11447cULL, 0x286d816cea5c4c8dULL, 0xdc3aa80028dc3208ULL},
+    {0x854d34c77e6c5520ULL, 0xc27df9efdcb9ea58ULL, 0x405f2369d686666dULL, 0x29d1febf0417aa85ULL,
+     0x9846819e93470afeULL, 0x3e6a9669e2a27f9eULL, 0x24d008a2e31e6504ULL, 0xdba7cecf9cb7680aULL},
+    {0x26a43e41d07fa53dULL, 0x3154a78a74e35bc5ULL, 0x7b768924e0da2f8cULL, 0xba964a2b23613f9aULL,
+     0x5a548d35ba1d16c4ULL, 0x2e1bfed1fb54d057ULL, 0xff992136bc640205ULL, 0xf39cb9148156df29ULL},
+    {0xc913e64699b444adULL, 0xddfce99dc40504c5ULL, 0x58482a99d42e53dbULL, 0x9aaf2c25d1aff537ULL,
+     0xee90f7962664cf67ULL, 0x74ab5c99f1393e2bULL, 0xfad0faeae6225bb0ULL, 0xc355648c2d63dd6cULL},
+    {0xe4e31d271d91cf9dULL, 0xcb35d4fdb377b20aULL, 0x74de1e45055e1327ULL, 0x3298e31b28703e75ULL,
+     0x55087237de013339ULL, 0x32cbf30123d101c6ULL, 0xc70dba22e8aab0dcULL, 0x4a52623d3d155bb9ULL},
+    {0xecaff541338d6e43ULL, 0x56f7dd734541d5ccULL, 0xb5d426de96bc88caULL, 0x48d94f6b9ed3a2c3ULL,
+     0x6354a3bb2ef8279cULL, 0xd575465b0b1867f2ULL, 0xef99b0ff95225151ULL, 0xf3e19d88f94500d8ULL},
+    {0xdbf435acc85dcf57ULL, 0x61745658c88f5415ULL, 0x26367e9a17c55807ULL, 0x22d077a5ca90c56fULL,
+     0xfbf72258a2e04e76ULL, 0xba965d3e6e06e405ULL, 0x5724d06fe3e6f954ULL, 0x3e47d47581251a74ULL},
+    {0xb8ba0151e0fb82f7ULL, 0x0d160726d5668ac2ULL, 0x622ba25814d711b0ULL, 0x6addf5577f3fe2f2ULL,
+     0x2b831e1c6b9c9435ULL, 0xce3a060ab73826bdULL, 0x93fa11c11c240f89ULL, 0x4f9cc8d8956e303aULL},
+    {0x4b9331f6641f82c9ULL, 0xd97c7c54dffec756ULL, 0xf5ee6d1f1a9158abULL, 0x054493a385c3da7fULL,
+     0xa57a05f5eb7d96dfULL, 0xa3afd447e4473a39ULL, 0x42a4d9c488e16d55ULL, 0x83e144f5f5f876aeULL},
+    {0x92a83268e32dd620ULL, 0x913ec99f627849a2ULL, 0xedd8fdfa2c378882ULL, 0xaf96f33eee6f8cfeULL,
+     0xc06737e5dc3fa8a5ULL, 0x236bb531b0b03a1dULL, 0x33e59f2989f037b0ULL, 0x13f9b5a7d9a12a53ULL},
+    {0x50d8ae9559029aa6ULL, 0xd74e292c5a4db2edULL, 0x0b9c3355848f373dULL, 0xec018db6ac45ab38ULL,
+     0x1f44690269cc53a8ULL, 0x8c4b628d1a879864ULL, 0x1c743d284b13475eULL, 0xbf4a933873de19f6ULL},
+    {0x4a8a4f47f0cefa69ULL, 0xdc8e4cbaa4546866ULL, 0x359ba69b23f603c1ULL, 0xdab4d601187b7ac5ULL,
+     0xa6ca4337c1ebc8d9ULL, 0x9fa6585452b4074bULL, 0x1a4b4f81902fb733ULL, 0xd2bb5d7aa525deaaULL},
+    {0xeb2e92d5f81f9567ULL, 0x54cb95ea4d698470ULL, 0x5f2acb28e04c81ebULL, 0x1c1ebfc4f8ceec64ULL,
+     0x8f799fac06e07423ULL, 0x72225f9937fa0c85ULL, 0xb0cd861634f4db44ULL, 0x5ec36159752c9091ULL},
+    {0x0d0df6ce51efb310ULL, 0xcb5b2eb4958df5beULL, 0xd6459e2936158e59ULL, 0x82aae2b91466e336ULL,
+     0xfb658a39411aa636ULL, 0x7152ecc5d4c0a933ULL, 0xf10c758a49f026b7ULL, 0xf4837f97cb09311fULL}
+  },
+  {
+    {0x994f523a626332d5ULL, 0x7bc388335561bb44ULL, 0x005ed4b03d845ea2ULL, 0xd39d3ee1c2a1f08aULL,
+     0x6561fdd3e7676b0dULL, 0x620e35fffb706017ULL, 0x36ce424ff264f9a8ULL, 0xc4c3419fda2681f7ULL},
+    {0x00f831769bb81648ULL, 0xd69eb485653120d0ULL, 0xd17d75f44ccabc62ULL, 0x34a07f82b749fcb1ULL,
+     0x2c3af787bbfb5554ULL, 0xb06ed4d062e283f8ULL, 0x5722889fa19213a0ULL, 0x162b085edcf3c7b4ULL},
+    {0x36d90ddaeb300f7aULL, 0x9dcf7dfcedb5e801ULL, 0x645cb26874d5244cULL, 0xa127ee79348e3aa2ULL,
+     0x488acc53575f1dbbULL, 0x95037e8580e6161eULL, 0x57e59283292650d0ULL, 0xabe67d9914938216ULL},
+    {0x32670d2f7189e71fULL, 0xc64387485ecf91e7ULL, 0x15758e57db757a21ULL, 0x427d09f8290a9ce5ULL,
+     0x846a308f38384a7aULL, 0xaac3acb4b0732b99ULL, 0x9e94100917845819ULL, 0x95cba111a7ce5e03ULL},
+    {0xeb81aa377378058eULL, 0x41c746a104411154ULL, 0xa10c73bcfb828ac7ULL, 0x6439be919d972b29ULL,
+     0x4bf3b4b043a2fbadULL, 0x39e6dadf82b5e840ULL, 0x4f7164086397bd4cULL, 0x0f7de5687f1eeccbULL},
+    {0xdb332a73f37ec3c3ULL, 0xc65259bddd59eba0ULL, 0x2291709cdb4d3257ULL, 0x9a793b25bd389390ULL,
+     0xf39fe34be43756f0ULL, 0x2f76bdce9afb56c9ULL, 0x9f37867a61208b27ULL, 0xea1d4307089972c3ULL},
+    {0xd0a744878a429f4fULL, 0x0649712bdb516609ULL, 0xb826ba57e769b5dfULL, 0x82335df21fc7aaf2ULL,
+     0x2389f0675c93d995ULL, 0x59ac367a68677be6ULL, 0xa77985ff21d9951bULL, 0x038956fb85011cceULL},
+    {0x97b7851aaaca5e9bULL, 0x518aa52156713b97ULL, 0x3357e8c7150a61f6ULL, 0x7842e7e2ec2c2b69ULL,
+     0x8dffaf656868a548ULL, 0xd963bd82e068fc81ULL, 0x64da5c8b65917733ULL, 0x927090ff7b247328ULL},
+    {0xd6ffdb942f6d0d97ULL, 0x05c3ee41443b9373ULL, 0xb2e541ebffd36db6ULL, 0xb7415a96ce1dcc3eULL,
+     0xe383682e163aa2f6ULL, 0x46febdd42f3af218ULL, 0x90a0507ebafdbadbULL, 0x4ca8ab4dce52e21aULL},
+    {0xa3f0832e1b7cfb73ULL, 0x7a8afe523ec354c9ULL, 0xae91c97e378eadcaULL, 0x7449c599ac3b32bbULL,
+     0xa619c3710b1c4655ULL, 0x692e4c6af79da87eULL, 0xff3f5d86de38d96aULL, 0xc5320f421c08c0ecULL},
+    {0x92a6f2bc8fec5decULL, 0xa71383ff84d6786cULL, 0x87588c06dbffa084ULL, 0x0d85f5ca6857e715ULL,
+     0xe87311b3b6c774d4ULL, 0x672357c84c3521a8ULL, 0xe5fe74615b29fe0fULL, 0x02bc51105b7158cdULL},
+    {0x37a01e48a105fc8eULL, 0x769d754a289ba48cULL, 0xc08c6fe1d51c2180ULL, 0xb032dd33b7bd1387ULL,
+     0x953826db020b0aa6ULL, 0x05137e800664c73cULL, 0xc66302c4660cf95dULL, 0x99004e11b2cef28aULL},
+    {0x824f5b284f973536ULL, 0xb43e299ed35b04eaULL, 0xc72c88f74da03089ULL, 0x8269d57a45a2e42cULL,
+     0x7c1e63fc6607b38eULL, 0xe89e2aaf29390b0cULL, 0xc7c740da1bee2869ULL, 0x8556f6fcaf3fb974ULL},
+    {0x1a0a3995a4b6bed1ULL, 0x2dab579597095c54ULL, 0x06c6a1ff2aa73ce9ULL, 0xadd0a54b4de438a7ULL,
+     0x160b6b1afca906cdULL, 0x25fc601629de10ddULL, 0x348e9c99d3633da3ULL, 0x1fe3f746158a4d5aULL},
+    {0xc253edc88be85c1dULL, 0xdd3d0e483ca09cb6ULL, 0xb997f6879ae3055aULL, 0x0c929ad007431dbfULL,
+     0xcef1621584d2db42ULL, 0xb50df3ef078828cdULL, 0x4589da9d6dbd4b66ULL, 0xbc4fd2e3d99c2b04ULL},
+    {0x214bc9a7d298c241ULL, 0xe3b697ba56807cfdULL, 0xef1c78024564eadbULL, 0xdde8cdcfb48149c5ULL,
+     0x946bf0a75a4d2604ULL, 0x27154d7f6c1538afULL, 0x95cc9230de5b1fccULL, 0xd88519e966864f82ULL}
+  },
+  {
+    {0xb828dd1a7cb1282cULL, 0xa08d7626be46973aULL, 0x6baf8d40e708d6b2ULL, 0x72571fa14daeb3f3ULL,
+     0x85b1732ff22dfd98ULL, 0x87ab01a70087108dULL, 0xaaaafea85988207aULL, 0xccc832f869f00755ULL},
+    {0x488f1185ca8d9d1aULL, 0xadf2c77dd987ded2ULL, 0x5f3039f060c46124ULL, 0xe5d70b7571e095f4ULL,
+     0x82d586506260e70fULL, 0x39d75ea7f750d105ULL, 0x8cf3d0b175bac364ULL, 0xf3a7564d21d01329ULL},
+    {0x94ab4700ec3128c2ULL, 0x6c76d8628e383f49ULL, 0xdc36b150c03024ebULL, 0xfb43947753daac69ULL,
+     0xfc68764a8dc79623ULL, 0x5b86995db440fbb2ULL, 0xd66879bfccc5ee0dULL, 0x0522894295aa8bd3ULL},
+    {0xb24aa43e3fcd3efcULL, 0xdd26c034b8088e9aULL, 0xa5ef4dc9bd3d46eaULL, 0xa2f99d588a4c6a6fULL,
+     0xddabd3552f1da46cULL, 0x72c3f8ce1afacdd1ULL, 0xd90c4eee92d40578ULL, 0xd28bb41fca623b94ULL},
+    {0x5e7c3becee8314f3ULL, 0x1c068aeddbea298fULL, 0x08d381f17c80acecULL, 0x03b56be8e330495bULL,
+     0xaeffb8f29222882dULL, 0x95ff38f6c4af8bf7ULL, 0x50e32d351fc57d8cULL, 0x6635be5217b444f0ULL},
+    {0x242792d2e7417ce1ULL, 0xff42bc71970ee7f5ULL, 0x1ff4dc6d5c67a41eULL, 0x77709b7b20882a58ULL,
+     0x3554731dbe217f2cULL, 0x2af2a8cd5bb72177ULL, 0x58eee769591dd059ULL, 0xbb2930c94bba6477ULL},
+    {0x174a9126cecdaa7aULL, 0xfc8c7e0e0b13247bULL, 0x29c110d23484c1c4ULL, 0xf8eb8757831dfc3bULL,
+     0x022f0212c0067452ULL, 0x3f6f69ee7b9b926cULL, 0x09032da0ef42daf4ULL, 0x79f00ade83f80de4ULL},
+    {0x1e6adddaf176f2c0ULL, 0x01ca4604e2572658ULL, 0x0a404ded85342ffbULL, 0x8cf60f96441838d6ULL,
+     0x9bbc691cc9071c4aULL, 0xfd58874434442803ULL, 0x97101c85809c0d81ULL, 0xa7fb754c8c456f7fULL},
+    {0xf8559ff4c1e99d81ULL, 0x08e1a7d6a3c617c0ULL, 0xb398fd43248c6ba7ULL, 0x6ffedd91d1283794ULL,
+     0x8a6a59d2d629d208ULL, 0xa9d141d53490530eULL, 0x42f6fc1838505989ULL, 0x09bf250d479d94eeULL},
+    {0x6af7a1d5af71013fULL, 0xe68216e50bedc946ULL, 0xf4cba30bd27370a0ULL, 0x7981afbf870421ccULL,
+     0x02496a679449f0e1ULL, 0x86cfc4be0a47edaeULL, 0x3073c936b1feca22ULL, 0xf569461203f8f8fbULL},
+    {0xec14f9e12cb7191eULL, 0x78ea1bd8e5b08ea6ULL, 0x3c65aa9b46332bb9ULL, 0x84cc22b3bf80ce25ULL,
+     0x0098e9e9d49d5bf1ULL, 0xcd4ec1c619087da4ULL, 0x3c9d07c5aef6e357ULL, 0x839a02689f8f64b8ULL},
+    {0xbcadd6715bde48f8ULL, 0xc97038732189bc7dULL, 0x5d45299ec709ee8aULL, 0xd1287ee2845aaff8ULL,
+     0x7d1f8874db1dbf1fULL, 0xea46588b990c88d6ULL, 0x60ba649a84368313ULL, 0xd5fdcbce60d543aeULL},
+    {0xf795643037577dd8ULL, 0x83b82af429c5fe88ULL, 0x9c1bea26cdbdc132ULL, 0x589fa0869c04339eULL,
+     0x033e9538b13799dfULL, 0x85fa8b21d295d034ULL, 0xdf17f73fbd9ddccaULL, 0xf32bd122ddb66334ULL},
+    {0xcf3de9959890272dULL, 0x75f3432a3e713a10ULL, 0x5e13479fe28227b8ULL, 0xb8561ea9fefacdc8ULL,
+     0xa6a297a08332aafdULL, 0x9b0d8bb573809b62ULL, 0xd2fa1cfd0c63036fULL, 0x7a16eb55bd64bda8ULL},
+    {0x4cc34ec13cf48283ULL, 0xb09daa259c8a705eULL, 0xd1e9d0d05b7d4f84ULL, 0x4df6ef64db38929dULL,
+     0xe16b0763aa21ba46ULL, 0xc6b1d178a293f8fbULL, 0x0ff5b602d520aabfULL, 0x94d671bdc339397aULL},
+    {0xf7e48e8a2ac13e27ULL, 0x4494f6df4eb1a9f5ULL, 0xedbf84eb981f0a62ULL, 0x49badc32536438f0ULL,
+     0x50bea541004f7571ULL, 0xbac67d10df1c94eeULL, 0x253d73a1b727bc31ULL, 0xb3d01cf230686e28ULL}
+  },
+  {
+    {0xd433e50f6d3549cfULL, 0x6f33696ffacd665eULL, 0x695bfdacce11fcb4ULL, 0x810ee252af7c9860ULL,
+     0x65450fe17159bb2cULL, 0xf7dfbebe758b357bULL, 0x2b057e74d69fea72ULL, 0xd485717a92731745ULL},
+    {0x896c42e8ee36860cULL, 0xdaf04dfd4113c22dULL, 0x1adbb7b744104213ULL, 0xe5fd5fa11fd394eaULL,
+     0x68235d941a4e0551ULL, 0x6772cfbe18d10151ULL, 0x276071e309984523ULL, 0xe4e879de5a56ba98ULL},
+    {0x6c8d0aa9b898fd52ULL, 0x2fb38a57be9af1a7ULL, 0xe1f2b9a93b4f03f8ULL, 0x2b1aad44c3f0cc6fULL,
+     0x58b5332e7cf2c084ULL, 0x1c57d96f0367d26dULL, 0x2297eabdfa6e4a8dULL, 0x65a947ee4a0e2b6aULL},
+    {0xaaafafb0285b9491ULL, 0x01a0be881e4c705eULL, 0xff1d4f5d2ad9caabULL, 0x6e349a4ac37a233fULL,
+     0xcf1c12464a1c6a16ULL, 0xd99e6b6629383260ULL, 0xea3d43665f6d5471ULL, 0x36974d04ff8cc89bULL},
+    {0xf535b616fdd5b854ULL, 0x592549c85728719fULL, 0xe231468606921cadULL, 0x98c8ce34311b1ef8ULL,
+     0x28b937e7e9090b36ULL, 0x67fc3ab90bf7bbb7ULL, 0x12337097a9d87974ULL, 0x3e5adca1f970e3feULL},
+    {0xc26c49a1cfe89d80ULL, 0xb42c026dda9c8371ULL, 0xca6c013adad066d2ULL, 0xfb8f722856a4f3eeULL,
+     0x08b579ecd850935bULL, 0x34c1a74cd631e1b3ULL, 0xcb5fe596ac198534ULL, 0x39ff21f6e1f24f25ULL},
+    {0xcdcc68a7b3f85ff0ULL, 0xacd21cdd1a888044ULL, 0xb6719b2e05dbe894ULL, 0xfae1d3d88b8260d4ULL,
+     0xedfedece8a1c5d92ULL, 0xbca01a94dc52077eULL, 0xc085549c16dd13edULL, 0xdc5c3bae495ebaadULL},
+    {0x27f29e148f929057ULL, 0x7a64ae06c0c853dfULL, 0x256cd18358e9c5ceULL, 0x9d9cce82ded092a5ULL,
+     0xcc6e59796e93b7c7ULL, 0xe1e4709231bb9e27ULL, 0xb70b3083aa9e29a0ULL, 0xbf181a753785e644ULL},
+    {0xcc17063fbe7b643aULL, 0x7872e1c846085760ULL, 0x86b0fffbb4214c9eULL, 0xb18bbc0e72bf3638ULL,
+     0x8b17de0c722591c9ULL, 0x1edeab1948c29e0cULL, 0x9fbfd98ef4304f20ULL, 0x2d1dbb6b9c77ffb6ULL},
+    {0xf53f2c658ead09f7ULL, 0x1335e1d59780d14dULL, 0x69cc20e0cd1b66bcULL, 0x9b670a37bbe0bfc8ULL,
+     0xce53dc8128efbeedULL, 0x0c74e77c8326a6e5ULL, 0x3604e0d2b88e9a63ULL, 0xbab38fca13dc2248ULL},
+    {0x255616d3c7141771ULL, 0xa86691ab2f226b66ULL, 0xda19fea4b3ca63a9ULL, 0xfc05dc42ae672f2bULL,
+     0xa9c6e786718ba28fULL, 0x07b7995b9c66b984ULL, 0x0f434f551b3702f2ULL, 0xd6f6212fda84eeffULL},
+    {0x8ed6e8c85c0a3f1eULL, 0xbcad24927c87c37fULL, 0xfdfb62bb9ee3b78dULL, 0xeba8e477cbceba46ULL,
+     0x37d38cb0eeaede4bULL, 0x0bc498e87976deb6ULL, 0xb2944c046b6147fbULL, 0x8b123f35f71f9609ULL},
+    {0x4b0e7987b5b41d78ULL, 0xea7df9074bf0c4f8ULL, 0xb4d03560fab80ecdULL, 0x6cf306f6fb1db7e5ULL,
+     0x0d59fb5689fd4773ULL, 0xab254f4000f9be33ULL, 0x18a09a9277352da4ULL, 0xf81862f5641ea3efULL},
+    {0xa155dcc7de79dc24ULL, 0xf1168a32558f69cdULL, 0xbac215950d1850dfULL, 0x15c8295bb204c848ULL,
+     0xf661aa367d8184ffULL, 0xc396228e30447bdbULL, 0x11cd5143bde4a59eULL, 0xe3a26e3b6beab5e6ULL},
+    {0xb59b01579f759d01ULL, 0xa2923d2f7eae4fdeULL, 0x18327757690ba8c0ULL, 0x4bf7e38b44f51443ULL,
+     0xb6812563b413fc26ULL, 0xedb7d36379e53b36ULL, 0x4fa585c4c389f66dULL, 0x8e1adc3154bd3416ULL},
+    {0xd3b3a13f1402b9d0ULL, 0x573441c32c7bc863ULL, 0x4b301ec4578c3e6eULL, 0xc26fc9c40adaf57eULL,
+     0x96e71bfd7493cea3ULL, 0xd05d4b3f1af81456ULL, 0xdaca2a8a6a8c608fULL, 0x53ef07f60725b276ULL}
+  },
+  {
+    {0xa6b5c9d646ac49d2ULL, 0x42c77c0b83137aa9ULL, 0x24d000fc68225a38ULL, 0x0f63cfc82fe1e907ULL,
+     0x22d1b01bc6441f95ULL, 0x7d38f719ec8e448fULL, 0x9b33fa5f787fb1baULL, 0x94dcfda1190158dfULL},
+    {0x211cde10296c36efULL, 0x7ee8967282c4da77ULL, 0xb617d270a57836daULL, 0xf0cd9c319cb7560bULL,
+     0x01fdcbf7e455fe90ULL, 0x3fb53cbb7e7334f3ULL, 0x781e2ea44e7de4ecULL, 0x8adab3ad0b384fd0ULL},
+    {0x01778a2b599ff0f9ULL, 0x68a923d78104fc6bULL, 0x5bfa44dfda694ff3ULL, 0x4f7199dbf7667f12ULL,
+     0xc06d8ff6e46f2a79ULL, 0x08b5deade9f8131dULL, 0x02519a59abb4ce7cULL, 0xc4f710bcb42aec3eULL},
+    {0x3014368b4ed80940ULL, 0x67e6d0567a6fceddULL, 0x7c208c49ca97579fULL, 0xfe3d7a81a23597f6ULL,
+     0x5e2032027e096ae2ULL, 0xb1f3e1e724b39366ULL, 0x26da26f32fdcdffcULL, 0x79422f1d6097be83ULL},
+    {0x50549c748c878145ULL, 0x67f14edf39c63565ULL, 0x22ddf78c9bcf2d5eULL, 0xffaa842f68201d10ULL,
+     0x47d94a9dd1b2de28ULL, 0xc09c4be8054be414ULL, 0xac80e178ca82755bULL, 0xe3251d105697c3bdULL},
+    {0x2bbe09d35001417bULL, 0x795e84ee5962ed5eULL, 0x5b79d1ca279f46c3ULL, 0x1f7f8a3b83836a2eULL,
+     0x692200b14a64dc32ULL, 0xc84243350f84f739ULL, 0xf110da07cc9155c0ULL, 0xee8fbe61594b0507ULL},
+    {0x2f6a5391035703ccULL, 0x9899bf6a40c7e24dULL, 0xc3f7f248bbfcbb9aULL, 0xf65027ded555875bULL,
+     0xa7a16b69ffff3b37ULL, 0x67b6eb54145b4431ULL, 0x19d7e1d249afd679ULL, 0xbd819bab110fccdfULL},
+    {0x263a2cfb9db3b381ULL, 0x9c3a2deed4df0a4bULL, 0x728d06e97d04e61fULL, 0x8b1adfbc42449325ULL,
+     0x6ec1d9397e053a1bULL, 0xee2be5c766daf707ULL, 0x80ba1e14810ac7abULL, 0xdd2ae778f530f174ULL},
+    {0x3e708e703b9f0426ULL, 0xe5b02fb60c84f17cULL, 0x2f4ff35be3b70a0bULL, 0x781b3c5f9b15565dULL,
+     0xe76c636a6e124c3aULL, 0xbde81eba8b496784ULL, 0xa412f8e2443f0370ULL, 0x15d42362999be45dULL},
+    {0x0f503ae2a4af76c1ULL, 0x550e66dc08276fe7ULL, 0x11e0c1fcbf3a33c6ULL, 0x42be231006629f85ULL,
+     0xedf7743e516ace49ULL, 0xce436668436a2262ULL, 0xe1ac7036446ca192ULL, 0x73631cb5476fe13eULL},
+    {0xd47f82d4a160bcfaULL, 0x258fb075b8ceb1f2ULL, 0x4f818e8fdf5a8d25ULL, 0x6685475e6fd31c9dULL,
+     0xcef6385ae1e9b13fULL, 0xe0a42594f0508bdbULL, 0x5ad7ae16aef1f90dULL, 0x45a155ef63f8a81eULL},
+    {0x8ca407c28034b95eULL, 0xc93eb97617bdc560ULL, 0x4ec24e8d339807e8ULL, 0x91b734d6dd64a4ebULL,
+     0xd0fece398f668b26ULL, 0x4822cc4b141823d5ULL, 0xb953bc32f09e4e00ULL, 0xca0a7c6006d861aeULL},
+    {0x4c74d4470f33e712ULL, 0x3cec1e0625a87cb0ULL, 0x5cec0610e5962db4ULL, 0xd971af1571a256aaULL,
+     0xa044c983a2ef4ac9ULL, 0xcaa1da63d74e9d00ULL, 0xfb972d834673d881ULL, 0x50747c5a03a26c8bULL},
+    {0x04349982a3e25566ULL, 0xeef9075e18e1b896ULL, 0x4c7bead092b2d24bULL, 0xd99f72fb0a21ba55ULL,
+     0xb93e09315005e541ULL, 0x2a7a98389ece3205ULL, 0xeb388ed11462f2f6ULL, 0xb488b15a2e3460a6ULL},
+    {0x43f6cd67969d56afULL, 0x9e0d872cdfc58a8bULL, 0x401c1509a4e70377ULL, 0x103d1a1308ad646cULL,
+     0x078ee37e9d062427ULL, 0x4e69c5acb9bef78cULL, 0x521ec00136e66142ULL, 0x8de1ecb2a634cd82ULL},
+    {0x0435d97a205b9d8bULL, 0x6eb8f064056756d4ULL, 0xd5e88a8bb6f8210eULL, 0x070ef12dec9fd9eaULL,
+     0x4d8495053bcc876aULL, 0x12a75338a7404ce3ULL, 0xd22b49e1b8a1db5eULL, 0xec1f205114bfa5adULL}
+  },
+  {
+    {0x43ed81b5c4e83d33ULL, 0xd9f358795efd488bULL, 0x164a620f9deb4d0fULL, 0xc6927bdbac6a7394ULL,
+     0x45c28df79f9e0f03ULL, 0x2868661efcd7e1a9ULL, 0x7cf4e8d0ffa348f1ULL, 0x6bd4c284398538e0ULL},
+    {0x56036e8c06d75fc1ULL, 0x2dcf7bb73249a89fULL, 0x81dd1d3de245e7ddULL, 0xf578dc4bebd6e2a7ULL,
+     0x4c028903df2ce7a0ULL, 0xaee362889c39afacULL, 0xdc847c31146404abULL, 0x6304c0d8a4e97818ULL},
+    {0xfb6836c327d02dccULL, 0x5ad009827a68bcc2ULL, 0x1b24b44c005e912dULL, 0xcc83d20f811fdcfeULL,
+     0x36527ec1666fba0cULL, 0x6994819714754635ULL, 0xfcdcb1a8556da9c2ULL, 0xa593426781a732b2ULL},
+    {0xe4ac8b33070d3aabULL, 0x2643672b9a2cd5e5ULL, 0x52eff79b1cfc9173ULL, 0x665ca49b90a7c13fULL,
+     0x5a8dda59b3efb998ULL, 0x8a5b922d052f1341ULL, 0xae9ebbab3cf9a530ULL, 0x35986e7bf56da4d7ULL},
+    {0x63ee4cbd8088b454ULL, 0xdb7f32f79a9e0c8aULL, 0xb377d4186b2447cbULL, 0xe3e982aad370219bULL,
+     0x06ccc1e4c2a2a593ULL, 0x72c368650773f24fULL, 0xa13b4da795859423ULL, 0x8bbf1d3375040c8fULL},
+    {0x03c187d0ad886aacULL, 0x5c16878ab771b645ULL, 0xb07dfc6fc74045abULL, 0x2c6360bf7800caedULL,
+     0x24295bb5b9c972a3ULL, 0xc9e6f88e7c9a6dbaULL, 0x90ffbf2492a79aa6ULL, 0xde29d50a41c26ac2ULL},
+    {0xb1f0fb68d84d835dULL, 0xc90caf39861dc1e6ULL, 0x12e5b0467594f8d7ULL, 0x26897ae265012b92ULL,
+     0xbcf68a08a4d6755dULL, 0x403ee41c0991fbdaULL, 0x733e343e3bbf17e8ULL, 0xd2c7980d679b3d65ULL},
+    {0x534acf4fda79e5acULL, 0x68b83b3a8630215fULL, 0x5c748b2ed085756eULL, 0xb0317258e5d37cb2ULL,
+     0x6735841ac5ccc2c4ULL, 0x7d7dc96b3d9d5069ULL, 0xa147e410fd1754bdULL, 0x65296e94d399ddd5ULL},
+    {0x1e71c9a1deb8568bULL, 0xa35daea080fb3d32ULL, 0xe8b6f2662cf8fb81ULL, 0x6d51afe89490696aULL,
+     0x81beac6e51803a19ULL, 0xe3d24b7f86219080ULL, 0x727cfd9ddf6f463cULL, 0x8c6865ca72284ee8ULL},
+    {0xe00df169d23233f3ULL, 0x3e32279677cb637fULL, 0x1f897c0e1da0cf6cULL, 0xa651f5d831d6bbddULL,
+     0xdd61af191a230c76ULL, 0xbd527272cdaa5e4aULL, 0xca753636d0abcd7eULL, 0x78bdd37c370bd8dcULL},
+    {0xcddb27c17078c432ULL, 0xe1961b9cb77fedb7ULL, 0x1edc2f5cc2290570ULL, 0x2c3fefca19cbd886ULL,
+     0xcf880a36c2af389aULL, 0x96c610fdbda71ceaULL, 0xf03977a932aa8463ULL, 0x8eb7763f8586d90aULL},
+    {0x831ab3edf0290a8fULL, 0xcae81966cb47c387ULL, 0xaad7dece184efb4fULL, 0xdcfc53b34749110eULL,
+     0x6698f23c4cb632f9ULL, 0xc42a1ad6b91f8067ULL, 0xb116a81d6284180aULL, 0xebedf5f8e901326fULL},
+    {0x91633f0ab2cf8940ULL, 0x72b0b1786f948f51ULL, 0x2d28dc30782653c8ULL, 0x88829849db903a05ULL,
+     0xb8095d0c6a19d2bbULL, 0x4b9e7f0c86f782cbULL, 0x7af739882d907064ULL, 0xd12be0fe8b32643cULL},
+    {0x9561f28b638a7e81ULL, 0x54155cdf5980ddc3ULL, 0xb2db4a96d26f247aULL, 0x9d774e4e4787d100ULL,
+     0x1a9e6e2e078637d2ULL, 0x1c363e2d5e0ae06aULL, 0x7493483ee9cfa354ULL, 0x76843cb37f74b98dULL},
+    {0x0491f1bc789a283bULL, 0x72d3ac3d880836f4ULL, 0xaa1c5ea388e5402dULL, 0x1b192421d5cc473dULL,
+     0x5c0b99989dc84cacULL, 0xb0a8482d9c6e75b8ULL, 0x639961d03a191ce2ULL, 0xda3bc8656d837930ULL},
+    {0xd7e0c4cdb30cfb3aULL, 0x6d09b8c16c9db4c8ULL, 0x40ba1a4207c8d9dfULL, 0x6fd495f71c52c66dULL,
+     0xfb0e169f275264daULL, 0x80c2b746e57d8362ULL, 0xedd987f749ad7222ULL, 0xfdc229af4398ec7bULL}
+  },
+  {
+    {0xb0d1ed8452666a58ULL, 0x4bcb6e00e6a9c3c2ULL, 0x3c57411c26906408ULL, 0xcfc2075513556400ULL,
+     0xa08b1c505294dba3ULL, 0xa30ba2868b7dd31eULL, 0xd70ba90e991eca74ULL, 0x094e142ce762c2b9ULL},
+    {0xb81d783e979f3925ULL, 0x1efd130aaf4c89a7ULL, 0x525c2144fd1bf7faULL, 0x4b2969041b265a9eULL,
+     0xed8e9634b9db65b6ULL, 0x35c82e3203599d8aULL, 0xdaa7a54f403563f3ULL, 0x9df088ad022c38abULL},
+    {0xe5cfb066bb3fd30aULL, 0x429169daeff0354eULL, 0x809cf8523524e36cULL, 0x136f4fb30155be1dULL,
+     0x4826af011fbba712ULL, 0x6ef0f0b4506ba1a1ULL, 0xd9928b3177aea73eULL, 0xe2bf6af25eaa244eULL},
+    {0x8d084f124237b64bULL, 0x688ebe99e3ecfd07ULL, 0x57b8a70cf6845dd8ULL, 0x808fc59c5da4a325ULL,
+     0xa9032b2ba3585862ULL, 0xb66825d5edf29386ULL, 0xb5a5a8db431ec29bULL, 0xbb143a983a1e8dc8ULL},
+    {0x35ee94ce12ae381bULL, 0x3a7f176c86ccda90ULL, 0xc63a657e4606eacaULL, 0x9ae5a38043cd04dfULL,
+     0x9bec8d15ed251b46ULL, 0x1f5d6d30caca5e64ULL, 0x347b3b359ff20f07ULL, 0x4d65f034f7e4b286ULL},
+    {0x9e93ba24f111661eULL, 0xedced484b105eb04ULL, 0x96dc9ba1f424b578ULL, 0xbf8f66b7e83e9069ULL,
+     0x872d4df4d7ed8216ULL, 0xbf07f3778e2cbecfULL, 0x4281d89998e73754ULL, 0xfec85fbb8aab8708ULL},
+    {0x9a3c0deea5ba5b0bULL, 0xe6a116ce42d05299ULL, 0xae9775fee9b02d42ULL, 0x72b05200a1545cb6ULL,
+     0xbc506f7d31a3b4eaULL, 0xe58930788bbd9b32ULL, 0xc8bc5f37e4b12a97ULL, 0x6b000c064a73b671ULL},
+    {0x13b5bf22765fa7d0ULL, 0x59805bf01d6a5370ULL, 0x67a5e29d4280db98ULL, 0x4f53916f776b1ce3ULL,
+     0x714ff61f33ddf626ULL, 0x4206238ea085d103ULL, 0x1c50d4b7e5809ee3ULL, 0x999f450d85f8eb1dULL},
+    {0x658a6051e4c79e9bULL, 0x1394cb73c66a9feaULL, 0x27f31ed5c6be7b23ULL, 0xf4c88f365aa6f8feULL,
+     0x0fb0721f4aaa499eULL, 0x68b3a7d5e3fb2a6bULL, 0xa788097d3a92851dULL, 0x060e7f8ae96f4913ULL},
+    {0x82eebe731a3a93bcULL, 0x42bbf465a21adc1aULL, 0xc10b6fa4ef030efdULL, 0x247aa4c787b097bbULL,
+     0x8b8dc632f60c77daULL, 0x6ffbc26ac223523eULL, 0xa4f6ff11344579cfULL, 0x5825653c980250f6ULL},
+    {0xb2dd097ebc1aa2b9ULL, 0x0788939337a0333aULL, 0x1cf55e7137a0db38ULL, 0x2648487f792c1613ULL,
+     0xdad013363fcef261ULL, 0x6239c81d0eabf129ULL, 0x8ee761de9d276be2ULL, 0x406a7a341eda6ad3ULL},
+    {0x4bf367ba4a493b31ULL, 0x54f20a529bf7f026ULL, 0xb696e0629795914bULL, 0xcddab96d8bf236acULL,
+     0x4ff2c70aed25ea13ULL, 0xfa1d09eb81cbbbe7ULL, 0x88fc8c87468544c5ULL, 0x847a670d696b3317ULL},
+    {0xf133421e64bcb626ULL, 0xaea638c826dee0b5ULL, 0xd6e7680bb310346cULL, 0xe06f4097d5d4ced3ULL,
+     0x099614527512a30bULL, 0xf3d867fde589a59aULL, 0x2e73254f52d0c180ULL, 0x9063d8a3333c74acULL},
+    {0xeda6c595d314e7bcULL, 0x2ee7464b467899edULL, 0x1cef423c0a1ed5d3ULL, 0x217e76ea69cc7613ULL,
+     0x27ccce1fe7cda917ULL, 0x12d8016b8a893f16ULL, 0xbcd6de849fc74f6bULL, 0xfa5817e2f3144e61ULL},
+    {0x1f3541640821ee4cULL, 0x1583eab40bc61992ULL, 0x7490caf61d72879fULL, 0x998ad9f3f76ae7b2ULL,
+     0x1e181950a41157f7ULL, 0xa9d7e1e6e8da3a7eULL, 0x963784eb8426b95fULL, 0x0ee4ed6e542e2a10ULL},
+    {0xb79d4cc5ac751e7bULL, 0x93f96472fd4211bdULL, 0x8c72d3d2c8de4fc6ULL, 0x7b69cbf5df44f064ULL,
+     0x3da90ca2f4bf94e1ULL, 0x1a5325f8f12894e2ULL, 0x0a437f6c7917d60bULL, 0x9be7048696c9cb5dULL}
+  },
+  {
+    {0x949c9976e1337c26ULL, 0x6faadebdd73d68e5ULL, 0x9e158614f1b768d9ULL, 0x22dfa5579cc4f069ULL,
+     0xccd6da17be93c6d6ULL, 0x24866c61a504f5b9ULL, 0x2121353c8d694da1ULL, 0x1c6ca5800140b8c6ULL},
+    {0xf1604a7dd4b79bb8ULL, 0xaee806fb52c878c8ULL, 0x34144f118d47b8e8ULL, 0x72edf52b949f9054ULL,
+     0xebfca84e2127015aULL, 0x9051d0c09cb7cef3ULL, 0x86e8fe58296deec8ULL, 0x33b2818841010d74ULL},
+    {0xbd5660ed9aed9f40ULL, 0x70ca6ad1532a8c99ULL, 0xc4978bfb95c371eaULL, 0xe5464d0d7003109dULL,
+     0x1af32fdfd9e535efULL, 0xabf57ea798c9185bULL, 0xed7a741712b42488ULL, 0x8e0296a7e97286faULL},
+    {0x01079383171b445fULL, 0x9bcf21e38131ad4cULL, 0x8cdfe205c93987e8ULL, 0xe63f4152c92e8c8fULL,
+     0x729462a930add43dULL, 0x62ebb143c980f05aULL, 0x4f3954e53b06e968ULL, 0xfe1d75ad242cf6b1ULL},
+    {0x8b57416e1f017d5eULL, 0x375333967674e99bULL, 0x6e6d94c0e8f488a0ULL, 0xb93a787adc16f95eULL,
+     0xc3ac51a2dcc99cccULL, 0xc134b4139aa47c1dULL, 0xf28fcdafafdfd8d5ULL, 0x0d57bd8e10b831edULL},
+    {0x9276fbccf0bcfc46ULL, 0x3a822aceb5cffee6ULL, 0x328ed2fec75d915bULL, 0xa145c113c359476cULL,
+     0xf61a81538be17bcdULL, 0x01e867c3aa6c3d8fULL, 0x5634e15d6516c82fULL, 0xc1437bd26948b9b0ULL},
+    {0xd2fcd2006c19d4c7ULL, 0xa0f3c437e1b1e976ULL, 0xf0545ff694f237e8ULL, 0xdd10ec3fc0bf8bb1ULL,
+     0x4f89696cac7cd3e1ULL, 0xed3714ec5f24bfe6ULL, 0x363eb1d85faf7706ULL, 0xfcbd604dc027cc32ULL},
+    {0x5f95c6c7af8685c8ULL, 0xd4c1c8ce2f8f01aaULL, 0xc44bbe322574692aULL, 0xb8003478d4a4a068ULL,
+     0x7c8fc6e52eca3cdbULL, 0xea1db16bec04d399ULL, 0xb05bc82e8f2bc5cfULL, 0x763d517ff44793d2ULL},
+    {0x16ce8eddc355363bULL, 0x4af2f70ff8820d6eULL, 0xcb7ed4d27661a508ULL, 0x41d3444edd195472ULL,
+     0x17fea2b438da9649ULL, 0x9bf69356aeb4a200ULL, 0xa13b5f916ab19c3dULL, 0xc0519c14dc9360a6ULL},
+    {0xc2571ae92e42e171ULL, 0xcb31ab63ed41ccf9ULL, 0x37f3c576b5c8854fULL, 0x66e5191bc62392a1ULL,
+     0x71565a1c6cd5683bULL, 0x484b0283606fe689ULL, 0xf3a25d6767e2fda6ULL, 0x87ba21de8a65c0a4ULL},
+    {0xde74e49ca70684d1ULL, 0x3ae8766133e80c3dULL, 0x5984a2a916a5c34dULL, 0x09a83eccb8298c35ULL,
+     0x9a19867caa4ca4c0ULL, 0x02085610b375b8ffULL, 0xf296328bf70396dcULL, 0x9c9ddc4cde6fae63ULL},
+    {0x4451c1b808bd98d0ULL, 0x644b1cd46575f240ULL, 0x6907eb337375d270ULL, 0x56c8bebdfa2286bdULL,
+     0xc713d2acc4632b46ULL, 0x17da427aafd60242ULL, 0x313065b7c95c7546ULL, 0xf8239898bf17a3deULL},
+    {0x94683d260b083b6eULL, 0x0a3752eb06f6a54dULL, 0x48bedc23752074ddULL, 0x637622fc3e822593ULL,
+     0xea0005136be55d3bULL, 0x9f5e12f4324d006dULL, 0x529486a964fc0270ULL, 0x09ba0d0c923399e6ULL},
+    {0x363858473a977080ULL, 0x4cf8e1b80c6a6ab6ULL, 0x919a5c6c0482261eULL, 0x517a9ad0e5ce4806ULL,
+     0x2792d40c056aa7aaULL, 0x4c7c6adae56c61b0ULL, 0xf19cb178a4b19e0cULL, 0x046d5c4fe4ba267fULL},
+    {0xd3e926ab121550b3ULL, 0xe4975e4ac147ce84ULL, 0x7a8be0f95eff722aULL, 0x71e4702c6fd4f2a0ULL,
+     0x13b92acf3cb7b280ULL, 0xc588716d28272d73ULL, 0x862c7bf3daa9fe5cULL, 0x78c008f2e2a79e42ULL},
+    {0xf3b7963f4c830320ULL, 0x842c7aa0903203e3ULL, 0xaf22ca0ae7327afbULL, 0x38e13092967609b6ULL,
+     0x73b8fb62757558f1ULL, 0x3cc3e831f7eca8c1ULL, 0xe4174474f6331627ULL, 0xa77989cac3c40234ULL}
+  },
+  {
+    {0xae8317f4b0166f7aULL, 0xfbd3e3f7ceec74e6ULL, 0xfdb516ace0874bfdULL, 0x3d846019c681f3a3ULL,
+     0x0b12ee5c7c1620b0ULL, 0xba68b4dd2b63c501ULL, 0xac03cd326668c51eULL, 0x2a6279f74e0bcb5bULL},
+    {0xfd8e139f8f5fcda8ULL, 0xf3e558c4bdee5bfdULL, 0xd76cbaf4e33f9f77ULL, 0x3a4c97a471771969ULL,
+     0xda27e84bf6dce6a7ULL, 0xff373d9613e6c2d1ULL, 0xf115193cd759a6e9ULL, 0x3f9b702563d2262cULL},
+    {0x12536fea87baa627ULL, 0x58c1fec1f72aa680ULL, 0x6c29b637601e5dc9ULL, 0x9e3c3c1cde9e01b9ULL,
+     0xefc8127b2bcfe0b0ULL, 0x351071022a12f50dULL, 0x6ccd6cb14879b397ULL, 0xf792f804f8a82f21ULL},
+    {0x8c3184911a335cc8ULL, 0x563459ba6a5913e4ULL, 0x1b920d61c7b32919ULL, 0x805ab8b6a02425adULL,
+     0x2ac512da8d006086ULL, 0x6ca4846abcf5c0fdULL, 0xafea51d8ac2138d7ULL, 0xcb647545344cd443ULL},
+    {0xa3f4f521e447f2c4ULL, 0x81b8da7a604291f0ULL, 0xd680bc467d5926deULL, 0x84f21fd534a1202fULL,
+     0x1d1e31814e9df3d8ULL, 0x1ca4861a39ab8d34ULL, 0x809ddeec5b19aa4aULL, 0x59f72f7e4d329366ULL},
+    {0x9f1b2466cdedca85ULL, 0x140bb7101a09538cULL, 0xac8ae8515e11115dULL, 0x0d63ff676f03f59eULL,
+     0x755e55517d234afbULL, 0x61c2db4e7e208fc1ULL, 0xaa9859cef28a4b5dULL, 0xbdd6d4fc34af030fULL},
+    {0x3f39e67f906151e5ULL, 0xcea27f5f55e10649ULL, 0xdca1d4e1c17cf7b7ULL, 0x0c326d122fe2362dULL,
+     0x05f7ac337dd35df3ULL, 0x0c3b7639c396dbdfULL, 0x0912f5ac03b7db1cULL, 0x9dea4b705c9ed4a9ULL},
+    {0x511053e453544774ULL, 0x834d0ecc3adba2bcULL, 0x4215d7f7bae371f5ULL, 0xfcfd57bf6c8663bcULL,
+     0xded2383dd6901b1dULL, 0x3b49fbb4b5587dc3ULL, 0xfd44a08d07625f62ULL, 0x3ee4d65b9de9b762ULL},
+    {0x3e56fe5bdf53aad0ULL, 0x51314de5e4604a67ULL, 0x386ad98607a261a0ULL, 0x8b7e021217afcc91ULL,
+     0xcbf411273b72aec5ULL, 0x13c85d05c4f9f509ULL, 0xeda56845b6484b57ULL, 0x13cb1642b3d0995bULL},
+    {0x5a994b6e717815deULL, 0xd995c7a0a7e131d1ULL, 0xc8b46df226c023aaULL, 0x8cfd094d702afcedULL,
+     0x7bc743cdced6a886ULL, 0xb7d70ec41fcabe75ULL, 0x2a6c9e47ddac9390ULL, 0x720694259310aa90ULL},
+    {0xa607b3263e8f793cULL, 0xa541166ecde3b289ULL, 0xf44ff2924a915b21ULL, 0x68bea906b58ecda6ULL,
+     0xd85b37b440292897ULL, 0xd2a508ae4b768423ULL, 0xd10bb79da413bbbeULL, 0x0262f481061491f4ULL},
+    {0xd17e80f55464d0ebULL, 0x89d3e1a767a613a7ULL, 0x77791260c8c97dadULL, 0xec2ff21fe4f0cbe7ULL,
+     0xed984ac2e9e6bc10ULL, 0xe3c53de877cba305ULL, 0x9bbaf9b283624fdcULL, 0x5e9451cd1485c0ecULL},
+    {0xfdfc9f63b7abad11ULL, 0xc7ec3a9263a46189ULL, 0x49ebee42f67037b7ULL, 0x8247f504cdac1710ULL,
+     0xfc518f8d397583e5ULL, 0xe7d24de70c3f8c2eULL, 0x354832669c5edcb1ULL, 0x94bba483f8c2cefcULL},
+    {0x1f13756db1761ec8ULL, 0xe53c8b98a4b97e55ULL, 0xb2aee3f84096cc28ULL, 0x48c361a0920f1a8dULL,
+     0xa98b672d8c31190aULL, 0x7bc1e7d1001855d4ULL, 0x242cfb07bf3f4b2aULL, 0x9bf44a3f32a28bc4ULL},
+    {0xeba8976299da550cULL, 0xb2c1781a16baa042ULL, 0x3068b082788c2f9dULL, 0xc0fa414594869a9eULL,
+     0x73bd9e39d50b693fULL, 0xb79e2a9c988e2c5eULL, 0xf1cb8de40f8f9f62ULL, 0x415b04ee1ea50c7bULL},
+    {0x64e5137d0d63d1faULL, 0x658fc05202a9d89fULL, 0x4889487450436309ULL, 0xe9ae30f8d598da61ULL,
+     0x2ed710d1818baf91ULL, 0xe27e9e068b6a0c20ULL, 0x1e28dcfb1c1a6b44ULL, 0x883acb64d6ac57dcULL}
+  },
+  {
+    {0x8735728dc2c6ff70ULL, 0x79d6122fc5dc2235ULL, 0x23f5d00319e277f9ULL, 0x7ee84e25dded8cc7ULL,
+     0x91a8afb063cd880aULL, 0x3f3ea7c63574af60ULL, 0x0cfcdc8402de7f42ULL, 0x62d0792fb31aa152ULL},
+    {0xb02c83f9dec31a21ULL, 0x988c8b236ad9d573ULL, 0x53e983aea57be365ULL, 0xe968734d646f834eULL,
+     0x9137ea8f5da6309bULL, 0x10f3a624c1f1ce16ULL, 0x782a9ea2ca440921ULL, 0xdf94739e5b46f1b5ULL},
+    {0x1df165a434a35ea8ULL, 0x3418e0f74d4412f6ULL, 0x5af1f8af518836c3ULL, 0x42ceef4d130e1965ULL,
+     0x5560ca0b543a1957ULL, 0xc33761e5886cb123ULL, 0x66624b1ffe98ed30ULL, 0xf772f4bf1090997dULL},
+    {0x56f8410ef4f8b16aULL, 0x97241afec47b266aULL, 0x0a406b8e6d9c87c1ULL, 0x803f3e02cd42ab1bULL,
+     0x7f0309a804dbec69ULL, 0xa83b85f73bbad05fULL, 0xc6097273ad8e197fULL, 0xc097440e5067adc1ULL},
+    {0xc507b6dd418e7dddULL, 0x39888d93472f19d6ULL, 0x7eae26be0c27eb4dULL, 0x17b53ed3fbabb884ULL,
+     0xfc27021b2b01ae4fULL, 0x88462e87cf488682ULL, 0xbee096ec215e2d87ULL, 0xeb2fea9ad242e29bULL},
+    {0xbbcc00c756b95bceULL, 0x5ec03906616da680ULL, 0x79162ee672214252ULL, 0x43132b6386a892d2ULL,
+     0x4bdd3ff22f3263bfULL, 0xd5b3733c9cd0a142ULL, 0x592eaa8244415ccbULL, 0x663e89248d5474eaULL},
+    {0x0d38ab35ce7c42d4ULL, 0x9fd493ef82feab10ULL, 0x46056b6d82111b45ULL, 0xda11dae173efc5c3ULL,
+     0xdc7402785545a7fbULL, 0xbdb2601c40d507e6ULL, 0x121dfeeb7066fa58ULL, 0x214369a839ae8c2aULL},
+    {0x3f747fa0b311898cULL, 0xe2a272e4cd0eac65ULL, 0x4bba5851f914d0bcULL, 0x7a1a9660c4a43ee3ULL,
+     0xe5a367cea1c8cde9ULL, 0x9d958ba97271abe3ULL, 0xf3ff7eb63d1615cdULL, 0xa2280dcef5ae20b0ULL},
+    {0x8c0ed566d4312483ULL, 0x5179a95d643e216fULL, 0xcc185fec17044493ULL, 0xb306333954991a21ULL,
+     0xd801ecdb0081a726ULL, 0x0149b0c64fa89bbbULL, 0xafe9065a4391b6b9ULL, 0xedc92786d633f3a3ULL},
+    {0xd6d9d9e37a6a308bULL, 0x623758304c2767d3ULL, 0x874a8bc6f38cbeb6ULL, 0xd94d3f1accb6fd9eULL,
+     0x92a9735bba21f248ULL, 0x272ad0e56cd1efb0ULL, 0x7437b69c05b03284ULL, 0xe7f047026948c225ULL},
+    {0x9ae868a9e9adfe1cULL, 0x3984403d314e39bbULL, 0xb5875720f2fe378fULL, 0x33f901e0ba44a628ULL,
+     0xea1125fe3652438cULL, 0xae9ec4e69dd1f20bULL, 0x1e740d9ebebf7fbdULL, 0x6dbd3ddc42dbe79cULL},
+    {0x266344a43794f8dcULL, 0xdcca923a483c5c36ULL, 0x2d6b6bbf3f9d10a0ULL, 0xb320c5ca81d9bdf3ULL,
+     0x620e28ff47b50a95ULL, 0x933e3b01cef03371ULL, 0xf081bf8599100153ULL, 0x183be9a0c3a8c8d6ULL},
+    {0x8a9443d77613aa81ULL, 0x8010080085fe6584ULL, 0x70fc4dbc7fb10288ULL, 0xf58280d3e86beee8ULL,
+     0x14fdd82f7c978c38ULL, 0xdf1204c10de44d7bULL, 0xa08a1c844160252fULL, 0x591554cac17646a5ULL},
+    {0x7ddc81ea77b46a08ULL, 0xcf5a6477c7480699ULL, 0x43a8cb346633f683ULL, 0x1b867e6b92363c60ULL,
+     0x439211141f60558eULL, 0xcdbcdd632f41450eULL, 0x7fc04601cc630e8bULL, 0xea7c66d597038b43ULL},
+    {0x34fc8820fbeee3f9ULL, 0x93e5349049091afdULL, 0x764b9be59a31f35cULL, 0x71f3786457e3d924ULL,
+     0x02fb34e0943aa75eULL, 0xa18c9c58ab8ff6e4ULL, 0x080f31b133cf0d19ULL, 0x5c9682db083518a7ULL},
+    {0xb6c185c341dca566ULL, 0x7de7fedad8622aa3ULL, 0x99e84d92901b6dfbULL, 0x30a02b0e7c4ad288ULL,
+     0xc7c81daa2fd3cf36ULL, 0xd1319547df89e59fULL, 0xb2be8184cd496733ULL, 0xd5f449eb93d3412bULL}
+  },
+  {
+    {0xc492ec644cd8f64cULL, 0x58a2d790279d7b51ULL, 0x0ced1fc51fc75256ULL, 0x3e658aed8f433017ULL,
+     0x0b61942e05da59ebULL, 0xba3d60a30ddc3722ULL, 0x7c311cd1742e7f87ULL, 0x6473ffeef6b01b6eULL},
+    {0x8303604f692ac542ULL, 0xf079ffe1227b91d3ULL, 0x19f63e6315aaf9bdULL, 0xf99ee565f1f344fbULL,
+     0x8a1d661fd6219199ULL, 0x8c883bc6d48ce41cULL, 0x1065118f3c74d904ULL, 0x713889ee0faf8b1bULL},
+    {0xc035f697960eb8c7ULL, 0xf1599f2ce2de04d3ULL, 0x892450f8d2ad9228ULL, 0x7d48129bb829c1abULL,
+     0x24d785e13a50afc9ULL, 0x2745ba2763a96ee0ULL, 0x956534013bfb6d7bULL, 0x536202671bad2a42ULL},
+    {0x972b3f8f81a1b3beULL, 0x4f3ce145ce2764a0ULL, 0xe2d0f1cc28c4f5f7ULL, 0xdeee0c0dc7f3985bULL,
+     0x7df4adc0d39e25c3ULL, 0x40619820c467a080ULL, 0x440ebc9361cf5a58ULL, 0x527729a6422ad600ULL},
+    {0xa691398a4a9eb3f0ULL, 0x56c1dbff3b99a48fULL, 0x9a87e1b91b4b5b32ULL, 0xad6396145378b5feULL,
+     0x437a243ec26b5302ULL, 0x0275878c3ccb4c10ULL, 0x0e81e4a21de07015ULL, 0x0c6265c9850df3c0ULL},
+    {0xca6c0937b1b76ba6ULL, 0x1a2eab854d2026dcULL, 0xb1715e1519d9ae0aULL, 0xf1ad9199bac4a026ULL,
+     0x35b3dfb807ea7b0eULL, 0xedf5496f3ed9eb89ULL, 0x8932e5ff2d6d08abULL, 0xf314874e25bd2731ULL},
+    {0xc8327149a8c25ff6ULL, 0x29bf2556782e6569ULL, 0x9012f5c6cd68fc38ULL, 0x3e67e8bd3b982ad5ULL,
+     0x5e3a75386ecdca88ULL, 0xf297eaa6c1753a04ULL, 0x10121e5405db3256ULL, 0xab9697d4f0851055ULL},
+    {0xefb26a753f73f449ULL, 0x1d1c94f88d44fc79ULL, 0x49f0fbc53bc0dc4dULL, 0xb747ea0b3698a0d0ULL,
+     0x5218c3fe228d291eULL, 0x35b804b543c129d6ULL, 0xfac859b8d1acc516ULL, 0x6c10697d95d6e668ULL},
+    {0xe5d27171f6bdf1bfULL, 0x0b77b876facb0d8fULL, 0xda95471d8496a31bULL, 0x46a50dbb3f16b103ULL,
+     0x2a4f3f977b865bffULL, 0x848195e66b1c198cULL, 0x491ad08821702ea6ULL, 0x3f20b43749035228ULL},
+    {0xc38e438f0876fd4eULL, 0x45f0c30783d2f383ULL, 0x203cc2ecb10934cbULL, 0x6a8f24392c9d46eeULL,
+     0xf16b431b65ccde7bULL, 0x41e2cd1827e76a6fULL, 0xb9c8cf8f4e3484d7ULL, 0x64426efd8315244aULL},
+    {0xe6ec98093a69fc01ULL, 0x7e20fecbfaa9dfc2ULL, 0x5cfdbb07f56f2a55ULL, 0xb1cd68680bbdbfdfULL,
+     0x247b4995986eb9edULL, 0x74785bf53dd0955eULL, 0x88f74f61c0c7a201ULL, 0x8861a15b5d01a80dULL},
+    {0x1c0a8e44fc94dea3ULL, 0x34c8cdbfdad6a0b0ULL, 0x919c384004113cefULL, 0xfd32fba415490ffaULL,
+     0x58d190f6795dcfb7ULL, 0xfef01b0383588bafULL, 0x9e6d1d63ca1fc1c0ULL, 0x53173f96f0a41ac9ULL},
+    {0x54637e4182997cc1ULL, 0x08c5a96ce3720c9cULL, 0x78bce01c11de5d45ULL, 0x49d623e50dfdd75aULL,
+     0x8c72a4680fb2a3acULL, 0xcc53bbff319c25afULL, 0x198eba7978a92421ULL, 0xcd61f28ba3bdecf3ULL},
+    {0x2b1d402aba16f73bULL, 0x2fb310148cf9b9fcULL, 0x2d51e60e446ef7bfULL, 0xc731021bb91e1745ULL,
+     0x9d3b47244fee99d4ULL, 0x4bca48b6fac5c1eaULL, 0x70f5f514bbea9af7ULL, 0x751f55a5974c283aULL},
+    {0x23899fe8662595c2ULL, 0x495d672711a80773ULL, 0x86c971d2b0d1d43bULL, 0xb518637c93b7a65fULL,
+     0x30e453bad98c99ceULL, 0xba6e0d4a14d39f5bULL, 0xf7db02a6431ce415ULL, 0xcd909c7cf6e1d823ULL},
+    {0x6e30251acb452fdbULL, 0x31ee696550f30650ULL, 0xb0b3e508933548d9ULL, 0xb8949a4ff4b0ef5bULL,
+     0x208b83263c88f3bdULL, 0xab147c30db1d9989ULL, 0xed6515fd44d4df03ULL, 0x17a12f75e72eb0c5ULL}
+  },
+  {
+    {0x25914f7881fdad90ULL, 0xcf638f560d2cf6abULL, 0xb90bc03fcc054de5ULL, 0x932811a718b06350ULL,
+     0x2f00b3309bbd11ffULL, 0x76108a6fb4044974ULL, 0x801bb9e0a851d266ULL, 0x0dd099bebf8990c1ULL},
+    {0x14c6dd8a58d6cd46ULL, 0x9cb633b58e6634d2ULL, 0xc1305047f81bc328ULL, 0x12ede0e226a177e5ULL,
+     0x332cca62065a6f4fULL, 0xc3a47ecd67be487bULL, 0x741eb1870f47ed1cULL, 0x99e66e58e7598b14ULL},
+    {0xebd6a6777b0ac93dULL, 0xa6e37b0d78f5e0d7ULL, 0x2516c09676f5492bULL, 0x1e4bf8889ac05f3aULL,
+     0xcdb42ce04df0ba2bULL, 0x935d5cfd5062341bULL, 0x8a30333382acac20ULL, 0x429438c45198b00eULL},
+    {0xfb2838be67e573e0ULL, 0x05891db94084c44bULL, 0x9131137396c1c2c5ULL, 0x6aebfa3fd958444bULL,
+     0xac9cdce9e56e55c1ULL, 0x7148ced32caa46d0ULL, 0x2e10c7efb61fe8ebULL, 0x9fd835daff97cf4dULL},
+    {0x6c626f56c1770616ULL, 0x5351909e09da9a2dULL, 0xe58e6825a3730e45ULL, 0x9d8c8bc003ef0a79ULL,
+     0x543f78b6056becfdULL, 0x33f13253a090b36dULL, 0x82ad4997794432f9ULL, 0x1386493c4721f502ULL},
+    {0x3794eefa5abea82aULL, 0x8dc611b993fe62d4ULL, 0x69f1af37281ef606ULL, 0x6af546c839839e69ULL,
+     0x625578c7c977ec23ULL, 0xa8de294cbd5c0576ULL, 0xe2ddaf0f7cd1a4c0ULL, 0x8243fc704f95f4d4ULL},
+    {0xe566f400b008733aULL, 0xcba0697d512e1f57ULL, 0x9537c2b240509cd0ULL, 0x5f989c6957353d8cULL,
+     0x7dbec9724c3c2b2fULL, 0x90e02fa8ff031fa8ULL, 0xf4d15c53cfd5d11fULL, 0xb3404fae48314dfcULL},
+    {0xa36da109081e9387ULL, 0xfb9780d78c935828ULL, 0xd5940332e540b015ULL, 0xc9d7b51be0f466faULL,
+     0xfaadcd41d6d9f671ULL, 0xba6c1e28b1a2ac17ULL, 0x066a7833ed201e5fULL, 0x19d99719f90f462bULL},
+    {0xf02cc3a9f327a07fULL, 0xefb27a9b4490937dULL, 0x81451e96b1b3afa5ULL, 0x67e24de891883be4ULL,
+     0x1ad65d4770869e54ULL, 0xd36291a464a3856aULL, 0x070a1abf7132e880ULL, 0x9511d0a30e28dfdfULL},
+    {0xfdeed650f8d1cac4ULL, 0xeb99194b6d16bda5ULL, 0xb53b19f71cabbe46ULL, 0x5f45af5039b9276cULL,
+     0xd0784c6126ee9d77ULL, 0xf7a1558b0c02ca5dULL, 0xb61d6c59f032e720ULL, 0xae3ffb95470cf3f7ULL},
+    {0x9b185facc72a4be5ULL, 0xf66de2364d848089ULL, 0xba14d07c717afea9ULL, 0x25bfbfc02d551c1cULL,
+     0x2cef0ecd4cdf3d88ULL, 0x8cee2aa3647f73c4ULL, 0xc10a7d3d722d67f7ULL, 0x090037a294564a21ULL},
+    {0xe6567987fa9ced27ULL, 0x36b2d8842a9e5dbcULL, 0xf4bdeec6380d8e8cULL, 0xb5e6a6b0dbc300d0ULL,
+     0x7ba7e9b9592bef36ULL, 0x2b373c4fee81b749ULL, 0x484b5e01f0ce596bULL, 0x7cc51c62c0bf54ccULL},
+    {0x6ac07bb84f3815c4ULL, 0xddb9f6241aa9017eULL, 0x31e30228ca85720aULL, 0xe59d63f57cb75838ULL,
+     0x69e18e777baad2d0ULL, 0x2cfdb784d42f5d73ULL, 0x025dd53df5774983ULL, 0x2f80e7cee042cd52ULL},
+    {0x4bf56bafec695bb0ULL, 0x22da1ca8f13c78adULL, 0x0f9c4b131182abb0ULL, 0x02ea555aae7d249eULL,
+     0x868583f25e05d9e3ULL, 0xe09cdcdf70382afaULL, 0xdf072ec787080408ULL, 0x0a317847cbf75658ULL},
+    {0x43f18d7f4d6ee4abULL, 0xd3ac8cde9570c3dcULL, 0x527e49070b8c9b2aULL, 0x716709a7c5a4c0f1ULL,
+     0x930852b0916a26b1ULL, 0x3cc17fcf4e071177ULL, 0x34f5e3d459694868ULL, 0xee0341aba28f655dULL},
+    {0xf431f462060b5f61ULL, 0xa56f46b47bd057c2ULL, 0x348dca6c47e1bf65ULL, 0x9a38783e41bcf1ffULL,
+     0x7a5d33a9da710718ULL, 0x5a7799872e0aeaf6ULL, 0xca87314d2d29d187ULL, 0xfa0edc3ec687d733ULL}
+  },
+  {
+    {0x1c894849cb198ac7ULL, 0xa884a93d0f264665ULL, 0x2da964ef9b200678ULL, 0x3c351b87009834e6ULL,
+     0xafb2ef9fe2c4b44bULL, 0x580f6c473326790cULL, 0xb84805210b02264aULL, 0x8ba6f9e242a194e2ULL},
+    {0x39d934abd3c095f1ULL, 0x04b261bee4b76d71ULL, 0x1d2e6970e73e6984ULL, 0x879fb23b5e5fcb11ULL,
+     0x11506c72dfd75490ULL, 0x3a97d08561bcf1c1ULL, 0x43201d82bf5e7007ULL, 0x7f0ac52f798232a7ULL},
+    {0xb25101fb319d7682ULL, 0xb02931290a982feeULL, 0x51c1c9b90261b344ULL, 0x0e008c5bbfd371faULL,
+     0xd866dd1c0278ca33ULL, 0x666f76a6e5aa53b1ULL, 0xe5cfb7796013a2cfULL, 0x1d3a1aada3521836ULL},
+    {0x76b4131a567193ecULL, 0xaf3c305ae5f6e70bULL, 0x9587bd39031eebddULL, 0x5709def871bbe831ULL,
+     0x570599830eb2b669ULL, 0x4d80ce1b875b7029ULL, 0x838a7da80364ac16ULL, 0x2f431d23be1c83abULL},
+    {0xe781276638235d4eULL, 0x1c62bd67496e3298ULL, 0x8378660c3f175bc8ULL, 0x4d04e18917afdd4dULL,
+     0x32a8160185a8068cULL, 0xdb58e4e192b29a85ULL, 0xe8a65b86c70d8a3bULL, 0x5f0e6f4e98a0403bULL},
+    {0x2c2492b73f894ae0ULL, 0xf59df3e5b75f18ceULL, 0x7cb740d28f53cad0ULL, 0x3eb585fbc4f01294ULL,
+     0x17da0c8632c7f717ULL, 0xeb8c795baf943f4cULL, 0x4ee23fb5f67c51d2ULL, 0xef18757568889949ULL},
+    {0x3ea011a4e822f0d0ULL, 0xbc647ad15a8704f8ULL, 0xbb315b3550c6820fULL, 0x863dec3db7e76becULL,
+     0x01ff5d3af017bfc7ULL, 0x20054439976b8229ULL, 0x067fca370bbd0d3bULL, 0xf63dde647f5e3d0fULL},
+    {0x75d9bc15adf7cccfULL, 0x81a3e5d6dfa1e1b0ULL, 0x8c39e444249bc17eULL, 0xf37dccb28ea7fd43ULL,
+     0xda654873907fba12ULL, 0x35daa6da4a372904ULL, 0x0564cfc66283a6c5ULL, 0xd09fa4f64a9395bfULL},
+    {0xb510b3b56aa39dffULL, 0x59b43da29f8e4d8cULL, 0xa8ce31fd9e4c4b9fULL, 0x0e20be26c1303c01ULL,
+     0x18187182e8ee47c9ULL, 0xd9687cdb7db98101ULL, 0x7a520e4da1e14ff6ULL, 0x429808ba8836d572ULL},
+    {0x174d46996d16768eULL, 0x9fc4ff6a628bf217ULL, 0x77705a94154e490dULL, 0x9d96dd288d2d997aULL,
+     0x77e2d9d8ce5d72c4ULL, 0x9d06c5a4c11c714fULL, 0x02aa513679e4a03eULL, 0x1386b3c2030ff28bULL},
+    {0x26a42d69ea40dc3aULL, 0xdc84ad22aecc018fULL, 0x25c36c7b3270f04aULL, 0x46ba6d4750fa72edULL,
+     0x6c37d1c593e58a8eULL, 0xa2394731120c088cULL, 0xc3be4263cb6e86daULL, 0x2c417d367126d038ULL},
+    {0xcca523bb440e2229ULL, 0x324673a273ef4d04ULL, 0xaf3adf343e11ec39ULL, 0x6136d7f1dc5968d3ULL,
+     0x7a7b2899b053a927ULL, 0x3eaa2661ae067ecdULL, 0x8549b9c802779cd9ULL, 0x061d7940c53385eaULL},
+    {0xe07141fcaaa2902bULL, 0x539ad799e4f69ad3ULL, 0xa6453f94813f9ffdULL, 0xc58d3c48375bc2f7ULL,
+     0xb3326fad5dc64e96ULL, 0x3aafcaa9b240e354ULL, 0x1d1b0903aca1e7a9ULL, 0x4ceb97671211b8a0ULL},
+    {0x1eb4de4687032d58ULL, 0xc54f3d835e2c79e0ULL, 0x07818df45d04ef23ULL, 0x55faa9c8673d41b4ULL,
+     0xced64f6f89b95355ULL, 0x4860d2eab7415c84ULL, 0x5fdb9bd2050ebad3ULL, 0xdb53e0cc6685a5bfULL},
+    {0x919fca5fabfae1caULL, 0x937afaac1a21459bULL, 0x9e0ca91c1f66a4d2ULL, 0x194cc7f323ec1331ULL,
+     0xad25143a8aa11690ULL, 0xbe40ad8d09b59e08ULL, 0x37d60d9be750860aULL, 0x6c53b008c6bf434cULL},
+    {0x832d7080eb6b242dULL, 0xd30bd0233b71e246ULL, 0x7027991bbe31139dULL, 0x68797e91462e4e53ULL,
+     0x423fe20a6b4e185aULL, 0x82f2c67e42d9b707ULL, 0x25c817684cf7811bULL, 0xbd53005e045bb95dULL}
+  },
+  {
+    {0xe5f649be9d8e68fdULL, 0xdb0f05331b044320ULL, 0xf6fde9b3e0c33398ULL, 0x92f4209b66c8cfaeULL,
+     0xe9d1afcc1a739d4bULL, 0x09aea75fa28ab8deULL, 0x14375fb5eac6f1d0ULL, 0x6420b560708f7aa5ULL},
+    {0x9eae499c6254dc41ULL, 0x7e2939247a837e7eULL, 0x74aec08c090524a7ULL, 0xf82b92198d6f55f2ULL,
+     0x493c962e1402cec5ULL, 0x9f17ca17fa2f30e7ULL, 0xbcd783e8e9b879cbULL, 0xea3d8c145a6f145fULL},
+    {0xdede15e75e0dee6eULL, 0x74f24872dc628aa2ULL, 0xd3e9c4fe7861bb93ULL, 0x56d4822a6187b2e0ULL,
+     0xb66417cfc59826f9ULL, 0xca2609692408169eULL, 0xedf69d06c79ef885ULL, 0x00031f8adc7d138fULL},
+    {0x103c46e60ebcf726ULL, 0x4482b8316231470eULL, 0x6f6dfaca487c2109ULL, 0x2e0ace9762e666efULL,
+     0x3246a9d31f8d1f42ULL, 0x1b1e83f1574944d2ULL, 0x13dfa63aa57f334bULL, 0x0cf8daed9f025d81ULL},
+    {0x30d78ea800ee11c1ULL, 0xeb053cd4b5e3dd75ULL, 0x9b65b13ed58c43c5ULL, 0xc3ad49bdbd151663ULL,
+     0x99fd8e41b6427990ULL, 0x12cf15bd707eae1eULL, 0x29ad4f1b1aabb71eULL, 0x5143e74d07545d0eULL},
+    {0x30266336c88bdee1ULL, 0x25f293065876767cULL, 0x9c078571c6731996ULL, 0xc88690b2ed552951ULL,
+     0x274f2c2d852705b4ULL, 0xb0bf8d444e09552dULL, 0x7628beeb986575d1ULL, 0x407be2387f864651ULL},
+    {0x0e5e3049a639fc6bULL, 0xe75c35d986003625ULL, 0x0cf35bd85dcc1646ULL, 0x8bcaced26c26273aULL,
+     0xe22ecf1db5536742ULL, 0x013dd8971a9e068bULL, 0x17f411cb8a7909c5ULL, 0x5757ac98861dd506ULL},
+    {0x85de1f0d1e935abbULL, 0xdefd10b4154de37aULL, 0xb8d9e392369cebb5ULL, 0x54d5ef9b761324beULL,
+     0x4d6341ba74f17e26ULL, 0xc0a0e3c878c1dde4ULL, 0xa6d7758187d918fdULL, 0x6687601502ca3a13ULL},
+    {0xc7313e9cf36658f0ULL, 0xc433ef1c71f8057eULL, 0x853262461b6a835aULL, 0xc8f053987c86394cULL,
+     0xff398cdfe983c4a1ULL, 0xbf5e816203b7b931ULL, 0x93193c46b7b9045bULL, 0x1e4ebf5da4a6e46bULL},
+    {0xf9942a6043a24fe7ULL, 0x29c1191effb3492bULL, 0x9f662449902fde05ULL, 0xc792a7ac6713c32dULL,
+     0x2fd88ad8b737982cULL, 0x7e3a0319a21e60e3ULL, 0x09b0de447383591aULL, 0x6df141ee8310a456ULL},
+    {0xaec1a039e6d6f471ULL, 0x14b2ba0f1198d12eULL, 0xebc1a1603aeee5acULL, 0x401f4836e0b964ceULL,
+     0x2ee437964fd03f66ULL, 0x3fdb4e49dd8f3f12ULL, 0x6ef267f629380f18ULL, 0x3e8e96708da64d16ULL},
+    {0xbc19180c207674f1ULL, 0x112e09a733ae8fdbULL, 0x996675546aaeb71eULL, 0x79432af1e101b1c7ULL,
+     0xd5eb558fde2ddec6ULL, 0x81392d1f5357753fULL, 0xa7a76b973ae1158aULL, 0x416fbbff4a899991ULL},
+    {0x9e65fdfd0d4a9dcfULL, 0x7bc29e48944ddf12ULL, 0xbc1a92d93c856866ULL, 0x273c69056e98dfe2ULL,
+     0x69fce418cdfaa6b8ULL, 0x606bd8235061c69fULL, 0x42d495a06af75e27ULL, 0x8ed3d5056d873a1fULL},
+    {0xaf5528416ab25b6aULL, 0xc6c0ffc72b1a4523ULL, 0xab18827b21c99e03ULL, 0x060e86489034691bULL,
+     0x5207f90f93c7f398ULL, 0x9f4a96cb82f8d10bULL, 0xdd71cd793ad0f9e3ULL, 0x84f435d2fc3a54f5ULL},
+    {0x4b03c55b8e33787fULL, 0xef42f975a6384673ULL, 0xff7304f75051b9f0ULL, 0x18aca1dc741c87c2ULL,
+     0x56f120a72d4bfe80ULL, 0xfd823b3d053e732cULL, 0x11bccfe47537ca16ULL, 0xdf6c9c741b5a996bULL},
+    {0xee7332c7904fc3faULL, 0x14a23f45c7e3636aULL, 0xc38659c3f091d9aaULL, 0x4a995e5db12d8540ULL,
+     0x20a53becf3a5598aULL, 0x56534b17b1eaa995ULL, 0x9ed3dca4bf04e03cULL, 0x716c563ad8d56268ULL}
+  },
+  {
+    {0x5043dea7e0f222c2ULL, 0x309d42ac72e65142ULL, 0x94fe9ddd9216cd30ULL, 0xd6539c7d0f87feecULL,
+     0x03c5a57c432ac7d7ULL, 0x72692cf0327fda10ULL, 0xec28c85f280698deULL, 0x2331fb467ec283b1ULL},
+    {0xa0158eeae457a477ULL, 0xd19857dbee6ddc05ULL, 0xb326522418c41671ULL, 0x3ffdfc7e3c2c0d58ULL,
+     0x3a3a525426ee7cdaULL, 0x341b0869df02c3a8ULL, 0xa023bf42723bbfc8ULL, 0x3d15002a14452691ULL},
+    {0xc961b2f687500b96ULL, 0x795510e72dcd9425ULL, 0x0308172978615433ULL, 0xe5d0145465445029ULL,
+     0x5bd13302bf690cbeULL, 0x44e48831731eca67ULL, 0x73306bc72b8038a4ULL, 0x351d151ebf57bf02ULL},
+    {0x5ef7324c85edfa30ULL, 0x2597655487d4f3daULL, 0x352f5bc0dcb50c86ULL, 0x8f6927b04832a96cULL,
+     0xd08ee1ba55f2f94cULL, 0x6a996f99344b45faULL, 0xe133cb8da8aa455dULL, 0x5d0721ec758dc1f7ULL},
+    {0xf3d44e1f9a876441ULL, 0x82bc0c14147a818dULL, 0x33ddc1170603eddeULL, 0x77163f2e0a25f260ULL,
+     0xb54c02caa3bfaa53ULL, 0xbd1b2502e2256982ULL, 0xc4e1728c1a6f37dcULL, 0xfe36c213814c94a5ULL},
+    {0xf3cae7e9262a3539ULL, 0x78a49d1d6670d59eULL, 0x37de0f63c1c5e1b9ULL, 0x3072c30c69cb7c1cULL,
+     0x1d278a5277c850e6ULL, 0x84f15f8f1f6a3de6ULL, 0x46a8bb45592ca7adULL, 0x1912e3eee4d424b8ULL},
+    {0xc1ffe2d490e31734ULL, 0x91b1f1267fca007cULL, 0x5459b1d0ae3f77e8ULL, 0x262b051d46425c88ULL,
+     0xcf5c8f765c51e274ULL, 0x997481e2304e6146ULL, 0x6fc1198bd84046b5ULL, 0x1cb0a6bbe7f7a6bdULL},
+    {0x6ba7a92079e5fb67ULL, 0xe1331feb70aa725eULL, 0x5080ccf57df5d837ULL, 0xe4cae01d7ff72e21ULL,
+     0xd9243ee60412a77dULL, 0x06ff7cacdf449025ULL, 0xbe75f7cd23ef5a31ULL, 0xbc9578220ddef7a8ULL},
+    {0xc4737ad11b7f30b0ULL, 0x525ab2c63629dcf9ULL, 0x963f4cc1186ae160ULL, 0x8507671373e6b6e0ULL,
+     0xd9be3180f6998bcfULL, 0x93d91da3b1c8d8d8ULL, 0xf902ce661b8c0054ULL, 0x47e7924d74a8a768ULL},
+    {0xdc988086365e668bULL, 0xada8dcdaaabda5fbULL, 0xbc146b4c255f1fbeULL, 0x9cfcde29cf34cfc3ULL,
+     0xacbb453e7e85d1e4ULL, 0x9ca09679f92358b5ULL, 0x15fc2d96240823ffULL, 0x8d65adf70c11d11eULL},
+    {0x323cfd177e19a46fULL, 0x0948a7a786161156ULL, 0x50d06b977e7d3363ULL, 0x41c47ec1a702579dULL,
+     0x9455998e59e9260bULL, 0xc865e44446c24260ULL, 0x393021ec13bc3744ULL, 0x4981994ecd92a14aULL},
+    {0x8cf7230cb0ce1c55ULL, 0x5b534d050bbfb607ULL, 0xee1ef1130e16363bULL, 0x27e0aa7ab4999e82ULL,
+     0xce1dac2d79362c41ULL, 0x67920c9091bb6cb0ULL, 0x1e648d632223df24ULL, 0x0f7d9eefe32e8f28ULL},
+    {0x9766f264d66f51c0ULL, 0x644317ab5d9ccea5ULL, 0xa39b37bcd721e232ULL, 0x98bdde0bb9daf737ULL,
+     0xc2ecc758165166bdULL, 0x0951a285a2802108ULL, 0xe39fbf24997aa66fULL, 0x1a2f6862db62da27ULL},
+    {0x775557f10296f4fdULL, 0x1dca76a3ea51b436ULL, 0xf3e98f60fb950805ULL, 0x31ff32ea831cf7f1ULL,
+     0x643e7bf18d2c714bULL, 0x64b5c3392e9d2acaULL, 0xa9fd9ccc6adc2d23ULL, 0xfc2397eccc721b9bULL},
+    {0xab651fc764465367ULL, 0xe43870152b098f57ULL, 0x0a91d519d382376fULL, 0xb5afdb0a53cad929ULL,
+     0x457e1875138d5523ULL, 0xa92becae1aecacfbULL, 0x0762f6e811484f49ULL, 0x114b5c86dda16c2bULL},
+    {0x6943f39afa833834ULL, 0x22951722a6328562ULL, 0x81d63dd54170fc10ULL, 0x9f5fa58faecc2e6dULL,
+     0xb66c8725e77d9a3bULL, 0x11235cea6384ebe0ULL, 0x06a8c1185845e24aULL, 0x0137b286ebd093b1ULL}
+  },
+  {
+    {0xdb567d6ac42bd6d2ULL, 0x6df86468bb1f96aeULL, 0x0efe5b1a4843b28eULL, 0x961bbb056379b240ULL,
+     0xb6caf5f070a6a26bULL, 0x70686c0d328e6e39ULL, 0x80da06cf895fc8d3ULL, 0x804d8810b363fdc9ULL},
+    {0x63b99ce74462007dULL, 0xb8ab48a54cb5f5b7ULL, 0x9ec673d2f55edde7ULL, 0xd1567f748cfaefdaULL,
+     0x46381b6b0887bcecULL, 0x694497cee178f3c2ULL, 0x5e6525e31e6266cbULL, 0x5931de26697d6413ULL},
+    {0x14e49da11f17a34cULL, 0x5420ab39235a1456ULL, 0xb76372412f50363bULL, 0x7b15d623c3fabb6eULL,
+     0xa0ef40b1e274e49cULL, 0x5cf5074496b1860aULL, 0xd6583fbf66afe5a4ULL, 0x44240510f47e3e9aULL},
+    {0x142b55021a93507aULL, 0xb4cd11878d3c06cfULL, 0xdf70e76a91ec3f40ULL, 0x484e81ad4e7553c2ULL,
+     0x830f87b5272e9d6eULL, 0xea1c93e5c6ff514aULL, 0x67cc2adcc4192a8eULL, 0xc77e27e242f4535aULL},
+    {0xb5358b1e48ac2840ULL, 0x18311294ecba9477ULL, 0xda58f990a6946b43ULL, 0x3098baf99ab41819ULL,
+     0x66c4c1584198da52ULL, 0xab4fc17c146bfd1bULL, 0x2f0a4c3cbf36a908ULL, 0x2ae9e34b58cf7838ULL},
+    {0x45eb40ec0ccced58ULL, 0x25cd4b9c0da44f98ULL, 0x43e06458871812c6ULL, 0x99f80d5516cef651ULL,
+     0x571340c9ce6dc153ULL, 0x138d5117d8665521ULL, 0xacdb45bc4e07014dULL, 0x2f34bb3884b60b91ULL},
+    {0x417499e84a34f239ULL, 0x15fdb83cb90402d5ULL, 0xb75f46bf433aa832ULL, 0xb61e15af63215db1ULL,
+     0xaabe59d4a127f89aULL, 0x5d541e0c07e816daULL, 0xaaba0659a618b692ULL, 0x5532773317266026ULL},
+    {0x8cda9cf2d0c05199ULL, 0x502fbc22fae78454ULL, 0xc0bda9dff572a182ULL, 0x5f9b71b86158b372ULL,
+     0xe0f33a592b82dd07ULL, 0x763027359523032eULL, 0x7fe1a721c4505a32ULL, 0x7b6e3e82f796409fULL},
+    {0x023c155d3f6effc7ULL, 0x1fbd69ff9c90f0c7ULL, 0xe5d7da8abeec2c5dULL, 0x8813872bd7e86273ULL,
+     0x9f3bc2c655f5e228ULL, 0x11482869b0923b41ULL, 0x65d75c741aa307caULL, 0xda92c2577f24eee5ULL},
+    {0x26357732edc665d1ULL, 0x9fb5b731a939ef1bULL, 0x7db720fb94968089ULL, 0x36f75f2c33138c52ULL,
+     0xf8b793ec48d3cb97ULL, 0x8dff1d456d261726ULL, 0xfb65791b885c4ffbULL, 0xf7c79e2df1a3a870ULL},
+    {0x08dd1028754c92e1ULL, 0xca90b57acf0fef34ULL, 0x1a9b84ac8af55919ULL, 0xaa95e0e1ed93686bULL,
+     0x46737315167021a4ULL, 0x6cb6a0da20d5ff98ULL, 0xecc4801a1092e706ULL, 0xedcab23a3c5e61a6ULL},
+    {0xb4c66356ea37ba9eULL, 0x1adc84150afff55dULL, 0xf0080ef9596cc862ULL, 0x756c85b86d647ab6ULL,
+     0xc9db94aa1db9c215ULL, 0x2dd36db12013b1a5ULL, 0xde6ac61c4286c903ULL, 0x3fd32f88c76cf884ULL},
+    {0x7f1290fca06d107eULL, 0x697261fdb7661137ULL, 0x1bb5be4e947b4b38ULL, 0xb49826b63bb79130ULL,
+     0x019ddfe85ba8bffbULL, 0xb1af79007e3fa8e4ULL, 0x72e1bdf201bcfe7fULL, 0x2ed3ca8fd1169aeaULL},
+    {0x3befda8cd745fff1ULL, 0x70b9e9b669b9924eULL, 0xa5df48cfd1511381ULL, 0x84f93fe2d06bc535ULL,
+     0xaa42c5a9b279a6c3ULL, 0x651da6c4d8f96132ULL, 0xb0368c8b01b6aea5ULL, 0x64e44c47ac7862a2ULL},
+    {0xe17a9947d9de99a8ULL, 0xc2e61b2dc93477bdULL, 0x57f684d41d19e287ULL, 0x843c2122fe358135ULL,
+     0xe2d3e2e904f7e8abULL, 0xbf93ffe9b5f27aeeULL, 0x29830d1d7b1858c4ULL, 0xa8f449648106adbfULL},
+    {0xe3417bc035d0b34aULL, 0x440b386b8327c0a7ULL, 0x8fb7262dac0362d1ULL, 0x2c41114ce0cdf943ULL,
+     0x2ba5cef1ad95a0b1ULL, 0xc09b37a867d54362ULL, 0x26d6cdd201e486c9ULL, 0x20477abf42ff9297ULL}
+  },
+  {
+    {0xa004dcb3292a9287ULL, 0xddc15cf677b092c7ULL, 0x083a8464806c0605ULL, 0x4a68df703db997b0ULL,
+     0x9c134e4505bf7dd0ULL, 0xa4e63d398ccf7f8cULL, 0xa6e6517f41b5f8afULL, 0xaa8b9342ad7bc1ccULL},
+    {0xc41764717af715d2ULL, 0xe2f7f594d0134a96ULL, 0x2c1873efa41ec956ULL, 0xe4e7b4f677821304ULL,
+     0xe5c8ff9788d5374aULL, 0x2b915e6380823d5bULL, 0xea6bc755b2ee8fe2ULL, 0x6657624ce7112651ULL},
+    {0xd6f800e07442f1d5ULL, 0x475607d166e0e3abULL, 0x82807f16b7c64047ULL, 0x8858e1e3a749883dULL,
+     0x5859120b8231ee10ULL, 0x1b80e7eb638a1eceULL, 0xcb72525ac6aa73a4ULL, 0xa7cdea3d844423acULL},
+    {0x57477b11e51732d2ULL, 0xdfd6eb282538fc0eULL, 0x5c43b0cc3b39eec5ULL, 0x6af12778cb36cc57ULL,
+     0x70b0852d06c425aeULL, 0x6df92f8c5c221b9bULL, 0x6c8d4f9ece826d9cULL, 0xf59aba7bb49359c3ULL},
+    {0xd2eb2cf152bfda05ULL, 0xe0e4c4e96197b98cULL, 0x1d35076cf8a1726fULL, 0x6c06085b2db11e3dULL,
+     0x15c0c4d74463ba14ULL, 0x9d292f830030238cULL, 0x1311ee8b3727536dULL, 0xfeea86efbeaedc1eULL},
+    {0xa7f96054afa05dd8ULL, 0x26dfcf21fcaf119eULL, 0xe20ef2e30564bb59ULL, 0xef4dca5061cb02b8ULL,
+     0xcda7838a65d30672ULL, 0x8b08d534fd657e86ULL, 0x4c5b439546d595c8ULL, 0x39b58725425cb836ULL},
+    {0xfda853931a62cc26ULL, 0x23c69b9650c0e052ULL, 0xa227df15bfc633f3ULL, 0x2ac788481bae7d48ULL,
+     0x487878f9187d073dULL, 0x6c2be919967f807dULL, 0x765861d8336e6d8fULL, 0x88b8974cce528a43ULL},
+    {0xc37e2c2e421d3aa4ULL, 0xf926407ce84fa840ULL, 0x18abc03d1454e41cULL, 0x26605ecd3f7af644ULL,
+     0x242341a6d6a5eabfULL, 0x1edb84f4216b668eULL, 0xd836edb804010102ULL, 0x5b337ce7945e1d8cULL},
+    {0x666ba2dccc78cf66ULL, 0xb30181746fdbff77ULL, 0x8d4dd0db168d4668ULL, 0x259455d01dab3a2aULL,
+     0xf58564c5cde3acecULL, 0x7714192513adb276ULL, 0x527d725d8a303f65ULL, 0x55deb6c9e6f38f7bULL},
+    {0x864d05d73272d838ULL, 0xe22924f9fa6295c5ULL, 0x8189593f6c2fda32ULL, 0x330d7189b184b544ULL,
+     0x79efa62cbde1f714ULL, 0x35771c94e5cb1a63ULL, 0x2f4826b8641c8332ULL, 0x00a894fbc8cee854ULL},
+    {0xdcdacd0a1058a318ULL, 0x369cf3f578053a9aULL, 0xc6c3de5031c68de2ULL, 0x4653a5763c4b6d9fULL,
+     0x1688dd5aaa4e5c97ULL, 0x5be80aa1b7ab3c74ULL, 0x70cefe7cbc65c283ULL, 0x57f95f1306867091ULL},
+    {0xc240b6de34eaacdaULL, 0xd9e116e82ba0f1deULL, 0xcbe45ec779438e55ULL, 0x91787c9d96f752d7ULL,
+     0x897f532bf129ac2fULL, 0xd307b7c85a36e22cULL, 0x91940675749fb8f3ULL, 0xd14f95d0157fdb28ULL},
+    {0x1625360416df4285ULL, 0xb0c9babbd0c56ae2ULL, 0x73032b19cfc5cfc3ULL, 0xe497e5c309752056ULL,
+     0x12096bb4164bda96ULL, 0x1ee42419a0b74da1ULL, 0x8fc36243403826baULL, 0x0c8f0069dc09e660ULL},
+    {0xc44b74a15b0ec6f5ULL, 0x47989fe45289b2b8ULL, 0x745f848458d6fc73ULL, 0xec362a6ff61c70abULL,
+     0x070c98a7b3a8ad41ULL, 0x73a20fc07b63db51ULL, 0xed2c2173f44c35f4ULL, 0x8a56149d9acc9dcaULL},
+    {0xa395c36f35d33ae7ULL, 0x200ea12350bb5a94ULL, 0x20c789bd0bafe84bULL, 0x243ef52d0919276aULL,
+     0x3934c577e23ae233ULL, 0xb93807afa460d1ecULL, 0xb72a53b1f8fa76a4ULL, 0xd8914cb0c3ca4491ULL},
+    {0x4c076b86d23ddc82ULL, 0x03fd344c7e0143f0ULL, 0xa95362ff317af2c5ULL, 0x0add3db7e18b7a4fULL,
+     0x9c673e3f8260e01bULL, 0xfbeb49e554a1cc91ULL, 0x91351bf292f2e433ULL, 0xc755e7ec851141ebULL}
+  },
+  {
+    {0x2bf5db47f23206d5ULL, 0x2f6d34201d260152ULL, 0x17b876533f8ff89aULL, 0x5157c30c378fa458ULL,
+     0x7517c5c52d4fb936ULL, 0xef22f7ace6518cdcULL, 0xdeb483e6bf847a64ULL, 0xf508455892e0fa89ULL},
+    {0xab9659d8df7304d4ULL, 0xb71bcf1bff210e8eULL, 0xa9a2438bd73fbd60ULL, 0x4595cd1f5d11b4deULL,
+     0x9c0d329a4835859dULL, 0x4a0f0d2d7dbb6e56ULL, 0xc6038e5edf928a4eULL, 0xc94296218f5ad154ULL},
+    {0x08a33840a70c6ec4ULL, 0x9e8819f7e0311195ULL, 0xed209d96708ab202ULL, 0x10d7c4e7ce943a27ULL,
+     0x372fb317a29b49a1ULL, 0x57a67fb346627d1fULL, 0xf912561e7cdf39ecULL, 0xfa3ce6f26f7c8f17ULL},
+    {0x91213462f23f2d92ULL, 0x6cab71bd60b94078ULL, 0x6bdd0a63176cde20ULL, 0x54c9b20cee4d54bcULL,
+     0x3cd2d8aa9f2ac02fULL, 0x03f8e617206eedb0ULL, 0xc7f68e1693086434ULL, 0x831469c592dd3db9ULL},
+    {0xfe7d7465653f3c5fULL, 0x283dd45ef040feb1ULL, 0x91fe599bf3b7edfeULL, 0x5ff039ad80379311ULL,
+     0xbf76995b4e96fa49ULL, 0x2640b6b2a3e25094ULL, 0x8b096341c1c83f74ULL, 0xd2bec884fa560ac3ULL},
+    {0x8521df248f981354ULL, 0x587e23ec3588a259ULL, 0xcbedf281d7a0992cULL, 0x06930a5538961407ULL,
+     0x09320debbe5bbe21ULL, 0xa7ffa5b52491817fULL, 0xe6c8b4d909065160ULL, 0xac4f3992fff6d2a9ULL},
+    {0x2e4eb2a3cc53da66ULL, 0x04708a71f17a9b4eULL, 0xdbfdc7b20de05b2cULL, 0x4cdc9aee4907a201ULL,
+     0xe5cc8dfc6c475566ULL, 0x2b83cbfb47be1691ULL, 0x695833a74c05c3fdULL, 0xee938a7243b0deb0ULL},
+    {0x7aa7a1583ae9c1bdULL, 0xe0af6d98e37ce240ULL, 0xe54342d928ab38b4ULL, 0xe8b750070a1c98caULL,
+     0xefce86afe02358f2ULL, 0x31b8b856ea921228ULL, 0x052a19120a1c67fcULL, 0xb4069ea4e3aead59ULL},
+    {0x3b826205c6ffcfe6ULL, 0x2eb31256aa39418aULL, 0xc4b4a9e1c18521fbULL, 0x48614dd8db610615ULL,
+     0x04c362bbeea7475fULL, 0x916ab969a8ead162ULL, 0x6a7975bc0310a876ULL, 0xea4e7d11ecc77ec4ULL},
+    {0x3232d6e27fa03cb3ULL, 0xdb938e5b0fdd7d88ULL, 0x04c1d2cd2ccbfc5dULL, 0xd2f45c12af3a580fULL,
+     0x592620b57883e614ULL, 0x5fd27e68be7c5f26ULL, 0x139e45a91567e1e3ULL, 0x2cc71d2d44d8aaafULL},
+    {0x6ef493c706ba8e6fULL, 0x05c07bf8123deffdULL, 0xcebf9b4d9c2b5a4fULL, 0xf958147e2d038e9cULL,
+     0x5af5cee03e5561c4ULL, 0x8d0b5a7a794a6afcULL, 0x9de22df13772168bULL, 0xe5d249c5d84097fdULL},
+    {0x4a9090cde36d0757ULL, 0xf722d7b1d9a29382ULL, 0xfb7fb04c04b48ddfULL, 0x628ad2a7ebe16f43ULL,
+     0xcd3fbfb520226040ULL, 0x6c34ecb15104b6c4ULL, 0x30c0754ec903c188ULL, 0xec336b082d23cab0ULL},
+    {0x74c70b4295c69248ULL, 0x8813259dfed90303ULL, 0xa3e330684b8cc87aULL, 0xe689371c111a7a95ULL,
+     0x52bfbbf7fbbbc20bULL, 0x73a8543d65f9a6e2ULL, 0x67bb2fdd7e413e6dULL, 0xa066b3efc5cf2032ULL},
+    {0x473d62a21e206ee5ULL, 0xf1e274808c49a633ULL, 0x87ab956ce9f6b2c3ULL, 0x61830b4862b606eaULL,
+     0x67cd6846e78e815fULL, 0xfe40139f4c02082aULL, 0x52bbbfcb952ec365ULL, 0x74c116426b9836abULL},
+    {0xcf61b89c44f48971ULL, 0xe2d700f76d660683ULL, 0x72ef285cd1d431bdULL, 0x0593b24e9bdebf4aULL,
+     0x4084bc5b0561f8a1ULL, 0x84ce74d0aa16f256ULL, 0x9cbc79d309f6d277ULL, 0xa94fe2fe4139bdfeULL},
+    {0x9f51439e558df019ULL, 0x230da4baac712b27ULL, 0x518919e355185a24ULL, 0x4dcefcdd84b78f50ULL,
+     0xa7d90fb2a47d4c5aULL, 0x55ac9abfb30e009eULL, 0xfd2fc35974eed273ULL, 0xb72d824cdbea8fafULL}
+  },
+  {
+    {0x549db2b5ef7d9289ULL, 0x2480d4a8197f015aULL, 0x61d5590bc40493b6ULL, 0x3a55b52e6f780331ULL,
+     0x40eb8115309eadb0ULL, 0xdea7de5a92e5c625ULL, 0x64d631f0cc6a3d5aULL, 0x9d5e9d7c93e8dd61ULL},
+    {0x196860411e84e0e5ULL, 0xa5db84d3aea34c93ULL, 0xf9d5bb197073a732ULL, 0xb8d2fe566bcfd7c0ULL,
+     0x45775f36f3eb82faULL, 0x8cb20cccfdff8b58ULL, 0x1659b65f8374c110ULL, 0xb8b4a422330c789aULL},
+    {0xc925ff87aedbae9fULL, 0x7daf0eb936880a54ULL, 0x9284ddf59c4d0e71ULL, 0x1581cf93316f8cf5ULL,
+     0x3eeca8873ac1f452ULL, 0xb417fce9fb6aeffeULL, 0xa5918046eefb8dc3ULL, 0x73d318ac02209400ULL},
+    {0xc4f4cda3af2ebc2fULL, 0xa0af843dcb4efe24ULL, 0x53b857c19ccd10b1ULL, 0xddc9d1eb914d3e04ULL,
+     0x7bdec8bb62771debULL, 0x829277aa91c5aa81ULL, 0x7af18dd6832391aeULL, 0x1740f316c71a84caULL},
+    {0xdd4a12d8e12b31f8ULL, 0x577e29bc177736e6ULL, 0x2353722ba88935e8ULL, 0xca1d3729015f286dULL,
+     0x86c7b6a239a3e035ULL, 0x6e5250bfd3b03a9fULL, 0x79d98930fd0d536eULL, 0x8c4cbbabfa0c3832ULL},
+    {0x2d500910cab91f1eULL, 0xbedd9e444d1cd216ULL, 0xd634b74fedd02252ULL, 0xbd60f8e11258617aULL,
+     0xd8c7537b9e05614aULL, 0xfd26c766e7af5fc5ULL, 0x0660b581582bd926ULL, 0x87019244acf07fc8ULL},
+    {0xafa26ccfaf64ecb6ULL, 0xe6054f974bd72775ULL, 0xbbcbab5b140f695aULL, 0xbc71b4a4e348efdeULL,
+     0xfc2e52becc96d963ULL, 0x150abf5f5e5d9018ULL, 0xbd182fa604568771ULL, 0x35b4c06170339f83ULL},
+    {0x8928e99aeeaf8c49ULL, 0xee7aa73d6e24d728ULL, 0x4c5007c2e72b156cULL, 0x5fcf57c5ed408a1dULL,
+     0x9f719e39b6057604ULL, 0x7d343c01c2868bbfULL, 0x2cca254b7e103e2dULL, 0xe6eb38a9f131bea2ULL},
+    {0xc624a04e5f40ff52ULL, 0x3611d7cffcd2914aULL, 0xb7e8b42b1fd3bfd6ULL, 0x6cde40fdfa85063aULL,
+     0x7811c449178b7e5bULL, 0x4cb609312972cc13ULL, 0xf579125e33b46135ULL, 0xca102ef788a4e56eULL},
+    {0x0ba4e3520a981b0dULL, 0x1c354cb3bd1a41a4ULL, 0x1aabaa3adf9fab9cULL, 0x0701a7d153c418d5ULL,
+     0xdd1a7cefdcf2b921ULL, 0x6ceef0b3bcf48061ULL, 0x1083b598de25cce6ULL, 0x890a54c7e90a5e34ULL},
+    {0xc535956640ac1807ULL, 0xd4c1e56684da0b1eULL, 0xc4b33f97e0b82421ULL, 0xd0bd23177b41be00ULL,
+     0x53a4b42e147b72e1ULL, 0xf8d39f5ff777104cULL, 0x36e64e64d3fb530dULL, 0xa7a6ba6756074fddULL},
+    {0x405718db4f6d01b1ULL, 0xe73c6bc28f11e8a0ULL, 0xac11bb8ca0591a3bULL, 0x12d09a5a0acc4531ULL,
+     0xcbf174eee7de13f4ULL, 0x177e2be6044fd682ULL, 0x65f574cb1c48af70ULL, 0xce5966929961cb7cULL},
+    {0x989fe84ebc6fab9fULL, 0xe70ce6b1c80f6474ULL, 0xbe9ff3053b02a1bcULL, 0x12ef486699c0afd3ULL,
+     0x22d957f9e3411a26ULL, 0x0b41d8817b485b98ULL, 0x820e56d04ae20119ULL, 0x81e3d01f328528e0ULL},
+    {0xc59eed6c048752a1ULL, 0x41f2702ea01341b4ULL, 0x6e35903b9dc6b092ULL, 0x4291aba81f5b5b23ULL,
+     0x8173aa70a653d61dULL, 0xd1b648d44f2eb51eULL, 0x31b7ce065ab93f8fULL, 0xa55408ee99e2f4feULL},
+    {0x1fa4ed0985e34160ULL, 0xa26d7dc37a03cde2ULL, 0x1dac0848fa84df2dULL, 0x5e9a28d61b697108ULL,
+     0xa88004d914ea0ea1ULL, 0xa8d154283ffe5520ULL, 0x4f422dae639b139cULL, 0xeedccc0dd4b5a861ULL},
+    {0xb33e624f8be762b4ULL, 0x2a9ee4d1058e3413ULL, 0x968e636967d805faULL, 0x9848949b7db8bfd7ULL,
+     0x5308d7e5d23a8417ULL, 0x892f3b1df3e29da5ULL, 0xc95c139e3dee471fULL, 0x8631594dd757e089ULL}
+  },
+  {
+    {0x1083e2ea1f095615ULL, 0x0a28ad7714e68c33ULL, 0x6bfc02523d8818beULL, 0xb585113af35850cdULL,
+     0x7d935f0b30df8aa1ULL, 0xaddda07c4ab7e3acULL, 0x92c34299552f00cbULL, 0xc33ed1de2909df6cULL},
+    {0x2dc40d483e07113cULL, 0x6e4a5d397d8b63aeULL, 0x5582a94b79684c2bULL, 0x932b33d4622da26cULL,
+     0xf534f6510dbbf08dULL, 0x211d07c964c23a52ULL, 0x0eeece0fee5bdc9bULL, 0xdf178168f7015558ULL},
+    {0xabe7905a83cdd60eULL, 0x50602fb5a1170184ULL, 0x689886cdb023642aULL, 0xd568d090a6e1fb00ULL,
+     0x5b1922c70259217fULL, 0x93831cd9c43141e4ULL, 0xdfca35870c95f86eULL, 0xdec2057a568ae828ULL},
+    {0x568f8925913cc16dULL, 0x18bc5b6de1a26f5aULL, 0xdfa413bef5f499aeULL, 0xf8835decc3f0ae84ULL,
+     0xb6e60bd865a40ab0ULL, 0x65596439194b377eULL, 0xbcd8562592084a69ULL, 0x5ce433b94f23ede0ULL},
+    {0x860d523d42e06189ULL, 0xbf0779414e3aff13ULL, 0x0b616dcac1b20650ULL, 0xe66dd6d12131300dULL,
+     0xd4a0fd67ff99abdeULL, 0xc9903550c7aac50dULL, 0x022ecf8b7c46b2d7ULL, 0x3333b1e83abf92afULL},
+    {0xc0da65e784d6365dULL, 0xbcb7443f8f759fb8ULL, 0x35c712b17ae81930ULL, 0x80428dff4c6e08abULL,
+     0xf19dafefa4faf843ULL, 0xced8538dffa9855fULL, 0x20ac409cbe3ac7ceULL, 0x358c1fb6882da71eULL},
+    {0xefecdef7be42a582ULL, 0xd3fc608065046be6ULL, 0xc9af13c809e8dba9ULL, 0x1e6c9847641491ffULL,
+     0x3b574925d30c31f7ULL, 0xb7eb72baac2a2122ULL, 0x776a0dacef0859e7ULL, 0x06fec31421900942ULL},
+    {0x324794b07e50122bULL, 0xdd744f8b4af07ca5ULL, 0x30a12f08d63fc97bULL, 0x39650f1a76626d9dULL,
+     0x101b47f71fa38477ULL, 0x3d815f19d4dc124fULL, 0x1569ae95b26eb58aULL, 0xc3cde18895fb1887ULL},
+    {0x7ec62fbbf4737f21ULL, 0xd8dba5ab6209f5acULL, 0x24b5d7a9a5f9adbeULL, 0x707d28f7a61dc768ULL,
+     0x7711460bcaa999eaULL, 0xba7b174d1c92e4ccULL, 0x3c4bab6618d4bf2dULL, 0xb8f0c980eb8bd279ULL},
+    {0x9d658932790691bfULL, 0xed61058906b736aeULL, 0x712c2f04c0d63b6eULL, 0x5cf06fd5c63d488fULL,
+     0x97363facd9588e41ULL, 0x1f9bf7622b93257eULL, 0xa9d1ffc4667acaceULL, 0x1cf4a1aa0a061ecfULL},
+    {0x28d675b2c0519a23ULL, 0x9ebf94fe4f6952e3ULL, 0xf28bb767a2294a8aULL, 0x85512b4dfe0af3f5ULL,
+     0x18958ba899b16a0dULL, 0x95c2430cba7548a7ULL, 0xb30d1b10a16be615ULL, 0xe3ebbb9785bfb74cULL},
+    {0x07b53f5eb2e63645ULL, 0xbe57e54784c84232ULL, 0xd779c2167214d5cfULL, 0x617969cd029a3acaULL,
+     0xd17668cd8a7017a0ULL, 0x77b4d19abe9b7ee8ULL, 0x58fd0e939c161776ULL, 0xa8c4f4efd5968a72ULL},
+    {0x81eeb865d2fdca23ULL, 0x5a15ee08cc8ef895ULL, 0x768fa10a01905614ULL, 0xeff5b8ef880ee19bULL,
+     0xf0c0cabbcb1c8a0eULL, 0x2e1ee9cdb8c838f9ULL, 0x0587d8b88a4a14c0ULL, 0xf6f278962ff698e5ULL},
+    {0x519d34b3bf44da80ULL, 0x283834f95ab32e66ULL, 0x6e6087976278a000ULL, 0x1e62960e627312f6ULL,
+     0x9b87b27be6901c55ULL, 0x80e7853824fdbc1fULL, 0xbbbc09512facc27dULL, 0x06394239ac143b5aULL},
+    {0x9c4b646e9e2fce99ULL, 0x68a210811e80857fULL, 0x06d54e443643b52aULL, 0xde8d6d630d8eb843ULL,
+     0x7032156342146a0aULL, 0x8ba826f25eaa3622ULL, 0x227a58bd86138787ULL, 0x43b6c03c10281d37ULL},
+    {0x02b37a952f41deffULL, 0x0e44a59ae63b89b7ULL, 0x673257dc143ff951ULL, 0x19c02205d752baf4ULL,
+     0x46c23069c4b7d692ULL, 0x2e6392c3fd1502acULL, 0x6057b1a21b220846ULL, 0xe51ff9460c1b5b63ULL}
+  },
+  {
+    {0x6e85cb51566c5c43ULL, 0xcff9c9193597f046ULL, 0x9354e90c4994d94aULL, 0xe0a393322147927dULL,
+     0x8427fac10dc1eb2bULL, 0x88cfd8c22ff319faULL, 0xe2d4e68401965274ULL, 0xfa2e067d67aaa746ULL},
+    {0xb6d92a7f3e5f9f11ULL, 0x9afe153ad6cb3b8eULL, 0x4d1a6dd7ddf800bdULL, 0xf6c13cc0caf17e19ULL,
+     0x15f6c58e325fc3eeULL, 0x71095400a31dc3b2ULL, 0x168e7c07afa3d3e7ULL, 0x3f8417a194c7ae2dULL},
+    {0xec234772813b230dULL, 0x634d0f5f17344427ULL, 0x11548ab1d77fc56aULL, 0x7fab1750ce06af77ULL,
+     0xb62c10a74f7c4f83ULL, 0xa7d2edc4220a67d9ULL, 0x1c404170921209a0ULL, 0x0b9815a0face59f0ULL},
+    {0x2842589b319540c3ULL, 0x18490f59a283d6f8ULL, 0xa2731f84daae9fcbULL, 0x3db6d960c3683ba0ULL,
+     0xc85c63bb14611069ULL, 0xb19436af0788bf05ULL, 0x905459df347460d2ULL, 0x73f6e094e11a7db1ULL},
+    {0xdc7f938eb6357f37ULL, 0xc5d00f792bd8aa62ULL, 0xc878dcb92ca979fcULL, 0x37e83ed9eb023a99ULL,
+     0x6b23e2731560bf3dULL, 0x1086e4591d0fae61ULL, 0x782483169a9414bdULL, 0x1b956bc0f0ea9ea1ULL},
+    {0x7b85bb91c31b9c38ULL, 0x0c5aa90b48ef57b5ULL, 0xdedeb169af3bab6fULL, 0xe610ad732d373685ULL,
+     0xf13870df02ba8e15ULL, 0x0337edb68ca7f771ULL, 0xe4acf747b62c036cULL, 0xd921d576b6b94e81ULL},
+    {0xdbc864392c422f7aULL, 0xfb635362ed348898ULL, 0x83084668c45bfcd1ULL, 0xc357c9e32b315e11ULL,
+     0xb173b5405b2e5b8cULL, 0x7e946931e102b9a4ULL, 0x17c890eb7b0fb199ULL, 0xec225a83d61b662bULL},
+    {0xf306a3c8ee3c76cbULL, 0x3cf11623d32a1f6eULL, 0xe6d5ab646863e956ULL, 0x3b8a4cbe5c005c26ULL,
+     0xdcd529a59ce6bb27ULL, 0xc4afaa5204d4b16fULL, 0xb0624a267923798dULL, 0x85e56df66b307fabULL},
+    {0x0281893c2bf29698ULL, 0x91fc19a4d7ce7603ULL, 0x75a5dca3ad9a558fULL, 0x40ceb3fa4d50bf77ULL,
+     0x1baf6060bc9ba369ULL, 0x927e1037597888c2ULL, 0xd936bf1986a34c07ULL, 0xd4cf10c1c34ae980ULL},
+    {0x3a3e5334859dd614ULL, 0x9c475b5b18d0c8eeULL, 0x63080d1f07cd51d5ULL, 0xc9c0d0a6b88b4326ULL,
+     0x1ac98691c234296fULL, 0x2a0a83a494887fb6ULL, 0x565114270cea9cf2ULL, 0x5230a6e8a24802f5ULL},
+    {0xf7a2bf0f72e3d5c1ULL, 0x377174464f21439eULL, 0xfedcbf259ce30334ULL, 0xe0030a787ce202f9ULL,
+     0x6f2d9ebf1202e9caULL, 0xe79dde6c75e6e591ULL, 0xf52072aff1dac4f8ULL, 0x6c8d087ebb9b404dULL},
+    {0xad0fc73dbce913afULL, 0x909e587b458a07cbULL, 0x1300da84d4f00c8aULL, 0x425cd048b54466acULL,
+     0xb59cb9be90e9d8bfULL, 0x991616db3e431b0eULL, 0xd3aa117a531aecffULL, 0x91af92d359f4dc3bULL},
+    {0x9b1ec292e93fda29ULL, 0x76bb6c17e97d91bcULL, 0x7509d95faface1e6ULL, 0x3653fe47be855ae3ULL,
+     0x73180b280f680e75ULL, 0x75eefd1beeb6c26cULL, 0xa4cdf29fb66d4236ULL, 0x2d70a9976b5821d8ULL},
+    {0x7a3ee20720445c36ULL, 0x71d1ac8259877174ULL, 0x0fc539f7949f73e9ULL, 0xd05cf3d7982e3081ULL,
+     0x8758e20b7b1c7129ULL, 0xffadcc20569e61f2ULL, 0xb05d3a2f59544c2dULL, 0xbe16f5c19fff5e53ULL},
+    {0x73cf65b8aad58135ULL, 0x622c2119037aa5beULL, 0x79373b3f646fd6a0ULL, 0x0e029db50d3978cfULL,
+     0x8bdfc43794fba037ULL, 0xaefbd687620797a6ULL, 0x3fa5382bbd30d38eULL, 0x7627cfbf585d7464ULL},
+    {0xb2330fef4e4ca463ULL, 0xbcef72873566cc63ULL, 0xd161d2cacf780900ULL, 0x135dc5395b54827dULL,
+     0x638f052e27bf1bc6ULL, 0x10a224f007dfa06cULL, 0xe973586d6d3321daULL, 0x8b0c573826152c8fULL}
+  },
+  {
+    {0x9910ba6b23a5d896ULL, 0x1fe19e357fe4364eULL, 0x6e1da8c39a33c677ULL, 0x15b4488b29fd9fd0ULL,
+     0x1f4392541a1f22bfULL, 0x920a8a70ab8163e8ULL, 0x3fd1b24907e5658eULL, 0xf2c4f79cb6ec839bULL},
+    {0x8b5c619c76497ee8ULL, 0x5d2b0ac6c717370eULL, 0x98204cb64fcf68e1ULL, 0x0bdec21162bc6792ULL,
+     0x6973ccefa63b1011ULL, 0xf9e3fa97e0de1ac5ULL, 0x5efb693e3d0e0c8bULL, 0x037248e9d2d4fcb4ULL},
+    {0xd3694e2ab20364e4ULL, 0x62699718e770b20dULL, 0x6183291b6ed77d1cULL, 0x69aada7f6d6180a5ULL,
+     0x51f9054bf185509bULL, 0xfd7e845678701077ULL, 0xd6a2308a7fb96d8dULL, 0xd53e48d228dc87eeULL},
+    {0x80802dc91ec34f9eULL, 0xd8772d3533810603ULL, 0x3f06d66c530cb4f3ULL, 0x7be5ed0dc475c129ULL,
+     0xcb9e3c1931e82b10ULL, 0xc63d2857c9ff6b4cULL, 0xb92118c692a1b45eULL, 0x0aec44147285bbcaULL},
+    {0x37071afbe8316c45ULL, 0x982be4fd46700b8bULL, 0x8d5d177c64ff8578ULL, 0x5ec40582c9a82fa7ULL,
+     0x5518e37bcfa86678ULL, 0x24e809f49f031284ULL, 0x312f39604bbbb74cULL, 0xad4b4f6fc0c14de6ULL},
+    {0xa3d6f4868eb6e843ULL, 0x6415834bac4ab3abULL, 0x028a81514f3cf2dcULL, 0xf3b4962f5f3e6c3eULL,
+     0x9119ae90987dd2f2ULL, 0x437a6d8ae10bce55ULL, 0xc31cdd6b9b149ed6ULL, 0x1b77791d06871332ULL},
+    {0x9c34b650e16e05e9ULL, 0x965a774094e74640ULL, 0xa3fd22fbcea3f029ULL, 0x1eb6a9688f95277cULL,
+     0x2520a63d7bad84f6ULL, 0xad917201f58f2feeULL, 0xea92c1669b840d48ULL, 0x12109c4aacef5cbdULL},
+    {0xfc189ae71e29a3efULL, 0xcbe906f04c93302eULL, 0xd0107914ceaae10eULL, 0xb7a23f34b68e19f8ULL,
+     0xe9d875c2efd2119dULL, 0x03198c6efcadc9c8ULL, 0x65591bf64da17113ULL, 0x3cf0bbf83d443038ULL},
+    {0xab293027aad991c1ULL, 0x598d0bf8849be4b7ULL, 0x8c94a21ab972da90ULL, 0xada4cfdd7ecfa840ULL,
+     0x93d4b9c0fbcec63aULL, 0x7ca617a203219a34ULL, 0x900424eb6a652a55ULL, 0xaf9346e9eb8562e0ULL},
+    {0xc3e04d7902381461ULL, 0xb1643ab5911bc478ULL, 0xc92becfa390b3ef2ULL, 0x54476778acd2f1b6ULL,
+     0x8daa0c4d66bf3aafULL, 0x2bc1287b2c21c65aULL, 0xee182910b5a13ac3ULL, 0xbb04730090b0790aULL},
+    {0x83766947d17d4e0bULL, 0xc5772beefdc3a47bULL, 0x765a50db1a6fd0ffULL, 0x17f904ba45b0995eULL,
+     0xcee643832883487eULL, 0xf56db7f3c270aaedULL, 0x6738d94f46cb1fd9ULL, 0xc8fa426a142fd4d5ULL},
+    {0xae485bb72b724759ULL, 0x945353e1b2d4c63aULL, 0x82159d07de7d6f2cULL, 0x389caef34ec5b109ULL,
+     0x4a8ebb53db65ef14ULL, 0x2dc2cb7edd99de43ULL, 0x816fa3ed83f2405fULL, 0x73429bb9c14208a3ULL},
+    {0x08ed8febd56daf06ULL, 0x8d98277b4a837f69ULL, 0x9947c636a9b6e05aULL, 0x58c8a77ac0d58abdULL,
+     0xf45496a45f121e4fULL, 0x16cd67c71076d3d3ULL, 0xecbd1958e3fb0c5dULL, 0xfbe185ec38e1eb47ULL},
+    {0xb7ef9760ff79d2eeULL, 0xdd4d06aff39e7832ULL, 0xfd025001b905b499ULL, 0x98fe1c61f5b61d31ULL,
+     0xa9f83980c5f12805ULL, 0x376e3b783009cd9aULL, 0xa322b09f514eb16dULL, 0x08e213122c3832dfULL},
+    {0xaea68626dc4ad4f4ULL, 0x5dc516824ddbc0b6ULL, 0xa76697bd602e9065ULL, 0xbeeb3ea58c37888eULL,
+     0x1ec4a2f214569113ULL, 0xe48b820ca35f4484ULL, 0x9fb560949ae44df2ULL, 0x6ca1346292cc09fdULL},
+    {0xb618d590b01e6e27ULL, 0x047e2ccde180b2dcULL, 0xd1b299b504aea4a9ULL, 0x412c9e1e9fa403a4ULL,
+     0x88d28a3679407552ULL, 0x49c50136f332b8e3ULL, 0x3a1b6fcce668de19ULL, 0x178851bc75122b97ULL}
+  },
+  {
+    {0x197dd46d95a7b1a2ULL, 0x9c4e7ad63c6341fbULL, 0x426eca29484c2eceULL, 0x9211e489de7f4f8aULL,
+     0x14997f6ec78ef1f4ULL, 0x2b2c091006574586ULL, 0x17286a6e1c3eede8ULL, 0x25f92e470f60e018ULL},
+    {0xb4e370af3aeac968ULL, 0xe4f7fee9c4b63266ULL, 0xb4acd4c2e3ac5664ULL, 0xf8910bd2ceb38cbfULL,
+     0x1c3ae50cc9c0726eULL, 0x15309569d97b40bfULL, 0x70884b7ffd5a5a1bULL, 0x3890896aef8314cdULL},
+    {0x090d7d205ffe7b37ULL, 0x3b7f3efb1747d2daULL, 0xa2cb525fb54fc519ULL, 0x6e220932f66a971eULL,
+     0xddc160dfb486d440ULL, 0x7fcfec463fe13465ULL, 0x83da7e4e76e4c151ULL, 0xd6fa48a1d8d302b5ULL},
+    {0x5ced3c9f82e4c634ULL, 0x8efb83143a4464f8ULL, 0xe706381b7a1dca25ULL, 0x6cd15a3c5a2a412bULL,
+     0x9347a8fdbfcd8fb5ULL, 0x31db2eef6e54cd22ULL, 0xc4aeb11ef8d8932fULL, 0x11e7c1ed344411afULL},
+    {0xae4065ef12045cf9ULL, 0x6fcb2caf9ccce8bdULL, 0x1fa0ba4ef2cf6525ULL, 0xf683125dcb72c312ULL,
+     0xa01da4eae312410eULL, 0x67e286776cd8e830ULL, 0xabd9575298fb3f07ULL, 0x05f11e11eef649a5ULL},
+    {0x996884f5903fa271ULL, 0xe6da0fd2b9da921eULL, 0xa6f2f2695db01e54ULL, 0x1ee3e9bd6876214eULL,
+     0xa26e181ce27a9497ULL, 0x36d254e48e215e04ULL, 0x42f32a6c252cabcaULL, 0x9948148780b57614ULL},
+    {0xea961058fa28a7e0ULL, 0xc726cf250bf5ec74ULL, 0xe74d55c8db229666ULL, 0x0bd9abbfa57f5799ULL,
+     0x7479ef074dfc47b3ULL, 0xd9c65fc30c52f91dULL, 0x8e0283fe36a8bde2ULL, 0xa32a8b5e7d4b7280ULL},
+    {0xab41b43a43228d83ULL, 0x24ae1c304ad63f99ULL, 0x8e525f1a46a51229ULL, 0x14af860fcd26d2b4ULL,
+     0xd6baef613f714aa1ULL, 0xf51865adeb78795eULL, 0xd3e21fcee6a9d694ULL, 0x82ceb1dd8a37b527ULL},
+    {0x8605d27d48307682ULL, 0x745aaba3e10566daULL, 0xe57cae36bff2d7abULL, 0x91332ba14b127823ULL,
+     0xcb5c3638f3429f43ULL, 0x43a21c4fec462929ULL, 0xe9bc95352b18b7bdULL, 0x8c2addf3e78cb0c6ULL},
+    {0x4a665bfd2f9fd51aULL, 0x7f2f1fe2481b97f7ULL, 0xcad05d69ad36ce50ULL, 0x314fc2a4844f4dedULL,
+     0xd5593d8cb55fc5c6ULL, 0xe3510ce8bfb1e23dULL, 0xf9b7be6937453cceULL, 0xd3541b7969fae631ULL},
+    {0xb013cbcad7154cedULL, 0x949b28573f52651aULL, 0x03b41f6e9f5e642eULL, 0xc3a3462986ed94a4ULL,
+     0xf3c86cd6222b24dcULL, 0x7578fe8a028c9c26ULL, 0xaac7bfa12edad3b6ULL, 0x4112c5d78847940aULL},
+    {0x99296525eca445dfULL, 0xf1af24f22cdfa4c6ULL, 0xf5b4eb61eba6d3bcULL, 0x4560910c98972cc7ULL,
+     0x54751c32093eaa32ULL, 0x018313497d3c67bbULL, 0x3bd90ce62d871110ULL, 0x75fc863a538baa7eULL},
+    {0x8fe1f8b64ae3a278ULL, 0x160c5306137cdf65ULL, 0x22f029e733be0492ULL, 0x79a680427a75cd82ULL,
+     0x1d8c094a5b3f3adaULL, 0x5d723bbe165c3250ULL, 0x08b958ffa5792e22ULL, 0x829fa986b11c1eaaULL},
+    {0x711b8a4176a9f05dULL, 0x06ca4e4b9011d488ULL, 0x543bc62ba248a65eULL, 0x017535ffc9290894ULL,
+     0x840b84ce406851d7ULL, 0xafa3acdf90e960b4ULL, 0xac3394af7128fd34ULL, 0x54eb4d5b2ac0f92cULL},
+    {0x923ea73e4a14f836ULL, 0xc8cc8c57f0946328ULL, 0xce3f117fe917a4dfULL, 0x6372f933f72ce929ULL,
+     0x75000249c29ba567ULL, 0xcbd437e68c829ccaULL, 0x6c63aaabdd02ec7aULL, 0xe9b2f90c7b42bd17ULL},
+    {0xdb09e87355dbd4b3ULL, 0x1f8799286639bbb1ULL, 0xb83e47e51c651962ULL, 0xd4ef0fb6c43fb574ULL,
+     0x27d3b9d8f1bfb12aULL, 0x6ab877e86e5e8b72ULL, 0x8eebdc9d157b9014ULL, 0x4c2110053aa5cb64ULL}
+  }
+};
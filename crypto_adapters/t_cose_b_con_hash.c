@@ -0,0 +1,350 @@
+/*
+ *  t_cose_b_con_hash.c
+ *
+ * Copyright 2019-2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#include "t_cose_crypto.h"
+
+
+/*
+ * The hash half of the crypto adapter for the crypto providers that
+ * have no external crypto library, the test adapter
+ * (t_cose_test_crypto.c) and the built-in adapter
+ * (t_cose_builtin_crypto.c). It uses the Brad Conte SHA-256 bundled
+ * with t_cose and the SHA-384/512 that goes with it.
+ */
+
+
+/* The Brad Conte hash implementaiton bundled with t_cose and the
+ * SHA-384/512 that goes with it */
+#include "sha256.h"
+#include "sha512.h"
+
+/* Use of this file requires definition of T_COSE_USE_B_CON_SHA256 when
+ * making t_cose_crypto.h.
+ *
+ * This implements SHA-256, SHA-384 and SHA-512 so short-circuit
+ * signatures work for every ECDSA and RSASSA-PSS algorithm.
+ */
+
+#if !defined(T_COSE_DISABLE_ES384) || !defined(T_COSE_DISABLE_PS384)
+#define B_CON_SHA_384
+#endif
+#if !defined(T_COSE_DISABLE_ES512) || !defined(T_COSE_DISABLE_PS512)
+#define B_CON_SHA_512
+#endif
+
+#ifdef T_COSE_ENABLE_HASH_FAIL_TEST
+/* Global variable just for this particular test. Not thread
+ * safe or good for commercial use.
+ */
+int hash_test_mode = 0;
+#endif
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_start(struct t_cose_crypto_hash *hash_ctx,
+                         int32_t cose_hash_alg_id)
+{
+#ifdef T_COSE_ENABLE_HASH_FAIL_TEST
+    if(hash_test_mode == 1) {
+        return T_COSE_ERR_HASH_GENERAL_FAIL;
+    }
+#endif
+
+    switch(cose_hash_alg_id) {
+    case COSE_ALGORITHM_SHA_256:
+        sha256_init(&(hash_ctx->b_con_hash_context.sha256));
+        break;
+
+#ifdef B_CON_SHA_384
+    case COSE_ALGORITHM_SHA_384:
+        sha384_init(&(hash_ctx->b_con_hash_context.sha512));
+        break;
+#endif
+
+#ifdef B_CON_SHA_512
+    case COSE_ALGORITHM_SHA_512:
+        sha512_init(&(hash_ctx->b_con_hash_context.sha512));
+        break;
+#endif
+
+    default:
+        return T_COSE_ERR_UNSUPPORTED_HASH;
+    }
+
+    hash_ctx->cose_hash_alg_id = cose_hash_alg_id;
+    return 0;
+}
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void t_cose_crypto_hash_update(struct t_cose_crypto_hash *hash_ctx,
+                               struct q_useful_buf_c data_to_hash)
+{
+    if(data_to_hash.ptr == NULL) {
+        return;
+    }
+
+#if defined(B_CON_SHA_384) || defined(B_CON_SHA_512)
+    if(hash_ctx->cose_hash_alg_id != COSE_ALGORITHM_SHA_256) {
+        sha512_update(&(hash_ctx->b_con_hash_context.sha512),
+                      data_to_hash.ptr,
+                      data_to_hash.len);
+        return;
+    }
+#endif
+
+    sha256_update(&(hash_ctx->b_con_hash_context.sha256),
+                  data_to_hash.ptr,
+                  data_to_hash.len);
+}
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_finish(struct t_cose_crypto_hash *hash_ctx,
+                          struct q_useful_buf buffer_to_hold_result,
+                          struct q_useful_buf_c *hash_result)
+{
+    size_t hash_size;
+
+#ifdef T_COSE_ENABLE_HASH_FAIL_TEST
+    if(hash_test_mode == 2) {
+        return T_COSE_ERR_HASH_GENERAL_FAIL;
+    }
+#endif
+
+    switch(hash_ctx->cose_hash_alg_id) {
+#ifdef B_CON_SHA_384
+    case COSE_ALGORITHM_SHA_384:
+        hash_size = SHA384_BLOCK_SIZE;
+        break;
+#endif
+
+#ifdef B_CON_SHA_512
+    case COSE_ALGORITHM_SHA_512:
+        hash_size = SHA512_BLOCK_SIZE;
+        break;
+#endif
+
+    default:
+        hash_size = SHA256_BLOCK_SIZE;
+        break;
+    }
+
+    if(buffer_to_hold_result.len < hash_size) {
+        return T_COSE_ERR_HASH_BUFFER_SIZE;
+    }
+
+    switch(hash_ctx->cose_hash_alg_id) {
+#ifdef B_CON_SHA_384
+    case COSE_ALGORITHM_SHA_384:
+        sha384_final(&(hash_ctx->b_con_hash_context.sha512), buffer_to_hold_result.ptr);
+        break;
+#endif
+
+#ifdef B_CON_SHA_512
+    case COSE_ALGORITHM_SHA_512:
+        sha512_final(&(hash_ctx->b_con_hash_context.sha512), buffer_to_hold_result.ptr);
+        break;
+#endif
+
+    default:
+        sha256_final(&(hash_ctx->b_con_hash_context.sha256), buffer_to_hold_result.ptr);
+        break;
+    }
+    *hash_result = (UsefulBufC){buffer_to_hold_result.ptr, hash_size};
+
+    return 0;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * The context is a plain struct with no allocations so a copy of it
+ * is a clone.
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_clone(struct t_cose_crypto_hash       *dest,
+                         const struct t_cose_crypto_hash *src)
+{
+    *dest = *src;
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_hash_abort(struct t_cose_crypto_hash *hash_ctx)
+{
+    (void)hash_ctx;
+}
+
+
+/*
+ * t_cose_crypto_hash_batch() for the hashes that don't have
+ * multi-buffer hashing.
+ */
+static enum t_cose_err_t
+hash_batch_one_at_a_time(int32_t                               cose_hash_alg_id,
+                         struct t_cose_crypto_hash_batch_item *items,
+                         size_t                                num_items)
+{
+    enum t_cose_err_t         return_value;
+    struct t_cose_crypto_hash hash_ctx;
+    size_t                    i;
+    size_t                    piece;
+
+    return_value = T_COSE_SUCCESS;
+    for(i = 0; i < num_items; i++) {
+        return_value = t_cose_crypto_hash_start(&hash_ctx, cose_hash_alg_id);
+        if(return_value) {
+            break;
+        }
+        for(piece = 0; piece < items[i].num_pieces; piece++) {
+            t_cose_crypto_hash_update(&hash_ctx, items[i].pieces[piece]);
+        }
+        return_value = t_cose_crypto_hash_finish(&hash_ctx,
+                                                 items[i].buffer_for_hash,
+                                                 &items[i].hash);
+        if(return_value) {
+            break;
+        }
+    }
+
+    return return_value;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * For SHA-256 this uses the multi-buffer hashing in the bundled
+ * SHA-256 so up to SHA256_MAX_LANES messages go through the
+ * compression function at once.
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_batch(int32_t                               cose_hash_alg_id,
+                         struct t_cose_crypto_hash_batch_item *items,
+                         size_t                                num_items)
+{
+    /* Aproximate stack usage
+     *                                             64-bit      32-bit
+     *   hash contexts                               1792        1728
+     *   pointer and length arrays                    512         256
+     *   local vars                                    32          16
+     *   sha256_update_multi()                        512         384
+     *   TOTAL                                       2848        2384
+     */
+    SHA256_CTX   ctx[SHA256_MAX_LANES];
+    SHA256_CTX  *ctx_ptrs[SHA256_MAX_LANES];
+    const BYTE  *data[SHA256_MAX_LANES];
+    size_t       len[SHA256_MAX_LANES];
+    BYTE        *hashes[SHA256_MAX_LANES];
+    size_t       group;
+    size_t       i;
+    size_t       piece;
+    size_t       max_pieces;
+
+#ifdef T_COSE_ENABLE_HASH_FAIL_TEST
+    if(hash_test_mode == 1 || hash_test_mode == 2) {
+        return T_COSE_ERR_HASH_GENERAL_FAIL;
+    }
+#endif
+
+    if(cose_hash_alg_id != COSE_ALGORITHM_SHA_256) {
+        /* There's no multi-buffer SHA-384/512 */
+        return hash_batch_one_at_a_time(cose_hash_alg_id, items, num_items);
+    }
+
+    for(i = 0; i < num_items; i++) {
+        if(items[i].buffer_for_hash.len < SHA256_BLOCK_SIZE) {
+            return T_COSE_ERR_HASH_BUFFER_SIZE;
+        }
+    }
+
+    for(; num_items > 0; num_items -= group, items += group) {
+        group = num_items < SHA256_MAX_LANES ? num_items : SHA256_MAX_LANES;
+
+        max_pieces = 0;
+        for(i = 0; i < group; i++) {
+            sha256_init(&ctx[i]);
+            ctx_ptrs[i] = &ctx[i];
+            hashes[i] = items[i].buffer_for_hash.ptr;
+            if(items[i].num_pieces > max_pieces) {
+                max_pieces = items[i].num_pieces;
+            }
+        }
+
+        /* Piece n of every message goes in one update */
+        for(piece = 0; piece < max_pieces; piece++) {
+            for(i = 0; i < group; i++) {
+                if(piece < items[i].num_pieces && items[i].pieces[piece].ptr) {
+                    data[i] = items[i].pieces[piece].ptr;
+                    len[i]  = items[i].pieces[piece].len;
+                } else {
+                    data[i] = (const BYTE *)"";
+                    len[i]  = 0;
+                }
+            }
+            sha256_update_multi(ctx_ptrs, data, len, group);
+        }
+
+        sha256_final_multi(ctx_ptrs, hashes, group);
+        for(i = 0; i < group; i++) {
+            items[i].hash = (struct q_useful_buf_c){hashes[i], SHA256_BLOCK_SIZE};
+        }
+    }
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * This is shared by the test and built-in adapters. The hash kernels
+ * are picked by CPUID on first use, which is the only set up either
+ * of them has. The P-256 and verification engines have their tables
+ * compiled in.
+ */
+enum t_cose_err_t
+t_cose_crypto_warmup(void *crypto_context)
+{
+    (void)crypto_context;
+
+    sha256_get_impl();
+#if defined(B_CON_SHA_384) || defined(B_CON_SHA_512)
+    sha512_get_impl();
+#endif
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * The test and built-in adapters' keys are plain structures that
+ * threads only read.
+ */
+enum t_cose_err_t
+t_cose_crypto_set_thread_key_replicas(bool enable)
+{
+    (void)enable;
+    return T_COSE_SUCCESS;
+}
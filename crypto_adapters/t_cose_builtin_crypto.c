@@ -0,0 +1,384 @@
+/*
+ *  t_cose_builtin_crypto.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#include "t_cose_crypto.h"
+#include "p256.h"
+#ifdef T_COSE_USE_ECV_VERIFY
+#include "ecv.h"
+#endif
+
+
+/*
+ * This is a crypto adapter with no external crypto library that does
+ * real signing. ES256 is done by the P-256 engine in p256/ and the
+ * hashes by the bundled SHA-256/384/512 in t_cose_b_con_hash.c. It
+ * is for small devices and for services where signing latency
+ * matters: a key can have a pool of precomputed nonces so each
+ * signature is only a few modular multiplications. See p256.h.
+ *
+ * Use of this file requires definition of T_COSE_USE_B_CON_SHA256
+ * when making t_cose_crypto.h for the hash context.
+ *
+ * Keys are a \c struct \c p256_key with \c crypto_lib set to
+ * \ref T_COSE_CRYPTO_LIB_BUILTIN.
+ */
+
+
+#if !defined(T_COSE_DISABLE_ES384) || !defined(T_COSE_DISABLE_PS384)
+#define B_CON_SHA_384
+#endif
+#if !defined(T_COSE_DISABLE_ES512) || !defined(T_COSE_DISABLE_PS512)
+#define B_CON_SHA_512
+#endif
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * This will typically not be referenced and thus not linked,
+ * for deployed code. This is mainly used for test.
+ */
+bool
+t_cose_crypto_is_algorithm_supported(int32_t cose_algorithm_id)
+{
+    static const int32_t supported_algs[] = {
+        COSE_ALGORITHM_SHA_256,
+#ifdef B_CON_SHA_384
+        COSE_ALGORITHM_SHA_384,
+#endif
+#ifdef B_CON_SHA_512
+        COSE_ALGORITHM_SHA_512,
+#endif
+        T_COSE_ALGORITHM_ES256,
+        0 /* List terminator */
+    };
+
+    return t_cose_check_list(cose_algorithm_id, supported_algs);
+}
+
+
+/**
+ * \brief Get the P-256 key out of a t_cose key.
+ *
+ * \param[in] t_cose_key   The key.
+ * \param[out] p256_key    The P-256 key.
+ *
+ * \retval T_COSE_ERR_INCORRECT_KEY_FOR_LIB
+ *         Not a key for this adapter.
+ * \retval T_COSE_ERR_EMPTY_KEY
+ *         The key pointer is \c NULL.
+ */
+static enum t_cose_err_t
+key_convert(struct t_cose_key t_cose_key, const struct p256_key **p256_key)
+{
+    if(t_cose_key.crypto_lib != T_COSE_CRYPTO_LIB_BUILTIN) {
+        return T_COSE_ERR_INCORRECT_KEY_FOR_LIB;
+    }
+    if(t_cose_key.k.key_ptr == NULL) {
+        return T_COSE_ERR_EMPTY_KEY;
+    }
+    *p256_key = (const struct p256_key *)t_cose_key.k.key_ptr;
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t t_cose_crypto_sig_size(int32_t           cose_algorithm_id,
+                                         struct t_cose_key signing_key,
+                                         size_t           *sig_size)
+{
+    (void)signing_key;
+
+    if(cose_algorithm_id != T_COSE_ALGORITHM_ES256) {
+        return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+    }
+
+    *sig_size = T_COSE_EC_P256_SIG_SIZE;
+
+    return T_COSE_SUCCESS;
+}
+
+
+/**
+ * \brief ES256 sign with a random or an RFC 6979 nonce.
+ *
+ * \param[in] cose_algorithm_id  Must be \ref T_COSE_ALGORITHM_ES256.
+ * \param[in] signing_key        The key.
+ * \param[in] hash_to_sign       The hash.
+ * \param[in] signature_buffer   Where to put the signature.
+ * \param[out] signature         The signature.
+ * \param[in] deterministic      Use p256_sign_deterministic().
+ *
+ * \return As for t_cose_crypto_sign().
+ */
+static enum t_cose_err_t
+sign_es256(int32_t                cose_algorithm_id,
+           struct t_cose_key      signing_key,
+           struct q_useful_buf_c  hash_to_sign,
+           struct q_useful_buf    signature_buffer,
+           struct q_useful_buf_c *signature,
+           bool                   deterministic)
+{
+    enum t_cose_err_t      return_value;
+    const struct p256_key *key;
+    int                    p256_result;
+
+    if(cose_algorithm_id != T_COSE_ALGORITHM_ES256) {
+        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        goto Done;
+    }
+
+    return_value = key_convert(signing_key, &key);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    if(signature_buffer.len < T_COSE_EC_P256_SIG_SIZE) {
+        return_value = T_COSE_ERR_SIG_BUFFER_SIZE;
+        goto Done;
+    }
+
+    if(deterministic) {
+        p256_result = p256_sign_deterministic(key,
+                                              hash_to_sign.ptr,
+                                              hash_to_sign.len,
+                                              signature_buffer.ptr);
+    } else {
+        p256_result = p256_sign(key,
+                                hash_to_sign.ptr,
+                                hash_to_sign.len,
+                                signature_buffer.ptr);
+    }
+    if(p256_result == P256_ERR_NO_PRIVATE_KEY) {
+        return_value = T_COSE_ERR_WRONG_TYPE_OF_KEY;
+        goto Done;
+    } else if(p256_result != P256_SUCCESS) {
+        return_value = T_COSE_ERR_SIG_FAIL;
+        goto Done;
+    }
+
+    *signature = (struct q_useful_buf_c){signature_buffer.ptr, T_COSE_EC_P256_SIG_SIZE};
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_sign(int32_t                cose_algorithm_id,
+                   struct t_cose_key      signing_key,
+                   struct q_useful_buf_c  hash_to_sign,
+                   struct q_useful_buf    signature_buffer,
+                   struct q_useful_buf_c *signature)
+{
+    return sign_es256(cose_algorithm_id,
+                      signing_key,
+                      hash_to_sign,
+                      signature_buffer,
+                      signature,
+                      false);
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_sign_deterministic(int32_t                cose_algorithm_id,
+                                 struct t_cose_key      signing_key,
+                                 struct q_useful_buf_c  hash_to_sign,
+                                 struct q_useful_buf    signature_buffer,
+                                 struct q_useful_buf_c *signature)
+{
+    return sign_es256(cose_algorithm_id,
+                      signing_key,
+                      hash_to_sign,
+                      signature_buffer,
+                      signature,
+                      true);
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_verify(int32_t                cose_algorithm_id,
+                     struct t_cose_key      verification_key,
+                     struct q_useful_buf_c  kid,
+                     struct q_useful_buf_c  hash_to_verify,
+                     struct q_useful_buf_c  signature)
+{
+    enum t_cose_err_t      return_value;
+    const struct p256_key *key;
+#ifdef T_COSE_USE_ECV_VERIFY
+    struct ecv_cache      *cache;
+    const struct ecv_key  *ecv_key;
+    uint8_t                point[P256_PUBLIC_KEY_SIZE];
+#endif
+
+    /* This implementation doesn't use any key store with the ability
+     * to look up a key based on kid. The kid only says where to look
+     * in the ecv key cache when that is in use. */
+    (void)kid;
+
+    if(cose_algorithm_id != T_COSE_ALGORITHM_ES256) {
+        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        goto Done;
+    }
+
+    return_value = key_convert(verification_key, &key);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+#ifdef T_COSE_USE_ECV_VERIFY
+    /* With a cache for this thread the key's table of multiples is
+     * computed once and verification is several times faster than
+     * p256_verify(), which is made to be constant time. */
+    cache = ecv_thread_cache();
+    if(cache != NULL) {
+        p256_key_public(key, point);
+        if(ecv_cache_get(cache,
+                         ECV_P256,
+                         kid.ptr,
+                         kid.len,
+                         point,
+                         sizeof(point),
+                         &ecv_key) != ECV_SUCCESS) {
+            return_value = T_COSE_ERR_SIG_FAIL;
+            goto Done;
+        }
+        if(ecv_verify(ecv_key,
+                      hash_to_verify.ptr,
+                      hash_to_verify.len,
+                      signature.ptr,
+                      signature.len) != ECV_SUCCESS) {
+            return_value = T_COSE_ERR_SIG_VERIFY;
+        }
+        goto Done;
+    }
+#endif /* T_COSE_USE_ECV_VERIFY */
+
+    if(signature.len != T_COSE_EC_P256_SIG_SIZE ||
+       p256_verify(key,
+                   hash_to_verify.ptr,
+                   hash_to_verify.len,
+                   signature.ptr) != P256_SUCCESS) {
+        return_value = T_COSE_ERR_SIG_VERIFY;
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_trust_new(const struct q_useful_buf_c *anchors,
+                                size_t                       num_anchors,
+                                void                       **trust)
+{
+    (void)anchors;
+    (void)num_anchors;
+    *trust = NULL;
+    /* The built-in adapter has no X.509 parser */
+    return T_COSE_ERR_X5CHAIN_UNSUPPORTED;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_x5chain_trust_free(void *trust)
+{
+    (void)trust;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_validate(void                        *trust,
+                               const struct q_useful_buf_c *certs,
+                               size_t                       num_certs,
+                               int64_t                      time,
+                               struct t_cose_key           *leaf_key,
+                               int64_t                     *not_before,
+                               int64_t                     *not_after)
+{
+    (void)trust;
+    (void)certs;
+    (void)num_certs;
+    (void)time;
+    (void)leaf_key;
+    (void)not_before;
+    (void)not_after;
+    return T_COSE_ERR_X5CHAIN_UNSUPPORTED;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_x5chain_free_key(struct t_cose_key key)
+{
+    (void)key;
+}
+
+
+#ifndef T_COSE_DISABLE_EDDSA
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_sign_eddsa(struct t_cose_key      signing_key,
+                         struct q_useful_buf_c  tbs,
+                         struct q_useful_buf    signature_buffer,
+                         struct q_useful_buf_c *signature)
+{
+    (void)signing_key;
+    (void)tbs;
+    (void)signature_buffer;
+    (void)signature;
+    return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_verify_eddsa(struct t_cose_key     verification_key,
+                           struct q_useful_buf_c kid,
+                           struct q_useful_buf_c tbs,
+                           struct q_useful_buf_c signature)
+{
+    (void)verification_key;
+    (void)kid;
+    (void)tbs;
+    (void)signature;
+    return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+}
+
+#endif /* T_COSE_DISABLE_EDDSA */
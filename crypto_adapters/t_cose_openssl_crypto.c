@@ -17,6 +17,18 @@
 #include <openssl/rsa.h>
 #include <openssl/evp.h>
 #include <openssl/err.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+#include <limits.h>
+#include <string.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#endif
+#ifdef T_COSE_USE_ECV_VERIFY
+#include <openssl/ec.h>
+#include <openssl/objects.h>
+#include "ecv.h"
+#endif
 
 /**
  * \file t_cose_openssl_crypto.c
@@ -60,6 +72,87 @@
  * a llittle.
  */
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+/* OpenSSL 3 looks up an implementation in its providers each time a
+ * digest or signature operation is set up with an object from
+ * EVP_get_digestbynid() or EVP_sha256(). The lookup takes a global
+ * lock and the first one loads and initializes the provider, which
+ * can take milliseconds. Objects fetched once with EVP_MD_fetch() and
+ * EVP_SIGNATURE_fetch() skip all that. They are filled in by
+ * t_cose_crypto_warmup() and are NULL until then, in which case the
+ * implicit lookups are used as before. */
+#define T_COSE_OSSL_FETCH
+
+static struct {
+    OSSL_LIB_CTX  *lib_ctx;
+    EVP_MD        *sha256;
+    EVP_MD        *sha384;
+    EVP_MD        *sha512;
+    EVP_SIGNATURE *ecdsa;
+    EVP_SIGNATURE *rsa;
+    EVP_SIGNATURE *ed25519;
+} fetched;
+#endif /* OPENSSL_VERSION_NUMBER >= 0x30000000L */
+
+#ifdef OSSL_SIGNATURE_PARAM_NONCE_TYPE
+/* OpenSSL 3.2 added deterministic ECDSA (RFC 6979), selected by the
+ * nonce-type parameter of the signing context */
+#define T_COSE_OSSL_NONCE_TYPE
+#endif
+
+
+/**
+ * \brief Get the OpenSSL message digest for a NID.
+ *
+ * \param[in] nid  \c NID_sha256, \c NID_sha384 or \c NID_sha512.
+ *
+ * \return The digest or \c NULL.
+ *
+ * This is the pre-fetched one if t_cose_crypto_warmup() has been
+ * called.
+ */
+static const EVP_MD *
+message_digest_for_nid(int nid)
+{
+#ifdef T_COSE_OSSL_FETCH
+    const EVP_MD *md;
+
+    switch(nid) {
+    case NID_sha256: md = fetched.sha256; break;
+    case NID_sha384: md = fetched.sha384; break;
+    case NID_sha512: md = fetched.sha512; break;
+    default:         md = NULL; break;
+    }
+    if(md != NULL) {
+        return md;
+    }
+#endif /* T_COSE_OSSL_FETCH */
+
+    return EVP_get_digestbynid(nid);
+}
+
+
+/**
+ * \brief Make an EVP_PKEY_CTX for signing or verifying with a key.
+ *
+ * \param[in] key_evp  The key.
+ *
+ * \return The context or \c NULL if out of memory.
+ *
+ * With OpenSSL 3 this uses the library context given to
+ * t_cose_crypto_warmup(), or the default one.
+ */
+static EVP_PKEY_CTX *
+new_pkey_context(EVP_PKEY *key_evp)
+{
+#ifdef T_COSE_OSSL_FETCH
+    return EVP_PKEY_CTX_new_from_pkey(fetched.lib_ctx, key_evp, NULL);
+#else
+    return EVP_PKEY_CTX_new(key_evp, NULL);
+#endif
+}
+
+
 /*
  * See documentation in t_cose_crypto.h
  *
@@ -424,15 +517,15 @@ configure_pkey_context(EVP_PKEY_CTX* context, int32_t cose_algorithm_id)
          */
         switch (cose_algorithm_id) {
             case T_COSE_ALGORITHM_PS256:
-                md = EVP_sha256();
+                md = message_digest_for_nid(NID_sha256);
                 break;
 
             case T_COSE_ALGORITHM_PS384:
-                md = EVP_sha384();
+                md = message_digest_for_nid(NID_sha384);
                 break;
 
             case T_COSE_ALGORITHM_PS512:
-                md = EVP_sha512();
+                md = message_digest_for_nid(NID_sha512);
                 break;
 
             default:
@@ -484,15 +577,549 @@ Done:
 }
 
 
+/* ---- Per-thread key replicas ---- */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    !defined(__STDC_NO_THREADS__)
+#define T_COSE_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define T_COSE_THREAD_LOCAL __thread
+#endif
+
+#ifdef T_COSE_THREAD_LOCAL
+
+/* Keys a thread keeps replicas of. The least recently used is
+ * released when another is needed. */
+#ifndef T_COSE_KEY_REPLICAS
+#define T_COSE_KEY_REPLICAS 8
+#endif
+
+/* A thread's copy of a key and the contexts it has prepared with it */
+struct key_replica {
+    EVP_PKEY     *original;  /* Referenced, so its address isn't reused */
+    EVP_PKEY     *replica;
+    EVP_PKEY_CTX *sign_context;
+    int32_t       sign_alg;
+    EVP_PKEY_CTX *verify_context;
+    int32_t       verify_alg;
+    uint64_t      last_use;  /* 0 if empty */
+};
+
+static T_COSE_THREAD_LOCAL struct {
+    bool               enabled;
+    uint64_t           clock;
+    struct key_replica entries[T_COSE_KEY_REPLICAS];
+} thread_replicas;
+
+
+static void
+replica_release(struct key_replica *replica)
+{
+    /* The OpenSSL free functions do nothing with NULL */
+    EVP_PKEY_CTX_free(replica->sign_context);
+    EVP_PKEY_CTX_free(replica->verify_context);
+    EVP_PKEY_free(replica->replica);
+    EVP_PKEY_free(replica->original);
+    memset(replica, 0, sizeof(*replica));
+}
+
+
+/**
+ * \brief Get the calling thread's prepared context for a key.
+ *
+ * \param[in] key_evp            The key passed to t_cose.
+ * \param[in] cose_algorithm_id  The signing algorithm.
+ * \param[in] for_signing        \c true for a context initialized for
+ *                               signing, \c false for verification.
+ *
+ * \return The context or \c NULL if replicas are not enabled for
+ *         this thread or one couldn't be made.
+ *
+ * The context belongs to the replica and must not be freed. When
+ * this returns \c NULL the caller makes its own context as usual.
+ *
+ * Every EVP_PKEY_CTX made from a key takes a reference to it, which
+ * is an atomic operation on memory shared by every thread using the
+ * key, and with OpenSSL 3 the sign or verify init looks up the
+ * implementation again. With many threads signing with one key this
+ * becomes the bottleneck. Here each thread gets its own duplicate of
+ * the key, so nothing is shared (RSA blinding state included), and
+ * keeps the contexts so neither cost is paid per message.
+ */
+static EVP_PKEY_CTX *
+replica_context(EVP_PKEY *key_evp, int32_t cose_algorithm_id, bool for_signing)
+{
+    struct key_replica *replica;
+    struct key_replica *victim;
+    EVP_PKEY_CTX      **context;
+    int32_t            *context_alg;
+    int                 ossl_result;
+    int                 i;
+
+    if(!thread_replicas.enabled) {
+        return NULL;
+    }
+
+    thread_replicas.clock++;
+    replica = NULL;
+    victim  = &thread_replicas.entries[0];
+    for(i = 0; i < T_COSE_KEY_REPLICAS; i++) {
+        if(thread_replicas.entries[i].original == key_evp) {
+            replica = &thread_replicas.entries[i];
+            break;
+        }
+        if(thread_replicas.entries[i].last_use < victim->last_use) {
+            victim = &thread_replicas.entries[i];
+        }
+    }
+
+    if(replica == NULL) {
+        replica = victim;
+        replica_release(replica);
+        if(EVP_PKEY_up_ref(key_evp) != 1) {
+            return NULL;
+        }
+        replica->original = key_evp;
+#ifdef T_COSE_OSSL_FETCH
+        replica->replica = EVP_PKEY_dup(key_evp);
+        if(replica->replica == NULL) {
+            replica_release(replica);
+            return NULL;
+        }
+#else
+        /* OpenSSL 1.1.1 has no EVP_PKEY_dup(). Keeping the contexts
+         * still saves the reference counting for every message. */
+        if(EVP_PKEY_up_ref(key_evp) != 1) {
+            replica_release(replica);
+            return NULL;
+        }
+        replica->replica = key_evp;
+#endif
+    }
+    replica->last_use = thread_replicas.clock;
+
+    if(for_signing) {
+        context     = &replica->sign_context;
+        context_alg = &replica->sign_alg;
+    } else {
+        context     = &replica->verify_context;
+        context_alg = &replica->verify_alg;
+    }
+    if(*context != NULL && *context_alg == cose_algorithm_id) {
+        return *context;
+    }
+
+    EVP_PKEY_CTX_free(*context);
+    *context = new_pkey_context(replica->replica);
+    if(*context == NULL) {
+        return NULL;
+    }
+    if(for_signing) {
+        ossl_result = EVP_PKEY_sign_init(*context);
+    } else {
+        ossl_result = EVP_PKEY_verify_init(*context);
+    }
+    if(ossl_result != 1 ||
+       configure_pkey_context(*context, cose_algorithm_id) != T_COSE_SUCCESS) {
+        EVP_PKEY_CTX_free(*context);
+        *context = NULL;
+        return NULL;
+    }
+    *context_alg = cose_algorithm_id;
+
+    return *context;
+}
+
+
+/**
+ * \brief Drop a replica's context after an error.
+ *
+ * \param[in] context  A context from replica_context().
+ *
+ * An OpenSSL error may leave the context in a bad state, so the next
+ * use makes a new one.
+ */
+static void
+replica_context_failed(EVP_PKEY_CTX *context)
+{
+    int i;
+
+    for(i = 0; i < T_COSE_KEY_REPLICAS; i++) {
+        if(thread_replicas.entries[i].sign_context == context) {
+            EVP_PKEY_CTX_free(context);
+            thread_replicas.entries[i].sign_context = NULL;
+        } else if(thread_replicas.entries[i].verify_context == context) {
+            EVP_PKEY_CTX_free(context);
+            thread_replicas.entries[i].verify_context = NULL;
+        }
+    }
+}
+
+#else /* T_COSE_THREAD_LOCAL */
+
+/* No thread-local storage so no replicas */
+static EVP_PKEY_CTX *
+replica_context(EVP_PKEY *key_evp, int32_t cose_algorithm_id, bool for_signing)
+{
+    (void)key_evp;
+    (void)cose_algorithm_id;
+    (void)for_signing;
+    return NULL;
+}
+
+static void
+replica_context_failed(EVP_PKEY_CTX *context)
+{
+    (void)context;
+}
+
+#endif /* T_COSE_THREAD_LOCAL */
+
+
 /*
  * See documentation in t_cose_crypto.h
  */
 enum t_cose_err_t
-t_cose_crypto_sign(const int32_t                cose_algorithm_id,
-                   const struct t_cose_key      signing_key,
-                   const struct q_useful_buf_c  hash_to_sign,
-                   const struct q_useful_buf    signature_buffer,
-                   struct q_useful_buf_c       *signature)
+t_cose_crypto_set_thread_key_replicas(bool enable)
+{
+#ifdef T_COSE_THREAD_LOCAL
+    int i;
+
+    if(!enable) {
+        for(i = 0; i < T_COSE_KEY_REPLICAS; i++) {
+            replica_release(&thread_replicas.entries[i]);
+        }
+    }
+    thread_replicas.enabled = enable;
+
+    return T_COSE_SUCCESS;
+#else
+    return enable ? T_COSE_ERR_FAIL : T_COSE_SUCCESS;
+#endif
+}
+
+
+/**
+ * \brief Parse one DER certificate.
+ *
+ * \param[in] der  The certificate.
+ *
+ * \return The certificate or \c NULL if it doesn't parse or there is
+ *         more after it.
+ */
+static X509 *
+parse_certificate(struct q_useful_buf_c der)
+{
+    const unsigned char *cursor;
+    X509                *certificate;
+
+    if(der.len > LONG_MAX) {
+        return NULL;
+    }
+    cursor      = der.ptr;
+    certificate = d2i_X509(NULL, &cursor, (long)der.len);
+    if(certificate != NULL && cursor != (const unsigned char *)der.ptr + der.len) {
+        X509_free(certificate);
+        certificate = NULL;
+    }
+
+    return certificate;
+}
+
+
+/**
+ * \brief Convert an ASN.1 time to seconds since the epoch.
+ *
+ * \param[in] asn1_time       The time to convert.
+ * \param[in] reference       A time as an ASN.1 time.
+ * \param[in] reference_epoch \c reference in seconds since the epoch.
+ * \param[out] epoch          The converted time.
+ *
+ * \return false if \c asn1_time is not a valid time.
+ *
+ * This goes by the difference from a known time because OpenSSL 1.1.1
+ * has no direct conversion and timegm() is not portable.
+ */
+static bool
+asn1_time_to_epoch(const ASN1_TIME *asn1_time,
+                   const ASN1_TIME *reference,
+                   int64_t          reference_epoch,
+                   int64_t         *epoch)
+{
+    int days;
+    int seconds;
+
+    if(ASN1_TIME_diff(&days, &seconds, reference, asn1_time) != 1) {
+        return false;
+    }
+    *epoch = reference_epoch + (int64_t)days * 86400 + seconds;
+    return true;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_trust_new(const struct q_useful_buf_c *anchors,
+                                size_t                       num_anchors,
+                                void                       **trust)
+{
+    enum t_cose_err_t return_value;
+    X509_STORE       *store;
+    X509             *anchor;
+    int               ossl_result;
+    size_t            i;
+
+    store = X509_STORE_new();
+    if(store == NULL) {
+        return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
+        goto Done;
+    }
+    for(i = 0; i < num_anchors; i++) {
+        anchor = parse_certificate(anchors[i]);
+        if(anchor == NULL) {
+            return_value = T_COSE_ERR_X5CHAIN_INVALID;
+            goto Done;
+        }
+        /* The store takes its own reference */
+        ossl_result = X509_STORE_add_cert(store, anchor);
+        X509_free(anchor);
+        if(ossl_result != 1) {
+            return_value = T_COSE_ERR_X5CHAIN_INVALID;
+            goto Done;
+        }
+    }
+    return_value = T_COSE_SUCCESS;
+
+Done:
+    if(return_value != T_COSE_SUCCESS) {
+        X509_STORE_free(store);
+        store = NULL;
+    }
+    *trust = store;
+    return return_value;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_x5chain_trust_free(void *trust)
+{
+    X509_STORE_free((X509_STORE *)trust);
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_validate(void                        *trust,
+                               const struct q_useful_buf_c *certs,
+                               size_t                       num_certs,
+                               int64_t                      time,
+                               struct t_cose_key           *leaf_key,
+                               int64_t                     *not_before,
+                               int64_t                     *not_after)
+{
+    enum t_cose_err_t return_value;
+    X509             *leaf;
+    X509             *certificate;
+    STACK_OF(X509)   *untrusted;
+    STACK_OF(X509)   *chain;
+    X509_STORE_CTX   *store_context;
+    ASN1_TIME        *reference;
+    EVP_PKEY         *key_evp;
+    int64_t           start;
+    int64_t           end;
+    int64_t           cert_time;
+    size_t            i;
+    int               j;
+
+    untrusted     = NULL;
+    store_context = NULL;
+    reference     = NULL;
+
+    leaf = num_certs > 0 ? parse_certificate(certs[0]) : NULL;
+    if(leaf == NULL) {
+        return_value = T_COSE_ERR_X5CHAIN_INVALID;
+        goto Done;
+    }
+
+    /* The rest may lead to a trust anchor, but aren't trusted */
+    untrusted = sk_X509_new_null();
+    if(untrusted == NULL) {
+        return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
+        goto Done;
+    }
+    for(i = 1; i < num_certs; i++) {
+        certificate = parse_certificate(certs[i]);
+        if(certificate == NULL) {
+            return_value = T_COSE_ERR_X5CHAIN_INVALID;
+            goto Done;
+        }
+        if(!sk_X509_push(untrusted, certificate)) {
+            X509_free(certificate);
+            return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
+            goto Done;
+        }
+    }
+
+    store_context = X509_STORE_CTX_new();
+    if(store_context == NULL ||
+       X509_STORE_CTX_init(store_context, (X509_STORE *)trust, leaf, untrusted) != 1) {
+        return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
+        goto Done;
+    }
+    X509_VERIFY_PARAM_set_time(X509_STORE_CTX_get0_param(store_context), (time_t)time);
+    if(X509_verify_cert(store_context) != 1) {
+        return_value = T_COSE_ERR_X5CHAIN_INVALID;
+        goto Done;
+    }
+
+    /* All bits are set when there is no key usage extension */
+    if(!(X509_get_key_usage(leaf) & KU_DIGITAL_SIGNATURE)) {
+        return_value = T_COSE_ERR_X5CHAIN_INVALID;
+        goto Done;
+    }
+
+    /* When the chain as validated, anchor included, is valid */
+    reference = ASN1_TIME_set(NULL, (time_t)time);
+    if(reference == NULL) {
+        return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
+        goto Done;
+    }
+    start = INT64_MIN;
+    end   = INT64_MAX;
+    chain = X509_STORE_CTX_get0_chain(store_context);
+    for(j = 0; j < sk_X509_num(chain); j++) {
+        certificate = sk_X509_value(chain, j);
+        if(!asn1_time_to_epoch(X509_get0_notBefore(certificate), reference, time, &cert_time)) {
+            return_value = T_COSE_ERR_X5CHAIN_INVALID;
+            goto Done;
+        }
+        if(cert_time > start) {
+            start = cert_time;
+        }
+        if(!asn1_time_to_epoch(X509_get0_notAfter(certificate), reference, time, &cert_time)) {
+            return_value = T_COSE_ERR_X5CHAIN_INVALID;
+            goto Done;
+        }
+        if(cert_time < end) {
+            end = cert_time;
+        }
+    }
+
+    /* The key outlives the certificate */
+    key_evp = X509_get0_pubkey(leaf);
+    if(key_evp == NULL || EVP_PKEY_up_ref(key_evp) != 1) {
+        return_value = T_COSE_ERR_X5CHAIN_INVALID;
+        goto Done;
+    }
+    leaf_key->crypto_lib = T_COSE_CRYPTO_LIB_OPENSSL;
+    leaf_key->k.key_ptr  = key_evp;
+    *not_before          = start;
+    *not_after           = end;
+    return_value = T_COSE_SUCCESS;
+
+Done:
+    /* The OpenSSL free functions do nothing with NULL */
+    ASN1_TIME_free(reference);
+    X509_STORE_CTX_free(store_context);
+    sk_X509_pop_free(untrusted, X509_free);
+    X509_free(leaf);
+    return return_value;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_x5chain_free_key(struct t_cose_key key)
+{
+    EVP_PKEY_free((EVP_PKEY *)key.k.key_ptr);
+}
+
+
+#ifdef T_COSE_OSSL_NONCE_TYPE
+/**
+ * \brief Select random or RFC 6979 nonces for an ECDSA context.
+ *
+ * \param[in] context            An ECDSA signing context.
+ * \param[in] cose_algorithm_id  The ECDSA algorithm.
+ * \param[in] deterministic      \c true for RFC 6979.
+ *
+ * \retval T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED
+ *         The provider rejected the parameter.
+ *
+ * The HMAC of RFC 6979 uses the hash the message was hashed with,
+ * which OpenSSL takes from the context's signature digest, so that is
+ * set too.
+ */
+static enum t_cose_err_t
+set_nonce_type(EVP_PKEY_CTX *context, int32_t cose_algorithm_id, bool deterministic)
+{
+    OSSL_PARAM   params[2];
+    unsigned int nonce_type;
+    int          nid;
+
+    if(deterministic) {
+        switch(cose_algorithm_id) {
+        case T_COSE_ALGORITHM_ES256: nid = NID_sha256; break;
+        case T_COSE_ALGORITHM_ES384: nid = NID_sha384; break;
+        case T_COSE_ALGORITHM_ES512: nid = NID_sha512; break;
+        default: return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        }
+        if(EVP_PKEY_CTX_set_signature_md(context, message_digest_for_nid(nid)) != 1) {
+            return T_COSE_ERR_SIG_FAIL;
+        }
+    }
+
+    nonce_type = deterministic ? 1 : 0;
+    params[0] = OSSL_PARAM_construct_uint(OSSL_SIGNATURE_PARAM_NONCE_TYPE, &nonce_type);
+    params[1] = OSSL_PARAM_construct_end();
+    if(EVP_PKEY_CTX_set_params(context, params) != 1) {
+        return T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED;
+    }
+
+    if(deterministic) {
+        /* A provider that doesn't know the parameter ignores it, as
+         * an older library loaded at run time would. Read it back so
+         * that doesn't quietly sign with a random nonce. */
+        nonce_type = 0;
+        if(EVP_PKEY_CTX_get_params(context, params) != 1 || nonce_type != 1) {
+            return T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED;
+        }
+    }
+
+    return T_COSE_SUCCESS;
+}
+#endif /* T_COSE_OSSL_NONCE_TYPE */
+
+
+/**
+ * \brief Sign a hash with a random or deterministic ECDSA nonce.
+ *
+ * \param[in] cose_algorithm_id  As for t_cose_crypto_sign().
+ * \param[in] signing_key        As for t_cose_crypto_sign().
+ * \param[in] hash_to_sign       As for t_cose_crypto_sign().
+ * \param[in] signature_buffer   As for t_cose_crypto_sign().
+ * \param[out] signature         As for t_cose_crypto_sign().
+ * \param[in] deterministic      RFC 6979 nonces for ECDSA.
+ *
+ * \return As for t_cose_crypto_sign() and
+ *         t_cose_crypto_sign_deterministic().
+ */
+static enum t_cose_err_t
+sign_hash(const int32_t                cose_algorithm_id,
+          const struct t_cose_key      signing_key,
+          const struct q_useful_buf_c  hash_to_sign,
+          const struct q_useful_buf    signature_buffer,
+          struct q_useful_buf_c       *signature,
+          const bool                   deterministic)
 {
     /* This is the overhead for the DER encoding of an EC signature as
      * described by ECDSA-Sig-Value in RFC 3279.  It is at max 3 * (1
@@ -504,6 +1131,7 @@ t_cose_crypto_sign(const int32_t                cose_algorithm_id,
 
     enum t_cose_err_t      return_value;
     EVP_PKEY_CTX          *sign_context;
+    EVP_PKEY_CTX          *owned_context = NULL;
     EVP_PKEY              *signing_key_evp;
     int                    ossl_result;
 
@@ -529,6 +1157,14 @@ t_cose_crypto_sign(const int32_t                cose_algorithm_id,
         goto Done2;
     }
 
+#ifndef T_COSE_OSSL_NONCE_TYPE
+    if(deterministic) {
+        /* Before OpenSSL 3.2 the nonce is always random */
+        return_value = T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED;
+        goto Done2;
+    }
+#endif /* !T_COSE_OSSL_NONCE_TYPE */
+
     /* Pull the pointer to the OpenSSL-format EVP_PKEY out of the
      * t_cose key structure. */
     return_value = key_convert(signing_key, &signing_key_evp);
@@ -536,26 +1172,41 @@ t_cose_crypto_sign(const int32_t                cose_algorithm_id,
         goto Done2;
     }
 
-    /* Create and initialize the OpenSSL EVP_PKEY_CTX that is the
-     * signing context. */
-    sign_context = EVP_PKEY_CTX_new(signing_key_evp, NULL);
+    /* Use this thread's prepared context for the key if it keeps
+     * replicas. Otherwise create and initialize the OpenSSL
+     * EVP_PKEY_CTX that is the signing context. */
+    sign_context = replica_context(signing_key_evp, cose_algorithm_id, true);
     if(sign_context == NULL) {
-        return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
-        goto Done;
-    }
-    ossl_result = EVP_PKEY_sign_init(sign_context);
-    if(ossl_result != 1) {
-        return_value = T_COSE_ERR_SIG_FAIL;
-        goto Done;
-    }
+        owned_context = new_pkey_context(signing_key_evp);
+        sign_context  = owned_context;
+        if(sign_context == NULL) {
+            return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
+            goto Done;
+        }
+        ossl_result = EVP_PKEY_sign_init(sign_context);
+        if(ossl_result != 1) {
+            return_value = T_COSE_ERR_SIG_FAIL;
+            goto Done;
+        }
 
-    return_value = configure_pkey_context(sign_context, cose_algorithm_id);
-    if (return_value) {
-        goto Done;
+        return_value = configure_pkey_context(sign_context, cose_algorithm_id);
+        if (return_value) {
+            goto Done;
+        }
     }
 
     /* Actually do the signature operation.  */
     if (t_cose_algorithm_is_ecdsa(cose_algorithm_id)) {
+#ifdef T_COSE_OSSL_NONCE_TYPE
+        /* A replica's kept context may have been used with the other
+         * nonce type, so it is always set for those */
+        if(deterministic || sign_context != owned_context) {
+            return_value = set_nonce_type(sign_context, cose_algorithm_id, deterministic);
+            if(return_value) {
+                goto Done;
+            }
+        }
+#endif /* T_COSE_OSSL_NONCE_TYPE */
         ossl_result = EVP_PKEY_sign(sign_context,
                                     der_format_signature.ptr,
                                     &der_format_signature.len,
@@ -604,16 +1255,173 @@ t_cose_crypto_sign(const int32_t                cose_algorithm_id,
     }
 
 Done:
+    if(return_value != T_COSE_SUCCESS && sign_context != owned_context) {
+        replica_context_failed(sign_context);
+    }
     /* This checks for NULL before free, so it is not
      * necessary to check for NULL here.
      */
-    EVP_PKEY_CTX_free(sign_context);
+    EVP_PKEY_CTX_free(owned_context);
 
 Done2:
     return return_value;
 }
 
 
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_sign(const int32_t                cose_algorithm_id,
+                   const struct t_cose_key      signing_key,
+                   const struct q_useful_buf_c  hash_to_sign,
+                   const struct q_useful_buf    signature_buffer,
+                   struct q_useful_buf_c       *signature)
+{
+    return sign_hash(cose_algorithm_id,
+                     signing_key,
+                     hash_to_sign,
+                     signature_buffer,
+                     signature,
+                     false);
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_sign_deterministic(const int32_t                cose_algorithm_id,
+                                 const struct t_cose_key      signing_key,
+                                 const struct q_useful_buf_c  hash_to_sign,
+                                 const struct q_useful_buf    signature_buffer,
+                                 struct q_useful_buf_c       *signature)
+{
+    return sign_hash(cose_algorithm_id,
+                     signing_key,
+                     hash_to_sign,
+                     signature_buffer,
+                     signature,
+                     true);
+}
+
+
+
+#ifdef T_COSE_USE_ECV_VERIFY
+/**
+ * \brief Verify an ECDSA signature with the thread's ecv key cache.
+ *
+ * \param[in] key_evp          The verification key.
+ * \param[in] kid              The kid, used to find the key in the cache.
+ * \param[in] hash_to_verify   The hash that was signed.
+ * \param[in] cose_signature   The COSE-format signature, r || s.
+ *
+ * \retval T_COSE_ERR_UNSUPPORTED_SIGNING_ALG
+ *         The key can't be handled here because there is no cache
+ *         for this thread or it is not a P-256 or P-384 key. The
+ *         caller should verify with OpenSSL.
+ * \retval T_COSE_ERR_SIG_VERIFY
+ *         The signature is malformed or doesn't verify.
+ *
+ * This skips the conversion to DER and the set up of an OpenSSL
+ * context, and on a cache hit the key's table of multiples is
+ * already computed. See ecv.h.
+ */
+static enum t_cose_err_t
+ecv_verify_cached(EVP_PKEY              *key_evp,
+                  struct q_useful_buf_c  kid,
+                  struct q_useful_buf_c  hash_to_verify,
+                  struct q_useful_buf_c  cose_signature)
+{
+    enum t_cose_err_t     return_value;
+    struct ecv_cache     *cache;
+    const struct ecv_key *ecv_key;
+    int                   curve_nid;
+    int                   curve;
+    int                   ecv_result;
+    uint8_t               point[ECV_MAX_PUBLIC_KEY_SIZE];
+    size_t                point_len;
+
+    return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+
+    cache = ecv_thread_cache();
+    if(cache == NULL || EVP_PKEY_base_id(key_evp) != EVP_PKEY_EC) {
+        goto Done;
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    {
+        char curve_name[32];
+
+        if(EVP_PKEY_get_group_name(key_evp,
+                                   curve_name,
+                                   sizeof(curve_name),
+                                   NULL) != 1) {
+            goto Done;
+        }
+        curve_nid = OBJ_sn2nid(curve_name);
+    }
+    if(EVP_PKEY_get_octet_string_param(key_evp,
+                                       OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY,
+                                       point,
+                                       sizeof(point),
+                                       &point_len) != 1) {
+        goto Done;
+    }
+#else
+    {
+        const EC_KEY *ec_key = EVP_PKEY_get0_EC_KEY(key_evp);
+
+        if(ec_key == NULL) {
+            goto Done;
+        }
+        curve_nid = EC_GROUP_get_curve_name(EC_KEY_get0_group(ec_key));
+        point_len = EC_POINT_point2oct(EC_KEY_get0_group(ec_key),
+                                       EC_KEY_get0_public_key(ec_key),
+                                       POINT_CONVERSION_UNCOMPRESSED,
+                                       point,
+                                       sizeof(point),
+                                       NULL);
+        if(point_len == 0) {
+            goto Done;
+        }
+    }
+#endif
+
+    if(curve_nid == NID_X9_62_prime256v1) {
+        curve = ECV_P256;
+    } else if(curve_nid == NID_secp384r1) {
+        curve = ECV_P384;
+    } else {
+        goto Done;
+    }
+
+    /* A compressed point comes back as ECV_ERR_INVALID_KEY, which
+     * leaves it to OpenSSL. */
+    if(ecv_cache_get(cache,
+                     curve,
+                     kid.ptr,
+                     kid.len,
+                     point,
+                     point_len,
+                     &ecv_key) != ECV_SUCCESS) {
+        goto Done;
+    }
+
+    ecv_result = ecv_verify(ecv_key,
+                            hash_to_verify.ptr,
+                            hash_to_verify.len,
+                            cose_signature.ptr,
+                            cose_signature.len);
+
+    return_value = ecv_result == ECV_SUCCESS ? T_COSE_SUCCESS
+                                             : T_COSE_ERR_SIG_VERIFY;
+
+Done:
+    return return_value;
+}
+#endif /* T_COSE_USE_ECV_VERIFY */
+
 
 /*
  * See documentation in t_cose_crypto.h
@@ -628,6 +1436,7 @@ t_cose_crypto_verify(const int32_t                cose_algorithm_id,
     int                    ossl_result;
     enum t_cose_err_t      return_value;
     EVP_PKEY_CTX          *verify_context = NULL;
+    EVP_PKEY_CTX          *owned_context = NULL;
     EVP_PKEY              *verification_key_evp;
 
     /* This buffer is used to convert COSE ECDSA signature to DER format,
@@ -643,7 +1452,8 @@ t_cose_crypto_verify(const int32_t                cose_algorithm_id,
     struct q_useful_buf_c  openssl_signature;
 
     /* This implementation doesn't use any key store with the ability
-     * to look up a key based on kid. */
+     * to look up a key based on kid. The kid only says where to look
+     * in the ecv key cache when that is in use. */
     (void)kid;
 
     if(!t_cose_algorithm_is_ecdsa(cose_algorithm_id) &&
@@ -659,6 +1469,18 @@ t_cose_crypto_verify(const int32_t                cose_algorithm_id,
         goto Done;
     }
 
+#ifdef T_COSE_USE_ECV_VERIFY
+    if(t_cose_algorithm_is_ecdsa(cose_algorithm_id)) {
+        return_value = ecv_verify_cached(verification_key_evp,
+                                         kid,
+                                         hash_to_verify,
+                                         cose_signature);
+        if(return_value != T_COSE_ERR_UNSUPPORTED_SIGNING_ALG) {
+            goto Done;
+        }
+    }
+#endif /* T_COSE_USE_ECV_VERIFY */
+
     if (t_cose_algorithm_is_ecdsa(cose_algorithm_id)) {
         /* Unfortunately the officially supported OpenSSL API supports
          * only DER-encoded signatures so the COSE format ECDSA signatures must
@@ -682,24 +1504,29 @@ t_cose_crypto_verify(const int32_t                cose_algorithm_id,
         goto Done;
     }
 
-    /* Create the verification context and set it up with the
-     * necessary verification key.
+    /* Use this thread's prepared context for the key if it keeps
+     * replicas. Otherwise create the verification context and set it
+     * up with the necessary verification key.
      */
-    verify_context = EVP_PKEY_CTX_new(verification_key_evp, NULL);
+    verify_context = replica_context(verification_key_evp, cose_algorithm_id, false);
     if(verify_context == NULL) {
-        return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
-        goto Done;
-    }
+        owned_context  = new_pkey_context(verification_key_evp);
+        verify_context = owned_context;
+        if(verify_context == NULL) {
+            return_value = T_COSE_ERR_INSUFFICIENT_MEMORY;
+            goto Done;
+        }
 
-    ossl_result = EVP_PKEY_verify_init(verify_context);
-    if(ossl_result != 1) {
-        return_value = T_COSE_ERR_SIG_FAIL;
-        goto Done;
-    }
+        ossl_result = EVP_PKEY_verify_init(verify_context);
+        if(ossl_result != 1) {
+            return_value = T_COSE_ERR_SIG_FAIL;
+            goto Done;
+        }
 
-    return_value = configure_pkey_context(verify_context, cose_algorithm_id);
-    if (return_value) {
-        goto Done;
+        return_value = configure_pkey_context(verify_context, cose_algorithm_id);
+        if (return_value) {
+            goto Done;
+        }
     }
 
     /* Actually do the signature verification */
@@ -724,7 +1551,10 @@ t_cose_crypto_verify(const int32_t                cose_algorithm_id,
     return_value = T_COSE_SUCCESS;
 
 Done:
-    EVP_PKEY_CTX_free(verify_context);
+    if(return_value == T_COSE_ERR_SIG_FAIL && verify_context != owned_context) {
+        replica_context_failed(verify_context);
+    }
+    EVP_PKEY_CTX_free(owned_context);
 
     return return_value;
 }
@@ -765,7 +1595,7 @@ t_cose_crypto_hash_start(struct t_cose_crypto_hash *hash_ctx,
         return T_COSE_ERR_UNSUPPORTED_HASH;
     }
 
-    message_digest = EVP_get_digestbynid(nid);
+    message_digest = message_digest_for_nid(nid);
     if(message_digest == NULL){
         return T_COSE_ERR_UNSUPPORTED_HASH;
     }
@@ -834,6 +1664,80 @@ t_cose_crypto_hash_finish(struct t_cose_crypto_hash *hash_ctx,
     return ossl_result ? T_COSE_SUCCESS : T_COSE_ERR_HASH_GENERAL_FAIL;
 }
 
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_clone(struct t_cose_crypto_hash       *dest,
+                         const struct t_cose_crypto_hash *src)
+{
+    int ossl_result;
+
+    dest->evp_ctx = EVP_MD_CTX_new();
+    if(dest->evp_ctx == NULL) {
+        return T_COSE_ERR_INSUFFICIENT_MEMORY;
+    }
+
+    ossl_result = EVP_MD_CTX_copy_ex(dest->evp_ctx, src->evp_ctx);
+    if(ossl_result == 0) {
+        EVP_MD_CTX_free(dest->evp_ctx);
+        return T_COSE_ERR_HASH_GENERAL_FAIL;
+    }
+
+    dest->cose_hash_alg_id = src->cose_hash_alg_id;
+    dest->update_error     = src->update_error;
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_hash_abort(struct t_cose_crypto_hash *hash_ctx)
+{
+    EVP_MD_CTX_free(hash_ctx->evp_ctx);
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * OpenSSL has no multi-buffer hashing so this just does one message
+ * after the other.
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_batch(int32_t                               cose_hash_alg_id,
+                         struct t_cose_crypto_hash_batch_item *items,
+                         size_t                                num_items)
+{
+    enum t_cose_err_t         return_value;
+    struct t_cose_crypto_hash hash_ctx;
+    size_t                    i;
+    size_t                    piece;
+
+    return_value = T_COSE_SUCCESS;
+    for(i = 0; i < num_items; i++) {
+        return_value = t_cose_crypto_hash_start(&hash_ctx, cose_hash_alg_id);
+        if(return_value) {
+            break;
+        }
+        for(piece = 0; piece < items[i].num_pieces; piece++) {
+            t_cose_crypto_hash_update(&hash_ctx, items[i].pieces[piece]);
+        }
+        return_value = t_cose_crypto_hash_finish(&hash_ctx,
+                                                 items[i].buffer_for_hash,
+                                                 &items[i].hash);
+        if(return_value) {
+            break;
+        }
+    }
+
+    return return_value;
+}
+
 #ifndef T_COSE_DISABLE_EDDSA
 
 /*
@@ -861,11 +1765,21 @@ t_cose_crypto_sign_eddsa(struct t_cose_key      signing_key,
         goto Done;
     }
 
+#ifdef T_COSE_OSSL_FETCH
+    ossl_result = EVP_DigestSignInit_ex(sign_context,
+                                        NULL,
+                                        NULL,
+                                        fetched.lib_ctx,
+                                        NULL,
+                                        signing_key_evp,
+                                        NULL);
+#else
     ossl_result = EVP_DigestSignInit(sign_context,
                                      NULL,
                                      NULL,
                                      NULL,
                                      signing_key_evp);
+#endif
     if(ossl_result != 1) {
         return_value = T_COSE_ERR_SIG_FAIL;
         goto Done;
@@ -925,11 +1839,21 @@ t_cose_crypto_verify_eddsa(struct t_cose_key     verification_key,
         goto Done;
     }
 
+#ifdef T_COSE_OSSL_FETCH
+    ossl_result = EVP_DigestVerifyInit_ex(verify_context,
+                                          NULL,
+                                          NULL,
+                                          fetched.lib_ctx,
+                                          NULL,
+                                          verification_key_evp,
+                                          NULL);
+#else
     ossl_result = EVP_DigestVerifyInit(verify_context,
                                        NULL,
                                        NULL,
                                        NULL,
                                        verification_key_evp);
+#endif
     if(ossl_result != 1) {
         return_value = T_COSE_ERR_SIG_FAIL;
         goto Done;
@@ -964,3 +1888,140 @@ Done:
 }
 
 #endif /* T_COSE_DISABLE_EDDSA */
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_warmup(void *crypto_context)
+{
+    static const int32_t       hash_algs[] = {
+        COSE_ALGORITHM_SHA_256,
+#if !defined(T_COSE_DISABLE_ES384) || !defined(T_COSE_DISABLE_PS384)
+        COSE_ALGORITHM_SHA_384,
+#endif
+#if !defined(T_COSE_DISABLE_ES512) || !defined(T_COSE_DISABLE_PS512)
+        COSE_ALGORITHM_SHA_512,
+#endif
+    };
+    enum t_cose_err_t          return_value;
+    struct t_cose_crypto_hash  hash_ctx;
+    MakeUsefulBufOnStack(      hash_buf, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    struct q_useful_buf_c      hash;
+    MakeUsefulBufOnStack(      sig_buf, T_COSE_MAX_ECDSA_SIG_SIZE);
+    struct q_useful_buf_c      sig;
+    struct t_cose_key          key;
+    EVP_PKEY                  *key_evp = NULL;
+    size_t                     i;
+
+#ifdef T_COSE_OSSL_FETCH
+    /* Release what an earlier call fetched. The EVP_*_free()
+     * functions do nothing with NULL. */
+    EVP_MD_free(fetched.sha256);
+    EVP_MD_free(fetched.sha384);
+    EVP_MD_free(fetched.sha512);
+    EVP_SIGNATURE_free(fetched.ecdsa);
+    EVP_SIGNATURE_free(fetched.rsa);
+    EVP_SIGNATURE_free(fetched.ed25519);
+    memset(&fetched, 0, sizeof(fetched));
+
+    fetched.lib_ctx = (OSSL_LIB_CTX *)crypto_context;
+
+    fetched.sha256 = EVP_MD_fetch(fetched.lib_ctx, "SHA2-256", NULL);
+    if(fetched.sha256 == NULL) {
+        return_value = T_COSE_ERR_UNSUPPORTED_HASH;
+        goto Done;
+    }
+#if !defined(T_COSE_DISABLE_ES384) || !defined(T_COSE_DISABLE_PS384)
+    fetched.sha384 = EVP_MD_fetch(fetched.lib_ctx, "SHA2-384", NULL);
+    if(fetched.sha384 == NULL) {
+        return_value = T_COSE_ERR_UNSUPPORTED_HASH;
+        goto Done;
+    }
+#endif
+#if !defined(T_COSE_DISABLE_ES512) || !defined(T_COSE_DISABLE_PS512)
+    fetched.sha512 = EVP_MD_fetch(fetched.lib_ctx, "SHA2-512", NULL);
+    if(fetched.sha512 == NULL) {
+        return_value = T_COSE_ERR_UNSUPPORTED_HASH;
+        goto Done;
+    }
+#endif
+
+    /* Signature implementations are looked up by EVP_PKEY_sign_init()
+     * and the like. Holding a reference keeps them constructed in the
+     * library context's store where those lookups find them. */
+    fetched.ecdsa = EVP_SIGNATURE_fetch(fetched.lib_ctx, "ECDSA", NULL);
+    if(fetched.ecdsa == NULL) {
+        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        goto Done;
+    }
+#if !defined(T_COSE_DISABLE_PS256) || !defined(T_COSE_DISABLE_PS384) || \
+    !defined(T_COSE_DISABLE_PS512)
+    fetched.rsa = EVP_SIGNATURE_fetch(fetched.lib_ctx, "RSA", NULL);
+    if(fetched.rsa == NULL) {
+        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        goto Done;
+    }
+#endif
+#ifndef T_COSE_DISABLE_EDDSA
+    fetched.ed25519 = EVP_SIGNATURE_fetch(fetched.lib_ctx, "ED25519", NULL);
+    if(fetched.ed25519 == NULL) {
+        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        goto Done;
+    }
+#endif
+
+    key_evp = EVP_PKEY_Q_keygen(fetched.lib_ctx, NULL, "EC", "P-256");
+#else
+    (void)crypto_context;
+
+    {
+        EVP_PKEY_CTX *keygen_context;
+
+        keygen_context = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, NULL);
+        if(keygen_context != NULL &&
+           EVP_PKEY_keygen_init(keygen_context) == 1 &&
+           EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keygen_context,
+                                                  NID_X9_62_prime256v1) == 1) {
+            EVP_PKEY_keygen(keygen_context, &key_evp);
+        }
+        EVP_PKEY_CTX_free(keygen_context);
+    }
+#endif /* T_COSE_OSSL_FETCH */
+
+    /* Run each hash and an ES256 signature and verification once so
+     * whatever is set up on first use is done now. SHA-256 goes last
+     * so its result is what's signed. */
+    for(i = sizeof(hash_algs) / sizeof(hash_algs[0]); i-- > 0; ) {
+        return_value = t_cose_crypto_hash_start(&hash_ctx, hash_algs[i]);
+        if(return_value) {
+            goto Done;
+        }
+        t_cose_crypto_hash_update(&hash_ctx, Q_USEFUL_BUF_FROM_SZ_LITERAL("warmup"));
+        return_value = t_cose_crypto_hash_finish(&hash_ctx, hash_buf, &hash);
+        if(return_value) {
+            goto Done;
+        }
+    }
+
+    if(key_evp == NULL) {
+        return_value = T_COSE_ERR_SIG_FAIL;
+        goto Done;
+    }
+    key.crypto_lib = T_COSE_CRYPTO_LIB_OPENSSL;
+    key.k.key_ptr  = key_evp;
+    return_value = t_cose_crypto_sign(T_COSE_ALGORITHM_ES256, key, hash, sig_buf, &sig);
+    if(return_value) {
+        goto Done;
+    }
+    return_value = t_cose_crypto_verify(T_COSE_ALGORITHM_ES256,
+                                        key,
+                                        NULL_Q_USEFUL_BUF_C,
+                                        hash,
+                                        sig);
+
+Done:
+    EVP_PKEY_free(key_evp);
+    return return_value;
+}
@@ -174,28 +174,29 @@ t_cose_crypto_verify(int32_t               cose_algorithm_id,
 }
 
 
-/*
- * See documentation in t_cose_crypto.h
+/**
+ * \brief Sign a hash with a PSA algorithm.
+ *
+ * \param[in] psa_alg_id         The PSA signing algorithm.
+ * \param[in] signing_key        The key.
+ * \param[in] hash_to_sign       The hash.
+ * \param[in] signature_buffer   Where to put the signature.
+ * \param[out] signature         The signature.
+ *
+ * \return An error from psa_status_to_t_cose_error_signing().
  */
-enum t_cose_err_t
-t_cose_crypto_sign(int32_t                cose_algorithm_id,
-                   struct t_cose_key      signing_key,
-                   struct q_useful_buf_c  hash_to_sign,
-                   struct q_useful_buf    signature_buffer,
-                   struct q_useful_buf_c *signature)
+static enum t_cose_err_t
+sign_hash(psa_algorithm_t        psa_alg_id,
+          struct t_cose_key      signing_key,
+          struct q_useful_buf_c  hash_to_sign,
+          struct q_useful_buf    signature_buffer,
+          struct q_useful_buf_c *signature)
 {
     enum t_cose_err_t     return_value;
     psa_status_t          psa_result;
-    psa_algorithm_t       psa_alg_id;
     mbedtls_svc_key_id_t  signing_key_psa;
     size_t                signature_len;
 
-    psa_alg_id = cose_alg_id_to_psa_alg_id(cose_algorithm_id);
-    if(!PSA_ALG_IS_ECDSA(psa_alg_id) && !PSA_ALG_IS_RSA_PSS(psa_alg_id)) {
-        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
-        goto Done;
-    }
-
     signing_key_psa = (mbedtls_svc_key_id_t)signing_key.k.key_handle;
 
     /* It is assumed that this call is checking the signature_buffer
@@ -218,8 +219,60 @@ t_cose_crypto_sign(int32_t                cose_algorithm_id,
         signature->len = signature_len;
     }
 
-  Done:
-     return return_value;
+    return return_value;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_sign(int32_t                cose_algorithm_id,
+                   struct t_cose_key      signing_key,
+                   struct q_useful_buf_c  hash_to_sign,
+                   struct q_useful_buf    signature_buffer,
+                   struct q_useful_buf_c *signature)
+{
+    psa_algorithm_t psa_alg_id;
+
+    psa_alg_id = cose_alg_id_to_psa_alg_id(cose_algorithm_id);
+    if(!PSA_ALG_IS_ECDSA(psa_alg_id) && !PSA_ALG_IS_RSA_PSS(psa_alg_id)) {
+        return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+    }
+
+    return sign_hash(psa_alg_id, signing_key, hash_to_sign, signature_buffer, signature);
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * The key's usage policy must permit PSA_ALG_DETERMINISTIC_ECDSA,
+ * for example as its enrollment algorithm.
+ */
+enum t_cose_err_t
+t_cose_crypto_sign_deterministic(int32_t                cose_algorithm_id,
+                                 struct t_cose_key      signing_key,
+                                 struct q_useful_buf_c  hash_to_sign,
+                                 struct q_useful_buf    signature_buffer,
+                                 struct q_useful_buf_c *signature)
+{
+    enum t_cose_err_t return_value;
+    psa_algorithm_t   psa_alg_id;
+
+    psa_alg_id = cose_alg_id_to_psa_alg_id(cose_algorithm_id);
+    if(!PSA_ALG_IS_ECDSA(psa_alg_id)) {
+        return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+    }
+    psa_alg_id = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SIGN_GET_HASH(psa_alg_id));
+
+    return_value = sign_hash(psa_alg_id, signing_key, hash_to_sign, signature_buffer, signature);
+    if(return_value == T_COSE_ERR_UNSUPPORTED_SIGNING_ALG) {
+        /* Mbed TLS built without MBEDTLS_ECDSA_DETERMINISTIC */
+        return_value = T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED;
+    }
+
+    return return_value;
 }
 
 
@@ -381,6 +434,162 @@ Done:
     return psa_status_to_t_cose_error_hash(hash_ctx->status);
 }
 
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_clone(struct t_cose_crypto_hash       *dest,
+                         const struct t_cose_crypto_hash *src)
+{
+    dest->ctx    = psa_hash_operation_init();
+    dest->status = src->status;
+    if(dest->status != PSA_SUCCESS) {
+        /* Copy the error state. It is returned by finish. */
+        return T_COSE_SUCCESS;
+    }
+
+    dest->status = psa_hash_clone(&(src->ctx), &(dest->ctx));
+
+    return psa_status_to_t_cose_error_hash(dest->status);
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_hash_abort(struct t_cose_crypto_hash *hash_ctx)
+{
+    psa_hash_abort(&(hash_ctx->ctx));
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * PSA has no multi-buffer hashing so this just does one message
+ * after the other.
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_batch(int32_t                               cose_hash_alg_id,
+                         struct t_cose_crypto_hash_batch_item *items,
+                         size_t                                num_items)
+{
+    enum t_cose_err_t         return_value;
+    struct t_cose_crypto_hash hash_ctx;
+    size_t                    i;
+    size_t                    piece;
+
+    return_value = T_COSE_SUCCESS;
+    for(i = 0; i < num_items; i++) {
+        return_value = t_cose_crypto_hash_start(&hash_ctx, cose_hash_alg_id);
+        if(return_value) {
+            break;
+        }
+        for(piece = 0; piece < items[i].num_pieces; piece++) {
+            t_cose_crypto_hash_update(&hash_ctx, items[i].pieces[piece]);
+        }
+        return_value = t_cose_crypto_hash_finish(&hash_ctx,
+                                                 items[i].buffer_for_hash,
+                                                 &items[i].hash);
+        if(return_value) {
+            break;
+        }
+    }
+
+    return return_value;
+}
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * PSA requires psa_crypto_init() before anything else is used, so
+ * this is mostly a convenient place to call it. Calling it more than
+ * once is allowed.
+ */
+enum t_cose_err_t
+t_cose_crypto_warmup(void *crypto_context)
+{
+    (void)crypto_context;
+
+    return psa_crypto_init() == PSA_SUCCESS ? T_COSE_SUCCESS
+                                            : T_COSE_ERR_FAIL;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ *
+ * PSA keys are handles and the library manages any sharing.
+ */
+enum t_cose_err_t
+t_cose_crypto_set_thread_key_replicas(bool enable)
+{
+    (void)enable;
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_trust_new(const struct q_useful_buf_c *anchors,
+                                size_t                       num_anchors,
+                                void                       **trust)
+{
+    (void)anchors;
+    (void)num_anchors;
+    *trust = NULL;
+    /* PSA Crypto has no X.509 */
+    return T_COSE_ERR_X5CHAIN_UNSUPPORTED;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_x5chain_trust_free(void *trust)
+{
+    (void)trust;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_validate(void                        *trust,
+                               const struct q_useful_buf_c *certs,
+                               size_t                       num_certs,
+                               int64_t                      time,
+                               struct t_cose_key           *leaf_key,
+                               int64_t                     *not_before,
+                               int64_t                     *not_after)
+{
+    (void)trust;
+    (void)certs;
+    (void)num_certs;
+    (void)time;
+    (void)leaf_key;
+    (void)not_before;
+    (void)not_after;
+    return T_COSE_ERR_X5CHAIN_UNSUPPORTED;
+}
+
+
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_x5chain_free_key(struct t_cose_key key)
+{
+    (void)key;
+}
+
+
 #ifndef T_COSE_DISABLE_EDDSA
 
 /*
@@ -29,22 +29,18 @@
  */
 
 
-/* The Brad Conte hash implementaiton bundled with t_cose */
-#include "sha256.h"
-
 /* Use of this file requires definition of T_COSE_USE_B_CON_SHA256 when
- * making t_cose_crypto.h.
- *
- * This only implements SHA-256 as that is all that is needed for the
- * non signing and verification tests using short-circuit signatures.
+ * making t_cose_crypto.h. The hash functions are in
+ * t_cose_b_con_hash.c.
  */
 
-#ifdef T_COSE_ENABLE_HASH_FAIL_TEST
-/* Global variable just for this particular test. Not thread
- * safe or good for commercial use.
- */
-int hash_test_mode = 0;
+#if !defined(T_COSE_DISABLE_ES384) || !defined(T_COSE_DISABLE_PS384)
+#define B_CON_SHA_384
 #endif
+#if !defined(T_COSE_DISABLE_ES512) || !defined(T_COSE_DISABLE_PS512)
+#define B_CON_SHA_512
+#endif
+
 
 /*
  * See documentation in t_cose_crypto.h
@@ -57,6 +53,12 @@ t_cose_crypto_is_algorithm_supported(int32_t cose_algorithm_id)
 {
     static const int32_t supported_algs[] = {
         COSE_ALGORITHM_SHA_256,
+#ifdef B_CON_SHA_384
+        COSE_ALGORITHM_SHA_384,
+#endif
+#ifdef B_CON_SHA_512
+        COSE_ALGORITHM_SHA_512,
+#endif
         0 /* List terminator */
     };
 
@@ -99,6 +101,25 @@ t_cose_crypto_sign(int32_t                cose_algorithm_id,
 }
 
 
+/*
+ * See documentation in t_cose_crypto.h
+ */
+enum t_cose_err_t
+t_cose_crypto_sign_deterministic(int32_t                cose_algorithm_id,
+                                 struct t_cose_key      signing_key,
+                                 struct q_useful_buf_c  hash_to_sign,
+                                 struct q_useful_buf    signature_buffer,
+                                 struct q_useful_buf_c *signature)
+{
+    (void)cose_algorithm_id;
+    (void)signing_key;
+    (void)hash_to_sign;
+    (void)signature_buffer;
+    (void)signature;
+    return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+}
+
+
 /*
  * See documentation in t_cose_crypto.h
  */
@@ -136,54 +157,58 @@ int check_for_key_pair_leaks(void)
  * See documentation in t_cose_crypto.h
  */
 enum t_cose_err_t
-t_cose_crypto_hash_start(struct t_cose_crypto_hash *hash_ctx,
-                         int32_t cose_hash_alg_id)
+t_cose_crypto_x5chain_trust_new(const struct q_useful_buf_c *anchors,
+                                size_t                       num_anchors,
+                                void                       **trust)
 {
-#ifdef T_COSE_ENABLE_HASH_FAIL_TEST
-    if(hash_test_mode == 1) {
-        return T_COSE_ERR_HASH_GENERAL_FAIL;
-    }
-#endif
-
-    if(cose_hash_alg_id != COSE_ALGORITHM_SHA_256) {
-        return T_COSE_ERR_UNSUPPORTED_HASH;
-    }
-
-    sha256_init(&(hash_ctx->b_con_hash_context));
-    return 0;
+    (void)anchors;
+    (void)num_anchors;
+    *trust = NULL;
+    /* The test adapter has no X.509 parser */
+    return T_COSE_ERR_X5CHAIN_UNSUPPORTED;
 }
 
+
 /*
  * See documentation in t_cose_crypto.h
  */
-void t_cose_crypto_hash_update(struct t_cose_crypto_hash *hash_ctx,
-                               struct q_useful_buf_c data_to_hash)
+void
+t_cose_crypto_x5chain_trust_free(void *trust)
 {
-    if(data_to_hash.ptr) {
-        sha256_update(&(hash_ctx->b_con_hash_context),
-                      data_to_hash.ptr,
-                      data_to_hash.len);
-    }
+    (void)trust;
 }
 
+
 /*
  * See documentation in t_cose_crypto.h
  */
 enum t_cose_err_t
-t_cose_crypto_hash_finish(struct t_cose_crypto_hash *hash_ctx,
-                          struct q_useful_buf buffer_to_hold_result,
-                          struct q_useful_buf_c *hash_result)
+t_cose_crypto_x5chain_validate(void                        *trust,
+                               const struct q_useful_buf_c *certs,
+                               size_t                       num_certs,
+                               int64_t                      time,
+                               struct t_cose_key           *leaf_key,
+                               int64_t                     *not_before,
+                               int64_t                     *not_after)
 {
-#ifdef T_COSE_ENABLE_HASH_FAIL_TEST
-    if(hash_test_mode == 2) {
-        return T_COSE_ERR_HASH_GENERAL_FAIL;
-    }
-#endif
+    (void)trust;
+    (void)certs;
+    (void)num_certs;
+    (void)time;
+    (void)leaf_key;
+    (void)not_before;
+    (void)not_after;
+    return T_COSE_ERR_X5CHAIN_UNSUPPORTED;
+}
 
-    sha256_final(&(hash_ctx->b_con_hash_context), buffer_to_hold_result.ptr);
-    *hash_result = (UsefulBufC){buffer_to_hold_result.ptr, 32};
 
-    return 0;
+/*
+ * See documentation in t_cose_crypto.h
+ */
+void
+t_cose_crypto_x5chain_free_key(struct t_cose_key key)
+{
+    (void)key;
 }
 
 
@@ -0,0 +1,264 @@
+/*
+ *  t_cose_claims_index.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#ifndef __T_COSE_CLAIMS_INDEX_H__
+#define __T_COSE_CLAIMS_INDEX_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} /* Keep editor indention formatting happy */
+#endif
+#endif
+
+
+/**
+ * \file t_cose_claims_index.h
+ *
+ * \brief Random access to the claims of a verified payload.
+ *
+ * Looking up a claim with \c QCBORDecode_GetItemInMapN() scans the
+ * map from the start, so looking up 20 claims scans it 20 times. The
+ * index is made in one pass over the payload and is then searched
+ * with a binary search. It is an array of small entries, one for each
+ * claim, that give where the claim's value is in the payload. Nothing
+ * is copied or allocated.
+ *
+ * Maps that are claim values, like EAT submodules, are indexed too,
+ * so their claims are found the same way:
+ *
+ *     t_cose_claims_index_build(&index, payload, entries, 40);
+ *     nonce = t_cose_claims_index_find(&index, NULL, 10);
+ *     submods = t_cose_claims_index_find(&index, NULL, 266);
+ *     radio = t_cose_claims_index_find_tstr(&index, submods,
+ *                                           Q_USEFUL_BUF_FROM_SZ_LITERAL("radio"));
+ *     t_cose_claims_index_get_string(&index,
+ *                                    t_cose_claims_index_find(&index, radio, 10),
+ *                                    &radio_nonce);
+ *
+ * Maps in arrays are not indexed as their claims have no label to
+ * find them by. Only integer and text string labels can be indexed;
+ * an indexed map with another kind of label or with a label twice is
+ * rejected. Indefinite lengths are not supported.
+ */
+
+
+/**
+ * How deeply maps and arrays may nest in a payload to index,
+ * including the outer map.
+ */
+#ifndef T_COSE_CLAIMS_INDEX_MAX_DEPTH
+#define T_COSE_CLAIMS_INDEX_MAX_DEPTH 8
+#endif
+
+
+/* The kinds of label in \ref t_cose_claims_index_entry */
+#define T_COSE_CLAIMS_INDEX_LABEL_INT  0
+#define T_COSE_CLAIMS_INDEX_LABEL_TSTR 1
+
+
+/**
+ * Where one claim is in the payload. 32 bytes. The offsets limit
+ * payloads to 4 GB.
+ */
+struct t_cose_claims_index_entry {
+    /* The integer label or the offset of a text string label */
+    int64_t  label;
+    /* The offset of the map the claim is in */
+    uint32_t map;
+    /* The offset and length of the value, including any tags */
+    uint32_t offset;
+    uint32_t length;
+    /* The length of a text string label */
+    uint32_t label_len;
+    /* The bytes of tags before the value's head */
+    uint8_t  tags_len;
+    /* The CBOR major type of the value, for example CBOR_MAJOR_TYPE_MAP */
+    uint8_t  major_type;
+    /* T_COSE_CLAIMS_INDEX_LABEL_INT or T_COSE_CLAIMS_INDEX_LABEL_TSTR */
+    uint8_t  label_type;
+};
+
+
+/**
+ * An index of the claims in a payload. Treat as opaque except for \c
+ * num_entries.
+ */
+struct t_cose_claims_index {
+    /* Private data structure */
+    struct q_useful_buf_c             payload;
+    struct t_cose_claims_index_entry *entries;
+    size_t                            num_entries;
+};
+
+
+/**
+ * \brief Index the claims in a payload.
+ *
+ * \param[out] index       The index.
+ * \param[in] payload      The encoded claims map, for example from
+ *                         t_cose_sign1_verify(). It must stay valid
+ *                         and unchanged as long as \c index is used.
+ * \param[in] entries      Storage for the entries, one for each claim
+ *                         including the claims in nested maps.
+ * \param[in] max_entries  The number of entries in \c entries.
+ *
+ * \retval T_COSE_ERR_TOO_SMALL
+ *         There are more than \c max_entries claims.
+ * \retval T_COSE_ERR_CBOR_NOT_WELL_FORMED
+ *         The payload isn't well-formed CBOR.
+ * \retval T_COSE_ERR_CWT_FORMAT
+ *         The payload isn't a single map, an indexed map has a label
+ *         that isn't an integer or text string or has a label twice,
+ *         nesting is deeper than \ref T_COSE_CLAIMS_INDEX_MAX_DEPTH
+ *         or there is an indefinite length.
+ * \retval T_COSE_ERR_INVALID_ARGUMENT
+ *         The payload is 4 GB or more.
+ * \retval T_COSE_SUCCESS
+ *         The claims can be looked up.
+ *
+ * The payload is walked once and the entries are then sorted, which
+ * takes next to nothing when the labels are already in order.
+ */
+enum t_cose_err_t
+t_cose_claims_index_build(struct t_cose_claims_index       *index,
+                          struct q_useful_buf_c             payload,
+                          struct t_cose_claims_index_entry *entries,
+                          size_t                            max_entries);
+
+
+/**
+ * \brief Find a claim with an integer label.
+ *
+ * \param[in] index  The index.
+ * \param[in] map    The entry of the nested map to look in or \c
+ *                   NULL for the outer map.
+ * \param[in] label  The label of the claim.
+ *
+ * \return The claim's entry or \c NULL if it isn't in the map or \c
+ *         map is not a map.
+ */
+const struct t_cose_claims_index_entry *
+t_cose_claims_index_find(const struct t_cose_claims_index       *index,
+                         const struct t_cose_claims_index_entry *map,
+                         int64_t                                 label);
+
+
+/**
+ * \brief Find a claim with a text string label.
+ *
+ * This is t_cose_claims_index_find() for a text string label.
+ */
+const struct t_cose_claims_index_entry *
+t_cose_claims_index_find_tstr(const struct t_cose_claims_index       *index,
+                              const struct t_cose_claims_index_entry *map,
+                              struct q_useful_buf_c                   label);
+
+
+/**
+ * \brief Go through the claims in a map.
+ *
+ * \param[in] index     The index.
+ * \param[in] map       The entry of the nested map or \c NULL for the
+ *                      outer map.
+ * \param[in] previous  The claim before or \c NULL for the first.
+ *
+ * \return The next claim in the map or \c NULL if there are no more
+ *         or \c map is not a map.
+ *
+ * The claims come in the order of the index: integer labels first in
+ * numeric order, then text string labels.
+ */
+const struct t_cose_claims_index_entry *
+t_cose_claims_index_next(const struct t_cose_claims_index       *index,
+                         const struct t_cose_claims_index_entry *map,
+                         const struct t_cose_claims_index_entry *previous);
+
+
+/**
+ * \brief Get the value of an integer claim.
+ *
+ * \param[in] index   The index.
+ * \param[in] entry   The claim's entry, or \c NULL.
+ * \param[out] value  The value.
+ *
+ * \retval T_COSE_ERR_CWT_FORMAT
+ *         \c entry is \c NULL or the claim isn't an integer that
+ *         fits in an \c int64_t.
+ * \retval T_COSE_SUCCESS
+ *         \c value is the claim.
+ *
+ * \c entry may come straight from a find function; a missing claim
+ * is an error the same as the wrong type.
+ */
+enum t_cose_err_t
+t_cose_claims_index_get_int(const struct t_cose_claims_index       *index,
+                            const struct t_cose_claims_index_entry *entry,
+                            int64_t                                *value);
+
+
+/**
+ * \brief Get the value of a byte or text string claim.
+ *
+ * \param[in] index   The index.
+ * \param[in] entry   The claim's entry, or \c NULL.
+ * \param[out] value  The string, pointing into the payload.
+ *
+ * \retval T_COSE_ERR_CWT_FORMAT
+ *         \c entry is \c NULL or the claim isn't a string.
+ * \retval T_COSE_SUCCESS
+ *         \c value is the claim.
+ */
+enum t_cose_err_t
+t_cose_claims_index_get_string(const struct t_cose_claims_index       *index,
+                               const struct t_cose_claims_index_entry *entry,
+                               struct q_useful_buf_c                  *value);
+
+
+/**
+ * \brief Get the encoded value of a claim.
+ *
+ * \param[in] index  The index.
+ * \param[in] entry  The claim's entry.
+ *
+ * \return The encoded value including any tags, pointing into the
+ *         payload, for decoding with QCBOR.
+ */
+static struct q_useful_buf_c
+t_cose_claims_index_encoded(const struct t_cose_claims_index       *index,
+                            const struct t_cose_claims_index_entry *entry);
+
+
+
+
+/* ------------------------------------------------------------------------
+ * Inline implementations of public functions defined above.
+ */
+
+static inline struct q_useful_buf_c
+t_cose_claims_index_encoded(const struct t_cose_claims_index       *me,
+                            const struct t_cose_claims_index_entry *entry)
+{
+    return (struct q_useful_buf_c){(const uint8_t *)me->payload.ptr + entry->offset,
+                                   entry->length};
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __T_COSE_CLAIMS_INDEX_H__ */
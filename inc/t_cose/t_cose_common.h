@@ -143,6 +143,37 @@ extern "C" {
  */
 #define T_COSE_ALGORITHM_PS512 -39
 
+/**
+ * \def T_COSE_ALGORITHM_SHA_256
+ *
+ * \brief Indicates SHA-256, for example as the payload hash
+ * algorithm of a hash envelope.
+ *
+ * This value comes from the
+ * [IANA COSE Registry](https://www.iana.org/assignments/cose/cose.xhtml).
+ */
+#define T_COSE_ALGORITHM_SHA_256 -16
+
+/**
+ * \def T_COSE_ALGORITHM_SHA_384
+ *
+ * \brief Indicates SHA-384.
+ *
+ * This value comes from the
+ * [IANA COSE Registry](https://www.iana.org/assignments/cose/cose.xhtml).
+ */
+#define T_COSE_ALGORITHM_SHA_384 -43
+
+/**
+ * \def T_COSE_ALGORITHM_SHA_512
+ *
+ * \brief Indicates SHA-512.
+ *
+ * This value comes from the
+ * [IANA COSE Registry](https://www.iana.org/assignments/cose/cose.xhtml).
+ */
+#define T_COSE_ALGORITHM_SHA_512 -44
+
 
 
 
@@ -161,7 +192,10 @@ enum t_cose_crypto_lib_t {
     T_COSE_CRYPTO_LIB_OPENSSL = 1,
      /** \c key_handle is a \c psa_key_handle_t in Arm's Platform Security
       * Architecture */
-    T_COSE_CRYPTO_LIB_PSA = 2
+    T_COSE_CRYPTO_LIB_PSA = 2,
+    /** \c key_ptr points to a \c struct \c p256_key for the built-in
+     * crypto adapter. See crypto_adapters/p256/p256.h. */
+    T_COSE_CRYPTO_LIB_BUILTIN = 3
 };
 
 
@@ -225,8 +259,12 @@ struct t_cose_key {
  * 17 extra bytes are added, rounding it up to 24 total, in case some
  * other protected header parameter is to be added and so the test
  * using T_COSE_TEST_CRIT_PARAMETER_EXIST can work.
+ *
+ * 40 more are for the hash envelope parameters, 8 bytes for the
+ * payload hash algorithm and a preimage content type of up to about
+ * 28 characters.
  */
-#define T_COSE_SIGN1_MAX_SIZE_PROTECTED_PARAMETERS (1+1+5+17)
+#define T_COSE_SIGN1_MAX_SIZE_PROTECTED_PARAMETERS (1+1+5+17+40)
 
 
 /**
@@ -403,6 +441,87 @@ enum t_cose_err_t {
 
     /** The auxiliary buffer is too small */
     T_COSE_ERR_AUXILIARY_BUFFER_SIZE = 39,
+
+    /** \ref T_COSE_OPT_DETERMINISTIC_ECDSA was requested, but the
+     * crypto library or its version can't make deterministic ECDSA
+     * signatures. */
+    T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED = 40,
+
+    /** The message, its protected header parameters or its payload
+     * is larger than the verification policy allows. See \ref
+     * t_cose_sign1_policy. */
+    T_COSE_ERR_POLICY_SIZE = 41,
+
+    /** The message's algorithm is not one the verification policy
+     * allows. */
+    T_COSE_ERR_POLICY_ALGORITHM = 42,
+
+    /** The kid is missing or not the length the verification policy
+     * requires. */
+    T_COSE_ERR_POLICY_KID = 43,
+
+    /** The signature is not the size the verification policy expects
+     * for the algorithm. */
+    T_COSE_ERR_POLICY_SIGNATURE_SIZE = 44,
+
+    /** A Merkle receipt is not well formed or its inclusion path
+     * doesn't fit the tree size in it. */
+    T_COSE_ERR_RECEIPT_FORMAT = 45,
+
+    /** The message is not a hash envelope or its payload hash
+     * algorithm is not the one expected. */
+    T_COSE_ERR_PAYLOAD_HASH_ALG = 46,
+
+    /** A file to hash couldn't be opened, read or mapped. */
+    T_COSE_ERR_FILE_READ = 47,
+
+    /** The payload is not a CWT claims set or one of the claims
+     * checked has the wrong type. */
+    T_COSE_ERR_CWT_FORMAT = 48,
+
+    /** The CWT has expired or has no expiration time when one is
+     * required. */
+    T_COSE_ERR_CWT_EXPIRED = 49,
+
+    /** The CWT's not-before time hasn't come yet. */
+    T_COSE_ERR_CWT_NOT_YET_VALID = 50,
+
+    /** The CWT's issuer is missing or not the one expected. */
+    T_COSE_ERR_CWT_ISSUER = 51,
+
+    /** The CWT's audience is missing or not the one expected. */
+    T_COSE_ERR_CWT_AUDIENCE = 52,
+
+    /** A payload doesn't match the CDDL schema of an encoder or
+     * decoder made by tools/cddl_gen. For example a required claim is
+     * missing or a claim has the wrong type. */
+    T_COSE_ERR_PAYLOAD_SCHEMA = 53,
+
+    /** The message has no x5chain parameter and its x5t parameter, if
+     * any, isn't for a certificate chain that was validated before. */
+    T_COSE_ERR_NO_X5CHAIN = 54,
+
+    /** The certificate chain doesn't lead to a trust anchor, isn't
+     * valid at the time, can't be parsed or its leaf certificate
+     * isn't for signing. Also when x5t doesn't match the leaf. */
+    T_COSE_ERR_X5CHAIN_INVALID = 55,
+
+    /** The crypto adapter can't validate certificate chains. */
+    T_COSE_ERR_X5CHAIN_UNSUPPORTED = 56,
+
+    /** The CWT's \c cti, or its payload if it has none, has been
+     * seen before. See \ref t_cose_replay_cache. */
+    T_COSE_ERR_CWT_REPLAYED = 57,
+
+    /** The replay cache can't remember the token until it expires,
+     * either because it lives longer than the cache is set up for or
+     * because too many tokens expire around the same time. */
+    T_COSE_ERR_REPLAY_CACHE_FULL = 58,
+
+    /** A CWT has no \c exp claim but one is required, either by
+     * \ref T_COSE_CWT_REQUIRE_EXP or because the replay cache would
+     * otherwise have to remember it forever. */
+    T_COSE_ERR_CWT_MISSING_EXP = 59,
 };
 
 
@@ -425,6 +544,19 @@ enum t_cose_err_t {
 #define T_COSE_PARAMETER_LIST_MAX 10
 
 
+/**
+ * The batch signing and verification functions,
+ * t_cose_sign1_sign_batch() and t_cose_sign1_verify_batch(), work
+ * through their items this many at a time. Their stack use goes up
+ * by roughly 500 bytes for each. It is best a multiple of the number
+ * of lanes in the crypto adapter's multi-buffer hash, if it has one.
+ * Like \ref T_COSE_PARAMETER_LIST_MAX this can be changed.
+ */
+#ifndef T_COSE_BATCH_GROUP_SIZE
+#define T_COSE_BATCH_GROUP_SIZE 16
+#endif
+
+
 
 /**
  * The value of an unsigned integer content type indicating no content
@@ -450,6 +582,71 @@ bool
 t_cose_is_algorithm_supported(int32_t cose_algorithm_id);
 
 
+/**
+ * \brief Do one-time set up of the crypto library at start up.
+ *
+ * \param[in] crypto_context  Crypto-library-specific context or
+ *                            \c NULL for the default.
+ *
+ * \returns An error from \ref t_cose_err_t or \ref T_COSE_SUCCESS.
+ *
+ * Crypto libraries do a lot of set up the first time something is
+ * used. OpenSSL 3 for example loads its default provider and
+ * constructs each algorithm implementation on first use, and looks
+ * up the implementation again under a global lock for every message
+ * unless it has been fetched explicitly. This can make the first
+ * message signed or verified tens of times slower than later ones.
+ *
+ * Calling this once at start up does that set up then. It runs each
+ * hash once and makes and verifies one ES256 signature. With OpenSSL
+ * 3 it also fetches the digest and signature implementations once
+ * and they are used for every message after. This saves both the
+ * first-use cost and some on every message.
+ *
+ * With OpenSSL 3 \c crypto_context may be an \c OSSL_LIB_CTX to
+ * fetch from. It must remain valid until this is called again with
+ * another context. The other crypto adapters ignore it.
+ *
+ * Call this before other threads use t_cose. It is not thread safe
+ * itself. It can be called again, for example to change the
+ * OpenSSL library context, under the same condition.
+ */
+enum t_cose_err_t
+t_cose_warmup(void *crypto_context);
+
+
+/**
+ * \brief Keep per-thread copies of keys in the calling thread.
+ *
+ * \param[in] enable  \c true to start keeping them, \c false to stop
+ *                    and release them.
+ *
+ * \returns An error from \ref t_cose_err_t or \ref T_COSE_SUCCESS.
+ *
+ * This is for servers where many threads sign or verify with the
+ * same \ref t_cose_key. With OpenSSL each message makes a context
+ * from the key, which atomically updates the key's reference count,
+ * and RSA blinding uses state in the key. All the threads contend on
+ * this shared memory and at high core counts it limits throughput.
+ *
+ * With replicas on, the OpenSSL adapter makes a duplicate of each key
+ * the thread uses, the first time it uses it, and keeps the signing
+ * and verification contexts made from it for the messages after. A
+ * few keys are kept per thread and the least recently used is
+ * released when another is needed.
+ *
+ * A replica holds a reference to the original key. The key is not
+ * actually freed until its replicas are released, so call this with
+ * \c false before the thread exits or the references are leaked.
+ *
+ * The other crypto adapters don't share key state between threads
+ * and this does nothing with them. \ref T_COSE_ERR_FAIL is returned
+ * if the compiler has no thread-local storage.
+ */
+enum t_cose_err_t
+t_cose_set_thread_key_replicas(bool enable);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,199 @@
+/*
+ *  t_cose_cwt_claims.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#ifndef __T_COSE_CWT_CLAIMS_H__
+#define __T_COSE_CWT_CLAIMS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} /* Keep editor indention formatting happy */
+#endif
+#endif
+
+
+/**
+ * \file t_cose_cwt_claims.h
+ *
+ * \brief Check the claims of a CWT.
+ *
+ * Most users of a verified CWT (RFC 8392) decode the claims map right
+ * after t_cose_sign1_verify() to check that it hasn't expired and
+ * that it is from the right issuer for the right audience. This does
+ * that in one pass over the map and returns the standard claims,
+ * pointing into the payload.
+ *
+ * t_cose_sign1_verify_cwt() verifies the \c COSE_Sign1 and checks
+ * the claims together. With \ref T_COSE_CWT_CHECK_BEFORE_SIGNATURE
+ * the claims are checked before the signature so an expired token
+ * costs a CBOR decode instead of a public key operation. With a \ref
+ * t_cose_replay_cache a CWT is also only accepted the first time.
+ */
+
+
+struct t_cose_replay_cache;
+
+
+/* CWT claim keys from RFC 8392 */
+#define T_COSE_CWT_CLAIM_ISS 1
+#define T_COSE_CWT_CLAIM_SUB 2
+#define T_COSE_CWT_CLAIM_AUD 3
+#define T_COSE_CWT_CLAIM_EXP 4
+#define T_COSE_CWT_CLAIM_NBF 5
+#define T_COSE_CWT_CLAIM_IAT 6
+#define T_COSE_CWT_CLAIM_CTI 7
+
+
+/**
+ * An option for \ref t_cose_cwt_validation to reject a CWT without
+ * an \c exp claim with \ref T_COSE_ERR_CWT_MISSING_EXP. Without it a
+ * CWT without \c exp never expires.
+ */
+#define T_COSE_CWT_REQUIRE_EXP 0x01
+
+
+/**
+ * An option for \ref t_cose_cwt_validation for
+ * t_cose_sign1_verify_cwt() to check the claims before the signature
+ * instead of after. A CWT that fails the checks is rejected without
+ * hashing the payload or using the key. Nothing is returned from the
+ * claims until the signature has been verified.
+ */
+#define T_COSE_CWT_CHECK_BEFORE_SIGNATURE 0x02
+
+
+/**
+ * What a CWT must have to be accepted. Set one up with
+ * t_cose_cwt_validation_init(), which checks only \c exp and \c nbf
+ * against the system clock, then set the fields wanted.
+ *
+ * This is only read while checking so one can be shared by any
+ * number of threads. The replay cache it points to is modified, but
+ * it can be shared too.
+ */
+struct t_cose_cwt_validation {
+    /* The exact iss or NULL_Q_USEFUL_BUF_C if it isn't checked */
+    struct q_useful_buf_c       issuer;
+    /* The exact aud or NULL_Q_USEFUL_BUF_C if it isn't checked */
+    struct q_useful_buf_c       audience;
+    /* Returns the time in seconds since 1970 or NULL for time() */
+    int64_t                   (*clock)(void *clock_ctx);
+    void                       *clock_ctx;
+    /* Seconds of clock skew allowed for exp and nbf */
+    uint32_t                    leeway;
+    /* T_COSE_CWT_REQUIRE_EXP and T_COSE_CWT_CHECK_BEFORE_SIGNATURE */
+    uint32_t                    option_flags;
+    /* Where t_cose_sign1_verify_cwt() remembers the CWTs it has
+     * accepted or NULL not to check for replays */
+    struct t_cose_replay_cache *replay_cache;
+};
+
+
+/**
+ * The standard claims of a CWT. The strings point into the payload,
+ * which must stay valid as long as this is used. A claim that isn't
+ * in the CWT is \c NULL_Q_USEFUL_BUF_C or, for the times, not in \c
+ * present.
+ */
+struct t_cose_cwt_claims {
+    struct q_useful_buf_c iss;
+    struct q_useful_buf_c sub;
+    struct q_useful_buf_c aud;
+    struct q_useful_buf_c cti;
+    int64_t               exp;
+    int64_t               nbf;
+    int64_t               iat;
+    /* Bit (1 << claim key) for each standard claim in the CWT */
+    uint32_t              present;
+    /* The number of claims that aren't standard ones */
+    size_t                num_other_claims;
+};
+
+
+/**
+ * \brief Set up a CWT validation that only checks the times.
+ *
+ * \param[out] validation    The validation to set up.
+ * \param[in] option_flags   \ref T_COSE_CWT_REQUIRE_EXP and \ref
+ *                           T_COSE_CWT_CHECK_BEFORE_SIGNATURE.
+ */
+static void
+t_cose_cwt_validation_init(struct t_cose_cwt_validation *validation,
+                           uint32_t                      option_flags);
+
+
+/**
+ * \brief Check a CWT claims set.
+ *
+ * \param[in] validation  What the claims must be.
+ * \param[in] payload     The encoded claims map, for example from
+ *                        t_cose_sign1_verify().
+ * \param[out] claims     The standard claims. May be \c NULL.
+ *
+ * \retval T_COSE_ERR_CWT_FORMAT
+ *         \c payload is not one well-formed map or a standard claim
+ *         is the wrong type or is duplicated.
+ * \retval T_COSE_ERR_CWT_EXPIRED
+ *         The time is at or past \c exp plus the leeway.
+ * \retval T_COSE_ERR_CWT_MISSING_EXP
+ *         There is no \c exp and \ref T_COSE_CWT_REQUIRE_EXP is set.
+ * \retval T_COSE_ERR_CWT_NOT_YET_VALID
+ *         The time is before \c nbf less the leeway.
+ * \retval T_COSE_ERR_CWT_ISSUER
+ *         \c iss is missing or different.
+ * \retval T_COSE_ERR_CWT_AUDIENCE
+ *         \c aud is missing or different.
+ * \retval T_COSE_SUCCESS
+ *         The claims are acceptable.
+ *
+ * The map is decoded once. The clock is read only if there is an \c
+ * exp or \c nbf. NumericDates may be integers or, if QCBOR has
+ * floating point, floating point numbers, of which the fraction is
+ * ignored. Claims that aren't standard are counted but not looked at
+ * otherwise. The replay cache isn't used here since a CWT must only
+ * be remembered once its signature is verified.
+ */
+enum t_cose_err_t
+t_cose_cwt_validate(const struct t_cose_cwt_validation *validation,
+                    struct q_useful_buf_c               payload,
+                    struct t_cose_cwt_claims           *claims);
+
+
+
+
+/* ------------------------------------------------------------------------
+ * Inline implementations of public functions defined above.
+ */
+
+static inline void
+t_cose_cwt_validation_init(struct t_cose_cwt_validation *me,
+                           uint32_t                      option_flags)
+{
+    me->issuer       = NULL_Q_USEFUL_BUF_C;
+    me->audience     = NULL_Q_USEFUL_BUF_C;
+    me->clock        = NULL;
+    me->clock_ctx    = NULL;
+    me->leeway       = 0;
+    me->option_flags = option_flags;
+    me->replay_cache = NULL;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __T_COSE_CWT_CLAIMS_H__ */
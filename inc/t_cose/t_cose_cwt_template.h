@@ -0,0 +1,289 @@
+/*
+ *  t_cose_cwt_template.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#ifndef __T_COSE_CWT_TEMPLATE_H__
+#define __T_COSE_CWT_TEMPLATE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_cwt_claims.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} /* Keep editor indention formatting happy */
+#endif
+#endif
+
+
+/**
+ * \file t_cose_cwt_template.h
+ *
+ * \brief Make CWT claims sets from a template.
+ *
+ * A token service usually issues CWTs (RFC 8392) that are all the
+ * same except for a few claims like \c exp, \c iat and \c cti. A
+ * template is the encoded claims map made once, with a fixed-width
+ * slot for each claim that changes. For each token the new values are
+ * stored into the slots and the template bytes are the payload to
+ * pass to t_cose_sign1_sign(). No CBOR is encoded per token.
+ *
+ *     t_cose_cwt_template_init(&tmpl, buffer);
+ *     t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_ISS, "issuer");
+ *     exp = t_cose_cwt_template_add_uint_slot(&tmpl, T_COSE_CWT_CLAIM_EXP);
+ *     cti = t_cose_cwt_template_add_bstr_slot(&tmpl, T_COSE_CWT_CLAIM_CTI, 16);
+ *     t_cose_cwt_template_finish(&tmpl, &payload);
+ *
+ *     // For each token
+ *     t_cose_cwt_template_set_uint(&tmpl, exp, now + 3600);
+ *     t_cose_cwt_template_set_bstr(&tmpl, cti, random_16_bytes);
+ *     t_cose_sign1_sign(&sign_ctx, payload, out_buf, &token);
+ */
+
+
+/**
+ * The most slots a template can have.
+ */
+#ifndef T_COSE_CWT_TEMPLATE_MAX_SLOTS
+#define T_COSE_CWT_TEMPLATE_MAX_SLOTS 4
+#endif
+
+
+/**
+ * The most claims, fixed and slots, a template can have. The map
+ * head is written last so it has to be the one-byte form.
+ */
+#define T_COSE_CWT_TEMPLATE_MAX_CLAIMS 23
+
+
+/**
+ * An encoded CWT claims set with slots for the claims that change.
+ * Treat as opaque.
+ */
+struct t_cose_cwt_template {
+    /* Private data structure */
+    struct q_useful_buf buffer;
+    size_t              len;
+    size_t              num_claims;
+    size_t              num_slots;
+    size_t              slot_offset[T_COSE_CWT_TEMPLATE_MAX_SLOTS];
+    size_t              slot_len[T_COSE_CWT_TEMPLATE_MAX_SLOTS];
+    bool                slot_is_uint[T_COSE_CWT_TEMPLATE_MAX_SLOTS];
+    enum t_cose_err_t   error;
+};
+
+
+/**
+ * \brief Start a CWT template.
+ *
+ * \param[out] me      The template.
+ * \param[in] buffer   Where the encoded claims go. It must stay valid
+ *                     as long as the template is used.
+ *
+ * Add the claims in the order they are to appear in the map with the
+ * functions below, then call t_cose_cwt_template_finish(). The adding
+ * functions don't return errors; the first one is kept and returned
+ * by t_cose_cwt_template_finish().
+ */
+void
+t_cose_cwt_template_init(struct t_cose_cwt_template *me,
+                         struct q_useful_buf         buffer);
+
+
+/**
+ * \brief Add a claim with an integer value that is the same in every
+ *        token.
+ *
+ * \param[in] me     The template.
+ * \param[in] label  The claim key.
+ * \param[in] value  The claim value.
+ */
+void
+t_cose_cwt_template_add_int(struct t_cose_cwt_template *me,
+                            int64_t                     label,
+                            int64_t                     value);
+
+
+/**
+ * \brief Add a claim with a text string value that is the same in
+ *        every token.
+ *
+ * \param[in] me     The template.
+ * \param[in] label  The claim key, for example \ref T_COSE_CWT_CLAIM_ISS.
+ * \param[in] value  The claim value. It is copied.
+ */
+void
+t_cose_cwt_template_add_tstr(struct t_cose_cwt_template *me,
+                             int64_t                     label,
+                             const char                 *value);
+
+
+/**
+ * \brief Add a claim with a byte string value that is the same in
+ *        every token.
+ *
+ * \param[in] me     The template.
+ * \param[in] label  The claim key.
+ * \param[in] value  The claim value. It is copied.
+ */
+void
+t_cose_cwt_template_add_bstr(struct t_cose_cwt_template *me,
+                             int64_t                     label,
+                             struct q_useful_buf_c       value);
+
+
+/**
+ * \brief Add a slot for an unsigned integer claim that changes.
+ *
+ * \param[in] me     The template.
+ * \param[in] label  The claim key, for example \ref T_COSE_CWT_CLAIM_EXP.
+ *
+ * \return The slot number to give to t_cose_cwt_template_set_uint().
+ *
+ * The value is always encoded in the four-byte form, which is the
+ * preferred serialization for every NumericDate from 1970-01-01T18:12Z
+ * to 2106. The slot starts as 0.
+ */
+size_t
+t_cose_cwt_template_add_uint_slot(struct t_cose_cwt_template *me,
+                                  int64_t                     label);
+
+
+/**
+ * \brief Add a slot for a fixed-length byte string claim that changes.
+ *
+ * \param[in] me     The template.
+ * \param[in] label  The claim key, for example \ref T_COSE_CWT_CLAIM_CTI.
+ * \param[in] len    The length every value will have.
+ *
+ * \return The slot number to give to t_cose_cwt_template_set_bstr().
+ *
+ * The slot starts as all zero bytes.
+ */
+size_t
+t_cose_cwt_template_add_bstr_slot(struct t_cose_cwt_template *me,
+                                  int64_t                     label,
+                                  size_t                      len);
+
+
+/**
+ * \brief Finish a CWT template.
+ *
+ * \param[in] me        The template.
+ * \param[out] payload  The encoded claims map.
+ *
+ * \retval T_COSE_ERR_TOO_SMALL
+ *         The buffer given to t_cose_cwt_template_init() is too small.
+ * \retval T_COSE_ERR_TOO_MANY_PARAMETERS
+ *         More than \ref T_COSE_CWT_TEMPLATE_MAX_CLAIMS claims or
+ *         \ref T_COSE_CWT_TEMPLATE_MAX_SLOTS slots.
+ * \retval T_COSE_SUCCESS
+ *         \c payload can be signed.
+ *
+ * \c payload points into the template's buffer. Setting a slot changes
+ * it in place, so it doesn't need to be fetched again.
+ */
+enum t_cose_err_t
+t_cose_cwt_template_finish(struct t_cose_cwt_template *me,
+                           struct q_useful_buf_c      *payload);
+
+
+/**
+ * \brief Store a new value in an unsigned integer slot.
+ *
+ * \param[in] me     The finished template.
+ * \param[in] slot   From t_cose_cwt_template_add_uint_slot().
+ * \param[in] value  The new value.
+ *
+ * \retval T_COSE_ERR_INVALID_ARGUMENT
+ *         \c slot is not an unsigned integer slot or \c value doesn't
+ *         fit in 32 bits.
+ * \retval T_COSE_SUCCESS
+ *         The payload has the new value.
+ */
+static enum t_cose_err_t
+t_cose_cwt_template_set_uint(struct t_cose_cwt_template *me,
+                             size_t                      slot,
+                             uint64_t                    value);
+
+
+/**
+ * \brief Store a new value in a byte string slot.
+ *
+ * \param[in] me     The finished template.
+ * \param[in] slot   From t_cose_cwt_template_add_bstr_slot().
+ * \param[in] value  The new value. It must be the slot's length.
+ *
+ * \retval T_COSE_ERR_INVALID_ARGUMENT
+ *         \c slot is not a byte string slot or \c value is the
+ *         wrong length.
+ * \retval T_COSE_SUCCESS
+ *         The payload has the new value.
+ */
+static enum t_cose_err_t
+t_cose_cwt_template_set_bstr(struct t_cose_cwt_template *me,
+                             size_t                      slot,
+                             struct q_useful_buf_c       value);
+
+
+
+
+/* ------------------------------------------------------------------------
+ * Inline implementations of public functions defined above.
+ */
+
+static inline enum t_cose_err_t
+t_cose_cwt_template_set_uint(struct t_cose_cwt_template *me,
+                             size_t                      slot,
+                             uint64_t                    value)
+{
+    uint8_t *p;
+
+    if(slot >= T_COSE_CWT_TEMPLATE_MAX_SLOTS || slot >= me->num_slots ||
+       !me->slot_is_uint[slot] || value > UINT32_MAX) {
+        return T_COSE_ERR_INVALID_ARGUMENT;
+    }
+
+    p = (uint8_t *)me->buffer.ptr + me->slot_offset[slot];
+    p[0] = (uint8_t)(value >> 24);
+    p[1] = (uint8_t)(value >> 16);
+    p[2] = (uint8_t)(value >> 8);
+    p[3] = (uint8_t)value;
+
+    return T_COSE_SUCCESS;
+}
+
+
+static inline enum t_cose_err_t
+t_cose_cwt_template_set_bstr(struct t_cose_cwt_template *me,
+                             size_t                      slot,
+                             struct q_useful_buf_c       value)
+{
+    if(slot >= T_COSE_CWT_TEMPLATE_MAX_SLOTS || slot >= me->num_slots ||
+       me->slot_is_uint[slot] || me->slot_len[slot] != value.len) {
+        return T_COSE_ERR_INVALID_ARGUMENT;
+    }
+
+    memcpy((uint8_t *)me->buffer.ptr + me->slot_offset[slot], value.ptr, value.len);
+
+    return T_COSE_SUCCESS;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __T_COSE_CWT_TEMPLATE_H__ */
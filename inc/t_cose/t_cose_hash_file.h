@@ -0,0 +1,105 @@
+/*
+ *  t_cose_hash_file.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#ifndef __T_COSE_HASH_FILE_H__
+#define __T_COSE_HASH_FILE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} /* Keep editor indention formatting happy */
+#endif
+#endif
+
+
+/**
+ * \file t_cose_hash_file.h
+ *
+ * \brief Hash files for hash envelopes.
+ *
+ * A hash envelope (see t_cose_sign1_set_hash_envelope()) signs the
+ * hash of a payload. For payloads that are files, possibly many
+ * gigabytes, this hashes them without reading them into buffers
+ * first. Each file is memory-mapped, the kernel is told it will be
+ * read sequentially so it reads ahead, and the mapped bytes are
+ * hashed directly.
+ *
+ * This needs POSIX mmap() and is left out when \c
+ * T_COSE_DISABLE_HASH_FILE is defined.
+ */
+
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+
+/**
+ * One file for t_cose_hash_files().
+ */
+struct t_cose_hash_file_item {
+    /* Inputs */
+    const char          *path;
+    struct q_useful_buf  buffer_for_hash;
+
+    /* Outputs */
+    struct q_useful_buf_c hash;
+    enum t_cose_err_t     err;
+};
+
+
+/**
+ * \brief Hash several files.
+ *
+ * \param[in] hash_alg_id   The COSE algorithm ID of the hash, for
+ *                          example \ref T_COSE_ALGORITHM_SHA_256.
+ * \param[in,out] items     The files to hash and where to put the
+ *                          hashes.
+ * \param[in] num_items     The number of entries in \c items.
+ *
+ * \return \ref T_COSE_SUCCESS if every file was hashed, otherwise the
+ *         error of the first one that wasn't.
+ *
+ * The outcome for each file is in its \c err and \c hash is filled in
+ * only when \c err is \ref T_COSE_SUCCESS. \ref T_COSE_ERR_FILE_READ
+ * is the error when a file can't be opened, examined or mapped. One
+ * failing doesn't stop the others.
+ *
+ * Up to \ref T_COSE_BATCH_GROUP_SIZE files are mapped at once and
+ * hashed together as for t_cose_sign1_sign_batch(), so crypto
+ * adapters with multi-buffer hashing hash them in parallel SIMD
+ * lanes while the kernel reads ahead in each.
+ *
+ * Hashing a big file takes far longer than signing its hash. This
+ * uses no shared state, so to keep it off the critical path it can
+ * be called from a worker thread and the resulting hashes handed to
+ * t_cose_sign1_sign() or t_cose_sign1_verify_hash_envelope() when
+ * ready.
+ *
+ * A file changed while it is being hashed gives a hash of some mix
+ * of the old and new contents. A file truncated while mapped may
+ * cause \c SIGBUS.
+ */
+enum t_cose_err_t
+t_cose_hash_files(int32_t                       hash_alg_id,
+                  struct t_cose_hash_file_item *items,
+                  size_t                        num_items);
+
+#endif /* T_COSE_DISABLE_HASH_FILE */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __T_COSE_HASH_FILE_H__ */
@@ -0,0 +1,254 @@
+/*
+ *  t_cose_nested.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#ifndef __T_COSE_NESTED_H__
+#define __T_COSE_NESTED_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_claims_index.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} /* Keep editor indention formatting happy */
+#endif
+#endif
+
+
+/**
+ * \file t_cose_nested.h
+ *
+ * \brief Verify a token and the tokens nested in it.
+ *
+ * An EAT may carry the tokens of its submodules as byte strings in
+ * its claims, each a \c COSE_Sign1 of its own. This verifies the
+ * outer token, indexes its payload once with a \ref
+ * t_cose_claims_index to find the inner tokens at the configured
+ * claim paths, then verifies those, and so on down to a configured
+ * depth. The results are a tree in an array the caller gives. The
+ * payloads in it point into the outer token; nothing is copied.
+ *
+ *     // Each token in the EAT submods claim, with its own key
+ *     static const struct t_cose_nested_label submods[] = {{266, NULL_Q_USEFUL_BUF_C}};
+ *     paths[0].labels     = submods;
+ *     paths[0].num_labels = 1;
+ *     paths[0].flags      = T_COSE_NESTED_EACH;
+ *     paths[0].verifier   = &submodule_verifier;
+ *
+ *     t_cose_nested_config_init(&config, paths, 1, entries, 40);
+ *     t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 10, &num_results);
+ *
+ * The inner tokens of each level found by a path are verified
+ * together in one call of t_cose_sign1_verifier_verify_batch() so
+ * their hashing runs in parallel SIMD lanes with crypto adapters
+ * that have multi-buffer hashing. t_cose has no threads of its own;
+ * to verify them on a worker pool set \c dispatch in \ref
+ * t_cose_nested_config to a function that spreads each batch over
+ * the pool and waits for it.
+ */
+
+
+/**
+ * A flag for \ref t_cose_nested_path. The path leads to a map and
+ * each byte string in it is a token. Other values in it, like
+ * submodule claims that aren't in a token, are passed over. Without
+ * this the path leads to one token.
+ */
+#define T_COSE_NESTED_EACH 0x01
+
+
+/**
+ * One label in a \ref t_cose_nested_path.
+ */
+struct t_cose_nested_label {
+    int64_t               label;
+    /* The text string label or NULL_Q_USEFUL_BUF_C if label is used */
+    struct q_useful_buf_c tstr;
+};
+
+
+/**
+ * Where inner tokens are in a payload and what verifies them.
+ */
+struct t_cose_nested_path {
+    /* The labels from the payload's map down to the claim */
+    const struct t_cose_nested_label   *labels;
+    size_t                              num_labels;
+    /* T_COSE_NESTED_EACH */
+    uint32_t                            flags;
+    /* The key and options for the tokens found by this path */
+    const struct t_cose_sign1_verifier *verifier;
+};
+
+
+/**
+ * What to verify. Set one up with t_cose_nested_config_init().
+ */
+struct t_cose_nested_config {
+    const struct t_cose_nested_path  *paths;
+    size_t                            num_paths;
+    /* How many levels of tokens in tokens; 1 for only those in the outer */
+    size_t                            max_depth;
+    /* Storage to index one payload at a time */
+    struct t_cose_claims_index_entry *index_entries;
+    size_t                            max_index_entries;
+    /* Verifies a batch of inner tokens, for example on a worker
+     * pool. NULL for t_cose_sign1_verifier_verify_batch() on the
+     * calling thread. */
+    enum t_cose_err_t               (*dispatch)(void                                  *dispatch_ctx,
+                                                const struct t_cose_sign1_verifier    *verifier,
+                                                struct t_cose_sign1_verify_batch_item *items,
+                                                size_t                                 num_items);
+    void                             *dispatch_ctx;
+};
+
+
+/**
+ * One token in the tree of results. The first is the outer token.
+ */
+struct t_cose_nested_result {
+    /* The index of the result for the token this one is in or
+     * SIZE_MAX for the outer token */
+    size_t                   parent;
+    /* The index of the path in the configuration that found it */
+    size_t                   path;
+    size_t                   depth;
+    /* The label of the claim it is in. label_tstr is NULL_Q_USEFUL_BUF_C
+     * for an integer label. */
+    int64_t                  label;
+    struct q_useful_buf_c    label_tstr;
+    /* The token and, when err is T_COSE_SUCCESS, its payload */
+    struct q_useful_buf_c    token;
+    struct q_useful_buf_c    payload;
+    struct t_cose_parameters parameters;
+    enum t_cose_err_t        err;
+};
+
+
+/**
+ * \brief Set up the configuration for nested verification.
+ *
+ * \param[out] config         The configuration.
+ * \param[in] paths           Where the inner tokens are. The same paths
+ *                            are looked for at every level.
+ * \param[in] num_paths       The number of \c paths.
+ * \param[in] index_entries   Storage for indexing a payload, one entry
+ *                            for each of its claims.
+ * \param[in] max_entries     The number of \c index_entries.
+ *
+ * Only the tokens in the outer token are verified; set \c max_depth
+ * for deeper ones.
+ */
+static void
+t_cose_nested_config_init(struct t_cose_nested_config      *config,
+                          const struct t_cose_nested_path  *paths,
+                          size_t                            num_paths,
+                          struct t_cose_claims_index_entry *index_entries,
+                          size_t                            max_entries);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 and the tokens nested in it.
+ *
+ * \param[in,out] context   The verification context for the outer token.
+ * \param[in] sign1         The outer token.
+ * \param[in] config        Where the inner tokens are and what verifies
+ *                          them.
+ * \param[out] results      The tree of results, the outer token first.
+ * \param[in] max_results   The number of \c results.
+ * \param[out] num_results  The number of \c results filled in.
+ *
+ * \retval T_COSE_ERR_TOO_SMALL
+ *         There are more than \c max_results tokens. The results so
+ *         far are filled in.
+ * \retval T_COSE_SUCCESS
+ *         Every token verified.
+ *
+ * Otherwise it is the error of the first token in \c results that
+ * didn't verify. If the outer token didn't verify it is the only
+ * result.
+ *
+ * Each result has the error for its token. One failing doesn't stop
+ * the others, but the tokens in one that failed are not looked for.
+ * A payload that can't be indexed, for example because it isn't a
+ * map, gives the error from t_cose_claims_index_build() for the token
+ * it is the payload of. A path without \ref T_COSE_NESTED_EACH to a
+ * claim that isn't a byte string, or with it to a claim that isn't a
+ * map, gives a result with \ref T_COSE_ERR_CWT_FORMAT. A path that
+ * leads to nothing is not an error.
+ *
+ * A \c dispatch function in \c config must set \c err in every item
+ * as t_cose_sign1_verifier_verify_batch() does. Its return value is
+ * not used.
+ *
+ * The inner tokens are verified with the verification call in \c
+ * context, so afterwards t_cose_sign1_get_nth_tag() gives the tags of
+ * the last one. Stack use is several KB, as for
+ * t_cose_sign1_verify_batch().
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_nested(struct t_cose_sign1_verify_ctx    *context,
+                           struct q_useful_buf_c              sign1,
+                           const struct t_cose_nested_config *config,
+                           struct t_cose_nested_result       *results,
+                           size_t                             max_results,
+                           size_t                            *num_results);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 and the tokens nested in it with a
+ *        shared configuration.
+ *
+ * This is t_cose_sign1_verify_nested() with the configuration and
+ * the per-message state separate as in t_cose_sign1_verifier_verify().
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_nested(const struct t_cose_sign1_verifier *verifier,
+                                    struct t_cose_sign1_verify_call    *call,
+                                    struct q_useful_buf_c               sign1,
+                                    const struct t_cose_nested_config  *config,
+                                    struct t_cose_nested_result        *results,
+                                    size_t                              max_results,
+                                    size_t                             *num_results);
+
+
+
+
+/* ------------------------------------------------------------------------
+ * Inline implementations of public functions defined above.
+ */
+
+static inline void
+t_cose_nested_config_init(struct t_cose_nested_config      *me,
+                          const struct t_cose_nested_path  *paths,
+                          size_t                            num_paths,
+                          struct t_cose_claims_index_entry *index_entries,
+                          size_t                            max_entries)
+{
+    me->paths             = paths;
+    me->num_paths         = num_paths;
+    me->max_depth         = 1;
+    me->index_entries     = index_entries;
+    me->max_index_entries = max_entries;
+    me->dispatch          = NULL;
+    me->dispatch_ctx      = NULL;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __T_COSE_NESTED_H__ */
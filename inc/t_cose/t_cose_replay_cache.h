@@ -0,0 +1,168 @@
+/*
+ *  t_cose_replay_cache.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#ifndef __T_COSE_REPLAY_CACHE_H__
+#define __T_COSE_REPLAY_CACHE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} /* Keep editor indention formatting happy */
+#endif
+#endif
+
+
+/**
+ * \file t_cose_replay_cache.h
+ *
+ * \brief Detect replayed tokens in process.
+ *
+ * A token must only be accepted once, so every \c cti seen must be
+ * remembered until the token it came in expires. This is a hash set
+ * of them that any number of threads can check and add to at once
+ * without locks. Give it to t_cose_sign1_verify_cwt() in \ref
+ * t_cose_cwt_validation and a token is rejected with \ref
+ * T_COSE_ERR_CWT_REPLAYED if it has been verified before. It must be
+ * a real verification; a replay cache with \ref T_COSE_OPT_DECODE_ONLY
+ * or \ref T_COSE_OPT_ALLOW_SHORT_CIRCUIT is an error:
+ *
+ *     t_cose_replay_cache_init(&replay, slots, num_slots, 3600, 12);
+ *     validation.replay_cache = &replay;
+ *     t_cose_sign1_verify_cwt(&verify_ctx, cwt, &validation, &claims, NULL);
+ *
+ * The set is split into buckets by expiration time, each covering an
+ * equal part of the longest token lifetime. A token is entered into
+ * the bucket for its \c exp so all its checks go to the same place
+ * and the check and the insert are one atomic operation. When a
+ * bucket's time has passed it is reused for a later time by changing
+ * one number. What was in it is then ignored without being cleared.
+ *
+ * A token is remembered by 40 bits of the SHA-256 of its \c cti, or of
+ * its payload if it has no \c cti. A CWT without \c exp could never be
+ * forgotten, so t_cose_sign1_verify_cwt() rejects it with \ref
+ * T_COSE_ERR_CWT_MISSING_EXP. By chance about one new token in
+ * 2^40 per token already in its bucket is taken as a replay.
+ *
+ * The checks are atomic with GCC and clang. With other compilers a
+ * cache must only be used by one thread at a time.
+ */
+
+
+/**
+ * The most buckets in a \ref t_cose_replay_cache.
+ */
+#ifndef T_COSE_REPLAY_MAX_BUCKETS
+#define T_COSE_REPLAY_MAX_BUCKETS 32
+#endif
+
+
+/**
+ * The number of slots for a \ref t_cose_replay_cache that verifies
+ * up to \c rate tokens a second, each of which lives up to \c
+ * ttl_seconds. This keeps the buckets at most half full after their
+ * sizes are rounded down to a power of two.
+ */
+#define T_COSE_REPLAY_CACHE_SLOTS(rate, ttl_seconds) \
+    ((size_t)(rate) * (size_t)(ttl_seconds) * 4)
+
+
+/**
+ * The tokens seen and not yet expired. Set one up with
+ * t_cose_replay_cache_init(). After that it may be shared by any
+ * number of threads. It must not be copied.
+ */
+struct t_cose_replay_cache {
+    /* Private data structure */
+    uint64_t *slots;
+    size_t    slots_per_bucket;
+    uint32_t  max_probes;
+    uint32_t  num_buckets;
+    uint32_t  bucket_seconds;
+    /* The expiration time slot each bucket is for, changed atomically */
+    uint64_t  bucket_times[T_COSE_REPLAY_MAX_BUCKETS + 1];
+};
+
+
+/**
+ * \brief Set up a replay cache.
+ *
+ * \param[out] cache        The cache.
+ * \param[in] slots         Storage for the cache.
+ * \param[in] num_slots     The number of \c slots, for example from
+ *                          \ref T_COSE_REPLAY_CACHE_SLOTS.
+ * \param[in] ttl_seconds   The longest a token is valid for from when
+ *                          it is verified, including leeway.
+ * \param[in] num_buckets   How many parts \c ttl_seconds is divided
+ *                          into, up to \ref T_COSE_REPLAY_MAX_BUCKETS.
+ *
+ * \retval T_COSE_SUCCESS
+ * \retval T_COSE_ERR_INVALID_ARGUMENT
+ *         \c ttl_seconds or \c num_buckets is 0 or there are too many
+ *         buckets.
+ * \retval T_COSE_ERR_TOO_SMALL
+ *         There isn't a slot for each bucket.
+ *
+ * One more bucket than \c num_buckets is used so there is always one
+ * for the tokens that expire next. More buckets waste less of the
+ * slots on tokens that have expired but haven't been evicted. The
+ * slots are divided evenly between the buckets.
+ */
+enum t_cose_err_t
+t_cose_replay_cache_init(struct t_cose_replay_cache *cache,
+                         uint64_t                   *slots,
+                         size_t                      num_slots,
+                         uint32_t                    ttl_seconds,
+                         uint32_t                    num_buckets);
+
+
+/**
+ * \brief Check that a token hasn't been seen and remember it.
+ *
+ * \param[in,out] cache  The cache.
+ * \param[in] id         What identifies the token, usually its \c cti.
+ * \param[in] expires    When the token stops being accepted, in
+ *                       seconds since 1970.
+ * \param[in] now        The time in seconds since 1970.
+ *
+ * \retval T_COSE_SUCCESS
+ *         \c id wasn't in the cache and now is.
+ * \retval T_COSE_ERR_CWT_REPLAYED
+ *         \c id is in the cache.
+ * \retval T_COSE_ERR_CWT_EXPIRED
+ *         \c expires isn't after \c now, or its bucket has been reused
+ *         for later tokens by a thread with a later \c now.
+ * \retval T_COSE_ERR_INVALID_ARGUMENT
+ *         \c now is before 1970.
+ * \retval T_COSE_ERR_REPLAY_CACHE_FULL
+ *         \c expires is further ahead than the cache's \c ttl_seconds
+ *         or the bucket for it is full.
+ *
+ * Only call this for tokens whose signature has been verified or
+ * anyone could fill the cache. When two threads check the same \c id
+ * at once, exactly one gets \ref T_COSE_SUCCESS.
+ */
+enum t_cose_err_t
+t_cose_replay_cache_check(struct t_cose_replay_cache *cache,
+                          struct q_useful_buf_c       id,
+                          int64_t                     expires,
+                          int64_t                     now);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __T_COSE_REPLAY_CACHE_H__ */
@@ -62,13 +62,17 @@ extern "C" {
 
 
 /**
- * This is the context for creating a \c COSE_Sign1 structure. The
- * caller should allocate it and pass it to the functions here.  This
- * is about 100 bytes so it fits easily on the stack.
+ * The configuration for creating \c COSE_Sign1 messages: the
+ * algorithm, key, kid, options and content type along with the
+ * encoded protected header parameters made from them.
+ *
+ * Once set up with t_cose_sign1_signer_init() and the setters, it is
+ * only read while signing, so one can be shared by any number of
+ * threads signing at the same time with no copying or locking. It is
+ * about 150 bytes.
  */
-struct t_cose_sign1_sign_ctx {
+struct t_cose_sign1_signer {
     /* Private data structure */
-    struct q_useful_buf_c protected_parameters; /* Encoded protected paramssy */
     int32_t               cose_algorithm_id;
     struct t_cose_key     signing_key;
     uint32_t              option_flags;
@@ -77,7 +81,22 @@ struct t_cose_sign1_sign_ctx {
     uint32_t              content_type_uint;
     const char *          content_type_tstr;
 #endif
+    /* 0 if not a hash envelope */
+    int32_t               payload_hash_alg;
+    const char *          preimage_content_type;
+    /* The encoded protected parameters without the bstr wrapping.
+     * Zero length if the algorithm isn't supported. */
+    size_t                protected_parameters_len;
+    uint8_t               protected_parameters[T_COSE_SIGN1_MAX_SIZE_PROTECTED_PARAMETERS];
+};
+
 
+/**
+ * The state of one signing operation. It is small and is meant to be
+ * on the stack of the caller. It only matters for EdDSA; for other
+ * algorithms \c NULL can be passed instead.
+ */
+struct t_cose_sign1_sign_call {
 #ifndef T_COSE_DISABLE_EDDSA
     /**
      * A auxiliary buffer provided by the caller, used to serialize
@@ -86,15 +105,35 @@ struct t_cose_sign1_sign_ctx {
      */
     struct q_useful_buf  auxiliary_buffer;
 
-    /* The size of the serialized Sig_Structure used in the last
+    /* The size of the serialized Sig_Structure used in the
      * signing operation. This can be used by the user to determine
      * a suitable auxiliary buffer size.
      */
     size_t               auxiliary_buffer_size;
+#else
+    /* There is no state without EdDSA, but C doesn't allow an empty
+     * struct */
+    uint8_t              unused;
 #endif
 };
 
 
+/**
+ * This is the context for creating a \c COSE_Sign1 structure. The
+ * caller should allocate it and pass it to the functions here.  This
+ * is about 180 bytes so it fits easily on the stack.
+ *
+ * It is a \ref t_cose_sign1_signer and a \ref t_cose_sign1_sign_call
+ * together. It is modified by every signing so each thread needs its
+ * own. Use those two directly to share one configuration.
+ */
+struct t_cose_sign1_sign_ctx {
+    /* Private data structure */
+    struct t_cose_sign1_signer    signer;
+    struct t_cose_sign1_sign_call call;
+};
+
+
 /**
  * This selects a signing test mode called _short_ _circuit_
  * _signing_. This mode is useful when there is no signing key
@@ -133,6 +172,29 @@ struct t_cose_sign1_sign_ctx {
 #define T_COSE_OPT_OMIT_CBOR_TAG 0x00000002
 
 
+/**
+ * An \c option_flag for t_cose_sign1_sign_init() to make ECDSA
+ * signatures with a deterministic nonce as described in [RFC 6979]
+ * (https://tools.ietf.org/html/rfc6979).
+ *
+ * Normally every ECDSA signature takes a fresh random nonce from the
+ * crypto library's random number generator. That generator is shared
+ * and locked, so when many threads sign at once they queue for it,
+ * and a signature can stall while it reseeds. With this option the
+ * nonce is derived from the private key and the hash being signed, so
+ * no randomness is used and signing the same payload with the same
+ * key and parameters always gives the same \c COSE_Sign1. The
+ * signatures verify like any other ECDSA signature.
+ *
+ * It has no effect for the algorithms that aren't ECDSA. If the crypto
+ * adapter can't do deterministic ECDSA, signing fails with \ref
+ * T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED rather than silently
+ * using a random nonce. The OpenSSL adapter needs OpenSSL 3.2 or
+ * later. The built-in adapter and PSA support it.
+ */
+#define T_COSE_OPT_DETERMINISTIC_ECDSA 0x00000004
+
+
 /**
  * \brief  Initialize to start creating a \c COSE_Sign1.
  *
@@ -277,6 +339,37 @@ t_cose_sign1_set_content_type_tstr(struct t_cose_sign1_sign_ctx *context,
 #endif /* T_COSE_DISABLE_CONTENT_TYPE */
 
 
+/**
+ * \brief Make the messages signed hash envelopes.
+ *
+ * \param[in] context                The t_cose signing context.
+ * \param[in] payload_hash_alg       The hash algorithm of the payloads,
+ *                                   for example \ref
+ *                                   T_COSE_ALGORITHM_SHA_256.
+ * \param[in] preimage_content_type  The MIME content type of what was
+ *                                   hashed or \c NULL.
+ *
+ * A hash envelope (draft-ietf-cose-hash-envelope) signs the hash of
+ * a payload rather than the payload. This is for payloads like
+ * multi-gigabyte files that are too big to send through t_cose. Hash
+ * them first, for example with t_cose_hash_files(), and sign the hash
+ * as the payload. Signing and verifying take the same time however
+ * big the file is.
+ *
+ * This puts \c payload_hash_alg and \c preimage_content_type in the
+ * protected header parameters. It doesn't check that payloads are
+ * hashes. A hash envelope must not have a content type parameter, so
+ * signing fails with \ref T_COSE_ERR_BAD_CONTENT_TYPE if one is set.
+ * \c preimage_content_type is not copied and must stay valid as long
+ * as \c context is used. Pass 0 for \c payload_hash_alg to go back
+ * to normal messages.
+ */
+static void
+t_cose_sign1_set_hash_envelope(struct t_cose_sign1_sign_ctx *context,
+                               int32_t                       payload_hash_alg,
+                               const char                   *preimage_content_type);
+
+
 
 /**
  * \brief  Create and sign a \c COSE_Sign1 message with a payload in one call.
@@ -474,6 +567,534 @@ t_cose_sign1_encode_signature_aad(struct t_cose_sign1_sign_ctx *context,
                                   QCBOREncodeContext          *cbor_encode_ctx);
 
 
+/**
+ * One message for t_cose_sign1_sign_batch().
+ */
+struct t_cose_sign1_sign_batch_item {
+    /* Inputs */
+    struct q_useful_buf_c payload;
+    struct q_useful_buf_c aad;     /* NULL_Q_USEFUL_BUF_C if none */
+    struct q_useful_buf   out_buf;
+
+    /* Outputs */
+    struct q_useful_buf_c result;
+    enum t_cose_err_t     err;
+};
+
+
+/**
+ * \brief Create and sign several \c COSE_Sign1 messages in one call.
+ *
+ * \param[in] context    The t_cose signing context.
+ * \param[in,out] items  The payloads to sign, where to put each
+ *                       \c COSE_Sign1 and where its result goes.
+ * \param[in] num_items  The number of entries in \c items.
+ *
+ * \return \ref T_COSE_SUCCESS if every message was signed, otherwise
+ *         the error of the first one that wasn't.
+ *
+ * Each item gives the same result as calling t_cose_sign1_sign_aad()
+ * with \c context and the item's \c aad, \c payload and \c out_buf.
+ * The outcome for each is in its \c err and one failing doesn't stop
+ * the others. All of them are signed with the algorithm, key, kid
+ * and options in \c context.
+ *
+ * This is for signing many small messages. The to-be-signed bytes of
+ * up to \ref T_COSE_BATCH_GROUP_SIZE messages at a time are hashed
+ * together with t_cose_crypto_hash_batch(), which for crypto
+ * adapters with multi-buffer hashing runs them in parallel SIMD
+ * lanes. The public key operations still happen one at a time.
+ *
+ * EdDSA has no separate hash step so for it this is the same as
+ * signing one after the other.
+ *
+ * Stack use is higher than t_cose_sign1_sign(), several KB with the
+ * default \ref T_COSE_BATCH_GROUP_SIZE.
+ */
+enum t_cose_err_t
+t_cose_sign1_sign_batch(struct t_cose_sign1_sign_ctx        *context,
+                        struct t_cose_sign1_sign_batch_item *items,
+                        size_t                               num_items);
+
+
+/**
+ * Where the payload and signature of a \c COSE_Sign1 started with
+ * t_cose_sign1_reserve_payload() go. Treat as opaque.
+ */
+struct t_cose_sign1_reservation {
+    /* Private data structure */
+    struct q_useful_buf message;
+    size_t              payload_offset;
+    size_t              payload_len;
+    size_t              signature_offset;
+    size_t              signature_len;
+};
+
+
+/**
+ * \brief Start a \c COSE_Sign1 message and get the place to write the
+ *        payload in it.
+ *
+ * \param[in] context        The t_cose signing context.
+ * \param[in] payload_len    The exact length the payload will be.
+ * \param[in] out_buf        Pointer and length of buffer to output to.
+ * \param[out] reservation   Where things are in \c out_buf, for
+ *                           t_cose_sign1_sign_reserved().
+ * \param[out] payload_slot  Where in \c out_buf to write the payload.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is an alternative to t_cose_sign1_encode_parameters() and
+ * t_cose_sign1_encode_signature() for large payloads. Those let the
+ * payload be written directly into the output buffer too, but closing
+ * the payload and the signature byte strings inserts their lengths in
+ * front of them, which moves the whole payload once more.
+ *
+ * Here the length of the payload is given up front and the signature
+ * size is known from the algorithm and key, so the whole layout of
+ * the message is fixed now. Everything but the payload and the
+ * signature is written to \c out_buf. \c payload_slot is exactly
+ * \c payload_len bytes at the payload's final place in the message.
+ * Copy or read the payload into it, for example with \c recv()
+ * directly from a socket, and then call t_cose_sign1_sign_reserved()
+ * which writes the signature directly into its final place too.
+ * Nothing is moved.
+ *
+ * The message made is byte-for-byte what t_cose_sign1_sign() makes
+ * with the same payload. Detached payloads aren't supported this way.
+ *
+ * \ref T_COSE_ERR_TOO_SMALL is returned if \c out_buf can't hold the
+ * whole message. If \c out_buf has a \c NULL pointer nothing is
+ * written, \c payload_slot has a \c NULL pointer and
+ * t_cose_sign1_sign_reserved() gives the size of the message.
+ */
+enum t_cose_err_t
+t_cose_sign1_reserve_payload(struct t_cose_sign1_sign_ctx    *context,
+                             size_t                           payload_len,
+                             struct q_useful_buf              out_buf,
+                             struct t_cose_sign1_reservation *reservation,
+                             struct q_useful_buf             *payload_slot);
+
+
+/**
+ * \brief Sign the payload written into a \c COSE_Sign1 started with
+ *        t_cose_sign1_reserve_payload().
+ *
+ * \param[in] context      The t_cose signing context.
+ * \param[in] reservation  From t_cose_sign1_reserve_payload().
+ * \param[in] aad          The Additional Authenticated Data or
+ *                         \c NULL_Q_USEFUL_BUF_C.
+ * \param[out] result      Pointer and length of the resulting
+ *                         \c COSE_Sign1.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is when the cryptographic signature algorithm is run. The
+ * whole payload slot must have been filled in and \c context must
+ * not have been changed since t_cose_sign1_reserve_payload().
+ */
+static enum t_cose_err_t
+t_cose_sign1_sign_reserved(struct t_cose_sign1_sign_ctx          *context,
+                           const struct t_cose_sign1_reservation *reservation,
+                           struct q_useful_buf_c                  aad,
+                           struct q_useful_buf_c                 *result);
+
+
+/**
+ * A \c COSE_Sign1 in three pieces from t_cose_sign1_sign_iovec(). The
+ * message is the bytes of \c header, then \c payload, then \c
+ * trailer, in that order. They can be the three entries of a
+ * <tt>struct iovec</tt> array for \c writev() or \c sendmsg().
+ */
+struct t_cose_sign1_iovec {
+    /* The tag, array head, parameters and payload byte string head */
+    struct q_useful_buf_c header;
+    /* The caller's payload; not copied */
+    struct q_useful_buf_c payload;
+    /* The signature byte string */
+    struct q_useful_buf_c trailer;
+};
+
+
+/**
+ * \brief Create and sign a \c COSE_Sign1 message without copying the
+ *        payload into it.
+ *
+ * \param[in] context      The t_cose signing context.
+ * \param[in] aad          The Additional Authenticated Data or
+ *                         \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] payload      Pointer and length of payload to sign.
+ * \param[in] header_buf   Buffer for everything before the payload.
+ * \param[in] trailer_buf  Buffer for everything after the payload.
+ * \param[out] result      The three pieces of the \c COSE_Sign1.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This makes the same message as t_cose_sign1_sign_aad(), but instead
+ * of one contiguous buffer it is returned as a small header, the
+ * caller's payload and a small trailer. The payload is hashed where it
+ * is and never copied, so a large payload can be signed and sent with
+ * one \c writev() or \c sendmsg().
+ *
+ * The header is less than 100 bytes plus the size of the kid and the
+ * content type. The trailer is the signature plus up to 3 bytes. If
+ * either buffer has a \c NULL pointer, nothing is signed and the sizes
+ * they need are returned in \c result. \ref T_COSE_ERR_TOO_SMALL is
+ * returned if either is too small.
+ *
+ * \c payload in \c result points to the caller's payload so it must
+ * stay valid and unchanged until the message has been sent.
+ */
+enum t_cose_err_t
+t_cose_sign1_sign_iovec(struct t_cose_sign1_sign_ctx *context,
+                        struct q_useful_buf_c         aad,
+                        struct q_useful_buf_c         payload,
+                        struct q_useful_buf           header_buf,
+                        struct q_useful_buf           trailer_buf,
+                        struct t_cose_sign1_iovec    *result);
+
+
+/**
+ * The largest hash the nodes of a Merkle tree can be, SHA-512.
+ */
+#define T_COSE_MERKLE_MAX_HASH_SIZE 64
+
+
+/**
+ * The size of the tree buffer for t_cose_sign1_sign_merkle() that
+ * is always big enough for \c num_payloads payloads. It is a little
+ * more than two hashes per payload.
+ */
+#define T_COSE_MERKLE_TREE_BUFFER_SIZE(num_payloads) \
+    ((2 * (num_payloads) + 64) * T_COSE_MERKLE_MAX_HASH_SIZE)
+
+
+/**
+ * A Merkle tree of payloads and the \c COSE_Sign1 of its root made
+ * by t_cose_sign1_sign_merkle(). Treat as opaque.
+ */
+struct t_cose_merkle_tree {
+    /* Private data structure */
+    /* Each level after the one below, the leaves first */
+    const uint8_t        *nodes;
+    size_t                num_leaves;
+    size_t                hash_size;
+    struct q_useful_buf_c signed_root;
+};
+
+
+/**
+ * \brief Sign many payloads with one signature over their Merkle tree.
+ *
+ * \param[in] context       The t_cose signing context.
+ * \param[in] payloads      The payloads.
+ * \param[in] num_payloads  The number of entries in \c payloads.
+ * \param[in] tree_buf      Buffer for the nodes of the tree. \ref
+ *                          T_COSE_MERKLE_TREE_BUFFER_SIZE is always
+ *                          enough.
+ * \param[in] out_buf       Buffer for the \c COSE_Sign1 of the root.
+ * \param[out] tree         The tree, for t_cose_merkle_tree_receipt().
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is for signing many events or log entries where a public key
+ * operation for each would cost too much. The payloads are hashed
+ * into a Merkle tree as in RFC 9162 (section 2.1), leaves as
+ * HASH(0x00 || payload) and interior nodes as HASH(0x01 || left ||
+ * right). Only the root is signed. It is the payload of a normal \c
+ * COSE_Sign1 made as t_cose_sign1_sign() would with \c context.
+ *
+ * The hash is that of the signing algorithm, for example SHA-384 for
+ * ES384. EdDSA uses SHA-256. The leaves and each level are hashed
+ * with t_cose_crypto_hash_batch() so crypto adapters with
+ * multi-buffer hashing do several at once.
+ *
+ * Then call t_cose_merkle_tree_receipt() for each payload to get the
+ * receipt that proves it is in the signed tree. The payloads are not
+ * needed for that and are not referenced by \c tree, but \c tree_buf
+ * and \c out_buf must stay valid as long as \c tree is used.
+ *
+ * \ref T_COSE_ERR_INVALID_ARGUMENT is returned if there are no
+ * payloads and \ref T_COSE_ERR_TOO_SMALL if either buffer is too
+ * small.
+ */
+enum t_cose_err_t
+t_cose_sign1_sign_merkle(struct t_cose_sign1_sign_ctx *context,
+                         const struct q_useful_buf_c  *payloads,
+                         size_t                        num_payloads,
+                         struct q_useful_buf           tree_buf,
+                         struct q_useful_buf           out_buf,
+                         struct t_cose_merkle_tree    *tree);
+
+
+/**
+ * \brief Make the receipt for one payload of a signed Merkle tree.
+ *
+ * \param[in] tree         The tree from t_cose_sign1_sign_merkle().
+ * \param[in] index        The index of the payload in the tree.
+ * \param[in] out_buf      Buffer to output the receipt to.
+ * \param[out] receipt     Pointer and length of the receipt.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * The receipt is everything needed to verify the payload with
+ * t_cose_sign1_verify_receipt(). It is this CBOR:
+ *
+ *     receipt = [
+ *         signed_root: bstr .cbor COSE_Sign1,
+ *         leaf_index:  uint,
+ *         tree_size:   uint,
+ *         path:        [* bstr]
+ *     ]
+ *
+ * \c path is the RFC 9162 inclusion proof, the hashes of the sibling
+ * nodes from the leaf up to the root. It has about log2(tree_size)
+ * entries, so a receipt is the \c COSE_Sign1 plus, for example, 340
+ * bytes for 1000 payloads signed with ES256.
+ *
+ * \ref T_COSE_ERR_INVALID_ARGUMENT is returned if \c index is not in
+ * the tree.
+ */
+enum t_cose_err_t
+t_cose_merkle_tree_receipt(const struct t_cose_merkle_tree *tree,
+                           size_t                           index,
+                           struct q_useful_buf              out_buf,
+                           struct q_useful_buf_c           *receipt);
+
+
+
+/**
+ * \brief Set up a configuration for signing \c COSE_Sign1 messages.
+ *
+ * \param[out] signer            The configuration to set up.
+ * \param[in] option_flags       One of \c T_COSE_OPT_XXXX.
+ * \param[in] cose_algorithm_id  The algorithm to sign with, for example
+ *                               \ref T_COSE_ALGORITHM_ES256.
+ *
+ * \retval T_COSE_SUCCESS
+ * \retval T_COSE_ERR_UNSUPPORTED_SIGNING_ALG
+ *         If this fails, signing with \c signer gives the same error.
+ *
+ * This is the same as t_cose_sign1_sign_init(), but the protected
+ * header parameters are encoded now, once, rather than for every
+ * message and an unsupported algorithm is reported here.
+ *
+ * After this, set the key with t_cose_sign1_signer_set_signing_key()
+ * and the content type if there is one. From then on \c signer is
+ * only read, so it can be shared by all the threads that sign with
+ * it, for example by making it a \c const global. The per-message
+ * state is in a \ref t_cose_sign1_sign_call that each caller has on
+ * its own stack.
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_init(struct t_cose_sign1_signer *signer,
+                         uint32_t                    option_flags,
+                         int32_t                     cose_algorithm_id);
+
+
+/**
+ * \brief Set the key and kid (key ID) for signing.
+ *
+ * \param[in] signer       The signing configuration.
+ * \param[in] signing_key  The signing key to use or \ref T_COSE_NULL_KEY.
+ * \param[in] kid          COSE kid (key ID) parameter or \c NULL_Q_USEFUL_BUF_C.
+ *
+ * This is the same as t_cose_sign1_set_signing_key(). The \c kid
+ * bytes are not copied and must stay valid as long as \c signer is
+ * used.
+ */
+static void
+t_cose_sign1_signer_set_signing_key(struct t_cose_sign1_signer *signer,
+                                    struct t_cose_key           signing_key,
+                                    struct q_useful_buf_c       kid);
+
+
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+/**
+ * \brief Set the payload content type using CoAP content types.
+ *
+ * This is the same as t_cose_sign1_set_content_type_uint().
+ */
+static void
+t_cose_sign1_signer_set_content_type_uint(struct t_cose_sign1_signer *signer,
+                                          uint16_t                    content_type);
+
+
+/**
+ * \brief Set the payload content type using MIME content types.
+ *
+ * This is the same as t_cose_sign1_set_content_type_tstr(). The
+ * string is not copied and must stay valid as long as \c signer is
+ * used.
+ */
+static void
+t_cose_sign1_signer_set_content_type_tstr(struct t_cose_sign1_signer *signer,
+                                          const char                 *content_type);
+#endif /* T_COSE_DISABLE_CONTENT_TYPE */
+
+
+/**
+ * \brief Make messages signed with a shared configuration hash
+ *        envelopes.
+ *
+ * \param[in] signer                 The signing configuration.
+ * \param[in] payload_hash_alg       The hash algorithm of the payloads.
+ * \param[in] preimage_content_type  The content type of what was
+ *                                   hashed or \c NULL.
+ *
+ * \retval T_COSE_SUCCESS
+ * \retval T_COSE_ERR_CBOR_FORMATTING
+ *         The preimage content type is too long. Signing with \c
+ *         signer then fails.
+ *
+ * This is t_cose_sign1_set_hash_envelope(). The protected header
+ * parameters are encoded again with the hash envelope parameters.
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_set_hash_envelope(struct t_cose_sign1_signer *signer,
+                                      int32_t                     payload_hash_alg,
+                                      const char                 *preimage_content_type);
+
+
+/**
+ * \brief Set up the state for one signing operation.
+ *
+ * \param[out] call            The state to set up.
+ * \param[in] auxiliary_buffer The buffer to serialize the Sig_Structure
+ *                             in for EdDSA or \c NULL_Q_USEFUL_BUF.
+ *
+ * See t_cose_sign1_sign_set_auxiliary_buffer() for sizing and size
+ * calculation. Afterwards \c auxiliary_buffer_size in \c call is the
+ * size used by the signing.
+ */
+static void
+t_cose_sign1_sign_call_init(struct t_cose_sign1_sign_call *call,
+                            struct q_useful_buf            auxiliary_buffer);
+
+
+/**
+ * \brief Create and sign a \c COSE_Sign1 message with a shared
+ *        configuration.
+ *
+ * \param[in] signer   The signing configuration.
+ * \param[in,out] call The state for this signing or \c NULL.
+ * \param[in] aad      The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] payload  Pointer and length of payload to sign.
+ * \param[in] out_buf  Pointer and length of buffer to output to.
+ * \param[out] result  Pointer and length of the resulting \c COSE_Sign1.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is t_cose_sign1_sign_aad() with the configuration and the
+ * per-message state separate. \c signer is not modified, so any
+ * number of threads can call this at once with the same one. \c call
+ * is only needed for EdDSA; with \c NULL EdDSA fails with \ref
+ * T_COSE_ERR_NEED_AUXILIARY_BUFFER, except when computing the size.
+ * The output is byte-for-byte what a \ref t_cose_sign1_sign_ctx set
+ * up the same way makes.
+ */
+static enum t_cose_err_t
+t_cose_sign1_signer_sign(const struct t_cose_sign1_signer *signer,
+                         struct t_cose_sign1_sign_call    *call,
+                         struct q_useful_buf_c             aad,
+                         struct q_useful_buf_c             payload,
+                         struct q_useful_buf               out_buf,
+                         struct q_useful_buf_c            *result);
+
+
+/**
+ * \brief Create and sign a \c COSE_Sign1 message with detached payload
+ *        and a shared configuration.
+ *
+ * This is t_cose_sign1_sign_detached() with the configuration and the
+ * per-message state separate as in t_cose_sign1_signer_sign().
+ */
+static enum t_cose_err_t
+t_cose_sign1_signer_sign_detached(const struct t_cose_sign1_signer *signer,
+                                  struct t_cose_sign1_sign_call    *call,
+                                  struct q_useful_buf_c             aad,
+                                  struct q_useful_buf_c             detached_payload,
+                                  struct q_useful_buf               out_buf,
+                                  struct q_useful_buf_c            *result);
+
+
+/**
+ * \brief Create and sign several \c COSE_Sign1 messages with a shared
+ *        configuration.
+ *
+ * This is t_cose_sign1_sign_batch() with the configuration and the
+ * per-message state separate as in t_cose_sign1_signer_sign().
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_batch(const struct t_cose_sign1_signer    *signer,
+                               struct t_cose_sign1_sign_call       *call,
+                               struct t_cose_sign1_sign_batch_item *items,
+                               size_t                               num_items);
+
+
+/**
+ * \brief Start a \c COSE_Sign1 message with a shared configuration
+ *        and get the place to write the payload in it.
+ *
+ * This is t_cose_sign1_reserve_payload() with the configuration
+ * separate as in t_cose_sign1_signer_sign().
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_reserve_payload(const struct t_cose_sign1_signer *signer,
+                                    size_t                            payload_len,
+                                    struct q_useful_buf               out_buf,
+                                    struct t_cose_sign1_reservation  *reservation,
+                                    struct q_useful_buf              *payload_slot);
+
+
+/**
+ * \brief Sign the payload written into a \c COSE_Sign1 started with
+ *        t_cose_sign1_signer_reserve_payload().
+ *
+ * This is t_cose_sign1_sign_reserved() with the configuration and the
+ * per-message state separate as in t_cose_sign1_signer_sign().
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_reserved(const struct t_cose_sign1_signer      *signer,
+                                  struct t_cose_sign1_sign_call         *call,
+                                  const struct t_cose_sign1_reservation *reservation,
+                                  struct q_useful_buf_c                  aad,
+                                  struct q_useful_buf_c                 *result);
+
+
+/**
+ * \brief Create and sign a \c COSE_Sign1 message with a shared
+ *        configuration without copying the payload into it.
+ *
+ * This is t_cose_sign1_sign_iovec() with the configuration and the
+ * per-message state separate as in t_cose_sign1_signer_sign().
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_iovec(const struct t_cose_sign1_signer *signer,
+                               struct t_cose_sign1_sign_call    *call,
+                               struct q_useful_buf_c             aad,
+                               struct q_useful_buf_c             payload,
+                               struct q_useful_buf               header_buf,
+                               struct q_useful_buf               trailer_buf,
+                               struct t_cose_sign1_iovec        *result);
+
+
+/**
+ * \brief Sign many payloads with one signature over their Merkle tree
+ *        with a shared configuration.
+ *
+ * This is t_cose_sign1_sign_merkle() with the configuration and the
+ * per-message state separate as in t_cose_sign1_signer_sign().
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_merkle(const struct t_cose_sign1_signer *signer,
+                                struct t_cose_sign1_sign_call    *call,
+                                const struct q_useful_buf_c      *payloads,
+                                size_t                            num_payloads,
+                                struct q_useful_buf               tree_buf,
+                                struct q_useful_buf               out_buf,
+                                struct t_cose_merkle_tree        *tree);
+
 
 
 
@@ -488,17 +1109,19 @@ t_cose_sign1_sign_init(struct t_cose_sign1_sign_ctx *me,
 {
     memset(me, 0, sizeof(*me));
 #ifndef T_COSE_DISABLE_CONTENT_TYPE
-    me->content_type_uint = T_COSE_EMPTY_UINT_CONTENT_TYPE;
+    me->signer.content_type_uint = T_COSE_EMPTY_UINT_CONTENT_TYPE;
 #endif
 
-    me->cose_algorithm_id = cose_algorithm_id;
-    me->option_flags      = option_flags;
+    /* The protected parameters are encoded for each message as the
+     * key and such can still be changed. */
+    me->signer.cose_algorithm_id = cose_algorithm_id;
+    me->signer.option_flags      = option_flags;
 
 #ifndef T_COSE_DISABLE_EDDSA
     /* Start with large (but NULL) auxiliary buffer. If EdDSA is used,
      * the Sig_Structure data will be serialized here.
      */
-    me->auxiliary_buffer.len = SIZE_MAX;
+    me->call.auxiliary_buffer.len = SIZE_MAX;
 #endif
 }
 
@@ -508,8 +1131,7 @@ t_cose_sign1_set_signing_key(struct t_cose_sign1_sign_ctx *me,
                              struct t_cose_key             signing_key,
                              struct q_useful_buf_c         kid)
 {
-    me->kid         = kid;
-    me->signing_key = signing_key;
+    t_cose_sign1_signer_set_signing_key(&me->signer, signing_key, kid);
 }
 
 static inline void
@@ -517,7 +1139,7 @@ t_cose_sign1_sign_set_auxiliary_buffer(struct t_cose_sign1_sign_ctx *me,
                                        struct q_useful_buf           auxiliary_buffer)
 {
 #ifndef T_COSE_DISABLE_EDDSA
-    me->auxiliary_buffer = auxiliary_buffer;
+    me->call.auxiliary_buffer = auxiliary_buffer;
 #else
     (void)me;
     (void)auxiliary_buffer;
@@ -528,7 +1150,7 @@ static inline size_t
 t_cose_sign1_sign_auxiliary_buffer_size(struct t_cose_sign1_sign_ctx *me)
 {
 #ifndef T_COSE_DISABLE_EDDSA
-    return me->auxiliary_buffer_size;
+    return me->call.auxiliary_buffer_size;
 #else
     /* If EdDSA is disabled we don't ever need an auxiliary buffer. */
     (void)me;
@@ -537,6 +1159,30 @@ t_cose_sign1_sign_auxiliary_buffer_size(struct t_cose_sign1_sign_ctx *me)
 }
 
 
+static inline void
+t_cose_sign1_signer_set_signing_key(struct t_cose_sign1_signer *me,
+                                    struct t_cose_key           signing_key,
+                                    struct q_useful_buf_c       kid)
+{
+    me->kid         = kid;
+    me->signing_key = signing_key;
+}
+
+
+static inline void
+t_cose_sign1_sign_call_init(struct t_cose_sign1_sign_call *me,
+                            struct q_useful_buf            auxiliary_buffer)
+{
+#ifndef T_COSE_DISABLE_EDDSA
+    me->auxiliary_buffer      = auxiliary_buffer;
+    me->auxiliary_buffer_size = 0;
+#else
+    me->unused = 0;
+    (void)auxiliary_buffer;
+#endif
+}
+
+
 /**
  * \brief Semi-private function that ouputs the COSE parameters, startng a
  *        \c COSE_Sign1 message.
@@ -624,6 +1270,71 @@ t_cose_sign1_sign_aad_internal(struct t_cose_sign1_sign_ctx *context,
                                struct q_useful_buf_c        *result);
 
 
+/**
+ * \brief Semi-private function that does a complete signing in one call
+ *        with a shared configuration.
+ *
+ * \param[in] signer               The signing configuration.
+ * \param[in,out] call             The state for this signing or \c NULL.
+ * \param[in] payload_is_detached  If \c true, then \c payload is detached.
+ * \param[in] payload              The payload, inline or detached.
+ * \param[in] aad                  The Additional Authenticated Data or
+ *                                 \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] out_buf              Pointer and length of buffer to output to.
+ * \param[out] result              Pointer and length of the resulting
+ *                                 \c COSE_Sign1.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is a private function internal to the implementation. Call
+ * t_cose_sign1_signer_sign() instead of this.
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_internal(const struct t_cose_sign1_signer *signer,
+                                  struct t_cose_sign1_sign_call    *call,
+                                  bool                              payload_is_detached,
+                                  struct q_useful_buf_c             payload,
+                                  struct q_useful_buf_c             aad,
+                                  struct q_useful_buf               out_buf,
+                                  struct q_useful_buf_c            *result);
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_signer_sign(const struct t_cose_sign1_signer *signer,
+                         struct t_cose_sign1_sign_call    *call,
+                         struct q_useful_buf_c             aad,
+                         struct q_useful_buf_c             payload,
+                         struct q_useful_buf               out_buf,
+                         struct q_useful_buf_c            *result)
+{
+    return t_cose_sign1_signer_sign_internal(signer,
+                                             call,
+                                             false,
+                                             payload,
+                                             aad,
+                                             out_buf,
+                                             result);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_signer_sign_detached(const struct t_cose_sign1_signer *signer,
+                                  struct t_cose_sign1_sign_call    *call,
+                                  struct q_useful_buf_c             aad,
+                                  struct q_useful_buf_c             detached_payload,
+                                  struct q_useful_buf               out_buf,
+                                  struct q_useful_buf_c            *result)
+{
+    return t_cose_sign1_signer_sign_internal(signer,
+                                             call,
+                                             true,
+                                             detached_payload,
+                                             aad,
+                                             out_buf,
+                                             result);
+}
+
+
 static inline enum t_cose_err_t
 t_cose_sign1_sign_aad(struct t_cose_sign1_sign_ctx *me,
                       struct q_useful_buf_c         aad,
@@ -694,23 +1405,64 @@ t_cose_sign1_encode_signature(struct t_cose_sign1_sign_ctx *me,
 }
 
 
+static inline enum t_cose_err_t
+t_cose_sign1_sign_reserved(struct t_cose_sign1_sign_ctx          *me,
+                           const struct t_cose_sign1_reservation *reservation,
+                           struct q_useful_buf_c                  aad,
+                           struct q_useful_buf_c                 *result)
+{
+    return t_cose_sign1_signer_sign_reserved(&me->signer,
+                                             &me->call,
+                                             reservation,
+                                             aad,
+                                             result);
+}
+
+
 #ifndef T_COSE_DISABLE_CONTENT_TYPE
 static inline void
 t_cose_sign1_set_content_type_uint(struct t_cose_sign1_sign_ctx *me,
                                    uint16_t                     content_type)
 {
-    me->content_type_uint = content_type;
+    me->signer.content_type_uint = content_type;
 }
 
 
 static inline void
 t_cose_sign1_set_content_type_tstr(struct t_cose_sign1_sign_ctx *me,
                                    const char                   *content_type)
+{
+    me->signer.content_type_tstr = content_type;
+}
+
+
+static inline void
+t_cose_sign1_signer_set_content_type_uint(struct t_cose_sign1_signer *me,
+                                          uint16_t                    content_type)
+{
+    me->content_type_uint = content_type;
+}
+
+
+static inline void
+t_cose_sign1_signer_set_content_type_tstr(struct t_cose_sign1_signer *me,
+                                          const char                 *content_type)
 {
     me->content_type_tstr = content_type;
 }
 #endif
 
+
+static inline void
+t_cose_sign1_set_hash_envelope(struct t_cose_sign1_sign_ctx *me,
+                               int32_t                       payload_hash_alg,
+                               const char                   *preimage_content_type)
+{
+    /* Encoded with the protected parameters for each message */
+    me->signer.payload_hash_alg      = payload_hash_alg;
+    me->signer.preimage_content_type = preimage_content_type;
+}
+
 #ifdef __cplusplus
 }
 #endif
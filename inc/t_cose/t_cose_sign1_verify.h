@@ -16,6 +16,7 @@
 #include <stdbool.h>
 #include "t_cose/q_useful_buf.h"
 #include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_cwt_claims.h"
 #include "qcbor/qcbor_common.h"
 
 #ifdef __cplusplus
@@ -99,6 +100,40 @@ struct t_cose_parameters {
      * present. Allowed range is 0 to UINT16_MAX per RFC 7252. */
     uint32_t              content_type_uint;
 #endif /* T_COSE_DISABLE_CONTENT_TYPE */
+
+    /** The hash algorithm of a hash envelope payload. \ref
+     * T_COSE_UNSET_ALGORITHM_ID if the message is not a hash
+     * envelope. */
+    int32_t               payload_hash_alg;
+
+    /** The content type of what was hashed for a hash envelope as a
+     * MIME type. \c NULL_Q_USEFUL_BUF_C if parameter is not present */
+    struct q_useful_buf_c preimage_content_type_tstr;
+
+    /** The content type of what was hashed for a hash envelope as a
+     * CoAP Content-Format integer. \ref T_COSE_EMPTY_UINT_CONTENT_TYPE
+     * if parameter is not present. */
+    uint32_t              preimage_content_type_uint;
+
+    /** The certificates of the x5chain parameter as they are in the
+     * message, from the start of the first to the end of the last
+     * with the CBOR byte string heads between them. Iterate over them
+     * with t_cose_x5chain_next_cert(). \c NULL_Q_USEFUL_BUF_C if
+     * parameter is not present. */
+    struct q_useful_buf_c x5chain;
+
+    /** The first certificate in the x5chain parameter, the one for
+     * the signing key. \c NULL_Q_USEFUL_BUF_C if parameter is not
+     * present. */
+    struct q_useful_buf_c x5chain_leaf;
+
+    /** The hash algorithm of the x5t parameter. \ref
+     * T_COSE_UNSET_ALGORITHM_ID if parameter is not present. */
+    int32_t               x5t_alg;
+
+    /** The hash of the certificate of the signing key from the x5t
+     * parameter. \c NULL_Q_USEFUL_BUF_C if parameter is not present. */
+    struct q_useful_buf_c x5t_hash;
 };
 
 
@@ -198,14 +233,173 @@ struct t_cose_parameters {
 
 
 /**
- * Context for signature verification.  It is about 80 bytes on a
- * 64-bit machine and 54 bytes on a 32-bit machine, or less if
- * certain features are disabled.
+ * An algorithm allowed by a \ref t_cose_sign1_policy.
  */
-struct t_cose_sign1_verify_ctx {
+struct t_cose_sign1_policy_alg {
+    int32_t cose_algorithm_id;
+    /* The exact size of the signature or 0 if it isn't checked. It
+     * is fixed by the algorithm for ECDSA and EdDSA, 64 for ES256
+     * for example, and by the key size for RSA. */
+    size_t  signature_size;
+};
+
+
+/**
+ * Limits on the messages to accept, checked while decoding so that
+ * junk is rejected before any hashing of the payload or use of the
+ * key. Set one up with t_cose_sign1_policy_init(), which sets no
+ * limits, then set the limits wanted and give it to
+ * t_cose_sign1_verify_set_policy().
+ *
+ * The checks run from cheapest to most expensive: the message size
+ * before decoding anything, the number of tags as they are decoded,
+ * the size of the protected header parameters before they are
+ * decoded, then the algorithm and signature size, the kid length
+ * and the payload size once the message is decoded.
+ *
+ * This is only read while verifying so one can be shared by any
+ * number of verification contexts and threads. It must stay valid
+ * for as long as it is in use.
+ */
+struct t_cose_sign1_policy {
+    /* Of the whole encoded COSE_Sign1, including any tags */
+    size_t                                max_message_size;
+    /* Of the encoded protected header parameters */
+    size_t                                max_protected_size;
+    /* Including a detached payload */
+    size_t                                max_payload_size;
+    /* All the tags on the message, including the COSE_Sign1 tag */
+    size_t                                max_tags;
+    /* The exact length of the kid or SIZE_MAX if it isn't checked */
+    size_t                                kid_size;
+    /* The algorithms allowed or NULL if any is allowed */
+    const struct t_cose_sign1_policy_alg *algorithms;
+    size_t                                num_algorithms;
+};
+
+
+/**
+ * The configuration for verifying \c COSE_Sign1 messages: the key
+ * and the options.
+ *
+ * Once set up with t_cose_sign1_verifier_init() and
+ * t_cose_sign1_verifier_set_verification_key(), it is only read while
+ * verifying, so one can be shared by any number of threads verifying
+ * at the same time with no copying or locking.
+ */
+struct t_cose_sign1_verifier {
+    /* Private data structure */
+    struct t_cose_key                 verification_key;
+    uint32_t                          option_flags;
+    const struct t_cose_sign1_policy *policy;
+};
+
+
+/**
+ * The largest encoded protected header parameters that a \ref
+ * t_cose_header_cache keeps. Larger ones are decoded every time. It
+ * sets the size of a \ref t_cose_header_cache_entry.
+ */
+#ifndef T_COSE_HEADER_CACHE_MAX_PROTECTED
+#define T_COSE_HEADER_CACHE_MAX_PROTECTED 64
+#endif
+
+
+/**
+ * The space in a \ref t_cose_header_cache_entry for the crypto
+ * adapter's hash context. If the adapter's context is larger the
+ * cache still saves decoding the protected header parameters, but
+ * the hash of them is redone every time. The OpenSSL adapter needs
+ * very little. The Brad Conte hashes need a little over 200 bytes
+ * with SHA-384 and SHA-512 enabled.
+ */
+#ifndef T_COSE_HEADER_CACHE_HASH_SIZE
+#define T_COSE_HEADER_CACHE_HASH_SIZE 256
+#endif
+
+
+/**
+ * One set of protected header parameters in a \ref
+ * t_cose_header_cache. This is about 440 bytes on a 64-bit machine
+ * with the default sizes.
+ */
+struct t_cose_header_cache_entry {
+    /* Private data structure */
+    uint8_t                  protected_parameters[T_COSE_HEADER_CACHE_MAX_PROTECTED];
+    /* 0 if the entry is unused */
+    size_t                   protected_len;
+    /* Decoded from protected_parameters and pointing into it */
+    struct t_cose_parameters parameters;
+    uint32_t                 last_used;
+    /* Set if hash_ctx has hashed the TBS bytes up to the payload */
+    bool                     has_hash;
+    uint64_t                 hash_ctx[T_COSE_HEADER_CACHE_HASH_SIZE / sizeof(uint64_t)];
+};
+
+
+/**
+ * A cache of decoded protected header parameters. Tokens from one
+ * issuer usually have byte-for-byte the same protected header
+ * parameters. With this, verifying them skips decoding the protected
+ * header parameters and hashing them into the to-be-signed bytes
+ * after the first time.
+ *
+ * Set one up with t_cose_header_cache_init() and give it to
+ * t_cose_sign1_verify_set_header_cache(). It is modified by every
+ * verification so, like the \ref t_cose_sign1_verify_call it is set
+ * on, each thread needs its own.
+ */
+struct t_cose_header_cache {
+    /* Private data structure */
+    struct t_cose_header_cache_entry *entries;
+    size_t                            num_entries;
+    uint32_t                          clock;
+};
+
+
+/**
+ * The largest signed Merkle root, a \c COSE_Sign1, that a \ref
+ * t_cose_receipt_cache keeps. One with ES512 and a short kid is
+ * about 220 bytes.
+ */
+#ifndef T_COSE_RECEIPT_CACHE_MAX_SIGNED_ROOT
+#define T_COSE_RECEIPT_CACHE_MAX_SIGNED_ROOT 256
+#endif
+
+
+/**
+ * The last signed Merkle root verified by
+ * t_cose_sign1_verify_receipt(). All the receipts from one call to
+ * t_cose_sign1_sign_merkle() have the same signed root, so with this
+ * its signature is verified once rather than for every receipt.
+ *
+ * Set one up with t_cose_receipt_cache_init() and give it to
+ * t_cose_sign1_verify_set_receipt_cache(). Like the \ref
+ * t_cose_sign1_verify_call it is set on, each thread needs its own.
+ * It is about 420 bytes on a 64-bit machine.
+ */
+struct t_cose_receipt_cache {
+    /* Private data structure */
+    uint8_t                           signed_root[T_COSE_RECEIPT_CACHE_MAX_SIGNED_ROOT];
+    /* 0 if nothing is cached */
+    size_t                            signed_root_len;
+    /* What it was verified with */
+    struct t_cose_key                 verification_key;
+    uint32_t                          option_flags;
+    const struct t_cose_sign1_policy *policy;
+    /* Decoded from signed_root and pointing into it */
+    struct t_cose_parameters          parameters;
+    struct q_useful_buf_c             root;
+};
+
+
+/**
+ * The state of one verification. It is small and is meant to be on
+ * the stack of the caller. It holds the tags of the message verified
+ * and, for EdDSA, the auxiliary buffer.
+ */
+struct t_cose_sign1_verify_call {
     /* Private data structure */
-    struct t_cose_key     verification_key;
-    uint32_t              option_flags;
     uint64_t              auTags[T_COSE_MAX_TAGS_TO_RETURN];
 
 #ifndef T_COSE_DISABLE_EDDSA
@@ -216,12 +410,34 @@ struct t_cose_sign1_verify_ctx {
      */
     struct q_useful_buf  auxiliary_buffer;
 
-    /* The size of the serialized Sig_Structure used in the last
+    /* The size of the serialized Sig_Structure used in the
      * verification. This can be used by the user to determine a
      * suitable auxiliary buffer size.
      */
     size_t               auxiliary_buffer_size;
 #endif
+
+    /* NULL if protected header parameters aren't cached */
+    struct t_cose_header_cache *header_cache;
+
+    /* NULL if signed Merkle roots aren't cached */
+    struct t_cose_receipt_cache *receipt_cache;
+};
+
+
+/**
+ * Context for signature verification.  It is about 80 bytes on a
+ * 64-bit machine and 54 bytes on a 32-bit machine.
+ *
+ * It is a \ref t_cose_sign1_verifier and a \ref
+ * t_cose_sign1_verify_call together. It is modified by every
+ * verification so each thread needs its own. Use those two directly
+ * to share one configuration.
+ */
+struct t_cose_sign1_verify_ctx {
+    /* Private data structure */
+    struct t_cose_sign1_verifier    verifier;
+    struct t_cose_sign1_verify_call call;
 };
 
 
@@ -264,7 +480,8 @@ t_cose_sign1_verify_init(struct t_cose_sign1_verify_ctx *context,
  * the kid will be returned in \c parameters. The caller finds the kid on
  * their own. Then call this to set the key. Last call
  * t_cose_sign1_verify(), again without the \ref T_COSE_OPT_DECODE_ONLY
- * option.
+ * option. Or, to decode only once, get the kid with
+ * t_cose_sign1_parse() and then call t_cose_sign1_verify_parsed().
  *
  * To use 2, the key is somehow determined without the kid and
  * t_cose_sign1_set_verification_key() is called with it. Then
@@ -339,6 +556,122 @@ t_cose_sign1_verify_set_auxiliary_buffer(struct t_cose_sign1_verify_ctx *context
 static size_t
 t_cose_sign1_verify_auxiliary_buffer_size(struct t_cose_sign1_verify_ctx *context);
 
+
+/**
+ * \brief Set up a verification policy that sets no limits.
+ *
+ * \param[out] policy  The policy to set up.
+ *
+ * Set the limits wanted in \c policy after this.
+ */
+static void
+t_cose_sign1_policy_init(struct t_cose_sign1_policy *policy);
+
+
+/**
+ * \brief Limit the messages that will be verified.
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in] policy       The limits or \c NULL for none.
+ *
+ * Messages outside the limits in \c policy are rejected with one of
+ * the \c T_COSE_ERR_POLICY_XXX errors, or \ref
+ * T_COSE_ERR_TOO_MANY_TAGS, as soon as decoding finds them. For a
+ * flood of junk this is much cheaper than hashing the payload and
+ * failing the signature check. See \ref t_cose_sign1_policy.
+ *
+ * The policy applies to t_cose_sign1_parse() and all the ways to
+ * verify, including with \ref T_COSE_OPT_DECODE_ONLY. \c policy is
+ * not copied.
+ */
+static void
+t_cose_sign1_verify_set_policy(struct t_cose_sign1_verify_ctx   *context,
+                               const struct t_cose_sign1_policy *policy);
+
+/**
+ * \brief Set up a cache of protected header parameters.
+ *
+ * \param[out] cache       The cache to set up.
+ * \param[in] entries      Storage for the entries.
+ * \param[in] num_entries  The number of entries in \c entries.
+ *
+ * A few entries are usually enough, one for each issuer that sends a
+ * lot of messages. When full, the least recently used entry is
+ * replaced. \c entries must stay valid as long as \c cache is in
+ * use.
+ */
+void
+t_cose_header_cache_init(struct t_cose_header_cache       *cache,
+                         struct t_cose_header_cache_entry *entries,
+                         size_t                            num_entries);
+
+
+/**
+ * \brief Empty a cache of protected header parameters.
+ *
+ * \param[in,out] cache  The cache to empty.
+ *
+ * This must be called before the cache goes away as some crypto
+ * adapters, OpenSSL for example, allocate memory for the saved hash
+ * state. The cache can be used again after this.
+ */
+void
+t_cose_header_cache_clear(struct t_cose_header_cache *cache);
+
+
+/**
+ * \brief Cache protected header parameters between verifications.
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in] cache        The cache or \c NULL for none.
+ *
+ * When the encoded protected header parameters of a message are in
+ * \c cache, the decoded parameters are copied from it rather than
+ * decoded again, and the hash of the to-be-signed bytes resumes from
+ * the saved state after the protected header parameters. The result
+ * of verifying is always the same as without the cache.
+ *
+ * Only protected header parameters of up to \ref
+ * T_COSE_HEADER_CACHE_MAX_PROTECTED bytes that have no critical
+ * parameters and no parameters t_cose doesn't know are cached. The
+ * others are decoded every time.
+ *
+ * This is for t_cose_sign1_verify() and the others that decode the
+ * message. t_cose_sign1_parse() doesn't use it, but the verification
+ * of a parsed message will use the saved hash state. Call it after
+ * t_cose_sign1_verify_init(). \c cache is not copied.
+ */
+static void
+t_cose_sign1_verify_set_header_cache(struct t_cose_sign1_verify_ctx *context,
+                                     struct t_cose_header_cache     *cache);
+
+
+/**
+ * \brief Set up an empty cache of signed Merkle roots.
+ *
+ * \param[out] cache  The cache to set up.
+ */
+static void
+t_cose_receipt_cache_init(struct t_cose_receipt_cache *cache);
+
+
+/**
+ * \brief Cache the signed Merkle root between receipt verifications.
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in] cache        The cache or \c NULL for none.
+ *
+ * When a receipt given to t_cose_sign1_verify_receipt() has
+ * byte-for-byte the signed root that was last verified with the same
+ * key, options and policy, its signature isn't verified again. Only
+ * the inclusion path is hashed. Call it after
+ * t_cose_sign1_verify_init(). \c cache is not copied.
+ */
+static void
+t_cose_sign1_verify_set_receipt_cache(struct t_cose_sign1_verify_ctx *context,
+                                      struct t_cose_receipt_cache    *cache);
+
+
 /**
  * \brief Verify a \c COSE_Sign1.
  *
@@ -462,6 +795,640 @@ t_cose_sign1_verify_detached(struct t_cose_sign1_verify_ctx *context,
                              struct t_cose_parameters       *parameters);
 
 
+/**
+ * One message for t_cose_sign1_verify_batch().
+ */
+struct t_cose_sign1_verify_batch_item {
+    /* Inputs */
+    struct q_useful_buf_c    cose_sign1;
+    struct q_useful_buf_c    aad;         /* NULL_Q_USEFUL_BUF_C if none */
+
+    /* Outputs */
+    struct q_useful_buf_c    payload;
+    struct t_cose_parameters parameters;
+    enum t_cose_err_t        err;
+};
+
+
+/**
+ * \brief Verify several \c COSE_Sign1 messages in one call.
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in,out] items    The messages to verify and where their
+ *                         results go.
+ * \param[in] num_items    The number of entries in \c items.
+ *
+ * \return \ref T_COSE_SUCCESS if every message verified, otherwise the
+ *         error of the first one that didn't.
+ *
+ * Each item gives the same result as calling t_cose_sign1_verify_aad()
+ * with \c context and the item's \c cose_sign1 and \c aad. The
+ * outcome for each is in its \c err, and \c payload and \c parameters
+ * are filled in only when \c err is \ref T_COSE_SUCCESS. One failing
+ * doesn't stop the others. All are verified with the key and options
+ * in \c context.
+ *
+ * This is for verifying many small messages. Up to \ref
+ * T_COSE_BATCH_GROUP_SIZE at a time are decoded, then their
+ * to-be-signed bytes are hashed together with
+ * t_cose_crypto_hash_batch(), which for crypto adapters with
+ * multi-buffer hashing runs them in parallel SIMD lanes. The public
+ * key operations still happen one at a time. Messages may use
+ * different algorithms; they are hashed in a batch per algorithm.
+ *
+ * Afterwards t_cose_sign1_get_nth_tag() gives the tags of the last
+ * message. Detached payloads are not supported.
+ *
+ * Stack use is higher than t_cose_sign1_verify(), several KB with
+ * the default \ref T_COSE_BATCH_GROUP_SIZE.
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_batch(struct t_cose_sign1_verify_ctx        *context,
+                          struct t_cose_sign1_verify_batch_item *items,
+                          size_t                                 num_items);
+
+
+/**
+ * A decoded \c COSE_Sign1 from t_cose_sign1_parse(). The byte strings
+ * point into the message, which must stay valid and unchanged as long
+ * as this is used. Nothing is copied. It is about 180 bytes on a
+ * 64-bit machine.
+ */
+struct t_cose_sign1_parsed {
+    /* The encoded protected header parameters, without the bstr head */
+    struct q_useful_buf_c    protected_parameters;
+    /* The protected and unprotected header parameters */
+    struct t_cose_parameters parameters;
+    /* NULL_Q_USEFUL_BUF_C if the payload is detached */
+    struct q_useful_buf_c    payload;
+    struct q_useful_buf_c    signature;
+    /* The unprocessed tags, as for t_cose_sign1_get_nth_tag() */
+    uint64_t                 auTags[T_COSE_MAX_TAGS_TO_RETURN];
+};
+
+
+/**
+ * \brief Decode a \c COSE_Sign1 without verifying it.
+ *
+ * \param[in] context      The t_cose signature verification context.
+ * \param[in] cose_sign1   Pointer and length of CBOR encoded \c COSE_Sign1.
+ * \param[out] parsed      The decoded message.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This decodes and checks a \c COSE_Sign1 exactly as
+ * t_cose_sign1_verify() does, including the tag, kid and critical
+ * parameter options in \c context, but doesn't check the signature.
+ * The header parameters, payload and tags can then be examined, for
+ * example to find the key by kid or to route the message, and then
+ * t_cose_sign1_verify_parsed() checks the signature without decoding
+ * the message again. This replaces verifying twice, once with \ref
+ * T_COSE_OPT_DECODE_ONLY.
+ *
+ * The payload may be attached or detached. If it is detached, \c
+ * payload in \c parsed is \c NULL_Q_USEFUL_BUF_C.
+ */
+static enum t_cose_err_t
+t_cose_sign1_parse(const struct t_cose_sign1_verify_ctx *context,
+                   struct q_useful_buf_c                 cose_sign1,
+                   struct t_cose_sign1_parsed           *parsed);
+
+
+/**
+ * \brief Verify the signature of a \c COSE_Sign1 from t_cose_sign1_parse().
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in] parsed       The message from t_cose_sign1_parse().
+ * \param[in] aad          The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This gives the same result as t_cose_sign1_verify_aad() on the
+ * message, but only the signature is checked. The key may be set on
+ * \c context after parsing. The payload must be attached; \ref
+ * T_COSE_ERR_SIGN1_FORMAT is returned if it isn't. The tags are not
+ * put in \c context; they are in \c parsed.
+ */
+static enum t_cose_err_t
+t_cose_sign1_verify_parsed(struct t_cose_sign1_verify_ctx   *context,
+                           const struct t_cose_sign1_parsed *parsed,
+                           struct q_useful_buf_c             aad);
+
+
+/**
+ * \brief Verify the signature of a \c COSE_Sign1 from t_cose_sign1_parse()
+ *        with a detached payload.
+ *
+ * This is t_cose_sign1_verify_parsed() for a detached payload, the
+ * same as t_cose_sign1_verify_detached(). \ref
+ * T_COSE_ERR_CBOR_FORMATTING is returned if the message has its
+ * payload attached.
+ */
+static enum t_cose_err_t
+t_cose_sign1_verify_parsed_detached(struct t_cose_sign1_verify_ctx   *context,
+                                    const struct t_cose_sign1_parsed *parsed,
+                                    struct q_useful_buf_c             aad,
+                                    struct q_useful_buf_c             detached_payload);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 from t_cose_sign1_parse() with the
+ *        first of several candidate keys that works.
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in] parsed       The message from t_cose_sign1_parse().
+ * \param[in] aad          The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] keys         The candidate verification keys.
+ * \param[in] num_keys     The number of keys in \c keys.
+ * \param[out] key_index   The index in \c keys of the key that
+ *                         verified or \c SIZE_MAX if no key was used.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is for messages without a kid and for key rotation, where any
+ * one of several keys may have made the signature. The to-be-signed
+ * hash, or for EdDSA the to-be-signed bytes, is computed once, then
+ * each key is tried in order until one verifies. That is a lot less
+ * work than verifying the whole message once per key when the
+ * payload is large.
+ *
+ * The algorithm comes from the message, so there is only one hash
+ * to compute no matter what the keys are. A key of the wrong type
+ * for the algorithm doesn't verify, the same as a key that doesn't
+ * match. \ref T_COSE_ERR_SIG_VERIFY is returned if no key verifies,
+ * including when \c num_keys is 0. Other errors from the crypto
+ * adapter stop the search and are returned.
+ *
+ * The key set on \c context is not used. Short-circuit signatures
+ * and \ref T_COSE_OPT_DECODE_ONLY are handled as for
+ * t_cose_sign1_verify_parsed() without using any key so \c
+ * key_index is \c SIZE_MAX for them. The payload must be attached.
+ */
+static enum t_cose_err_t
+t_cose_sign1_verify_parsed_any_key(struct t_cose_sign1_verify_ctx   *context,
+                                   const struct t_cose_sign1_parsed *parsed,
+                                   struct q_useful_buf_c             aad,
+                                   const struct t_cose_key          *keys,
+                                   size_t                            num_keys,
+                                   size_t                           *key_index);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 from t_cose_sign1_parse() with a
+ *        detached payload and the first of several candidate keys
+ *        that works.
+ *
+ * This is t_cose_sign1_verify_parsed_any_key() for a detached
+ * payload, with the same errors for the wrong kind of payload as
+ * t_cose_sign1_verify_parsed_detached().
+ */
+static enum t_cose_err_t
+t_cose_sign1_verify_parsed_any_key_detached(struct t_cose_sign1_verify_ctx   *context,
+                                            const struct t_cose_sign1_parsed *parsed,
+                                            struct q_useful_buf_c             aad,
+                                            struct q_useful_buf_c             detached_payload,
+                                            const struct t_cose_key          *keys,
+                                            size_t                            num_keys,
+                                            size_t                           *key_index);
+
+
+/**
+ * \brief Return unprocessed tags from a parsed message.
+ *
+ * \param[in] parsed  The message from t_cose_sign1_parse().
+ * \param[in] n       Index of the tag to return.
+ *
+ * \return  The tag value or \ref CBOR_TAG_INVALID64 if there is no tag
+ *          at the index or the index is too large.
+ *
+ * This is t_cose_sign1_get_nth_tag() for t_cose_sign1_parse().
+ */
+static uint64_t
+t_cose_sign1_parsed_nth_tag(const struct t_cose_sign1_parsed *parsed,
+                            size_t                            n);
+
+
+/**
+ * \brief Verify that a payload is in a signed Merkle tree.
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in] receipt      The receipt from t_cose_merkle_tree_receipt().
+ * \param[in] payload      The payload the receipt is for.
+ * \param[out] parameters  Place to return the parameters of the signed
+ *                         root. May be \c NULL.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * The signed root in the receipt is verified as t_cose_sign1_verify()
+ * would with \c context. Then the leaf hash of \c payload is hashed
+ * up the inclusion path as in RFC 9162 (section 2.1.3.2) and must
+ * come to the signed root. That is about log2(tree_size) hashes.
+ *
+ * With a cache set by t_cose_sign1_verify_set_receipt_cache() the
+ * signature is verified only for the first of the receipts from one
+ * tree, after which each is just the hashes.
+ *
+ * \ref T_COSE_ERR_SIG_VERIFY is returned if \c payload isn't the one
+ * in the tree at the receipt's index. \ref T_COSE_ERR_RECEIPT_FORMAT
+ * is returned if the receipt can't be decoded or the path is the
+ * wrong length for the index and tree size in it. Errors verifying
+ * the signed root are returned as they are.
+ *
+ * With \ref T_COSE_OPT_DECODE_ONLY the receipt and the signed root
+ * are decoded but nothing is verified and nothing is cached.
+ *
+ * The byte strings in \c parameters point into the receipt or into
+ * the cache. t_cose_sign1_get_nth_tag() gives the tags of the signed
+ * root only when it was not in the cache.
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_receipt(struct t_cose_sign1_verify_ctx *context,
+                            struct q_useful_buf_c           receipt,
+                            struct q_useful_buf_c           payload,
+                            struct t_cose_parameters       *parameters);
+
+
+/**
+ * \brief Verify a hash envelope against a hash of the payload.
+ *
+ * \param[in,out] context      The t_cose signature verification context.
+ * \param[in] sign1            Pointer and length of CBOR encoded \c
+ *                             COSE_Sign1 that is a hash envelope.
+ * \param[in] payload_hash_alg The hash algorithm \c payload_hash was
+ *                             made with, for example \ref
+ *                             T_COSE_ALGORITHM_SHA_256.
+ * \param[in] payload_hash     The hash of the payload, for example from
+ *                             t_cose_hash_files().
+ * \param[out] parameters      Place to return parsed parameters. May
+ *                             be \c NULL.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * A hash envelope, as made after t_cose_sign1_set_hash_envelope(),
+ * is a \c COSE_Sign1 whose payload is the hash of the real payload.
+ * This verifies it as t_cose_sign1_verify() does, then checks that it
+ * is a hash envelope for \c payload_hash_alg and that the signed hash
+ * is \c payload_hash. The time taken doesn't depend on the size of
+ * the real payload, only hashing it does.
+ *
+ * \ref T_COSE_ERR_PAYLOAD_HASH_ALG is returned if the message is not
+ * a hash envelope or its payload hash algorithm is different. \ref
+ * T_COSE_ERR_SIG_VERIFY is returned if the signed hash is not \c
+ * payload_hash. \ref T_COSE_ERR_BAD_CONTENT_TYPE is returned if it
+ * has a content type parameter, which a hash envelope must not have.
+ *
+ * When the hash algorithm isn't known ahead of time, verify with
+ * t_cose_sign1_verify(), take the algorithm from \c payload_hash_alg
+ * in the returned parameters, hash the real payload with it and
+ * compare the hash to the returned payload.
+ *
+ * The preimage content type, if any, is returned in \c parameters.
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_hash_envelope(struct t_cose_sign1_verify_ctx *context,
+                                  struct q_useful_buf_c           sign1,
+                                  int32_t                         payload_hash_alg,
+                                  struct q_useful_buf_c           payload_hash,
+                                  struct t_cose_parameters       *parameters);
+
+
+/**
+ * \brief Verify a CWT and check its claims.
+ *
+ * \param[in,out] context  The t_cose signature verification context.
+ * \param[in] cwt          Pointer and length of CBOR encoded \c
+ *                         COSE_Sign1 that is a CWT.
+ * \param[in] validation   What the claims must be.
+ * \param[out] claims      The standard claims. May be \c NULL.
+ * \param[out] parameters  Place to return parsed parameters. May be
+ *                         \c NULL.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This verifies \c cwt as t_cose_sign1_verify() does, then checks
+ * its payload with t_cose_cwt_validate(). With \ref
+ * T_COSE_CWT_CHECK_BEFORE_SIGNATURE in \c validation the claims are
+ * checked after the message is decoded but before the payload is
+ * hashed, so expired tokens and tokens for someone else cost no
+ * public key operation. Either way the claims map is decoded once.
+ * With \ref T_COSE_CWT_REQUIRE_EXP a CWT without \c exp is \ref
+ * T_COSE_ERR_CWT_MISSING_EXP.
+ *
+ * If \c validation has a replay cache, a CWT that passes everything
+ * else is checked against it and remembered last. It is \ref
+ * T_COSE_ERR_CWT_REPLAYED if its \c cti, or its payload if it has no
+ * \c cti, was accepted before. A CWT without \c exp is \ref
+ * T_COSE_ERR_CWT_MISSING_EXP as it can't be forgotten. A replay cache
+ * with \ref T_COSE_OPT_DECODE_ONLY or \ref
+ * T_COSE_OPT_ALLOW_SHORT_CIRCUIT is \ref T_COSE_ERR_INVALID_ARGUMENT
+ * as tokens that aren't really verified must not go in it.
+ *
+ * \c claims and \c parameters are only filled in if both the
+ * signature and the claims are good. The strings in \c claims point
+ * into \c cwt. The payload must be attached.
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_cwt(struct t_cose_sign1_verify_ctx     *context,
+                        struct q_useful_buf_c               cwt,
+                        const struct t_cose_cwt_validation *validation,
+                        struct t_cose_cwt_claims           *claims,
+                        struct t_cose_parameters           *parameters);
+
+
+/**
+ * \brief Set up a configuration for verifying \c COSE_Sign1 messages.
+ *
+ * \param[out] verifier      The configuration to set up.
+ * \param[in] option_flags   Options controlling the verification.
+ *
+ * This is the same as t_cose_sign1_verify_init(). After this and
+ * t_cose_sign1_verifier_set_verification_key(), \c verifier is only
+ * read, so it can be shared by all the threads that verify with it.
+ * The per-message state is in a \ref t_cose_sign1_verify_call that
+ * each caller has on its own stack.
+ */
+static void
+t_cose_sign1_verifier_init(struct t_cose_sign1_verifier *verifier,
+                           uint32_t                      option_flags);
+
+
+/**
+ * \brief Set key for \c COSE_Sign1 message verification.
+ *
+ * \param[in,out] verifier     The verification configuration.
+ * \param[in] verification_key The verification key to use.
+ *
+ * This is the same as t_cose_sign1_set_verification_key().
+ */
+static void
+t_cose_sign1_verifier_set_verification_key(struct t_cose_sign1_verifier *verifier,
+                                           struct t_cose_key             verification_key);
+
+
+/**
+ * \brief Limit the messages that will be verified with a shared
+ *        configuration.
+ *
+ * \param[in,out] verifier  The verification configuration.
+ * \param[in] policy        The limits or \c NULL for none.
+ *
+ * This is the same as t_cose_sign1_verify_set_policy().
+ */
+static void
+t_cose_sign1_verifier_set_policy(struct t_cose_sign1_verifier     *verifier,
+                                 const struct t_cose_sign1_policy *policy);
+
+
+/**
+ * \brief Set up the state for one verification.
+ *
+ * \param[out] call            The state to set up.
+ * \param[in] auxiliary_buffer The buffer to serialize the Sig_Structure
+ *                             in for EdDSA or \c NULL_Q_USEFUL_BUF.
+ *
+ * See t_cose_sign1_verify_set_auxiliary_buffer() for sizing. After a
+ * verification, \c auxiliary_buffer_size in \c call is the size used
+ * and t_cose_sign1_verify_call_nth_tag() gives the message's tags.
+ */
+static void
+t_cose_sign1_verify_call_init(struct t_cose_sign1_verify_call *call,
+                              struct q_useful_buf              auxiliary_buffer);
+
+
+/**
+ * \brief Cache protected header parameters between verifications
+ *        with a shared configuration.
+ *
+ * \param[in,out] call  The state for verifications.
+ * \param[in] cache     The cache or \c NULL for none.
+ *
+ * This is t_cose_sign1_verify_set_header_cache() for
+ * t_cose_sign1_verifier_verify(). Call it after
+ * t_cose_sign1_verify_call_init().
+ */
+static void
+t_cose_sign1_verify_call_set_header_cache(struct t_cose_sign1_verify_call *call,
+                                          struct t_cose_header_cache      *cache);
+
+
+/**
+ * \brief Cache the signed Merkle root between receipt verifications
+ *        with a shared configuration.
+ *
+ * \param[in,out] call  The state for verifications.
+ * \param[in] cache     The cache or \c NULL for none.
+ *
+ * This is t_cose_sign1_verify_set_receipt_cache() for
+ * t_cose_sign1_verifier_verify_receipt(). Call it after
+ * t_cose_sign1_verify_call_init().
+ */
+static void
+t_cose_sign1_verify_call_set_receipt_cache(struct t_cose_sign1_verify_call *call,
+                                           struct t_cose_receipt_cache     *cache);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 with a shared configuration.
+ *
+ * \param[in] verifier     The verification configuration.
+ * \param[in,out] call     The state for this verification or \c NULL.
+ * \param[in] cose_sign1   Pointer and length of CBOR encoded \c COSE_Sign1
+ *                         message that is to be verified.
+ * \param[in] aad          The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[out] payload     Pointer and length of the payload.
+ * \param[out] parameters  Place to return parsed parameters. May be \c NULL.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is t_cose_sign1_verify_aad() with the configuration and the
+ * per-message state separate. \c verifier is not modified, so any
+ * number of threads can call this at once with the same one. \c call
+ * is needed for EdDSA and to get the tags; it may be \c NULL
+ * otherwise.
+ */
+static enum t_cose_err_t
+t_cose_sign1_verifier_verify(const struct t_cose_sign1_verifier *verifier,
+                             struct t_cose_sign1_verify_call    *call,
+                             struct q_useful_buf_c               cose_sign1,
+                             struct q_useful_buf_c               aad,
+                             struct q_useful_buf_c              *payload,
+                             struct t_cose_parameters           *parameters);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 with detached payload and a shared
+ *        configuration.
+ *
+ * This is t_cose_sign1_verify_detached() with the configuration and
+ * the per-message state separate as in t_cose_sign1_verifier_verify().
+ */
+static enum t_cose_err_t
+t_cose_sign1_verifier_verify_detached(const struct t_cose_sign1_verifier *verifier,
+                                      struct t_cose_sign1_verify_call    *call,
+                                      struct q_useful_buf_c               cose_sign1,
+                                      struct q_useful_buf_c               aad,
+                                      struct q_useful_buf_c               detached_payload,
+                                      struct t_cose_parameters           *parameters);
+
+
+/**
+ * \brief Verify several \c COSE_Sign1 messages with a shared
+ *        configuration.
+ *
+ * This is t_cose_sign1_verify_batch() with the configuration and the
+ * per-message state separate as in t_cose_sign1_verifier_verify().
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_batch(const struct t_cose_sign1_verifier    *verifier,
+                                   struct t_cose_sign1_verify_call       *call,
+                                   struct t_cose_sign1_verify_batch_item *items,
+                                   size_t                                 num_items);
+
+
+/**
+ * \brief Verify that a payload is in a signed Merkle tree with a
+ *        shared configuration.
+ *
+ * This is t_cose_sign1_verify_receipt() with the configuration and
+ * the per-message state separate as in t_cose_sign1_verifier_verify().
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_receipt(const struct t_cose_sign1_verifier *verifier,
+                                     struct t_cose_sign1_verify_call    *call,
+                                     struct q_useful_buf_c               receipt,
+                                     struct q_useful_buf_c               payload,
+                                     struct t_cose_parameters           *parameters);
+
+
+/**
+ * \brief Verify a hash envelope with a shared configuration.
+ *
+ * This is t_cose_sign1_verify_hash_envelope() with the configuration
+ * and the per-message state separate as in
+ * t_cose_sign1_verifier_verify().
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_hash_envelope(const struct t_cose_sign1_verifier *verifier,
+                                           struct t_cose_sign1_verify_call    *call,
+                                           struct q_useful_buf_c               sign1,
+                                           int32_t                             payload_hash_alg,
+                                           struct q_useful_buf_c               payload_hash,
+                                           struct t_cose_parameters           *parameters);
+
+
+/**
+ * \brief Verify a CWT and check its claims with a shared configuration.
+ *
+ * This is t_cose_sign1_verify_cwt() with the configuration and the
+ * per-message state separate as in t_cose_sign1_verifier_verify().
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_cwt(const struct t_cose_sign1_verifier *verifier,
+                                 struct t_cose_sign1_verify_call    *call,
+                                 struct q_useful_buf_c               cwt,
+                                 const struct t_cose_cwt_validation *validation,
+                                 struct t_cose_cwt_claims           *claims,
+                                 struct t_cose_parameters           *parameters);
+
+
+/**
+ * \brief Decode a \c COSE_Sign1 without verifying it with a shared
+ *        configuration.
+ *
+ * This is t_cose_sign1_parse() with the configuration separate as in
+ * t_cose_sign1_verifier_verify().
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_parse(const struct t_cose_sign1_verifier *verifier,
+                            struct q_useful_buf_c               cose_sign1,
+                            struct t_cose_sign1_parsed         *parsed);
+
+
+/**
+ * \brief Verify the signature of a parsed \c COSE_Sign1 with a shared
+ *        configuration.
+ *
+ * This is t_cose_sign1_verify_parsed() with the configuration and the
+ * per-message state separate as in t_cose_sign1_verifier_verify().
+ */
+static enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed(const struct t_cose_sign1_verifier *verifier,
+                                    struct t_cose_sign1_verify_call    *call,
+                                    const struct t_cose_sign1_parsed   *parsed,
+                                    struct q_useful_buf_c               aad);
+
+
+/**
+ * \brief Verify the signature of a parsed \c COSE_Sign1 with a detached
+ *        payload and a shared configuration.
+ *
+ * This is t_cose_sign1_verify_parsed_detached() with the
+ * configuration and the per-message state separate as in
+ * t_cose_sign1_verifier_verify().
+ */
+static enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_detached(const struct t_cose_sign1_verifier *verifier,
+                                             struct t_cose_sign1_verify_call    *call,
+                                             const struct t_cose_sign1_parsed   *parsed,
+                                             struct q_useful_buf_c               aad,
+                                             struct q_useful_buf_c               detached_payload);
+
+
+/**
+ * \brief Verify a parsed \c COSE_Sign1 with the first of several
+ *        candidate keys that works and a shared configuration.
+ *
+ * This is t_cose_sign1_verify_parsed_any_key() with the
+ * configuration and the per-message state separate as in
+ * t_cose_sign1_verifier_verify(). The key in \c verifier is not
+ * used.
+ */
+static enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_any_key(const struct t_cose_sign1_verifier *verifier,
+                                            struct t_cose_sign1_verify_call    *call,
+                                            const struct t_cose_sign1_parsed   *parsed,
+                                            struct q_useful_buf_c               aad,
+                                            const struct t_cose_key            *keys,
+                                            size_t                              num_keys,
+                                            size_t                             *key_index);
+
+
+/**
+ * \brief Verify a parsed \c COSE_Sign1 with a detached payload, the
+ *        first of several candidate keys that works and a shared
+ *        configuration.
+ *
+ * This is t_cose_sign1_verify_parsed_any_key_detached() with the
+ * configuration and the per-message state separate as in
+ * t_cose_sign1_verifier_verify().
+ */
+static enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_any_key_detached(const struct t_cose_sign1_verifier *verifier,
+                                                     struct t_cose_sign1_verify_call    *call,
+                                                     const struct t_cose_sign1_parsed   *parsed,
+                                                     struct q_useful_buf_c               aad,
+                                                     struct q_useful_buf_c               detached_payload,
+                                                     const struct t_cose_key            *keys,
+                                                     size_t                              num_keys,
+                                                     size_t                             *key_index);
+
+
+/**
+ * \brief Return unprocessed tags from a verification.
+ *
+ * \param[in] call  The state of a verification.
+ * \param[in] n     Index of the tag to return.
+ *
+ * \return  The tag value or \ref CBOR_TAG_INVALID64 if there is no tag
+ *          at the index or the index is too large.
+ *
+ * This is t_cose_sign1_get_nth_tag() for t_cose_sign1_verifier_verify().
+ */
+static uint64_t
+t_cose_sign1_verify_call_nth_tag(const struct t_cose_sign1_verify_call *call,
+                                 size_t                                 n);
+
+
 /**
  * \brief Return unprocessed tags from most recent signature verify.
  *
@@ -494,15 +1461,12 @@ static inline void
 t_cose_sign1_verify_init(struct t_cose_sign1_verify_ctx *me,
                          uint32_t                        option_flags)
 {
-    memset(me, 0, sizeof(*me));
-    me->option_flags = option_flags;
+    t_cose_sign1_verifier_init(&me->verifier, option_flags);
 
-#ifndef T_COSE_DISABLE_EDDSA
     /* Start with large (but NULL) auxiliary buffer. If EdDSA is used,
      * the Sig_Structure data will be serialized here.
      */
-    me->auxiliary_buffer.len = SIZE_MAX;
-#endif
+    t_cose_sign1_verify_call_init(&me->call, (struct q_useful_buf){NULL, SIZE_MAX});
 }
 
 
@@ -510,7 +1474,7 @@ static inline void
 t_cose_sign1_set_verification_key(struct t_cose_sign1_verify_ctx *me,
                                   struct t_cose_key               verification_key)
 {
-    me->verification_key = verification_key;
+    me->verifier.verification_key = verification_key;
 }
 
 static inline void
@@ -518,7 +1482,7 @@ t_cose_sign1_verify_set_auxiliary_buffer(struct t_cose_sign1_verify_ctx *me,
                                          struct q_useful_buf             auxiliary_buffer)
 {
 #ifndef T_COSE_DISABLE_EDDSA
-    me->auxiliary_buffer = auxiliary_buffer;
+    me->call.auxiliary_buffer = auxiliary_buffer;
 #else
     (void)me;
     (void)auxiliary_buffer;
@@ -529,7 +1493,7 @@ static inline size_t
 t_cose_sign1_verify_auxiliary_buffer_size(struct t_cose_sign1_verify_ctx *me)
 {
 #ifndef T_COSE_DISABLE_EDDSA
-    return me->auxiliary_buffer_size;
+    return me->call.auxiliary_buffer_size;
 #else
     /* If EdDSA is disabled we don't ever need an auxiliary buffer. */
     (void)me;
@@ -538,14 +1502,120 @@ t_cose_sign1_verify_auxiliary_buffer_size(struct t_cose_sign1_verify_ctx *me)
 }
 
 
+static inline void
+t_cose_sign1_policy_init(struct t_cose_sign1_policy *me)
+{
+    me->max_message_size   = SIZE_MAX;
+    me->max_protected_size = SIZE_MAX;
+    me->max_payload_size   = SIZE_MAX;
+    me->max_tags           = SIZE_MAX;
+    me->kid_size           = SIZE_MAX;
+    me->algorithms         = NULL;
+    me->num_algorithms     = 0;
+}
+
+
+static inline void
+t_cose_sign1_verify_set_policy(struct t_cose_sign1_verify_ctx   *me,
+                               const struct t_cose_sign1_policy *policy)
+{
+    t_cose_sign1_verifier_set_policy(&me->verifier, policy);
+}
+
+
+static inline void
+t_cose_sign1_verify_set_header_cache(struct t_cose_sign1_verify_ctx *me,
+                                     struct t_cose_header_cache     *cache)
+{
+    t_cose_sign1_verify_call_set_header_cache(&me->call, cache);
+}
+
+
+static inline void
+t_cose_receipt_cache_init(struct t_cose_receipt_cache *me)
+{
+    me->signed_root_len = 0;
+}
+
+
+static inline void
+t_cose_sign1_verify_set_receipt_cache(struct t_cose_sign1_verify_ctx *me,
+                                      struct t_cose_receipt_cache    *cache)
+{
+    t_cose_sign1_verify_call_set_receipt_cache(&me->call, cache);
+}
+
+
 static inline uint64_t
 t_cose_sign1_get_nth_tag(const struct t_cose_sign1_verify_ctx *context,
                          size_t                                n)
+{
+    return t_cose_sign1_verify_call_nth_tag(&context->call, n);
+}
+
+
+static inline void
+t_cose_sign1_verifier_init(struct t_cose_sign1_verifier *me,
+                           uint32_t                      option_flags)
+{
+    memset(me, 0, sizeof(*me));
+    me->option_flags = option_flags;
+}
+
+
+static inline void
+t_cose_sign1_verifier_set_verification_key(struct t_cose_sign1_verifier *me,
+                                           struct t_cose_key             verification_key)
+{
+    me->verification_key = verification_key;
+}
+
+
+static inline void
+t_cose_sign1_verifier_set_policy(struct t_cose_sign1_verifier     *me,
+                                 const struct t_cose_sign1_policy *policy)
+{
+    me->policy = policy;
+}
+
+
+static inline void
+t_cose_sign1_verify_call_init(struct t_cose_sign1_verify_call *me,
+                              struct q_useful_buf              auxiliary_buffer)
+{
+    memset(me, 0, sizeof(*me));
+#ifndef T_COSE_DISABLE_EDDSA
+    me->auxiliary_buffer = auxiliary_buffer;
+#else
+    (void)auxiliary_buffer;
+#endif
+}
+
+
+static inline void
+t_cose_sign1_verify_call_set_header_cache(struct t_cose_sign1_verify_call *me,
+                                          struct t_cose_header_cache      *cache)
+{
+    me->header_cache = cache;
+}
+
+
+static inline void
+t_cose_sign1_verify_call_set_receipt_cache(struct t_cose_sign1_verify_call *me,
+                                           struct t_cose_receipt_cache     *cache)
+{
+    me->receipt_cache = cache;
+}
+
+
+static inline uint64_t
+t_cose_sign1_verify_call_nth_tag(const struct t_cose_sign1_verify_call *me,
+                                 size_t                                 n)
 {
     if(n > T_COSE_MAX_TAGS_TO_RETURN) {
         return CBOR_TAG_INVALID64;
     }
-    return context->auTags[n];
+    return me->auTags[n];
 }
 
 
@@ -576,6 +1646,36 @@ t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
                              bool                            is_detached);
 
 
+/**
+ * \brief Semi-private function to verify a COSE_Sign1 with a shared
+ *        configuration.
+ *
+ * \param[in] verifier      The verification configuration.
+ * \param[in,out] call      The state for this verification or \c NULL.
+ * \param[in] sign1         Pointer and length of CBOR encoded \c COSE_Sign1
+ *                          message that is to be verified.
+ * \param[in] aad           The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in,out] payload   Pointer and length of the payload.
+ * \param[out] parameters   Place to return parsed parameters. May be \c NULL.
+ * \param[in] is_detached   Indicates the payload is detached.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This does the work for t_cose_sign1_verifier_verify() and
+ * t_cose_sign1_verifier_verify_detached(). It is a semi-private
+ * function which means its interface isn't guaranteed so it should
+ * not to call it directly.
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_internal(const struct t_cose_sign1_verifier *verifier,
+                                      struct t_cose_sign1_verify_call    *call,
+                                      struct q_useful_buf_c               sign1,
+                                      struct q_useful_buf_c               aad,
+                                      struct q_useful_buf_c              *payload,
+                                      struct t_cose_parameters           *parameters,
+                                      bool                                is_detached);
+
+
 static inline enum t_cose_err_t
 t_cose_sign1_verify(struct t_cose_sign1_verify_ctx *me,
                     struct q_useful_buf_c           sign1,
@@ -622,6 +1722,254 @@ t_cose_sign1_verify_detached(struct t_cose_sign1_verify_ctx *me,
                                          true);
 }
 
+
+static inline enum t_cose_err_t
+t_cose_sign1_verifier_verify(const struct t_cose_sign1_verifier *verifier,
+                             struct t_cose_sign1_verify_call    *call,
+                             struct q_useful_buf_c               cose_sign1,
+                             struct q_useful_buf_c               aad,
+                             struct q_useful_buf_c              *payload,
+                             struct t_cose_parameters           *parameters)
+{
+    return t_cose_sign1_verifier_verify_internal(verifier,
+                                                 call,
+                                                 cose_sign1,
+                                                 aad,
+                                                 payload,
+                                                 parameters,
+                                                 false);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verifier_verify_detached(const struct t_cose_sign1_verifier *verifier,
+                                      struct t_cose_sign1_verify_call    *call,
+                                      struct q_useful_buf_c               cose_sign1,
+                                      struct q_useful_buf_c               aad,
+                                      struct q_useful_buf_c               detached_payload,
+                                      struct t_cose_parameters           *parameters)
+{
+    return t_cose_sign1_verifier_verify_internal(verifier,
+                                                 call,
+                                                 cose_sign1,
+                                                 aad,
+                                                 &detached_payload,
+                                                 parameters,
+                                                 true);
+}
+
+
+/**
+ * \brief Semi-private function to verify the signature of a parsed
+ *        COSE_Sign1.
+ *
+ * \param[in] verifier         The verification configuration.
+ * \param[in,out] call         The state for this verification or \c NULL.
+ * \param[in] parsed           The message from t_cose_sign1_parse().
+ * \param[in] aad              The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] detached_payload The detached payload or \c NULL_Q_USEFUL_BUF_C
+ *                             if it is attached.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This does the work for t_cose_sign1_verify_parsed() and the like.
+ * It is a semi-private function which means its interface isn't
+ * guaranteed so it should not to call it directly.
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_internal(const struct t_cose_sign1_verifier *verifier,
+                                             struct t_cose_sign1_verify_call    *call,
+                                             const struct t_cose_sign1_parsed   *parsed,
+                                             struct q_useful_buf_c               aad,
+                                             struct q_useful_buf_c               detached_payload);
+
+
+/**
+ * \brief Semi-private function to verify the signature of a parsed
+ *        COSE_Sign1 with the first of several candidate keys.
+ *
+ * \param[in] verifier         The verification configuration.
+ * \param[in,out] call         The state for this verification or \c NULL.
+ * \param[in] parsed           The message from t_cose_sign1_parse().
+ * \param[in] aad              The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] detached_payload The detached payload or \c NULL_Q_USEFUL_BUF_C
+ *                             if it is attached.
+ * \param[in] keys             The candidate verification keys.
+ * \param[in] num_keys         The number of keys in \c keys.
+ * \param[out] key_index       The index of the key that verified.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This does the work for t_cose_sign1_verify_parsed_any_key() and the
+ * like. It is a semi-private function which means its interface
+ * isn't guaranteed so it should not to call it directly.
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_any_key_internal(const struct t_cose_sign1_verifier *verifier,
+                                              struct t_cose_sign1_verify_call    *call,
+                                              const struct t_cose_sign1_parsed   *parsed,
+                                              struct q_useful_buf_c               aad,
+                                              struct q_useful_buf_c               detached_payload,
+                                              const struct t_cose_key            *keys,
+                                              size_t                              num_keys,
+                                              size_t                             *key_index);
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_parse(const struct t_cose_sign1_verify_ctx *me,
+                   struct q_useful_buf_c                 cose_sign1,
+                   struct t_cose_sign1_parsed           *parsed)
+{
+    return t_cose_sign1_verifier_parse(&me->verifier, cose_sign1, parsed);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verify_parsed(struct t_cose_sign1_verify_ctx   *me,
+                           const struct t_cose_sign1_parsed *parsed,
+                           struct q_useful_buf_c             aad)
+{
+    return t_cose_sign1_verifier_verify_parsed_internal(&me->verifier,
+                                                        &me->call,
+                                                        parsed,
+                                                        aad,
+                                                        NULL_Q_USEFUL_BUF_C);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verify_parsed_detached(struct t_cose_sign1_verify_ctx   *me,
+                                    const struct t_cose_sign1_parsed *parsed,
+                                    struct q_useful_buf_c             aad,
+                                    struct q_useful_buf_c             detached_payload)
+{
+    return t_cose_sign1_verifier_verify_parsed_internal(&me->verifier,
+                                                        &me->call,
+                                                        parsed,
+                                                        aad,
+                                                        detached_payload);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed(const struct t_cose_sign1_verifier *verifier,
+                                    struct t_cose_sign1_verify_call    *call,
+                                    const struct t_cose_sign1_parsed   *parsed,
+                                    struct q_useful_buf_c               aad)
+{
+    return t_cose_sign1_verifier_verify_parsed_internal(verifier,
+                                                        call,
+                                                        parsed,
+                                                        aad,
+                                                        NULL_Q_USEFUL_BUF_C);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_detached(const struct t_cose_sign1_verifier *verifier,
+                                             struct t_cose_sign1_verify_call    *call,
+                                             const struct t_cose_sign1_parsed   *parsed,
+                                             struct q_useful_buf_c               aad,
+                                             struct q_useful_buf_c               detached_payload)
+{
+    return t_cose_sign1_verifier_verify_parsed_internal(verifier,
+                                                        call,
+                                                        parsed,
+                                                        aad,
+                                                        detached_payload);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verify_parsed_any_key(struct t_cose_sign1_verify_ctx   *me,
+                                   const struct t_cose_sign1_parsed *parsed,
+                                   struct q_useful_buf_c             aad,
+                                   const struct t_cose_key          *keys,
+                                   size_t                            num_keys,
+                                   size_t                           *key_index)
+{
+    return t_cose_sign1_verifier_verify_any_key_internal(&me->verifier,
+                                                         &me->call,
+                                                         parsed,
+                                                         aad,
+                                                         NULL_Q_USEFUL_BUF_C,
+                                                         keys,
+                                                         num_keys,
+                                                         key_index);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verify_parsed_any_key_detached(struct t_cose_sign1_verify_ctx   *me,
+                                            const struct t_cose_sign1_parsed *parsed,
+                                            struct q_useful_buf_c             aad,
+                                            struct q_useful_buf_c             detached_payload,
+                                            const struct t_cose_key          *keys,
+                                            size_t                            num_keys,
+                                            size_t                           *key_index)
+{
+    return t_cose_sign1_verifier_verify_any_key_internal(&me->verifier,
+                                                         &me->call,
+                                                         parsed,
+                                                         aad,
+                                                         detached_payload,
+                                                         keys,
+                                                         num_keys,
+                                                         key_index);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_any_key(const struct t_cose_sign1_verifier *verifier,
+                                            struct t_cose_sign1_verify_call    *call,
+                                            const struct t_cose_sign1_parsed   *parsed,
+                                            struct q_useful_buf_c               aad,
+                                            const struct t_cose_key            *keys,
+                                            size_t                              num_keys,
+                                            size_t                             *key_index)
+{
+    return t_cose_sign1_verifier_verify_any_key_internal(verifier,
+                                                         call,
+                                                         parsed,
+                                                         aad,
+                                                         NULL_Q_USEFUL_BUF_C,
+                                                         keys,
+                                                         num_keys,
+                                                         key_index);
+}
+
+
+static inline enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_any_key_detached(const struct t_cose_sign1_verifier *verifier,
+                                                     struct t_cose_sign1_verify_call    *call,
+                                                     const struct t_cose_sign1_parsed   *parsed,
+                                                     struct q_useful_buf_c               aad,
+                                                     struct q_useful_buf_c               detached_payload,
+                                                     const struct t_cose_key            *keys,
+                                                     size_t                              num_keys,
+                                                     size_t                             *key_index)
+{
+    return t_cose_sign1_verifier_verify_any_key_internal(verifier,
+                                                         call,
+                                                         parsed,
+                                                         aad,
+                                                         detached_payload,
+                                                         keys,
+                                                         num_keys,
+                                                         key_index);
+}
+
+
+static inline uint64_t
+t_cose_sign1_parsed_nth_tag(const struct t_cose_sign1_parsed *me,
+                            size_t                            n)
+{
+    if(n >= T_COSE_MAX_TAGS_TO_RETURN) {
+        return CBOR_TAG_INVALID64;
+    }
+    return me->auTags[n];
+}
+
 #ifdef __cplusplus
 }
 #endif
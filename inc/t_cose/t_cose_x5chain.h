@@ -0,0 +1,224 @@
+/*
+ *  t_cose_x5chain.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+
+#ifndef __T_COSE_X5CHAIN_H__
+#define __T_COSE_X5CHAIN_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_verify.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} /* Keep editor indention formatting happy */
+#endif
+#endif
+
+
+/**
+ * \file t_cose_x5chain.h
+ *
+ * \brief Verify a \c COSE_Sign1 with the key from its certificate chain.
+ *
+ * A message may carry the certificate of its signing key and the
+ * certificates up to a trust anchor in the x5chain parameter, or
+ * only the hash of the signing key's certificate in the x5t
+ * parameter, as in RFC 9360. Parsing the certificates and validating
+ * the chain costs far more than verifying the signature, and tokens
+ * from one device have the same chain every time. So validated chains
+ * are kept in a \ref t_cose_x5chain_cache, keyed by the SHA-256 of
+ * the certificates as they are in the message, with the public key
+ * of the leaf certificate. A repeat chain goes straight to signature
+ * verification without any X.509 parsing:
+ *
+ *     t_cose_x5chain_cache_init(&cache, entries, 16, &root, 1);
+ *     t_cose_sign1_verify_init(&verify_ctx, 0);
+ *     t_cose_sign1_verify_x5chain(&verify_ctx, &cache, token,
+ *                                 NULL_Q_USEFUL_BUF_C, &payload, &parameters);
+ *
+ * A message with only x5t is verified with the key of a chain in the
+ * cache whose leaf has that SHA-256.
+ *
+ * Chain validation is done by the crypto adapter. Only the OpenSSL
+ * adapter has it; the others give \ref T_COSE_ERR_X5CHAIN_UNSUPPORTED.
+ */
+
+
+/**
+ * The most certificates in an x5chain parameter that are validated.
+ */
+#ifndef T_COSE_X5CHAIN_MAX_CERTS
+#define T_COSE_X5CHAIN_MAX_CERTS 8
+#endif
+
+
+/**
+ * One validated chain in a \ref t_cose_x5chain_cache.
+ */
+struct t_cose_x5chain_cache_entry {
+    /* Private data structure */
+    /* SHA-256 of the certificates as they are in the message */
+    uint8_t           chain_hash[32];
+    /* SHA-256 of the leaf certificate, as in x5t */
+    uint8_t           leaf_hash[32];
+    /* From the leaf certificate and owned by the entry */
+    struct t_cose_key leaf_key;
+    /* When every certificate in the chain is valid */
+    int64_t           not_before;
+    int64_t           not_after;
+    /* 0 if the entry is unused */
+    uint32_t          last_used;
+};
+
+
+/**
+ * Certificate chains that have been validated and the trust anchors
+ * they were validated to. Set one up with
+ * t_cose_x5chain_cache_init() and free it with
+ * t_cose_x5chain_cache_free().
+ *
+ * The least recently used chain is replaced when it is full. It is
+ * modified by every verification so each thread needs its own.
+ */
+struct t_cose_x5chain_cache {
+    /* Private data structure except for clock and clock_ctx */
+    struct t_cose_x5chain_cache_entry *entries;
+    size_t                             num_entries;
+    uint32_t                           counter;
+    /* The trust anchors as the crypto adapter keeps them */
+    void                              *trust;
+    /* Returns the time in seconds since 1970 or NULL for time() */
+    int64_t                          (*clock)(void *clock_ctx);
+    void                              *clock_ctx;
+};
+
+
+/**
+ * \brief Set up a cache of validated certificate chains.
+ *
+ * \param[out] cache         The cache.
+ * \param[in] entries        Storage for the chains.
+ * \param[in] num_entries    The number of \c entries. At least one.
+ * \param[in] trust_anchors  The DER certificates chains must lead to.
+ * \param[in] num_anchors    The number of \c trust_anchors.
+ *
+ * \retval T_COSE_SUCCESS
+ * \retval T_COSE_ERR_TOO_SMALL
+ *         \c num_entries is 0.
+ * \retval T_COSE_ERR_X5CHAIN_INVALID
+ *         A trust anchor can't be parsed.
+ * \retval T_COSE_ERR_X5CHAIN_UNSUPPORTED
+ *         The crypto adapter can't validate certificate chains.
+ *
+ * The trust anchors are parsed here and don't have to stay in
+ * memory. Validation is against the system clock; set \c clock and
+ * \c clock_ctx for another one.
+ */
+enum t_cose_err_t
+t_cose_x5chain_cache_init(struct t_cose_x5chain_cache       *cache,
+                          struct t_cose_x5chain_cache_entry *entries,
+                          size_t                             num_entries,
+                          const struct q_useful_buf_c       *trust_anchors,
+                          size_t                             num_anchors);
+
+
+/**
+ * \brief Release the keys and trust anchors of a cache.
+ *
+ * \param[in,out] cache  The cache.
+ *
+ * This must be called when done with the cache as the crypto adapter
+ * may have allocated them. Calling it on a cache whose init failed is
+ * allowed.
+ */
+void
+t_cose_x5chain_cache_free(struct t_cose_x5chain_cache *cache);
+
+
+/**
+ * \brief Get the next certificate of an x5chain parameter.
+ *
+ * \param[in] parameters  The parameters of a message.
+ * \param[in] previous    The previous certificate or \c NULL_Q_USEFUL_BUF_C
+ *                        for the first.
+ *
+ * \return The certificate or \c NULL_Q_USEFUL_BUF_C after the last one.
+ *
+ * The first certificate is the one for the signing key, the same as
+ * \c x5chain_leaf in \ref t_cose_parameters.
+ */
+struct q_useful_buf_c
+t_cose_x5chain_next_cert(const struct t_cose_parameters *parameters,
+                         struct q_useful_buf_c           previous);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 with the key from its certificate chain.
+ *
+ * \param[in,out] context   The verification context. Its key is not used.
+ * \param[in,out] cache     The validated chains and trust anchors.
+ * \param[in] cose_sign1    The message.
+ * \param[in] aad           The Additional Authenticated Data or
+ *                          \c NULL_Q_USEFUL_BUF_C.
+ * \param[out] payload      The payload.
+ * \param[out] parameters   The parameters or \c NULL.
+ *
+ * \retval T_COSE_ERR_NO_X5CHAIN
+ *         There is no x5chain parameter and the x5t parameter, if
+ *         any, isn't a SHA-256 of a leaf in the cache.
+ * \retval T_COSE_ERR_X5CHAIN_INVALID
+ *         The chain doesn't validate, has more than \ref
+ *         T_COSE_X5CHAIN_MAX_CERTS certificates or doesn't match x5t.
+ * \retval T_COSE_ERR_X5CHAIN_UNSUPPORTED
+ *         The crypto adapter can't validate certificate chains.
+ *
+ * Otherwise the errors are those of t_cose_sign1_verify().
+ *
+ * A chain in the cache is only used while the time is in the
+ * validity of all its certificates. A chain that fails validation is
+ * not cached. The x5chain and x5t parameters need not be protected as
+ * the key is bound by the signature. The payload must not be
+ * detached.
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_x5chain(struct t_cose_sign1_verify_ctx *context,
+                            struct t_cose_x5chain_cache    *cache,
+                            struct q_useful_buf_c           cose_sign1,
+                            struct q_useful_buf_c           aad,
+                            struct q_useful_buf_c          *payload,
+                            struct t_cose_parameters       *parameters);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 with the key from its certificate
+ *        chain with a shared configuration.
+ *
+ * This is t_cose_sign1_verify_x5chain() with the configuration and
+ * the per-message state separate as in t_cose_sign1_verifier_verify().
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_x5chain(const struct t_cose_sign1_verifier *verifier,
+                                     struct t_cose_sign1_verify_call    *call,
+                                     struct t_cose_x5chain_cache        *cache,
+                                     struct q_useful_buf_c               cose_sign1,
+                                     struct q_useful_buf_c               aad,
+                                     struct q_useful_buf_c              *payload,
+                                     struct t_cose_parameters           *parameters);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __T_COSE_X5CHAIN_H__ */
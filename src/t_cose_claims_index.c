@@ -0,0 +1,578 @@
+/*
+ *  t_cose_claims_index.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include "t_cose/t_cose_claims_index.h"
+#include "qcbor/qcbor_common.h"
+
+
+/**
+ * \file t_cose_claims_index.c
+ *
+ * \brief Indexing of claims in a payload.
+ *
+ * The payload is walked with a small CBOR head decoder rather than
+ * QCBOR because the index needs the offset and length of every
+ * value, which the QCBOR decoder doesn't give.
+ */
+
+
+/* An entry number for a level that has no entry */
+#define NO_ENTRY SIZE_MAX
+
+
+/**
+ * A map or array being walked.
+ */
+struct index_level {
+    /* Items left, counting labels and values separately in maps */
+    uint64_t remaining;
+    /* The entry to set the length of when done or NO_ENTRY */
+    size_t   entry;
+    /* The offset of the map for the claims in it */
+    uint32_t map;
+    /* Whether the items are claims to index */
+    bool     indexed;
+    /* The label for the next value in an indexed map */
+    int64_t  label;
+    uint32_t label_len;
+    uint8_t  label_type;
+};
+
+
+/**
+ * \brief Decode a CBOR head.
+ *
+ * \param[in] payload     The payload.
+ * \param[in,out] pos     Where the head starts. Set to just after it.
+ * \param[out] major_type The major type.
+ * \param[out] argument   The argument. For floating point and simple
+ *                        values the bytes of the value are in the head.
+ *
+ * \retval T_COSE_ERR_CBOR_NOT_WELL_FORMED
+ *         The head runs off the end or is reserved.
+ * \retval T_COSE_ERR_CWT_FORMAT
+ *         The head is for an indefinite length or a break.
+ * \retval T_COSE_SUCCESS
+ *         The head was decoded.
+ */
+static enum t_cose_err_t
+decode_head(struct q_useful_buf_c payload,
+            size_t               *pos,
+            uint8_t              *major_type,
+            uint64_t             *argument)
+{
+    const uint8_t *bytes = payload.ptr;
+    uint8_t        additional_info;
+    size_t         arg_len;
+    uint64_t       arg;
+    size_t         i;
+
+    if(*pos >= payload.len) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    *major_type     = bytes[*pos] >> 5;
+    additional_info = bytes[*pos] & 0x1f;
+    (*pos)++;
+
+    if(additional_info < 24) {
+        *argument = additional_info;
+        return T_COSE_SUCCESS;
+    }
+    if(additional_info == 31) {
+        return T_COSE_ERR_CWT_FORMAT;
+    }
+    if(additional_info > 27) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+
+    arg_len = (size_t)1 << (additional_info - 24);
+    if(arg_len > payload.len - *pos) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    arg = 0;
+    for(i = 0; i < arg_len; i++) {
+        arg = (arg << 8) | bytes[*pos + i];
+    }
+    *pos += arg_len;
+    *argument = arg;
+
+    return T_COSE_SUCCESS;
+}
+
+
+/**
+ * \brief Compare an entry's map and label to a key.
+ *
+ * \param[in] payload     The payload.
+ * \param[in] entry       The entry.
+ * \param[in] map         The key's map.
+ * \param[in] label_type  The key's kind of label.
+ * \param[in] int_label   The key's integer label.
+ * \param[in] tstr_label  The key's text string label.
+ *
+ * \return Less than, equal to or more than 0 as the entry is before,
+ *         the same as or after the key.
+ *
+ * Entries are ordered by map, then integer labels before text, then
+ * text labels by length and then bytes as in deterministic encoding.
+ */
+static int
+compare_entry(struct q_useful_buf_c                   payload,
+              const struct t_cose_claims_index_entry *entry,
+              uint32_t                                map,
+              uint8_t                                 label_type,
+              int64_t                                 int_label,
+              struct q_useful_buf_c                   tstr_label)
+{
+    if(entry->map != map) {
+        return entry->map < map ? -1 : 1;
+    }
+    if(entry->label_type != label_type) {
+        return entry->label_type < label_type ? -1 : 1;
+    }
+    if(label_type == T_COSE_CLAIMS_INDEX_LABEL_INT) {
+        if(entry->label != int_label) {
+            return entry->label < int_label ? -1 : 1;
+        }
+        return 0;
+    }
+    if(entry->label_len != tstr_label.len) {
+        return entry->label_len < tstr_label.len ? -1 : 1;
+    }
+    return memcmp((const uint8_t *)payload.ptr + entry->label, tstr_label.ptr, tstr_label.len);
+}
+
+
+/**
+ * \brief Compare two entries.
+ *
+ * \param[in] payload  The payload.
+ * \param[in] a        The first entry.
+ * \param[in] b        The second entry.
+ *
+ * \return As for compare_entry().
+ */
+static int
+compare_entries(struct q_useful_buf_c                   payload,
+                const struct t_cose_claims_index_entry *a,
+                const struct t_cose_claims_index_entry *b)
+{
+    return compare_entry(payload,
+                         a,
+                         b->map,
+                         b->label_type,
+                         b->label,
+                         (struct q_useful_buf_c){(const uint8_t *)payload.ptr + b->label,
+                                                 b->label_len});
+}
+
+
+/**
+ * \brief Decode a label in an indexed map.
+ *
+ * \param[in] payload  The payload.
+ * \param[in,out] pos  Where the label starts. Set to just after it.
+ * \param[out] level   The level to put the label in.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ */
+static enum t_cose_err_t
+decode_label(struct q_useful_buf_c  payload,
+             size_t                *pos,
+             struct index_level    *level)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          argument;
+
+    return_value = decode_head(payload, pos, &major_type, &argument);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+
+    switch(major_type) {
+    case CBOR_MAJOR_TYPE_POSITIVE_INT:
+    case CBOR_MAJOR_TYPE_NEGATIVE_INT:
+        if(argument > INT64_MAX) {
+            return T_COSE_ERR_CWT_FORMAT;
+        }
+        level->label_type = T_COSE_CLAIMS_INDEX_LABEL_INT;
+        level->label_len  = 0;
+        level->label      = major_type == CBOR_MAJOR_TYPE_POSITIVE_INT ?
+                                (int64_t)argument : -(int64_t)argument - 1;
+        return T_COSE_SUCCESS;
+
+    case CBOR_MAJOR_TYPE_TEXT_STRING:
+        if(argument > payload.len - *pos) {
+            return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+        }
+        level->label_type = T_COSE_CLAIMS_INDEX_LABEL_TSTR;
+        level->label      = (int64_t)*pos;
+        level->label_len  = (uint32_t)argument;
+        *pos += (size_t)argument;
+        return T_COSE_SUCCESS;
+
+    default:
+        return T_COSE_ERR_CWT_FORMAT;
+    }
+}
+
+
+/*
+ * Public function. See t_cose_claims_index.h
+ */
+enum t_cose_err_t
+t_cose_claims_index_build(struct t_cose_claims_index       *me,
+                          struct q_useful_buf_c             payload,
+                          struct t_cose_claims_index_entry *entries,
+                          size_t                            max_entries)
+{
+    enum t_cose_err_t                 return_value;
+    struct index_level                levels[T_COSE_CLAIMS_INDEX_MAX_DEPTH];
+    struct index_level               *level;
+    struct t_cose_claims_index_entry *entry;
+    struct t_cose_claims_index_entry  moving;
+    size_t                            depth;
+    size_t                            pos;
+    size_t                            value_start;
+    size_t                            head_start;
+    uint8_t                           major_type;
+    uint64_t                          argument;
+    size_t                            i;
+    size_t                            j;
+
+    me->payload     = payload;
+    me->entries     = entries;
+    me->num_entries = 0;
+
+    if(payload.len > UINT32_MAX) {
+        return_value = T_COSE_ERR_INVALID_ARGUMENT;
+        goto Done;
+    }
+
+    pos = 0;
+    return_value = decode_head(payload, &pos, &major_type, &argument);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    if(major_type != CBOR_MAJOR_TYPE_MAP) {
+        return_value = T_COSE_ERR_CWT_FORMAT;
+        goto Done;
+    }
+    /* Every item is at least a byte */
+    if(argument > (payload.len - pos) / 2) {
+        return_value = T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+        goto Done;
+    }
+    levels[0].remaining = argument * 2;
+    levels[0].entry     = NO_ENTRY;
+    levels[0].map       = 0;
+    levels[0].indexed   = true;
+    depth = 1;
+
+    /* One pass over the payload. Aggregates push a level so nothing
+     * recurses. */
+    while(depth > 0) {
+        level = &levels[depth - 1];
+        if(level->remaining == 0) {
+            if(level->entry != NO_ENTRY) {
+                entries[level->entry].length = (uint32_t)(pos - entries[level->entry].offset);
+            }
+            depth--;
+            continue;
+        }
+        level->remaining--;
+
+        if(level->indexed && level->remaining % 2 == 1) {
+            return_value = decode_label(payload, &pos, level);
+            if(return_value != T_COSE_SUCCESS) {
+                goto Done;
+            }
+            continue;
+        }
+
+        value_start = pos;
+        do {
+            head_start = pos;
+            return_value = decode_head(payload, &pos, &major_type, &argument);
+            if(return_value != T_COSE_SUCCESS) {
+                goto Done;
+            }
+        } while(major_type == CBOR_MAJOR_TYPE_TAG);
+        if(head_start - value_start > UINT8_MAX) {
+            return_value = T_COSE_ERR_CWT_FORMAT;
+            goto Done;
+        }
+
+        entry = NULL;
+        if(level->indexed) {
+            if(me->num_entries >= max_entries) {
+                return_value = T_COSE_ERR_TOO_SMALL;
+                goto Done;
+            }
+            entry = &entries[me->num_entries];
+            entry->label      = level->label;
+            entry->label_len  = level->label_len;
+            entry->label_type = level->label_type;
+            entry->map        = level->map;
+            entry->offset     = (uint32_t)value_start;
+            entry->tags_len   = (uint8_t)(head_start - value_start);
+            entry->major_type = major_type;
+            me->num_entries++;
+        }
+
+        switch(major_type) {
+        case CBOR_MAJOR_TYPE_BYTE_STRING:
+        case CBOR_MAJOR_TYPE_TEXT_STRING:
+            if(argument > payload.len - pos) {
+                return_value = T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+                goto Done;
+            }
+            pos += (size_t)argument;
+            break;
+
+        case CBOR_MAJOR_TYPE_ARRAY:
+        case CBOR_MAJOR_TYPE_MAP:
+            if(depth >= T_COSE_CLAIMS_INDEX_MAX_DEPTH) {
+                return_value = T_COSE_ERR_CWT_FORMAT;
+                goto Done;
+            }
+            if(argument > (payload.len - pos) / (major_type == CBOR_MAJOR_TYPE_MAP ? 2 : 1)) {
+                return_value = T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+                goto Done;
+            }
+            /* Only maps that are claims have claims to index */
+            levels[depth].remaining = major_type == CBOR_MAJOR_TYPE_MAP ? argument * 2 : argument;
+            levels[depth].entry     = entry != NULL ? me->num_entries - 1 : NO_ENTRY;
+            levels[depth].map       = (uint32_t)value_start;
+            levels[depth].indexed   = entry != NULL && major_type == CBOR_MAJOR_TYPE_MAP;
+            depth++;
+            entry = NULL;
+            break;
+
+        default:
+            /* Integers, floats and simple values are all head */
+            break;
+        }
+
+        if(entry != NULL) {
+            entry->length = (uint32_t)(pos - value_start);
+        }
+    }
+
+    if(pos != payload.len) {
+        return_value = T_COSE_ERR_CWT_FORMAT;
+        goto Done;
+    }
+
+    /* Insertion sort as the claims are usually in order already */
+    for(i = 1; i < me->num_entries; i++) {
+        moving = entries[i];
+        for(j = i; j > 0 && compare_entries(payload, &entries[j - 1], &moving) > 0; j--) {
+            entries[j] = entries[j - 1];
+        }
+        entries[j] = moving;
+    }
+    for(i = 1; i < me->num_entries; i++) {
+        if(compare_entries(payload, &entries[i - 1], &entries[i]) == 0) {
+            return_value = T_COSE_ERR_CWT_FORMAT;
+            goto Done;
+        }
+    }
+
+Done:
+    if(return_value != T_COSE_SUCCESS) {
+        me->num_entries = 0;
+    }
+    return return_value;
+}
+
+
+/**
+ * \brief Binary search for a claim.
+ *
+ * \param[in] me          The index.
+ * \param[in] map         The entry of the map or \c NULL for the outer one.
+ * \param[in] label_type  The kind of label.
+ * \param[in] int_label   The integer label.
+ * \param[in] tstr_label  The text string label.
+ *
+ * \return The entry or \c NULL.
+ */
+static const struct t_cose_claims_index_entry *
+index_find(const struct t_cose_claims_index       *me,
+           const struct t_cose_claims_index_entry *map,
+           uint8_t                                 label_type,
+           int64_t                                 int_label,
+           struct q_useful_buf_c                   tstr_label)
+{
+    uint32_t map_offset;
+    size_t   low;
+    size_t   high;
+    size_t   middle;
+    int      comparison;
+
+    map_offset = 0;
+    if(map != NULL) {
+        if(map->major_type != CBOR_MAJOR_TYPE_MAP) {
+            return NULL;
+        }
+        map_offset = map->offset;
+    }
+
+    low  = 0;
+    high = me->num_entries;
+    while(low < high) {
+        middle = low + (high - low) / 2;
+        comparison = compare_entry(me->payload,
+                                  &me->entries[middle],
+                                   map_offset,
+                                   label_type,
+                                   int_label,
+                                   tstr_label);
+        if(comparison == 0) {
+            return &me->entries[middle];
+        }
+        if(comparison < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return NULL;
+}
+
+
+/*
+ * Public function. See t_cose_claims_index.h
+ */
+const struct t_cose_claims_index_entry *
+t_cose_claims_index_find(const struct t_cose_claims_index       *me,
+                         const struct t_cose_claims_index_entry *map,
+                         int64_t                                 label)
+{
+    return index_find(me, map, T_COSE_CLAIMS_INDEX_LABEL_INT, label, NULL_Q_USEFUL_BUF_C);
+}
+
+
+/*
+ * Public function. See t_cose_claims_index.h
+ */
+const struct t_cose_claims_index_entry *
+t_cose_claims_index_find_tstr(const struct t_cose_claims_index       *me,
+                              const struct t_cose_claims_index_entry *map,
+                              struct q_useful_buf_c                   label)
+{
+    return index_find(me, map, T_COSE_CLAIMS_INDEX_LABEL_TSTR, 0, label);
+}
+
+
+/*
+ * Public function. See t_cose_claims_index.h
+ */
+const struct t_cose_claims_index_entry *
+t_cose_claims_index_next(const struct t_cose_claims_index       *me,
+                         const struct t_cose_claims_index_entry *map,
+                         const struct t_cose_claims_index_entry *previous)
+{
+    uint32_t map_offset;
+    size_t   low;
+    size_t   high;
+    size_t   middle;
+
+    map_offset = 0;
+    if(map != NULL) {
+        if(map->major_type != CBOR_MAJOR_TYPE_MAP) {
+            return NULL;
+        }
+        map_offset = map->offset;
+    }
+
+    if(previous != NULL) {
+        low = (size_t)(previous - me->entries) + 1;
+    } else {
+        /* The first entry of the map, as they are sorted by map */
+        low  = 0;
+        high = me->num_entries;
+        while(low < high) {
+            middle = low + (high - low) / 2;
+            if(me->entries[middle].map < map_offset) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+    }
+
+    if(low >= me->num_entries || me->entries[low].map != map_offset) {
+        return NULL;
+    }
+    return &me->entries[low];
+}
+
+
+/*
+ * Public function. See t_cose_claims_index.h
+ */
+enum t_cose_err_t
+t_cose_claims_index_get_int(const struct t_cose_claims_index       *me,
+                            const struct t_cose_claims_index_entry *entry,
+                            int64_t                                *value)
+{
+    size_t   pos;
+    uint8_t  major_type;
+    uint64_t argument;
+
+    if(entry == NULL ||
+       (entry->major_type != CBOR_MAJOR_TYPE_POSITIVE_INT &&
+        entry->major_type != CBOR_MAJOR_TYPE_NEGATIVE_INT)) {
+        return T_COSE_ERR_CWT_FORMAT;
+    }
+
+    pos = entry->offset + entry->tags_len;
+    if(decode_head(me->payload, &pos, &major_type, &argument) != T_COSE_SUCCESS ||
+       argument > INT64_MAX) {
+        return T_COSE_ERR_CWT_FORMAT;
+    }
+    *value = major_type == CBOR_MAJOR_TYPE_POSITIVE_INT ? (int64_t)argument : -(int64_t)argument - 1;
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * Public function. See t_cose_claims_index.h
+ */
+enum t_cose_err_t
+t_cose_claims_index_get_string(const struct t_cose_claims_index       *me,
+                               const struct t_cose_claims_index_entry *entry,
+                               struct q_useful_buf_c                  *value)
+{
+    size_t   pos;
+    uint8_t  major_type;
+    uint64_t argument;
+
+    if(entry == NULL ||
+       (entry->major_type != CBOR_MAJOR_TYPE_BYTE_STRING &&
+        entry->major_type != CBOR_MAJOR_TYPE_TEXT_STRING)) {
+        return T_COSE_ERR_CWT_FORMAT;
+    }
+
+    pos = entry->offset + entry->tags_len;
+    if(decode_head(me->payload, &pos, &major_type, &argument) != T_COSE_SUCCESS) {
+        return T_COSE_ERR_CWT_FORMAT;
+    }
+    *value = (struct q_useful_buf_c){(const uint8_t *)me->payload.ptr + pos, (size_t)argument};
+
+    return T_COSE_SUCCESS;
+}
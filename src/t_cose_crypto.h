@@ -47,6 +47,9 @@ extern "C" {
  *   - t_cose_crypto_hash_start()
  *   - t_cose_crypto_hash_update()
  *   - t_cose_crypto_hash_finish()
+ *   - t_cose_crypto_hash_clone()
+ *   - t_cose_crypto_hash_abort()
+ *   - t_cose_crypto_hash_batch()
  *
  * This runs entirely off of COSE-style algorithm identifiers.  They
  * are simple integers and thus work nice as function parameters. An
@@ -226,6 +229,34 @@ t_cose_crypto_sign(int32_t                cose_algorithm_id,
                    struct q_useful_buf_c *signature);
 
 
+/**
+ * \brief Perform ECDSA signing with a deterministic nonce. Part of the
+ * t_cose crypto adaptation layer.
+ *
+ * \param[in] cose_algorithm_id  An ECDSA algorithm, for example
+ *                               \ref T_COSE_ALGORITHM_ES256.
+ * \param[in] signing_key        As for t_cose_crypto_sign().
+ * \param[in] hash_to_sign       As for t_cose_crypto_sign().
+ * \param[in] signature_buffer   As for t_cose_crypto_sign().
+ * \param[out] signature         As for t_cose_crypto_sign().
+ *
+ * \retval T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED
+ *         The crypto library can't do it.
+ *
+ * Otherwise the same as t_cose_crypto_sign(), except that the nonce
+ * is derived from the key and hash as in RFC 6979 rather than drawn
+ * from the random number generator. This is only called for ECDSA
+ * algorithms and only when \ref T_COSE_OPT_DETERMINISTIC_ECDSA is
+ * set.
+ */
+enum t_cose_err_t
+t_cose_crypto_sign_deterministic(int32_t                cose_algorithm_id,
+                                 struct t_cose_key      signing_key,
+                                 struct q_useful_buf_c  hash_to_sign,
+                                 struct q_useful_buf    signature_buffer,
+                                 struct q_useful_buf_c *signature);
+
+
 /**
  * \brief Perform public key signature verification. Part of the
  * t_cose crypto adaptation layer.
@@ -394,9 +425,11 @@ t_cose_crypto_verify_eddsa(struct t_cose_key     verification_key,
 #elif T_COSE_USE_B_CON_SHA256
 /* This is code for use with Brad Conte's crypto.  See
  * https://github.com/B-Con/crypto-algorithms and see the description
- * of t_cose_crypto_hash
+ * of t_cose_crypto_hash. sha512.h is the SHA-384/512 bundled next
+ * to it.
  */
 #include "sha256.h"
+#include "sha512.h"
 #endif
 
 
@@ -452,8 +485,15 @@ struct t_cose_crypto_hash {
         int32_t      cose_hash_alg_id; /* COSE integer ID for the hash alg */
 
    #elif T_COSE_USE_B_CON_SHA256
-        /* --- Specific context for Brad Conte's sha256.c --- */
-        SHA256_CTX b_con_hash_context;
+        /* --- Specific context for Brad Conte's sha256.c and sha512.c --- */
+        union {
+            SHA256_CTX sha256;
+    #if !defined(T_COSE_DISABLE_ES384) || !defined(T_COSE_DISABLE_PS384) || \
+        !defined(T_COSE_DISABLE_ES512) || !defined(T_COSE_DISABLE_PS512)
+            SHA512_CTX sha512; /* Also SHA-384 */
+    #endif
+        } b_con_hash_context;
+        int32_t cose_hash_alg_id; /* COSE integer ID for the hash alg */
 
    #else
     /* --- Default: generic pointer / handle --- */
@@ -599,6 +639,220 @@ t_cose_crypto_hash_finish(struct t_cose_crypto_hash *hash_ctx,
                           struct q_useful_buf_c     *hash_result);
 
 
+/**
+ * \brief Copy a hash in progress. Part of the t_cose crypto
+ * adaptation layer.
+ *
+ * \param[out] dest  Pointer to the hash context to copy into. It
+ *                   is not initialized before the call.
+ * \param[in] src    Pointer to a started hash context that has not
+ *                   been finished.
+ *
+ * \retval T_COSE_ERR_INSUFFICIENT_MEMORY
+ *         The crypto library couldn't allocate the copy.
+ * \retval T_COSE_ERR_HASH_GENERAL_FAIL
+ *         Some general failure of the hash function.
+ * \retval T_COSE_SUCCESS
+ *         Success.
+ *
+ * After this \c dest and \c src are independent. Each must either
+ * be finished with t_cose_crypto_hash_finish() or released with
+ * t_cose_crypto_hash_abort(). This is how a hash of a common prefix
+ * is computed once and then resumed for many messages.
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_clone(struct t_cose_crypto_hash       *dest,
+                         const struct t_cose_crypto_hash *src);
+
+
+/**
+ * \brief Release a hash in progress without finishing it. Part of
+ * the t_cose crypto adaptation layer.
+ *
+ * \param[in,out] hash_ctx  Pointer to a started hash context that
+ *                          has not been finished.
+ *
+ * This frees anything the crypto library holds for the hash. The
+ * context must not be used again until it is restarted.
+ */
+void
+t_cose_crypto_hash_abort(struct t_cose_crypto_hash *hash_ctx);
+
+
+/**
+ * One message for t_cose_crypto_hash_batch(). The message is the
+ * concatenation of \c pieces, so it doesn't have to be in one
+ * buffer. A piece with a \c NULL pointer is skipped, the same as
+ * with t_cose_crypto_hash_update().
+ */
+struct t_cose_crypto_hash_batch_item {
+    /* Inputs */
+    const struct q_useful_buf_c *pieces;
+    size_t                       num_pieces;
+    struct q_useful_buf          buffer_for_hash;
+
+    /* Output */
+    struct q_useful_buf_c        hash;
+};
+
+
+/**
+ * \brief Hash several independent messages. Part of the t_cose
+ * crypto adaptation layer.
+ *
+ * \param[in] cose_hash_alg_id  Algorithm ID of the hash to use for
+ *                              all the messages.
+ * \param[in,out] items         The messages to hash and where to
+ *                              put the results.
+ * \param[in] num_items         The number of entries in \c items.
+ *
+ * \retval T_COSE_ERR_UNSUPPORTED_HASH
+ *         The requested algorithm is unknown or unsupported.
+ * \retval T_COSE_ERR_HASH_BUFFER_SIZE
+ *         One of the \c buffer_for_hash is too small.
+ * \retval T_COSE_ERR_HASH_GENERAL_FAIL
+ *         Some general failure of the hash function.
+ * \retval T_COSE_SUCCESS
+ *         All the messages were hashed.
+ *
+ * The result is the same as calling t_cose_crypto_hash_start(),
+ * t_cose_crypto_hash_update() for each piece and
+ * t_cose_crypto_hash_finish() for each item. It exists so that
+ * adapters for hash implementations with multi-buffer kernels can
+ * run several messages through the compression function at once in
+ * SIMD lanes. That is much faster than one at a time for many short
+ * messages like the to-be-signed bytes of small tokens. An adapter
+ * without such a kernel just loops.
+ *
+ * If an error is returned, none of the hashes should be used.
+ */
+enum t_cose_err_t
+t_cose_crypto_hash_batch(int32_t                               cose_hash_alg_id,
+                         struct t_cose_crypto_hash_batch_item *items,
+                         size_t                                num_items);
+
+
+/**
+ * \brief Do the crypto library's one-time set up ahead of time.
+ *
+ * \param[in] crypto_context  Crypto-library-specific context or
+ *                            \c NULL for the default.
+ *
+ * \retval T_COSE_SUCCESS
+ *         The set up is done.
+ * \retval T_COSE_ERR_UNSUPPORTED_HASH
+ *         A hash the adapter needs isn't available.
+ * \retval T_COSE_ERR_UNSUPPORTED_SIGNING_ALG
+ *         A signing algorithm the adapter needs isn't available.
+ *
+ * This is the implementation of t_cose_warmup(). An adapter should
+ * do every lookup, allocation and table build here that would
+ * otherwise happen on the first hash, signature or verification, so
+ * the first message isn't much slower than the rest. It is called
+ * before any other thread uses t_cose so it doesn't have to be
+ * thread safe. Calling it again must work.
+ *
+ * With OpenSSL 3 \c crypto_context is an \c OSSL_LIB_CTX that
+ * everything is fetched from. Other adapters ignore it.
+ */
+enum t_cose_err_t
+t_cose_crypto_warmup(void *crypto_context);
+
+
+/**
+ * \brief Turn per-thread key replicas on or off for the calling thread.
+ *
+ * \param[in] enable  \c true to turn on, \c false to turn off and
+ *                    release the replicas.
+ *
+ * \retval T_COSE_SUCCESS
+ * \retval T_COSE_ERR_FAIL
+ *         Replicas are not supported in this build.
+ *
+ * This is the implementation of t_cose_set_thread_key_replicas().
+ * Adapters whose keys are not shared, reference-counted objects
+ * have nothing to do and just return success.
+ */
+enum t_cose_err_t
+t_cose_crypto_set_thread_key_replicas(bool enable);
+
+
+/**
+ * \brief Make a trust store for validating certificate chains.
+ *
+ * \param[in] anchors      The DER certificates of the trust anchors.
+ * \param[in] num_anchors  The number of \c anchors.
+ * \param[out] trust       The trust store.
+ *
+ * \retval T_COSE_SUCCESS
+ * \retval T_COSE_ERR_X5CHAIN_INVALID
+ *         An anchor can't be parsed.
+ * \retval T_COSE_ERR_INSUFFICIENT_MEMORY
+ * \retval T_COSE_ERR_X5CHAIN_UNSUPPORTED
+ *         The adapter has no X.509 support.
+ *
+ * The anchors are parsed here once. \c trust is used by
+ * t_cose_crypto_x5chain_validate() from one thread at a time.
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_trust_new(const struct q_useful_buf_c *anchors,
+                                size_t                       num_anchors,
+                                void                       **trust);
+
+
+/**
+ * \brief Free a trust store from t_cose_crypto_x5chain_trust_new().
+ *
+ * \param[in] trust  The trust store. \c NULL is allowed.
+ */
+void
+t_cose_crypto_x5chain_trust_free(void *trust);
+
+
+/**
+ * \brief Validate a certificate chain and get the key of its leaf.
+ *
+ * \param[in] trust       The trust store.
+ * \param[in] certs       The DER certificates, the leaf first.
+ * \param[in] num_certs   The number of \c certs.
+ * \param[in] time        The time to validate at in seconds since the
+ *                        epoch.
+ * \param[out] leaf_key   The public key of the leaf certificate.
+ * \param[out] not_before The latest start of validity in the chain.
+ * \param[out] not_after  The earliest end of validity in the chain.
+ *
+ * \retval T_COSE_SUCCESS
+ * \retval T_COSE_ERR_X5CHAIN_INVALID
+ *         The chain doesn't lead to an anchor in \c trust, isn't valid
+ *         at \c time, a certificate can't be parsed or the leaf's key
+ *         usage doesn't allow signing.
+ * \retval T_COSE_ERR_INSUFFICIENT_MEMORY
+ * \retval T_COSE_ERR_X5CHAIN_UNSUPPORTED
+ *         The adapter has no X.509 support.
+ *
+ * \c leaf_key is usable with t_cose_crypto_verify() and must be
+ * released with t_cose_crypto_x5chain_free_key(). \c not_before and
+ * \c not_after bound when a cached result of this can be used.
+ */
+enum t_cose_err_t
+t_cose_crypto_x5chain_validate(void                        *trust,
+                               const struct q_useful_buf_c *certs,
+                               size_t                       num_certs,
+                               int64_t                      time,
+                               struct t_cose_key           *leaf_key,
+                               int64_t                     *not_before,
+                               int64_t                     *not_after);
+
+
+/**
+ * \brief Release a key from t_cose_crypto_x5chain_validate().
+ *
+ * \param[in] key  The key.
+ */
+void
+t_cose_crypto_x5chain_free_key(struct t_cose_key key);
+
+
 
 /**
  * \brief Indicate whether a COSE algorithm is ECDSA or not.
@@ -0,0 +1,202 @@
+/*
+ *  t_cose_cwt_claims.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <time.h>
+#include "t_cose/t_cose_cwt_claims.h"
+#include "qcbor/qcbor_spiffy_decode.h"
+
+
+/**
+ * \file t_cose_cwt_claims.c
+ *
+ * \brief Checking of CWT claims sets.
+ */
+
+
+/* Indexes of the standard claims in the item list. Each is one less
+ * than the claim key. */
+#define CLAIM_ISS_INDEX (T_COSE_CWT_CLAIM_ISS - 1)
+#define CLAIM_SUB_INDEX (T_COSE_CWT_CLAIM_SUB - 1)
+#define CLAIM_AUD_INDEX (T_COSE_CWT_CLAIM_AUD - 1)
+#define CLAIM_EXP_INDEX (T_COSE_CWT_CLAIM_EXP - 1)
+#define CLAIM_NBF_INDEX (T_COSE_CWT_CLAIM_NBF - 1)
+#define CLAIM_IAT_INDEX (T_COSE_CWT_CLAIM_IAT - 1)
+#define CLAIM_CTI_INDEX (T_COSE_CWT_CLAIM_CTI - 1)
+#define CLAIM_END_INDEX (T_COSE_CWT_CLAIM_CTI)
+
+
+/**
+ * \brief Count the claims that aren't standard ones.
+ *
+ * \param[in] callback_ctx  The \c num_other_claims to count in.
+ * \param[in] item          The claim.
+ *
+ * \return Always \c QCBOR_SUCCESS.
+ */
+static QCBORError
+other_claim_callback(void *callback_ctx, const QCBORItem *item)
+{
+    (void)item;
+    (*(size_t *)callback_ctx)++;
+
+    return QCBOR_SUCCESS;
+}
+
+
+/**
+ * \brief Get a NumericDate out of a decoded claim.
+ *
+ * \param[in] item   The decoded claim.
+ * \param[out] date  The date in whole seconds.
+ *
+ * \return \ref T_COSE_SUCCESS or \ref T_COSE_ERR_CWT_FORMAT.
+ *
+ * RFC 8392 says the date has no tag so an epoch date tag is a format
+ * error.
+ */
+static enum t_cose_err_t
+numeric_date(const QCBORItem *item, int64_t *date)
+{
+    switch(item->uDataType) {
+    case QCBOR_TYPE_INT64:
+        *date = item->val.int64;
+        return T_COSE_SUCCESS;
+
+#ifndef USEFULBUF_DISABLE_ALL_FLOAT
+    case QCBOR_TYPE_DOUBLE:
+        /* The comparisons are false for NaN */
+        if(!(item->val.dfnum >= -9223372036854775808.0 &&
+             item->val.dfnum < 9223372036854775808.0)) {
+            return T_COSE_ERR_CWT_FORMAT;
+        }
+        *date = (int64_t)item->val.dfnum;
+        return T_COSE_SUCCESS;
+#endif /* USEFULBUF_DISABLE_ALL_FLOAT */
+
+    default:
+        return T_COSE_ERR_CWT_FORMAT;
+    }
+}
+
+
+/*
+ * Public function. See t_cose_cwt_claims.h
+ */
+enum t_cose_err_t
+t_cose_cwt_validate(const struct t_cose_cwt_validation *validation,
+                    struct q_useful_buf_c               payload,
+                    struct t_cose_cwt_claims           *returned_claims)
+{
+    QCBORDecodeContext       decode_context;
+    QCBORItem                claim_items[CLAIM_END_INDEX + 1];
+    QCBORError               qcbor_result;
+    enum t_cose_err_t        return_value;
+    struct t_cose_cwt_claims claims;
+    int64_t                  now;
+    int                      i;
+
+    memset(&claims, 0, sizeof(claims));
+
+    for(i = 0; i < CLAIM_END_INDEX; i++) {
+        claim_items[i].label.int64 = i + 1;
+        claim_items[i].uLabelType  = QCBOR_TYPE_INT64;
+        claim_items[i].uDataType   = QCBOR_TYPE_ANY;
+    }
+    claim_items[CLAIM_ISS_INDEX].uDataType = QCBOR_TYPE_TEXT_STRING;
+    claim_items[CLAIM_SUB_INDEX].uDataType = QCBOR_TYPE_TEXT_STRING;
+    claim_items[CLAIM_AUD_INDEX].uDataType = QCBOR_TYPE_TEXT_STRING;
+    claim_items[CLAIM_CTI_INDEX].uDataType = QCBOR_TYPE_BYTE_STRING;
+    claim_items[CLAIM_END_INDEX].uLabelType = QCBOR_TYPE_NONE;
+
+    /* One pass over the map picks out the standard claims, checks
+     * their types, catches duplicates and counts the rest */
+    QCBORDecode_Init(&decode_context, payload, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterMap(&decode_context, NULL);
+    QCBORDecode_GetItemsInMapWithCallback(&decode_context,
+                                          claim_items,
+                                          &claims.num_other_claims,
+                                          other_claim_callback);
+    QCBORDecode_ExitMap(&decode_context);
+    qcbor_result = QCBORDecode_Finish(&decode_context);
+    if(qcbor_result != QCBOR_SUCCESS) {
+        return_value = T_COSE_ERR_CWT_FORMAT;
+        goto Done;
+    }
+
+    for(i = 0; i < CLAIM_END_INDEX; i++) {
+        if(claim_items[i].uDataType != QCBOR_TYPE_NONE) {
+            claims.present |= 1U << (i + 1);
+        }
+    }
+    claims.iss = claim_items[CLAIM_ISS_INDEX].uDataType == QCBOR_TYPE_NONE ?
+                     NULL_Q_USEFUL_BUF_C : claim_items[CLAIM_ISS_INDEX].val.string;
+    claims.sub = claim_items[CLAIM_SUB_INDEX].uDataType == QCBOR_TYPE_NONE ?
+                     NULL_Q_USEFUL_BUF_C : claim_items[CLAIM_SUB_INDEX].val.string;
+    claims.aud = claim_items[CLAIM_AUD_INDEX].uDataType == QCBOR_TYPE_NONE ?
+                     NULL_Q_USEFUL_BUF_C : claim_items[CLAIM_AUD_INDEX].val.string;
+    claims.cti = claim_items[CLAIM_CTI_INDEX].uDataType == QCBOR_TYPE_NONE ?
+                     NULL_Q_USEFUL_BUF_C : claim_items[CLAIM_CTI_INDEX].val.string;
+
+    return_value = T_COSE_SUCCESS;
+    if(claims.present & (1U << T_COSE_CWT_CLAIM_EXP)) {
+        return_value = numeric_date(&claim_items[CLAIM_EXP_INDEX], &claims.exp);
+    }
+    if(return_value == T_COSE_SUCCESS && (claims.present & (1U << T_COSE_CWT_CLAIM_NBF))) {
+        return_value = numeric_date(&claim_items[CLAIM_NBF_INDEX], &claims.nbf);
+    }
+    if(return_value == T_COSE_SUCCESS && (claims.present & (1U << T_COSE_CWT_CLAIM_IAT))) {
+        return_value = numeric_date(&claim_items[CLAIM_IAT_INDEX], &claims.iat);
+    }
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    if(!q_useful_buf_c_is_null(validation->issuer) &&
+       (q_useful_buf_c_is_null(claims.iss) || q_useful_buf_compare(claims.iss, validation->issuer))) {
+        return_value = T_COSE_ERR_CWT_ISSUER;
+        goto Done;
+    }
+    if(!q_useful_buf_c_is_null(validation->audience) &&
+       (q_useful_buf_c_is_null(claims.aud) || q_useful_buf_compare(claims.aud, validation->audience))) {
+        return_value = T_COSE_ERR_CWT_AUDIENCE;
+        goto Done;
+    }
+
+    if((validation->option_flags & T_COSE_CWT_REQUIRE_EXP) &&
+       !(claims.present & (1U << T_COSE_CWT_CLAIM_EXP))) {
+        return_value = T_COSE_ERR_CWT_MISSING_EXP;
+        goto Done;
+    }
+    if(!(claims.present & ((1U << T_COSE_CWT_CLAIM_EXP) | (1U << T_COSE_CWT_CLAIM_NBF)))) {
+        goto Done;
+    }
+
+    now = validation->clock != NULL ? validation->clock(validation->clock_ctx) : (int64_t)time(NULL);
+
+    /* The differences are taken unsigned so they can't overflow */
+    if(claims.present & (1U << T_COSE_CWT_CLAIM_EXP)) {
+        if(now >= claims.exp && (uint64_t)now - (uint64_t)claims.exp >= validation->leeway) {
+            return_value = T_COSE_ERR_CWT_EXPIRED;
+            goto Done;
+        }
+    }
+    if(claims.present & (1U << T_COSE_CWT_CLAIM_NBF)) {
+        if(now < claims.nbf && (uint64_t)claims.nbf - (uint64_t)now > validation->leeway) {
+            return_value = T_COSE_ERR_CWT_NOT_YET_VALID;
+            goto Done;
+        }
+    }
+
+Done:
+    if(return_value == T_COSE_SUCCESS && returned_claims != NULL) {
+        *returned_claims = claims;
+    }
+    return return_value;
+}
@@ -0,0 +1,261 @@
+/*
+ *  t_cose_cwt_template.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "t_cose/t_cose_cwt_template.h"
+#include "qcbor/qcbor_encode.h"
+
+
+/**
+ * \file t_cose_cwt_template.c
+ *
+ * \brief Encoding of CWT templates.
+ *
+ * The map head goes in the first byte once the number of claims is
+ * known, so the claims are written from the second byte on with
+ * QCBOREncode_EncodeHead() rather than a QCBOR encode context.
+ */
+
+
+/**
+ * \brief Append bytes to a template.
+ *
+ * \param[in] me     The template.
+ * \param[in] bytes  The bytes to append. A \c NULL pointer appends
+ *                   zero bytes.
+ *
+ * \return Where the bytes went in the buffer, or 0 on error.
+ */
+static size_t
+template_append(struct t_cose_cwt_template *me, struct q_useful_buf_c bytes)
+{
+    size_t offset;
+
+    if(me->error != T_COSE_SUCCESS) {
+        return 0;
+    }
+    if(bytes.len > me->buffer.len - me->len) {
+        me->error = T_COSE_ERR_TOO_SMALL;
+        return 0;
+    }
+
+    offset = me->len;
+    if(bytes.ptr != NULL) {
+        memcpy((uint8_t *)me->buffer.ptr + offset, bytes.ptr, bytes.len);
+    } else {
+        memset((uint8_t *)me->buffer.ptr + offset, 0, bytes.len);
+    }
+    me->len += bytes.len;
+
+    return offset;
+}
+
+
+/**
+ * \brief Append a CBOR head to a template.
+ *
+ * \param[in] me          The template.
+ * \param[in] major_type  The CBOR major type.
+ * \param[in] argument    The argument, in preferred serialization.
+ */
+static void
+template_append_head(struct t_cose_cwt_template *me,
+                     uint8_t                     major_type,
+                     uint64_t                    argument)
+{
+    uint8_t head_buf[QCBOR_HEAD_BUFFER_SIZE];
+
+    template_append(me, QCBOREncode_EncodeHead(Q_USEFUL_BUF_FROM_BYTE_ARRAY(head_buf),
+                                               major_type,
+                                               0,
+                                               argument));
+}
+
+
+/**
+ * \brief Append an integer to a template.
+ *
+ * \param[in] me     The template.
+ * \param[in] value  The integer.
+ */
+static void
+template_append_int(struct t_cose_cwt_template *me, int64_t value)
+{
+    if(value < 0) {
+        template_append_head(me, CBOR_MAJOR_TYPE_NEGATIVE_INT, (uint64_t)(-(value + 1)));
+    } else {
+        template_append_head(me, CBOR_MAJOR_TYPE_POSITIVE_INT, (uint64_t)value);
+    }
+}
+
+
+/**
+ * \brief Start a claim in a template.
+ *
+ * \param[in] me     The template.
+ * \param[in] label  The claim key.
+ */
+static void
+template_append_label(struct t_cose_cwt_template *me, int64_t label)
+{
+    if(me->error == T_COSE_SUCCESS && me->num_claims >= T_COSE_CWT_TEMPLATE_MAX_CLAIMS) {
+        me->error = T_COSE_ERR_TOO_MANY_PARAMETERS;
+    }
+    me->num_claims++;
+    template_append_int(me, label);
+}
+
+
+/**
+ * \brief Add a slot to a template after its head.
+ *
+ * \param[in] me       The template.
+ * \param[in] len      The length of the value after the head.
+ * \param[in] is_uint  Whether it's an unsigned integer slot.
+ *
+ * \return The slot number.
+ */
+static size_t
+template_add_slot(struct t_cose_cwt_template *me,
+                  size_t                      len,
+                  bool                        is_uint)
+{
+    size_t slot;
+    size_t offset;
+
+    slot = me->num_slots;
+    if(slot >= T_COSE_CWT_TEMPLATE_MAX_SLOTS) {
+        if(me->error == T_COSE_SUCCESS) {
+            me->error = T_COSE_ERR_TOO_MANY_PARAMETERS;
+        }
+        return slot;
+    }
+
+    offset = template_append(me, (struct q_useful_buf_c){NULL, len});
+    if(me->error != T_COSE_SUCCESS) {
+        return slot;
+    }
+
+    me->slot_offset[slot]  = offset;
+    me->slot_len[slot]     = len;
+    me->slot_is_uint[slot] = is_uint;
+    me->num_slots++;
+
+    return slot;
+}
+
+
+/*
+ * Public function. See t_cose_cwt_template.h
+ */
+void
+t_cose_cwt_template_init(struct t_cose_cwt_template *me,
+                         struct q_useful_buf         buffer)
+{
+    memset(me, 0, sizeof(*me));
+    me->buffer = buffer;
+    me->error  = T_COSE_SUCCESS;
+
+    /* Room for the one-byte map head */
+    template_append(me, (struct q_useful_buf_c){NULL, 1});
+}
+
+
+/*
+ * Public function. See t_cose_cwt_template.h
+ */
+void
+t_cose_cwt_template_add_int(struct t_cose_cwt_template *me,
+                            int64_t                     label,
+                            int64_t                     value)
+{
+    template_append_label(me, label);
+    template_append_int(me, value);
+}
+
+
+/*
+ * Public function. See t_cose_cwt_template.h
+ */
+void
+t_cose_cwt_template_add_tstr(struct t_cose_cwt_template *me,
+                             int64_t                     label,
+                             const char                 *value)
+{
+    template_append_label(me, label);
+    template_append_head(me, CBOR_MAJOR_TYPE_TEXT_STRING, strlen(value));
+    template_append(me, (struct q_useful_buf_c){value, strlen(value)});
+}
+
+
+/*
+ * Public function. See t_cose_cwt_template.h
+ */
+void
+t_cose_cwt_template_add_bstr(struct t_cose_cwt_template *me,
+                             int64_t                     label,
+                             struct q_useful_buf_c       value)
+{
+    template_append_label(me, label);
+    template_append_head(me, CBOR_MAJOR_TYPE_BYTE_STRING, value.len);
+    template_append(me, value);
+}
+
+
+/*
+ * Public function. See t_cose_cwt_template.h
+ */
+size_t
+t_cose_cwt_template_add_uint_slot(struct t_cose_cwt_template *me,
+                                  int64_t                     label)
+{
+    /* Major type 0 with a four-byte argument */
+    static const uint8_t uint32_head = (CBOR_MAJOR_TYPE_POSITIVE_INT << 5) | 26;
+
+    template_append_label(me, label);
+    template_append(me, (struct q_useful_buf_c){&uint32_head, 1});
+    return template_add_slot(me, 4, true);
+}
+
+
+/*
+ * Public function. See t_cose_cwt_template.h
+ */
+size_t
+t_cose_cwt_template_add_bstr_slot(struct t_cose_cwt_template *me,
+                                  int64_t                     label,
+                                  size_t                      len)
+{
+    template_append_label(me, label);
+    /* The length is fixed so the head never changes */
+    template_append_head(me, CBOR_MAJOR_TYPE_BYTE_STRING, len);
+    return template_add_slot(me, len, false);
+}
+
+
+/*
+ * Public function. See t_cose_cwt_template.h
+ */
+enum t_cose_err_t
+t_cose_cwt_template_finish(struct t_cose_cwt_template *me,
+                           struct q_useful_buf_c      *payload)
+{
+    *payload = NULL_Q_USEFUL_BUF_C;
+
+    if(me->error != T_COSE_SUCCESS) {
+        return me->error;
+    }
+
+    /* Fewer than 24 so the head is one byte */
+    ((uint8_t *)me->buffer.ptr)[0] = (uint8_t)((CBOR_MAJOR_TYPE_MAP << 5) | me->num_claims);
+
+    *payload = (struct q_useful_buf_c){me->buffer.ptr, me->len};
+
+    return T_COSE_SUCCESS;
+}
@@ -0,0 +1,141 @@
+/*
+ *  t_cose_hash_file.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "t_cose/t_cose_hash_file.h"
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "t_cose_crypto.h"
+
+
+/**
+ * \file t_cose_hash_file.c
+ *
+ * \brief Memory-mapped hashing of files for hash envelopes.
+ */
+
+
+/**
+ * \brief Map a file to hash it.
+ *
+ * \param[in] path     Name of the file.
+ * \param[out] mapped  The file's bytes. \c ptr is \c NULL for an
+ *                     empty file, which can't be mapped.
+ *
+ * \return \ref T_COSE_SUCCESS or \ref T_COSE_ERR_FILE_READ.
+ *
+ * The descriptor is closed before returning as the mapping doesn't
+ * need it.
+ */
+static enum t_cose_err_t
+map_file(const char *path, struct q_useful_buf_c *mapped)
+{
+    int         fd;
+    struct stat file_stat;
+    void       *bytes;
+
+    fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        return T_COSE_ERR_FILE_READ;
+    }
+
+    bytes = NULL;
+    if(fstat(fd, &file_stat) != 0 ||
+       !S_ISREG(file_stat.st_mode) ||
+       (uintmax_t)file_stat.st_size > SIZE_MAX) {
+        close(fd);
+        return T_COSE_ERR_FILE_READ;
+    }
+
+    if(file_stat.st_size > 0) {
+        bytes = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(bytes == MAP_FAILED) {
+            close(fd);
+            return T_COSE_ERR_FILE_READ;
+        }
+        /* Only advice, so whether it worked doesn't matter */
+        (void)madvise(bytes, (size_t)file_stat.st_size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    *mapped = (struct q_useful_buf_c){bytes, (size_t)file_stat.st_size};
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * Public function. See t_cose_hash_file.h
+ */
+enum t_cose_err_t
+t_cose_hash_files(int32_t                       hash_alg_id,
+                  struct t_cose_hash_file_item *items,
+                  size_t                        num_items)
+{
+    enum t_cose_err_t                    return_value;
+    enum t_cose_err_t                    err;
+    struct q_useful_buf_c                mapped[T_COSE_BATCH_GROUP_SIZE];
+    struct t_cose_crypto_hash_batch_item batch[T_COSE_BATCH_GROUP_SIZE];
+    struct t_cose_hash_file_item        *batch_file[T_COSE_BATCH_GROUP_SIZE];
+    size_t                               num_batch;
+    size_t                               group;
+    size_t                               i;
+
+    return_value = T_COSE_SUCCESS;
+    for(; num_items > 0; num_items -= group, items += group) {
+        group = num_items < T_COSE_BATCH_GROUP_SIZE ? num_items : T_COSE_BATCH_GROUP_SIZE;
+
+        /* Map all of the group first so the kernel reads ahead in
+         * each of them while they are hashed */
+        num_batch = 0;
+        for(i = 0; i < group; i++) {
+            items[i].hash = NULL_Q_USEFUL_BUF_C;
+            items[i].err  = map_file(items[i].path, &mapped[num_batch]);
+            if(items[i].err != T_COSE_SUCCESS) {
+                if(return_value == T_COSE_SUCCESS) {
+                    return_value = items[i].err;
+                }
+                continue;
+            }
+            batch[num_batch].pieces          = &mapped[num_batch];
+            batch[num_batch].num_pieces      = 1;
+            batch[num_batch].buffer_for_hash = items[i].buffer_for_hash;
+            batch_file[num_batch]            = &items[i];
+            num_batch++;
+        }
+
+        err = T_COSE_SUCCESS;
+        if(num_batch > 0) {
+            err = t_cose_crypto_hash_batch(hash_alg_id, batch, num_batch);
+            if(err != T_COSE_SUCCESS && return_value == T_COSE_SUCCESS) {
+                return_value = err;
+            }
+        }
+
+        for(i = 0; i < num_batch; i++) {
+            batch_file[i]->err = err;
+            if(err == T_COSE_SUCCESS) {
+                batch_file[i]->hash = batch[i].hash;
+            }
+            if(mapped[i].ptr != NULL) {
+                munmap((void *)(uintptr_t)mapped[i].ptr, mapped[i].len);
+            }
+        }
+    }
+
+    return return_value;
+}
+
+#endif /* T_COSE_DISABLE_HASH_FILE */
@@ -0,0 +1,323 @@
+/*
+ *  t_cose_nested.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdbool.h>
+#include "t_cose/t_cose_nested.h"
+#include "qcbor/qcbor_common.h"
+
+
+/**
+ * \file t_cose_nested.c
+ *
+ * \brief Verification of tokens nested in tokens.
+ *
+ * The tree is built breadth first in the results array. For each
+ * level the payload of every token that verified is indexed and the
+ * paths are resolved into new results. The index storage is reused
+ * for the next payload as the results only point into the payloads.
+ * Then the new results are verified in batches, one path at a time
+ * as each path has its own verifier.
+ */
+
+
+/**
+ * \brief Add a result for a claim found by a path.
+ *
+ * \param[in] results      The results.
+ * \param[in] max_results  The number of \c results.
+ * \param[in,out] count    The number of results filled in.
+ * \param[in] parent       The result whose payload the claim is in.
+ * \param[in] path         The path that found it.
+ * \param[in] index        The index of the parent's payload.
+ * \param[in] entry        The claim.
+ * \param[in] err          \ref T_COSE_SUCCESS if the claim is to be
+ *                         verified or the error for it.
+ *
+ * \return false if \c results is full.
+ */
+static bool
+add_result(struct t_cose_nested_result            *results,
+           size_t                                  max_results,
+           size_t                                 *count,
+           size_t                                  parent,
+           size_t                                  path,
+           const struct t_cose_claims_index       *index,
+           const struct t_cose_claims_index_entry *entry,
+           enum t_cose_err_t                       err)
+{
+    struct t_cose_nested_result *result;
+
+    if(*count >= max_results) {
+        return false;
+    }
+    result = &results[*count];
+    (*count)++;
+
+    result->parent     = parent;
+    result->path       = path;
+    result->depth      = results[parent].depth + 1;
+    result->label      = 0;
+    result->label_tstr = NULL_Q_USEFUL_BUF_C;
+    if(entry->label_type == T_COSE_CLAIMS_INDEX_LABEL_TSTR) {
+        result->label_tstr = (struct q_useful_buf_c){
+            (const uint8_t *)index->payload.ptr + entry->label, entry->label_len};
+    } else {
+        result->label = entry->label;
+    }
+    result->token   = NULL_Q_USEFUL_BUF_C;
+    result->payload = NULL_Q_USEFUL_BUF_C;
+    result->err     = err;
+    if(err == T_COSE_SUCCESS) {
+        result->err = t_cose_claims_index_get_string(index, entry, &result->token);
+    }
+
+    return true;
+}
+
+
+/**
+ * \brief Add results for the tokens a path leads to in one payload.
+ *
+ * \return false if \c results is full.
+ */
+static bool
+resolve_path(const struct t_cose_nested_path  *path,
+             size_t                            path_number,
+             size_t                            parent,
+             const struct t_cose_claims_index *index,
+             struct t_cose_nested_result      *results,
+             size_t                            max_results,
+             size_t                           *count)
+{
+    const struct t_cose_claims_index_entry *entry;
+    const struct t_cose_claims_index_entry *claim;
+    size_t                                  i;
+
+    entry = NULL;
+    for(i = 0; i < path->num_labels; i++) {
+        if(!q_useful_buf_c_is_null(path->labels[i].tstr)) {
+            entry = t_cose_claims_index_find_tstr(index, entry, path->labels[i].tstr);
+        } else {
+            entry = t_cose_claims_index_find(index, entry, path->labels[i].label);
+        }
+        if(entry == NULL) {
+            /* Not in this payload */
+            return true;
+        }
+    }
+
+    if(!(path->flags & T_COSE_NESTED_EACH)) {
+        if(entry == NULL) {
+            /* No labels; the payload can't be its own token */
+            return true;
+        }
+        return add_result(results, max_results, count, parent, path_number,
+                          index, entry,
+                          entry->major_type == CBOR_MAJOR_TYPE_BYTE_STRING ?
+                              T_COSE_SUCCESS : T_COSE_ERR_CWT_FORMAT);
+    }
+
+    if(entry != NULL && entry->major_type != CBOR_MAJOR_TYPE_MAP) {
+        return add_result(results, max_results, count, parent, path_number,
+                          index, entry, T_COSE_ERR_CWT_FORMAT);
+    }
+    for(claim = t_cose_claims_index_next(index, entry, NULL);
+        claim != NULL;
+        claim = t_cose_claims_index_next(index, entry, claim)) {
+        if(claim->major_type != CBOR_MAJOR_TYPE_BYTE_STRING) {
+            continue;
+        }
+        if(!add_result(results, max_results, count, parent, path_number,
+                       index, claim, T_COSE_SUCCESS)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * \brief Verify the results of one path in one level.
+ *
+ * \param[in] path        The path the results were found by.
+ * \param[in] path_number Its index in the configuration.
+ * \param[in] config      The configuration, for the dispatch function.
+ * \param[in,out] call    The state to verify with when there is no
+ *                        dispatch function.
+ * \param[in,out] results The results of the level.
+ * \param[in] count       The number of \c results.
+ */
+static void
+verify_path(const struct t_cose_nested_path   *path,
+            size_t                             path_number,
+            const struct t_cose_nested_config *config,
+            struct t_cose_sign1_verify_call   *call,
+            struct t_cose_nested_result       *results,
+            size_t                             count)
+{
+    struct t_cose_sign1_verify_batch_item items[T_COSE_BATCH_GROUP_SIZE];
+    size_t                                numbers[T_COSE_BATCH_GROUP_SIZE];
+    size_t                                num_items;
+    size_t                                i;
+    size_t                                j;
+
+    i = 0;
+    while(i < count) {
+        num_items = 0;
+        for(; i < count && num_items < T_COSE_BATCH_GROUP_SIZE; i++) {
+            if(results[i].path != path_number || results[i].err != T_COSE_SUCCESS) {
+                continue;
+            }
+            items[num_items].cose_sign1 = results[i].token;
+            items[num_items].aad        = NULL_Q_USEFUL_BUF_C;
+            numbers[num_items]          = i;
+            num_items++;
+        }
+        if(num_items == 0) {
+            break;
+        }
+
+        if(config->dispatch != NULL) {
+            (void)config->dispatch(config->dispatch_ctx, path->verifier, items, num_items);
+        } else {
+            (void)t_cose_sign1_verifier_verify_batch(path->verifier, call, items, num_items);
+        }
+
+        for(j = 0; j < num_items; j++) {
+            results[numbers[j]].err = items[j].err;
+            if(items[j].err == T_COSE_SUCCESS) {
+                results[numbers[j]].payload    = items[j].payload;
+                results[numbers[j]].parameters = items[j].parameters;
+            }
+        }
+    }
+}
+
+
+/*
+ * Public function. See t_cose_nested.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_nested(const struct t_cose_sign1_verifier *verifier,
+                                    struct t_cose_sign1_verify_call    *call,
+                                    struct q_useful_buf_c               sign1,
+                                    const struct t_cose_nested_config  *config,
+                                    struct t_cose_nested_result        *results,
+                                    size_t                              max_results,
+                                    size_t                             *num_results)
+{
+    enum t_cose_err_t          return_value;
+    struct t_cose_claims_index index;
+    size_t                     level_start;
+    size_t                     level_end;
+    size_t                     count;
+    size_t                     node;
+    size_t                     path;
+    size_t                     i;
+    bool                       full;
+
+    *num_results = 0;
+    if(max_results == 0) {
+        return_value = T_COSE_ERR_TOO_SMALL;
+        goto Done;
+    }
+
+    results[0].parent     = SIZE_MAX;
+    results[0].path       = 0;
+    results[0].depth      = 0;
+    results[0].label      = 0;
+    results[0].label_tstr = NULL_Q_USEFUL_BUF_C;
+    results[0].token      = sign1;
+    results[0].payload    = NULL_Q_USEFUL_BUF_C;
+    results[0].err        = t_cose_sign1_verifier_verify(verifier,
+                                                         call,
+                                                         sign1,
+                                                         NULL_Q_USEFUL_BUF_C,
+                                                         &results[0].payload,
+                                                         &results[0].parameters);
+    count = 1;
+    if(results[0].err != T_COSE_SUCCESS) {
+        *num_results = count;
+        return_value = results[0].err;
+        goto Done;
+    }
+
+    full        = false;
+    level_start = 0;
+    level_end   = 1;
+    while(level_start < level_end &&
+          results[level_start].depth < config->max_depth &&
+          !full) {
+        /* Find the tokens in this level's payloads */
+        for(node = level_start; node < level_end && !full; node++) {
+            if(results[node].err != T_COSE_SUCCESS) {
+                continue;
+            }
+            results[node].err = t_cose_claims_index_build(&index,
+                                                          results[node].payload,
+                                                          config->index_entries,
+                                                          config->max_index_entries);
+            if(results[node].err != T_COSE_SUCCESS) {
+                continue;
+            }
+            for(path = 0; path < config->num_paths && !full; path++) {
+                full = !resolve_path(&config->paths[path], path, node, &index,
+                                     results, max_results, &count);
+            }
+        }
+
+        /* Verify them */
+        for(path = 0; path < config->num_paths; path++) {
+            verify_path(&config->paths[path], path, config, call,
+                        &results[level_end], count - level_end);
+        }
+
+        level_start = level_end;
+        level_end   = count;
+    }
+
+    *num_results = count;
+    if(full) {
+        return_value = T_COSE_ERR_TOO_SMALL;
+        goto Done;
+    }
+    return_value = T_COSE_SUCCESS;
+    for(i = 0; i < count; i++) {
+        if(results[i].err != T_COSE_SUCCESS) {
+            return_value = results[i].err;
+            break;
+        }
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_nested.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_nested(struct t_cose_sign1_verify_ctx    *me,
+                           struct q_useful_buf_c              sign1,
+                           const struct t_cose_nested_config *config,
+                           struct t_cose_nested_result       *results,
+                           size_t                             max_results,
+                           size_t                            *num_results)
+{
+    return t_cose_sign1_verifier_verify_nested(&me->verifier,
+                                               &me->call,
+                                               sign1,
+                                               config,
+                                               results,
+                                               max_results,
+                                               num_results);
+}
@@ -85,21 +85,6 @@ Done:
 }
 
 
-/**
- * \brief Indicate whether label list is clear or not.
- *
- * \param[in,out] list  The list to check.
- *
- * \return true if the list is clear.
- */
-inline static bool
-is_label_list_clear(const struct t_cose_label_list *list)
-{
-    return list->int_labels[0] == 0 &&
-               q_useful_buf_c_is_null_or_empty(list->tstr_labels[0]);
-}
-
-
 /**
  * \brief Decode the parameter containing the labels of parameters considered
  *        critical.
@@ -252,6 +237,141 @@ Done:
 }
 
 
+/**
+ * \brief Decode the x5chain parameter.
+ *
+ * \param[in] decode_context  The decoder, entered into the parameters map.
+ * \param[in] x5chain_item    The parameter's item from the map.
+ * \param[out] parameters     Where to put the certificates.
+ *
+ * \retval T_COSE_ERR_PARAMETER_CBOR        Not a certificate or an array
+ *                                          of them.
+ * \retval T_COSE_ERR_CBOR_NOT_WELL_FORMED  The array is not well formed.
+ *
+ * The certificates of an array are consecutive byte strings, so they
+ * are returned as one span from the start of the first to the end of
+ * the last. Tags would come between them, so they are not allowed.
+ */
+static enum t_cose_err_t
+decode_x5chain(QCBORDecodeContext       *decode_context,
+               const QCBORItem          *x5chain_item,
+               struct t_cose_parameters *parameters)
+{
+    QCBORItem             item;
+    QCBORError            cbor_result;
+    struct q_useful_buf_c leaf;
+    struct q_useful_buf_c last;
+    enum t_cose_err_t     return_value;
+
+    if(x5chain_item->uDataType == QCBOR_TYPE_BYTE_STRING) {
+        /* Just the one certificate */
+        if(x5chain_item->val.string.len == 0) {
+            return_value = T_COSE_ERR_PARAMETER_CBOR;
+            goto Done;
+        }
+        parameters->x5chain      = x5chain_item->val.string;
+        parameters->x5chain_leaf = x5chain_item->val.string;
+        return_value = T_COSE_SUCCESS;
+        goto Done;
+    }
+    if(x5chain_item->uDataType != QCBOR_TYPE_ARRAY) {
+        return_value = T_COSE_ERR_PARAMETER_CBOR;
+        goto Done;
+    }
+
+    QCBORDecode_EnterArrayFromMapN(decode_context, COSE_HEADER_PARAM_X5CHAIN);
+    if(QCBORDecode_GetAndResetError(decode_context) != QCBOR_SUCCESS) {
+        return_value = T_COSE_ERR_PARAMETER_CBOR;
+        goto Done;
+    }
+
+    leaf = NULL_Q_USEFUL_BUF_C;
+    last = NULL_Q_USEFUL_BUF_C;
+    while(1) {
+        cbor_result = QCBORDecode_GetNext(decode_context, &item);
+        if(cbor_result == QCBOR_ERR_NO_MORE_ITEMS) {
+            break;
+        }
+        if(cbor_result != QCBOR_SUCCESS) {
+            return_value = T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+            goto Done;
+        }
+        if(item.uDataType != QCBOR_TYPE_BYTE_STRING ||
+           item.val.string.len == 0 ||
+           QCBORDecode_GetNthTag(decode_context, &item, 0) != CBOR_TAG_INVALID64) {
+            return_value = T_COSE_ERR_PARAMETER_CBOR;
+            goto Done;
+        }
+        if(q_useful_buf_c_is_null(leaf)) {
+            leaf = item.val.string;
+        }
+        last = item.val.string;
+    }
+
+    QCBORDecode_ExitArray(decode_context);
+
+    if(q_useful_buf_c_is_null(leaf)) {
+        /* An empty chain */
+        return_value = T_COSE_ERR_PARAMETER_CBOR;
+        goto Done;
+    }
+    parameters->x5chain.ptr  = leaf.ptr;
+    parameters->x5chain.len  = (size_t)((const uint8_t *)last.ptr - (const uint8_t *)leaf.ptr) +
+                               last.len;
+    parameters->x5chain_leaf = leaf;
+    return_value = T_COSE_SUCCESS;
+
+Done:
+    return return_value;
+}
+
+
+/**
+ * \brief Decode the x5t parameter.
+ *
+ * \param[in] decode_context  The decoder, entered into the parameters map.
+ * \param[out] parameters     Where to put the hash algorithm and hash.
+ *
+ * \retval T_COSE_ERR_PARAMETER_CBOR  Not an array of an integer hash
+ *                                    algorithm and a byte string hash.
+ */
+static enum t_cose_err_t
+decode_x5t(QCBORDecodeContext       *decode_context,
+           struct t_cose_parameters *parameters)
+{
+    QCBORItem         alg;
+    QCBORItem         hash;
+    QCBORItem         extra;
+    enum t_cose_err_t return_value;
+
+    QCBORDecode_EnterArrayFromMapN(decode_context, COSE_HEADER_PARAM_X5T);
+    if(QCBORDecode_GetAndResetError(decode_context) != QCBOR_SUCCESS ||
+       QCBORDecode_GetNext(decode_context, &alg) != QCBOR_SUCCESS ||
+       QCBORDecode_GetNext(decode_context, &hash) != QCBOR_SUCCESS ||
+       QCBORDecode_GetNext(decode_context, &extra) != QCBOR_ERR_NO_MORE_ITEMS) {
+        return_value = T_COSE_ERR_PARAMETER_CBOR;
+        goto Done;
+    }
+    QCBORDecode_ExitArray(decode_context);
+
+    if(alg.uDataType != QCBOR_TYPE_INT64 ||
+       alg.val.int64 == COSE_ALGORITHM_RESERVED ||
+       alg.val.int64 > INT32_MAX ||
+       alg.val.int64 < INT32_MIN ||
+       hash.uDataType != QCBOR_TYPE_BYTE_STRING ||
+       hash.val.string.len == 0) {
+        return_value = T_COSE_ERR_PARAMETER_CBOR;
+        goto Done;
+    }
+    parameters->x5t_alg  = (int32_t)alg.val.int64;
+    parameters->x5t_hash = hash.val.string;
+    return_value = T_COSE_SUCCESS;
+
+Done:
+    return return_value;
+}
+
+
 struct cb_context {
     struct t_cose_label_list *unknown_labels;
     enum t_cose_err_t         return_value;
@@ -326,7 +446,9 @@ static QCBORError header_parameter_callback(void *pCallbackCtx, const QCBORItem
  *                                            integer. This implementation
  *                                            doesn't support string algorithm
  *                                            IDs.
- * \retval T_COSE_ERR_BAD_CONTENT_TYPE        Error in content type parameter.
+ * \retval T_COSE_ERR_BAD_CONTENT_TYPE        Error in content type or
+ *                                            preimage content type
+ *                                            parameter.
  * \retval T_COSE_ERR_UNKNOWN_CRITICAL_PARAMETER   A label marked critical is
  *                                                 present and not understood.
  *
@@ -346,10 +468,10 @@ parse_cose_header_parameters(QCBORDecodeContext        *decode_context,
     /* Aproximate stack usage
      *                                             64-bit      32-bit
      *   local vars                                    32          16
-     *   header_items                                 336         312
+     *   header_items                                 560         520
      *   MAX (GetItemsInMapWithCallback+CB 432  316
      *        decode_critical               88   68)  432         316
-     *   TOTAL                                        768         628
+     *   TOTAL                                        992         836
      */
     enum t_cose_err_t  return_value;
     QCBORError         qcbor_result;
@@ -363,7 +485,11 @@ parse_cose_header_parameters(QCBORDecodeContext        *decode_context,
 #define IV_INDEX             2
 #define PARTIAL_IV_INDEX     3
 #define CONTENT_TYPE         4
-#define END_INDEX            5
+#define PAYLOAD_HASH_ALG     5
+#define PREIMAGE_CONTENT     6
+#define X5CHAIN_INDEX        7
+#define X5T_INDEX            8
+#define END_INDEX            9
     QCBORItem         header_items[END_INDEX+1];
 
     QCBORDecode_EnterMap(decode_context, NULL);
@@ -388,6 +514,22 @@ parse_cose_header_parameters(QCBORDecodeContext        *decode_context,
     header_items[CONTENT_TYPE].uLabelType  = QCBOR_TYPE_INT64;
     header_items[CONTENT_TYPE].uDataType   = QCBOR_TYPE_ANY;
 
+    header_items[PAYLOAD_HASH_ALG].label.int64 = COSE_HEADER_PARAM_PAYLOAD_HASH_ALG;
+    header_items[PAYLOAD_HASH_ALG].uLabelType  = QCBOR_TYPE_INT64;
+    header_items[PAYLOAD_HASH_ALG].uDataType   = QCBOR_TYPE_INT64;
+
+    header_items[PREIMAGE_CONTENT].label.int64 = COSE_HEADER_PARAM_PREIMAGE_CONTENT_TYPE;
+    header_items[PREIMAGE_CONTENT].uLabelType  = QCBOR_TYPE_INT64;
+    header_items[PREIMAGE_CONTENT].uDataType   = QCBOR_TYPE_ANY;
+
+    header_items[X5CHAIN_INDEX].label.int64 = COSE_HEADER_PARAM_X5CHAIN;
+    header_items[X5CHAIN_INDEX].uLabelType  = QCBOR_TYPE_INT64;
+    header_items[X5CHAIN_INDEX].uDataType   = QCBOR_TYPE_ANY;
+
+    header_items[X5T_INDEX].label.int64 = COSE_HEADER_PARAM_X5T;
+    header_items[X5T_INDEX].uLabelType  = QCBOR_TYPE_INT64;
+    header_items[X5T_INDEX].uDataType   = QCBOR_TYPE_ANY;
+
     header_items[END_INDEX].uLabelType  = QCBOR_TYPE_NONE;
 
     /* This call takes care of duplicate detection in the map itself.
@@ -496,6 +638,70 @@ parse_cose_header_parameters(QCBORDecodeContext        *decode_context,
     }
 #endif
 
+    /* COSE_HEADER_PARAM_PAYLOAD_HASH_ALG */
+    if(header_items[PAYLOAD_HASH_ALG].uDataType != QCBOR_TYPE_NONE) {
+        if(critical_labels == NULL) {
+            /* What the payload is a hash of must be protected */
+            return_value = T_COSE_ERR_PARAMETER_NOT_PROTECTED;
+            goto Done;
+        }
+        if(header_items[PAYLOAD_HASH_ALG].val.int64 == COSE_ALGORITHM_RESERVED ||
+           header_items[PAYLOAD_HASH_ALG].val.int64 > INT32_MAX ||
+           header_items[PAYLOAD_HASH_ALG].val.int64 < INT32_MIN) {
+            return_value = T_COSE_ERR_NON_INTEGER_ALG_ID;
+            goto Done;
+        }
+        parameters->payload_hash_alg = (int32_t)header_items[PAYLOAD_HASH_ALG].val.int64;
+    }
+
+    /* COSE_HEADER_PARAM_PREIMAGE_CONTENT_TYPE */
+    if(header_items[PREIMAGE_CONTENT].uDataType != QCBOR_TYPE_NONE) {
+        if(critical_labels == NULL) {
+            return_value = T_COSE_ERR_PARAMETER_NOT_PROTECTED;
+            goto Done;
+        }
+        if(header_items[PREIMAGE_CONTENT].uDataType == QCBOR_TYPE_TEXT_STRING) {
+            parameters->preimage_content_type_tstr = header_items[PREIMAGE_CONTENT].val.string;
+        } else if(header_items[PREIMAGE_CONTENT].uDataType == QCBOR_TYPE_INT64 &&
+                  header_items[PREIMAGE_CONTENT].val.int64 >= 0 &&
+                  header_items[PREIMAGE_CONTENT].val.int64 <= UINT16_MAX) {
+            parameters->preimage_content_type_uint = (uint32_t)header_items[PREIMAGE_CONTENT].val.int64;
+        } else {
+            return_value = T_COSE_ERR_BAD_CONTENT_TYPE;
+            goto Done;
+        }
+    }
+
+    /* COSE_HEADER_PARAM_X5CHAIN. It may be protected or not. */
+    if(header_items[X5CHAIN_INDEX].uDataType != QCBOR_TYPE_NONE) {
+        if(!q_useful_buf_c_is_null(parameters->x5chain)) {
+            return_value = T_COSE_ERR_DUPLICATE_PARAMETER;
+            goto Done;
+        }
+        return_value = decode_x5chain(decode_context,
+                                      &header_items[X5CHAIN_INDEX],
+                                      parameters);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+    }
+
+    /* COSE_HEADER_PARAM_X5T */
+    if(header_items[X5T_INDEX].uDataType != QCBOR_TYPE_NONE) {
+        if(parameters->x5t_alg != T_COSE_UNSET_ALGORITHM_ID) {
+            return_value = T_COSE_ERR_DUPLICATE_PARAMETER;
+            goto Done;
+        }
+        if(header_items[X5T_INDEX].uDataType != QCBOR_TYPE_ARRAY) {
+            return_value = T_COSE_ERR_PARAMETER_CBOR;
+            goto Done;
+        }
+        return_value = decode_x5t(decode_context, parameters);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+    }
+
     /* COSE_HEADER_PARAM_CRIT */
     return_value = decode_critical_parameter(decode_context, critical_labels);
 
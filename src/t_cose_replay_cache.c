@@ -0,0 +1,275 @@
+/*
+ *  t_cose_replay_cache.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include "t_cose/t_cose_replay_cache.h"
+#include "t_cose_crypto.h"
+
+
+/**
+ * \file t_cose_replay_cache.c
+ *
+ * \brief Lock-free detection of replayed tokens.
+ *
+ * Each bucket is an open addressing hash table with linear probing.
+ * A slot holds a token's fingerprint in the top 40 bits and, in the
+ * bottom 24, which turn of the ring of buckets it was entered in. A
+ * slot from an earlier turn is empty. Nothing is ever deleted within
+ * a turn so a probe can stop at the first empty slot, and a slot is
+ * only ever filled with a compare and swap so two threads entering
+ * the same token can't both succeed.
+ *
+ * A thread can fall behind another that moves its bucket on to a
+ * later turn. Turns are compared modulo 2^24 so it never takes a slot
+ * from a later turn, and it checks the bucket is still for its time
+ * after filling a slot. Either way its token has expired.
+ */
+
+
+/* The bits of a slot for the turn of the ring */
+#define REPLAY_TURN_MASK 0xffffffULL
+
+/* Longer probes than this mean the bucket is too full */
+#define REPLAY_MAX_PROBES 128
+
+/* Turns this far ahead modulo 2^24 are later, the rest earlier */
+#define REPLAY_TURN_HALF 0x800000ULL
+
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/* Sequentially consistent so the recheck of a bucket's time after
+ * filling a slot sees any move of it ordered before the fill */
+
+static inline uint64_t
+replay_load(uint64_t *location)
+{
+    return __atomic_load_n(location, __ATOMIC_SEQ_CST);
+}
+
+static inline bool
+replay_compare_swap(uint64_t *location, uint64_t *expected, uint64_t desired)
+{
+    return __atomic_compare_exchange_n(location,
+                                       expected,
+                                       desired,
+                                       false,
+                                       __ATOMIC_SEQ_CST,
+                                       __ATOMIC_SEQ_CST);
+}
+
+#else /* __GNUC__ || __clang__ */
+
+/* One thread at a time as documented in t_cose_replay_cache.h */
+
+static inline uint64_t
+replay_load(uint64_t *location)
+{
+    return *location;
+}
+
+static inline bool
+replay_compare_swap(uint64_t *location, uint64_t *expected, uint64_t desired)
+{
+    if(*location != *expected) {
+        *expected = *location;
+        return false;
+    }
+    *location = desired;
+    return true;
+}
+
+#endif /* __GNUC__ || __clang__ */
+
+
+/**
+ * \brief Get the slot index and fingerprint of a token.
+ *
+ * \param[in] id            What identifies the token.
+ * \param[out] index        Where to start probing, before masking.
+ * \param[out] fingerprint  40 bits that are never all zero.
+ */
+static enum t_cose_err_t
+replay_fingerprint(struct q_useful_buf_c  id,
+                   uint64_t              *index,
+                   uint64_t              *fingerprint)
+{
+    Q_USEFUL_BUF_MAKE_STACK_UB(hash_buffer, T_COSE_CRYPTO_SHA256_SIZE);
+    struct t_cose_crypto_hash  hash_ctx;
+    struct q_useful_buf_c      hash;
+    const uint8_t             *bytes;
+    enum t_cose_err_t          return_value;
+    int                        i;
+
+    return_value = t_cose_crypto_hash_start(&hash_ctx, T_COSE_ALGORITHM_SHA_256);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    t_cose_crypto_hash_update(&hash_ctx, id);
+    return_value = t_cose_crypto_hash_finish(&hash_ctx, hash_buffer, &hash);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    bytes  = hash.ptr;
+    *index = 0;
+    for(i = 0; i < 8; i++) {
+        *index = (*index << 8) | bytes[i];
+    }
+    *fingerprint = 0;
+    for(i = 8; i < 13; i++) {
+        *fingerprint = (*fingerprint << 8) | bytes[i];
+    }
+    if(*fingerprint == 0) {
+        *fingerprint = 1;
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_replay_cache.h
+ */
+enum t_cose_err_t
+t_cose_replay_cache_init(struct t_cose_replay_cache *me,
+                         uint64_t                   *slots,
+                         size_t                      num_slots,
+                         uint32_t                    ttl_seconds,
+                         uint32_t                    num_buckets)
+{
+    size_t slots_per_bucket;
+
+    if(ttl_seconds == 0 || num_buckets == 0 || num_buckets > T_COSE_REPLAY_MAX_BUCKETS) {
+        return T_COSE_ERR_INVALID_ARGUMENT;
+    }
+
+    /* A power of two so the index is masked instead of divided */
+    slots_per_bucket = num_slots / (num_buckets + 1);
+    if(slots_per_bucket == 0) {
+        return T_COSE_ERR_TOO_SMALL;
+    }
+    while(slots_per_bucket & (slots_per_bucket - 1)) {
+        slots_per_bucket &= slots_per_bucket - 1;
+    }
+
+    me->slots            = slots;
+    me->slots_per_bucket = slots_per_bucket;
+    me->max_probes       = slots_per_bucket < REPLAY_MAX_PROBES ?
+                               (uint32_t)slots_per_bucket : REPLAY_MAX_PROBES;
+    me->num_buckets      = num_buckets + 1;
+    me->bucket_seconds   = ttl_seconds / num_buckets + (ttl_seconds % num_buckets != 0);
+
+    memset(slots, 0, slots_per_bucket * me->num_buckets * sizeof(uint64_t));
+    memset(me->bucket_times, 0, sizeof(me->bucket_times));
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * Public function. See t_cose_replay_cache.h
+ */
+enum t_cose_err_t
+t_cose_replay_cache_check(struct t_cose_replay_cache *me,
+                          struct q_useful_buf_c       id,
+                          int64_t                     expires,
+                          int64_t                     now)
+{
+    enum t_cose_err_t return_value;
+    uint64_t          index;
+    uint64_t          fingerprint;
+    uint64_t          now_time;
+    uint64_t          token_time;
+    uint64_t          bucket_time;
+    uint64_t          turn;
+    uint64_t          entry;
+    uint64_t          slot;
+    uint64_t          slot_turn;
+    uint64_t         *bucket;
+    uint64_t         *bucket_time_ptr;
+    uint32_t          probes;
+
+    if(now < 0) {
+        return_value = T_COSE_ERR_INVALID_ARGUMENT;
+        goto Done;
+    }
+    if(expires <= now) {
+        return_value = T_COSE_ERR_CWT_EXPIRED;
+        goto Done;
+    }
+
+    /* Times are in units of a bucket from here on */
+    now_time   = (uint64_t)now / me->bucket_seconds;
+    token_time = (uint64_t)expires / me->bucket_seconds;
+    if(token_time - now_time >= me->num_buckets) {
+        /* Its bucket still has tokens that haven't expired */
+        return_value = T_COSE_ERR_REPLAY_CACHE_FULL;
+        goto Done;
+    }
+
+    return_value = replay_fingerprint(id, &index, &fingerprint);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    /* Moving a bucket on to a later time evicts everything in it */
+    bucket          = me->slots + (token_time % me->num_buckets) * me->slots_per_bucket;
+    bucket_time_ptr = &me->bucket_times[token_time % me->num_buckets];
+    bucket_time     = replay_load(bucket_time_ptr);
+    while(bucket_time < token_time &&
+          !replay_compare_swap(bucket_time_ptr, &bucket_time, token_time)) {
+        /* Another thread moved it; look again */
+    }
+    if(bucket_time > token_time) {
+        /* Only happens once the token has expired */
+        return_value = T_COSE_ERR_CWT_EXPIRED;
+        goto Done;
+    }
+
+    turn  = (token_time / me->num_buckets) & REPLAY_TURN_MASK;
+    entry = (fingerprint << 24) | turn;
+    index &= me->slots_per_bucket - 1;
+    for(probes = 0; probes < me->max_probes; probes++) {
+        slot = replay_load(&bucket[index]);
+        for(;;) {
+            slot_turn = slot & REPLAY_TURN_MASK;
+            if(slot != 0 && slot_turn == turn) {
+                if(slot == entry) {
+                    return_value = T_COSE_ERR_CWT_REPLAYED;
+                    goto Done;
+                }
+                break;
+            }
+            if(slot != 0 && ((slot_turn - turn) & REPLAY_TURN_MASK) < REPLAY_TURN_HALF) {
+                /* The bucket was moved on after it was checked above */
+                return_value = T_COSE_ERR_CWT_EXPIRED;
+                goto Done;
+            }
+            if(replay_compare_swap(&bucket[index], &slot, entry)) {
+                if(replay_load(bucket_time_ptr) != token_time) {
+                    /* Moved on before the slot was filled */
+                    return_value = T_COSE_ERR_CWT_EXPIRED;
+                } else {
+                    return_value = T_COSE_SUCCESS;
+                }
+                goto Done;
+            }
+            /* Lost to another thread; slot is now what it put there */
+        }
+        index = (index + 1) & (me->slots_per_bucket - 1);
+    }
+    return_value = T_COSE_ERR_REPLAY_CACHE_FULL;
+
+Done:
+    return return_value;
+}
@@ -14,6 +14,7 @@
 #include "t_cose_crypto.h"
 #include "t_cose_util.h"
 #include "t_cose_short_circuit.h"
+#include "t_cose_trace.h"
 
 #ifndef QCBOR_1_1
 // The OpenBytes API we use was only added in 1.1.
@@ -60,52 +61,93 @@
 #error COSE algorithm identifier definitions are in error
 #endif
 
+#if T_COSE_ALGORITHM_SHA_256 != COSE_ALGORITHM_SHA_256 || \
+    T_COSE_ALGORITHM_SHA_384 != COSE_ALGORITHM_SHA_384 || \
+    T_COSE_ALGORITHM_SHA_512 != COSE_ALGORITHM_SHA_512
+#error COSE algorithm identifier definitions are in error
+#endif
+
 /**
  * \brief  Makes the protected header parameters for COSE.
  *
- * \param[in] cose_algorithm_id      The COSE algorithm ID to put in the
- *                                   header parameters.
- * \param[in,out] cbor_encode_ctx    Encoding context to output to.
+ * \param[in,out] me  The signing configuration.
+ *
+ * \returns An error of type \ref t_cose_err_t.
  *
- * \return   The pointer and length of the encoded protected
- *           parameters is returned, or \c NULL_Q_USEFUL_BUF_C if this fails.
- *           This will have the same pointer as \c buffer_for_parameters,
- *           but the pointer is conts and the length is that of the valid
- *           data, not of the size of the buffer.
+ * The protected parameters are kept in fully encoded CBOR format in
+ * \c me as they are added to the \c COSE_Sign1 message as a binary
+ * string and are part of the to-be-signed bytes. This is different
+ * from the unprotected parameters which are not handled this way.
  *
- * The protected parameters are returned in fully encoded CBOR format as
- * they are added to the \c COSE_Sign1 message as a binary string. This is
- * different from the unprotected parameters which are not handled this
- * way.
+ * On error the length of the encoded protected parameters is zero so
+ * signing with \c me fails.
  */
-static inline struct q_useful_buf_c
-encode_protected_parameters(int32_t             cose_algorithm_id,
-                            QCBOREncodeContext *cbor_encode_ctx)
+static enum t_cose_err_t
+encode_protected_parameters(struct t_cose_sign1_signer *me)
 {
     /* Aproximate stack usage
      *                                             64-bit      32-bit
      *   local vars                                    16           8
+     *   encode context                               168         148
      *   QCBOR   (guess)                               32          24
-     *   TOTAL                                         48          32
+     *   TOTAL                                        216         180
      */
+    QCBOREncodeContext    cbor_encode_ctx;
     struct q_useful_buf_c protected_parameters;
 
-    QCBOREncode_BstrWrap(cbor_encode_ctx);
-    QCBOREncode_OpenMap(cbor_encode_ctx);
-    QCBOREncode_AddInt64ToMapN(cbor_encode_ctx,
+    me->protected_parameters_len = 0;
+
+    if (!signature_algorithm_id_is_supported(me->cose_algorithm_id)) {
+        return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+    }
+
+    QCBOREncode_Init(&cbor_encode_ctx,
+                     (struct q_useful_buf){me->protected_parameters,
+                                           sizeof(me->protected_parameters)});
+    QCBOREncode_OpenMap(&cbor_encode_ctx);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode_ctx,
                                COSE_HEADER_PARAM_ALG,
-                               cose_algorithm_id);
-    QCBOREncode_CloseMap(cbor_encode_ctx);
-    QCBOREncode_CloseBstrWrap2(cbor_encode_ctx, false, &protected_parameters);
+                               me->cose_algorithm_id);
+    if(me->payload_hash_alg != T_COSE_INVALID_ALGORITHM_ID) {
+        QCBOREncode_AddInt64ToMapN(&cbor_encode_ctx,
+                                   COSE_HEADER_PARAM_PAYLOAD_HASH_ALG,
+                                   me->payload_hash_alg);
+        if(me->preimage_content_type != NULL) {
+            QCBOREncode_AddSZStringToMapN(&cbor_encode_ctx,
+                                          COSE_HEADER_PARAM_PREIMAGE_CONTENT_TYPE,
+                                          me->preimage_content_type);
+        }
+    }
+    QCBOREncode_CloseMap(&cbor_encode_ctx);
+    if(QCBOREncode_Finish(&cbor_encode_ctx, &protected_parameters)) {
+        return T_COSE_ERR_CBOR_FORMATTING;
+    }
+
+    me->protected_parameters_len = protected_parameters.len;
+
+    return T_COSE_SUCCESS;
+}
+
 
-    return protected_parameters;
+/**
+ * \brief Get the encoded protected parameters of a signing configuration.
+ *
+ * \param[in] me  The signing configuration.
+ *
+ * \return The encoded protected parameters, without the bstr wrapping.
+ */
+static inline struct q_useful_buf_c
+signer_protected_parameters(const struct t_cose_sign1_signer *me)
+{
+    return (struct q_useful_buf_c){me->protected_parameters,
+                                   me->protected_parameters_len};
 }
 
 
 /**
  * \brief Add the unprotected parameters to a CBOR encoding context
  *
- * \param[in] me               The t_cose signing context.
+ * \param[in] me               The signing configuration.
  * \param[in] kid              The key ID.
  * \param[in] cbor_encode_ctx  CBOR encoding context to output to
  *
@@ -118,9 +160,9 @@ encode_protected_parameters(int32_t             cose_algorithm_id,
  * cbor_encode_ctx.
  */
 static inline enum t_cose_err_t
-add_unprotected_parameters(const struct t_cose_sign1_sign_ctx *me,
-                           const struct q_useful_buf_c         kid,
-                           QCBOREncodeContext                 *cbor_encode_ctx)
+add_unprotected_parameters(const struct t_cose_sign1_signer *me,
+                           const struct q_useful_buf_c       kid,
+                           QCBOREncodeContext               *cbor_encode_ctx)
 {
     /* Aproximate stack usage
      *                                             64-bit      32-bit
@@ -143,6 +185,13 @@ add_unprotected_parameters(const struct t_cose_sign1_sign_ctx *me,
         return T_COSE_ERR_DUPLICATE_PARAMETER;
     }
 
+    if(me->payload_hash_alg != T_COSE_INVALID_ALGORITHM_ID &&
+       (me->content_type_uint != T_COSE_EMPTY_UINT_CONTENT_TYPE ||
+        me->content_type_tstr != NULL)) {
+        /* A hash envelope has a preimage content type instead */
+        return T_COSE_ERR_BAD_CONTENT_TYPE;
+    }
+
 
     if(me->content_type_uint != T_COSE_EMPTY_UINT_CONTENT_TYPE) {
         QCBOREncode_AddUInt64ToMapN(cbor_encode_ctx,
@@ -165,32 +214,30 @@ add_unprotected_parameters(const struct t_cose_sign1_sign_ctx *me,
 }
 
 
-/*
- * Semi-private function. See t_cose_sign1_sign.h
+/**
+ * \brief Output the protected and unprotected parameters of a \c COSE_Sign1.
+ *
+ * \param[in] me               The signing configuration.
+ * \param[in] cbor_encode_ctx  Encoding context to output to.
+ *
+ * \returns An error of type \ref t_cose_err_t.
+ *
+ * The protected parameters were encoded when \c me was set up, so
+ * they are just copied in.
  */
-enum t_cose_err_t
-t_cose_sign1_encode_parameters_internal(struct t_cose_sign1_sign_ctx *me,
-                                        bool                          payload_is_detached,
-                                        QCBOREncodeContext           *cbor_encode_ctx)
+static enum t_cose_err_t
+sign1_encode_header_parameters(const struct t_cose_sign1_signer *me,
+                               QCBOREncodeContext               *cbor_encode_ctx)
 {
-    enum t_cose_err_t      return_value;
     struct q_useful_buf_c  kid;
 
-    if (!signature_algorithm_id_is_supported(me->cose_algorithm_id)) {
+    if(me->protected_parameters_len == 0) {
+        /* Setting up me failed because of the algorithm */
         return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
     }
 
-    /* Add the CBOR tag indicating COSE_Sign1 */
-    if(!(me->option_flags & T_COSE_OPT_OMIT_CBOR_TAG)) {
-        QCBOREncode_AddTag(cbor_encode_ctx, CBOR_TAG_COSE_SIGN1);
-    }
-
-    /* Get started with the tagged array that holds the four parts of
-     * a cose single signed message */
-    QCBOREncode_OpenArray(cbor_encode_ctx);
-
     /* The protected parameters, which are added as a wrapped bstr  */
-    me->protected_parameters = encode_protected_parameters(me->cose_algorithm_id, cbor_encode_ctx);
+    QCBOREncode_AddBytes(cbor_encode_ctx, signer_protected_parameters(me));
 
     /* The Unprotected parameters */
     /* Get the kid because it goes into the parameters that are about
@@ -204,12 +251,46 @@ t_cose_sign1_encode_parameters_internal(struct t_cose_sign1_sign_ctx *me,
             kid = get_short_circuit_kid();
         }
 #else
-        return_value = T_COSE_ERR_SHORT_CIRCUIT_SIG_DISABLED;
-        goto Done;
+        return T_COSE_ERR_SHORT_CIRCUIT_SIG_DISABLED;
 #endif
     }
 
-    return_value = add_unprotected_parameters(me, kid, cbor_encode_ctx);
+    return add_unprotected_parameters(me, kid, cbor_encode_ctx);
+}
+
+
+/**
+ * \brief Output the first part and the parameters of a \c COSE_Sign1.
+ *
+ * \param[in] me                   The signing configuration.
+ * \param[in] payload_is_detached  If the payload is to be detached, this
+ *                                 is \c true.
+ * \param[in] cbor_encode_ctx      Encoding context to output to.
+ *
+ * \returns An error of type \ref t_cose_err_t.
+ */
+static enum t_cose_err_t
+sign1_encode_parameters(const struct t_cose_sign1_signer *me,
+                        bool                              payload_is_detached,
+                        QCBOREncodeContext               *cbor_encode_ctx)
+{
+    enum t_cose_err_t      return_value;
+
+    if(me->protected_parameters_len == 0) {
+        /* Setting up me failed because of the algorithm */
+        return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+    }
+
+    /* Add the CBOR tag indicating COSE_Sign1 */
+    if(!(me->option_flags & T_COSE_OPT_OMIT_CBOR_TAG)) {
+        QCBOREncode_AddTag(cbor_encode_ctx, CBOR_TAG_COSE_SIGN1);
+    }
+
+    /* Get started with the tagged array that holds the four parts of
+     * a cose single signed message */
+    QCBOREncode_OpenArray(cbor_encode_ctx);
+
+    return_value = sign1_encode_header_parameters(me, cbor_encode_ctx);
     if(return_value != T_COSE_SUCCESS) {
         goto Done;
     }
@@ -227,74 +308,145 @@ Done:
     return return_value;
 }
 
-#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+
+/*
+ * Semi-private function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_encode_parameters_internal(struct t_cose_sign1_sign_ctx *me,
+                                        bool                          payload_is_detached,
+                                        QCBOREncodeContext           *cbor_encode_ctx)
+{
+    enum t_cose_err_t return_value;
+
+    /* The context's configuration can change between messages, so
+     * its protected parameters are made each time. */
+    return_value = encode_protected_parameters(&me->signer);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+
+    return sign1_encode_parameters(&me->signer, payload_is_detached, cbor_encode_ctx);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_init(struct t_cose_sign1_signer *me,
+                         uint32_t                    option_flags,
+                         int32_t                     cose_algorithm_id)
+{
+    memset(me, 0, sizeof(*me));
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    me->content_type_uint = T_COSE_EMPTY_UINT_CONTENT_TYPE;
+#endif
+    me->cose_algorithm_id = cose_algorithm_id;
+    me->option_flags      = option_flags;
+
+    return encode_protected_parameters(me);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_set_hash_envelope(struct t_cose_sign1_signer *me,
+                                      int32_t                     payload_hash_alg,
+                                      const char                 *preimage_content_type)
+{
+    me->payload_hash_alg      = payload_hash_alg;
+    me->preimage_content_type = preimage_content_type;
+
+    return encode_protected_parameters(me);
+}
+
+
 /**
- * \brief Compute the short-circuit signature for a COSE_Sign1 message.
+ * \brief Sign the hash of the to-be-signed bytes of a \c COSE_Sign1
+ * message.
  *
- * \param[in] me                    The t_cose signing context.
- * \param[in] aad                   The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
- * \param[in] payload               Pointer and length of payload to sign.
+ * \param[in] me                    The signing configuration.
+ * \param[in] tbs_hash              The hash of the to-be-signed bytes.
  * \param[in] buffer_for_signature  Pointer and length of buffer to output to.
  * \param[out] signature            Pointer and length of the resulting signature.
  *
  * \returns An error of type \ref t_cose_err_t.
  *
- * This function does not actually perform any kind of cryptographic
- * signature, and should only be used as a test mode.
+ * This makes a short-circuit signature if \ref
+ * T_COSE_OPT_SHORT_CIRCUIT_SIG is set and otherwise has the crypto
+ * adapter make a real one. It is not for EdDSA.
  *
  * If \c buffer_for_signature contains a \c NULL pointer, this function
- * will compute the necessary size, and set \c signature accordingly.
+ * will compute the necessary size, and update \c signature accordingly.
  */
-static inline enum t_cose_err_t
-sign1_sign_short_circuit(struct t_cose_sign1_sign_ctx *me,
-                         struct q_useful_buf_c         aad,
-                         struct q_useful_buf_c         payload,
-                         struct q_useful_buf           buffer_for_signature,
-                         struct q_useful_buf_c         *signature)
+static enum t_cose_err_t
+sign1_sign_tbs_hash(const struct t_cose_sign1_signer *me,
+                    struct q_useful_buf_c             tbs_hash,
+                    struct q_useful_buf               buffer_for_signature,
+                    struct q_useful_buf_c            *signature)
 {
-    enum t_cose_err_t            return_value;
+    enum t_cose_err_t return_value;
 
-    Q_USEFUL_BUF_MAKE_STACK_UB(  buffer_for_tbs_hash, T_COSE_CRYPTO_MAX_HASH_SIZE);
-    struct q_useful_buf_c        tbs_hash;
-
-    /* Create the hash of the to-be-signed bytes. Inputs to the
-     * hash are the protected parameters, the payload that is
-     * getting signed, the cose signature alg from which the hash
-     * alg is determined. The cose_algorithm_id was checked in
-     * t_cose_sign1_init() so it doesn't need to be checked here.
-     */
-    return_value = create_tbs_hash(me->cose_algorithm_id,
-                                   me->protected_parameters,
-                                   aad,
-                                   payload,
-                                   buffer_for_tbs_hash,
-                                   &tbs_hash);
-    if (return_value) {
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    if (me->option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG) {
+        /* No actual cryptographic signature. This is only for test. */
+        if (buffer_for_signature.ptr == NULL) {
+            /* Output size calculation. Only need signature size. */
+            signature->ptr = NULL;
+            return_value = short_circuit_sig_size(me->cose_algorithm_id, &signature->len);
+        } else {
+            /* Perform the a short circuit signing */
+            return_value = short_circuit_sign(me->cose_algorithm_id,
+                                              tbs_hash,
+                                              buffer_for_signature,
+                                              signature);
+        }
         goto Done;
     }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
 
     if (buffer_for_signature.ptr == NULL) {
         /* Output size calculation. Only need signature size. */
         signature->ptr = NULL;
-        return_value = short_circuit_sig_size(me->cose_algorithm_id, &signature->len);
+        return_value  = t_cose_crypto_sig_size(me->cose_algorithm_id,
+                                               me->signing_key,
+                                              &signature->len);
     } else {
-        /* Perform the a short circuit signing */
-        return_value = short_circuit_sign(me->cose_algorithm_id,
-                                          tbs_hash,
-                                          buffer_for_signature,
-                                          signature);
+        /* Perform the public key signing */
+        T_COSE_PROBE2(crypto_sign_entry, me->cose_algorithm_id, tbs_hash.len);
+        if((me->option_flags & T_COSE_OPT_DETERMINISTIC_ECDSA) &&
+           t_cose_algorithm_is_ecdsa(me->cose_algorithm_id)) {
+            return_value = t_cose_crypto_sign_deterministic(me->cose_algorithm_id,
+                                                            me->signing_key,
+                                                            tbs_hash,
+                                                            buffer_for_signature,
+                                                            signature);
+        } else {
+            return_value = t_cose_crypto_sign(me->cose_algorithm_id,
+                                              me->signing_key,
+                                              tbs_hash,
+                                              buffer_for_signature,
+                                              signature);
+        }
+        T_COSE_PROBE2(crypto_sign_return, return_value, me->cose_algorithm_id);
     }
 
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
 Done:
+#endif
     return return_value;
 }
-#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
 
 #ifndef T_COSE_DISABLE_EDDSA
 /**
  * \brief Compute an EDDSA signature for a COSE_Sign1 message.
  *
- * \param[in] me                    The t_cose signing context.
+ * \param[in] me                    The signing configuration.
+ * \param[in,out] call              The state of this signing.
  * \param[in] aad                   The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
  * \param[in] payload               Pointer and length of payload to sign.
  * \param[in] buffer_for_signature  Pointer and length of buffer to output to.
@@ -306,19 +458,19 @@ Done:
  * to-be-signed data, and therefore cannot be performed incrementally.
  * This function serializes the to-be-signed bytes and uses the crypto
  * adapter to compute the signature over them. An auxiliary buffer,
- * used to store the to-be-signed bytes, must have previously been
- * configured by calling the \ref t_cose_sign1_sign_set_auxiliary_buffer
- * function.
+ * used to store the to-be-signed bytes, must be in \c call, for
+ * example from t_cose_sign1_sign_set_auxiliary_buffer().
  *
  * If \c buffer_for_signature contains a \c NULL pointer, this function
  * will compute the necessary size, and update \c signature accordingly.
  */
 static inline enum t_cose_err_t
-sign1_sign_eddsa(struct t_cose_sign1_sign_ctx *me,
-                 struct q_useful_buf_c         aad,
-                 struct q_useful_buf_c         payload,
-                 struct q_useful_buf           buffer_for_signature,
-                 struct q_useful_buf_c        *signature)
+sign1_sign_eddsa(const struct t_cose_sign1_signer *me,
+                 struct t_cose_sign1_sign_call    *call,
+                 struct q_useful_buf_c             aad,
+                 struct q_useful_buf_c             payload,
+                 struct q_useful_buf               buffer_for_signature,
+                 struct q_useful_buf_c            *signature)
 {
     enum t_cose_err_t            return_value;
     struct q_useful_buf_c        tbs;
@@ -327,10 +479,10 @@ sign1_sign_eddsa(struct t_cose_sign1_sign_ctx *me,
      * If auxiliary_buffer.ptr is NULL this will succeed, computing
      * the necessary size.
      */
-    return_value = create_tbs(me->protected_parameters,
+    return_value = create_tbs(signer_protected_parameters(me),
                               aad,
                               payload,
-                              me->auxiliary_buffer,
+                              call->auxiliary_buffer,
                              &tbs);
     if (return_value == T_COSE_ERR_TOO_SMALL) {
         /* Be a bit more specific about which buffer is too small */
@@ -345,7 +497,7 @@ sign1_sign_eddsa(struct t_cose_sign1_sign_ctx *me,
      * This is particularly useful when buffer_for_signature.ptr is
      * NULL and no signing is actually taking place yet.
      */
-    me->auxiliary_buffer_size = tbs.len;
+    call->auxiliary_buffer_size = tbs.len;
 
     if (buffer_for_signature.ptr == NULL) {
         /* Output size calculation. Only need signature size. */
@@ -353,17 +505,19 @@ sign1_sign_eddsa(struct t_cose_sign1_sign_ctx *me,
         return_value  = t_cose_crypto_sig_size(me->cose_algorithm_id,
                                                me->signing_key,
                                               &signature->len);
-    } else if (me->auxiliary_buffer.ptr == NULL) {
+    } else if (call->auxiliary_buffer.ptr == NULL) {
         /* Without a real auxiliary buffer, we have nothing to sign. */
         return_value = T_COSE_ERR_NEED_AUXILIARY_BUFFER;
     } else {
         /* Perform the public key signing over the TBS bytes we just
          * serialized.
          */
+        T_COSE_PROBE1(crypto_sign_eddsa_entry, tbs.len);
         return_value = t_cose_crypto_sign_eddsa(me->signing_key,
                                                 tbs,
                                                 buffer_for_signature,
                                                 signature);
+        T_COSE_PROBE1(crypto_sign_eddsa_return, return_value);
     }
 
 Done:
@@ -375,7 +529,7 @@ Done:
  * \brief Compute a signature for a COSE_Sign1 message, following the
  * general procedure which works for most algorithms.
  *
- * \param[in] me                    The t_cose signing context.
+ * \param[in] me                    The signing configuration.
  * \param[in] aad                   The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
  * \param[in] payload               Pointer and length of payload to sign.
  * \param[in] buffer_for_signature  Pointer and length of buffer to output to.
@@ -385,21 +539,20 @@ Done:
  *
  * The message's to-be-signed bytes are hashed incrementally using the
  * chosen algorithm's digest function, and the result is signed by the
- * crypto adapter.
+ * crypto adapter, or short-circuit signed if that option is set.
  *
- * This function does not support short-circuit signing or EDDSA
- * signatures, which require a special procedure. See
- * \ref sign1_sign_short_circuit and \ref sign1_sign_eddsa.
+ * This function does not support EDDSA signatures, which require a
+ * special procedure. See \ref sign1_sign_eddsa.
  *
  * If \c buffer_for_signature contains a \c NULL pointer, this function
  * will compute the necessary size, and update \c signature accordingly.
  */
 static inline enum t_cose_err_t
-sign1_sign_default(struct t_cose_sign1_sign_ctx *me,
-                   struct q_useful_buf_c         aad,
-                   struct q_useful_buf_c         payload,
-                   struct q_useful_buf           buffer_for_signature,
-                   struct q_useful_buf_c        *signature)
+sign1_sign_default(const struct t_cose_sign1_signer *me,
+                   struct q_useful_buf_c             aad,
+                   struct q_useful_buf_c             payload,
+                   struct q_useful_buf               buffer_for_signature,
+                   struct q_useful_buf_c            *signature)
 {
     enum t_cose_err_t            return_value;
     Q_USEFUL_BUF_MAKE_STACK_UB(  buffer_for_tbs_hash, T_COSE_CRYPTO_MAX_HASH_SIZE);
@@ -408,11 +561,12 @@ sign1_sign_default(struct t_cose_sign1_sign_ctx *me,
     /* Create the hash of the to-be-signed bytes. Inputs to the
      * hash are the protected parameters, the payload that is
      * getting signed, the cose signature alg from which the hash
-     * alg is determined. The cose_algorithm_id was checked in
-     * t_cose_sign1_init() so it doesn't need to be checked here.
+     * alg is determined. The cose_algorithm_id was checked when the
+     * protected parameters were encoded so it doesn't need to be
+     * checked here.
      */
     return_value = create_tbs_hash(me->cose_algorithm_id,
-                                   me->protected_parameters,
+                                   signer_protected_parameters(me),
                                    aad,
                                    payload,
                                    buffer_for_tbs_hash,
@@ -421,33 +575,81 @@ sign1_sign_default(struct t_cose_sign1_sign_ctx *me,
         goto Done;
     }
 
-    if (buffer_for_signature.ptr == NULL) {
-        /* Output size calculation. Only need signature size. */
-        signature->ptr = NULL;
-        return_value  = t_cose_crypto_sig_size(me->cose_algorithm_id,
-                                               me->signing_key,
-                                              &signature->len);
-    } else {
-        /* Perform the public key signing */
-        return_value = t_cose_crypto_sign(me->cose_algorithm_id,
-                                          me->signing_key,
-                                          tbs_hash,
-                                          buffer_for_signature,
-                                          signature);
-    }
+    return_value = sign1_sign_tbs_hash(me,
+                                       tbs_hash,
+                                       buffer_for_signature,
+                                       signature);
 
 Done:
     return return_value;
 }
 
-/*
- * Semi-private function. See t_cose_sign1_sign.h
+
+/**
+ * \brief Compute the signature for a COSE_Sign1 message.
+ *
+ * \param[in] me                    The signing configuration.
+ * \param[in,out] call              The state of this signing.
+ * \param[in] aad                   The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] payload               Pointer and length of payload to sign.
+ * \param[in] buffer_for_signature  Pointer and length of buffer to output to.
+ * \param[out] signature            Pointer and length of the resulting signature.
+ *
+ * \returns An error of type \ref t_cose_err_t.
+ *
+ * This picks sign1_sign_eddsa() or sign1_sign_default() depending on
+ * the flags and algorithm.
  */
-enum t_cose_err_t
-t_cose_sign1_encode_signature_aad_internal(struct t_cose_sign1_sign_ctx *me,
-                                           struct q_useful_buf_c         aad,
-                                           struct q_useful_buf_c         detached_payload,
-                                           QCBOREncodeContext           *cbor_encode_ctx)
+static enum t_cose_err_t
+sign1_sign(const struct t_cose_sign1_signer *me,
+           struct t_cose_sign1_sign_call    *call,
+           struct q_useful_buf_c             aad,
+           struct q_useful_buf_c             payload,
+           struct q_useful_buf               buffer_for_signature,
+           struct q_useful_buf_c            *signature)
+{
+#ifndef T_COSE_DISABLE_EDDSA
+    if (me->cose_algorithm_id == COSE_ALGORITHM_EDDSA &&
+        !(me->option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG)) {
+        return sign1_sign_eddsa(me,
+                                call,
+                                aad,
+                                payload,
+                                buffer_for_signature,
+                                signature);
+    }
+#else
+    (void)call;
+#endif
+    return sign1_sign_default(me,
+                              aad,
+                              payload,
+                              buffer_for_signature,
+                              signature);
+}
+
+
+/**
+ * \brief Output the signature, finishing a \c COSE_Sign1 message.
+ *
+ * \param[in] me                The signing configuration.
+ * \param[in,out] call          The state of this signing.
+ * \param[in] aad               The Additional Authenticated Data or
+ *                              \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] detached_payload  The detached payload or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] cbor_encode_ctx   Encoding context to output to.
+ *
+ * \returns An error of type \ref t_cose_err_t.
+ *
+ * This is t_cose_sign1_encode_signature_aad_internal() for a
+ * configuration and per-call state.
+ */
+static enum t_cose_err_t
+sign1_encode_signature(const struct t_cose_sign1_signer *me,
+                       struct t_cose_sign1_sign_call    *call,
+                       struct q_useful_buf_c             aad,
+                       struct q_useful_buf_c             detached_payload,
+                       QCBOREncodeContext               *cbor_encode_ctx)
 {
     enum t_cose_err_t            return_value;
     QCBORError                   cbor_err;
@@ -480,39 +682,17 @@ t_cose_sign1_encode_signature_aad_internal(struct t_cose_sign1_sign_ctx *me,
     /* The signature gets written directly into the output buffer.
      * The matching QCBOREncode_CloseBytes call further down still needs do a
      * memmove to make space for the CBOR header, but at least we avoid the need
-     * to allocate an extra buffer.
+     * to allocate an extra buffer. t_cose_sign1_signer_reserve_payload()
+     * avoids the memmove by knowing the signature size up front.
      */
     QCBOREncode_OpenBytes(cbor_encode_ctx, &buffer_for_signature);
 
-    /* Sign the message using the appropriate procedure, depending on
-     * the flags and algorithm.
-     */
-#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
-    if (me->option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG) {
-        return_value = sign1_sign_short_circuit(me,
-                                                aad,
-                                                signed_payload,
-                                                buffer_for_signature,
-                                               &signature);
-    } else
-#endif
-#ifndef T_COSE_DISABLE_EDDSA
-    if (me->cose_algorithm_id == COSE_ALGORITHM_EDDSA) {
-        return_value = sign1_sign_eddsa(me,
-                                        aad,
-                                        signed_payload,
-                                        buffer_for_signature,
-                                       &signature);
-    } else
-#endif
-    {
-        return_value = sign1_sign_default(me,
-                aad,
-                signed_payload,
-                buffer_for_signature,
-                &signature);
-    }
-
+    return_value = sign1_sign(me,
+                              call,
+                              aad,
+                              signed_payload,
+                              buffer_for_signature,
+                             &signature);
     if (return_value)
         goto Done;
 
@@ -534,12 +714,60 @@ Done:
  * Semi-private function. See t_cose_sign1_sign.h
  */
 enum t_cose_err_t
-t_cose_sign1_sign_aad_internal(struct t_cose_sign1_sign_ctx *me,
-                               bool                         payload_is_detached,
-                               struct q_useful_buf_c         payload,
-                               struct q_useful_buf_c         aad,
-                               struct q_useful_buf           out_buf,
-                               struct q_useful_buf_c        *result)
+t_cose_sign1_encode_signature_aad_internal(struct t_cose_sign1_sign_ctx *me,
+                                           struct q_useful_buf_c         aad,
+                                           struct q_useful_buf_c         detached_payload,
+                                           QCBOREncodeContext           *cbor_encode_ctx)
+{
+    return sign1_encode_signature(&me->signer,
+                                  &me->call,
+                                  aad,
+                                  detached_payload,
+                                  cbor_encode_ctx);
+}
+
+
+/**
+ * \brief Check for CBOR encoding errors and get the completed
+ * \c COSE_Sign1.
+ *
+ * \param[in] cbor_encode_ctx  The encoder the \c COSE_Sign1 was output to.
+ * \param[out] result          Pointer and length of the resulting \c COSE_Sign1.
+ *
+ * \returns An error of type \ref t_cose_err_t.
+ */
+static enum t_cose_err_t
+sign1_finish_encode(QCBOREncodeContext    *cbor_encode_ctx,
+                    struct q_useful_buf_c *result)
+{
+    QCBORError cbor_err;
+
+    cbor_err = QCBOREncode_GetErrorState(cbor_encode_ctx);
+    if(cbor_err == QCBOR_ERR_BUFFER_TOO_SMALL) {
+        return T_COSE_ERR_TOO_SMALL;
+    } else if(cbor_err != QCBOR_SUCCESS) {
+        return T_COSE_ERR_CBOR_FORMATTING;
+    }
+
+    if(QCBOREncode_Finish(cbor_encode_ctx, result)) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * Semi-private function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_internal(const struct t_cose_sign1_signer *me,
+                                  struct t_cose_sign1_sign_call    *call,
+                                  bool                              payload_is_detached,
+                                  struct q_useful_buf_c             payload,
+                                  struct q_useful_buf_c             aad,
+                                  struct q_useful_buf               out_buf,
+                                  struct q_useful_buf_c            *result)
 {
     /* Aproximate stack usage
      *                                             64-bit      32-bit
@@ -549,16 +777,23 @@ t_cose_sign1_sign_aad_internal(struct t_cose_sign1_sign_ctx *me,
      *   max(encode_param, encode_signature)     224-1316    216-1024
      *   TOTAL                                   432-1524    392-1300
      */
-    QCBOREncodeContext  encode_context;
-    enum t_cose_err_t   return_value;
+    QCBOREncodeContext            encode_context;
+    enum t_cose_err_t             return_value;
+    struct t_cose_sign1_sign_call default_call;
+
+    T_COSE_PROBE3(sign1_sign_entry, me->cose_algorithm_id, payload.len, aad.len);
+
+    if(call == NULL) {
+        /* Can only compute the size for EdDSA */
+        t_cose_sign1_sign_call_init(&default_call, (struct q_useful_buf){NULL, SIZE_MAX});
+        call = &default_call;
+    }
 
     /* -- Initialize CBOR encoder context with output buffer -- */
     QCBOREncode_Init(&encode_context, out_buf);
 
     /* -- Output the header parameters into the encoder context -- */
-    return_value = t_cose_sign1_encode_parameters_internal(me,
-                                                           payload_is_detached,
-                                                           &encode_context);
+    return_value = sign1_encode_parameters(me, payload_is_detached, &encode_context);
     if(return_value != T_COSE_SUCCESS) {
         goto Done;
     }
@@ -583,30 +818,749 @@ t_cose_sign1_sign_aad_internal(struct t_cose_sign1_sign_ctx *me,
     if(!payload_is_detached) {
         payload = NULL_Q_USEFUL_BUF_C;
     }
-    return_value = t_cose_sign1_encode_signature_aad_internal(me,
-                                                              aad,
-                                                              payload,
-                                                              &encode_context);
+    return_value = sign1_encode_signature(me, call, aad, payload, &encode_context);
     if(return_value) {
         goto Done;
     }
 
-    QCBORError cbor_err = QCBOREncode_GetErrorState(&encode_context);
-    if(cbor_err == QCBOR_ERR_BUFFER_TOO_SMALL) {
-        return_value = T_COSE_ERR_TOO_SMALL;
-        goto Done;
-    } else if(cbor_err != QCBOR_SUCCESS) {
-        return_value = T_COSE_ERR_CBOR_FORMATTING;
-        goto Done;
-    }
-
     /* -- Close off and get the resulting encoded CBOR -- */
-    if(QCBOREncode_Finish(&encode_context, result)) {
-        return_value = T_COSE_ERR_CBOR_NOT_WELL_FORMED;
-        goto Done;
-    }
+    return_value = sign1_finish_encode(&encode_context, result);
 
 Done:
+    T_COSE_PROBE3(sign1_sign_return,
+                  return_value,
+                  me->cose_algorithm_id,
+                  return_value == T_COSE_SUCCESS ? result->len : 0);
     return return_value;
 }
 
+
+/*
+ * Semi-private function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_sign_aad_internal(struct t_cose_sign1_sign_ctx *me,
+                               bool                         payload_is_detached,
+                               struct q_useful_buf_c         payload,
+                               struct q_useful_buf_c         aad,
+                               struct q_useful_buf           out_buf,
+                               struct q_useful_buf_c        *result)
+{
+    enum t_cose_err_t return_value;
+
+    return_value = encode_protected_parameters(&me->signer);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+
+    return t_cose_sign1_signer_sign_internal(&me->signer,
+                                             &me->call,
+                                             payload_is_detached,
+                                             payload,
+                                             aad,
+                                             out_buf,
+                                             result);
+}
+
+
+/**
+ * \brief Get the size of the signature a configuration makes.
+ *
+ * \param[in] me         The signing configuration.
+ * \param[out] sig_size  The size of the signature.
+ *
+ * \returns An error of type \ref t_cose_err_t.
+ */
+static enum t_cose_err_t
+sign1_signature_size(const struct t_cose_sign1_signer *me,
+                     size_t                           *sig_size)
+{
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    if(me->option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG) {
+        return short_circuit_sig_size(me->cose_algorithm_id, sig_size);
+    }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+    return t_cose_crypto_sig_size(me->cose_algorithm_id,
+                                  me->signing_key,
+                                  sig_size);
+}
+
+
+/**
+ * \brief Output everything in a \c COSE_Sign1 before the payload.
+ *
+ * \param[in] me           The signing configuration.
+ * \param[in] payload_len  The length of the payload.
+ * \param[in] out_buf      Pointer and length of buffer to output to.
+ * \param[out] header      The tag, array head, parameters and the head
+ *                         of the payload byte string.
+ *
+ * \returns An error of type \ref t_cose_err_t.
+ *
+ * Everything is output by QCBOR, but the array and payload heads are
+ * added as already-encoded bytes rather than by opening and closing
+ * an array and a byte string. Closing them inserts their heads in
+ * front of the contents which would move the payload.
+ *
+ * If \c out_buf has a \c NULL pointer, only the size is computed.
+ */
+static enum t_cose_err_t
+sign1_encode_header(const struct t_cose_sign1_signer *me,
+                    size_t                            payload_len,
+                    struct q_useful_buf               out_buf,
+                    struct q_useful_buf_c            *header)
+{
+    /* Aproximate stack usage
+     *                                             64-bit      32-bit
+     *   local vars                                    24          16
+     *   encode context                               168         148
+     *   QCBOR   (guess)                               32          24
+     *   encode_header_parameters                      32          24
+     *   TOTAL                                        256         212
+     */
+    QCBOREncodeContext    encode_context;
+    enum t_cose_err_t     return_value;
+    QCBORError            cbor_err;
+    uint8_t               head_buf[QCBOR_HEAD_BUFFER_SIZE];
+
+    QCBOREncode_Init(&encode_context, out_buf);
+    if(!(me->option_flags & T_COSE_OPT_OMIT_CBOR_TAG)) {
+        QCBOREncode_AddTag(&encode_context, CBOR_TAG_COSE_SIGN1);
+    }
+    QCBOREncode_AddEncoded(&encode_context,
+                           QCBOREncode_EncodeHead(Q_USEFUL_BUF_FROM_BYTE_ARRAY(head_buf),
+                                                  CBOR_MAJOR_TYPE_ARRAY,
+                                                  0,
+                                                  4));
+    return_value = sign1_encode_header_parameters(me, &encode_context);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    QCBOREncode_AddEncoded(&encode_context,
+                           QCBOREncode_EncodeHead(Q_USEFUL_BUF_FROM_BYTE_ARRAY(head_buf),
+                                                  CBOR_MAJOR_TYPE_BYTE_STRING,
+                                                  0,
+                                                  payload_len));
+
+    cbor_err = QCBOREncode_Finish(&encode_context, header);
+    if(cbor_err == QCBOR_ERR_BUFFER_TOO_SMALL) {
+        return_value = T_COSE_ERR_TOO_SMALL;
+    } else if(cbor_err != QCBOR_SUCCESS) {
+        return_value = T_COSE_ERR_CBOR_FORMATTING;
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_reserve_payload(const struct t_cose_sign1_signer *me,
+                                    size_t                            payload_len,
+                                    struct q_useful_buf               out_buf,
+                                    struct t_cose_sign1_reservation  *reservation,
+                                    struct q_useful_buf              *payload_slot)
+{
+    enum t_cose_err_t     return_value;
+    uint8_t               head_buf[QCBOR_HEAD_BUFFER_SIZE];
+    struct q_useful_buf_c head;
+    struct q_useful_buf_c header;
+    size_t                sig_size;
+
+    memset(reservation, 0, sizeof(*reservation));
+    *payload_slot = NULL_Q_USEFUL_BUF;
+
+    return_value = sign1_signature_size(me, &sig_size);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    return_value = sign1_encode_header(me, payload_len, out_buf, &header);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    /* The payload is followed by the signature and its head */
+    head = QCBOREncode_EncodeHead(Q_USEFUL_BUF_FROM_BYTE_ARRAY(head_buf),
+                                  CBOR_MAJOR_TYPE_BYTE_STRING,
+                                  0,
+                                  sig_size);
+    if(payload_len > out_buf.len - header.len ||
+       head.len + sig_size > out_buf.len - header.len - payload_len) {
+        return_value = T_COSE_ERR_TOO_SMALL;
+        goto Done;
+    }
+
+    reservation->message.ptr      = out_buf.ptr;
+    reservation->payload_offset   = header.len;
+    reservation->payload_len      = payload_len;
+    reservation->signature_offset = header.len + payload_len + head.len;
+    reservation->signature_len    = sig_size;
+    reservation->message.len      = reservation->signature_offset + sig_size;
+
+    if(out_buf.ptr != NULL) {
+        memcpy((uint8_t *)out_buf.ptr + header.len + payload_len,
+               head.ptr,
+               head.len);
+        payload_slot->ptr = (uint8_t *)out_buf.ptr + header.len;
+    }
+    payload_slot->len = payload_len;
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_reserved(const struct t_cose_sign1_signer      *me,
+                                  struct t_cose_sign1_sign_call         *call,
+                                  const struct t_cose_sign1_reservation *reservation,
+                                  struct q_useful_buf_c                  aad,
+                                  struct q_useful_buf_c                 *result)
+{
+    enum t_cose_err_t             return_value;
+    struct t_cose_sign1_sign_call default_call;
+    struct q_useful_buf_c         payload;
+    struct q_useful_buf_c         signature;
+    struct q_useful_buf           buffer_for_signature;
+
+    T_COSE_PROBE3(sign1_sign_entry, me->cose_algorithm_id, reservation->payload_len, aad.len);
+
+    if(reservation->message.len == 0) {
+        /* Reserving failed or wasn't done */
+        return_value = T_COSE_ERR_INVALID_ARGUMENT;
+        goto Done;
+    }
+
+    if(reservation->message.ptr == NULL) {
+        /* Output size calculation */
+        *result = (struct q_useful_buf_c){NULL, reservation->message.len};
+        return_value = T_COSE_SUCCESS;
+        goto Done;
+    }
+
+    if(call == NULL) {
+        t_cose_sign1_sign_call_init(&default_call, NULL_Q_USEFUL_BUF);
+        call = &default_call;
+    }
+
+    payload.ptr = (const uint8_t *)reservation->message.ptr + reservation->payload_offset;
+    payload.len = reservation->payload_len;
+    buffer_for_signature.ptr = (uint8_t *)reservation->message.ptr + reservation->signature_offset;
+    buffer_for_signature.len = reservation->signature_len;
+
+    /* The signature is made right where it goes in the message */
+    return_value = sign1_sign(me,
+                              call,
+                              aad,
+                              payload,
+                              buffer_for_signature,
+                             &signature);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    if(signature.ptr != buffer_for_signature.ptr ||
+       signature.len != buffer_for_signature.len) {
+        /* The head before it says how big it is, so it can't be
+         * anything else. */
+        return_value = T_COSE_ERR_SIG_FAIL;
+        goto Done;
+    }
+
+    *result = (struct q_useful_buf_c){reservation->message.ptr,
+                                      reservation->message.len};
+
+Done:
+    T_COSE_PROBE3(sign1_sign_return,
+                  return_value,
+                  me->cose_algorithm_id,
+                  return_value == T_COSE_SUCCESS ? result->len : 0);
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_iovec(const struct t_cose_sign1_signer *me,
+                               struct t_cose_sign1_sign_call    *call,
+                               struct q_useful_buf_c             aad,
+                               struct q_useful_buf_c             payload,
+                               struct q_useful_buf               header_buf,
+                               struct q_useful_buf               trailer_buf,
+                               struct t_cose_sign1_iovec        *result)
+{
+    enum t_cose_err_t             return_value;
+    struct t_cose_sign1_sign_call default_call;
+    uint8_t                       head_buf[QCBOR_HEAD_BUFFER_SIZE];
+    struct q_useful_buf_c         head;
+    struct q_useful_buf_c         signature;
+    struct q_useful_buf           buffer_for_signature;
+    size_t                        sig_size;
+
+    T_COSE_PROBE3(sign1_sign_entry, me->cose_algorithm_id, payload.len, aad.len);
+
+    result->header  = NULL_Q_USEFUL_BUF_C;
+    result->payload = payload;
+    result->trailer = NULL_Q_USEFUL_BUF_C;
+
+    return_value = sign1_signature_size(me, &sig_size);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    return_value = sign1_encode_header(me, payload.len, header_buf, &result->header);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    /* The trailer is the head of the signature byte string followed
+     * by the signature. */
+    head = QCBOREncode_EncodeHead(Q_USEFUL_BUF_FROM_BYTE_ARRAY(head_buf),
+                                  CBOR_MAJOR_TYPE_BYTE_STRING,
+                                  0,
+                                  sig_size);
+    if(head.len > trailer_buf.len || sig_size > trailer_buf.len - head.len) {
+        return_value = T_COSE_ERR_TOO_SMALL;
+        goto Done;
+    }
+
+    if(header_buf.ptr == NULL || trailer_buf.ptr == NULL) {
+        /* Output size calculation */
+        result->trailer = (struct q_useful_buf_c){NULL, head.len + sig_size};
+        goto Done;
+    }
+    memcpy(trailer_buf.ptr, head.ptr, head.len);
+
+    if(call == NULL) {
+        t_cose_sign1_sign_call_init(&default_call, NULL_Q_USEFUL_BUF);
+        call = &default_call;
+    }
+
+    buffer_for_signature.ptr = (uint8_t *)trailer_buf.ptr + head.len;
+    buffer_for_signature.len = sig_size;
+    return_value = sign1_sign(me,
+                              call,
+                              aad,
+                              payload,
+                              buffer_for_signature,
+                             &signature);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    if(signature.len != sig_size) {
+        /* The head before it says how big it is */
+        return_value = T_COSE_ERR_SIG_FAIL;
+        goto Done;
+    }
+
+    result->trailer = (struct q_useful_buf_c){trailer_buf.ptr, head.len + sig_size};
+
+Done:
+    T_COSE_PROBE3(sign1_sign_return,
+                  return_value,
+                  me->cose_algorithm_id,
+                  return_value == T_COSE_SUCCESS ?
+                      result->header.len + payload.len + result->trailer.len : 0);
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_sign_iovec(struct t_cose_sign1_sign_ctx *me,
+                        struct q_useful_buf_c         aad,
+                        struct q_useful_buf_c         payload,
+                        struct q_useful_buf           header_buf,
+                        struct q_useful_buf           trailer_buf,
+                        struct t_cose_sign1_iovec    *result)
+{
+    enum t_cose_err_t return_value;
+
+    return_value = encode_protected_parameters(&me->signer);
+    if(return_value != T_COSE_SUCCESS) {
+        result->header  = NULL_Q_USEFUL_BUF_C;
+        result->payload = payload;
+        result->trailer = NULL_Q_USEFUL_BUF_C;
+        return return_value;
+    }
+
+    return t_cose_sign1_signer_sign_iovec(&me->signer,
+                                          &me->call,
+                                          aad,
+                                          payload,
+                                          header_buf,
+                                          trailer_buf,
+                                          result);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_reserve_payload(struct t_cose_sign1_sign_ctx    *me,
+                             size_t                           payload_len,
+                             struct q_useful_buf              out_buf,
+                             struct t_cose_sign1_reservation *reservation,
+                             struct q_useful_buf             *payload_slot)
+{
+    enum t_cose_err_t return_value;
+
+    return_value = encode_protected_parameters(&me->signer);
+    if(return_value != T_COSE_SUCCESS) {
+        memset(reservation, 0, sizeof(*reservation));
+        *payload_slot = NULL_Q_USEFUL_BUF;
+        return return_value;
+    }
+
+    return t_cose_sign1_signer_reserve_payload(&me->signer,
+                                               payload_len,
+                                               out_buf,
+                                               reservation,
+                                               payload_slot);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_batch(const struct t_cose_sign1_signer    *me,
+                               struct t_cose_sign1_sign_call       *call,
+                               struct t_cose_sign1_sign_batch_item *items,
+                               size_t                               num_items)
+{
+    /* Aproximate stack usage
+     *                                             64-bit      32-bit
+     *   local vars                                    96          48
+     *   encode contexts                       168 * group 148 * group
+     *   TBS hash items                         80 * group  40 * group
+     *   hash buffers                           64 * group  64 * group
+     *   index list                              8 * group   4 * group
+     *   MAX(create_tbs_hash_batch         3560-5896  2284-4620
+     *       crypto lib sign            64-1024    64-1024) 3560-5896  2284-4620
+     *   TOTAL (group of 16)                   9000-11300  6800-9100
+     */
+    QCBOREncodeContext          encode_context[T_COSE_BATCH_GROUP_SIZE];
+    struct t_cose_tbs_hash_item tbs[T_COSE_BATCH_GROUP_SIZE];
+    uint8_t                     hash_buffers[T_COSE_BATCH_GROUP_SIZE][T_COSE_CRYPTO_MAX_HASH_SIZE];
+    size_t                      tbs_item[T_COSE_BATCH_GROUP_SIZE];
+    struct q_useful_buf         buffer_for_signature;
+    struct q_useful_buf_c       signature;
+    struct q_useful_buf_c       signed_payload;
+    enum t_cose_err_t           return_value;
+    enum t_cose_err_t           hash_result;
+    size_t                      group;
+    size_t                      num_tbs;
+    size_t                      i;
+    size_t                      j;
+
+    T_COSE_PROBE2(sign1_sign_batch_entry, me->cose_algorithm_id, num_items);
+
+    return_value = T_COSE_SUCCESS;
+
+#ifndef T_COSE_DISABLE_EDDSA
+    if(me->cose_algorithm_id == COSE_ALGORITHM_EDDSA &&
+       !(me->option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG)) {
+        /* EdDSA signs the TBS bytes rather than a hash of them, so
+         * there's nothing to batch. */
+        for(i = 0; i < num_items; i++) {
+            items[i].err = t_cose_sign1_signer_sign_internal(me,
+                                                             call,
+                                                             false,
+                                                             items[i].payload,
+                                                             items[i].aad,
+                                                             items[i].out_buf,
+                                                            &items[i].result);
+            if(items[i].err && !return_value) {
+                return_value = items[i].err;
+            }
+        }
+        goto Done;
+    }
+#else
+    (void)call;
+#endif /* T_COSE_DISABLE_EDDSA */
+
+    for(; num_items > 0; num_items -= group, items += group) {
+        group = num_items < T_COSE_BATCH_GROUP_SIZE ? num_items : T_COSE_BATCH_GROUP_SIZE;
+
+        /* -- Output everything before the signature for each -- */
+        num_tbs = 0;
+        for(i = 0; i < group; i++) {
+            items[i].result = NULL_Q_USEFUL_BUF_C;
+            QCBOREncode_Init(&encode_context[i], items[i].out_buf);
+            items[i].err = sign1_encode_parameters(me, false, &encode_context[i]);
+            if(items[i].err) {
+                continue;
+            }
+            QCBOREncode_AddEncoded(&encode_context[i], items[i].payload);
+            QCBOREncode_CloseBstrWrap2(&encode_context[i], false, &signed_payload);
+
+            /* Catch encoding errors here so their hashes aren't computed */
+            switch(QCBOREncode_GetErrorState(&encode_context[i])) {
+            case QCBOR_SUCCESS:
+                break;
+            case QCBOR_ERR_BUFFER_TOO_SMALL:
+                items[i].err = T_COSE_ERR_TOO_SMALL;
+                continue;
+            default:
+                items[i].err = T_COSE_ERR_CBOR_FORMATTING;
+                continue;
+            }
+
+            tbs[num_tbs].protected_parameters = signer_protected_parameters(me);
+            tbs[num_tbs].aad                  = items[i].aad;
+            tbs[num_tbs].payload              = signed_payload;
+            tbs[num_tbs].buffer_for_hash      = (struct q_useful_buf){hash_buffers[num_tbs],
+                                                                       sizeof(hash_buffers[num_tbs])};
+            tbs_item[num_tbs] = i;
+            num_tbs++;
+        }
+
+        /* -- Hash all their TBS bytes together -- */
+        if(num_tbs > 0) {
+            hash_result = create_tbs_hash_batch(me->cose_algorithm_id, tbs, num_tbs);
+            if(hash_result) {
+                for(j = 0; j < num_tbs; j++) {
+                    items[tbs_item[j]].err = hash_result;
+                }
+                num_tbs = 0;
+            }
+        }
+
+        /* -- Sign and finish each one -- */
+        for(j = 0; j < num_tbs; j++) {
+            i = tbs_item[j];
+            QCBOREncode_OpenBytes(&encode_context[i], &buffer_for_signature);
+            items[i].err = sign1_sign_tbs_hash(me,
+                                               tbs[j].hash,
+                                               buffer_for_signature,
+                                              &signature);
+            if(items[i].err) {
+                continue;
+            }
+            QCBOREncode_CloseBytes(&encode_context[i], signature.len);
+            QCBOREncode_CloseArray(&encode_context[i]);
+            items[i].err = sign1_finish_encode(&encode_context[i], &items[i].result);
+        }
+
+        for(i = 0; i < group && !return_value; i++) {
+            return_value = items[i].err;
+        }
+    }
+
+#ifndef T_COSE_DISABLE_EDDSA
+Done:
+#endif
+    T_COSE_PROBE2(sign1_sign_batch_return, return_value, me->cose_algorithm_id);
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_sign_batch(struct t_cose_sign1_sign_ctx        *me,
+                        struct t_cose_sign1_sign_batch_item *items,
+                        size_t                               num_items)
+{
+    enum t_cose_err_t return_value;
+    size_t            i;
+
+    return_value = encode_protected_parameters(&me->signer);
+    if(return_value != T_COSE_SUCCESS) {
+        for(i = 0; i < num_items; i++) {
+            items[i].result = NULL_Q_USEFUL_BUF_C;
+            items[i].err    = return_value;
+        }
+        return num_items > 0 ? return_value : T_COSE_SUCCESS;
+    }
+
+    return t_cose_sign1_signer_sign_batch(&me->signer, &me->call, items, num_items);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_signer_sign_merkle(const struct t_cose_sign1_signer *me,
+                                struct t_cose_sign1_sign_call    *call,
+                                const struct q_useful_buf_c      *payloads,
+                                size_t                            num_payloads,
+                                struct q_useful_buf               tree_buf,
+                                struct q_useful_buf               out_buf,
+                                struct t_cose_merkle_tree        *tree)
+{
+    enum t_cose_err_t     return_value;
+    int32_t               hash_alg_id;
+    struct q_useful_buf_c first_leaf;
+    uint8_t              *level;
+    size_t                level_size;
+    size_t                num_nodes;
+
+    T_COSE_PROBE2(sign1_sign_batch_entry, me->cose_algorithm_id, num_payloads);
+
+    memset(tree, 0, sizeof(*tree));
+
+    if(num_payloads == 0) {
+        return_value = T_COSE_ERR_INVALID_ARGUMENT;
+        goto Done;
+    }
+
+    hash_alg_id = merkle_hash_alg_id(me->cose_algorithm_id);
+    if(hash_alg_id == T_COSE_INVALID_ALGORITHM_ID) {
+        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        goto Done;
+    }
+
+    /* The first leaf gives the hash size, which fixes where
+     * everything else goes in the tree buffer. */
+    return_value = merkle_leaf_hash(hash_alg_id, payloads[0], tree_buf, &first_leaf);
+    if(return_value == T_COSE_ERR_HASH_BUFFER_SIZE) {
+        return_value = T_COSE_ERR_TOO_SMALL;
+    }
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    num_nodes = 1;
+    for(level_size = num_payloads; level_size > 1; level_size = (level_size + 1) / 2) {
+        num_nodes += level_size;
+    }
+    if(num_nodes > tree_buf.len / first_leaf.len) {
+        return_value = T_COSE_ERR_TOO_SMALL;
+        goto Done;
+    }
+
+    level = tree_buf.ptr;
+    return_value = merkle_hash_leaves(hash_alg_id,
+                                      payloads + 1,
+                                      num_payloads - 1,
+                                      first_leaf.len,
+                                      level + first_leaf.len);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    for(level_size = num_payloads; level_size > 1; level_size = (level_size + 1) / 2) {
+        return_value = merkle_hash_level(hash_alg_id,
+                                         level,
+                                         level_size,
+                                         first_leaf.len,
+                                         level + level_size * first_leaf.len);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+        level += level_size * first_leaf.len;
+    }
+
+    /* level is now the root */
+    return_value = t_cose_sign1_signer_sign_internal(me,
+                                                     call,
+                                                     false,
+                                                     (struct q_useful_buf_c){level, first_leaf.len},
+                                                     NULL_Q_USEFUL_BUF_C,
+                                                     out_buf,
+                                                    &tree->signed_root);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    tree->nodes      = tree_buf.ptr;
+    tree->num_leaves = num_payloads;
+    tree->hash_size  = first_leaf.len;
+
+Done:
+    T_COSE_PROBE2(sign1_sign_batch_return, return_value, me->cose_algorithm_id);
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_sign1_sign_merkle(struct t_cose_sign1_sign_ctx *me,
+                         const struct q_useful_buf_c  *payloads,
+                         size_t                        num_payloads,
+                         struct q_useful_buf           tree_buf,
+                         struct q_useful_buf           out_buf,
+                         struct t_cose_merkle_tree    *tree)
+{
+    enum t_cose_err_t return_value;
+
+    return_value = encode_protected_parameters(&me->signer);
+    if(return_value != T_COSE_SUCCESS) {
+        memset(tree, 0, sizeof(*tree));
+        return return_value;
+    }
+
+    return t_cose_sign1_signer_sign_merkle(&me->signer,
+                                           &me->call,
+                                           payloads,
+                                           num_payloads,
+                                           tree_buf,
+                                           out_buf,
+                                           tree);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_sign.h
+ */
+enum t_cose_err_t
+t_cose_merkle_tree_receipt(const struct t_cose_merkle_tree *tree,
+                           size_t                           index,
+                           struct q_useful_buf              out_buf,
+                           struct q_useful_buf_c           *receipt)
+{
+    QCBOREncodeContext cbor_encode_ctx;
+    const uint8_t     *level;
+    size_t             level_size;
+    size_t             sibling;
+
+    *receipt = NULL_Q_USEFUL_BUF_C;
+
+    if(index >= tree->num_leaves) {
+        return T_COSE_ERR_INVALID_ARGUMENT;
+    }
+
+    QCBOREncode_Init(&cbor_encode_ctx, out_buf);
+    QCBOREncode_OpenArray(&cbor_encode_ctx);
+    QCBOREncode_AddBytes(&cbor_encode_ctx, tree->signed_root);
+    QCBOREncode_AddUInt64(&cbor_encode_ctx, index);
+    QCBOREncode_AddUInt64(&cbor_encode_ctx, tree->num_leaves);
+
+    /* The sibling at each level from the leaf up. A node with no
+     * sibling moved up unchanged so it adds nothing to the path. */
+    QCBOREncode_OpenArray(&cbor_encode_ctx);
+    level = tree->nodes;
+    for(level_size = tree->num_leaves; level_size > 1; level_size = (level_size + 1) / 2) {
+        sibling = index ^ 1;
+        if(sibling < level_size) {
+            QCBOREncode_AddBytes(&cbor_encode_ctx,
+                                 (struct q_useful_buf_c){level + sibling * tree->hash_size,
+                                                         tree->hash_size});
+        }
+        level += level_size * tree->hash_size;
+        index /= 2;
+    }
+    QCBOREncode_CloseArray(&cbor_encode_ctx);
+    QCBOREncode_CloseArray(&cbor_encode_ctx);
+
+    return sign1_finish_encode(&cbor_encode_ctx, receipt);
+}
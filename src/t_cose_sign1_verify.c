@@ -8,18 +8,20 @@
  * See BSD-3-Clause license in README.md
  */
 
-
+#include <time.h>
 #include "qcbor/qcbor_decode.h"
 #ifndef QCBOR_SPIFFY_DECODE
 #error This t_cose requires a version of QCBOR that supports spiffy decode
 #endif
 #include "qcbor/qcbor_spiffy_decode.h"
 #include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_replay_cache.h"
 #include "t_cose/q_useful_buf.h"
 #include "t_cose_crypto.h"
 #include "t_cose_util.h"
 #include "t_cose_parameters.h"
 #include "t_cose_short_circuit.h"
+#include "t_cose_trace.h"
 
 
 
@@ -33,7 +35,8 @@
 /**
  * \brief Check the tagging of the COSE about to be verified.
  *
- * \param[in] me                 The verification context.
+ * \param[in] me                 The verification configuration.
+ * \param[out] call              Where the tags go.
  * \param[in] decode_context     The decoder context to pull from.
  *
  * \return This returns one of the error codes defined by \ref
@@ -49,7 +52,9 @@
  * at the level above COSE.
  */
 static inline enum t_cose_err_t
-process_tags(struct t_cose_sign1_verify_ctx *me, QCBORDecodeContext *decode_context)
+process_tags(const struct t_cose_sign1_verifier *me,
+             struct t_cose_sign1_verify_call    *call,
+             QCBORDecodeContext                 *decode_context)
 {
     /* Aproximate stack usage
      *                                             64-bit      32-bit
@@ -59,12 +64,18 @@ process_tags(struct t_cose_sign1_verify_ctx *me, QCBORDecodeContext *decode_cont
     uint64_t uTag;
     uint32_t item_tag_index = 0;
     int returned_tag_index;
+    size_t   max_tags;
+
+    max_tags = me->policy != NULL ? me->policy->max_tags : SIZE_MAX;
 
     /* The 0th tag is the only one that might identify the type of the
      * CBOR we are trying to decode so it is handled special.
      */
     uTag = QCBORDecode_GetNthTagOfLast(decode_context, item_tag_index);
     item_tag_index++;
+    if(uTag != CBOR_TAG_INVALID64 && max_tags == 0) {
+        return T_COSE_ERR_TOO_MANY_TAGS;
+    }
     if(me->option_flags & T_COSE_OPT_TAG_REQUIRED) {
         /* The protocol that is using COSE says the input CBOR must
          * be a COSE tag.
@@ -90,7 +101,7 @@ process_tags(struct t_cose_sign1_verify_ctx *me, QCBORDecodeContext *decode_cont
 #if CBOR_TAG_INVALID64 != 0xffffffffffffffff
 #error Initializing return tags array
 #endif
-    memset(me->auTags, 0xff, sizeof(me->auTags));
+    memset(call->auTags, 0xff, sizeof(call->auTags));
 
     returned_tag_index = 0;
 
@@ -99,7 +110,7 @@ process_tags(struct t_cose_sign1_verify_ctx *me, QCBORDecodeContext *decode_cont
          * that you can sign a COSE_SIGN1 recursively. This only takes out
          * the one tag layer that is processed here.
          */
-        me->auTags[returned_tag_index] = uTag;
+        call->auTags[returned_tag_index] = uTag;
         returned_tag_index++;
     }
 
@@ -109,10 +120,13 @@ process_tags(struct t_cose_sign1_verify_ctx *me, QCBORDecodeContext *decode_cont
         if(uTag == CBOR_TAG_INVALID64) {
             break;
         }
+        if(item_tag_index > max_tags) {
+            return T_COSE_ERR_TOO_MANY_TAGS;
+        }
         if(returned_tag_index > T_COSE_MAX_TAGS_TO_RETURN) {
             return T_COSE_ERR_TOO_MANY_TAGS;
         }
-        me->auTags[returned_tag_index] = uTag;
+        call->auTags[returned_tag_index] = uTag;
         returned_tag_index++;
     }
 
@@ -144,11 +158,220 @@ qcbor_decode_error_to_t_cose_error(QCBORError qcbor_error)
 }
 
 
+/**
+ * \brief Get the saved hash state in a header cache entry.
+ *
+ * \param[in] entry  The cache entry.
+ *
+ * \return The hash context that lives in \c entry.
+ */
+static inline struct t_cose_crypto_hash *
+header_cache_hash_ctx(struct t_cose_header_cache_entry *entry)
+{
+    return (struct t_cose_crypto_hash *)entry->hash_ctx;
+}
+
+
+/**
+ * \brief Move the pointers in a set of parameters to a copy of the
+ * bytes they point into.
+ *
+ * \param[in,out] parameters  The parameters to move.
+ * \param[in] from            The bytes they point into now.
+ * \param[in] to              The copy of \c from to point into.
+ *
+ * Only parameters decoded from the bytes at \c from may be given.
+ */
+static void
+rebase_parameters(struct t_cose_parameters *parameters,
+                  const uint8_t            *from,
+                  const uint8_t            *to)
+{
+    struct q_useful_buf_c *pointers[] = {
+        &parameters->kid,
+        &parameters->iv,
+        &parameters->partial_iv,
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+        &parameters->content_type_tstr,
+#endif
+        &parameters->preimage_content_type_tstr,
+        &parameters->x5chain,
+        &parameters->x5chain_leaf,
+        &parameters->x5t_hash,
+    };
+    size_t i;
+
+    for(i = 0; i < sizeof(pointers) / sizeof(pointers[0]); i++) {
+        if(pointers[i]->ptr != NULL) {
+            pointers[i]->ptr = to + ((const uint8_t *)pointers[i]->ptr - from);
+        }
+    }
+}
+
+
+/**
+ * \brief Look up encoded protected header parameters in a cache.
+ *
+ * \param[in,out] cache            The cache or \c NULL.
+ * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
+ *
+ * \return The entry for \c protected_parameters or \c NULL if
+ *         they are not in the cache.
+ */
+static struct t_cose_header_cache_entry *
+header_cache_find(struct t_cose_header_cache *cache,
+                  struct q_useful_buf_c       protected_parameters)
+{
+    struct t_cose_header_cache_entry *entry;
+    size_t                            i;
+
+    if(cache == NULL ||
+       protected_parameters.len == 0 ||
+       protected_parameters.len > T_COSE_HEADER_CACHE_MAX_PROTECTED) {
+        return NULL;
+    }
+
+    for(i = 0; i < cache->num_entries; i++) {
+        entry = &cache->entries[i];
+        if(entry->protected_len == protected_parameters.len &&
+           !memcmp(entry->protected_parameters, protected_parameters.ptr, protected_parameters.len)) {
+            entry->last_used = ++cache->clock;
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * \brief Add decoded protected header parameters to a cache.
+ *
+ * \param[in,out] cache            The cache.
+ * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
+ * \param[in] parameters           What was decoded from them.
+ *
+ * This replaces an unused entry or the least recently used one. The
+ * hash of the to-be-signed bytes up to the end of the protected
+ * header parameters is started here and saved in the entry if the
+ * crypto adapter's hash context fits.
+ */
+static void
+header_cache_add(struct t_cose_header_cache     *cache,
+                 struct q_useful_buf_c           protected_parameters,
+                 const struct t_cose_parameters *parameters)
+{
+    struct t_cose_header_cache_entry *entry;
+    size_t                            i;
+
+    if(cache->num_entries == 0 ||
+       protected_parameters.len == 0 ||
+       protected_parameters.len > T_COSE_HEADER_CACHE_MAX_PROTECTED) {
+        return;
+    }
+
+    entry = &cache->entries[0];
+    for(i = 0; i < cache->num_entries; i++) {
+        if(cache->entries[i].protected_len == 0) {
+            entry = &cache->entries[i];
+            break;
+        }
+        if(cache->entries[i].last_used < entry->last_used) {
+            entry = &cache->entries[i];
+        }
+    }
+
+    if(entry->has_hash) {
+        t_cose_crypto_hash_abort(header_cache_hash_ctx(entry));
+        entry->has_hash = false;
+    }
+
+    memcpy(entry->protected_parameters, protected_parameters.ptr, protected_parameters.len);
+    entry->protected_len = protected_parameters.len;
+    entry->parameters    = *parameters;
+    rebase_parameters(&entry->parameters, protected_parameters.ptr, entry->protected_parameters);
+    entry->last_used     = ++cache->clock;
+
+    if(sizeof(struct t_cose_crypto_hash) <= sizeof(entry->hash_ctx)) {
+        /* An unsupported algorithm just doesn't get a saved hash.
+         * The error comes when the message is verified. */
+        entry->has_hash = start_tbs_hash(parameters->cose_algorithm_id,
+                                         (struct q_useful_buf_c){entry->protected_parameters,
+                                                                 entry->protected_len},
+                                         header_cache_hash_ctx(entry)) == T_COSE_SUCCESS;
+    }
+}
+
+
+/**
+ * \brief Compute the hash of the to-be-signed bytes, resuming from
+ * the header cache if possible.
+ *
+ * \param[in,out] call             The state of this verification.
+ * \param[in] cose_algorithm_id    The COSE signing algorithm ID.
+ * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
+ * \param[in] aad                  The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] payload              Pointer and length of the message's payload.
+ * \param[in] buffer_for_hash      Pointer and length of buffer into which
+ *                                 the resulting hash is put.
+ * \param[out] hash                Pointer and length of the
+ *                                 resulting hash.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * The result is always the same as create_tbs_hash().
+ */
+static enum t_cose_err_t
+sign1_tbs_hash(struct t_cose_sign1_verify_call *call,
+               int32_t                          cose_algorithm_id,
+               struct q_useful_buf_c            protected_parameters,
+               struct q_useful_buf_c            aad,
+               struct q_useful_buf_c            payload,
+               struct q_useful_buf              buffer_for_hash,
+               struct q_useful_buf_c           *hash)
+{
+    enum t_cose_err_t                 return_value;
+    struct t_cose_header_cache_entry *entry;
+    struct t_cose_crypto_hash         hash_ctx;
+
+    entry = header_cache_find(call->header_cache, protected_parameters);
+    if(entry == NULL ||
+       !entry->has_hash ||
+       entry->parameters.cose_algorithm_id != cose_algorithm_id) {
+        return create_tbs_hash(cose_algorithm_id,
+                               protected_parameters,
+                               aad,
+                               payload,
+                               buffer_for_hash,
+                               hash);
+    }
+
+    T_COSE_PROBE3(tbs_hash_entry, cose_algorithm_id, aad.len, payload.len);
+
+    return_value = t_cose_crypto_hash_clone(&hash_ctx, header_cache_hash_ctx(entry));
+    if(return_value) {
+        goto Done;
+    }
+
+    return_value = finish_tbs_hash(cose_algorithm_id,
+                                  &hash_ctx,
+                                   aad,
+                                   payload,
+                                   buffer_for_hash,
+                                   hash);
+
+Done:
+    T_COSE_PROBE2(tbs_hash_return, return_value, cose_algorithm_id);
+    return return_value;
+}
+
+
 #ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
 /**
  * \brief Verify the short-circuit signature of a COSE_Sign1 message.
  *
- * \param[in] me                   The t_cose signature verification context.
+ * \param[in] me                   The verification configuration.
+ * \param[in,out] call             The state of this verification.
  * \param[in] parameters           The previously decoded parameters from the message.
  * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
  * \param[in] aad                  The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
@@ -166,12 +389,13 @@ qcbor_decode_error_to_t_cose_error(QCBORError qcbor_error)
  * flag must be set in the verification context.
  */
 static inline enum t_cose_err_t
-sign1_verify_short_circuit(struct t_cose_sign1_verify_ctx *me,
-                           const struct t_cose_parameters *parameters,
-                           struct q_useful_buf_c           signature,
-                           struct q_useful_buf_c           protected_parameters,
-                           struct q_useful_buf_c           aad,
-                           struct q_useful_buf_c           payload)
+sign1_verify_short_circuit(const struct t_cose_sign1_verifier *me,
+                           struct t_cose_sign1_verify_call    *call,
+                           const struct t_cose_parameters     *parameters,
+                           struct q_useful_buf_c               signature,
+                           struct q_useful_buf_c               protected_parameters,
+                           struct q_useful_buf_c               aad,
+                           struct q_useful_buf_c               payload)
 {
     enum t_cose_err_t          return_value;
     Q_USEFUL_BUF_MAKE_STACK_UB(buffer_for_tbs_hash, T_COSE_CRYPTO_MAX_HASH_SIZE);
@@ -188,12 +412,13 @@ sign1_verify_short_circuit(struct t_cose_sign1_verify_ctx *me,
     }
 
     /* -- Compute the TBS hash -- */
-    return_value = create_tbs_hash(parameters->cose_algorithm_id,
-                                   protected_parameters,
-                                   aad,
-                                   payload,
-                                   buffer_for_tbs_hash,
-                                   &tbs_hash);
+    return_value = sign1_tbs_hash(call,
+                                  parameters->cose_algorithm_id,
+                                  protected_parameters,
+                                  aad,
+                                  payload,
+                                  buffer_for_tbs_hash,
+                                 &tbs_hash);
     if(return_value) {
         goto Done;
     }
@@ -207,10 +432,89 @@ Done:
 
 
 #ifndef T_COSE_DISABLE_EDDSA
+/**
+ * \brief Serialize the to-be-signed bytes for EdDSA.
+ *
+ * \param[in,out] call             The state of this verification.
+ * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
+ * \param[in] aad                  The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] payload              Pointer and length of the message's payload.
+ * \param[out] tbs                 The to-be-signed bytes.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * The bytes go in the auxiliary buffer in \c call. The size they
+ * need is recorded in \c call even if the buffer is \c NULL so the
+ * caller can find out how big it needs to be.
+ */
+static enum t_cose_err_t
+sign1_eddsa_tbs(struct t_cose_sign1_verify_call *call,
+                struct q_useful_buf_c            protected_parameters,
+                struct q_useful_buf_c            aad,
+                struct q_useful_buf_c            payload,
+                struct q_useful_buf_c           *tbs)
+{
+    enum t_cose_err_t return_value;
+
+    return_value = create_tbs(protected_parameters,
+                              aad,
+                              payload,
+                              call->auxiliary_buffer,
+                              tbs);
+    if (return_value == T_COSE_ERR_TOO_SMALL) {
+        /* Be a bit more specific about which buffer is too small */
+        return_value = T_COSE_ERR_AUXILIARY_BUFFER_SIZE;
+    }
+    if (return_value) {
+        goto Done;
+    }
+
+    /* Record how much buffer we actually used / would have used,
+     * allowing the caller to allocate an appropriately sized buffer.
+     * This is particularly useful in DECODE_ONLY mode.
+     */
+    call->auxiliary_buffer_size = tbs->len;
+
+Done:
+    return return_value;
+}
+
+
+/**
+ * \brief Have the crypto adapter verify an EdDSA signature over the
+ * to-be-signed bytes.
+ *
+ * \param[in] verification_key  The key to verify with.
+ * \param[in] parameters        The previously decoded parameters from the message.
+ * \param[in] tbs               The to-be-signed bytes.
+ * \param[in] signature         Pointer and length of the message's signature.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ */
+static enum t_cose_err_t
+sign1_verify_eddsa_tbs(struct t_cose_key               verification_key,
+                       const struct t_cose_parameters *parameters,
+                       struct q_useful_buf_c           tbs,
+                       struct q_useful_buf_c           signature)
+{
+    enum t_cose_err_t return_value;
+
+    T_COSE_PROBE1(crypto_verify_eddsa_entry, tbs.len);
+    return_value = t_cose_crypto_verify_eddsa(verification_key,
+                                              parameters->kid,
+                                              tbs,
+                                              signature);
+    T_COSE_PROBE1(crypto_verify_eddsa_return, return_value);
+
+    return return_value;
+}
+
+
 /**
  * \brief Verify the EDDSA signature from a COSE_Sign1 message.
  *
- * \param[in] me                   The t_cose signature verification context.
+ * \param[in] me                   The verification configuration.
+ * \param[in,out] call             The state of this verification.
  * \param[in] parameters           The previously decoded parameters from the message.
  * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
  * \param[in] aad                  The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
@@ -223,20 +527,21 @@ Done:
  * the to-be-signed data, and therefore cannot be performed incrementally.
  * This function serializes the to-be-signed bytes and uses the crypto
  * adapter to verify the signature. An auxiliary buffer, used to store
- * the to-be-signed bytes, must have previously been configured by
- * calling the \ref t_cose_sign1_verify_set_auxiliary_buffer function.
+ * the to-be-signed bytes, must be in \c call, for example from
+ * \ref t_cose_sign1_verify_set_auxiliary_buffer.
  *
  * Signature verification is skipped if the \ref T_COSE_OPT_DECODE_ONLY
  * flag is set. This mode can however be used to determine the
  * necessary size for the auxiliary buffer.
  */
 static enum t_cose_err_t
-sign1_verify_eddsa(struct t_cose_sign1_verify_ctx *me,
-                   const struct t_cose_parameters *parameters,
-                   struct q_useful_buf_c           signature,
-                   struct q_useful_buf_c           protected_parameters,
-                   struct q_useful_buf_c           aad,
-                   struct q_useful_buf_c           payload)
+sign1_verify_eddsa(const struct t_cose_sign1_verifier *me,
+                   struct t_cose_sign1_verify_call    *call,
+                   const struct t_cose_parameters     *parameters,
+                   struct q_useful_buf_c               signature,
+                   struct q_useful_buf_c               protected_parameters,
+                   struct q_useful_buf_c               aad,
+                   struct q_useful_buf_c               payload)
 {
     enum t_cose_err_t            return_value;
     struct q_useful_buf_c        tbs;
@@ -248,39 +553,22 @@ sign1_verify_eddsa(struct t_cose_sign1_verify_ctx *me,
      * auxiliary_buffer, and we record the size the structure would
      * have occupied).
      */
-    return_value = create_tbs(protected_parameters,
-                              aad,
-                              payload,
-                              me->auxiliary_buffer,
-                             &tbs);
-    if (return_value == T_COSE_ERR_TOO_SMALL) {
-        /* Be a bit more specific about which buffer is too small */
-        return_value = T_COSE_ERR_AUXILIARY_BUFFER_SIZE;
-    }
+    return_value = sign1_eddsa_tbs(call, protected_parameters, aad, payload, &tbs);
     if (return_value) {
         goto Done;
     }
 
-    /* Record how much buffer we actually used / would have used,
-     * allowing the caller to allocate an appropriately sized buffer.
-     * This is particularly useful in DECODE_ONLY mode.
-     */
-    me->auxiliary_buffer_size = tbs.len;
-
     if(me->option_flags & T_COSE_OPT_DECODE_ONLY) {
         return_value = T_COSE_SUCCESS;
         goto Done;
     }
 
-    if (me->auxiliary_buffer.ptr == NULL) {
+    if (call->auxiliary_buffer.ptr == NULL) {
         return_value = T_COSE_ERR_NEED_AUXILIARY_BUFFER;
         goto Done;
     }
 
-    return_value = t_cose_crypto_verify_eddsa(me->verification_key,
-                                              parameters->kid,
-                                              tbs,
-                                              signature);
+    return_value = sign1_verify_eddsa_tbs(me->verification_key, parameters, tbs, signature);
 
 Done:
     return return_value;
@@ -288,11 +576,43 @@ Done:
 #endif /* T_COSE_DISABLE_EDDSA */
 
 
+/**
+ * \brief Have the crypto adapter verify a signature over the hash of
+ * the to-be-signed bytes.
+ *
+ * \param[in] verification_key  The key to verify with.
+ * \param[in] parameters        The previously decoded parameters from the message.
+ * \param[in] tbs_hash          The hash of the to-be-signed bytes.
+ * \param[in] signature         Pointer and length of the message's signature.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ */
+static enum t_cose_err_t
+sign1_verify_tbs_hash(struct t_cose_key               verification_key,
+                      const struct t_cose_parameters *parameters,
+                      struct q_useful_buf_c           tbs_hash,
+                      struct q_useful_buf_c           signature)
+{
+    enum t_cose_err_t return_value;
+
+    T_COSE_PROBE2(crypto_verify_entry, parameters->cose_algorithm_id, tbs_hash.len);
+    return_value = t_cose_crypto_verify(parameters->cose_algorithm_id,
+                                        verification_key,
+                                        parameters->kid,
+                                        tbs_hash,
+                                        signature);
+    T_COSE_PROBE2(crypto_verify_return, return_value, parameters->cose_algorithm_id);
+
+    return return_value;
+}
+
+
 /**
  * \brief Verify the signature from a COSE_Sign1 message, following
  * the general process which work for most algorithms.
  *
- * \param[in] me                   The t_cose signature verification context.
+ * \param[in] me                   The verification configuration.
+ * \param[in,out] call             The state of this verification.
  * \param[in] parameters           The previously decoded parameters from the message.
  * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
  * \param[in] aad                  The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
@@ -309,12 +629,13 @@ Done:
  * \ref sign1_sign_eddsa.
  */
 static enum t_cose_err_t
-sign1_verify_default(struct t_cose_sign1_verify_ctx *me,
-                     const struct t_cose_parameters *parameters,
-                     struct q_useful_buf_c           signature,
-                     struct q_useful_buf_c           protected_parameters,
-                     struct q_useful_buf_c           aad,
-                     struct q_useful_buf_c           payload)
+sign1_verify_default(const struct t_cose_sign1_verifier *me,
+                     struct t_cose_sign1_verify_call    *call,
+                     const struct t_cose_parameters     *parameters,
+                     struct q_useful_buf_c               signature,
+                     struct q_useful_buf_c               protected_parameters,
+                     struct q_useful_buf_c               aad,
+                     struct q_useful_buf_c               payload)
 {
     enum t_cose_err_t          return_value;
     Q_USEFUL_BUF_MAKE_STACK_UB(buffer_for_tbs_hash, T_COSE_CRYPTO_MAX_HASH_SIZE);
@@ -326,68 +647,144 @@ sign1_verify_default(struct t_cose_sign1_verify_ctx *me,
     }
 
     /* -- Compute the TBS hash -- */
-    return_value = create_tbs_hash(parameters->cose_algorithm_id,
-                                   protected_parameters,
-                                   aad,
-                                   payload,
-                                   buffer_for_tbs_hash,
-                                   &tbs_hash);
+    return_value = sign1_tbs_hash(call,
+                                  parameters->cose_algorithm_id,
+                                  protected_parameters,
+                                  aad,
+                                  payload,
+                                  buffer_for_tbs_hash,
+                                 &tbs_hash);
     if(return_value) {
         goto Done;
     }
 
     /* -- Call crypto adapter to verify the signature -- */
-    return_value = t_cose_crypto_verify(parameters->cose_algorithm_id,
-                                        me->verification_key,
-                                        parameters->kid,
-                                        tbs_hash,
-                                        signature);
+    return_value = sign1_verify_tbs_hash(me->verification_key, parameters, tbs_hash, signature);
 
 Done:
     return return_value;
 }
 
 
-/*
- * Semi-private function. See t_cose_sign1_verify.h
+/**
+ * \brief Check a decoded \c COSE_Sign1 against a verification policy.
+ *
+ * \param[in] policy      The verification policy.
+ * \param[in] parameters  The decoded header parameters.
+ * \param[in] payload     The payload or \c NULL_Q_USEFUL_BUF_C if it
+ *                        is detached and not known yet.
+ * \param[in] signature   The signature.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * These are the checks that need the whole message decoded. The
+ * message size, tag count and protected header size are checked
+ * earlier, as decoding gets to them.
  */
-enum t_cose_err_t
-t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
-                             struct q_useful_buf_c           cose_sign1,
-                             struct q_useful_buf_c           aad,
-                             struct q_useful_buf_c          *payload,
-                             struct t_cose_parameters       *returned_parameters,
-                             bool                            is_dc)
+static enum t_cose_err_t
+check_policy(const struct t_cose_sign1_policy *policy,
+             const struct t_cose_parameters   *parameters,
+             struct q_useful_buf_c             payload,
+             struct q_useful_buf_c             signature)
+{
+    const struct t_cose_sign1_policy_alg *alg;
+    size_t                                i;
+
+    if(policy->algorithms != NULL) {
+        alg = NULL;
+        for(i = 0; i < policy->num_algorithms; i++) {
+            if(policy->algorithms[i].cose_algorithm_id == parameters->cose_algorithm_id) {
+                alg = &policy->algorithms[i];
+                break;
+            }
+        }
+        if(alg == NULL) {
+            return T_COSE_ERR_POLICY_ALGORITHM;
+        }
+        if(alg->signature_size != 0 && signature.len != alg->signature_size) {
+            return T_COSE_ERR_POLICY_SIGNATURE_SIZE;
+        }
+    }
+
+    if(policy->kid_size != SIZE_MAX &&
+       (q_useful_buf_c_is_null(parameters->kid) || parameters->kid.len != policy->kid_size)) {
+        return T_COSE_ERR_POLICY_KID;
+    }
+
+    if(payload.len > policy->max_payload_size) {
+        return T_COSE_ERR_POLICY_SIZE;
+    }
+
+    return T_COSE_SUCCESS;
+}
+
+
+/* What the payload of a message being decoded must be */
+enum sign1_payload_kind {
+    SIGN1_PAYLOAD_ATTACHED,
+    SIGN1_PAYLOAD_DETACHED,
+    /* Attached or detached, for t_cose_sign1_verifier_parse() */
+    SIGN1_PAYLOAD_EITHER
+};
+
+
+/**
+ * \brief Decode a \c COSE_Sign1 and check its header parameters.
+ *
+ * \param[in] me                     The verification configuration.
+ * \param[out] call                  Where the tags go.
+ * \param[in] cose_sign1             The \c COSE_Sign1 to decode.
+ * \param[in] payload_kind           Whether the payload must be detached.
+ * \param[out] parameters            The decoded header parameters.
+ * \param[out] protected_parameters  The encoded protected parameters.
+ * \param[in,out] payload            The payload. It is not touched if
+ *                                   it must be detached. With \ref
+ *                                   SIGN1_PAYLOAD_EITHER it is \c
+ *                                   NULL_Q_USEFUL_BUF_C if detached.
+ * \param[out] signature             The signature.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is everything up to hashing and verifying. Decoding and
+ * structure errors, a required but missing kid, unknown critical
+ * parameters and anything outside the verification policy are all
+ * caught here.
+ */
+static enum t_cose_err_t
+sign1_decode(const struct t_cose_sign1_verifier *me,
+             struct t_cose_sign1_verify_call    *call,
+             struct q_useful_buf_c               cose_sign1,
+             enum sign1_payload_kind             payload_kind,
+             struct t_cose_parameters           *parameters,
+             struct q_useful_buf_c              *protected_parameters,
+             struct q_useful_buf_c              *payload,
+             struct q_useful_buf_c              *signature)
 {
     /* Aproximate stack usage
      *                                             64-bit      32-bit
-     *   local vars                                    80          40
+     *   local vars                                    32          16
      *   Decode context                               312         256
-     *   Hash output                                32-64       32-64
      *   header parameter lists                       244         176
      *   MAX(parse_headers         768     628
      *       process tags           20      16
-     *       check crit             24      12
-     *       create_tbs_hash     32-748  30-746
-     *       crypto lib verify  64-1024 64-1024) 768-1024    768-1024
-     *   TOTAL                                  1724-1436   1560-1272
+     *       check crit             24      12)       768         628
+     *   TOTAL                                       1356        1076
      */
     QCBORDecodeContext            decode_context;
-    struct q_useful_buf_c         protected_parameters;
     enum t_cose_err_t             return_value;
-    struct q_useful_buf_c         signature;
     struct t_cose_label_list      critical_parameter_labels;
     struct t_cose_label_list      unknown_parameter_labels;
-    struct t_cose_parameters      parameters;
-    struct q_useful_buf_c         signed_payload;
     QCBORError                    qcbor_error;
-#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
-    struct q_useful_buf_c         short_circuit_kid;
-#endif
+    struct t_cose_header_cache_entry *cache_entry;
 
     clear_label_list(&unknown_parameter_labels);
     clear_label_list(&critical_parameter_labels);
-    clear_cose_parameters(&parameters);
+    clear_cose_parameters(parameters);
+
+    if(me->policy != NULL && cose_sign1.len > me->policy->max_message_size) {
+        return_value = T_COSE_ERR_POLICY_SIZE;
+        goto Done;
+    }
 
 
     /* === Decoding of the array of four starts here === */
@@ -399,27 +796,47 @@ t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
     if(return_value != T_COSE_SUCCESS) {
         goto Done;
     }
-    return_value = process_tags(me, &decode_context);
+    return_value = process_tags(me, call, &decode_context);
     if(return_value != T_COSE_SUCCESS) {
         goto Done;
     }
 
     /* --- The protected parameters --- */
-    QCBORDecode_EnterBstrWrapped(&decode_context, QCBOR_TAG_REQUIREMENT_NOT_A_TAG, &protected_parameters);
-    if(protected_parameters.len) {
+    QCBORDecode_EnterBstrWrapped(&decode_context, QCBOR_TAG_REQUIREMENT_NOT_A_TAG, protected_parameters);
+    if(me->policy != NULL &&
+       QCBORDecode_GetError(&decode_context) == QCBOR_SUCCESS &&
+       protected_parameters->len > me->policy->max_protected_size) {
+        return_value = T_COSE_ERR_POLICY_SIZE;
+        goto Done;
+    }
+    cache_entry = NULL;
+    if(QCBORDecode_GetError(&decode_context) == QCBOR_SUCCESS) {
+        cache_entry = header_cache_find(call->header_cache, *protected_parameters);
+    }
+    if(cache_entry != NULL) {
+        /* Decoded before. Only ones with nothing critical or unknown
+         * are cached, so the label lists stay clear. */
+        *parameters = cache_entry->parameters;
+        rebase_parameters(parameters, cache_entry->protected_parameters, protected_parameters->ptr);
+    } else if(protected_parameters->len) {
         return_value = parse_cose_header_parameters(&decode_context,
-                                                    &parameters,
+                                                    parameters,
                                                     &critical_parameter_labels,
                                                     &unknown_parameter_labels);
         if(return_value != T_COSE_SUCCESS) {
             goto Done;
         }
+        if(call->header_cache != NULL &&
+           is_label_list_clear(&critical_parameter_labels) &&
+           is_label_list_clear(&unknown_parameter_labels)) {
+            header_cache_add(call->header_cache, *protected_parameters, parameters);
+        }
     }
     QCBORDecode_ExitBstrWrapped(&decode_context);
 
     /* ---  The unprotected parameters --- */
     return_value = parse_cose_header_parameters(&decode_context,
-                                                &parameters,
+                                                parameters,
                                                  NULL,
                                                 &unknown_parameter_labels);
     if(return_value != T_COSE_SUCCESS) {
@@ -427,8 +844,7 @@ t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
     }
 
     /* --- The payload --- */
-    if(is_dc) {
-        signed_payload = *payload;
+    if(payload_kind == SIGN1_PAYLOAD_DETACHED) {
         QCBORItem tmp;
         QCBORDecode_GetNext(&decode_context, &tmp);
         if (tmp.uDataType != QCBOR_TYPE_NULL) {
@@ -438,12 +854,23 @@ t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
         /* In detached content mode, the payload should be set by
          * function caller, so there is no need to set the payload.
          */
+    } else if(payload_kind == SIGN1_PAYLOAD_EITHER) {
+        QCBORItem tmp;
+        QCBORDecode_GetNext(&decode_context, &tmp);
+        if(tmp.uDataType == QCBOR_TYPE_NULL) {
+            *payload = NULL_Q_USEFUL_BUF_C;
+        } else if(tmp.uDataType == QCBOR_TYPE_BYTE_STRING) {
+            *payload = tmp.val.string;
+        } else {
+            return_value = T_COSE_ERR_SIGN1_FORMAT;
+            goto Done;
+        }
     } else {
-        QCBORDecode_GetByteString(&decode_context, &signed_payload);
+        QCBORDecode_GetByteString(&decode_context, payload);
     }
 
     /* --- The signature --- */
-    QCBORDecode_GetByteString(&decode_context, &signature);
+    QCBORDecode_GetByteString(&decode_context, signature);
 
     /* --- Finish up the CBOR decode --- */
     QCBORDecode_ExitArray(&decode_context);
@@ -460,8 +887,17 @@ t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
 
     /* === End of the decoding of the array of four === */
 
+    if(me->policy != NULL) {
+        return_value = check_policy(me->policy,
+                                    parameters,
+                                   *payload,
+                                   *signature);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+    }
 
-    if((me->option_flags & T_COSE_OPT_REQUIRE_KID) && q_useful_buf_c_is_null(parameters.kid)) {
+    if((me->option_flags & T_COSE_OPT_REQUIRE_KID) && q_useful_buf_c_is_null(parameters->kid)) {
         return_value = T_COSE_ERR_NO_KID;
         goto Done;
     }
@@ -474,24 +910,115 @@ t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
         }
     }
 
-#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
-    short_circuit_kid = get_short_circuit_kid();
-    if(!q_useful_buf_compare(parameters.kid, short_circuit_kid)) {
-        return_value = sign1_verify_short_circuit(me, &parameters, signature, protected_parameters, aad, signed_payload);
-        goto Done;
-    }
-#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
-
-#ifndef T_COSE_DISABLE_EDDSA
-    if (parameters.cose_algorithm_id == COSE_ALGORITHM_EDDSA) {
-        return_value = sign1_verify_eddsa(me, &parameters, signature, protected_parameters, aad, signed_payload);
-        goto Done;
-    }
-#endif
+Done:
+    return return_value;
+}
 
-    return_value = sign1_verify_default(me, &parameters, signature, protected_parameters, aad, signed_payload);
 
-Done:
+/**
+ * \brief Verify the signature of a decoded \c COSE_Sign1.
+ *
+ * \param[in] me                   The verification configuration.
+ * \param[in,out] call             The state of this verification.
+ * \param[in] parameters           The decoded parameters from the message.
+ * \param[in] signature            Pointer and length of the message's signature.
+ * \param[in] protected_parameters Full, CBOR encoded, protected parameters.
+ * \param[in] aad                  The Additional Authenticated Data or \c NULL_Q_USEFUL_BUF_C.
+ * \param[in] payload              Pointer and length of the message's payload.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This picks short-circuit, EdDSA or the general procedure from the
+ * kid and algorithm in \c parameters.
+ */
+static enum t_cose_err_t
+sign1_verify_signature(const struct t_cose_sign1_verifier *me,
+                       struct t_cose_sign1_verify_call    *call,
+                       const struct t_cose_parameters     *parameters,
+                       struct q_useful_buf_c               signature,
+                       struct q_useful_buf_c               protected_parameters,
+                       struct q_useful_buf_c               aad,
+                       struct q_useful_buf_c               payload)
+{
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    struct q_useful_buf_c short_circuit_kid;
+
+    short_circuit_kid = get_short_circuit_kid();
+    if(!q_useful_buf_compare(parameters->kid, short_circuit_kid)) {
+        return sign1_verify_short_circuit(me, call, parameters, signature, protected_parameters, aad, payload);
+    }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+#ifndef T_COSE_DISABLE_EDDSA
+    if (parameters->cose_algorithm_id == COSE_ALGORITHM_EDDSA) {
+        return sign1_verify_eddsa(me, call, parameters, signature, protected_parameters, aad, payload);
+    }
+#endif
+
+    return sign1_verify_default(me, call, parameters, signature, protected_parameters, aad, payload);
+}
+
+
+/*
+ * Semi-private function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_internal(const struct t_cose_sign1_verifier *me,
+                                      struct t_cose_sign1_verify_call    *call,
+                                      struct q_useful_buf_c               cose_sign1,
+                                      struct q_useful_buf_c               aad,
+                                      struct q_useful_buf_c              *payload,
+                                      struct t_cose_parameters           *returned_parameters,
+                                      bool                                is_dc)
+{
+    /* Aproximate stack usage
+     *                                             64-bit      32-bit
+     *   local vars                                    80          40
+     *   Hash output                                32-64       32-64
+     *   MAX(sign1_decode             1356    1076
+     *       create_tbs_hash        32-748  30-746
+     *       crypto lib verify     64-1024 64-1024)  1356        1076
+     *   TOTAL                                  1468-1500   1148-1180
+     */
+    struct q_useful_buf_c         protected_parameters;
+    enum t_cose_err_t             return_value;
+    struct q_useful_buf_c         signature;
+    struct t_cose_parameters      parameters;
+    struct q_useful_buf_c         signed_payload;
+    struct t_cose_sign1_verify_call default_call;
+
+    T_COSE_PROBE3(sign1_verify_entry, cose_sign1.len, aad.len, is_dc);
+
+    if(call == NULL) {
+        /* Can only find the size for EdDSA */
+        t_cose_sign1_verify_call_init(&default_call, (struct q_useful_buf){NULL, SIZE_MAX});
+        call = &default_call;
+    }
+
+    if(is_dc) {
+        signed_payload = *payload;
+    }
+    return_value = sign1_decode(me,
+                                call,
+                                cose_sign1,
+                                is_dc ? SIGN1_PAYLOAD_DETACHED : SIGN1_PAYLOAD_ATTACHED,
+                               &parameters,
+                               &protected_parameters,
+                               &signed_payload,
+                               &signature);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    return_value = sign1_verify_signature(me,
+                                          call,
+                                         &parameters,
+                                          signature,
+                                          protected_parameters,
+                                          aad,
+                                          signed_payload);
+
+Done:
     if (return_value == T_COSE_SUCCESS)
     {
         if(returned_parameters != NULL) {
@@ -502,6 +1029,938 @@ Done:
         }
     }
 
+    T_COSE_PROBE2(sign1_verify_return, return_value, parameters.cose_algorithm_id);
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_parse(const struct t_cose_sign1_verifier *me,
+                            struct q_useful_buf_c               cose_sign1,
+                            struct t_cose_sign1_parsed         *parsed)
+{
+    enum t_cose_err_t               return_value;
+    struct t_cose_sign1_verify_call call;
+
+    t_cose_sign1_verify_call_init(&call, NULL_Q_USEFUL_BUF);
+
+    return_value = sign1_decode(me,
+                               &call,
+                                cose_sign1,
+                                SIGN1_PAYLOAD_EITHER,
+                               &parsed->parameters,
+                               &parsed->protected_parameters,
+                               &parsed->payload,
+                               &parsed->signature);
+
+    memcpy(parsed->auTags, call.auTags, sizeof(parsed->auTags));
+
+    return return_value;
+}
+
+
+/**
+ * \brief Pick the payload that was signed for a parsed \c COSE_Sign1.
+ *
+ * \param[in] me                The verification configuration.
+ * \param[in] parsed            The message from t_cose_sign1_parse().
+ * \param[in] detached_payload  The detached payload or \c NULL_Q_USEFUL_BUF_C
+ *                              if it is attached.
+ * \param[out] signed_payload   The payload to verify the signature over.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * The errors are the same as decoding the message for the wrong kind
+ * of payload would give. A detached payload is checked against the
+ * policy here as parsing didn't have it.
+ */
+static enum t_cose_err_t
+parsed_signed_payload(const struct t_cose_sign1_verifier *me,
+                      const struct t_cose_sign1_parsed   *parsed,
+                      struct q_useful_buf_c               detached_payload,
+                      struct q_useful_buf_c              *signed_payload)
+{
+    if(!q_useful_buf_c_is_null(detached_payload)) {
+        if(!q_useful_buf_c_is_null(parsed->payload)) {
+            return T_COSE_ERR_CBOR_FORMATTING;
+        }
+        if(me->policy != NULL && detached_payload.len > me->policy->max_payload_size) {
+            return T_COSE_ERR_POLICY_SIZE;
+        }
+        *signed_payload = detached_payload;
+    } else {
+        if(q_useful_buf_c_is_null(parsed->payload)) {
+            return T_COSE_ERR_SIGN1_FORMAT;
+        }
+        *signed_payload = parsed->payload;
+    }
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * Semi-private function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_parsed_internal(const struct t_cose_sign1_verifier *me,
+                                             struct t_cose_sign1_verify_call    *call,
+                                             const struct t_cose_sign1_parsed   *parsed,
+                                             struct q_useful_buf_c               aad,
+                                             struct q_useful_buf_c               detached_payload)
+{
+    enum t_cose_err_t               return_value;
+    struct q_useful_buf_c           signed_payload;
+    struct t_cose_sign1_verify_call default_call;
+
+    T_COSE_PROBE3(sign1_verify_entry,
+                  parsed->signature.len,
+                  aad.len,
+                  !q_useful_buf_c_is_null(detached_payload));
+
+    if(call == NULL) {
+        /* Can only find the size for EdDSA */
+        t_cose_sign1_verify_call_init(&default_call, (struct q_useful_buf){NULL, SIZE_MAX});
+        call = &default_call;
+    }
+
+    return_value = parsed_signed_payload(me, parsed, detached_payload, &signed_payload);
+    if(return_value) {
+        goto Done;
+    }
+
+    return_value = sign1_verify_signature(me,
+                                          call,
+                                         &parsed->parameters,
+                                          parsed->signature,
+                                          parsed->protected_parameters,
+                                          aad,
+                                          signed_payload);
+
+Done:
+    T_COSE_PROBE2(sign1_verify_return, return_value, parsed->parameters.cose_algorithm_id);
     return return_value;
 }
 
+
+/*
+ * Semi-private function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_any_key_internal(const struct t_cose_sign1_verifier *me,
+                                              struct t_cose_sign1_verify_call    *call,
+                                              const struct t_cose_sign1_parsed   *parsed,
+                                              struct q_useful_buf_c               aad,
+                                              struct q_useful_buf_c               detached_payload,
+                                              const struct t_cose_key            *keys,
+                                              size_t                              num_keys,
+                                              size_t                             *key_index)
+{
+    enum t_cose_err_t               return_value;
+    enum t_cose_err_t               key_result;
+    struct q_useful_buf_c           signed_payload;
+    Q_USEFUL_BUF_MAKE_STACK_UB(buffer_for_tbs_hash, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    /* The TBS hash, or the TBS bytes themselves for EdDSA */
+    struct q_useful_buf_c           tbs;
+    struct t_cose_sign1_verify_call default_call;
+    size_t                          i;
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    struct q_useful_buf_c           short_circuit_kid;
+#endif
+#ifndef T_COSE_DISABLE_EDDSA
+    bool                            is_eddsa;
+#endif
+
+    *key_index = SIZE_MAX;
+
+    T_COSE_PROBE3(sign1_verify_entry,
+                  parsed->signature.len,
+                  aad.len,
+                  !q_useful_buf_c_is_null(detached_payload));
+
+    if(call == NULL) {
+        /* Can only find the size for EdDSA */
+        t_cose_sign1_verify_call_init(&default_call, (struct q_useful_buf){NULL, SIZE_MAX});
+        call = &default_call;
+    }
+
+    return_value = parsed_signed_payload(me, parsed, detached_payload, &signed_payload);
+    if(return_value) {
+        goto Done;
+    }
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    /* There's no key to pick for short-circuit signatures */
+    short_circuit_kid = get_short_circuit_kid();
+    if(!q_useful_buf_compare(parsed->parameters.kid, short_circuit_kid)) {
+        return_value = sign1_verify_short_circuit(me,
+                                                  call,
+                                                 &parsed->parameters,
+                                                  parsed->signature,
+                                                  parsed->protected_parameters,
+                                                  aad,
+                                                  signed_payload);
+        goto Done;
+    }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+    /* -- Compute what is verified once for all the keys -- */
+    /* The algorithm comes from the message, not the keys, so there is
+     * only ever one digest to compute. */
+#ifndef T_COSE_DISABLE_EDDSA
+    is_eddsa = parsed->parameters.cose_algorithm_id == COSE_ALGORITHM_EDDSA;
+    if(is_eddsa) {
+        return_value = sign1_eddsa_tbs(call,
+                                       parsed->protected_parameters,
+                                       aad,
+                                       signed_payload,
+                                      &tbs);
+        if(return_value) {
+            goto Done;
+        }
+    }
+#endif /* T_COSE_DISABLE_EDDSA */
+
+    if(me->option_flags & T_COSE_OPT_DECODE_ONLY) {
+        return_value = T_COSE_SUCCESS;
+        goto Done;
+    }
+
+#ifndef T_COSE_DISABLE_EDDSA
+    if(is_eddsa) {
+        if(call->auxiliary_buffer.ptr == NULL) {
+            return_value = T_COSE_ERR_NEED_AUXILIARY_BUFFER;
+            goto Done;
+        }
+    } else
+#endif /* T_COSE_DISABLE_EDDSA */
+    {
+        return_value = sign1_tbs_hash(call,
+                                      parsed->parameters.cose_algorithm_id,
+                                      parsed->protected_parameters,
+                                      aad,
+                                      signed_payload,
+                                      buffer_for_tbs_hash,
+                                     &tbs);
+        if(return_value) {
+            goto Done;
+        }
+    }
+
+    /* -- Try each key until one verifies -- */
+    /* A key of the wrong type or size for the algorithm is just
+     * another key that didn't verify. Anything else, like running out
+     * of memory, stops the search. */
+    return_value = T_COSE_ERR_SIG_VERIFY;
+    for(i = 0; i < num_keys; i++) {
+#ifndef T_COSE_DISABLE_EDDSA
+        if(is_eddsa) {
+            key_result = sign1_verify_eddsa_tbs(keys[i], &parsed->parameters, tbs, parsed->signature);
+        } else
+#endif /* T_COSE_DISABLE_EDDSA */
+        {
+            key_result = sign1_verify_tbs_hash(keys[i], &parsed->parameters, tbs, parsed->signature);
+        }
+
+        if(key_result == T_COSE_SUCCESS) {
+            *key_index   = i;
+            return_value = T_COSE_SUCCESS;
+            break;
+        }
+        if(key_result != T_COSE_ERR_SIG_VERIFY &&
+           key_result != T_COSE_ERR_SIG_FAIL &&
+           key_result != T_COSE_ERR_WRONG_TYPE_OF_KEY) {
+            return_value = key_result;
+            break;
+        }
+    }
+
+Done:
+    T_COSE_PROBE2(sign1_verify_return, return_value, parsed->parameters.cose_algorithm_id);
+    return return_value;
+}
+
+
+/*
+ * Semi-private function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_internal(struct t_cose_sign1_verify_ctx *me,
+                             struct q_useful_buf_c           cose_sign1,
+                             struct q_useful_buf_c           aad,
+                             struct q_useful_buf_c          *payload,
+                             struct t_cose_parameters       *returned_parameters,
+                             bool                            is_dc)
+{
+    return t_cose_sign1_verifier_verify_internal(&me->verifier,
+                                                 &me->call,
+                                                 cose_sign1,
+                                                 aad,
+                                                 payload,
+                                                 returned_parameters,
+                                                 is_dc);
+}
+
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_batch(const struct t_cose_sign1_verifier    *me,
+                                   struct t_cose_sign1_verify_call       *call,
+                                   struct t_cose_sign1_verify_batch_item *items,
+                                   size_t                                 num_items)
+{
+    /* Aproximate stack usage
+     *                                             64-bit      32-bit
+     *   local vars                                    96          48
+     *   protected parameters and signatures    32 * group  16 * group
+     *   TBS hash items                         80 * group  40 * group
+     *   hash buffers                           64 * group  64 * group
+     *   flags and index list                   10 * group   6 * group
+     *   MAX(sign1_decode                  1356       1076
+     *       create_tbs_hash_batch    3560-5896  2284-4620
+     *       crypto lib verify          64-1024    64-1024) 3560-5896  2284-4620
+     *   TOTAL (group of 16)                   6600-8900   4400-6800
+     */
+    struct q_useful_buf_c        protected_parameters[T_COSE_BATCH_GROUP_SIZE];
+    struct q_useful_buf_c        signature[T_COSE_BATCH_GROUP_SIZE];
+    /* Needs a TBS hash, it hasn't been computed yet */
+    bool                         needs_hash[T_COSE_BATCH_GROUP_SIZE];
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    bool                         is_short_circuit[T_COSE_BATCH_GROUP_SIZE];
+    struct q_useful_buf_c        short_circuit_kid;
+#endif
+    struct t_cose_tbs_hash_item  tbs[T_COSE_BATCH_GROUP_SIZE];
+    uint8_t                      hash_buffers[T_COSE_BATCH_GROUP_SIZE][T_COSE_CRYPTO_MAX_HASH_SIZE];
+    size_t                       tbs_item[T_COSE_BATCH_GROUP_SIZE];
+    struct t_cose_sign1_verify_batch_item *item;
+    enum t_cose_err_t            return_value;
+    enum t_cose_err_t            hash_result;
+    int32_t                      cose_algorithm_id;
+    size_t                       group;
+    size_t                       num_pending;
+    size_t                       num_tbs;
+    size_t                       i;
+    size_t                       j;
+    struct t_cose_sign1_verify_call default_call;
+
+    T_COSE_PROBE1(sign1_verify_batch_entry, num_items);
+
+    if(call == NULL) {
+        t_cose_sign1_verify_call_init(&default_call, (struct q_useful_buf){NULL, SIZE_MAX});
+        call = &default_call;
+    }
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+    short_circuit_kid = get_short_circuit_kid();
+#endif
+
+    return_value = T_COSE_SUCCESS;
+    for(; num_items > 0; num_items -= group, items += group) {
+        group = num_items < T_COSE_BATCH_GROUP_SIZE ? num_items : T_COSE_BATCH_GROUP_SIZE;
+
+        /* -- Decode each and sort out which need a TBS hash -- */
+        num_pending = 0;
+        for(i = 0; i < group; i++) {
+            item = &items[i];
+            needs_hash[i] = false;
+            item->err = sign1_decode(me,
+                                     call,
+                                     item->cose_sign1,
+                                     SIGN1_PAYLOAD_ATTACHED,
+                                    &item->parameters,
+                                    &protected_parameters[i],
+                                    &item->payload,
+                                    &signature[i]);
+            if(item->err) {
+                continue;
+            }
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+            is_short_circuit[i] = !q_useful_buf_compare(item->parameters.kid, short_circuit_kid);
+            if(is_short_circuit[i]) {
+                if(me->option_flags & T_COSE_OPT_DECODE_ONLY) {
+                    continue;
+                }
+                if(!(me->option_flags & T_COSE_OPT_ALLOW_SHORT_CIRCUIT)) {
+                    item->err = T_COSE_ERR_SHORT_CIRCUIT_SIG;
+                    continue;
+                }
+            } else
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+#ifndef T_COSE_DISABLE_EDDSA
+            if(item->parameters.cose_algorithm_id == COSE_ALGORITHM_EDDSA) {
+                /* No hash to batch */
+                item->err = sign1_verify_eddsa(me,
+                                               call,
+                                              &item->parameters,
+                                               signature[i],
+                                               protected_parameters[i],
+                                               item->aad,
+                                               item->payload);
+                continue;
+            } else
+#endif /* T_COSE_DISABLE_EDDSA */
+            if(me->option_flags & T_COSE_OPT_DECODE_ONLY) {
+                continue;
+            }
+
+            needs_hash[i] = true;
+            num_pending++;
+        }
+
+        /* -- Hash the TBS bytes, a batch per algorithm -- */
+        while(num_pending > 0) {
+            cose_algorithm_id = T_COSE_INVALID_ALGORITHM_ID;
+            num_tbs = 0;
+            for(i = 0; i < group; i++) {
+                if(!needs_hash[i]) {
+                    continue;
+                }
+                if(num_tbs == 0) {
+                    cose_algorithm_id = items[i].parameters.cose_algorithm_id;
+                } else if(items[i].parameters.cose_algorithm_id != cose_algorithm_id) {
+                    continue;
+                }
+                needs_hash[i] = false;
+                tbs[num_tbs].protected_parameters = protected_parameters[i];
+                tbs[num_tbs].aad                  = items[i].aad;
+                tbs[num_tbs].payload              = items[i].payload;
+                tbs[num_tbs].buffer_for_hash      = (struct q_useful_buf){hash_buffers[num_tbs],
+                                                                           sizeof(hash_buffers[num_tbs])};
+                tbs_item[num_tbs] = i;
+                num_tbs++;
+            }
+            num_pending -= num_tbs;
+
+            hash_result = create_tbs_hash_batch(cose_algorithm_id, tbs, num_tbs);
+
+            /* -- Verify each signature against its hash -- */
+            for(j = 0; j < num_tbs; j++) {
+                item = &items[tbs_item[j]];
+                if(hash_result) {
+                    item->err = hash_result;
+                    continue;
+                }
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+                if(is_short_circuit[tbs_item[j]]) {
+                    item->err = t_cose_crypto_short_circuit_verify(tbs[j].hash,
+                                                                   signature[tbs_item[j]]);
+                    continue;
+                }
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+                item->err = sign1_verify_tbs_hash(me->verification_key,
+                                                 &item->parameters,
+                                                  tbs[j].hash,
+                                                  signature[tbs_item[j]]);
+            }
+        }
+
+        /* -- Outputs are only for the ones that verified -- */
+        for(i = 0; i < group; i++) {
+            if(items[i].err) {
+                items[i].payload = NULL_Q_USEFUL_BUF_C;
+                clear_cose_parameters(&items[i].parameters);
+                if(!return_value) {
+                    return_value = items[i].err;
+                }
+            }
+        }
+    }
+
+    T_COSE_PROBE1(sign1_verify_batch_return, return_value);
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_batch(struct t_cose_sign1_verify_ctx        *me,
+                          struct t_cose_sign1_verify_batch_item *items,
+                          size_t                                 num_items)
+{
+    return t_cose_sign1_verifier_verify_batch(&me->verifier, &me->call, items, num_items);
+}
+
+
+/**
+ * \brief Look up a signed Merkle root in a receipt cache.
+ *
+ * \param[in] me           The verification configuration.
+ * \param[in] cache        The cache or \c NULL.
+ * \param[in] signed_root  The \c COSE_Sign1 of the root.
+ *
+ * \return \c true if \c signed_root was verified with the same
+ *         configuration as \c me and is in \c cache.
+ */
+static bool
+receipt_cache_hit(const struct t_cose_sign1_verifier *me,
+                  const struct t_cose_receipt_cache  *cache,
+                  struct q_useful_buf_c               signed_root)
+{
+    return cache != NULL &&
+           cache->signed_root_len == signed_root.len &&
+           cache->verification_key.crypto_lib == me->verification_key.crypto_lib &&
+           cache->verification_key.k.key_handle == me->verification_key.k.key_handle &&
+           cache->option_flags == me->option_flags &&
+           cache->policy == me->policy &&
+           !memcmp(cache->signed_root, signed_root.ptr, signed_root.len);
+}
+
+
+/**
+ * \brief Put a verified signed Merkle root in a receipt cache.
+ *
+ * \param[in] me           The verification configuration.
+ * \param[in,out] cache    The cache or \c NULL.
+ * \param[in] signed_root  The verified \c COSE_Sign1 of the root.
+ * \param[in] parameters   Its parameters.
+ * \param[in] root         Its payload, the root.
+ *
+ * Signed roots too big for the cache are not cached.
+ */
+static void
+receipt_cache_add(const struct t_cose_sign1_verifier *me,
+                  struct t_cose_receipt_cache        *cache,
+                  struct q_useful_buf_c               signed_root,
+                  const struct t_cose_parameters     *parameters,
+                  struct q_useful_buf_c               root)
+{
+    if(cache == NULL || signed_root.len > sizeof(cache->signed_root)) {
+        return;
+    }
+
+    memcpy(cache->signed_root, signed_root.ptr, signed_root.len);
+    cache->signed_root_len  = signed_root.len;
+    cache->verification_key = me->verification_key;
+    cache->option_flags     = me->option_flags;
+    cache->policy           = me->policy;
+    cache->parameters       = *parameters;
+    rebase_parameters(&cache->parameters, signed_root.ptr, cache->signed_root);
+    cache->root.ptr = cache->signed_root + ((const uint8_t *)root.ptr - (const uint8_t *)signed_root.ptr);
+    cache->root.len = root.len;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_receipt(const struct t_cose_sign1_verifier *me,
+                                     struct t_cose_sign1_verify_call    *call,
+                                     struct q_useful_buf_c               receipt,
+                                     struct q_useful_buf_c               payload,
+                                     struct t_cose_parameters           *returned_parameters)
+{
+    QCBORDecodeContext           decode_context;
+    QCBORItem                    path_array;
+    enum t_cose_err_t            return_value;
+    struct t_cose_receipt_cache *cache;
+    struct q_useful_buf_c        signed_root;
+    struct q_useful_buf_c        root;
+    struct q_useful_buf_c        node;
+    struct q_useful_buf_c        sibling;
+    struct t_cose_parameters     parameters;
+    uint64_t                     leaf_index;
+    uint64_t                     tree_size;
+    uint64_t                     fn;
+    uint64_t                     sn;
+    int32_t                      hash_alg_id;
+    uint16_t                     i;
+    bool                         decode_only;
+    /* Each hash up the path goes in the one the last didn't */
+    uint8_t                      node_buffers[2][T_COSE_CRYPTO_MAX_HASH_SIZE];
+
+    cache       = call != NULL ? call->receipt_cache : NULL;
+    decode_only = me->option_flags & T_COSE_OPT_DECODE_ONLY;
+
+    /* --- Decode everything but the path --- */
+    QCBORDecode_Init(&decode_context, receipt, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterArray(&decode_context, NULL);
+    QCBORDecode_GetByteString(&decode_context, &signed_root);
+    QCBORDecode_GetUInt64(&decode_context, &leaf_index);
+    QCBORDecode_GetUInt64(&decode_context, &tree_size);
+    QCBORDecode_EnterArray(&decode_context, &path_array);
+    if(QCBORDecode_GetError(&decode_context) != QCBOR_SUCCESS ||
+       path_array.val.uCount == UINT16_MAX ||
+       leaf_index >= tree_size) {
+        /* Indefinite-length paths aren't allowed */
+        return_value = T_COSE_ERR_RECEIPT_FORMAT;
+        goto Done;
+    }
+
+    /* --- Get the root, from the cache or by verifying it --- */
+    if(!decode_only && receipt_cache_hit(me, cache, signed_root)) {
+        parameters = cache->parameters;
+        root       = cache->root;
+    } else {
+        return_value = t_cose_sign1_verifier_verify_internal(me,
+                                                             call,
+                                                             signed_root,
+                                                             NULL_Q_USEFUL_BUF_C,
+                                                            &root,
+                                                            &parameters,
+                                                             false);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+        if(!decode_only) {
+            receipt_cache_add(me, cache, signed_root, &parameters, root);
+        }
+    }
+
+    /* --- Hash up the path as in RFC 9162 section 2.1.3.2 --- */
+    hash_alg_id = merkle_hash_alg_id(parameters.cose_algorithm_id);
+    if(!decode_only) {
+        return_value = merkle_leaf_hash(hash_alg_id,
+                                        payload,
+                                        Q_USEFUL_BUF_FROM_BYTE_ARRAY(node_buffers[0]),
+                                       &node);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+    }
+
+    fn = leaf_index;
+    sn = tree_size - 1;
+    for(i = 0; i < path_array.val.uCount; i++) {
+        QCBORDecode_GetByteString(&decode_context, &sibling);
+        if(QCBORDecode_GetError(&decode_context) != QCBOR_SUCCESS || sn == 0) {
+            return_value = T_COSE_ERR_RECEIPT_FORMAT;
+            goto Done;
+        }
+        if(decode_only) {
+            /* Only the shape of the path is checked */
+        } else if(sibling.len != node.len) {
+            return_value = T_COSE_ERR_RECEIPT_FORMAT;
+            goto Done;
+        } else if((fn & 1) || fn == sn) {
+            return_value = merkle_node_hash(hash_alg_id,
+                                            sibling,
+                                            node,
+                                            Q_USEFUL_BUF_FROM_BYTE_ARRAY(node_buffers[(i + 1) % 2]),
+                                           &node);
+        } else {
+            return_value = merkle_node_hash(hash_alg_id,
+                                            node,
+                                            sibling,
+                                            Q_USEFUL_BUF_FROM_BYTE_ARRAY(node_buffers[(i + 1) % 2]),
+                                           &node);
+        }
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+
+        if(!(fn & 1) && fn == sn) {
+            /* A last node with no sibling moved up unchanged */
+            while(fn != 0 && !(fn & 1)) {
+                fn >>= 1;
+                sn >>= 1;
+            }
+        }
+        fn >>= 1;
+        sn >>= 1;
+    }
+    QCBORDecode_ExitArray(&decode_context);
+    QCBORDecode_ExitArray(&decode_context);
+    if(QCBORDecode_Finish(&decode_context) != QCBOR_SUCCESS || sn != 0) {
+        return_value = T_COSE_ERR_RECEIPT_FORMAT;
+        goto Done;
+    }
+
+    if(!decode_only && q_useful_buf_compare(node, root)) {
+        return_value = T_COSE_ERR_SIG_VERIFY;
+        goto Done;
+    }
+
+    if(returned_parameters != NULL) {
+        *returned_parameters = parameters;
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_receipt(struct t_cose_sign1_verify_ctx *me,
+                            struct q_useful_buf_c           receipt,
+                            struct q_useful_buf_c           payload,
+                            struct t_cose_parameters       *parameters)
+{
+    return t_cose_sign1_verifier_verify_receipt(&me->verifier,
+                                                &me->call,
+                                                receipt,
+                                                payload,
+                                                parameters);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_hash_envelope(const struct t_cose_sign1_verifier *me,
+                                           struct t_cose_sign1_verify_call    *call,
+                                           struct q_useful_buf_c               sign1,
+                                           int32_t                             payload_hash_alg,
+                                           struct q_useful_buf_c               payload_hash,
+                                           struct t_cose_parameters           *returned_parameters)
+{
+    enum t_cose_err_t        return_value;
+    struct q_useful_buf_c    signed_hash;
+    struct t_cose_parameters parameters;
+
+    return_value = t_cose_sign1_verifier_verify_internal(me,
+                                                         call,
+                                                         sign1,
+                                                         NULL_Q_USEFUL_BUF_C,
+                                                        &signed_hash,
+                                                        &parameters,
+                                                         false);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    if(parameters.payload_hash_alg == T_COSE_UNSET_ALGORITHM_ID ||
+       parameters.payload_hash_alg != payload_hash_alg) {
+        return_value = T_COSE_ERR_PAYLOAD_HASH_ALG;
+        goto Done;
+    }
+
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    if(parameters.content_type_uint != T_COSE_EMPTY_UINT_CONTENT_TYPE ||
+       !q_useful_buf_c_is_null(parameters.content_type_tstr)) {
+        /* Only the preimage content type is allowed */
+        return_value = T_COSE_ERR_BAD_CONTENT_TYPE;
+        goto Done;
+    }
+#endif
+
+    /* The signature covers the hash, so a different hash is a
+     * different payload */
+    if(q_useful_buf_compare(signed_hash, payload_hash)) {
+        return_value = T_COSE_ERR_SIG_VERIFY;
+        goto Done;
+    }
+
+    if(returned_parameters != NULL) {
+        *returned_parameters = parameters;
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_hash_envelope(struct t_cose_sign1_verify_ctx *me,
+                                  struct q_useful_buf_c           sign1,
+                                  int32_t                         payload_hash_alg,
+                                  struct q_useful_buf_c           payload_hash,
+                                  struct t_cose_parameters       *parameters)
+{
+    return t_cose_sign1_verifier_verify_hash_envelope(&me->verifier,
+                                                      &me->call,
+                                                      sign1,
+                                                      payload_hash_alg,
+                                                      payload_hash,
+                                                      parameters);
+}
+
+
+/**
+ * \brief Check a verified CWT hasn't been seen before and remember it.
+ *
+ * \param[in] validation  The validation with the replay cache.
+ * \param[in] claims      The CWT's standard claims.
+ * \param[in] payload     The CWT's claims map.
+ *
+ * A CWT is remembered by its \c cti or, without one, its whole
+ * payload until \c exp plus the leeway. One without \c exp would have
+ * to be remembered forever so it is rejected.
+ */
+static enum t_cose_err_t
+check_replay(const struct t_cose_cwt_validation *validation,
+             const struct t_cose_cwt_claims     *claims,
+             struct q_useful_buf_c               payload)
+{
+    int64_t expires;
+    int64_t now;
+
+    if(!(claims->present & (1U << T_COSE_CWT_CLAIM_EXP))) {
+        return T_COSE_ERR_CWT_MISSING_EXP;
+    }
+    expires = claims->exp > INT64_MAX - (int64_t)validation->leeway ?
+                  INT64_MAX : claims->exp + (int64_t)validation->leeway;
+    now = validation->clock != NULL ? validation->clock(validation->clock_ctx) : (int64_t)time(NULL);
+
+    return t_cose_replay_cache_check(validation->replay_cache,
+                                     q_useful_buf_c_is_null(claims->cti) ? payload : claims->cti,
+                                     expires,
+                                     now);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_cwt(const struct t_cose_sign1_verifier *me,
+                                 struct t_cose_sign1_verify_call    *call,
+                                 struct q_useful_buf_c               cwt,
+                                 const struct t_cose_cwt_validation *validation,
+                                 struct t_cose_cwt_claims           *returned_claims,
+                                 struct t_cose_parameters           *returned_parameters)
+{
+    enum t_cose_err_t               return_value;
+    struct q_useful_buf_c           protected_parameters;
+    struct q_useful_buf_c           signature;
+    struct q_useful_buf_c           payload;
+    struct t_cose_parameters        parameters;
+    struct t_cose_cwt_claims        claims;
+    bool                            checked_claims;
+    struct t_cose_sign1_verify_call default_call;
+
+    T_COSE_PROBE3(sign1_verify_entry, cwt.len, 0, false);
+
+    /* Without a real signature check anyone could fill the replay
+     * cache with the cti of genuine tokens to come */
+    if(validation->replay_cache != NULL &&
+       (me->option_flags & (T_COSE_OPT_DECODE_ONLY | T_COSE_OPT_ALLOW_SHORT_CIRCUIT))) {
+        return_value = T_COSE_ERR_INVALID_ARGUMENT;
+        parameters.cose_algorithm_id = T_COSE_INVALID_ALGORITHM_ID;
+        goto Done;
+    }
+
+    if(call == NULL) {
+        /* Can only find the size for EdDSA */
+        t_cose_sign1_verify_call_init(&default_call, (struct q_useful_buf){NULL, SIZE_MAX});
+        call = &default_call;
+    }
+
+    return_value = sign1_decode(me,
+                                call,
+                                cwt,
+                                SIGN1_PAYLOAD_ATTACHED,
+                               &parameters,
+                               &protected_parameters,
+                               &payload,
+                               &signature);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    /* Checking first turns away expired floods without hashing or
+     * a public key operation */
+    checked_claims = false;
+    if(validation->option_flags & T_COSE_CWT_CHECK_BEFORE_SIGNATURE) {
+        return_value = t_cose_cwt_validate(validation, payload, &claims);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+        checked_claims = true;
+    }
+
+    return_value = sign1_verify_signature(me,
+                                          call,
+                                         &parameters,
+                                          signature,
+                                          protected_parameters,
+                                          NULL_Q_USEFUL_BUF_C,
+                                          payload);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    if(!checked_claims) {
+        return_value = t_cose_cwt_validate(validation, payload, &claims);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+    }
+
+    /* Last, so only a CWT whose signature has been verified and
+     * that is otherwise accepted is remembered */
+    if(validation->replay_cache != NULL) {
+        return_value = check_replay(validation, &claims, payload);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+    }
+
+    if(returned_claims != NULL) {
+        *returned_claims = claims;
+    }
+    if(returned_parameters != NULL) {
+        *returned_parameters = parameters;
+    }
+
+Done:
+    T_COSE_PROBE2(sign1_verify_return, return_value, parameters.cose_algorithm_id);
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_cwt(struct t_cose_sign1_verify_ctx     *me,
+                        struct q_useful_buf_c               cwt,
+                        const struct t_cose_cwt_validation *validation,
+                        struct t_cose_cwt_claims           *claims,
+                        struct t_cose_parameters           *parameters)
+{
+    return t_cose_sign1_verifier_verify_cwt(&me->verifier,
+                                            &me->call,
+                                            cwt,
+                                            validation,
+                                            claims,
+                                            parameters);
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+void
+t_cose_header_cache_init(struct t_cose_header_cache       *me,
+                         struct t_cose_header_cache_entry *entries,
+                         size_t                            num_entries)
+{
+    me->entries     = entries;
+    me->num_entries = num_entries;
+    me->clock       = 0;
+    memset(entries, 0, num_entries * sizeof(*entries));
+}
+
+
+/*
+ * Public function. See t_cose_sign1_verify.h
+ */
+void
+t_cose_header_cache_clear(struct t_cose_header_cache *me)
+{
+    size_t i;
+
+    for(i = 0; i < me->num_entries; i++) {
+        if(me->entries[i].has_hash) {
+            t_cose_crypto_hash_abort(header_cache_hash_ctx(&me->entries[i]));
+        }
+    }
+    t_cose_header_cache_init(me, me->entries, me->num_entries);
+}
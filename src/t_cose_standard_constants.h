@@ -125,6 +125,55 @@
 #define COSE_HEADER_PARAM_COUNTER_SIGNATURE 6
 
 
+/**
+ * \def COSE_HEADER_PARAM_X5CHAIN
+ *
+ * \brief Label of COSE parameter with an X.509 certificate chain.
+ *
+ * Either one DER certificate as a byte string or an array of them,
+ * the certificate of the signing key first and each following one
+ * the issuer of the one before. See RFC 9360.
+ */
+#define COSE_HEADER_PARAM_X5CHAIN 33
+
+
+/**
+ * \def COSE_HEADER_PARAM_X5T
+ *
+ * \brief Label of COSE parameter with the thumbprint of the
+ * certificate of the signing key.
+ *
+ * An array of a COSE hash algorithm and the hash of the DER
+ * certificate. See RFC 9360.
+ */
+#define COSE_HEADER_PARAM_X5T 34
+
+
+/**
+ * \def COSE_HEADER_PARAM_PAYLOAD_HASH_ALG
+ *
+ * \brief Label of COSE parameter with the hash algorithm of a hash
+ * envelope.
+ *
+ * The payload is the hash of the real payload, the preimage, made
+ * with this COSE hash algorithm. It must be protected. See
+ * draft-ietf-cose-hash-envelope.
+ */
+#define COSE_HEADER_PARAM_PAYLOAD_HASH_ALG 258
+
+
+/**
+ * \def COSE_HEADER_PARAM_PREIMAGE_CONTENT_TYPE
+ *
+ * \brief Label of COSE parameter with the content type of the
+ * preimage of a hash envelope.
+ *
+ * Either an integer CoAP content type or a string MIME type. A hash
+ * envelope has this instead of \ref COSE_HEADER_PARAM_CONTENT_TYPE.
+ */
+#define COSE_HEADER_PARAM_PREIMAGE_CONTENT_TYPE 259
+
+
 
 
 
@@ -241,7 +290,7 @@
  *
  * \brief Indicates simple SHA-256 hash.
  *
- * This is not used in the t_cose interface, just used internally.
+ * The public definition is \ref T_COSE_ALGORITHM_SHA_256.
  */
 #define COSE_ALGORITHM_SHA_256 -16
 
@@ -250,7 +299,7 @@
  *
  * \brief Indicates simple SHA-384 hash.
  *
- * This is not used in the t_cose interface, just used internally.
+ * The public definition is \ref T_COSE_ALGORITHM_SHA_384.
  */
 #define COSE_ALGORITHM_SHA_384 -43
 
@@ -259,7 +308,7 @@
  *
  * \brief Indicates simple SHA-512 hash.
  *
- * This is not used in the t_cose interface, just used internally.
+ * The public definition is \ref T_COSE_ALGORITHM_SHA_512.
  */
 #define COSE_ALGORITHM_SHA_512 -44
 
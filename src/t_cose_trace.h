@@ -0,0 +1,56 @@
+/*
+ *  t_cose_trace.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef __T_COSE_TRACE_H__
+#define __T_COSE_TRACE_H__
+
+/**
+ * \file t_cose_trace.h
+ *
+ * \brief Optional USDT static tracepoints for the sign/verify paths.
+ *
+ * When \c T_COSE_ENABLE_USDT is defined, the probes below compile to
+ * SystemTap-style USDT probes via <sys/sdt.h> under the provider name
+ * \c t_cose. Each probe is a single \c nop in the instruction stream
+ * plus a note in the \c .note.stapsdt ELF section, so they cost next
+ * to nothing unless a tracer such as bpftrace or perf attaches to
+ * them. When \c T_COSE_ENABLE_USDT is not defined, they compile to
+ * nothing at all.
+ *
+ * Probes come in \c _entry / \c _return pairs so tracers can compute
+ * latency. Arguments are limited to integers (algorithm IDs, lengths
+ * and \ref t_cose_err_t result codes) so nothing sensitive like key
+ * material or payload bytes is exposed. The full list of probes and
+ * their arguments is in examples/bpftrace/README.md.
+ */
+
+#ifdef T_COSE_ENABLE_USDT
+
+#include <sys/sdt.h>
+
+#define T_COSE_PROBE0(name) \
+    DTRACE_PROBE(t_cose, name)
+#define T_COSE_PROBE1(name, a1) \
+    DTRACE_PROBE1(t_cose, name, a1)
+#define T_COSE_PROBE2(name, a1, a2) \
+    DTRACE_PROBE2(t_cose, name, a1, a2)
+#define T_COSE_PROBE3(name, a1, a2, a3) \
+    DTRACE_PROBE3(t_cose, name, a1, a2, a3)
+
+#else /* T_COSE_ENABLE_USDT */
+
+#define T_COSE_PROBE0(name)
+#define T_COSE_PROBE1(name, a1)
+#define T_COSE_PROBE2(name, a1, a2)
+#define T_COSE_PROBE3(name, a1, a2, a3)
+
+#endif /* T_COSE_ENABLE_USDT */
+
+#endif /* __T_COSE_TRACE_H__ */
@@ -13,6 +13,7 @@
 #include "t_cose_util.h"
 #include "t_cose_standard_constants.h"
 #include "t_cose_crypto.h"
+#include "t_cose_trace.h"
 
 
 /**
@@ -62,6 +63,26 @@ t_cose_is_algorithm_supported(int32_t cose_algorithm_id)
     return t_cose_crypto_is_algorithm_supported(cose_algorithm_id);
 }
 
+
+/*
+ * Public function. See t_cose_common.h
+ */
+enum t_cose_err_t
+t_cose_warmup(void *crypto_context)
+{
+    return t_cose_crypto_warmup(crypto_context);
+}
+
+
+/*
+ * Public function. See t_cose_common.h
+ */
+enum t_cose_err_t
+t_cose_set_thread_key_replicas(bool enable)
+{
+    return t_cose_crypto_set_thread_key_replicas(enable);
+}
+
 /*
  * Public function. See t_cose_util.h
  */
@@ -105,6 +126,10 @@ create_tbs(struct q_useful_buf_c  protected_parameters,
            struct q_useful_buf_c *tbs)
 {
     QCBOREncodeContext  cbor_context;
+    enum t_cose_err_t   return_value;
+
+    T_COSE_PROBE3(tbs_entry, protected_parameters.len, aad.len, payload.len);
+
     QCBOREncode_Init(&cbor_context, buffer_for_tbs);
 
     QCBOREncode_OpenArray(&cbor_context);
@@ -116,12 +141,17 @@ create_tbs(struct q_useful_buf_c  protected_parameters,
 
     QCBORError cbor_err = QCBOREncode_Finish(&cbor_context, tbs);
     if (cbor_err == QCBOR_ERR_BUFFER_TOO_SMALL) {
-        return T_COSE_ERR_TOO_SMALL;
+        return_value = T_COSE_ERR_TOO_SMALL;
     } else if (cbor_err != QCBOR_SUCCESS) {
-        return T_COSE_ERR_CBOR_FORMATTING;
+        return_value = T_COSE_ERR_CBOR_FORMATTING;
     } else {
-        return T_COSE_SUCCESS;
+        return_value = T_COSE_SUCCESS;
     }
+
+    T_COSE_PROBE2(tbs_return,
+                  return_value,
+                  return_value == T_COSE_SUCCESS ? tbs->len : 0);
+    return return_value;
 }
 
 /**
@@ -155,7 +185,9 @@ static void hash_bstr(struct t_cose_crypto_hash *hash_ctx,
 
     /* An encoded bstr is the CBOR head with its length followed by the bytes */
     t_cose_crypto_hash_update(hash_ctx, encoded_head);
+    T_COSE_PROBE1(crypto_hash_update_entry, bstr.len);
     t_cose_crypto_hash_update(hash_ctx, bstr);
+    T_COSE_PROBE0(crypto_hash_update_return);
 }
 
 
@@ -179,22 +211,11 @@ static void hash_bstr(struct t_cose_crypto_hash *hash_ctx,
  * COSE_Sign1 structure. This is a little hard to to understand in the
  * spec.
  */
-enum t_cose_err_t create_tbs_hash(int32_t                cose_algorithm_id,
-                                  struct q_useful_buf_c  protected_parameters,
-                                  struct q_useful_buf_c  aad,
-                                  struct q_useful_buf_c  payload,
-                                  struct q_useful_buf    buffer_for_hash,
-                                  struct q_useful_buf_c *hash)
+enum t_cose_err_t start_tbs_hash(int32_t                    cose_algorithm_id,
+                                 struct q_useful_buf_c      protected_parameters,
+                                 struct t_cose_crypto_hash *hash_ctx)
 {
-    /* Aproximate stack usage
-     *                                             64-bit      32-bit
-     *   local vars                                     8           6
-     *   hash_ctx                                   8-224       8-224
-     *   hash function (a guess! variable!)        16-512      16-512
-     *   TOTAL                                     32-748      30-746
-     */
     enum t_cose_err_t           return_value;
-    struct t_cose_crypto_hash   hash_ctx;
     int32_t                     hash_alg_id;
 
     /* Start the hashing */
@@ -207,7 +228,9 @@ enum t_cose_err_t create_tbs_hash(int32_t                cose_algorithm_id,
     /* Don't check hash_alg_id for failure. t_cose_crypto_hash_start()
      * will handle error properly. It was also checked earlier.
      */
-    return_value = t_cose_crypto_hash_start(&hash_ctx, hash_alg_id);
+    T_COSE_PROBE1(crypto_hash_start_entry, hash_alg_id);
+    return_value = t_cose_crypto_hash_start(hash_ctx, hash_alg_id);
+    T_COSE_PROBE2(crypto_hash_start_return, return_value, hash_alg_id);
     if(return_value) {
         goto Done;
     }
@@ -239,21 +262,319 @@ enum t_cose_err_t create_tbs_hash(int32_t                cose_algorithm_id,
 
     /* Hand-constructed CBOR for the array of 4 and the context string.
      * \x84 is an array of 4. \x6A is a text string of 10 bytes. */
-    t_cose_crypto_hash_update(&hash_ctx, Q_USEFUL_BUF_FROM_SZ_LITERAL("\x84\x6A" COSE_SIG_CONTEXT_STRING_SIGNATURE1));
+    t_cose_crypto_hash_update(hash_ctx, Q_USEFUL_BUF_FROM_SZ_LITERAL("\x84\x6A" COSE_SIG_CONTEXT_STRING_SIGNATURE1));
 
     /* body_protected */
-    hash_bstr(&hash_ctx, protected_parameters);
+    hash_bstr(hash_ctx, protected_parameters);
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_util.h
+ */
+enum t_cose_err_t finish_tbs_hash(int32_t                    cose_algorithm_id,
+                                  struct t_cose_crypto_hash *hash_ctx,
+                                  struct q_useful_buf_c      aad,
+                                  struct q_useful_buf_c      payload,
+                                  struct q_useful_buf        buffer_for_hash,
+                                  struct q_useful_buf_c     *hash)
+{
+    enum t_cose_err_t           return_value;
+    int32_t                     hash_alg_id;
+
+    hash_alg_id = hash_alg_id_from_sig_alg_id(cose_algorithm_id);
+    (void)hash_alg_id; /* Only used by the probes */
 
     /* external_aad */
-    hash_bstr(&hash_ctx, aad);
+    hash_bstr(hash_ctx, aad);
 
     /* payload */
-    hash_bstr(&hash_ctx, payload);
+    hash_bstr(hash_ctx, payload);
 
     /* Finish the hash and set up to return it */
-    return_value = t_cose_crypto_hash_finish(&hash_ctx,
+    T_COSE_PROBE1(crypto_hash_finish_entry, hash_alg_id);
+    return_value = t_cose_crypto_hash_finish(hash_ctx,
                                              buffer_for_hash,
                                              hash);
+    T_COSE_PROBE2(crypto_hash_finish_return, return_value, hash_alg_id);
+
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_util.h
+ */
+enum t_cose_err_t create_tbs_hash(int32_t                cose_algorithm_id,
+                                  struct q_useful_buf_c  protected_parameters,
+                                  struct q_useful_buf_c  aad,
+                                  struct q_useful_buf_c  payload,
+                                  struct q_useful_buf    buffer_for_hash,
+                                  struct q_useful_buf_c *hash)
+{
+    /* Aproximate stack usage
+     *                                             64-bit      32-bit
+     *   local vars                                     8           6
+     *   hash_ctx                                   8-224       8-224
+     *   hash function (a guess! variable!)        16-512      16-512
+     *   TOTAL                                     32-748      30-746
+     */
+    enum t_cose_err_t           return_value;
+    struct t_cose_crypto_hash   hash_ctx;
+
+    T_COSE_PROBE3(tbs_hash_entry, cose_algorithm_id, aad.len, payload.len);
+
+    return_value = start_tbs_hash(cose_algorithm_id, protected_parameters, &hash_ctx);
+    if(return_value) {
+        goto Done;
+    }
+
+    return_value = finish_tbs_hash(cose_algorithm_id,
+                                  &hash_ctx,
+                                   aad,
+                                   payload,
+                                   buffer_for_hash,
+                                   hash);
+
+Done:
+    T_COSE_PROBE2(tbs_hash_return, return_value, cose_algorithm_id);
+    return return_value;
+}
+
+
+
+/*
+ * Public function. See t_cose_util.h
+ */
+enum t_cose_err_t create_tbs_hash_batch(int32_t                      cose_algorithm_id,
+                                        struct t_cose_tbs_hash_item *items,
+                                        size_t                       num_items)
+{
+    /* Aproximate stack usage
+     *                                             64-bit      32-bit
+     *   local vars                                    40          20
+     *   pieces (7 per item)                   112 * group  56 * group
+     *   encoded heads (3 per item)             27 * group  27 * group
+     *   batch items                            48 * group  24 * group
+     *   hash function (a guess! variable!)      512-2848    512-2848
+     *   TOTAL (group of 16)                    3560-5896   2284-4620
+     */
+    enum t_cose_err_t                    return_value;
+    int32_t                              hash_alg_id;
+    struct q_useful_buf_c                pieces[T_COSE_BATCH_GROUP_SIZE][7];
+    uint8_t                              heads[T_COSE_BATCH_GROUP_SIZE][3][QCBOR_HEAD_BUFFER_SIZE];
+    struct t_cose_crypto_hash_batch_item batch[T_COSE_BATCH_GROUP_SIZE];
+    size_t                               group;
+    size_t                               i;
+
+    T_COSE_PROBE2(tbs_hash_batch_entry, cose_algorithm_id, num_items);
+
+    hash_alg_id = hash_alg_id_from_sig_alg_id(cose_algorithm_id);
+    if (hash_alg_id == T_COSE_INVALID_ALGORITHM_ID) {
+        return_value = T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+        goto Done;
+    }
+
+    return_value = T_COSE_SUCCESS;
+    for(; num_items > 0; num_items -= group, items += group) {
+        group = num_items < T_COSE_BATCH_GROUP_SIZE ? num_items : T_COSE_BATCH_GROUP_SIZE;
+
+        /* The Sig_structure as pieces, the same bytes that
+         * create_tbs_hash() feeds to the hash one at a time. */
+        for(i = 0; i < group; i++) {
+            pieces[i][0] = Q_USEFUL_BUF_FROM_SZ_LITERAL("\x84\x6A" COSE_SIG_CONTEXT_STRING_SIGNATURE1);
+            pieces[i][1] = QCBOREncode_EncodeHead((struct q_useful_buf){heads[i][0], QCBOR_HEAD_BUFFER_SIZE},
+                                                  CBOR_MAJOR_TYPE_BYTE_STRING,
+                                                  0,
+                                                  items[i].protected_parameters.len);
+            pieces[i][2] = items[i].protected_parameters;
+            pieces[i][3] = QCBOREncode_EncodeHead((struct q_useful_buf){heads[i][1], QCBOR_HEAD_BUFFER_SIZE},
+                                                  CBOR_MAJOR_TYPE_BYTE_STRING,
+                                                  0,
+                                                  items[i].aad.len);
+            pieces[i][4] = items[i].aad;
+            pieces[i][5] = QCBOREncode_EncodeHead((struct q_useful_buf){heads[i][2], QCBOR_HEAD_BUFFER_SIZE},
+                                                  CBOR_MAJOR_TYPE_BYTE_STRING,
+                                                  0,
+                                                  items[i].payload.len);
+            pieces[i][6] = items[i].payload;
+
+            batch[i].pieces          = pieces[i];
+            batch[i].num_pieces      = 7;
+            batch[i].buffer_for_hash = items[i].buffer_for_hash;
+        }
+
+        return_value = t_cose_crypto_hash_batch(hash_alg_id, batch, group);
+        if(return_value) {
+            goto Done;
+        }
+
+        for(i = 0; i < group; i++) {
+            items[i].hash = batch[i].hash;
+        }
+    }
+
+Done:
+    T_COSE_PROBE2(tbs_hash_batch_return, return_value, cose_algorithm_id);
+    return return_value;
+}
+
+/*
+ * Public function. See t_cose_util.h
+ */
+int32_t merkle_hash_alg_id(int32_t cose_algorithm_id)
+{
+#ifndef T_COSE_DISABLE_EDDSA
+    if(cose_algorithm_id == COSE_ALGORITHM_EDDSA) {
+        return COSE_ALGORITHM_SHA_256;
+    }
+#endif /* T_COSE_DISABLE_EDDSA */
+
+    return hash_alg_id_from_sig_alg_id(cose_algorithm_id);
+}
+
+
+/* The domain separation prefixes of RFC 9162 */
+static const uint8_t merkle_leaf_prefix[] = {0x00};
+static const uint8_t merkle_node_prefix[] = {0x01};
+
+
+/*
+ * Public function. See t_cose_util.h
+ */
+enum t_cose_err_t merkle_leaf_hash(int32_t                hash_alg_id,
+                                   struct q_useful_buf_c  payload,
+                                   struct q_useful_buf    buffer,
+                                   struct q_useful_buf_c *hash)
+{
+    enum t_cose_err_t         return_value;
+    struct t_cose_crypto_hash hash_ctx;
+
+    return_value = t_cose_crypto_hash_start(&hash_ctx, hash_alg_id);
+    if(return_value) {
+        return return_value;
+    }
+    t_cose_crypto_hash_update(&hash_ctx, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(merkle_leaf_prefix));
+    t_cose_crypto_hash_update(&hash_ctx, payload);
+
+    return t_cose_crypto_hash_finish(&hash_ctx, buffer, hash);
+}
+
+
+/*
+ * Public function. See t_cose_util.h
+ */
+enum t_cose_err_t merkle_hash_leaves(int32_t                      hash_alg_id,
+                                     const struct q_useful_buf_c *payloads,
+                                     size_t                       num_payloads,
+                                     size_t                       hash_size,
+                                     uint8_t                     *leaves)
+{
+    enum t_cose_err_t                    return_value;
+    struct q_useful_buf_c                pieces[T_COSE_BATCH_GROUP_SIZE][2];
+    struct t_cose_crypto_hash_batch_item batch[T_COSE_BATCH_GROUP_SIZE];
+    size_t                               group;
+    size_t                               i;
+
+    return_value = T_COSE_SUCCESS;
+    for(; num_payloads > 0; num_payloads -= group) {
+        group = num_payloads < T_COSE_BATCH_GROUP_SIZE ? num_payloads : T_COSE_BATCH_GROUP_SIZE;
+
+        for(i = 0; i < group; i++) {
+            pieces[i][0] = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(merkle_leaf_prefix);
+            pieces[i][1] = *payloads;
+
+            batch[i].pieces          = pieces[i];
+            batch[i].num_pieces      = 2;
+            batch[i].buffer_for_hash = (struct q_useful_buf){leaves, hash_size};
+
+            payloads++;
+            leaves += hash_size;
+        }
+
+        return_value = t_cose_crypto_hash_batch(hash_alg_id, batch, group);
+        if(return_value) {
+            goto Done;
+        }
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_util.h
+ */
+enum t_cose_err_t merkle_node_hash(int32_t                hash_alg_id,
+                                   struct q_useful_buf_c  left,
+                                   struct q_useful_buf_c  right,
+                                   struct q_useful_buf    buffer,
+                                   struct q_useful_buf_c *hash)
+{
+    enum t_cose_err_t         return_value;
+    struct t_cose_crypto_hash hash_ctx;
+
+    return_value = t_cose_crypto_hash_start(&hash_ctx, hash_alg_id);
+    if(return_value) {
+        return return_value;
+    }
+    t_cose_crypto_hash_update(&hash_ctx, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(merkle_node_prefix));
+    t_cose_crypto_hash_update(&hash_ctx, left);
+    t_cose_crypto_hash_update(&hash_ctx, right);
+
+    return t_cose_crypto_hash_finish(&hash_ctx, buffer, hash);
+}
+
+
+/*
+ * Public function. See t_cose_util.h
+ */
+enum t_cose_err_t merkle_hash_level(int32_t        hash_alg_id,
+                                    const uint8_t *children,
+                                    size_t         num_children,
+                                    size_t         hash_size,
+                                    uint8_t       *parents)
+{
+    enum t_cose_err_t                    return_value;
+    struct q_useful_buf_c                pieces[T_COSE_BATCH_GROUP_SIZE][3];
+    struct t_cose_crypto_hash_batch_item batch[T_COSE_BATCH_GROUP_SIZE];
+    size_t                               num_pairs;
+    size_t                               group;
+    size_t                               i;
+
+    return_value = T_COSE_SUCCESS;
+    num_pairs = num_children / 2;
+    for(; num_pairs > 0; num_pairs -= group) {
+        group = num_pairs < T_COSE_BATCH_GROUP_SIZE ? num_pairs : T_COSE_BATCH_GROUP_SIZE;
+
+        for(i = 0; i < group; i++) {
+            pieces[i][0] = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(merkle_node_prefix);
+            pieces[i][1] = (struct q_useful_buf_c){children, hash_size};
+            pieces[i][2] = (struct q_useful_buf_c){children + hash_size, hash_size};
+
+            batch[i].pieces          = pieces[i];
+            batch[i].num_pieces      = 3;
+            batch[i].buffer_for_hash = (struct q_useful_buf){parents, hash_size};
+
+            children += 2 * hash_size;
+            parents  += hash_size;
+        }
+
+        return_value = t_cose_crypto_hash_batch(hash_alg_id, batch, group);
+        if(return_value) {
+            goto Done;
+        }
+    }
+
+    if(num_children % 2) {
+        /* The odd one out moves up unchanged */
+        memmove(parents, children, hash_size);
+    }
+
 Done:
     return return_value;
 }
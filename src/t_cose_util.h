@@ -126,6 +126,198 @@ enum t_cose_err_t create_tbs_hash(int32_t                     cose_algorithm_id,
                                   struct q_useful_buf         buffer_for_hash,
                                   struct q_useful_buf_c      *hash);
 
+struct t_cose_crypto_hash;
+
+
+/**
+ * \brief Start the hash of the to-be-signed bytes.
+ *
+ * \param[in] cose_algorithm_id     The COSE signing algorithm ID. Used to
+ *                                  determine which hash function to use.
+ * \param[in] protected_parameters  Full, CBOR encoded, protected parameters.
+ * \param[out] hash_ctx             The hash context to start.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is the first half of create_tbs_hash(). It hashes the part of
+ * the TBS bytes that is the same for every message with the same
+ * protected parameters. The context can be cloned with
+ * t_cose_crypto_hash_clone() and each clone completed with
+ * finish_tbs_hash(). If this succeeds, \c hash_ctx must be finished
+ * or aborted.
+ */
+enum t_cose_err_t start_tbs_hash(int32_t                    cose_algorithm_id,
+                                 struct q_useful_buf_c      protected_parameters,
+                                 struct t_cose_crypto_hash *hash_ctx);
+
+
+/**
+ * \brief Finish the hash of the to-be-signed bytes.
+ *
+ * \param[in] cose_algorithm_id  The COSE signing algorithm ID given to
+ *                               start_tbs_hash().
+ * \param[in] hash_ctx           The hash context from start_tbs_hash()
+ *                               or a clone of it.
+ * \param[in] aad                Additional Authenitcated Data to be
+ *                               included in TBS.
+ * \param[in] payload            The CBOR-encoded payload.
+ * \param[in] buffer_for_hash    Pointer and length of buffer into which
+ *                               the resulting hash is put.
+ * \param[out] hash              Pointer and length of the
+ *                               resulting hash.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is the second half of create_tbs_hash(). \c hash_ctx is
+ * finished by this whether it succeeds or not.
+ */
+enum t_cose_err_t finish_tbs_hash(int32_t                    cose_algorithm_id,
+                                  struct t_cose_crypto_hash *hash_ctx,
+                                  struct q_useful_buf_c      aad,
+                                  struct q_useful_buf_c      payload,
+                                  struct q_useful_buf        buffer_for_hash,
+                                  struct q_useful_buf_c     *hash);
+
+
+/**
+ * One message for create_tbs_hash_batch(). The inputs are the same
+ * as for create_tbs_hash().
+ */
+struct t_cose_tbs_hash_item {
+    /* Inputs */
+    struct q_useful_buf_c  protected_parameters;
+    struct q_useful_buf_c  aad;
+    struct q_useful_buf_c  payload;
+    struct q_useful_buf    buffer_for_hash;
+
+    /* Output */
+    struct q_useful_buf_c  hash;
+};
+
+
+/**
+ * \brief Create the hashes of the to-be-signed (TBS) bytes for
+ * several messages at once.
+ *
+ * \param[in] cose_algorithm_id  The COSE signing algorithm ID for all
+ *                               the messages.
+ * \param[in,out] items          The messages. The hashes are returned
+ *                               in them.
+ * \param[in] num_items          The number of entries in \c items.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This gives the same hashes as calling create_tbs_hash() on each
+ * item, but uses t_cose_crypto_hash_batch() so that a crypto adapter
+ * with multi-buffer hashing can hash them together. The errors are
+ * the same as create_tbs_hash() and apply to the whole batch.
+ */
+enum t_cose_err_t create_tbs_hash_batch(int32_t                      cose_algorithm_id,
+                                        struct t_cose_tbs_hash_item *items,
+                                        size_t                       num_items);
+
+
+/**
+ * \brief Get the hash algorithm of the Merkle tree for a signing
+ * algorithm.
+ *
+ * \param[in] cose_algorithm_id  The COSE signing algorithm ID.
+ *
+ * \return The COSE hash algorithm ID or \ref T_COSE_INVALID_ALGORITHM_ID.
+ *
+ * This is the hash of the signing algorithm, except for EdDSA, which
+ * has none of its own and uses SHA-256.
+ */
+int32_t merkle_hash_alg_id(int32_t cose_algorithm_id);
+
+
+/**
+ * \brief Hash a payload into a Merkle tree leaf.
+ *
+ * \param[in] hash_alg_id   The COSE hash algorithm ID.
+ * \param[in] payload       The payload.
+ * \param[in] buffer        Where to put the hash.
+ * \param[out] hash         The leaf hash.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is HASH(0x00 || payload) as for RFC 9162 so that a leaf can't
+ * be passed off as an interior node.
+ */
+enum t_cose_err_t merkle_leaf_hash(int32_t                hash_alg_id,
+                                   struct q_useful_buf_c  payload,
+                                   struct q_useful_buf    buffer,
+                                   struct q_useful_buf_c *hash);
+
+
+/**
+ * \brief Hash many payloads into Merkle tree leaves.
+ *
+ * \param[in] hash_alg_id    The COSE hash algorithm ID.
+ * \param[in] payloads       The payloads.
+ * \param[in] num_payloads   The number of entries in \c payloads.
+ * \param[in] hash_size      The size of the hash.
+ * \param[out] leaves        Where to put the \c num_payloads leaf
+ *                           hashes, one after the other.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This gives the same hashes as merkle_leaf_hash() but uses
+ * t_cose_crypto_hash_batch() for up to \ref T_COSE_BATCH_GROUP_SIZE
+ * at a time.
+ */
+enum t_cose_err_t merkle_hash_leaves(int32_t                      hash_alg_id,
+                                     const struct q_useful_buf_c *payloads,
+                                     size_t                       num_payloads,
+                                     size_t                       hash_size,
+                                     uint8_t                     *leaves);
+
+
+/**
+ * \brief Hash two Merkle tree nodes into their parent.
+ *
+ * \param[in] hash_alg_id   The COSE hash algorithm ID.
+ * \param[in] left          The left child's hash.
+ * \param[in] right         The right child's hash.
+ * \param[in] buffer        Where to put the hash.
+ * \param[out] hash         The parent's hash.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * This is HASH(0x01 || left || right) as for RFC 9162.
+ */
+enum t_cose_err_t merkle_node_hash(int32_t                hash_alg_id,
+                                   struct q_useful_buf_c  left,
+                                   struct q_useful_buf_c  right,
+                                   struct q_useful_buf    buffer,
+                                   struct q_useful_buf_c *hash);
+
+
+/**
+ * \brief Compute one level of a Merkle tree from the level below.
+ *
+ * \param[in] hash_alg_id    The COSE hash algorithm ID.
+ * \param[in] children       The hashes of the level below, one after
+ *                           the other.
+ * \param[in] num_children   The number of hashes in \c children.
+ * \param[in] hash_size      The size of each hash.
+ * \param[out] parents       Where to put the (num_children + 1) / 2
+ *                           hashes of this level.
+ *
+ * \return This returns one of the error codes defined by \ref t_cose_err_t.
+ *
+ * Pairs are hashed with merkle_node_hash() using
+ * t_cose_crypto_hash_batch() so adapters with multi-buffer hashing
+ * do several at once. An odd node at the end moves up unchanged,
+ * which makes the same tree as the recursive definition in RFC 9162.
+ */
+enum t_cose_err_t merkle_hash_level(int32_t        hash_alg_id,
+                                    const uint8_t *children,
+                                    size_t         num_children,
+                                    size_t         hash_size,
+                                    uint8_t       *parents);
+
+
 /**
  * Serialize the to-be-signed (TBS) bytes for COSE.
  *
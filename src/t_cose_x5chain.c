@@ -0,0 +1,408 @@
+/*
+ *  t_cose_x5chain.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include <string.h>
+#include <time.h>
+#include "t_cose/t_cose_x5chain.h"
+#include "t_cose_crypto.h"
+#include "qcbor/qcbor_common.h"
+
+
+/**
+ * \file t_cose_x5chain.c
+ *
+ * \brief Verification with keys from validated certificate chains.
+ *
+ * The crypto adapter parses and validates a chain once. After that
+ * the SHA-256 of the chain's bytes in the message finds the leaf key
+ * in the cache.
+ */
+
+
+/**
+ * \brief Hash some bytes.
+ *
+ * \param[in] cose_hash_alg_id  The COSE hash algorithm.
+ * \param[in] bytes             What to hash.
+ * \param[in] buffer            Where to put the hash.
+ * \param[out] hash             The hash.
+ */
+static enum t_cose_err_t
+hash_bytes(int32_t                cose_hash_alg_id,
+           struct q_useful_buf_c  bytes,
+           struct q_useful_buf    buffer,
+           struct q_useful_buf_c *hash)
+{
+    struct t_cose_crypto_hash hash_ctx;
+    enum t_cose_err_t         return_value;
+
+    return_value = t_cose_crypto_hash_start(&hash_ctx, cose_hash_alg_id);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    t_cose_crypto_hash_update(&hash_ctx, bytes);
+    return t_cose_crypto_hash_finish(&hash_ctx, buffer, hash);
+}
+
+
+/**
+ * \brief Check the x5t parameter against the leaf certificate.
+ *
+ * \param[in] parameters  The message's parameters with x5chain and x5t.
+ * \param[in] entry       The cache entry for the chain.
+ *
+ * \retval T_COSE_ERR_X5CHAIN_INVALID  x5t isn't the hash of the leaf.
+ */
+static enum t_cose_err_t
+check_thumbprint(const struct t_cose_parameters          *parameters,
+                 const struct t_cose_x5chain_cache_entry *entry)
+{
+    Q_USEFUL_BUF_MAKE_STACK_UB(buffer, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    struct q_useful_buf_c      leaf_hash;
+    enum t_cose_err_t          return_value;
+
+    if(parameters->x5t_alg == T_COSE_ALGORITHM_SHA_256) {
+        /* Already have this one */
+        leaf_hash = (struct q_useful_buf_c){entry->leaf_hash, sizeof(entry->leaf_hash)};
+    } else {
+        return_value = hash_bytes(parameters->x5t_alg,
+                                  parameters->x5chain_leaf,
+                                  buffer,
+                                  &leaf_hash);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+    }
+
+    return_value = q_useful_buf_compare(leaf_hash, parameters->x5t_hash) ?
+                       T_COSE_ERR_X5CHAIN_INVALID : T_COSE_SUCCESS;
+
+Done:
+    return return_value;
+}
+
+
+/**
+ * \brief Get the cache entry for the message's x5chain, validating
+ *        it if it isn't cached.
+ *
+ * \param[in,out] cache   The cache.
+ * \param[in] parameters  The message's parameters with x5chain.
+ * \param[in] now         The time to validate at.
+ * \param[out] entry      The entry for the chain.
+ */
+static enum t_cose_err_t
+chain_entry(struct t_cose_x5chain_cache        *cache,
+            const struct t_cose_parameters     *parameters,
+            int64_t                             now,
+            struct t_cose_x5chain_cache_entry **entry)
+{
+    Q_USEFUL_BUF_MAKE_STACK_UB(chain_hash_buffer, T_COSE_CRYPTO_SHA256_SIZE);
+    Q_USEFUL_BUF_MAKE_STACK_UB(leaf_hash_buffer, T_COSE_CRYPTO_SHA256_SIZE);
+    struct q_useful_buf_c              chain_hash;
+    struct q_useful_buf_c              leaf_hash;
+    struct q_useful_buf_c              certs[T_COSE_X5CHAIN_MAX_CERTS];
+    struct q_useful_buf_c              cert;
+    struct t_cose_x5chain_cache_entry *found;
+    struct t_cose_x5chain_cache_entry *victim;
+    struct t_cose_key                  leaf_key;
+    int64_t                            not_before;
+    int64_t                            not_after;
+    size_t                             num_certs;
+    size_t                             i;
+    enum t_cose_err_t                  return_value;
+
+    return_value = hash_bytes(T_COSE_ALGORITHM_SHA_256,
+                              parameters->x5chain,
+                              chain_hash_buffer,
+                              &chain_hash);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    found  = NULL;
+    victim = &cache->entries[0];
+    for(i = 0; i < cache->num_entries; i++) {
+        if(cache->entries[i].last_used != 0 &&
+           memcmp(cache->entries[i].chain_hash, chain_hash.ptr, chain_hash.len) == 0) {
+            found = &cache->entries[i];
+            break;
+        }
+        if(cache->entries[i].last_used < victim->last_used) {
+            victim = &cache->entries[i];
+        }
+    }
+    if(found != NULL && now >= found->not_before && now <= found->not_after) {
+        /* Validated before and still in its time */
+        *entry = found;
+        return_value = T_COSE_SUCCESS;
+        goto Done;
+    }
+    if(found != NULL) {
+        /* Revalidate it in the same place */
+        victim = found;
+    }
+
+    num_certs = 0;
+    for(cert = t_cose_x5chain_next_cert(parameters, NULL_Q_USEFUL_BUF_C);
+        !q_useful_buf_c_is_null(cert);
+        cert = t_cose_x5chain_next_cert(parameters, cert)) {
+        if(num_certs >= T_COSE_X5CHAIN_MAX_CERTS) {
+            return_value = T_COSE_ERR_X5CHAIN_INVALID;
+            goto Done;
+        }
+        certs[num_certs++] = cert;
+    }
+
+    return_value = hash_bytes(T_COSE_ALGORITHM_SHA_256,
+                              parameters->x5chain_leaf,
+                              leaf_hash_buffer,
+                              &leaf_hash);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    return_value = t_cose_crypto_x5chain_validate(cache->trust,
+                                                  certs,
+                                                  num_certs,
+                                                  now,
+                                                  &leaf_key,
+                                                  &not_before,
+                                                  &not_after);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    if(victim->last_used != 0) {
+        t_cose_crypto_x5chain_free_key(victim->leaf_key);
+    }
+    memcpy(victim->chain_hash, chain_hash.ptr, sizeof(victim->chain_hash));
+    memcpy(victim->leaf_hash, leaf_hash.ptr, sizeof(victim->leaf_hash));
+    victim->leaf_key   = leaf_key;
+    victim->not_before = not_before;
+    victim->not_after  = not_after;
+    victim->last_used  = ++cache->counter;
+    *entry = victim;
+
+Done:
+    return return_value;
+}
+
+
+/**
+ * \brief Get the cache entry for the message's x5t.
+ *
+ * \param[in] cache       The cache.
+ * \param[in] parameters  The message's parameters without x5chain.
+ * \param[in] now         The time.
+ * \param[out] entry      The entry whose leaf has the hash in x5t.
+ *
+ * \retval T_COSE_ERR_NO_X5CHAIN  No x5t or it isn't in the cache.
+ */
+static enum t_cose_err_t
+thumbprint_entry(struct t_cose_x5chain_cache        *cache,
+                 const struct t_cose_parameters     *parameters,
+                 int64_t                             now,
+                 struct t_cose_x5chain_cache_entry **entry)
+{
+    struct t_cose_x5chain_cache_entry *candidate;
+    size_t                             i;
+
+    /* Leaves are only kept by their SHA-256 */
+    if(parameters->x5t_alg != T_COSE_ALGORITHM_SHA_256 ||
+       parameters->x5t_hash.len != sizeof(candidate->leaf_hash)) {
+        return T_COSE_ERR_NO_X5CHAIN;
+    }
+
+    for(i = 0; i < cache->num_entries; i++) {
+        candidate = &cache->entries[i];
+        if(candidate->last_used != 0 &&
+           now >= candidate->not_before &&
+           now <= candidate->not_after &&
+           memcmp(candidate->leaf_hash, parameters->x5t_hash.ptr, sizeof(candidate->leaf_hash)) == 0) {
+            *entry = candidate;
+            return T_COSE_SUCCESS;
+        }
+    }
+
+    return T_COSE_ERR_NO_X5CHAIN;
+}
+
+
+/*
+ * Public function. See t_cose_x5chain.h
+ */
+enum t_cose_err_t
+t_cose_x5chain_cache_init(struct t_cose_x5chain_cache       *me,
+                          struct t_cose_x5chain_cache_entry *entries,
+                          size_t                             num_entries,
+                          const struct q_useful_buf_c       *trust_anchors,
+                          size_t                             num_anchors)
+{
+    memset(me, 0, sizeof(*me));
+    if(num_entries == 0) {
+        return T_COSE_ERR_TOO_SMALL;
+    }
+    memset(entries, 0, num_entries * sizeof(*entries));
+    me->entries     = entries;
+    me->num_entries = num_entries;
+
+    return t_cose_crypto_x5chain_trust_new(trust_anchors, num_anchors, &me->trust);
+}
+
+
+/*
+ * Public function. See t_cose_x5chain.h
+ */
+void
+t_cose_x5chain_cache_free(struct t_cose_x5chain_cache *me)
+{
+    size_t i;
+
+    for(i = 0; i < me->num_entries; i++) {
+        if(me->entries[i].last_used != 0) {
+            t_cose_crypto_x5chain_free_key(me->entries[i].leaf_key);
+            me->entries[i].last_used = 0;
+        }
+    }
+    t_cose_crypto_x5chain_trust_free(me->trust);
+    me->trust = NULL;
+}
+
+
+/*
+ * Public function. See t_cose_x5chain.h
+ */
+struct q_useful_buf_c
+t_cose_x5chain_next_cert(const struct t_cose_parameters *parameters,
+                         struct q_useful_buf_c           previous)
+{
+    const uint8_t *cursor;
+    const uint8_t *end;
+    uint64_t       length;
+    size_t         num_length_bytes;
+    uint8_t        additional_info;
+
+    if(q_useful_buf_c_is_null(previous)) {
+        return parameters->x5chain_leaf;
+    }
+
+    /* After the first, each is a byte string head and the certificate */
+    cursor = (const uint8_t *)previous.ptr + previous.len;
+    end    = (const uint8_t *)parameters->x5chain.ptr + parameters->x5chain.len;
+    if(cursor >= end || (*cursor >> 5) != CBOR_MAJOR_TYPE_BYTE_STRING) {
+        return NULL_Q_USEFUL_BUF_C;
+    }
+
+    additional_info = *cursor & 0x1f;
+    cursor++;
+    if(additional_info < 24) {
+        length           = additional_info;
+        num_length_bytes = 0;
+    } else if(additional_info <= 27) {
+        num_length_bytes = (size_t)1 << (additional_info - 24);
+        if((size_t)(end - cursor) < num_length_bytes) {
+            return NULL_Q_USEFUL_BUF_C;
+        }
+        length = 0;
+        for(; num_length_bytes > 0; num_length_bytes--) {
+            length = (length << 8) | *cursor++;
+        }
+    } else {
+        return NULL_Q_USEFUL_BUF_C;
+    }
+
+    if(length > (uint64_t)(end - cursor)) {
+        return NULL_Q_USEFUL_BUF_C;
+    }
+
+    return (struct q_useful_buf_c){cursor, (size_t)length};
+}
+
+
+/*
+ * Public function. See t_cose_x5chain.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verifier_verify_x5chain(const struct t_cose_sign1_verifier *verifier,
+                                     struct t_cose_sign1_verify_call    *call,
+                                     struct t_cose_x5chain_cache        *cache,
+                                     struct q_useful_buf_c               cose_sign1,
+                                     struct q_useful_buf_c               aad,
+                                     struct q_useful_buf_c              *payload,
+                                     struct t_cose_parameters           *parameters)
+{
+    struct t_cose_sign1_parsed         parsed;
+    struct t_cose_x5chain_cache_entry *entry;
+    enum t_cose_err_t                  return_value;
+    int64_t                            now;
+    size_t                             key_index;
+
+    return_value = t_cose_sign1_verifier_parse(verifier, cose_sign1, &parsed);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    now = cache->clock != NULL ? cache->clock(cache->clock_ctx) : (int64_t)time(NULL);
+
+    if(!q_useful_buf_c_is_null(parsed.parameters.x5chain)) {
+        return_value = chain_entry(cache, &parsed.parameters, now, &entry);
+        if(return_value == T_COSE_SUCCESS &&
+           parsed.parameters.x5t_alg != T_COSE_UNSET_ALGORITHM_ID) {
+            return_value = check_thumbprint(&parsed.parameters, entry);
+        }
+    } else {
+        return_value = thumbprint_entry(cache, &parsed.parameters, now, &entry);
+    }
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    entry->last_used = ++cache->counter;
+
+    return_value = t_cose_sign1_verifier_verify_parsed_any_key(verifier,
+                                                               call,
+                                                               &parsed,
+                                                               aad,
+                                                               &entry->leaf_key,
+                                                               1,
+                                                               &key_index);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+
+    *payload = parsed.payload;
+    if(parameters != NULL) {
+        *parameters = parsed.parameters;
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See t_cose_x5chain.h
+ */
+enum t_cose_err_t
+t_cose_sign1_verify_x5chain(struct t_cose_sign1_verify_ctx *me,
+                            struct t_cose_x5chain_cache    *cache,
+                            struct q_useful_buf_c           cose_sign1,
+                            struct q_useful_buf_c           aad,
+                            struct q_useful_buf_c          *payload,
+                            struct t_cose_parameters       *parameters)
+{
+    return t_cose_sign1_verifier_verify_x5chain(&me->verifier,
+                                                &me->call,
+                                                cache,
+                                                cose_sign1,
+                                                aad,
+                                                payload,
+                                                parameters);
+}
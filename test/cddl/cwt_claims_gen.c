@@ -0,0 +1,692 @@
+/*
+ *  cwt_claims_gen.c
+ *
+ * Generated by tools/cddl_gen/cddl_gen.py from cwt_claims.cddl.
+ * Don't edit; change the schema and generate again.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "cwt_claims_gen.h"
+
+
+#define CDDL_MAJOR_TYPE_POSITIVE_INT 0
+#define CDDL_MAJOR_TYPE_NEGATIVE_INT 1
+#define CDDL_MAJOR_TYPE_BYTE_STRING  2
+#define CDDL_MAJOR_TYPE_TEXT_STRING  3
+#define CDDL_MAJOR_TYPE_ARRAY        4
+#define CDDL_MAJOR_TYPE_MAP          5
+#define CDDL_MAJOR_TYPE_TAG          6
+#define CDDL_MAJOR_TYPE_SIMPLE       7
+
+#define CDDL_SIMPLE_FALSE 20
+#define CDDL_SIMPLE_TRUE  21
+
+
+/* Where the encoder is writing */
+struct cddl_out {
+    uint8_t          *ptr;
+    size_t            size;
+    size_t            len;
+    enum t_cose_err_t error;
+};
+
+
+/* Where the decoder is reading */
+struct cddl_in {
+    const uint8_t *pos;
+    const uint8_t *end;
+};
+
+
+/* Keep the first error */
+static void
+cddl_fail(struct cddl_out *out, enum t_cose_err_t error)
+{
+    if(out->error == T_COSE_SUCCESS) {
+        out->error = error;
+    }
+}
+
+
+static void
+cddl_put_bytes(struct cddl_out *out, const void *bytes, size_t len)
+{
+    if(out->size - out->len < len) {
+        cddl_fail(out, T_COSE_ERR_TOO_SMALL);
+        return;
+    }
+    if(len > 0) {
+        memcpy(out->ptr + out->len, bytes, len);
+        out->len += len;
+    }
+}
+
+
+/* Write a head in its shortest form */
+static void
+cddl_put_head(struct cddl_out *out, uint8_t major_type, uint64_t argument)
+{
+    uint8_t head[9];
+    size_t  len;
+    int     shift;
+
+    if(argument < 24) {
+        head[0] = (uint8_t)(major_type << 5 | argument);
+        len = 1;
+    } else {
+        if(argument <= UINT8_MAX) {
+            head[0] = (uint8_t)(major_type << 5 | 24);
+            len = 2;
+        } else if(argument <= UINT16_MAX) {
+            head[0] = (uint8_t)(major_type << 5 | 25);
+            len = 3;
+        } else if(argument <= UINT32_MAX) {
+            head[0] = (uint8_t)(major_type << 5 | 26);
+            len = 5;
+        } else {
+            head[0] = (uint8_t)(major_type << 5 | 27);
+            len = 9;
+        }
+        for(shift = 0; shift < (int)len - 1; shift++) {
+            head[len - 1 - (size_t)shift] = (uint8_t)(argument >> (8 * shift));
+        }
+    }
+    cddl_put_bytes(out, head, len);
+}
+
+
+static void
+cddl_put_int(struct cddl_out *out, int64_t value)
+{
+    if(value < 0) {
+        cddl_put_head(out, CDDL_MAJOR_TYPE_NEGATIVE_INT, (uint64_t)(-(value + 1)));
+    } else {
+        cddl_put_head(out, CDDL_MAJOR_TYPE_POSITIVE_INT, (uint64_t)value);
+    }
+}
+
+
+static void
+cddl_put_string(struct cddl_out       *out,
+                uint8_t                major_type,
+                size_t                 min_len,
+                size_t                 max_len,
+                struct q_useful_buf_c  value)
+{
+    if(value.len < min_len || value.len > max_len) {
+        cddl_fail(out, T_COSE_ERR_PAYLOAD_SCHEMA);
+        return;
+    }
+    cddl_put_head(out, major_type, value.len);
+    cddl_put_bytes(out, value.ptr, value.len);
+}
+
+
+/* Read a head. Indefinite lengths aren't supported. */
+static enum t_cose_err_t
+cddl_get_head(struct cddl_in *in, uint8_t *major_type, uint64_t *argument)
+{
+    uint8_t  additional;
+    size_t   len;
+    uint64_t value;
+
+    if(in->pos >= in->end) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    *major_type = *in->pos >> 5;
+    additional  = *in->pos & 0x1f;
+    in->pos++;
+
+    if(additional < 24) {
+        *argument = additional;
+        return T_COSE_SUCCESS;
+    }
+    if(additional == 31) {
+        return *major_type == CDDL_MAJOR_TYPE_SIMPLE ? T_COSE_ERR_CBOR_NOT_WELL_FORMED :
+                                                       T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    if(additional > 27) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    len = (size_t)1 << (additional - 24);
+    if((size_t)(in->end - in->pos) < len) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    value = 0;
+    while(len--) {
+        value = value << 8 | *in->pos++;
+    }
+    if(*major_type == CDDL_MAJOR_TYPE_SIMPLE && additional == 24 && value < 32) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    *argument = value;
+    return T_COSE_SUCCESS;
+}
+
+
+static enum t_cose_err_t
+cddl_get_uint(struct cddl_in *in, uint64_t *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+
+    return_value = cddl_get_head(in, &major_type, value);
+    if(return_value == T_COSE_SUCCESS && major_type != CDDL_MAJOR_TYPE_POSITIVE_INT) {
+        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    return return_value;
+}
+
+
+static enum t_cose_err_t
+cddl_get_int(struct cddl_in *in, int64_t *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          argument;
+
+    return_value = cddl_get_head(in, &major_type, &argument);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    if(major_type > CDDL_MAJOR_TYPE_NEGATIVE_INT || argument > INT64_MAX) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    *value = major_type == CDDL_MAJOR_TYPE_POSITIVE_INT ? (int64_t)argument :
+                                                          -1 - (int64_t)argument;
+    return T_COSE_SUCCESS;
+}
+
+
+static enum t_cose_err_t
+cddl_get_bool(struct cddl_in *in, bool *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          argument;
+
+    return_value = cddl_get_head(in, &major_type, &argument);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    if(major_type != CDDL_MAJOR_TYPE_SIMPLE ||
+       (argument != CDDL_SIMPLE_FALSE && argument != CDDL_SIMPLE_TRUE)) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    *value = argument == CDDL_SIMPLE_TRUE;
+    return T_COSE_SUCCESS;
+}
+
+
+/* The string points into the payload */
+static enum t_cose_err_t
+cddl_get_string(struct cddl_in        *in,
+                uint8_t                expected_major_type,
+                size_t                 min_len,
+                size_t                 max_len,
+                struct q_useful_buf_c *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          len;
+
+    return_value = cddl_get_head(in, &major_type, &len);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    if(major_type != expected_major_type) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    if(len > (uint64_t)(in->end - in->pos)) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    if(len < min_len || len > max_len) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    value->ptr = in->pos;
+    value->len = (size_t)len;
+    in->pos += len;
+    return T_COSE_SUCCESS;
+}
+
+
+/* Skip one item of any type for a label the schema allows but doesn't
+ * name. Nesting is followed by counting the items still to skip, each
+ * of which takes at least a byte. */
+static enum t_cose_err_t
+cddl_skip(struct cddl_in *in)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          argument;
+    uint64_t          to_skip;
+
+    for(to_skip = 1; to_skip > 0; to_skip--) {
+        return_value = cddl_get_head(in, &major_type, &argument);
+        if(return_value != T_COSE_SUCCESS) {
+            return return_value;
+        }
+        switch(major_type) {
+        case CDDL_MAJOR_TYPE_BYTE_STRING:
+        case CDDL_MAJOR_TYPE_TEXT_STRING:
+            if(argument > (uint64_t)(in->end - in->pos)) {
+                return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+            }
+            in->pos += argument;
+            break;
+
+        case CDDL_MAJOR_TYPE_ARRAY:
+        case CDDL_MAJOR_TYPE_MAP:
+            if(argument > (uint64_t)(in->end - in->pos)) {
+                return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+            }
+            to_skip += major_type == CDDL_MAJOR_TYPE_MAP ? 2 * argument : argument;
+            break;
+
+        case CDDL_MAJOR_TYPE_TAG:
+            to_skip++;
+            break;
+
+        default:
+            /* Integers and simple values are all head */
+            break;
+        }
+        if(to_skip - 1 > (uint64_t)(in->end - in->pos)) {
+            return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+        }
+    }
+    return T_COSE_SUCCESS;
+}
+
+
+static void
+hw_claims_encode_map(struct cddl_out *out, const struct hw_claims *me)
+{
+    cddl_put_head(out, CDDL_MAJOR_TYPE_MAP,
+                  (uint64_t)(2 +
+                             ((me->present & HW_CLAIMS_SECURE_PRESENT) != 0) +
+                             ((me->present & HW_CLAIMS_LIFECYCLE_PRESENT) != 0)));
+
+    cddl_put_bytes(out, "\x01", 1); /* 1 */
+    cddl_put_string(out, CDDL_MAJOR_TYPE_TEXT_STRING, 1, 32, me->model);
+
+    cddl_put_bytes(out, "\x02", 1); /* 2 */
+    cddl_put_head(out, CDDL_MAJOR_TYPE_POSITIVE_INT, me->version);
+
+    if(me->present & HW_CLAIMS_SECURE_PRESENT) {
+        cddl_put_bytes(out, "\x66\x73\x65\x63\x75\x72\x65", 7); /* "secure" */
+        cddl_put_bytes(out, me->secure ? "\xf5" : "\xf4", 1);
+    }
+
+    if(me->present & HW_CLAIMS_LIFECYCLE_PRESENT) {
+        cddl_put_bytes(out, "\x69\x6c\x69\x66\x65\x63\x79\x63\x6c\x65", 10); /* "lifecycle" */
+        if(me->lifecycle >= 0) {
+            cddl_fail(out, T_COSE_ERR_PAYLOAD_SCHEMA);
+        }
+        cddl_put_int(out, me->lifecycle);
+    }
+}
+
+
+/* The members of \c hw-claims that must be there */
+#define HW_CLAIMS_REQUIRED (HW_CLAIMS_MODEL_PRESENT | HW_CLAIMS_VERSION_PRESENT)
+
+static enum t_cose_err_t
+hw_claims_decode_map(struct cddl_in *in, struct hw_claims *me)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          count;
+    uint64_t          label;
+    uint32_t          bit;
+    const uint8_t    *label_bytes;
+
+    return_value = cddl_get_head(in, &major_type, &count);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    if(major_type != CDDL_MAJOR_TYPE_MAP) {
+        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+        goto Done;
+    }
+
+    me->present = 0;
+    for(; count > 0; count--) {
+        return_value = cddl_get_head(in, &major_type, &label);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+        bit = 0;
+
+        switch(major_type) {
+        case CDDL_MAJOR_TYPE_POSITIVE_INT:
+            switch(label) {
+            case 1:
+                bit = HW_CLAIMS_MODEL_PRESENT;
+                return_value = cddl_get_string(in, CDDL_MAJOR_TYPE_TEXT_STRING, 1, 32, &me->model);
+                break;
+
+            case 2:
+                bit = HW_CLAIMS_VERSION_PRESENT;
+                return_value = cddl_get_uint(in, &me->version);
+                break;
+
+            default:
+                break;
+            }
+            break;
+
+        case CDDL_MAJOR_TYPE_TEXT_STRING:
+            if(label > (uint64_t)(in->end - in->pos)) {
+                return_value = T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+                goto Done;
+            }
+            label_bytes = in->pos;
+            in->pos += label;
+            switch(label) {
+            case 6:
+                if(!memcmp(label_bytes, "\x73\x65\x63\x75\x72\x65", 6)) { /* "secure" */
+                    bit = HW_CLAIMS_SECURE_PRESENT;
+                    return_value = cddl_get_bool(in, &me->secure);
+                }
+                break;
+
+            case 9:
+                if(!memcmp(label_bytes, "\x6c\x69\x66\x65\x63\x79\x63\x6c\x65", 9)) { /* "lifecycle" */
+                    bit = HW_CLAIMS_LIFECYCLE_PRESENT;
+                    return_value = cddl_get_int(in, &me->lifecycle);
+                    if(return_value == T_COSE_SUCCESS && me->lifecycle >= 0) {
+                        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+                    }
+                }
+                break;
+
+            default:
+                break;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+        if(bit == 0) {
+            return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+            goto Done;
+        }
+        if(me->present & bit) {
+            /* Duplicate label */
+            return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+            goto Done;
+        }
+        me->present |= bit;
+    }
+
+    if((me->present & HW_CLAIMS_REQUIRED) != HW_CLAIMS_REQUIRED) {
+        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+
+Done:
+    return return_value;
+}
+
+
+static void
+cwt_claims_encode_map(struct cddl_out *out, const struct cwt_claims *me)
+{
+    cddl_put_head(out, CDDL_MAJOR_TYPE_MAP,
+                  (uint64_t)(((me->present & CWT_CLAIMS_ISS_PRESENT) != 0) +
+                             ((me->present & CWT_CLAIMS_SUB_PRESENT) != 0) +
+                             ((me->present & CWT_CLAIMS_AUD_PRESENT) != 0) +
+                             ((me->present & CWT_CLAIMS_EXP_PRESENT) != 0) +
+                             ((me->present & CWT_CLAIMS_NBF_PRESENT) != 0) +
+                             ((me->present & CWT_CLAIMS_IAT_PRESENT) != 0) +
+                             ((me->present & CWT_CLAIMS_CTI_PRESENT) != 0) +
+                             ((me->present & CWT_CLAIMS_HW_PRESENT) != 0)));
+
+    if(me->present & CWT_CLAIMS_ISS_PRESENT) {
+        cddl_put_bytes(out, "\x01", 1); /* 1 */
+        cddl_put_string(out, CDDL_MAJOR_TYPE_TEXT_STRING, 0, 64, me->iss);
+    }
+
+    if(me->present & CWT_CLAIMS_SUB_PRESENT) {
+        cddl_put_bytes(out, "\x02", 1); /* 2 */
+        cddl_put_string(out, CDDL_MAJOR_TYPE_TEXT_STRING, 0, 64, me->sub);
+    }
+
+    if(me->present & CWT_CLAIMS_AUD_PRESENT) {
+        cddl_put_bytes(out, "\x03", 1); /* 3 */
+        cddl_put_string(out, CDDL_MAJOR_TYPE_TEXT_STRING, 0, 64, me->aud);
+    }
+
+    if(me->present & CWT_CLAIMS_EXP_PRESENT) {
+        cddl_put_bytes(out, "\x04", 1); /* 4 */
+        cddl_put_int(out, me->exp);
+    }
+
+    if(me->present & CWT_CLAIMS_NBF_PRESENT) {
+        cddl_put_bytes(out, "\x05", 1); /* 5 */
+        cddl_put_int(out, me->nbf);
+    }
+
+    if(me->present & CWT_CLAIMS_IAT_PRESENT) {
+        cddl_put_bytes(out, "\x06", 1); /* 6 */
+        cddl_put_int(out, me->iat);
+    }
+
+    if(me->present & CWT_CLAIMS_CTI_PRESENT) {
+        cddl_put_bytes(out, "\x07", 1); /* 7 */
+        cddl_put_string(out, CDDL_MAJOR_TYPE_BYTE_STRING, 0, 16, me->cti);
+    }
+
+    if(me->present & CWT_CLAIMS_HW_PRESENT) {
+        cddl_put_bytes(out, "\x3a\x00\x01\x24\xf7", 5); /* -75000 */
+        hw_claims_encode_map(out, &me->hw);
+    }
+}
+
+
+static enum t_cose_err_t
+cwt_claims_decode_map(struct cddl_in *in, struct cwt_claims *me)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          count;
+    uint64_t          label;
+    uint32_t          bit;
+
+    return_value = cddl_get_head(in, &major_type, &count);
+    if(return_value != T_COSE_SUCCESS) {
+        goto Done;
+    }
+    if(major_type != CDDL_MAJOR_TYPE_MAP) {
+        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+        goto Done;
+    }
+
+    me->present = 0;
+    for(; count > 0; count--) {
+        return_value = cddl_get_head(in, &major_type, &label);
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+        bit = 0;
+
+        switch(major_type) {
+        case CDDL_MAJOR_TYPE_POSITIVE_INT:
+            switch(label) {
+            case 1:
+                bit = CWT_CLAIMS_ISS_PRESENT;
+                return_value = cddl_get_string(in, CDDL_MAJOR_TYPE_TEXT_STRING, 0, 64, &me->iss);
+                break;
+
+            case 2:
+                bit = CWT_CLAIMS_SUB_PRESENT;
+                return_value = cddl_get_string(in, CDDL_MAJOR_TYPE_TEXT_STRING, 0, 64, &me->sub);
+                break;
+
+            case 3:
+                bit = CWT_CLAIMS_AUD_PRESENT;
+                return_value = cddl_get_string(in, CDDL_MAJOR_TYPE_TEXT_STRING, 0, 64, &me->aud);
+                break;
+
+            case 4:
+                bit = CWT_CLAIMS_EXP_PRESENT;
+                return_value = cddl_get_int(in, &me->exp);
+                break;
+
+            case 5:
+                bit = CWT_CLAIMS_NBF_PRESENT;
+                return_value = cddl_get_int(in, &me->nbf);
+                break;
+
+            case 6:
+                bit = CWT_CLAIMS_IAT_PRESENT;
+                return_value = cddl_get_int(in, &me->iat);
+                break;
+
+            case 7:
+                bit = CWT_CLAIMS_CTI_PRESENT;
+                return_value = cddl_get_string(in, CDDL_MAJOR_TYPE_BYTE_STRING, 0, 16, &me->cti);
+                break;
+
+            default:
+                break;
+            }
+            break;
+
+        case CDDL_MAJOR_TYPE_NEGATIVE_INT:
+            switch(label) {
+            case 74999: /* -75000 */
+                bit = CWT_CLAIMS_HW_PRESENT;
+                return_value = hw_claims_decode_map(in, &me->hw);
+                break;
+
+            default:
+                break;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if(return_value != T_COSE_SUCCESS) {
+            goto Done;
+        }
+        if(bit == 0) {
+            /* A label the schema allows but doesn't name */
+            if(major_type > CDDL_MAJOR_TYPE_NEGATIVE_INT) {
+                return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+                goto Done;
+            }
+            return_value = cddl_skip(in);
+            if(return_value != T_COSE_SUCCESS) {
+                goto Done;
+            }
+            continue;
+        }
+        if(me->present & bit) {
+            /* Duplicate label */
+            return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+            goto Done;
+        }
+        me->present |= bit;
+    }
+
+Done:
+    return return_value;
+}
+
+
+/*
+ * Public function. See cwt_claims_gen.h
+ */
+enum t_cose_err_t
+cwt_claims_encode(const struct cwt_claims *me,
+                  struct q_useful_buf      buffer,
+                  struct q_useful_buf_c   *encoded)
+{
+    struct cddl_out out;
+
+    out.ptr   = buffer.ptr;
+    out.size  = buffer.len;
+    out.len   = 0;
+    out.error = T_COSE_SUCCESS;
+
+    cwt_claims_encode_map(&out, me);
+
+    if(out.error == T_COSE_SUCCESS) {
+        encoded->ptr = out.ptr;
+        encoded->len = out.len;
+    }
+    return out.error;
+}
+
+
+/*
+ * Public function. See cwt_claims_gen.h
+ */
+enum t_cose_err_t
+cwt_claims_decode(struct q_useful_buf_c  encoded,
+                  struct cwt_claims     *me)
+{
+    struct cddl_in    in;
+    enum t_cose_err_t return_value;
+
+    memset(me, 0, sizeof(*me));
+    in.pos = encoded.ptr;
+    in.end = in.pos + encoded.len;
+
+    return_value = cwt_claims_decode_map(&in, me);
+    if(return_value == T_COSE_SUCCESS && in.pos != in.end) {
+        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    return return_value;
+}
+
+
+/*
+ * Public function. See cwt_claims_gen.h
+ */
+enum t_cose_err_t
+cwt_claims_sign1_sign(struct t_cose_sign1_sign_ctx *sign_ctx,
+                      const struct cwt_claims      *me,
+                      struct q_useful_buf           out_buf,
+                      struct q_useful_buf_c        *result)
+{
+    Q_USEFUL_BUF_MAKE_STACK_UB(payload_buffer, CWT_CLAIMS_MAX_SIZE);
+    struct q_useful_buf_c      payload;
+    enum t_cose_err_t          return_value;
+
+    return_value = cwt_claims_encode(me, payload_buffer, &payload);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    return t_cose_sign1_sign(sign_ctx, payload, out_buf, result);
+}
+
+
+/*
+ * Public function. See cwt_claims_gen.h
+ */
+enum t_cose_err_t
+cwt_claims_sign1_verify(struct t_cose_sign1_verify_ctx *verify_ctx,
+                        struct q_useful_buf_c           sign1,
+                        struct cwt_claims              *me,
+                        struct t_cose_parameters       *parameters)
+{
+    struct q_useful_buf_c payload;
+    enum t_cose_err_t     return_value;
+
+    return_value = t_cose_sign1_verify(verify_ctx, sign1, &payload, parameters);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    return cwt_claims_decode(payload, me);
+}
@@ -0,0 +1,140 @@
+/*
+ *  cwt_claims_gen.h
+ *
+ * Generated by tools/cddl_gen/cddl_gen.py from cwt_claims.cddl.
+ * Don't edit; change the schema and generate again.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __CWT_CLAIMS_GEN_H__
+#define __CWT_CLAIMS_GEN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "t_cose/q_useful_buf.h"
+#include "t_cose/t_cose_common.h"
+#include "t_cose/t_cose_sign1_sign.h"
+#include "t_cose/t_cose_sign1_verify.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * The \c hw-claims map. \c present has a bit for each member
+ * in it; required members are always encoded.
+ */
+struct hw_claims {
+    struct q_useful_buf_c model;
+    uint64_t              version;
+    bool                  secure;
+    int64_t               lifecycle;
+    uint32_t              present;
+};
+
+#define HW_CLAIMS_MODEL_PRESENT                  0x00000001U /* 1, required */
+#define HW_CLAIMS_VERSION_PRESENT                0x00000002U /* 2, required */
+#define HW_CLAIMS_SECURE_PRESENT                 0x00000004U /* "secure" */
+#define HW_CLAIMS_LIFECYCLE_PRESENT              0x00000008U /* "lifecycle" */
+
+
+/**
+ * The \c cwt-claims map. \c present has a bit for each member
+ * in it; required members are always encoded.
+ */
+struct cwt_claims {
+    struct q_useful_buf_c iss;
+    struct q_useful_buf_c sub;
+    struct q_useful_buf_c aud;
+    int64_t               exp;
+    int64_t               nbf;
+    int64_t               iat;
+    struct q_useful_buf_c cti;
+    struct hw_claims      hw;
+    uint32_t              present;
+};
+
+#define CWT_CLAIMS_ISS_PRESENT                   0x00000001U /* 1 */
+#define CWT_CLAIMS_SUB_PRESENT                   0x00000002U /* 2 */
+#define CWT_CLAIMS_AUD_PRESENT                   0x00000004U /* 3 */
+#define CWT_CLAIMS_EXP_PRESENT                   0x00000008U /* 4 */
+#define CWT_CLAIMS_NBF_PRESENT                   0x00000010U /* 5 */
+#define CWT_CLAIMS_IAT_PRESENT                   0x00000020U /* 6 */
+#define CWT_CLAIMS_CTI_PRESENT                   0x00000040U /* 7 */
+#define CWT_CLAIMS_HW_PRESENT                    0x00000080U /* -75000 */
+
+
+/* The most bytes a \c cwt-claims map encodes to */
+#define CWT_CLAIMS_MAX_SIZE 328
+
+
+/**
+ * \brief Encode a \c cwt-claims map.
+ *
+ * \param[in] me        The claims to encode.
+ * \param[in] buffer    Where to encode them.
+ * \param[out] encoded  The encoded map in \c buffer.
+ *
+ * \retval T_COSE_ERR_TOO_SMALL
+ *         \c buffer is too small.
+ * \retval T_COSE_ERR_PAYLOAD_SCHEMA
+ *         A value is outside what the schema allows.
+ * \retval T_COSE_SUCCESS
+ *         \c encoded is the map.
+ */
+enum t_cose_err_t
+cwt_claims_encode(const struct cwt_claims *me,
+                  struct q_useful_buf      buffer,
+                  struct q_useful_buf_c   *encoded);
+
+
+/**
+ * \brief Decode a \c cwt-claims map.
+ *
+ * \param[in] encoded  The encoded map, for example a verified payload.
+ * \param[out] me      The claims. Strings point into \c encoded.
+ *
+ * \retval T_COSE_ERR_CBOR_NOT_WELL_FORMED
+ *         \c encoded is not well-formed.
+ * \retval T_COSE_ERR_PAYLOAD_SCHEMA
+ *         \c encoded doesn't match the schema or has an indefinite
+ *         length.
+ * \retval T_COSE_SUCCESS
+ *         \c me has the claims.
+ */
+enum t_cose_err_t
+cwt_claims_decode(struct q_useful_buf_c  encoded,
+                  struct cwt_claims     *me);
+
+
+/**
+ * \brief Encode a \c cwt-claims map and sign it as a \c COSE_Sign1.
+ *
+ * The map is encoded on the stack and passed to t_cose_sign1_sign().
+ */
+enum t_cose_err_t
+cwt_claims_sign1_sign(struct t_cose_sign1_sign_ctx *sign_ctx,
+                      const struct cwt_claims      *me,
+                      struct q_useful_buf           out_buf,
+                      struct q_useful_buf_c        *result);
+
+
+/**
+ * \brief Verify a \c COSE_Sign1 and decode its \c cwt-claims payload.
+ *
+ * This is t_cose_sign1_verify() then cwt_claims_decode().
+ */
+enum t_cose_err_t
+cwt_claims_sign1_verify(struct t_cose_sign1_verify_ctx *verify_ctx,
+                        struct q_useful_buf_c           sign1,
+                        struct cwt_claims              *me,
+                        struct t_cose_parameters       *parameters);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CWT_CLAIMS_GEN_H__ */
@@ -17,6 +17,9 @@
 
 #include "t_cose_test.h"
 #include "t_cose_sign_verify_test.h"
+#include "t_cose_crypto_test.h"
+#include "t_cose_p256_test.h"
+#include "t_cose_ecv_test.h"
 
 
 /*
@@ -50,6 +53,17 @@ static test_entry2 s_tests2[] = {
 
 static test_entry s_tests[] = {
     TEST_ENTRY(sign1_structure_decode_test),
+    TEST_ENTRY(crypto_hash_test),
+    TEST_ENTRY(crypto_hash_batch_test),
+    TEST_ENTRY(crypto_warmup_test),
+#ifndef T_COSE_DISABLE_HASH_FILE
+    TEST_ENTRY(hash_file_test),
+#endif /* T_COSE_DISABLE_HASH_FILE */
+#ifdef T_COSE_USE_B_CON_SHA256
+    TEST_ENTRY(b_con_sha256_kernel_test),
+    TEST_ENTRY(b_con_sha256_multi_test),
+    TEST_ENTRY(b_con_sha512_kernel_test),
+#endif /* T_COSE_USE_B_CON_SHA256 */
 
 #ifndef T_COSE_DISABLE_SIGN_VERIFY_TESTS
     /* Many tests can be run without a crypto library integration and
@@ -64,8 +78,32 @@ static test_entry s_tests[] = {
     TEST_ENTRY(sign_verify_known_good_test),
     TEST_ENTRY(sign_verify_unsupported_test),
     TEST_ENTRY(sign_verify_bad_auxiliary_buffer),
+    TEST_ENTRY(sign_verify_batch_test),
+    TEST_ENTRY(sign_verify_key_replicas_test),
+    TEST_ENTRY(sign_verify_deterministic_test),
+    TEST_ENTRY(sign_verify_reserve_payload_test),
+    TEST_ENTRY(sign_verify_iovec_test),
+    TEST_ENTRY(sign_verify_parse_test),
+    TEST_ENTRY(sign_verify_any_key_test),
+    TEST_ENTRY(sign_verify_merkle_test),
+    TEST_ENTRY(sign_verify_x5chain_test),
+    TEST_ENTRY(sign_verify_replay_cache_test),
 #endif /* T_COSE_DISABLE_SIGN_VERIFY_TESTS */
 
+#ifdef T_COSE_ENABLE_P256_TESTS
+    TEST_ENTRY(p256_kat_test),
+    TEST_ENTRY(p256_nonce_pool_test),
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+    TEST_ENTRY(p256_openssl_cross_test),
+#endif /* T_COSE_USE_OPENSSL_CRYPTO */
+#endif /* T_COSE_ENABLE_P256_TESTS */
+
+#ifdef T_COSE_USE_ECV_VERIFY
+    TEST_ENTRY(ecv_kat_test),
+    TEST_ENTRY(ecv_cache_test),
+    TEST_ENTRY(ecv_adapter_test),
+#endif /* T_COSE_USE_ECV_VERIFY */
+
 #ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
     /* These tests can't run if short-circuit signatures are disabled.
      * The most critical ones are replicated in the group of tests
@@ -89,6 +127,22 @@ static test_entry s_tests[] = {
     TEST_ENTRY(tags_test),
     TEST_ENTRY(get_size_test),
     TEST_ENTRY(indef_array_and_map_test),
+    TEST_ENTRY(short_circuit_batch_test),
+    TEST_ENTRY(short_circuit_shared_config_test),
+    TEST_ENTRY(short_circuit_reserve_payload_test),
+    TEST_ENTRY(short_circuit_iovec_test),
+    TEST_ENTRY(short_circuit_parse_test),
+    TEST_ENTRY(short_circuit_policy_test),
+    TEST_ENTRY(short_circuit_header_cache_test),
+    TEST_ENTRY(short_circuit_merkle_test),
+    TEST_ENTRY(short_circuit_hash_envelope_test),
+    TEST_ENTRY(short_circuit_cwt_template_test),
+    TEST_ENTRY(short_circuit_cwt_validate_test),
+    TEST_ENTRY(short_circuit_claims_index_test),
+    TEST_ENTRY(short_circuit_cddl_gen_test),
+    TEST_ENTRY(short_circuit_nested_verify_test),
+    TEST_ENTRY(short_circuit_x5chain_test),
+    TEST_ENTRY(short_circuit_replay_cache_test),
 
 #ifdef T_COSE_ENABLE_HASH_FAIL_TEST
     TEST_ENTRY(short_circuit_hash_fail_test),
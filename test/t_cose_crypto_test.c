@@ -0,0 +1,714 @@
+/*
+ *  t_cose_crypto_test.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "t_cose_crypto_test.h"
+#include "t_cose_crypto.h"
+#include "t_cose_standard_constants.h"
+
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+#include <openssl/opensslv.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/crypto.h>
+#define WARMUP_TEST_LIB_CTX
+#endif
+#endif
+
+#ifdef T_COSE_USE_B_CON_SHA256
+#include <string.h>
+#include "sha256.h"
+#include "sha512.h"
+#endif
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "t_cose/t_cose_hash_file.h"
+#endif
+
+
+struct hash_kat {
+    int32_t               cose_hash_alg_id;
+    struct q_useful_buf_c input;
+    /* If non-zero the input is hashed this many times over */
+    uint32_t              repeat;
+    struct q_useful_buf_c expected;
+};
+
+static const uint8_t million_a_chunk[] =
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+
+/* Test vectors from FIPS 180-2 appendix B and NIST CSRC examples */
+static const struct hash_kat hash_kats[] = {
+    {COSE_ALGORITHM_SHA_256,
+     {"", 0}, 0,
+     {"\xe3\xb0\xc4\x42\x98\xfc\x1c\x14\x9a\xfb\xf4\xc8\x99\x6f\xb9\x24"
+      "\x27\xae\x41\xe4\x64\x9b\x93\x4c\xa4\x95\x99\x1b\x78\x52\xb8\x55", 32}},
+
+    {COSE_ALGORITHM_SHA_256,
+     {"abc", 3}, 0,
+     {"\xba\x78\x16\xbf\x8f\x01\xcf\xea\x41\x41\x40\xde\x5d\xae\x22\x23"
+      "\xb0\x03\x61\xa3\x96\x17\x7a\x9c\xb4\x10\xff\x61\xf2\x00\x15\xad", 32}},
+
+    {COSE_ALGORITHM_SHA_256,
+     {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56}, 0,
+     {"\x24\x8d\x6a\x61\xd2\x06\x38\xb8\xe5\xc0\x26\x93\x0c\x3e\x60\x39"
+      "\xa3\x3c\xe4\x59\x64\xff\x21\x67\xf6\xec\xed\xd4\x19\xdb\x06\xc1", 32}},
+
+    {COSE_ALGORITHM_SHA_256,
+     {million_a_chunk, 500}, 2000,
+     {"\xcd\xc7\x6e\x5c\x99\x14\xfb\x92\x81\xa1\xc7\xe2\x84\xd7\x3e\x67"
+      "\xf1\x80\x9a\x48\xa4\x97\x20\x0e\x04\x6d\x39\xcc\xc7\x11\x2c\xd0", 32}},
+
+    {COSE_ALGORITHM_SHA_384,
+     {"", 0}, 0,
+     {"\x38\xb0\x60\xa7\x51\xac\x96\x38\x4c\xd9\x32\x7e\xb1\xb1\xe3\x6a"
+      "\x21\xfd\xb7\x11\x14\xbe\x07\x43\x4c\x0c\xc7\xbf\x63\xf6\xe1\xda"
+      "\x27\x4e\xde\xbf\xe7\x6f\x65\xfb\xd5\x1a\xd2\xf1\x48\x98\xb9\x5b", 48}},
+
+    {COSE_ALGORITHM_SHA_384,
+     {"abc", 3}, 0,
+     {"\xcb\x00\x75\x3f\x45\xa3\x5e\x8b\xb5\xa0\x3d\x69\x9a\xc6\x50\x07"
+      "\x27\x2c\x32\xab\x0e\xde\xd1\x63\x1a\x8b\x60\x5a\x43\xff\x5b\xed"
+      "\x80\x86\x07\x2b\xa1\xe7\xcc\x23\x58\xba\xec\xa1\x34\xc8\x25\xa7", 48}},
+
+    {COSE_ALGORITHM_SHA_384,
+     {"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+      "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 112}, 0,
+     {"\x09\x33\x0c\x33\xf7\x11\x47\xe8\x3d\x19\x2f\xc7\x82\xcd\x1b\x47"
+      "\x53\x11\x1b\x17\x3b\x3b\x05\xd2\x2f\xa0\x80\x86\xe3\xb0\xf7\x12"
+      "\xfc\xc7\xc7\x1a\x55\x7e\x2d\xb9\x66\xc3\xe9\xfa\x91\x74\x60\x39", 48}},
+
+    {COSE_ALGORITHM_SHA_384,
+     {million_a_chunk, 500}, 2000,
+     {"\x9d\x0e\x18\x09\x71\x64\x74\xcb\x08\x6e\x83\x4e\x31\x0a\x4a\x1c"
+      "\xed\x14\x9e\x9c\x00\xf2\x48\x52\x79\x72\xce\xc5\x70\x4c\x2a\x5b"
+      "\x07\xb8\xb3\xdc\x38\xec\xc4\xeb\xae\x97\xdd\xd8\x7f\x3d\x89\x85", 48}},
+
+    {COSE_ALGORITHM_SHA_512,
+     {"", 0}, 0,
+     {"\xcf\x83\xe1\x35\x7e\xef\xb8\xbd\xf1\x54\x28\x50\xd6\x6d\x80\x07"
+      "\xd6\x20\xe4\x05\x0b\x57\x15\xdc\x83\xf4\xa9\x21\xd3\x6c\xe9\xce"
+      "\x47\xd0\xd1\x3c\x5d\x85\xf2\xb0\xff\x83\x18\xd2\x87\x7e\xec\x2f"
+      "\x63\xb9\x31\xbd\x47\x41\x7a\x81\xa5\x38\x32\x7a\xf9\x27\xda\x3e", 64}},
+
+    {COSE_ALGORITHM_SHA_512,
+     {"abc", 3}, 0,
+     {"\xdd\xaf\x35\xa1\x93\x61\x7a\xba\xcc\x41\x73\x49\xae\x20\x41\x31"
+      "\x12\xe6\xfa\x4e\x89\xa9\x7e\xa2\x0a\x9e\xee\xe6\x4b\x55\xd3\x9a"
+      "\x21\x92\x99\x2a\x27\x4f\xc1\xa8\x36\xba\x3c\x23\xa3\xfe\xeb\xbd"
+      "\x45\x4d\x44\x23\x64\x3c\xe8\x0e\x2a\x9a\xc9\x4f\xa5\x4c\xa4\x9f", 64}},
+
+    {COSE_ALGORITHM_SHA_512,
+     {"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+      "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 112}, 0,
+     {"\x8e\x95\x9b\x75\xda\xe3\x13\xda\x8c\xf4\xf7\x28\x14\xfc\x14\x3f"
+      "\x8f\x77\x79\xc6\xeb\x9f\x7f\xa1\x72\x99\xae\xad\xb6\x88\x90\x18"
+      "\x50\x1d\x28\x9e\x49\x00\xf7\xe4\x33\x1b\x99\xde\xc4\xb5\x43\x3a"
+      "\xc7\xd3\x29\xee\xb6\xdd\x26\x54\x5e\x96\xe5\x5b\x87\x4b\xe9\x09", 64}},
+
+    {COSE_ALGORITHM_SHA_512,
+     {million_a_chunk, 500}, 2000,
+     {"\xe7\x18\x48\x3d\x0c\xe7\x69\x64\x4e\x2e\x42\xc7\xbc\x15\xb4\x63"
+      "\x8e\x1f\x98\xb1\x3b\x20\x44\x28\x56\x32\xa8\x03\xaf\xa9\x73\xeb"
+      "\xde\x0f\xf2\x44\x87\x7e\xa6\x0a\x4c\xb0\x43\x2c\xe5\x77\xc3\x1b"
+      "\xeb\x00\x9c\x5c\x2c\x49\xaa\x2e\x4e\xad\xb2\x17\xad\x8c\xc0\x9b", 64}},
+
+    {0, {NULL, 0}, 0, {NULL, 0}}
+};
+
+
+/* Hashes kat->input feeding it in pieces of chunk_size bytes */
+static enum t_cose_err_t
+hash_in_chunks(const struct hash_kat  *kat,
+               size_t                  chunk_size,
+               struct q_useful_buf     buffer,
+               struct q_useful_buf_c  *hash)
+{
+    struct t_cose_crypto_hash hash_ctx;
+    enum t_cose_err_t         result;
+    uint32_t                  repeat;
+    size_t                    offset;
+    size_t                    len;
+
+    result = t_cose_crypto_hash_start(&hash_ctx, kat->cose_hash_alg_id);
+    if(result) {
+        return result;
+    }
+
+    repeat = kat->repeat ? kat->repeat : 1;
+    while(repeat--) {
+        for(offset = 0; offset < kat->input.len; offset += len) {
+            len = kat->input.len - offset;
+            if(len > chunk_size) {
+                len = chunk_size;
+            }
+            t_cose_crypto_hash_update(&hash_ctx,
+                                      q_useful_buf_tail(q_useful_buf_head(kat->input,
+                                                                          offset + len),
+                                                        offset));
+        }
+    }
+
+    return t_cose_crypto_hash_finish(&hash_ctx, buffer, hash);
+}
+
+
+/*
+ * Public function, see t_cose_crypto_test.h
+ */
+int_fast32_t crypto_hash_test(void)
+{
+    static const size_t        chunk_sizes[] = {SIZE_MAX, 1, 7, 63, 64, 65, 127, 128, 129, 200};
+    const struct hash_kat     *kat;
+    size_t                     i;
+    enum t_cose_err_t          result;
+    Q_USEFUL_BUF_MAKE_STACK_UB(buffer, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    struct q_useful_buf_c      hash;
+
+    for(kat = hash_kats; kat->cose_hash_alg_id; kat++) {
+        for(i = 0; i < sizeof(chunk_sizes)/sizeof(chunk_sizes[0]); i++) {
+            result = hash_in_chunks(kat, chunk_sizes[i], buffer, &hash);
+            if(result == T_COSE_ERR_UNSUPPORTED_HASH) {
+                /* Not all adaptors do all hashes */
+                break;
+            }
+            if(result) {
+                return (int_fast32_t)(kat - hash_kats) * 100 + (int_fast32_t)result;
+            }
+            if(q_useful_buf_compare(hash, kat->expected)) {
+                return (int_fast32_t)(kat - hash_kats) * 100 + 99;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+
+/*
+ * Public function, see t_cose_crypto_test.h
+ */
+int_fast32_t crypto_warmup_test(void)
+{
+    int_fast32_t result;
+
+    if(t_cose_warmup(NULL)) {
+        return 1;
+    }
+    /* Hashing works the same after */
+    result = crypto_hash_test();
+    if(result) {
+        return 1000 + result;
+    }
+    /* And a second call works */
+    if(t_cose_warmup(NULL)) {
+        return 2;
+    }
+
+#ifdef WARMUP_TEST_LIB_CTX
+    {
+        OSSL_LIB_CTX *lib_ctx;
+
+        lib_ctx = OSSL_LIB_CTX_new();
+        if(lib_ctx == NULL) {
+            return 3;
+        }
+        /* Fetching from a separate library context. The warm-up's own
+         * ES256 signature is made with it. */
+        if(t_cose_warmup(lib_ctx)) {
+            OSSL_LIB_CTX_free(lib_ctx);
+            return 4;
+        }
+        result = crypto_hash_test();
+        /* Back to the default before the context goes away */
+        if(t_cose_warmup(NULL)) {
+            result = 5;
+        }
+        OSSL_LIB_CTX_free(lib_ctx);
+        if(result) {
+            return 2000 + result;
+        }
+    }
+#endif /* WARMUP_TEST_LIB_CTX */
+
+    return 0;
+}
+
+
+/* Fills buffer with bytes from a simple LCG */
+static void fill_pseudo_random(uint8_t *buffer, size_t len, uint32_t seed)
+{
+    size_t i;
+
+    for(i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+
+/*
+ * Public function, see t_cose_crypto_test.h
+ */
+int_fast32_t crypto_hash_batch_test(void)
+{
+    /* Enough that the b_con adaptor does more than one group of
+     * lanes */
+    #define NUM_HASH_BATCH_ITEMS 37
+    #define PIECES_PER_ITEM      3
+    static uint8_t                       input[2000];
+    static const int32_t                 hash_algs[] = {COSE_ALGORITHM_SHA_256,
+                                                        COSE_ALGORITHM_SHA_384,
+                                                        COSE_ALGORITHM_SHA_512};
+    static uint8_t                       hashes[NUM_HASH_BATCH_ITEMS][T_COSE_CRYPTO_MAX_HASH_SIZE];
+    struct q_useful_buf_c                pieces[NUM_HASH_BATCH_ITEMS][PIECES_PER_ITEM];
+    struct t_cose_crypto_hash_batch_item items[NUM_HASH_BATCH_ITEMS];
+    struct t_cose_crypto_hash            hash_ctx;
+    Q_USEFUL_BUF_MAKE_STACK_UB(          buffer, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    struct q_useful_buf_c                expected;
+    enum t_cose_err_t                    result;
+    size_t                               i;
+    size_t                               p;
+    size_t                               offset;
+    size_t                               a;
+
+    fill_pseudo_random(input, sizeof(input), 7);
+
+    /* Messages from 0 to a few hundred bytes in up to three pieces,
+     * some missing or NULL, straddling block boundaries differently */
+    offset = 0;
+    for(i = 0; i < NUM_HASH_BATCH_ITEMS; i++) {
+        for(p = 0; p < PIECES_PER_ITEM; p++) {
+            pieces[i][p] = (struct q_useful_buf_c){input + offset, (i * 13 + p * 29) % 130};
+            offset = (offset + 17) % 1000;
+        }
+        if(i % 5 == 2) {
+            pieces[i][1] = NULL_Q_USEFUL_BUF_C;
+        }
+        items[i].pieces          = pieces[i];
+        items[i].num_pieces      = i % 4 == 3 ? 1 : PIECES_PER_ITEM;
+        items[i].buffer_for_hash = (struct q_useful_buf){hashes[i], sizeof(hashes[i])};
+    }
+
+    for(a = 0; a < sizeof(hash_algs)/sizeof(hash_algs[0]); a++) {
+        result = t_cose_crypto_hash_batch(hash_algs[a], items, NUM_HASH_BATCH_ITEMS);
+        if(result == T_COSE_ERR_UNSUPPORTED_HASH && a > 0) {
+            /* Not all adaptors do all hashes */
+            continue;
+        }
+        if(result) {
+            return 1000 + (int_fast32_t)result;
+        }
+
+        for(i = 0; i < NUM_HASH_BATCH_ITEMS; i++) {
+            result = t_cose_crypto_hash_start(&hash_ctx, hash_algs[a]);
+            if(result) {
+                return 2000 + (int_fast32_t)result;
+            }
+            for(p = 0; p < items[i].num_pieces; p++) {
+                t_cose_crypto_hash_update(&hash_ctx, pieces[i][p]);
+            }
+            result = t_cose_crypto_hash_finish(&hash_ctx, buffer, &expected);
+            if(result) {
+                return 3000 + (int_fast32_t)result;
+            }
+            if(q_useful_buf_compare(expected, items[i].hash)) {
+                return 4000 + (int_fast32_t)i;
+            }
+        }
+    }
+
+    /* An unsupported hash is an error for the whole batch */
+    result = t_cose_crypto_hash_batch(COSE_ALGORITHM_RESERVED, items, NUM_HASH_BATCH_ITEMS);
+    if(result != T_COSE_ERR_UNSUPPORTED_HASH) {
+        return 5000 + (int_fast32_t)result;
+    }
+
+    /* An empty batch is fine */
+    result = t_cose_crypto_hash_batch(COSE_ALGORITHM_SHA_256, items, 0);
+    if(result) {
+        return 6000 + (int_fast32_t)result;
+    }
+
+    return 0;
+}
+
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+
+/* Makes a temporary file with the given contents. Returns 0 on
+ * success. */
+static int make_temp_file(char *path, const uint8_t *bytes, size_t len)
+{
+    int fd;
+
+    fd = mkstemp(path);
+    if(fd < 0) {
+        return 1;
+    }
+    if(len > 0 && write(fd, bytes, len) != (ssize_t)len) {
+        close(fd);
+        unlink(path);
+        return 1;
+    }
+    close(fd);
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_crypto_test.h
+ */
+int_fast32_t hash_file_test(void)
+{
+    /* Enough to take more than one group */
+    #define NUM_HASH_FILE_ITEMS (T_COSE_BATCH_GROUP_SIZE + 3)
+    static const uint8_t abc_sha256[] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde,
+        0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+        0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+    static const uint8_t empty_sha256[] = {
+        0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8,
+        0x99, 0x6f, 0xb9, 0x24, 0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c,
+        0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55};
+    static uint8_t               big[300000];
+    static uint8_t               hashes[NUM_HASH_FILE_ITEMS][T_COSE_CRYPTO_MAX_HASH_SIZE];
+    char                         abc_path[]   = "/tmp/t_cose_hash_file_XXXXXX";
+    char                         empty_path[] = "/tmp/t_cose_hash_file_XXXXXX";
+    char                         big_path[]   = "/tmp/t_cose_hash_file_XXXXXX";
+    struct t_cose_hash_file_item items[NUM_HASH_FILE_ITEMS];
+    struct t_cose_crypto_hash    hash_ctx;
+    Q_USEFUL_BUF_MAKE_STACK_UB(  buffer, T_COSE_CRYPTO_MAX_HASH_SIZE);
+    struct q_useful_buf_c        big_hash;
+    struct q_useful_buf_c        expected;
+    enum t_cose_err_t            err;
+    int_fast32_t                 result;
+    size_t                       i;
+
+    fill_pseudo_random(big, sizeof(big), 11);
+
+    result = 0;
+    if(make_temp_file(abc_path, (const uint8_t *)"abc", 3)) {
+        return 1;
+    }
+    if(make_temp_file(empty_path, NULL, 0)) {
+        unlink(abc_path);
+        return 2;
+    }
+    if(make_temp_file(big_path, big, sizeof(big))) {
+        unlink(abc_path);
+        unlink(empty_path);
+        return 3;
+    }
+
+    err = t_cose_crypto_hash_start(&hash_ctx, COSE_ALGORITHM_SHA_256);
+    if(err == T_COSE_SUCCESS) {
+        t_cose_crypto_hash_update(&hash_ctx, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(big));
+        err = t_cose_crypto_hash_finish(&hash_ctx, buffer, &big_hash);
+    }
+    if(err) {
+        result = 100 + (int_fast32_t)err;
+        goto Done;
+    }
+
+    /* The three files over and over with one that doesn't exist in
+     * each group */
+    for(i = 0; i < NUM_HASH_FILE_ITEMS; i++) {
+        switch(i % 4) {
+        case 0: items[i].path = abc_path; break;
+        case 1: items[i].path = empty_path; break;
+        case 2: items[i].path = big_path; break;
+        default: items[i].path = "/tmp/t_cose_hash_file_missing"; break;
+        }
+        items[i].buffer_for_hash = (struct q_useful_buf){hashes[i], sizeof(hashes[i])};
+    }
+
+    err = t_cose_hash_files(COSE_ALGORITHM_SHA_256, items, NUM_HASH_FILE_ITEMS);
+    if(err != T_COSE_ERR_FILE_READ) {
+        result = 200 + (int_fast32_t)err;
+        goto Done;
+    }
+    for(i = 0; i < NUM_HASH_FILE_ITEMS; i++) {
+        switch(i % 4) {
+        case 0: expected = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(abc_sha256); break;
+        case 1: expected = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(empty_sha256); break;
+        case 2: expected = big_hash; break;
+        default: expected = NULL_Q_USEFUL_BUF_C; break;
+        }
+        if(q_useful_buf_c_is_null(expected)) {
+            if(items[i].err != T_COSE_ERR_FILE_READ) {
+                result = 300 + (int_fast32_t)i;
+                goto Done;
+            }
+        } else if(items[i].err != T_COSE_SUCCESS ||
+                  q_useful_buf_compare(items[i].hash, expected)) {
+            result = 400 + (int_fast32_t)i;
+            goto Done;
+        }
+    }
+
+    /* All found */
+    err = t_cose_hash_files(COSE_ALGORITHM_SHA_256, items, 3);
+    if(err) {
+        result = 500 + (int_fast32_t)err;
+        goto Done;
+    }
+
+    /* A directory can't be hashed */
+    items[0].path = "/tmp";
+    err = t_cose_hash_files(COSE_ALGORITHM_SHA_256, items, 1);
+    if(err != T_COSE_ERR_FILE_READ) {
+        result = 600 + (int_fast32_t)err;
+        goto Done;
+    }
+
+    /* An unsupported hash fails the files that were opened */
+    items[0].path = abc_path;
+    err = t_cose_hash_files(COSE_ALGORITHM_RESERVED, items, 2);
+    if(err != T_COSE_ERR_UNSUPPORTED_HASH ||
+       items[0].err != T_COSE_ERR_UNSUPPORTED_HASH ||
+       items[1].err != T_COSE_ERR_UNSUPPORTED_HASH) {
+        result = 700 + (int_fast32_t)err;
+        goto Done;
+    }
+
+Done:
+    unlink(abc_path);
+    unlink(empty_path);
+    unlink(big_path);
+
+    return result;
+}
+
+#endif /* T_COSE_DISABLE_HASH_FILE */
+
+#ifdef T_COSE_USE_B_CON_SHA256
+
+/*
+ * Public function, see t_cose_crypto_test.h
+ */
+int_fast32_t b_con_sha256_kernel_test(void)
+{
+    static const int impls[] = {SHA256_IMPL_AVX2, SHA256_IMPL_SHANI};
+    static uint8_t   input[3000];
+    uint32_t         lcg;
+    size_t           i;
+    size_t           len;
+    size_t           offset;
+    size_t           n;
+    SHA256_CTX       ctx;
+    uint8_t          expected[SHA256_BLOCK_SIZE];
+    uint8_t          actual[SHA256_BLOCK_SIZE];
+    int_fast32_t     return_value;
+    int              saved_impl;
+
+    lcg = 1;
+    for(i = 0; i < sizeof(input); i++) {
+        lcg = lcg * 1103515245 + 12345;
+        input[i] = (uint8_t)(lcg >> 16);
+    }
+
+    saved_impl = sha256_get_impl();
+    return_value = 0;
+
+    for(i = 0; i < sizeof(impls)/sizeof(impls[0]); i++) {
+        if(sha256_set_impl(impls[i])) {
+            /* Not on this CPU or in this build */
+            continue;
+        }
+        for(len = 0; len < sizeof(input); len += len < 200 ? 1 : 97) {
+            sha256_set_impl(SHA256_IMPL_GENERIC);
+            sha256_init(&ctx);
+            sha256_update(&ctx, input, len);
+            sha256_final(&ctx, expected);
+
+            /* Vary the update size to mix buffered and direct blocks */
+            sha256_set_impl(impls[i]);
+            sha256_init(&ctx);
+            for(offset = 0; offset < len; offset += n) {
+                n = len - offset;
+                if(n > (len % 150) + 1) {
+                    n = (len % 150) + 1;
+                }
+                sha256_update(&ctx, input + offset, n);
+            }
+            sha256_final(&ctx, actual);
+
+            if(memcmp(expected, actual, sizeof(actual))) {
+                return_value = (int_fast32_t)impls[i] * 10000 + (int_fast32_t)len;
+                goto Done;
+            }
+        }
+    }
+
+Done:
+    sha256_set_impl(saved_impl);
+    return return_value;
+}
+
+/*
+ * Public function, see t_cose_crypto_test.h
+ */
+int_fast32_t b_con_sha256_multi_test(void)
+{
+    /* The portable kernel lets short runs narrow to fewer lanes and
+     * SHA-NI doesn't, so try both */
+    static const int single_impls[] = {SHA256_IMPL_GENERIC, SHA256_IMPL_SHANI};
+    static const int lane_counts[]  = {1, 4, 8, 16};
+    static uint8_t   input[SHA256_MAX_LANES][2000];
+    SHA256_CTX       ctx[SHA256_MAX_LANES];
+    SHA256_CTX       expected_ctx[SHA256_MAX_LANES];
+    SHA256_CTX      *ctx_ptrs[SHA256_MAX_LANES];
+    const BYTE      *data[SHA256_MAX_LANES];
+    size_t           len[SHA256_MAX_LANES];
+    uint8_t          hashes[SHA256_MAX_LANES][SHA256_BLOCK_SIZE];
+    BYTE            *hash_ptrs[SHA256_MAX_LANES];
+    uint8_t          expected[SHA256_BLOCK_SIZE];
+    uint32_t         lcg;
+    size_t           s;
+    size_t           l;
+    size_t           n;
+    size_t           i;
+    int              update;
+    int              trial;
+    int              saved_impl;
+    int              saved_lanes;
+    int_fast32_t     return_value;
+
+    for(i = 0; i < SHA256_MAX_LANES; i++) {
+        fill_pseudo_random(input[i], sizeof(input[i]), (uint32_t)i + 1);
+    }
+
+    saved_impl = sha256_get_impl();
+    saved_lanes = sha256_get_mb_lanes();
+    return_value = 0;
+    lcg = 3;
+
+    for(s = 0; s < sizeof(single_impls)/sizeof(single_impls[0]); s++) {
+        if(sha256_set_impl(single_impls[s])) {
+            continue;
+        }
+        for(l = 0; l < sizeof(lane_counts)/sizeof(lane_counts[0]); l++) {
+            if(sha256_set_mb_lanes(lane_counts[l])) {
+                continue;
+            }
+            for(n = 1; n <= SHA256_MAX_LANES; n++) {
+                for(trial = 0; trial < 6; trial++) {
+                    for(i = 0; i < n; i++) {
+                        sha256_init(&ctx[i]);
+                        sha256_init(&expected_ctx[i]);
+                        ctx_ptrs[i] = &ctx[i];
+                        hash_ptrs[i] = hashes[i];
+                    }
+                    /* Three updates of different lengths per message */
+                    for(update = 0; update < 3; update++) {
+                        for(i = 0; i < n; i++) {
+                            lcg = lcg * 1103515245 + 12345;
+                            len[i] = (lcg >> 8) % (trial < 3 ? 150 : 600);
+                            data[i] = input[i] + (lcg >> 20) % 100;
+                            sha256_update(&expected_ctx[i], data[i], len[i]);
+                        }
+                        sha256_update_multi(ctx_ptrs, data, len, n);
+                    }
+                    sha256_final_multi(ctx_ptrs, hash_ptrs, n);
+
+                    for(i = 0; i < n; i++) {
+                        sha256_final(&expected_ctx[i], expected);
+                        if(memcmp(expected, hashes[i], sizeof(expected))) {
+                            return_value = lane_counts[l] * 1000 + (int_fast32_t)n;
+                            goto Done;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+Done:
+    sha256_set_impl(saved_impl);
+    sha256_set_mb_lanes(saved_lanes);
+    return return_value;
+}
+
+/*
+ * Public function, see t_cose_crypto_test.h
+ */
+int_fast32_t b_con_sha512_kernel_test(void)
+{
+    static uint8_t   input[3000];
+    uint32_t         lcg;
+    size_t           i;
+    size_t           len;
+    size_t           offset;
+    size_t           n;
+    int              is_384;
+    void           (*init)(SHA512_CTX *);
+    void           (*final)(SHA512_CTX *, BYTE *);
+    SHA512_CTX       ctx;
+    uint8_t          expected[SHA512_BLOCK_SIZE];
+    uint8_t          actual[SHA512_BLOCK_SIZE];
+    int_fast32_t     return_value;
+    int              saved_impl;
+
+    lcg = 1;
+    for(i = 0; i < sizeof(input); i++) {
+        lcg = lcg * 1103515245 + 12345;
+        input[i] = (uint8_t)(lcg >> 16);
+    }
+
+    saved_impl = sha512_get_impl();
+    return_value = 0;
+
+    if(sha512_set_impl(SHA512_IMPL_AVX2)) {
+        /* Not on this CPU or in this build */
+        goto Done;
+    }
+
+    for(is_384 = 0; is_384 < 2; is_384++) {
+        init  = is_384 ? sha384_init : sha512_init;
+        final = is_384 ? sha384_final : sha512_final;
+        for(len = 0; len < sizeof(input); len += len < 300 ? 1 : 97) {
+            sha512_set_impl(SHA512_IMPL_GENERIC);
+            init(&ctx);
+            sha512_update(&ctx, input, len);
+            final(&ctx, expected);
+
+            /* Vary the update size to mix buffered and direct blocks */
+            sha512_set_impl(SHA512_IMPL_AVX2);
+            init(&ctx);
+            for(offset = 0; offset < len; offset += n) {
+                n = len - offset;
+                if(n > (len % 300) + 1) {
+                    n = (len % 300) + 1;
+                }
+                sha512_update(&ctx, input + offset, n);
+            }
+            final(&ctx, actual);
+
+            if(memcmp(expected, actual, is_384 ? SHA384_BLOCK_SIZE : SHA512_BLOCK_SIZE)) {
+                return_value = (is_384 + 1) * 10000 + (int_fast32_t)len;
+                goto Done;
+            }
+        }
+    }
+
+Done:
+    sha512_set_impl(saved_impl);
+    return return_value;
+}
+
+#endif /* T_COSE_USE_B_CON_SHA256 */
@@ -0,0 +1,81 @@
+/*
+ *  t_cose_crypto_test.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef t_cose_crypto_test_h
+#define t_cose_crypto_test_h
+
+#include <stdint.h>
+
+
+/**
+ * \file t_cose_crypto_test.h
+ *
+ * \brief Tests of the crypto adaptation layer directly, rather than
+ * through COSE_Sign1 signing and verification.
+ */
+
+
+/*
+ * Known-answer tests for the hash functions through
+ * t_cose_crypto_hash_start(), _update() and _finish(), fed in chunks
+ * of various sizes to exercise partial-block handling.
+ */
+int_fast32_t crypto_hash_test(void);
+
+
+/*
+ * Check t_cose_crypto_hash_batch() gives the same hashes as hashing
+ * each message by itself.
+ */
+int_fast32_t crypto_hash_batch_test(void);
+
+
+/*
+ * t_cose_warmup() succeeds, can be called again and hashing works
+ * after it. With OpenSSL 3 it is also run with its own library
+ * context.
+ */
+int_fast32_t crypto_warmup_test(void);
+
+
+#ifndef T_COSE_DISABLE_HASH_FILE
+/*
+ * Hash temporary files with t_cose_hash_files(), including an empty
+ * one and missing ones, in more than one group.
+ */
+int_fast32_t hash_file_test(void);
+#endif /* T_COSE_DISABLE_HASH_FILE */
+
+
+#ifdef T_COSE_USE_B_CON_SHA256
+/*
+ * Check that every SHA-256 kernel in the bundled hash
+ * implementation that this CPU supports gives the same output as the
+ * portable C one.
+ */
+int_fast32_t b_con_sha256_kernel_test(void);
+
+
+/*
+ * Check the multi-buffer hashing in the bundled SHA-256 with each
+ * lane count against hashing one message at a time.
+ */
+int_fast32_t b_con_sha256_multi_test(void);
+
+
+/*
+ * Same as b_con_sha256_kernel_test() for the bundled SHA-512 with
+ * SHA-384 as well.
+ */
+int_fast32_t b_con_sha512_kernel_test(void);
+#endif /* T_COSE_USE_B_CON_SHA256 */
+
+
+#endif /* t_cose_crypto_test_h */
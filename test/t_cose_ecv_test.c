@@ -0,0 +1,410 @@
+/*
+ *  t_cose_ecv_test.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "t_cose_ecv_test.h"
+#include "ecv.h"
+#include "p256.h"
+#include "t_cose_crypto.h"
+#include "t_cose_make_test_pub_key.h"
+#include <string.h>
+
+
+/* RFC 6979 appendix A.2.5, P-256 with SHA-256 */
+static const uint8_t p256_public[] = {
+    0x04,
+    0x60, 0xfe, 0xd4, 0xba, 0x25, 0x5a, 0x9d, 0x31, 0xc9, 0x61, 0xeb, 0x74, 0xc6, 0x35, 0x6d, 0x68,
+    0xc0, 0x49, 0xb8, 0x92, 0x3b, 0x61, 0xfa, 0x6c, 0xe6, 0x69, 0x62, 0x2e, 0x60, 0xf2, 0x9f, 0xb6,
+    0x79, 0x03, 0xfe, 0x10, 0x08, 0xb8, 0xbc, 0x99, 0xa4, 0x1a, 0xe9, 0xe9, 0x56, 0x28, 0xbc, 0x64,
+    0xf2, 0xf1, 0xb2, 0x0c, 0x2d, 0x7e, 0x9f, 0x51, 0x77, 0xa3, 0xc2, 0x94, 0xd4, 0x46, 0x22, 0x99
+};
+
+static const uint8_t p256_hashes[2][32] = {
+    /* Message "sample" */
+    {0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+     0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15, 0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf},
+    /* Message "test" */
+    {0x9f, 0x86, 0xd0, 0x81, 0x88, 0x4c, 0x7d, 0x65, 0x9a, 0x2f, 0xea, 0xa0, 0xc5, 0x5a, 0xd0, 0x15,
+     0xa3, 0xbf, 0x4f, 0x1b, 0x2b, 0x0b, 0x82, 0x2c, 0xd1, 0x5d, 0x6c, 0x15, 0xb0, 0xf0, 0x0a, 0x08}
+};
+
+static const uint8_t p256_signatures[2][64] = {
+    {0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd, 0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+     0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91, 0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+     0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41, 0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+     0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06, 0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8},
+    {0xf1, 0xab, 0xb0, 0x23, 0x51, 0x83, 0x51, 0xcd, 0x71, 0xd8, 0x81, 0x56, 0x7b, 0x1e, 0xa6, 0x63,
+     0xed, 0x3e, 0xfc, 0xf6, 0xc5, 0x13, 0x2b, 0x35, 0x4f, 0x28, 0xd3, 0xb0, 0xb7, 0xd3, 0x83, 0x67,
+     0x01, 0x9f, 0x41, 0x13, 0x74, 0x2a, 0x2b, 0x14, 0xbd, 0x25, 0x92, 0x6b, 0x49, 0xc6, 0x49, 0x15,
+     0x5f, 0x26, 0x7e, 0x60, 0xd3, 0x81, 0x4b, 0x4c, 0x0c, 0xc8, 0x42, 0x50, 0xe4, 0x6f, 0x00, 0x83}
+};
+
+/* The P-256 group order n */
+static const uint8_t p256_order[] = {
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51
+};
+
+
+/* A P-384 key and a signature with SHA-384 over "sample", made with
+ * OpenSSL */
+static const uint8_t p384_public[] = {
+    0x04, 0xf8, 0xf8, 0xf3, 0x74, 0xb9, 0x62, 0xda, 0x1d, 0x4d, 0x80, 0x46, 0x7b, 0x7d, 0x44, 0x18,
+    0xaa, 0x39, 0x3a, 0x01, 0x2b, 0x9b, 0x7f, 0x13, 0x10, 0x12, 0x5c, 0x2f, 0x71, 0x19, 0x39, 0x8a,
+    0x85, 0x93, 0xce, 0xeb, 0x38, 0xef, 0xde, 0x45, 0x66, 0xc9, 0x0e, 0x99, 0x23, 0x5e, 0x64, 0x05,
+    0x66, 0xb0, 0xc9, 0xb3, 0xdb, 0x02, 0x60, 0xd8, 0x03, 0xf7, 0xab, 0x77, 0xd3, 0x99, 0x20, 0x2f,
+    0xe1, 0x26, 0xcb, 0x83, 0xee, 0x36, 0x0b, 0x89, 0xab, 0xb9, 0x14, 0x23, 0x6e, 0x2a, 0x3f, 0xc1,
+    0x42, 0xb7, 0x55, 0x45, 0x4a, 0x34, 0x6f, 0xa7, 0x97, 0xf6, 0xda, 0xd1, 0x55, 0x62, 0xb6, 0x01,
+    0x42
+};
+
+static const uint8_t p384_hash[] = {
+    0x9a, 0x90, 0x83, 0x50, 0x5b, 0xc9, 0x22, 0x76, 0xae, 0xc4, 0xbe, 0x31, 0x26, 0x96, 0xef, 0x7b,
+    0xf3, 0xbf, 0x60, 0x3f, 0x4b, 0xbd, 0x38, 0x11, 0x96, 0xa0, 0x29, 0xf3, 0x40, 0x58, 0x53, 0x12,
+    0x31, 0x3b, 0xca, 0x4a, 0x9b, 0x5b, 0x89, 0x0e, 0xfe, 0xe4, 0x2c, 0x77, 0xb1, 0xee, 0x25, 0xfe
+};
+
+static const uint8_t p384_signature[] = {
+    0x28, 0xf8, 0x5d, 0x7f, 0xfa, 0x07, 0x88, 0xa8, 0x03, 0xfe, 0x15, 0x31, 0xa4, 0x67, 0x53, 0xdd,
+    0xad, 0xc8, 0x64, 0x30, 0x66, 0x0e, 0xca, 0x27, 0x77, 0x57, 0x84, 0x01, 0x5b, 0x36, 0x63, 0x25,
+    0x51, 0xaa, 0x98, 0x79, 0xa2, 0x10, 0x4b, 0x13, 0x90, 0x57, 0xd6, 0x71, 0x2d, 0x2a, 0x4b, 0x40,
+    0x72, 0xe8, 0x1f, 0xfc, 0x56, 0xc9, 0x66, 0xa6, 0x64, 0xa0, 0x12, 0x4d, 0x76, 0x2f, 0x32, 0x01,
+    0xcc, 0xc8, 0x81, 0x33, 0xac, 0x2d, 0x76, 0xd7, 0xd2, 0x91, 0xd2, 0xed, 0x40, 0xa6, 0x04, 0xe1,
+    0x7b, 0x4c, 0xf6, 0xdb, 0x8b, 0x9a, 0xdb, 0x21, 0x0a, 0x1d, 0xfa, 0x54, 0xa3, 0xe1, 0x37, 0x81
+};
+
+
+/*
+ * Public function, see t_cose_ecv_test.h
+ */
+int_fast32_t ecv_kat_test(void)
+{
+    struct ecv_key key;
+    uint8_t        point[ECV_P384_PUBLIC_KEY_SIZE];
+    uint8_t        signature[ECV_P384_PUBLIC_KEY_SIZE - 1];
+    uint8_t        long_hash[64];
+    size_t         i;
+
+    /* P-256 */
+    if(ecv_key_init(&key, ECV_P256, p256_public, sizeof(p256_public))) {
+        return 1;
+    }
+    for(i = 0; i < 2; i++) {
+        if(ecv_verify(&key, p256_hashes[i], 32, p256_signatures[i], 64)) {
+            return (int_fast32_t)(10 + i * 10);
+        }
+        /* Wrong hash */
+        if(ecv_verify(&key, p256_hashes[1 - i], 32,
+                      p256_signatures[i], 64) != ECV_ERR_BAD_SIGNATURE) {
+            return (int_fast32_t)(11 + i * 10);
+        }
+        /* Modified r and modified s */
+        memcpy(signature, p256_signatures[i], 64);
+        signature[3] ^= 0x10;
+        if(ecv_verify(&key, p256_hashes[i], 32, signature, 64) != ECV_ERR_BAD_SIGNATURE) {
+            return (int_fast32_t)(12 + i * 10);
+        }
+        memcpy(signature, p256_signatures[i], 64);
+        signature[63] ^= 0x01;
+        if(ecv_verify(&key, p256_hashes[i], 32, signature, 64) != ECV_ERR_BAD_SIGNATURE) {
+            return (int_fast32_t)(13 + i * 10);
+        }
+        /* Wrong length */
+        if(ecv_verify(&key, p256_hashes[i], 32,
+                      p256_signatures[i], 63) != ECV_ERR_BAD_SIGNATURE) {
+            return (int_fast32_t)(14 + i * 10);
+        }
+    }
+
+    /* A hash longer than the curve is truncated to its leftmost bytes */
+    memcpy(long_hash, p256_hashes[0], 32);
+    memset(long_hash + 32, 0xa5, 32);
+    if(ecv_verify(&key, long_hash, sizeof(long_hash), p256_signatures[0], 64)) {
+        return 30;
+    }
+
+    /* r and s must be in [1, n-1] */
+    memset(signature, 0, 32);
+    memcpy(signature + 32, p256_signatures[0] + 32, 32);
+    if(ecv_verify(&key, p256_hashes[0], 32, signature, 64) != ECV_ERR_BAD_SIGNATURE) {
+        return 31;
+    }
+    memcpy(signature, p256_signatures[0], 32);
+    memcpy(signature + 32, p256_order, 32);
+    if(ecv_verify(&key, p256_hashes[0], 32, signature, 64) != ECV_ERR_BAD_SIGNATURE) {
+        return 32;
+    }
+
+    /* P-384 */
+    if(ecv_key_init(&key, ECV_P384, p384_public, sizeof(p384_public))) {
+        return 40;
+    }
+    if(ecv_verify(&key, p384_hash, sizeof(p384_hash),
+                  p384_signature, sizeof(p384_signature))) {
+        return 41;
+    }
+    memcpy(signature, p384_signature, sizeof(p384_signature));
+    signature[90] ^= 0x80;
+    if(ecv_verify(&key, p384_hash, sizeof(p384_hash),
+                  signature, sizeof(p384_signature)) != ECV_ERR_BAD_SIGNATURE) {
+        return 42;
+    }
+    if(ecv_verify(&key, p256_hashes[0], 32,
+                  p384_signature, sizeof(p384_signature)) != ECV_ERR_BAD_SIGNATURE) {
+        return 43;
+    }
+
+    /* Invalid keys */
+    if(ecv_key_init(&key, ECV_P384, p256_public, sizeof(p256_public)) != ECV_ERR_INVALID_KEY) {
+        return 50;
+    }
+    if(ecv_key_init(&key, 99, p256_public, sizeof(p256_public)) != ECV_ERR_UNSUPPORTED_CURVE) {
+        return 51;
+    }
+    memcpy(point, p256_public, sizeof(p256_public));
+    point[0] = 0x02;
+    if(ecv_key_init(&key, ECV_P256, point, sizeof(p256_public)) != ECV_ERR_INVALID_KEY) {
+        return 52;
+    }
+    /* Not on the curve */
+    memcpy(point, p256_public, sizeof(p256_public));
+    point[64] ^= 0x01;
+    if(ecv_key_init(&key, ECV_P256, point, sizeof(p256_public)) != ECV_ERR_INVALID_KEY) {
+        return 53;
+    }
+    /* x not less than p */
+    memset(point + 1, 0xff, 32);
+    if(ecv_key_init(&key, ECV_P256, point, sizeof(p256_public)) != ECV_ERR_INVALID_KEY) {
+        return 54;
+    }
+    memcpy(point, p384_public, sizeof(p384_public));
+    point[20] ^= 0x04;
+    if(ecv_key_init(&key, ECV_P384, point, sizeof(p384_public)) != ECV_ERR_INVALID_KEY) {
+        return 55;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_ecv_test.h
+ */
+int_fast32_t ecv_cache_test(void)
+{
+    static struct ecv_cache_entry entries[2 * ECV_CACHE_WAYS];
+    struct ecv_cache              cache;
+    const struct ecv_key         *key;
+    const struct ecv_key         *first;
+    struct p256_key               p256;
+    uint8_t                       private_key[P256_PRIVATE_KEY_SIZE];
+    uint8_t                       points[ECV_CACHE_WAYS + 1][P256_PUBLIC_KEY_SIZE];
+    int                           i;
+
+    if(ecv_cache_init(&cache, entries, 0) != ECV_ERR_INVALID_ARG ||
+       ecv_cache_init(&cache, entries, ECV_CACHE_WAYS + 1) != ECV_ERR_INVALID_ARG ||
+       ecv_cache_init(&cache, entries, 3 * ECV_CACHE_WAYS) != ECV_ERR_INVALID_ARG) {
+        return 1;
+    }
+    if(ecv_cache_init(&cache, entries, 2 * ECV_CACHE_WAYS)) {
+        return 2;
+    }
+
+    /* Miss then hit */
+    if(ecv_cache_get(&cache, ECV_P256, (const uint8_t *)"dev1", 4,
+                     p256_public, sizeof(p256_public), &first)) {
+        return 10;
+    }
+    if(ecv_cache_get(&cache, ECV_P256, (const uint8_t *)"dev1", 4,
+                     p256_public, sizeof(p256_public), &key)) {
+        return 11;
+    }
+    if(key != first || cache.hits != 1 || cache.misses != 1) {
+        return 12;
+    }
+    if(ecv_verify(key, p256_hashes[0], 32, p256_signatures[0], 64)) {
+        return 13;
+    }
+
+    /* The same kid with a different key is not a hit */
+    if(ecv_cache_get(&cache, ECV_P384, (const uint8_t *)"dev1", 4,
+                     p384_public, sizeof(p384_public), &key)) {
+        return 20;
+    }
+    if(cache.misses != 2) {
+        return 21;
+    }
+    if(ecv_verify(key, p384_hash, sizeof(p384_hash),
+                  p384_signature, sizeof(p384_signature))) {
+        return 22;
+    }
+
+    /* No kid */
+    if(ecv_cache_get(&cache, ECV_P256, NULL, 0,
+                     p256_public, sizeof(p256_public), &key) ||
+       ecv_cache_get(&cache, ECV_P256, NULL, 0,
+                     p256_public, sizeof(p256_public), &key)) {
+        return 30;
+    }
+    if(cache.misses > 3 || ecv_verify(key, p256_hashes[1], 32, p256_signatures[1], 64)) {
+        return 31;
+    }
+
+    /* An invalid key is an error and isn't cached */
+    memcpy(points[0], p256_public, sizeof(p256_public));
+    points[0][40] ^= 0x01;
+    if(ecv_cache_get(&cache, ECV_P256, NULL, 0,
+                     points[0], sizeof(points[0]), &key) != ECV_ERR_INVALID_KEY) {
+        return 32;
+    }
+
+    /* One set of ECV_CACHE_WAYS entries evicts the least recently used */
+    if(ecv_cache_init(&cache, entries, ECV_CACHE_WAYS)) {
+        return 40;
+    }
+    memset(private_key, 0, sizeof(private_key));
+    for(i = 0; i <= ECV_CACHE_WAYS; i++) {
+        private_key[31] = (uint8_t)(i + 1);
+        if(p256_key_from_private(&p256, private_key)) {
+            return 41;
+        }
+        p256_key_public(&p256, points[i]);
+        p256_key_wipe(&p256);
+    }
+    for(i = 0; i < ECV_CACHE_WAYS; i++) {
+        if(ecv_cache_get(&cache, ECV_P256, NULL, 0, points[i], P256_PUBLIC_KEY_SIZE, &key)) {
+            return 42;
+        }
+    }
+    /* Use the first so the second is the oldest */
+    if(ecv_cache_get(&cache, ECV_P256, NULL, 0, points[0], P256_PUBLIC_KEY_SIZE, &key) ||
+       cache.hits != 1) {
+        return 43;
+    }
+    if(ecv_cache_get(&cache, ECV_P256, NULL, 0,
+                     points[ECV_CACHE_WAYS], P256_PUBLIC_KEY_SIZE, &key) ||
+       cache.misses != ECV_CACHE_WAYS + 1) {
+        return 44;
+    }
+    if(ecv_cache_get(&cache, ECV_P256, NULL, 0, points[0], P256_PUBLIC_KEY_SIZE, &key) ||
+       cache.hits != 2) {
+        return 45;
+    }
+    if(ecv_cache_get(&cache, ECV_P256, NULL, 0, points[1], P256_PUBLIC_KEY_SIZE, &key) ||
+       cache.misses != ECV_CACHE_WAYS + 2) {
+        return 46;
+    }
+
+    ecv_cache_clear(&cache);
+    if(cache.hits || cache.misses) {
+        return 50;
+    }
+    if(ecv_cache_get(&cache, ECV_P256, NULL, 0, points[0], P256_PUBLIC_KEY_SIZE, &key) ||
+       cache.misses != 1) {
+        return 51;
+    }
+
+    return 0;
+}
+
+
+/* Sign and verify with one algorithm, with and without the cache */
+static int_fast32_t adapter_sign_verify(int32_t cose_algorithm_id, struct ecv_cache *cache)
+{
+    struct t_cose_key           key_pair;
+    MakeUsefulBufOnStack(       sig_buf, T_COSE_MAX_ECDSA_SIG_SIZE);
+    uint8_t                     tampered_buf[T_COSE_MAX_ECDSA_SIG_SIZE];
+    struct q_useful_buf_c       sig;
+    struct q_useful_buf_c       tampered;
+    const struct q_useful_buf_c kid = Q_USEFUL_BUF_FROM_SZ_LITERAL("kid-1");
+    const struct q_useful_buf_c hash = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(p256_hashes[0]);
+    int_fast32_t                return_value;
+
+    if(make_key_pair(cose_algorithm_id, &key_pair)) {
+        return 1;
+    }
+
+    if(t_cose_crypto_sign(cose_algorithm_id, key_pair, hash, sig_buf, &sig)) {
+        return_value = 2;
+        goto Done;
+    }
+    memcpy(tampered_buf, sig.ptr, sig.len);
+    tampered_buf[sig.len - 1] ^= 0x01;
+    tampered = (struct q_useful_buf_c){tampered_buf, sig.len};
+
+    /* Without a cache */
+    ecv_set_thread_cache(NULL);
+    if(t_cose_crypto_verify(cose_algorithm_id, key_pair, kid, hash, sig)) {
+        return_value = 3;
+        goto Done;
+    }
+
+    /* With a cache, a miss then a hit */
+    ecv_cache_clear(cache);
+    ecv_set_thread_cache(cache);
+    if(t_cose_crypto_verify(cose_algorithm_id, key_pair, kid, hash, sig) ||
+       t_cose_crypto_verify(cose_algorithm_id, key_pair, kid, hash, sig)) {
+        return_value = 4;
+        goto Done;
+    }
+    if(cache->misses != 1 || cache->hits != 1) {
+        return_value = 5;
+        goto Done;
+    }
+    if(t_cose_crypto_verify(cose_algorithm_id, key_pair, kid, hash, tampered) != T_COSE_ERR_SIG_VERIFY) {
+        return_value = 6;
+        goto Done;
+    }
+    sig.len--;
+    if(t_cose_crypto_verify(cose_algorithm_id, key_pair, kid, hash, sig) != T_COSE_ERR_SIG_VERIFY) {
+        return_value = 7;
+        goto Done;
+    }
+    sig.len++;
+    if(t_cose_crypto_verify(cose_algorithm_id, key_pair, NULL_Q_USEFUL_BUF_C, hash, sig)) {
+        return_value = 8;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    ecv_set_thread_cache(NULL);
+    free_key_pair(key_pair);
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_ecv_test.h
+ */
+int_fast32_t ecv_adapter_test(void)
+{
+    static struct ecv_cache_entry entries[ECV_CACHE_WAYS];
+    struct ecv_cache              cache;
+    int_fast32_t                  return_value;
+
+    if(ecv_cache_init(&cache, entries, ECV_CACHE_WAYS)) {
+        return 1;
+    }
+
+    return_value = adapter_sign_verify(T_COSE_ALGORITHM_ES256, &cache);
+    if(return_value) {
+        return 10 + return_value;
+    }
+
+#if defined(T_COSE_USE_OPENSSL_CRYPTO) && !defined(T_COSE_DISABLE_ES384)
+    return_value = adapter_sign_verify(T_COSE_ALGORITHM_ES384, &cache);
+    if(return_value) {
+        return 20 + return_value;
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+/*
+ *  t_cose_ecv_test.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef t_cose_ecv_test_h
+#define t_cose_ecv_test_h
+
+#include <stdint.h>
+
+
+/**
+ * \file t_cose_ecv_test.h
+ *
+ * \brief Tests of the verification engine with per-key tables. These
+ * are built with T_COSE_USE_ECV_VERIFY, which is set for the built-in
+ * and the OpenSSL crypto providers.
+ */
+
+
+/*
+ * Verify known signatures on P-256 and P-384 and reject invalid keys,
+ * tampered signatures, out-of-range r and s and wrong hashes.
+ */
+int_fast32_t ecv_kat_test(void);
+
+
+/*
+ * Cache hits and misses, a kid reused with a different key, a
+ * missing kid and least recently used eviction.
+ */
+int_fast32_t ecv_cache_test(void);
+
+
+/*
+ * Sign through the crypto adapter and verify through it with and
+ * without a key cache installed for the thread.
+ */
+int_fast32_t ecv_adapter_test(void);
+
+
+#endif /* t_cose_ecv_test_h */
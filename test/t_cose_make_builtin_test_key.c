@@ -0,0 +1,82 @@
+/*
+ *  t_cose_make_builtin_test_key.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "t_cose_make_test_pub_key.h" /* The interface implemented here */
+#include "p256.h"
+#include <stdlib.h>
+
+
+/*
+ * The private scalar of the P-256 key in t_cose_make_openssl_test_key.c
+ * and t_cose_make_psa_test_key.c so known-good messages made with
+ * those verify here.
+ */
+static const uint8_t ec256_private_key[] = {
+    0xd9, 0xb5, 0xe7, 0x1f, 0x77, 0x28, 0xbf, 0xe5,
+    0x63, 0xa9, 0xdc, 0x93, 0x75, 0x62, 0x27, 0x7e,
+    0x32, 0x7d, 0x98, 0xd9, 0x94, 0x80, 0xf3, 0xdc,
+    0x92, 0x41, 0xe5, 0x74, 0x2a, 0xc4, 0x58, 0x89
+};
+
+
+static int key_pair_count = 0;
+
+
+/*
+ * Public function, see t_cose_make_test_pub_key.h
+ */
+/*
+ * The key object returned by this is malloced and has to be freed by
+ * by calling free_key_pair().
+ */
+enum t_cose_err_t make_key_pair(int32_t            cose_algorithm_id,
+                                struct t_cose_key *key_pair)
+{
+    struct p256_key *key;
+
+    if(cose_algorithm_id != T_COSE_ALGORITHM_ES256) {
+        return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
+    }
+
+    key = malloc(sizeof(struct p256_key));
+    if(key == NULL) {
+        return T_COSE_ERR_INSUFFICIENT_MEMORY;
+    }
+    if(p256_key_from_private(key, ec256_private_key)) {
+        free(key);
+        return T_COSE_ERR_FAIL;
+    }
+
+    key_pair->crypto_lib = T_COSE_CRYPTO_LIB_BUILTIN;
+    key_pair->k.key_ptr  = key;
+    key_pair_count++;
+
+    return T_COSE_SUCCESS;
+}
+
+
+/*
+ * Public function, see t_cose_make_test_pub_key.h
+ */
+void free_key_pair(struct t_cose_key key_pair)
+{
+    p256_key_wipe(key_pair.k.key_ptr);
+    free(key_pair.k.key_ptr);
+    key_pair_count--;
+}
+
+
+/*
+ * Public function, see t_cose_make_test_pub_key.h
+ */
+int check_for_key_pair_leaks(void)
+{
+    return key_pair_count;
+}
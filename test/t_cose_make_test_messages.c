@@ -418,6 +418,9 @@ add_unprotected_parameters(uint32_t              test_message_options,
  */
 static uint8_t s_protected_params[40];
 
+/* The encoded protected parameters in s_protected_params, if any */
+static struct q_useful_buf_c s_protected_parameters;
+
 /**
  * Replica of t_cose_sign1_encode_parameters() with modifications to
  * output various good and bad messages for testing verification.
@@ -436,13 +439,13 @@ t_cose_sign1_test_message_encode_parameters(struct t_cose_sign1_sign_ctx *me,
     /* Check the cose_algorithm_id now by getting the hash alg as an early
      * error check even though it is not used until later.
      */
-    hash_alg_id = hash_alg_id_from_sig_alg_id(me->cose_algorithm_id);
+    hash_alg_id = hash_alg_id_from_sig_alg_id(me->signer.cose_algorithm_id);
     if(hash_alg_id == T_COSE_INVALID_ALGORITHM_ID) {
         return T_COSE_ERR_UNSUPPORTED_SIGNING_ALG;
     }
 
     /* Add the CBOR tag indicating COSE_Sign1 */
-    if(!(me->option_flags & T_COSE_OPT_OMIT_CBOR_TAG)) {
+    if(!(me->signer.option_flags & T_COSE_OPT_OMIT_CBOR_TAG)) {
         QCBOREncode_AddTag(cbor_encode_ctx, CBOR_TAG_COSE_SIGN1);
     }
 
@@ -455,26 +458,27 @@ t_cose_sign1_test_message_encode_parameters(struct t_cose_sign1_sign_ctx *me,
     }
 
     /* The protected parameters, which are added as a wrapped bstr  */
+    s_protected_parameters = NULL_Q_USEFUL_BUF_C;
     if( ! (test_mess_options & T_COSE_TEST_NO_PROTECTED_PARAMETERS)) {
         buffer_for_protected_parameters = Q_USEFUL_BUF_FROM_BYTE_ARRAY(s_protected_params);
 
-        me->protected_parameters = encode_protected_parameters(test_mess_options,
-                                                               me->cose_algorithm_id,
-                                                               buffer_for_protected_parameters);
-        QCBOREncode_AddBytes(cbor_encode_ctx, me->protected_parameters);
+        s_protected_parameters = encode_protected_parameters(test_mess_options,
+                                                             me->signer.cose_algorithm_id,
+                                                             buffer_for_protected_parameters);
+        QCBOREncode_AddBytes(cbor_encode_ctx, s_protected_parameters);
     }
 
     /* The Unprotected parameters */
     /* Get the key id because it goes into the parameters that are about
      to be made. */
-    if(me->option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG) {
+    if(me->signer.option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG) {
 #ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
         kid = get_short_circuit_kid();
 #else
         return T_COSE_ERR_SHORT_CIRCUIT_SIG_DISABLED;
 #endif
     } else {
-        kid = me->kid;
+        kid = me->signer.kid;
     }
 
     if( ! (test_mess_options & T_COSE_TEST_NO_UNPROTECTED_PARAMETERS)) {
@@ -544,8 +548,8 @@ t_cose_sign1_test_message_output_signature(struct t_cose_sign1_sign_ctx *me,
      * cose_algorithm_id was checked in t_cose_sign1_init() so it
      * doesn't need to be checked here.
      */
-    return_value = create_tbs_hash(me->cose_algorithm_id,
-                                   me->protected_parameters,
+    return_value = create_tbs_hash(me->signer.cose_algorithm_id,
+                                   s_protected_parameters,
                                    NULL_Q_USEFUL_BUF_C,
                                    signed_payload,
                                    buffer_for_tbs_hash,
@@ -571,16 +575,16 @@ t_cose_sign1_test_message_output_signature(struct t_cose_sign1_sign_ctx *me,
      * public key operation and requires no key. It is just a test
      * mode that always works.
      */
-    if(!(me->option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG)) {
+    if(!(me->signer.option_flags & T_COSE_OPT_SHORT_CIRCUIT_SIG)) {
         /* Normal, non-short-circuit signing */
-        return_value = t_cose_crypto_sign(me->cose_algorithm_id,
-                                          me->signing_key,
+        return_value = t_cose_crypto_sign(me->signer.cose_algorithm_id,
+                                          me->signer.signing_key,
                                           tbs_hash,
                                           buffer_for_signature,
                                          &signature);
     } else {
 #ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
-        return_value = short_circuit_sign(me->cose_algorithm_id,
+        return_value = short_circuit_sign(me->signer.cose_algorithm_id,
                                           tbs_hash,
                                           buffer_for_signature,
                                           &signature);
@@ -656,3 +660,31 @@ Done:
     return return_value;
 }
 
+
+
+/*
+ * Public function. See t_cose_make_test_messages.h
+ */
+enum t_cose_err_t
+t_cose_test_message_sign1_from_parts(struct q_useful_buf_c  protected_parameters,
+                                     struct q_useful_buf_c  unprotected_parameters,
+                                     struct q_useful_buf_c  payload,
+                                     struct q_useful_buf_c  signature,
+                                     struct q_useful_buf    out_buf,
+                                     struct q_useful_buf_c *result)
+{
+    QCBOREncodeContext encode_context;
+
+    QCBOREncode_Init(&encode_context, out_buf);
+    QCBOREncode_OpenArray(&encode_context);
+    QCBOREncode_AddBytes(&encode_context, protected_parameters);
+    QCBOREncode_AddEncoded(&encode_context, unprotected_parameters);
+    QCBOREncode_AddBytes(&encode_context, payload);
+    QCBOREncode_AddBytes(&encode_context, signature);
+    QCBOREncode_CloseArray(&encode_context);
+
+    if(QCBOREncode_Finish(&encode_context, result)) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    return T_COSE_SUCCESS;
+}
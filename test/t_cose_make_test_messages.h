@@ -146,6 +146,20 @@ t_cose_test_message_sign1_sign(struct t_cose_sign1_sign_ctx *me,
                                struct q_useful_buf_c        *result);
 
 
+/**
+ * Put together a \c COSE_Sign1 from its parts, for example to give a
+ * signed message unprotected parameters t_cose doesn't make, like
+ * x5chain. \c unprotected_parameters is the encoded map.
+ */
+enum t_cose_err_t
+t_cose_test_message_sign1_from_parts(struct q_useful_buf_c  protected_parameters,
+                                     struct q_useful_buf_c  unprotected_parameters,
+                                     struct q_useful_buf_c  payload,
+                                     struct q_useful_buf_c  signature,
+                                     struct q_useful_buf    out_buf,
+                                     struct q_useful_buf_c *result);
+
+
 #ifdef __cplusplus
 }
 #endif
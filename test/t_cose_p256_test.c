@@ -0,0 +1,413 @@
+/*
+ *  t_cose_p256_test.c
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#include "t_cose_p256_test.h"
+#include "p256.h"
+#include <string.h>
+
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+#include "t_cose_crypto.h"
+#include "t_cose_make_test_pub_key.h"
+#endif
+
+
+/* RFC 6979 appendix A.2.5, P-256 */
+static const uint8_t rfc6979_private[] = {
+    0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16, 0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+    0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12, 0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21
+};
+
+static const uint8_t rfc6979_public[] = {
+    0x04,
+    0x60, 0xfe, 0xd4, 0xba, 0x25, 0x5a, 0x9d, 0x31, 0xc9, 0x61, 0xeb, 0x74, 0xc6, 0x35, 0x6d, 0x68,
+    0xc0, 0x49, 0xb8, 0x92, 0x3b, 0x61, 0xfa, 0x6c, 0xe6, 0x69, 0x62, 0x2e, 0x60, 0xf2, 0x9f, 0xb6,
+    0x79, 0x03, 0xfe, 0x10, 0x08, 0xb8, 0xbc, 0x99, 0xa4, 0x1a, 0xe9, 0xe9, 0x56, 0x28, 0xbc, 0x64,
+    0xf2, 0xf1, 0xb2, 0x0c, 0x2d, 0x7e, 0x9f, 0x51, 0x77, 0xa3, 0xc2, 0x94, 0xd4, 0x46, 0x22, 0x99
+};
+
+struct p256_kat {
+    uint8_t hash[32];
+    uint8_t k[32];
+    uint8_t signature[64];
+};
+
+static const struct p256_kat rfc6979_kats[] = {
+    /* SHA-256, message "sample" */
+    {
+        {0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+         0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15, 0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf},
+        {0xa6, 0xe3, 0xc5, 0x7d, 0xd0, 0x1a, 0xbe, 0x90, 0x08, 0x65, 0x38, 0x39, 0x83, 0x55, 0xdd, 0x4c,
+         0x3b, 0x17, 0xaa, 0x87, 0x33, 0x82, 0xb0, 0xf2, 0x4d, 0x61, 0x29, 0x49, 0x3d, 0x8a, 0xad, 0x60},
+        {0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd, 0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+         0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91, 0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+         0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41, 0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+         0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06, 0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8}
+    },
+    /* SHA-256, message "test" */
+    {
+        {0x9f, 0x86, 0xd0, 0x81, 0x88, 0x4c, 0x7d, 0x65, 0x9a, 0x2f, 0xea, 0xa0, 0xc5, 0x5a, 0xd0, 0x15,
+         0xa3, 0xbf, 0x4f, 0x1b, 0x2b, 0x0b, 0x82, 0x2c, 0xd1, 0x5d, 0x6c, 0x15, 0xb0, 0xf0, 0x0a, 0x08},
+        {0xd1, 0x6b, 0x6a, 0xe8, 0x27, 0xf1, 0x71, 0x75, 0xe0, 0x40, 0x87, 0x1a, 0x1c, 0x7e, 0xc3, 0x50,
+         0x01, 0x92, 0xc4, 0xc9, 0x26, 0x77, 0x33, 0x6e, 0xc2, 0x53, 0x7a, 0xca, 0xee, 0x00, 0x08, 0xe0},
+        {0xf1, 0xab, 0xb0, 0x23, 0x51, 0x83, 0x51, 0xcd, 0x71, 0xd8, 0x81, 0x56, 0x7b, 0x1e, 0xa6, 0x63,
+         0xed, 0x3e, 0xfc, 0xf6, 0xc5, 0x13, 0x2b, 0x35, 0x4f, 0x28, 0xd3, 0xb0, 0xb7, 0xd3, 0x83, 0x67,
+         0x01, 0x9f, 0x41, 0x13, 0x74, 0x2a, 0x2b, 0x14, 0xbd, 0x25, 0x92, 0x6b, 0x49, 0xc6, 0x49, 0x15,
+         0x5f, 0x26, 0x7e, 0x60, 0xd3, 0x81, 0x4b, 0x4c, 0x0c, 0xc8, 0x42, 0x50, 0xe4, 0x6f, 0x00, 0x83}
+    }
+};
+
+
+/* The group order n */
+static const uint8_t p256_order[] = {
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51
+};
+
+
+/*
+ * Public function, see t_cose_p256_test.h
+ */
+int_fast32_t p256_kat_test(void)
+{
+    struct p256_key key;
+    struct p256_key public_key;
+    uint8_t         point[P256_PUBLIC_KEY_SIZE];
+    uint8_t         signature[P256_SIGNATURE_SIZE];
+    uint8_t         scalar[P256_PRIVATE_KEY_SIZE];
+    size_t          i;
+
+    if(p256_key_from_private(&key, rfc6979_private)) {
+        return 1;
+    }
+    p256_key_public(&key, point);
+    if(memcmp(point, rfc6979_public, sizeof(point))) {
+        return 2;
+    }
+    if(p256_key_from_public(&public_key, rfc6979_public)) {
+        return 3;
+    }
+
+    for(i = 0; i < sizeof(rfc6979_kats) / sizeof(rfc6979_kats[0]); i++) {
+        if(p256_sign_with_nonce(&key,
+                                rfc6979_kats[i].hash, sizeof(rfc6979_kats[i].hash),
+                                rfc6979_kats[i].k,
+                                signature)) {
+            return (int_fast32_t)(10 + i * 10);
+        }
+        if(memcmp(signature, rfc6979_kats[i].signature, sizeof(signature))) {
+            return (int_fast32_t)(11 + i * 10);
+        }
+        if(p256_verify(&public_key,
+                       rfc6979_kats[i].hash, sizeof(rfc6979_kats[i].hash),
+                       signature)) {
+            return (int_fast32_t)(12 + i * 10);
+        }
+        /* The RFC 6979 nonce is derived rather than given */
+        if(p256_sign_deterministic(&key,
+                                   rfc6979_kats[i].hash, sizeof(rfc6979_kats[i].hash),
+                                   signature)) {
+            return (int_fast32_t)(18 + i * 10);
+        }
+        if(memcmp(signature, rfc6979_kats[i].signature, sizeof(signature))) {
+            return (int_fast32_t)(19 + i * 10);
+        }
+        /* A random nonce gives a different signature that verifies */
+        if(p256_sign(&key, rfc6979_kats[i].hash, sizeof(rfc6979_kats[i].hash), signature)) {
+            return (int_fast32_t)(13 + i * 10);
+        }
+        if(!memcmp(signature, rfc6979_kats[i].signature, sizeof(signature))) {
+            return (int_fast32_t)(14 + i * 10);
+        }
+        if(p256_verify(&public_key,
+                       rfc6979_kats[i].hash, sizeof(rfc6979_kats[i].hash),
+                       signature)) {
+            return (int_fast32_t)(15 + i * 10);
+        }
+        /* Wrong hash */
+        if(p256_verify(&public_key,
+                       rfc6979_kats[1 - i].hash, sizeof(rfc6979_kats[i].hash),
+                       signature) != P256_ERR_BAD_SIGNATURE) {
+            return (int_fast32_t)(16 + i * 10);
+        }
+        /* Modified signature */
+        signature[40] ^= 0x01;
+        if(p256_verify(&public_key,
+                       rfc6979_kats[i].hash, sizeof(rfc6979_kats[i].hash),
+                       signature) != P256_ERR_BAD_SIGNATURE) {
+            return (int_fast32_t)(17 + i * 10);
+        }
+    }
+
+    /* A public key can't sign */
+    if(p256_sign(&public_key, rfc6979_kats[0].hash, 32, signature) != P256_ERR_NO_PRIVATE_KEY) {
+        return 40;
+    }
+    if(p256_sign_deterministic(&public_key, rfc6979_kats[0].hash, 32, signature) != P256_ERR_NO_PRIVATE_KEY) {
+        return 43;
+    }
+
+    /* r and s must be in [1, n - 1] */
+    memcpy(signature, rfc6979_kats[0].signature, sizeof(signature));
+    memset(signature, 0, 32);
+    if(p256_verify(&public_key, rfc6979_kats[0].hash, 32, signature) != P256_ERR_BAD_SIGNATURE) {
+        return 41;
+    }
+    memcpy(signature + 32, p256_order, 32);
+    memcpy(signature, rfc6979_kats[0].signature, 32);
+    if(p256_verify(&public_key, rfc6979_kats[0].hash, 32, signature) != P256_ERR_BAD_SIGNATURE) {
+        return 42;
+    }
+
+    /* Private scalars 0 and n are not valid */
+    memset(scalar, 0, sizeof(scalar));
+    if(p256_key_from_private(&key, scalar) != P256_ERR_INVALID_KEY) {
+        return 50;
+    }
+    if(p256_key_from_private(&key, p256_order) != P256_ERR_INVALID_KEY) {
+        return 51;
+    }
+
+    /* A point not on the curve or not uncompressed */
+    memcpy(point, rfc6979_public, sizeof(point));
+    point[64] ^= 0x01;
+    if(p256_key_from_public(&public_key, point) != P256_ERR_INVALID_KEY) {
+        return 52;
+    }
+    memcpy(point, rfc6979_public, sizeof(point));
+    point[0] = 0x02;
+    if(p256_key_from_public(&public_key, point) != P256_ERR_INVALID_KEY) {
+        return 53;
+    }
+
+    p256_key_wipe(&key);
+
+    return 0;
+}
+
+
+static int failing_random(void *context, uint8_t *buf, size_t len)
+{
+    (void)context;
+    (void)buf;
+    (void)len;
+    return -1;
+}
+
+
+/*
+ * Public function, see t_cose_p256_test.h
+ */
+int_fast32_t p256_nonce_pool_test(void)
+{
+#ifdef P256_HAVE_NONCE_POOL
+    struct p256_nonce_slot slots[8];
+    struct p256_nonce_pool pool;
+    struct p256_key        key;
+    uint8_t                signature[P256_SIGNATURE_SIZE];
+    uint8_t                r_values[8][32];
+    int_fast32_t           return_value;
+    size_t                 i;
+    size_t                 j;
+
+    if(p256_nonce_pool_init(&pool, slots, 6) != P256_ERR_INVALID_ARG) {
+        return 1;
+    }
+    if(p256_nonce_pool_init(&pool, slots, 8)) {
+        return 2;
+    }
+    if(p256_key_from_private(&key, rfc6979_private)) {
+        return 3;
+    }
+    p256_key_set_nonce_pool(&key, &pool);
+
+    /* Fills up to the size and no more */
+    if(p256_nonce_pool_fill(&pool, 5) != 5 || p256_nonce_pool_count(&pool) != 5) {
+        return 4;
+    }
+    if(p256_nonce_pool_fill(&pool, 10) != 3 || p256_nonce_pool_count(&pool) != 8) {
+        return 5;
+    }
+
+    /* With a full pool no randomness is needed to sign */
+    p256_set_random(failing_random, NULL);
+    for(i = 0; i < 8; i++) {
+        if(p256_sign(&key, rfc6979_kats[0].hash, 32, signature)) {
+            return_value = 10;
+            goto Done;
+        }
+        if(p256_verify(&key, rfc6979_kats[0].hash, 32, signature)) {
+            return_value = 11;
+            goto Done;
+        }
+        memcpy(r_values[i], signature, 32);
+        for(j = 0; j < i; j++) {
+            if(!memcmp(r_values[j], r_values[i], 32)) {
+                /* A nonce was used twice */
+                return_value = 12;
+                goto Done;
+            }
+        }
+        if(p256_nonce_pool_count(&pool) != 7 - i) {
+            return_value = 13;
+            goto Done;
+        }
+    }
+
+    /* Empty pool and no randomness */
+    if(p256_sign(&key, rfc6979_kats[0].hash, 32, signature) != P256_ERR_RANDOM) {
+        return_value = 14;
+        goto Done;
+    }
+    if(p256_nonce_pool_fill(&pool, 1) != 0) {
+        return_value = 15;
+        goto Done;
+    }
+    /* Deterministic signing needs no randomness and leaves the pool
+     * alone */
+    if(p256_sign_deterministic(&key, rfc6979_kats[0].hash, 32, signature)) {
+        return_value = 21;
+        goto Done;
+    }
+    if(memcmp(signature, rfc6979_kats[0].signature, sizeof(signature))) {
+        return_value = 22;
+        goto Done;
+    }
+    p256_set_random(NULL, NULL);
+
+    /* Empty pool falls back to making a nonce */
+    if(p256_sign(&key, rfc6979_kats[0].hash, 32, signature)) {
+        return_value = 16;
+        goto Done;
+    }
+    if(p256_verify(&key, rfc6979_kats[0].hash, 32, signature)) {
+        return_value = 17;
+        goto Done;
+    }
+
+    /* Wiping empties it */
+    if(p256_nonce_pool_fill(&pool, 4) != 4) {
+        return_value = 18;
+        goto Done;
+    }
+    p256_nonce_pool_wipe(&pool);
+    if(p256_nonce_pool_count(&pool) != 0) {
+        return_value = 19;
+        goto Done;
+    }
+    for(i = 0; i < 8; i++) {
+        for(j = 0; j < sizeof(slots[i].r) / sizeof(slots[i].r[0]); j++) {
+            if(slots[i].r[j] || slots[i].k_inverse[j]) {
+                return_value = 20;
+                goto Done;
+            }
+        }
+    }
+
+    return_value = 0;
+
+Done:
+    p256_set_random(NULL, NULL);
+    p256_key_wipe(&key);
+    return return_value;
+#else
+    return 0;
+#endif /* P256_HAVE_NONCE_POOL */
+}
+
+
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+
+/* The private scalar of the P-256 key in t_cose_make_openssl_test_key.c */
+static const uint8_t ossl_ec256_private[] = {
+    0xd9, 0xb5, 0xe7, 0x1f, 0x77, 0x28, 0xbf, 0xe5, 0x63, 0xa9, 0xdc, 0x93, 0x75, 0x62, 0x27, 0x7e,
+    0x32, 0x7d, 0x98, 0xd9, 0x94, 0x80, 0xf3, 0xdc, 0x92, 0x41, 0xe5, 0x74, 0x2a, 0xc4, 0x58, 0x89
+};
+
+
+/*
+ * Public function, see t_cose_p256_test.h
+ */
+int_fast32_t p256_openssl_cross_test(void)
+{
+    struct t_cose_key     ossl_key;
+    struct p256_key       key;
+    uint8_t               hash[32];
+    uint8_t               signature[P256_SIGNATURE_SIZE];
+    struct q_useful_buf_c ossl_signature;
+    struct q_useful_buf_c hash_c = {hash, sizeof(hash)};
+    enum t_cose_err_t     result;
+    int_fast32_t          return_value;
+    int                   i;
+    size_t                j;
+
+    if(make_key_pair(T_COSE_ALGORITHM_ES256, &ossl_key)) {
+        return 1;
+    }
+    if(p256_key_from_private(&key, ossl_ec256_private)) {
+        return_value = 2;
+        goto Done;
+    }
+
+    for(i = 0; i < 32; i++) {
+        for(j = 0; j < sizeof(hash); j++) {
+            hash[j] = (uint8_t)(i * 37 + j * 11);
+        }
+
+        /* This engine signs, OpenSSL verifies */
+        if(p256_sign(&key, hash, sizeof(hash), signature)) {
+            return_value = 10;
+            goto Done;
+        }
+        result = t_cose_crypto_verify(T_COSE_ALGORITHM_ES256,
+                                      ossl_key,
+                                      NULL_Q_USEFUL_BUF_C,
+                                      hash_c,
+                                      (struct q_useful_buf_c){signature, sizeof(signature)});
+        if(result) {
+            return_value = 1000 + (int_fast32_t)result;
+            goto Done;
+        }
+        signature[i] ^= 0x80;
+        result = t_cose_crypto_verify(T_COSE_ALGORITHM_ES256,
+                                      ossl_key,
+                                      NULL_Q_USEFUL_BUF_C,
+                                      hash_c,
+                                      (struct q_useful_buf_c){signature, sizeof(signature)});
+        if(result != T_COSE_ERR_SIG_VERIFY) {
+            return_value = 11;
+            goto Done;
+        }
+
+        /* OpenSSL signs, this engine verifies */
+        result = t_cose_crypto_sign(T_COSE_ALGORITHM_ES256,
+                                    ossl_key,
+                                    hash_c,
+                                    (struct q_useful_buf){signature, sizeof(signature)},
+                                    &ossl_signature);
+        if(result) {
+            return_value = 2000 + (int_fast32_t)result;
+            goto Done;
+        }
+        if(ossl_signature.len != sizeof(signature) ||
+           p256_verify(&key, hash, sizeof(hash), ossl_signature.ptr)) {
+            return_value = 12;
+            goto Done;
+        }
+    }
+
+    return_value = 0;
+
+Done:
+    p256_key_wipe(&key);
+    free_key_pair(ossl_key);
+    return return_value;
+}
+
+#endif /* T_COSE_USE_OPENSSL_CRYPTO */
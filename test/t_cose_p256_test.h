@@ -0,0 +1,51 @@
+/*
+ *  t_cose_p256_test.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef t_cose_p256_test_h
+#define t_cose_p256_test_h
+
+#include <stdint.h>
+
+
+/**
+ * \file t_cose_p256_test.h
+ *
+ * \brief Tests of the P-256 engine used by the built-in crypto
+ * adapter. These are built with T_COSE_ENABLE_P256_TESTS, which is
+ * set for the built-in and the OpenSSL crypto providers.
+ */
+
+
+/*
+ * Key derivation, signing with a fixed nonce, deterministic signing
+ * and verification against the P-256 / SHA-256 vectors in RFC 6979
+ * appendix A.2.5, plus
+ * rejection of invalid keys and signatures.
+ */
+int_fast32_t p256_kat_test(void);
+
+
+/*
+ * Fill a nonce pool, sign from it and check it falls back to making
+ * nonces when it is empty.
+ */
+int_fast32_t p256_nonce_pool_test(void);
+
+
+#ifdef T_COSE_USE_OPENSSL_CRYPTO
+/*
+ * Sign with the P-256 engine and verify with the OpenSSL adapter,
+ * and the other way around, with the same key.
+ */
+int_fast32_t p256_openssl_cross_test(void);
+#endif
+
+
+#endif /* t_cose_p256_test_h */
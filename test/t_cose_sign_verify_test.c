@@ -11,8 +11,12 @@
 #include <stdlib.h>
 #include "t_cose/t_cose_sign1_sign.h"
 #include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_x5chain.h"
+#include "t_cose/t_cose_replay_cache.h"
 #include "t_cose/q_useful_buf.h"
 #include "t_cose_make_test_pub_key.h"
+#include "t_cose_make_test_messages.h"
+#include "t_cose_x5chain_test_certs.h"
 #include "t_cose_sign_verify_test.h"
 
 #include "t_cose_crypto.h" /* Just for t_cose_crypto_sig_size() */
@@ -974,3 +978,1337 @@ Done:
 
     return return_value;
 }
+
+
+#define NUM_SIGN_VERIFY_BATCH_ITEMS 19
+
+static int_fast32_t sign_verify_batch_test_alg(int32_t cose_alg)
+{
+    struct t_cose_sign1_sign_ctx          sign_ctx;
+    struct t_cose_sign1_verify_ctx        verify_ctx;
+    struct t_cose_key                     key_pair;
+    struct t_cose_sign1_sign_batch_item   sign_items[NUM_SIGN_VERIFY_BATCH_ITEMS];
+    struct t_cose_sign1_verify_batch_item verify_items[NUM_SIGN_VERIFY_BATCH_ITEMS];
+    static uint8_t                        payloads[1000];
+    static uint8_t                        signed_cose_buffers[NUM_SIGN_VERIFY_BATCH_ITEMS][1400];
+    Q_USEFUL_BUF_MAKE_STACK_UB(           auxiliary_buffer, 1400);
+    struct q_useful_buf_c                 payload;
+    struct q_useful_buf                   tamper;
+    int32_t                               return_value;
+    enum t_cose_err_t                     result;
+    size_t                                i;
+
+    for(i = 0; i < sizeof(payloads); i++) {
+        payloads[i] = (uint8_t)(i * 7);
+    }
+
+    result = make_key_pair(cose_alg, &key_pair);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    /* Payloads of different lengths, some with AAD */
+    for(i = 0; i < NUM_SIGN_VERIFY_BATCH_ITEMS; i++) {
+        sign_items[i].payload = (struct q_useful_buf_c){payloads, i * 53};
+        sign_items[i].aad     = i % 3 ? NULL_Q_USEFUL_BUF_C :
+                                        (struct q_useful_buf_c){payloads + 500, i};
+        sign_items[i].out_buf = (struct q_useful_buf){signed_cose_buffers[i],
+                                                      sizeof(signed_cose_buffers[i])};
+    }
+
+    t_cose_sign1_sign_init(&sign_ctx, 0, cose_alg);
+    t_cose_sign1_set_signing_key(&sign_ctx, key_pair, Q_USEFUL_BUF_FROM_SZ_LITERAL("kid"));
+    t_cose_sign1_sign_set_auxiliary_buffer(&sign_ctx, auxiliary_buffer);
+    result = t_cose_sign1_sign_batch(&sign_ctx, sign_items, NUM_SIGN_VERIFY_BATCH_ITEMS);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* Each batch signed message verifies one at a time */
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key_pair);
+    t_cose_sign1_verify_set_auxiliary_buffer(&verify_ctx, auxiliary_buffer);
+    for(i = 0; i < NUM_SIGN_VERIFY_BATCH_ITEMS; i++) {
+        result = t_cose_sign1_verify_aad(&verify_ctx,
+                                         sign_items[i].result,
+                                         sign_items[i].aad,
+                                         &payload,
+                                         NULL);
+        if(result) {
+            return_value = 3000 + (int32_t)result;
+            goto Done;
+        }
+        if(q_useful_buf_compare(payload, sign_items[i].payload)) {
+            return_value = 3900;
+            goto Done;
+        }
+    }
+
+    /* Tamper with one in the middle; only it should fail */
+    tamper = q_useful_buf_unconst(sign_items[9].result);
+    ((uint8_t *)tamper.ptr)[tamper.len / 2] ^= 0x01;
+
+    for(i = 0; i < NUM_SIGN_VERIFY_BATCH_ITEMS; i++) {
+        verify_items[i].cose_sign1 = sign_items[i].result;
+        verify_items[i].aad        = sign_items[i].aad;
+    }
+    result = t_cose_sign1_verify_batch(&verify_ctx, verify_items, NUM_SIGN_VERIFY_BATCH_ITEMS);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return_value = 4000 + (int32_t)result;
+        goto Done;
+    }
+    for(i = 0; i < NUM_SIGN_VERIFY_BATCH_ITEMS; i++) {
+        if(i == 9) {
+            if(verify_items[i].err != T_COSE_ERR_SIG_VERIFY) {
+                return_value = 5000 + (int32_t)verify_items[i].err;
+                goto Done;
+            }
+            continue;
+        }
+        if(verify_items[i].err) {
+            return_value = 6000 + (int32_t)verify_items[i].err;
+            goto Done;
+        }
+        if(q_useful_buf_compare(verify_items[i].payload, sign_items[i].payload) ||
+           verify_items[i].parameters.cose_algorithm_id != cose_alg ||
+           q_useful_buf_compare(verify_items[i].parameters.kid,
+                                Q_USEFUL_BUF_FROM_SZ_LITERAL("kid"))) {
+            return_value = 7000 + (int32_t)i;
+            goto Done;
+        }
+    }
+
+    return_value = 0;
+
+Done:
+    free_key_pair(key_pair);
+
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_batch_test(void)
+{
+    int_fast32_t return_value;
+    const struct test_case* tc;
+    for (tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if (t_cose_is_algorithm_supported(tc->cose_algorithm_id)) {
+            return_value = sign_verify_batch_test_alg(tc->cose_algorithm_id);
+            if (return_value) {
+                return (int32_t)(1 + tc - test_cases) * 10000 + return_value;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+/* Signs and verifies a message with each of keys, num_keys times over */
+static int_fast32_t replica_round(int32_t                  cose_alg,
+                                  const struct t_cose_key *keys,
+                                  size_t                   num_keys)
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 600);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    auxiliary_buffer, 100);
+    struct q_useful_buf_c          signed_cose;
+    struct q_useful_buf_c          payload;
+    struct q_useful_buf            tamper;
+    enum t_cose_err_t              result;
+    size_t                         i;
+
+    for(i = 0; i < num_keys; i++) {
+        t_cose_sign1_sign_init(&sign_ctx, 0, cose_alg);
+        t_cose_sign1_set_signing_key(&sign_ctx, keys[i], NULL_Q_USEFUL_BUF_C);
+        t_cose_sign1_sign_set_auxiliary_buffer(&sign_ctx, auxiliary_buffer);
+        result = t_cose_sign1_sign(&sign_ctx,
+                                   Q_USEFUL_BUF_FROM_SZ_LITERAL("payload"),
+                                   signed_cose_buffer,
+                                   &signed_cose);
+        if(result) {
+            return 100 + (int32_t)result;
+        }
+
+        t_cose_sign1_verify_init(&verify_ctx, 0);
+        t_cose_sign1_set_verification_key(&verify_ctx, keys[i]);
+        t_cose_sign1_verify_set_auxiliary_buffer(&verify_ctx, auxiliary_buffer);
+        result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+        if(result) {
+            return 200 + (int32_t)result;
+        }
+
+        /* A failed verification leaves the kept context usable */
+        tamper = q_useful_buf_unconst(signed_cose);
+        ((uint8_t *)tamper.ptr)[tamper.len - 1] ^= 0x01;
+        result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+        if(result != T_COSE_ERR_SIG_VERIFY) {
+            return 300 + (int32_t)result;
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_key_replicas_test(void)
+{
+    /* More keys than a thread keeps replicas of so some are evicted */
+    #define NUM_REPLICA_TEST_KEYS 11
+    static const int32_t ps_algs[] = {T_COSE_ALGORITHM_PS256,
+                                      T_COSE_ALGORITHM_PS384,
+                                      T_COSE_ALGORITHM_PS512};
+    struct t_cose_key    keys[NUM_REPLICA_TEST_KEYS];
+    size_t               num_keys;
+    size_t               i;
+    int                  round;
+    int_fast32_t         return_value;
+    enum t_cose_err_t    result;
+
+    result = t_cose_set_thread_key_replicas(true);
+    if(result == T_COSE_ERR_FAIL) {
+        /* No thread-local storage in this build */
+        return 0;
+    }
+    if(result) {
+        return 1;
+    }
+
+    return_value = 0;
+
+    for(num_keys = 0; num_keys < NUM_REPLICA_TEST_KEYS; num_keys++) {
+        result = make_key_pair(T_COSE_ALGORITHM_ES256, &keys[num_keys]);
+        if(result) {
+            return_value = 1000 + (int32_t)result;
+            goto Done;
+        }
+    }
+
+    /* Twice so the second round uses kept contexts where there are
+     * any, then the first few again after they've been evicted */
+    for(round = 0; round < 2; round++) {
+        return_value = replica_round(T_COSE_ALGORITHM_ES256, keys, num_keys);
+        if(return_value) {
+            return_value += 2000 + round * 1000;
+            goto Done;
+        }
+    }
+    return_value = replica_round(T_COSE_ALGORITHM_ES256, keys, 3);
+    if(return_value) {
+        return_value += 4000;
+        goto Done;
+    }
+
+    /* The same RSA key with each PSS algorithm in turn */
+    if(t_cose_is_algorithm_supported(T_COSE_ALGORITHM_PS256)) {
+        while(num_keys > 0) {
+            free_key_pair(keys[--num_keys]);
+        }
+        result = make_key_pair(T_COSE_ALGORITHM_PS256, &keys[0]);
+        if(result) {
+            return_value = 5000 + (int32_t)result;
+            goto Done;
+        }
+        num_keys = 1;
+        for(round = 0; round < 2; round++) {
+            for(i = 0; i < sizeof(ps_algs)/sizeof(ps_algs[0]); i++) {
+                return_value = replica_round(ps_algs[i], keys, 1);
+                if(return_value) {
+                    return_value += 6000 + (int32_t)i * 1000;
+                    goto Done;
+                }
+            }
+        }
+    }
+
+Done:
+    /* Replicas hold references to the keys, so release them first */
+    if(t_cose_set_thread_key_replicas(false) && return_value == 0) {
+        return_value = 2;
+    }
+    while(num_keys > 0) {
+        free_key_pair(keys[--num_keys]);
+    }
+
+    return return_value;
+}
+
+
+/* Signs "payload" with the option flags given */
+static enum t_cose_err_t sign_with_options(int32_t               cose_alg,
+                                           uint32_t              option_flags,
+                                           struct t_cose_key     key_pair,
+                                           struct q_useful_buf   buffer,
+                                           struct q_useful_buf_c *signed_cose)
+{
+    struct t_cose_sign1_sign_ctx sign_ctx;
+    Q_USEFUL_BUF_MAKE_STACK_UB(  auxiliary_buffer, 100);
+
+    t_cose_sign1_sign_init(&sign_ctx, option_flags, cose_alg);
+    t_cose_sign1_set_signing_key(&sign_ctx, key_pair, Q_USEFUL_BUF_FROM_SZ_LITERAL("kid"));
+    t_cose_sign1_sign_set_auxiliary_buffer(&sign_ctx, auxiliary_buffer);
+
+    return t_cose_sign1_sign(&sign_ctx,
+                             Q_USEFUL_BUF_FROM_SZ_LITERAL("payload"),
+                             buffer,
+                             signed_cose);
+}
+
+
+static int_fast32_t sign_verify_deterministic_test_alg(int32_t cose_alg)
+{
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_key              key_pair;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    first_buffer, 700);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    second_buffer, 700);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    auxiliary_buffer, 100);
+    struct q_useful_buf_c          first;
+    struct q_useful_buf_c          second;
+    struct q_useful_buf_c          payload;
+    int_fast32_t                   return_value;
+    enum t_cose_err_t              result;
+
+    result = make_key_pair(cose_alg, &key_pair);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    result = sign_with_options(cose_alg, T_COSE_OPT_DETERMINISTIC_ECDSA,
+                               key_pair, first_buffer, &first);
+    if(result == T_COSE_ERR_DETERMINISTIC_ECDSA_UNSUPPORTED &&
+       t_cose_algorithm_is_ecdsa(cose_alg)) {
+        /* For example OpenSSL before 3.2. It must say so rather than
+         * quietly use a random nonce. */
+        return_value = 0;
+        goto Done;
+    }
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+    result = sign_with_options(cose_alg, T_COSE_OPT_DETERMINISTIC_ECDSA,
+                               key_pair, second_buffer, &second);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* The same every time for ECDSA. The option doesn't apply to
+     * the others, which are only checked to sign and verify. */
+    if(t_cose_algorithm_is_ecdsa(cose_alg) && q_useful_buf_compare(first, second)) {
+        return_value = 4000;
+        goto Done;
+    }
+
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key_pair);
+    t_cose_sign1_verify_set_auxiliary_buffer(&verify_ctx, auxiliary_buffer);
+    result = t_cose_sign1_verify(&verify_ctx, first, &payload, NULL);
+    if(result) {
+        return_value = 5000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* Without the option the nonce is random */
+    result = sign_with_options(cose_alg, 0, key_pair, second_buffer, &second);
+    if(result) {
+        return_value = 6000 + (int32_t)result;
+        goto Done;
+    }
+    if(t_cose_algorithm_is_ecdsa(cose_alg) && !q_useful_buf_compare(first, second)) {
+        return_value = 7000;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    free_key_pair(key_pair);
+
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_deterministic_test(void)
+{
+    int_fast32_t return_value;
+    const struct test_case* tc;
+    for (tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if (t_cose_is_algorithm_supported(tc->cose_algorithm_id)) {
+            return_value = sign_verify_deterministic_test_alg(tc->cose_algorithm_id);
+            if (return_value) {
+                return (int32_t)(1 + tc - test_cases) * 10000 + return_value;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+static int_fast32_t sign_verify_reserve_payload_test_alg(int32_t cose_alg)
+{
+    struct t_cose_sign1_signer      signer;
+    struct t_cose_sign1_sign_call   sign_call;
+    struct t_cose_sign1_verify_ctx  verify_ctx;
+    struct t_cose_sign1_reservation reservation;
+    struct t_cose_key               key_pair;
+    struct q_useful_buf             payload_slot;
+    Q_USEFUL_BUF_MAKE_STACK_UB(     signed_cose_buffer, 900);
+    Q_USEFUL_BUF_MAKE_STACK_UB(     auxiliary_buffer, 300);
+    struct q_useful_buf_c           signed_cose;
+    struct q_useful_buf_c           payload;
+    struct q_useful_buf_c           input_payload = Q_USEFUL_BUF_FROM_SZ_LITERAL("payload");
+    int_fast32_t                    return_value;
+    enum t_cose_err_t               result;
+
+    result = make_key_pair(cose_alg, &key_pair);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    result = t_cose_sign1_signer_init(&signer, 0, cose_alg);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+    t_cose_sign1_signer_set_signing_key(&signer, key_pair, NULL_Q_USEFUL_BUF_C);
+    t_cose_sign1_sign_call_init(&sign_call, auxiliary_buffer);
+
+    result = t_cose_sign1_signer_reserve_payload(&signer,
+                                                 input_payload.len,
+                                                 signed_cose_buffer,
+                                                &reservation,
+                                                &payload_slot);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+    memcpy(payload_slot.ptr, input_payload.ptr, input_payload.len);
+    result = t_cose_sign1_signer_sign_reserved(&signer,
+                                              &sign_call,
+                                              &reservation,
+                                               Q_USEFUL_BUF_FROM_SZ_LITERAL("aad"),
+                                              &signed_cose);
+    if(result) {
+        return_value = 4000 + (int32_t)result;
+        goto Done;
+    }
+
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key_pair);
+    t_cose_sign1_verify_set_auxiliary_buffer(&verify_ctx, auxiliary_buffer);
+    result = t_cose_sign1_verify_aad(&verify_ctx,
+                                     signed_cose,
+                                     Q_USEFUL_BUF_FROM_SZ_LITERAL("aad"),
+                                    &payload,
+                                     NULL);
+    if(result) {
+        return_value = 5000 + (int32_t)result;
+        goto Done;
+    }
+    if(q_useful_buf_compare(payload, input_payload)) {
+        return_value = 6000;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    free_key_pair(key_pair);
+
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_reserve_payload_test(void)
+{
+    int_fast32_t return_value;
+    const struct test_case* tc;
+    for (tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if (t_cose_is_algorithm_supported(tc->cose_algorithm_id)) {
+            return_value = sign_verify_reserve_payload_test_alg(tc->cose_algorithm_id);
+            if (return_value) {
+                return (int32_t)(1 + tc - test_cases) * 10000 + return_value;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+static int_fast32_t sign_verify_iovec_test_alg(int32_t cose_alg)
+{
+    struct t_cose_sign1_signer     signer;
+    struct t_cose_sign1_sign_call  sign_call;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_iovec      iovec;
+    struct t_cose_key              key_pair;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    header_buffer, 100);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    trailer_buffer, 600);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 700);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    auxiliary_buffer, 300);
+    UsefulOutBuf                   signed_cose;
+    struct q_useful_buf_c          payload;
+    struct q_useful_buf_c          input_payload = Q_USEFUL_BUF_FROM_SZ_LITERAL("payload");
+    int_fast32_t                   return_value;
+    enum t_cose_err_t              result;
+
+    result = make_key_pair(cose_alg, &key_pair);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    result = t_cose_sign1_signer_init(&signer, 0, cose_alg);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+    t_cose_sign1_signer_set_signing_key(&signer, key_pair, NULL_Q_USEFUL_BUF_C);
+    t_cose_sign1_sign_call_init(&sign_call, auxiliary_buffer);
+
+    result = t_cose_sign1_signer_sign_iovec(&signer,
+                                           &sign_call,
+                                            Q_USEFUL_BUF_FROM_SZ_LITERAL("aad"),
+                                            input_payload,
+                                            header_buffer,
+                                            trailer_buffer,
+                                           &iovec);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* What writev() would send */
+    UsefulOutBuf_Init(&signed_cose, signed_cose_buffer);
+    UsefulOutBuf_AppendUsefulBuf(&signed_cose, iovec.header);
+    UsefulOutBuf_AppendUsefulBuf(&signed_cose, iovec.payload);
+    UsefulOutBuf_AppendUsefulBuf(&signed_cose, iovec.trailer);
+
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key_pair);
+    t_cose_sign1_verify_set_auxiliary_buffer(&verify_ctx, auxiliary_buffer);
+    result = t_cose_sign1_verify_aad(&verify_ctx,
+                                     UsefulOutBuf_OutUBuf(&signed_cose),
+                                     Q_USEFUL_BUF_FROM_SZ_LITERAL("aad"),
+                                    &payload,
+                                     NULL);
+    if(result) {
+        return_value = 4000 + (int32_t)result;
+        goto Done;
+    }
+    if(q_useful_buf_compare(payload, input_payload)) {
+        return_value = 5000;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    free_key_pair(key_pair);
+
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_iovec_test(void)
+{
+    int_fast32_t return_value;
+    const struct test_case* tc;
+    for (tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if (t_cose_is_algorithm_supported(tc->cose_algorithm_id)) {
+            return_value = sign_verify_iovec_test_alg(tc->cose_algorithm_id);
+            if (return_value) {
+                return (int32_t)(1 + tc - test_cases) * 10000 + return_value;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+static int_fast32_t sign_verify_parse_test_alg(int32_t cose_alg)
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_parsed     parsed;
+    struct t_cose_key              key_pair;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 700);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    auxiliary_buffer, 300);
+    struct q_useful_buf_c          signed_cose;
+    struct q_useful_buf_c          kid = Q_USEFUL_BUF_FROM_SZ_LITERAL("the kid");
+    int_fast32_t                   return_value;
+    enum t_cose_err_t              result;
+
+    result = make_key_pair(cose_alg, &key_pair);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    t_cose_sign1_sign_init(&sign_ctx, 0, cose_alg);
+    t_cose_sign1_set_signing_key(&sign_ctx, key_pair, kid);
+    t_cose_sign1_sign_set_auxiliary_buffer(&sign_ctx, auxiliary_buffer);
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_SZ_LITERAL("payload"),
+                               signed_cose_buffer,
+                              &signed_cose);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* Parse to find the kid, then set the key for it */
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    result = t_cose_sign1_parse(&verify_ctx, signed_cose, &parsed);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+    if(q_useful_buf_compare(parsed.parameters.kid, kid)) {
+        return_value = 3100;
+        goto Done;
+    }
+    t_cose_sign1_set_verification_key(&verify_ctx, key_pair);
+    t_cose_sign1_verify_set_auxiliary_buffer(&verify_ctx, auxiliary_buffer);
+    result = t_cose_sign1_verify_parsed(&verify_ctx, &parsed, NULL_Q_USEFUL_BUF_C);
+    if(result) {
+        return_value = 4000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* A changed payload doesn't verify */
+    parsed.payload = Q_USEFUL_BUF_FROM_SZ_LITERAL("payloaf");
+    result = t_cose_sign1_verify_parsed(&verify_ctx, &parsed, NULL_Q_USEFUL_BUF_C);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return_value = 5000 + (int32_t)result;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    free_key_pair(key_pair);
+
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_parse_test(void)
+{
+    int_fast32_t return_value;
+    const struct test_case* tc;
+    for (tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if (t_cose_is_algorithm_supported(tc->cose_algorithm_id)) {
+            return_value = sign_verify_parse_test_alg(tc->cose_algorithm_id);
+            if (return_value) {
+                return (int32_t)(1 + tc - test_cases) * 10000 + return_value;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+static int_fast32_t sign_verify_any_key_test_alg(int32_t cose_alg)
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_parsed     parsed;
+    /* The keys of the other algorithms, then the one that signed */
+    struct t_cose_key              keys[sizeof(test_cases) / sizeof(test_cases[0])];
+    size_t                         num_keys;
+    size_t                         key_index;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 700);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    auxiliary_buffer, 300);
+    struct q_useful_buf_c          signed_cose;
+    const struct test_case        *tc;
+    int_fast32_t                   return_value;
+    enum t_cose_err_t              result;
+    size_t                         i;
+
+    /* The RSA algorithms all use the same test key so only one of
+     * them can be a candidate */
+    num_keys = 0;
+    for(tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if(tc->cose_algorithm_id == cose_alg ||
+           !t_cose_is_algorithm_supported(tc->cose_algorithm_id) ||
+           (t_cose_algorithm_is_rsassa_pss(tc->cose_algorithm_id) &&
+            t_cose_algorithm_is_rsassa_pss(cose_alg))) {
+            continue;
+        }
+        if(make_key_pair(tc->cose_algorithm_id, &keys[num_keys]) == T_COSE_SUCCESS) {
+            num_keys++;
+        }
+    }
+    result = make_key_pair(cose_alg, &keys[num_keys]);
+    if(result) {
+        return_value = 1000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* No kid as is the case that needs trying keys */
+    t_cose_sign1_sign_init(&sign_ctx, 0, cose_alg);
+    t_cose_sign1_set_signing_key(&sign_ctx, keys[num_keys], NULL_Q_USEFUL_BUF_C);
+    t_cose_sign1_sign_set_auxiliary_buffer(&sign_ctx, auxiliary_buffer);
+    num_keys++;
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_SZ_LITERAL("payload"),
+                               signed_cose_buffer,
+                              &signed_cose);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_verify_set_auxiliary_buffer(&verify_ctx, auxiliary_buffer);
+    result = t_cose_sign1_parse(&verify_ctx, signed_cose, &parsed);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* The signing key is found after the others fail */
+    result = t_cose_sign1_verify_parsed_any_key(&verify_ctx,
+                                                &parsed,
+                                                 NULL_Q_USEFUL_BUF_C,
+                                                 keys,
+                                                 num_keys,
+                                                &key_index);
+    if(result) {
+        return_value = 4000 + (int32_t)result;
+        goto Done;
+    }
+    if(key_index != num_keys - 1) {
+        return_value = 4100;
+        goto Done;
+    }
+
+    /* None of the others verify */
+    result = t_cose_sign1_verify_parsed_any_key(&verify_ctx,
+                                                &parsed,
+                                                 NULL_Q_USEFUL_BUF_C,
+                                                 keys,
+                                                 num_keys - 1,
+                                                &key_index);
+    if(result != T_COSE_ERR_SIG_VERIFY || key_index != SIZE_MAX) {
+        return_value = 5000 + (int32_t)result;
+        goto Done;
+    }
+
+    /* A changed payload doesn't verify with any of them */
+    parsed.payload = Q_USEFUL_BUF_FROM_SZ_LITERAL("payloaf");
+    result = t_cose_sign1_verify_parsed_any_key(&verify_ctx,
+                                                &parsed,
+                                                 NULL_Q_USEFUL_BUF_C,
+                                                 keys,
+                                                 num_keys,
+                                                &key_index);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return_value = 6000 + (int32_t)result;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    for(i = 0; i < num_keys; i++) {
+        free_key_pair(keys[i]);
+    }
+
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_any_key_test(void)
+{
+    int_fast32_t return_value;
+    const struct test_case* tc;
+    for (tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if (t_cose_is_algorithm_supported(tc->cose_algorithm_id)) {
+            return_value = sign_verify_any_key_test_alg(tc->cose_algorithm_id);
+            if (return_value) {
+                return (int32_t)(1 + tc - test_cases) * 10000 + return_value;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+static int_fast32_t sign_verify_merkle_test_alg(int32_t cose_alg)
+{
+    struct t_cose_sign1_signer      signer;
+    struct t_cose_sign1_sign_call   sign_call;
+    struct t_cose_sign1_verifier    verifier;
+    struct t_cose_sign1_verify_call verify_call;
+    struct t_cose_receipt_cache     cache;
+    struct t_cose_merkle_tree       tree;
+    struct t_cose_key               key_pair;
+    struct q_useful_buf_c           payloads[5];
+    uint8_t                         tree_buffer[T_COSE_MERKLE_TREE_BUFFER_SIZE(5)];
+    Q_USEFUL_BUF_MAKE_STACK_UB(     signed_root_buffer, 700);
+    Q_USEFUL_BUF_MAKE_STACK_UB(     receipt_buffer, 1000);
+    Q_USEFUL_BUF_MAKE_STACK_UB(     auxiliary_buffer, 300);
+    struct q_useful_buf_c           receipt;
+    size_t                          i;
+    int_fast32_t                    return_value;
+    enum t_cose_err_t               result;
+
+    payloads[0] = Q_USEFUL_BUF_FROM_SZ_LITERAL("zero");
+    payloads[1] = Q_USEFUL_BUF_FROM_SZ_LITERAL("one");
+    payloads[2] = Q_USEFUL_BUF_FROM_SZ_LITERAL("two");
+    payloads[3] = Q_USEFUL_BUF_FROM_SZ_LITERAL("three");
+    payloads[4] = Q_USEFUL_BUF_FROM_SZ_LITERAL("four");
+
+    result = make_key_pair(cose_alg, &key_pair);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    result = t_cose_sign1_signer_init(&signer, 0, cose_alg);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+    t_cose_sign1_signer_set_signing_key(&signer, key_pair, NULL_Q_USEFUL_BUF_C);
+    t_cose_sign1_sign_call_init(&sign_call, auxiliary_buffer);
+
+    result = t_cose_sign1_signer_sign_merkle(&signer,
+                                            &sign_call,
+                                             payloads,
+                                             5,
+                                             Q_USEFUL_BUF_FROM_BYTE_ARRAY(tree_buffer),
+                                             signed_root_buffer,
+                                            &tree);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+
+    t_cose_sign1_verifier_init(&verifier, 0);
+    t_cose_sign1_verifier_set_verification_key(&verifier, key_pair);
+    t_cose_sign1_verify_call_init(&verify_call, auxiliary_buffer);
+    t_cose_receipt_cache_init(&cache);
+    t_cose_sign1_verify_call_set_receipt_cache(&verify_call, &cache);
+
+    for(i = 0; i < 5; i++) {
+        result = t_cose_merkle_tree_receipt(&tree, i, receipt_buffer, &receipt);
+        if(result) {
+            return_value = 4000 + (int32_t)result;
+            goto Done;
+        }
+        result = t_cose_sign1_verifier_verify_receipt(&verifier,
+                                                      &verify_call,
+                                                      receipt,
+                                                      payloads[i],
+                                                      NULL);
+        if(result) {
+            return_value = 5000 + (int32_t)result;
+            goto Done;
+        }
+        result = t_cose_sign1_verifier_verify_receipt(&verifier,
+                                                      &verify_call,
+                                                      receipt,
+                                                      payloads[(i + 1) % 5],
+                                                      NULL);
+        if(result != T_COSE_ERR_SIG_VERIFY) {
+            return_value = 6000 + (int32_t)result;
+            goto Done;
+        }
+    }
+
+    return_value = 0;
+
+Done:
+    free_key_pair(key_pair);
+
+    return return_value;
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_merkle_test(void)
+{
+    int_fast32_t return_value;
+    const struct test_case* tc;
+    for (tc = test_cases; tc->cose_algorithm_id != 0; tc++) {
+        if (t_cose_is_algorithm_supported(tc->cose_algorithm_id)) {
+            return_value = sign_verify_merkle_test_alg(tc->cose_algorithm_id);
+            if (return_value) {
+                return (int32_t)(1 + tc - test_cases) * 10000 + return_value;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+/* The time for sign_verify_x5chain_test() and
+ * sign_verify_replay_cache_test() */
+static int64_t x5chain_test_clock(void *clock_ctx)
+{
+    return *(const int64_t *)clock_ctx;
+}
+
+
+/* Puts the unprotected parameters in parsed, which must be made with
+ * no unprotected parameters, for sign_verify_x5chain_test() */
+static enum t_cose_err_t
+x5chain_test_message(const struct t_cose_sign1_parsed *parsed,
+                     struct q_useful_buf_c             payload,
+                     const struct q_useful_buf_c      *certs,
+                     size_t                            num_certs,
+                     struct q_useful_buf_c             x5t_hash,
+                     struct q_useful_buf               buffer,
+                     struct q_useful_buf_c            *message)
+{
+    QCBOREncodeContext    cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(unprotected_buffer, 1000);
+    struct q_useful_buf_c unprotected;
+    size_t                i;
+
+    QCBOREncode_Init(&cbor_encode, unprotected_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    if(num_certs > 0) {
+        QCBOREncode_OpenArrayInMapN(&cbor_encode, 33);
+        for(i = 0; i < num_certs; i++) {
+            QCBOREncode_AddBytes(&cbor_encode, certs[i]);
+        }
+        QCBOREncode_CloseArray(&cbor_encode);
+    }
+    if(!q_useful_buf_c_is_null(x5t_hash)) {
+        QCBOREncode_OpenArrayInMapN(&cbor_encode, 34);
+        QCBOREncode_AddInt64(&cbor_encode, T_COSE_ALGORITHM_SHA_256);
+        QCBOREncode_AddBytes(&cbor_encode, x5t_hash);
+        QCBOREncode_CloseArray(&cbor_encode);
+    }
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &unprotected)) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+
+    return t_cose_test_message_sign1_from_parts(parsed->protected_parameters,
+                                                unprotected,
+                                                payload,
+                                                parsed->signature,
+                                                buffer,
+                                                message);
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_x5chain_test(void)
+{
+    const struct q_useful_buf_c root = {x5chain_test_root, sizeof(x5chain_test_root)};
+    const struct q_useful_buf_c other_root = {x5chain_test_other_root, sizeof(x5chain_test_other_root)};
+    const struct q_useful_buf_c chain[] = {
+        {x5chain_test_device, sizeof(x5chain_test_device)},
+        {x5chain_test_intermediate, sizeof(x5chain_test_intermediate)}};
+    struct t_cose_x5chain_cache       cache;
+    struct t_cose_x5chain_cache       other_cache;
+    struct t_cose_x5chain_cache_entry entries[2];
+    struct t_cose_x5chain_cache_entry other_entries[1];
+    struct t_cose_sign1_sign_ctx      sign_ctx;
+    struct t_cose_sign1_verify_ctx    verify_ctx;
+    struct t_cose_sign1_parsed        parsed;
+    struct t_cose_crypto_hash         hash_ctx;
+    struct t_cose_key                 key_pair;
+    Q_USEFUL_BUF_MAKE_STACK_UB(       signed_buffer, 300);
+    Q_USEFUL_BUF_MAKE_STACK_UB(       message_buffer, 1200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(       leaf_hash_buffer, T_COSE_CRYPTO_SHA256_SIZE);
+    struct q_useful_buf_c             signed_cose;
+    struct q_useful_buf_c             message;
+    struct q_useful_buf_c             leaf_hash;
+    struct q_useful_buf_c             payload;
+    struct t_cose_parameters          parameters;
+    void                             *leaf_key_ptr;
+    int64_t                           now;
+    int_fast32_t                      return_value;
+    enum t_cose_err_t                 result;
+
+    result = t_cose_x5chain_cache_init(&cache, entries, 2, &root, 1);
+    if(result == T_COSE_ERR_X5CHAIN_UNSUPPORTED) {
+        /* This crypto adapter can't validate chains */
+        t_cose_x5chain_cache_free(&cache);
+        return 0;
+    }
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+    /* January 2028, when the test certificates are good */
+    now             = 1830297600;
+    cache.clock     = x5chain_test_clock;
+    cache.clock_ctx = &now;
+
+    /* --- A message signed by the key of the device certificate --- */
+    result = make_key_pair(T_COSE_ALGORITHM_ES256, &key_pair);
+    if(result) {
+        return_value = 1100 + (int32_t)result;
+        goto Done;
+    }
+    t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key_pair, NULL_Q_USEFUL_BUF_C);
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_SZ_LITERAL("payload"),
+                               signed_buffer,
+                               &signed_cose);
+    free_key_pair(key_pair);
+    if(result) {
+        return_value = 1200 + (int32_t)result;
+        goto Done;
+    }
+    /* The unprotected parameters aren't signed, so add x5chain there */
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    result = t_cose_sign1_parse(&verify_ctx, signed_cose, &parsed);
+    if(result) {
+        return_value = 1300 + (int32_t)result;
+        goto Done;
+    }
+    result = x5chain_test_message(&parsed, parsed.payload, chain, 2, NULL_Q_USEFUL_BUF_C,
+                                  message_buffer, &message);
+    if(result) {
+        return_value = 1400 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- Validated the first time and from the cache after --- */
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, &parameters);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+    if(q_useful_buf_compare(payload, Q_USEFUL_BUF_FROM_SZ_LITERAL("payload")) ||
+       parameters.x5chain_leaf.len != sizeof(x5chain_test_device) ||
+       entries[0].last_used == 0 || entries[1].last_used != 0) {
+        return_value = 2100;
+        goto Done;
+    }
+    leaf_key_ptr = entries[0].leaf_key.k.key_ptr;
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    /* Validating again would have made another key */
+    if(result || entries[0].leaf_key.k.key_ptr != leaf_key_ptr || entries[1].last_used != 0) {
+        return_value = 2200 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- Only x5t of a chain in the cache --- */
+    result = t_cose_crypto_hash_start(&hash_ctx, T_COSE_ALGORITHM_SHA_256);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+    t_cose_crypto_hash_update(&hash_ctx, chain[0]);
+    result = t_cose_crypto_hash_finish(&hash_ctx, leaf_hash_buffer, &leaf_hash);
+    if(result) {
+        return_value = 3100 + (int32_t)result;
+        goto Done;
+    }
+    result = x5chain_test_message(&parsed, parsed.payload, NULL, 0, leaf_hash,
+                                  message_buffer, &message);
+    if(result) {
+        return_value = 3200 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    if(result) {
+        return_value = 3300 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- Not valid when far in the future --- */
+    now = 7258118400; /* 2200 */
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    if(result != T_COSE_ERR_NO_X5CHAIN) {
+        return_value = 4000 + (int32_t)result;
+        goto Done;
+    }
+    result = x5chain_test_message(&parsed, parsed.payload, chain, 2, NULL_Q_USEFUL_BUF_C,
+                                  message_buffer, &message);
+    if(result) {
+        return_value = 4100 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    if(result != T_COSE_ERR_X5CHAIN_INVALID) {
+        return_value = 4200 + (int32_t)result;
+        goto Done;
+    }
+    now = 1830297600;
+
+    /* --- Without the intermediate, with the wrong x5t and to the wrong anchor --- */
+    result = x5chain_test_message(&parsed, parsed.payload, chain, 1, NULL_Q_USEFUL_BUF_C,
+                                  message_buffer, &message);
+    if(result) {
+        return_value = 5000 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    if(result != T_COSE_ERR_X5CHAIN_INVALID) {
+        return_value = 5100 + (int32_t)result;
+        goto Done;
+    }
+    result = x5chain_test_message(&parsed, parsed.payload, chain, 2,
+                                  (struct q_useful_buf_c){x5chain_test_root, T_COSE_CRYPTO_SHA256_SIZE},
+                                  message_buffer, &message);
+    if(result) {
+        return_value = 5200 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    if(result != T_COSE_ERR_X5CHAIN_INVALID) {
+        return_value = 5300 + (int32_t)result;
+        goto Done;
+    }
+    result = x5chain_test_message(&parsed, parsed.payload, chain, 2, NULL_Q_USEFUL_BUF_C,
+                                  message_buffer, &message);
+    if(result) {
+        return_value = 5400 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_x5chain_cache_init(&other_cache, other_entries, 1, &other_root, 1);
+    if(result) {
+        return_value = 5500 + (int32_t)result;
+        goto Done;
+    }
+    other_cache.clock     = x5chain_test_clock;
+    other_cache.clock_ctx = &now;
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &other_cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    t_cose_x5chain_cache_free(&other_cache);
+    if(result != T_COSE_ERR_X5CHAIN_INVALID) {
+        return_value = 5600 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- A good chain with a signature that doesn't verify --- */
+    result = x5chain_test_message(&parsed, Q_USEFUL_BUF_FROM_SZ_LITERAL("payloaD"), chain, 2,
+                                  NULL_Q_USEFUL_BUF_C, message_buffer, &message);
+    if(result) {
+        return_value = 6000 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C,
+                                         &payload, NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return_value = 6100 + (int32_t)result;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    t_cose_x5chain_cache_free(&cache);
+    return return_value;
+}
+
+
+/* Make a CWT signed with key with an exp, if not 0, and a cti, if not
+ * NULL_Q_USEFUL_BUF_C */
+static enum t_cose_err_t
+replay_cache_test_cwt(struct t_cose_key      key,
+                      int64_t                exp,
+                      struct q_useful_buf_c  cti,
+                      struct q_useful_buf    buffer,
+                      struct q_useful_buf_c *cwt)
+{
+    struct t_cose_sign1_sign_ctx sign_ctx;
+    QCBOREncodeContext           cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(  claims_buffer, 60);
+    struct q_useful_buf_c        claims;
+
+    QCBOREncode_Init(&cbor_encode, claims_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_SUB, "erikw");
+    if(exp != 0) {
+        QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_EXP, exp);
+    }
+    if(!q_useful_buf_c_is_null(cti)) {
+        QCBOREncode_AddBytesToMapN(&cbor_encode, T_COSE_CWT_CLAIM_CTI, cti);
+    }
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &claims)) {
+        return T_COSE_ERR_CBOR_FORMATTING;
+    }
+
+    t_cose_sign1_sign_init(&sign_ctx, 0, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_signing_key(&sign_ctx, key, NULL_Q_USEFUL_BUF_C);
+    return t_cose_sign1_sign(&sign_ctx, claims, buffer, cwt);
+}
+
+
+/*
+ * Public function, see t_cose_sign_verify_test.h
+ */
+int_fast32_t sign_verify_replay_cache_test(void)
+{
+    struct t_cose_replay_cache     replay;
+    uint64_t                       slots[64];
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_cwt_validation   validation;
+    struct t_cose_key              key_pair;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 300);
+    struct q_useful_buf_c          signed_cose;
+    int64_t                        now;
+    int_fast32_t                   return_value;
+    enum t_cose_err_t              result;
+
+    result = make_key_pair(T_COSE_ALGORITHM_ES256, &key_pair);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    /* 100 second buckets, five of them with 8 slots each */
+    result = t_cose_replay_cache_init(&replay, slots, 64, 400, 4);
+    if(result) {
+        return_value = 1100 + (int32_t)result;
+        goto Done;
+    }
+    now = 1444000000;
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    t_cose_sign1_set_verification_key(&verify_ctx, key_pair);
+    t_cose_cwt_validation_init(&validation, 0);
+    validation.clock        = x5chain_test_clock;
+    validation.clock_ctx    = &now;
+    validation.replay_cache = &replay;
+
+    /* --- The second time is a replay --- */
+    result = replay_cache_test_cwt(key_pair, now + 60, Q_USEFUL_BUF_FROM_SZ_LITERAL("cti-1"),
+                                   signed_cose_buffer, &signed_cose);
+    if(result) {
+        return_value = 2000 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result) {
+        return_value = 2100 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_CWT_REPLAYED) {
+        return_value = 2200 + (int32_t)result;
+        goto Done;
+    }
+    /* The same cti with another exp is still a replay as long as the
+     * bucket is the same */
+    result = replay_cache_test_cwt(key_pair, now + 61, Q_USEFUL_BUF_FROM_SZ_LITERAL("cti-1"),
+                                   signed_cose_buffer, &signed_cose);
+    if(result) {
+        return_value = 2300 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_CWT_REPLAYED) {
+        return_value = 2400 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- A bad signature isn't remembered --- */
+    result = replay_cache_test_cwt(key_pair, now + 60, Q_USEFUL_BUF_FROM_SZ_LITERAL("cti-2"),
+                                   signed_cose_buffer, &signed_cose);
+    if(result) {
+        return_value = 3000 + (int32_t)result;
+        goto Done;
+    }
+    ((uint8_t *)signed_cose_buffer.ptr)[signed_cose.len - 1] ^= 0x01;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return_value = 3100 + (int32_t)result;
+        goto Done;
+    }
+    ((uint8_t *)signed_cose_buffer.ptr)[signed_cose.len - 1] ^= 0x01;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result) {
+        return_value = 3200 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- Without a cti the payload is remembered --- */
+    result = replay_cache_test_cwt(key_pair, now + 60, NULL_Q_USEFUL_BUF_C,
+                                   signed_cose_buffer, &signed_cose);
+    if(result) {
+        return_value = 4000 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result) {
+        return_value = 4100 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_CWT_REPLAYED) {
+        return_value = 4200 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- Without an exp it couldn't be forgotten --- */
+    result = replay_cache_test_cwt(key_pair, 0, Q_USEFUL_BUF_FROM_SZ_LITERAL("cti-3"),
+                                   signed_cose_buffer, &signed_cose);
+    if(result) {
+        return_value = 5000 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_CWT_MISSING_EXP) {
+        return_value = 5100 + (int32_t)result;
+        goto Done;
+    }
+
+    /* --- Lives longer than the cache is for --- */
+    result = replay_cache_test_cwt(key_pair, now + 1000, Q_USEFUL_BUF_FROM_SZ_LITERAL("cti-4"),
+                                   signed_cose_buffer, &signed_cose);
+    if(result) {
+        return_value = 6000 + (int32_t)result;
+        goto Done;
+    }
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_REPLAY_CACHE_FULL) {
+        return_value = 6100 + (int32_t)result;
+        goto Done;
+    }
+
+    return_value = 0;
+
+Done:
+    free_key_pair(key_pair);
+    return return_value;
+}
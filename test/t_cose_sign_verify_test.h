@@ -64,4 +64,76 @@ int_fast32_t sign_verify_unsupported_test(void);
  */
 int_fast32_t sign_verify_bad_auxiliary_buffer(void);
 
+
+/*
+ * Sign and verify a batch of messages with real keys for each
+ * supported algorithm and check they interoperate with one at a time
+ * signing and verification.
+ */
+int_fast32_t sign_verify_batch_test(void);
+
+
+/*
+ * Sign and verify with per-thread key replicas turned on, with more
+ * keys than are kept and with one key used for several algorithms.
+ */
+int_fast32_t sign_verify_key_replicas_test(void);
+
+
+/*
+ * Sign with T_COSE_OPT_DETERMINISTIC_ECDSA and check ECDSA signatures
+ * repeat exactly and verify, or that the adapter says it can't.
+ */
+int_fast32_t sign_verify_deterministic_test(void);
+
+
+/*
+ * Sign with t_cose_sign1_signer_reserve_payload() and real keys for
+ * each supported algorithm and verify the result.
+ */
+int_fast32_t sign_verify_reserve_payload_test(void);
+
+
+/*
+ * Sign with t_cose_sign1_signer_sign_iovec() and real keys for each
+ * supported algorithm and verify the joined pieces.
+ */
+int_fast32_t sign_verify_iovec_test(void);
+
+
+/*
+ * Parse messages signed with real keys for each supported algorithm,
+ * set the key by the kid and verify the parsed message.
+ */
+int_fast32_t sign_verify_parse_test(void);
+
+
+/*
+ * Sign without a kid and verify by trying the test keys of all the
+ * algorithms.
+ */
+int_fast32_t sign_verify_any_key_test(void);
+
+
+/*
+ * Sign a Merkle tree with real keys for each supported algorithm and
+ * verify the receipt of each payload with a receipt cache.
+ */
+int_fast32_t sign_verify_merkle_test(void);
+
+
+/*
+ * Verify a message with a certificate chain to a test root, first
+ * validating the chain and then from the cache, with only x5t, and
+ * chains that don't validate.
+ */
+int_fast32_t sign_verify_x5chain_test(void);
+
+
+/*
+ * Verify CWTs with a replay cache: replays with and without cti, a
+ * bad signature not being remembered and tokens that can't be cached.
+ */
+int_fast32_t sign_verify_replay_cache_test(void);
+
 #endif /* t_cose_sign_verify_test_h */
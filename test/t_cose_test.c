@@ -12,6 +12,12 @@
 #include "t_cose_test.h"
 #include "t_cose/t_cose_sign1_sign.h"
 #include "t_cose/t_cose_sign1_verify.h"
+#include "t_cose/t_cose_cwt_template.h"
+#include "t_cose/t_cose_claims_index.h"
+#include "t_cose/t_cose_nested.h"
+#include "t_cose/t_cose_x5chain.h"
+#include "t_cose/t_cose_replay_cache.h"
+#include "cddl/cwt_claims_gen.h"
 #include "t_cose_make_test_messages.h"
 #include "t_cose/q_useful_buf.h"
 #include "t_cose_crypto.h" /* For signature size constant */
@@ -1660,3 +1666,2911 @@ int_fast32_t indef_array_and_map_test()
 
     return 0;
 }
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_batch_test()
+{
+    /* More than T_COSE_BATCH_GROUP_SIZE so there are two groups */
+    #define NUM_BATCH_TEST_ITEMS 21
+    static uint8_t                        payload_bytes[700];
+    static uint8_t                        out_bytes[NUM_BATCH_TEST_ITEMS][800];
+    struct t_cose_sign1_sign_ctx          sign_ctx;
+    struct t_cose_sign1_verify_ctx        verify_ctx;
+    struct t_cose_sign1_sign_batch_item   sign_items[NUM_BATCH_TEST_ITEMS];
+    struct t_cose_sign1_verify_batch_item verify_items[NUM_BATCH_TEST_ITEMS];
+    Q_USEFUL_BUF_MAKE_STACK_UB(           one_at_a_time_buffer, 800);
+    struct q_useful_buf_c                 one_at_a_time;
+    enum t_cose_err_t                     result;
+    size_t                                i;
+
+    for(i = 0; i < sizeof(payload_bytes); i++) {
+        payload_bytes[i] = (uint8_t)(i * 7);
+    }
+
+    /* Payloads of varied length, half with AAD. Item 5 has an output
+     * buffer that's too small. */
+    for(i = 0; i < NUM_BATCH_TEST_ITEMS; i++) {
+        sign_items[i].payload = (struct q_useful_buf_c){payload_bytes, i * 33};
+        sign_items[i].aad     = i & 1 ? Q_USEFUL_BUF_FROM_SZ_LITERAL("some aad") : NULL_Q_USEFUL_BUF_C;
+        sign_items[i].out_buf = (struct q_useful_buf){out_bytes[i], i == 5 ? 100 : sizeof(out_bytes[i])};
+    }
+
+    /* --- Sign them all --- */
+    t_cose_sign1_sign_init(&sign_ctx,
+                           T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                           T_COSE_ALGORITHM_ES256);
+    result = t_cose_sign1_sign_batch(&sign_ctx, sign_items, NUM_BATCH_TEST_ITEMS);
+    if(result != T_COSE_ERR_TOO_SMALL) {
+        return 1000 + (int32_t)result;
+    }
+
+    /* Short-circuit signatures are deterministic so the output must
+     * be the same as signing one at a time. */
+    for(i = 0; i < NUM_BATCH_TEST_ITEMS; i++) {
+        result = t_cose_sign1_sign_aad(&sign_ctx,
+                                       sign_items[i].payload,
+                                       sign_items[i].aad,
+                                       i == 5 ? (struct q_useful_buf){one_at_a_time_buffer.ptr, 100} :
+                                                one_at_a_time_buffer,
+                                      &one_at_a_time);
+        if(result != sign_items[i].err) {
+            return 2000 + (int32_t)i;
+        }
+        if(result == T_COSE_SUCCESS &&
+           q_useful_buf_compare(one_at_a_time, sign_items[i].result)) {
+            return 3000 + (int32_t)i;
+        }
+    }
+
+    /* --- Verify them all, one of them modified --- */
+    for(i = 0; i < NUM_BATCH_TEST_ITEMS; i++) {
+        verify_items[i].cose_sign1 = sign_items[i].result;
+        verify_items[i].aad        = sign_items[i].aad;
+    }
+    /* A byte near the end of the payload of item 17 */
+    out_bytes[17][sign_items[17].result.len - 70] ^= 1;
+    /* Item 5 wasn't signed */
+    verify_items[5].cose_sign1 = NULL_Q_USEFUL_BUF_C;
+
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_verify_batch(&verify_ctx, verify_items, NUM_BATCH_TEST_ITEMS);
+    if(result != T_COSE_ERR_CBOR_NOT_WELL_FORMED &&
+       result != T_COSE_ERR_SIGN1_FORMAT) {
+        return 4000 + (int32_t)result;
+    }
+    for(i = 0; i < NUM_BATCH_TEST_ITEMS; i++) {
+        if(i == 5) {
+            if(verify_items[i].err == T_COSE_SUCCESS) {
+                return 5000 + (int32_t)i;
+            }
+        } else if(i == 17) {
+            if(verify_items[i].err != T_COSE_ERR_SIG_VERIFY ||
+               !q_useful_buf_c_is_null(verify_items[i].payload)) {
+                return 6000 + (int32_t)verify_items[i].err;
+            }
+        } else {
+            if(verify_items[i].err) {
+                return 7000 + (int32_t)i;
+            }
+            if(q_useful_buf_compare(verify_items[i].payload, sign_items[i].payload)) {
+                return 8000 + (int32_t)i;
+            }
+            if(verify_items[i].parameters.cose_algorithm_id != T_COSE_ALGORITHM_ES256) {
+                return 9000 + (int32_t)i;
+            }
+        }
+    }
+
+    /* --- Short-circuit signatures must be refused unless allowed --- */
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    result = t_cose_sign1_verify_batch(&verify_ctx, verify_items, 3);
+    if(result != T_COSE_ERR_SHORT_CIRCUIT_SIG) {
+        return 10000 + (int32_t)result;
+    }
+
+    /* --- Decode only works without allowing short-circuit --- */
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_DECODE_ONLY);
+    result = t_cose_sign1_verify_batch(&verify_ctx, &verify_items[16], 2);
+    if(result != T_COSE_SUCCESS) {
+        return 11000 + (int32_t)result;
+    }
+
+    /* --- An empty batch is fine --- */
+    result = t_cose_sign1_verify_batch(&verify_ctx, verify_items, 0);
+    if(result != T_COSE_SUCCESS) {
+        return 12000 + (int32_t)result;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_shared_config_test()
+{
+    struct t_cose_sign1_signer            signer;
+    struct t_cose_sign1_signer            signer_copy;
+    struct t_cose_sign1_verifier          verifier;
+    struct t_cose_sign1_verify_call       verify_call;
+    struct t_cose_sign1_sign_ctx          sign_ctx;
+    struct t_cose_sign1_sign_batch_item   sign_items[3];
+    struct t_cose_sign1_verify_batch_item verify_items[3];
+    static uint8_t                        out_bytes[3][200];
+    Q_USEFUL_BUF_MAKE_STACK_UB(           signed_cose_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(           ctx_cose_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(           tagged_buffer, 210);
+    struct q_useful_buf_c                 signed_cose;
+    struct q_useful_buf_c                 ctx_cose;
+    struct q_useful_buf_c                 tagged_cose;
+    struct q_useful_buf_c                 payload;
+    struct t_cose_parameters              parameters;
+    QCBOREncodeContext                    cbor_encode;
+    enum t_cose_err_t                     result;
+    size_t                                i;
+
+    /* --- Set up once --- */
+    result = t_cose_sign1_signer_init(&signer,
+                                      T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                                      T_COSE_ALGORITHM_ES256);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    t_cose_sign1_signer_set_content_type_uint(&signer, 42);
+#endif
+    memcpy(&signer_copy, &signer, sizeof(signer));
+
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+
+    /* --- Same as a context set up the same way --- */
+    result = t_cose_sign1_signer_sign(&signer,
+                                      NULL,
+                                      NULL_Q_USEFUL_BUF_C,
+                                      s_input_payload,
+                                      signed_cose_buffer,
+                                     &signed_cose);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    t_cose_sign1_set_content_type_uint(&sign_ctx, 42);
+#endif
+    result = t_cose_sign1_sign(&sign_ctx, s_input_payload, ctx_cose_buffer, &ctx_cose);
+    if(result) {
+        return 2100 + (int32_t)result;
+    }
+    if(q_useful_buf_compare(signed_cose, ctx_cose)) {
+        return 2200;
+    }
+
+    /* --- Verify, with the per-call state on the stack --- */
+    t_cose_sign1_verify_call_init(&verify_call, NULL_Q_USEFUL_BUF);
+    result = t_cose_sign1_verifier_verify(&verifier,
+                                         &verify_call,
+                                          signed_cose,
+                                          NULL_Q_USEFUL_BUF_C,
+                                         &payload,
+                                         &parameters);
+    if(result) {
+        return 3000 + (int32_t)result;
+    }
+    if(q_useful_buf_compare(payload, s_input_payload)) {
+        return 3100;
+    }
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    if(parameters.content_type_uint != 42) {
+        return 3200;
+    }
+#endif
+    if(t_cose_sign1_verify_call_nth_tag(&verify_call, 0) != CBOR_TAG_INVALID64) {
+        return 3300;
+    }
+
+    /* --- The extra tags come back in the call --- */
+    QCBOREncode_Init(&cbor_encode, tagged_buffer);
+    QCBOREncode_AddTag(&cbor_encode, CBOR_TAG_CWT);
+    QCBOREncode_AddEncoded(&cbor_encode, signed_cose);
+    if(QCBOREncode_Finish(&cbor_encode, &tagged_cose)) {
+        return 3400;
+    }
+    result = t_cose_sign1_verifier_verify(&verifier,
+                                         &verify_call,
+                                          tagged_cose,
+                                          NULL_Q_USEFUL_BUF_C,
+                                         &payload,
+                                          NULL);
+    if(result) {
+        return 3500 + (int32_t)result;
+    }
+    if(t_cose_sign1_verify_call_nth_tag(&verify_call, 0) != CBOR_TAG_CWT ||
+       t_cose_sign1_verify_call_nth_tag(&verify_call, 1) != CBOR_TAG_INVALID64) {
+        return 3600;
+    }
+
+    /* --- AAD and detached, with no per-call state --- */
+    result = t_cose_sign1_signer_sign_detached(&signer,
+                                               NULL,
+                                               Q_USEFUL_BUF_FROM_SZ_LITERAL("aad"),
+                                               s_input_payload,
+                                               signed_cose_buffer,
+                                              &signed_cose);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    result = t_cose_sign1_verifier_verify_detached(&verifier,
+                                                   NULL,
+                                                   signed_cose,
+                                                   Q_USEFUL_BUF_FROM_SZ_LITERAL("aad"),
+                                                   s_input_payload,
+                                                   NULL);
+    if(result) {
+        return 4100 + (int32_t)result;
+    }
+    result = t_cose_sign1_verifier_verify_detached(&verifier,
+                                                   NULL,
+                                                   signed_cose,
+                                                   NULL_Q_USEFUL_BUF_C,
+                                                   s_input_payload,
+                                                   NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 4200 + (int32_t)result;
+    }
+
+    /* --- Batches --- */
+    for(i = 0; i < 3; i++) {
+        sign_items[i].payload = (struct q_useful_buf_c){s_input_payload.ptr, s_input_payload.len - i};
+        sign_items[i].aad     = NULL_Q_USEFUL_BUF_C;
+        sign_items[i].out_buf = (struct q_useful_buf){out_bytes[i], sizeof(out_bytes[i])};
+    }
+    result = t_cose_sign1_signer_sign_batch(&signer, NULL, sign_items, 3);
+    if(result) {
+        return 5000 + (int32_t)result;
+    }
+    for(i = 0; i < 3; i++) {
+        verify_items[i].cose_sign1 = sign_items[i].result;
+        verify_items[i].aad        = NULL_Q_USEFUL_BUF_C;
+    }
+    result = t_cose_sign1_verifier_verify_batch(&verifier, NULL, verify_items, 3);
+    if(result) {
+        return 5100 + (int32_t)result;
+    }
+    for(i = 0; i < 3; i++) {
+        if(q_useful_buf_compare(verify_items[i].payload, sign_items[i].payload)) {
+            return 5200 + (int32_t)i;
+        }
+    }
+
+    /* --- Nothing in the configuration changed --- */
+    if(memcmp(&signer, &signer_copy, sizeof(signer))) {
+        return 6000;
+    }
+
+    /* --- A bad algorithm is caught at set up and when signing --- */
+    result = t_cose_sign1_signer_init(&signer, T_COSE_OPT_SHORT_CIRCUIT_SIG, -1000);
+    if(result != T_COSE_ERR_UNSUPPORTED_SIGNING_ALG) {
+        return 7000 + (int32_t)result;
+    }
+    result = t_cose_sign1_signer_sign(&signer,
+                                      NULL,
+                                      NULL_Q_USEFUL_BUF_C,
+                                      s_input_payload,
+                                      signed_cose_buffer,
+                                     &signed_cose);
+    if(result != T_COSE_ERR_UNSUPPORTED_SIGNING_ALG) {
+        return 7100 + (int32_t)result;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_reserve_payload_test()
+{
+    struct t_cose_sign1_signer      signer;
+    struct t_cose_sign1_verifier    verifier;
+    struct t_cose_sign1_sign_ctx    sign_ctx;
+    struct t_cose_sign1_reservation reservation;
+    struct q_useful_buf             payload_slot;
+    static uint8_t                  payload_bytes[300];
+    static uint8_t                  reserved_bytes[500];
+    static uint8_t                  expected_bytes[500];
+    struct q_useful_buf_c           reserved_cose;
+    struct q_useful_buf_c           expected_cose;
+    struct q_useful_buf_c           payload;
+    struct q_useful_buf_c           aad = Q_USEFUL_BUF_FROM_SZ_LITERAL("aad");
+    enum t_cose_err_t               result;
+    size_t                          i;
+    size_t                          size;
+
+    /* Long enough that its length is not in the initial byte */
+    for(i = 0; i < sizeof(payload_bytes); i++) {
+        payload_bytes[i] = (uint8_t)i;
+    }
+    payload = (struct q_useful_buf_c){payload_bytes, sizeof(payload_bytes)};
+
+    result = t_cose_sign1_signer_init(&signer,
+                                      T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                                      T_COSE_ALGORITHM_ES256);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+
+    result = t_cose_sign1_signer_sign(&signer,
+                                      NULL,
+                                      aad,
+                                      payload,
+                                      Q_USEFUL_BUF_FROM_BYTE_ARRAY(expected_bytes),
+                                     &expected_cose);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+
+    /* --- Same bytes as signing in one go --- */
+    result = t_cose_sign1_signer_reserve_payload(&signer,
+                                                 payload.len,
+                                                 Q_USEFUL_BUF_FROM_BYTE_ARRAY(reserved_bytes),
+                                                &reservation,
+                                                &payload_slot);
+    if(result) {
+        return 3000 + (int32_t)result;
+    }
+    if(payload_slot.len != payload.len ||
+       (uint8_t *)payload_slot.ptr <= reserved_bytes ||
+       (uint8_t *)payload_slot.ptr + payload_slot.len > reserved_bytes + sizeof(reserved_bytes)) {
+        return 3100;
+    }
+    memcpy(payload_slot.ptr, payload.ptr, payload.len);
+    result = t_cose_sign1_signer_sign_reserved(&signer,
+                                               NULL,
+                                              &reservation,
+                                               aad,
+                                              &reserved_cose);
+    if(result) {
+        return 3200 + (int32_t)result;
+    }
+    if(reserved_cose.ptr != reserved_bytes ||
+       q_useful_buf_compare(reserved_cose, expected_cose)) {
+        return 3300;
+    }
+
+    result = t_cose_sign1_verifier_verify(&verifier,
+                                          NULL,
+                                          reserved_cose,
+                                          aad,
+                                         &payload,
+                                          NULL);
+    if(result) {
+        return 3400 + (int32_t)result;
+    }
+    if(payload.ptr != payload_slot.ptr || payload.len != sizeof(payload_bytes)) {
+        return 3500;
+    }
+
+    /* --- Size calculation --- */
+    result = t_cose_sign1_signer_reserve_payload(&signer,
+                                                 sizeof(payload_bytes),
+                                                 (struct q_useful_buf){NULL, SIZE_MAX},
+                                                &reservation,
+                                                &payload_slot);
+    if(result || payload_slot.ptr != NULL) {
+        return 4000 + (int32_t)result;
+    }
+    result = t_cose_sign1_signer_sign_reserved(&signer,
+                                               NULL,
+                                              &reservation,
+                                               aad,
+                                              &reserved_cose);
+    if(result) {
+        return 4100 + (int32_t)result;
+    }
+    if(reserved_cose.ptr != NULL || reserved_cose.len != expected_cose.len) {
+        return 4200;
+    }
+    size = reserved_cose.len;
+
+    /* --- Too small by one, which is the last byte of the signature --- */
+    result = t_cose_sign1_signer_reserve_payload(&signer,
+                                                 sizeof(payload_bytes),
+                                                 (struct q_useful_buf){reserved_bytes, size - 1},
+                                                &reservation,
+                                                &payload_slot);
+    if(result != T_COSE_ERR_TOO_SMALL) {
+        return 5000 + (int32_t)result;
+    }
+    /* Signing after a failed reservation is an error, not a crash */
+    result = t_cose_sign1_signer_sign_reserved(&signer,
+                                               NULL,
+                                              &reservation,
+                                               aad,
+                                              &reserved_cose);
+    if(result != T_COSE_ERR_INVALID_ARGUMENT) {
+        return 5100 + (int32_t)result;
+    }
+
+    /* --- With a context, no AAD and an empty payload --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES384);
+    result = t_cose_sign1_sign(&sign_ctx,
+                               NULL_Q_USEFUL_BUF_C,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY(expected_bytes),
+                              &expected_cose);
+    if(result) {
+        return 6000 + (int32_t)result;
+    }
+    result = t_cose_sign1_reserve_payload(&sign_ctx,
+                                          0,
+                                          Q_USEFUL_BUF_FROM_BYTE_ARRAY(reserved_bytes),
+                                         &reservation,
+                                         &payload_slot);
+    if(result) {
+        return 6100 + (int32_t)result;
+    }
+    result = t_cose_sign1_sign_reserved(&sign_ctx,
+                                       &reservation,
+                                        NULL_Q_USEFUL_BUF_C,
+                                       &reserved_cose);
+    if(result) {
+        return 6200 + (int32_t)result;
+    }
+    if(q_useful_buf_compare(reserved_cose, expected_cose)) {
+        return 6300;
+    }
+
+    /* --- A bad algorithm is caught when reserving --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, -1000);
+    result = t_cose_sign1_reserve_payload(&sign_ctx,
+                                          0,
+                                          Q_USEFUL_BUF_FROM_BYTE_ARRAY(reserved_bytes),
+                                         &reservation,
+                                         &payload_slot);
+    if(result != T_COSE_ERR_UNSUPPORTED_SIGNING_ALG) {
+        return 7000 + (int32_t)result;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_iovec_test()
+{
+    struct t_cose_sign1_signer   signer;
+    struct t_cose_sign1_verifier verifier;
+    struct t_cose_sign1_sign_ctx sign_ctx;
+    struct t_cose_sign1_iovec    iovec;
+    Q_USEFUL_BUF_MAKE_STACK_UB(  header_buffer, 100);
+    Q_USEFUL_BUF_MAKE_STACK_UB(  trailer_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(  expected_buffer, 300);
+    Q_USEFUL_BUF_MAKE_STACK_UB(  joined_buffer, 300);
+    struct q_useful_buf_c        expected_cose;
+    struct q_useful_buf_c        joined_cose;
+    struct q_useful_buf_c        payload;
+    struct q_useful_buf_c        aad = Q_USEFUL_BUF_FROM_SZ_LITERAL("aad");
+    UsefulOutBuf                 joined;
+    enum t_cose_err_t            result;
+
+    result = t_cose_sign1_signer_init(&signer,
+                                      T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                                      T_COSE_ALGORITHM_ES256);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+
+    result = t_cose_sign1_signer_sign(&signer,
+                                      NULL,
+                                      aad,
+                                      s_input_payload,
+                                      expected_buffer,
+                                     &expected_cose);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+
+    /* --- The three pieces joined are the same message --- */
+    result = t_cose_sign1_signer_sign_iovec(&signer,
+                                            NULL,
+                                            aad,
+                                            s_input_payload,
+                                            header_buffer,
+                                            trailer_buffer,
+                                           &iovec);
+    if(result) {
+        return 3000 + (int32_t)result;
+    }
+    if(iovec.payload.ptr != s_input_payload.ptr ||
+       iovec.payload.len != s_input_payload.len ||
+       iovec.header.ptr != header_buffer.ptr ||
+       iovec.trailer.ptr != trailer_buffer.ptr) {
+        return 3100;
+    }
+    UsefulOutBuf_Init(&joined, joined_buffer);
+    UsefulOutBuf_AppendUsefulBuf(&joined, iovec.header);
+    UsefulOutBuf_AppendUsefulBuf(&joined, iovec.payload);
+    UsefulOutBuf_AppendUsefulBuf(&joined, iovec.trailer);
+    joined_cose = UsefulOutBuf_OutUBuf(&joined);
+    if(q_useful_buf_compare(joined_cose, expected_cose)) {
+        return 3200;
+    }
+    result = t_cose_sign1_verifier_verify(&verifier,
+                                          NULL,
+                                          joined_cose,
+                                          aad,
+                                         &payload,
+                                          NULL);
+    if(result) {
+        return 3300 + (int32_t)result;
+    }
+
+    /* --- Size calculation --- */
+    result = t_cose_sign1_signer_sign_iovec(&signer,
+                                            NULL,
+                                            aad,
+                                            s_input_payload,
+                                            (struct q_useful_buf){NULL, SIZE_MAX},
+                                            (struct q_useful_buf){NULL, SIZE_MAX},
+                                           &iovec);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    if(iovec.header.ptr != NULL || iovec.trailer.ptr != NULL ||
+       iovec.header.len + iovec.payload.len + iovec.trailer.len != expected_cose.len) {
+        return 4100;
+    }
+
+    /* --- Too small by one --- */
+    result = t_cose_sign1_signer_sign_iovec(&signer,
+                                            NULL,
+                                            aad,
+                                            s_input_payload,
+                                            header_buffer,
+                                            (struct q_useful_buf){trailer_buffer.ptr,
+                                                                  iovec.trailer.len - 1},
+                                           &iovec);
+    if(result != T_COSE_ERR_TOO_SMALL) {
+        return 5000 + (int32_t)result;
+    }
+    result = t_cose_sign1_signer_sign_iovec(&signer,
+                                            NULL,
+                                            aad,
+                                            s_input_payload,
+                                            (struct q_useful_buf){header_buffer.ptr, 10},
+                                            trailer_buffer,
+                                           &iovec);
+    if(result != T_COSE_ERR_TOO_SMALL) {
+        return 5100 + (int32_t)result;
+    }
+
+    /* --- With a context and no AAD --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES512);
+    result = t_cose_sign1_sign(&sign_ctx, s_input_payload, expected_buffer, &expected_cose);
+    if(result) {
+        return 6000 + (int32_t)result;
+    }
+    result = t_cose_sign1_sign_iovec(&sign_ctx,
+                                     NULL_Q_USEFUL_BUF_C,
+                                     s_input_payload,
+                                     header_buffer,
+                                     trailer_buffer,
+                                    &iovec);
+    if(result) {
+        return 6100 + (int32_t)result;
+    }
+    UsefulOutBuf_Init(&joined, joined_buffer);
+    UsefulOutBuf_AppendUsefulBuf(&joined, iovec.header);
+    UsefulOutBuf_AppendUsefulBuf(&joined, iovec.payload);
+    UsefulOutBuf_AppendUsefulBuf(&joined, iovec.trailer);
+    if(q_useful_buf_compare(UsefulOutBuf_OutUBuf(&joined), expected_cose)) {
+        return 6200;
+    }
+
+    return 0;
+}
+
+
+#ifndef T_COSE_DISABLE_SHORT_CIRCUIT_SIGN
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_parse_test()
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_verifier   verifier;
+    struct t_cose_sign1_parsed     parsed;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    tagged_buffer, 210);
+    struct q_useful_buf_c          signed_cose;
+    struct q_useful_buf_c          tagged_cose;
+    struct q_useful_buf_c          aad = Q_USEFUL_BUF_FROM_SZ_LITERAL("aad");
+    QCBOREncodeContext             cbor_encode;
+    size_t                         key_index;
+    enum t_cose_err_t              result;
+
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    t_cose_sign1_set_content_type_uint(&sign_ctx, 42);
+#endif
+    QCBOREncode_Init(&cbor_encode, signed_cose_buffer);
+    result = t_cose_sign1_encode_parameters(&sign_ctx, &cbor_encode);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+    QCBOREncode_AddEncoded(&cbor_encode, s_input_payload);
+    result = t_cose_sign1_encode_signature_aad(&sign_ctx, aad, &cbor_encode);
+    if(result) {
+        return 1100 + (int32_t)result;
+    }
+    if(QCBOREncode_Finish(&cbor_encode, &signed_cose)) {
+        return 1200;
+    }
+
+    /* Wrapped in a CWT tag, which comes back in parsed */
+    QCBOREncode_Init(&cbor_encode, tagged_buffer);
+    QCBOREncode_AddTag(&cbor_encode, CBOR_TAG_CWT);
+    QCBOREncode_AddEncoded(&cbor_encode, signed_cose);
+    if(QCBOREncode_Finish(&cbor_encode, &tagged_cose)) {
+        return 1300;
+    }
+
+    /* --- Parse and look at it before there's a key --- */
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    result = t_cose_sign1_parse(&verify_ctx, tagged_cose, &parsed);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+    if(q_useful_buf_compare(parsed.parameters.kid, get_short_circuit_kid()) ||
+       parsed.parameters.cose_algorithm_id != T_COSE_ALGORITHM_ES256) {
+        return 2100;
+    }
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    if(parsed.parameters.content_type_uint != 42) {
+        return 2200;
+    }
+#endif
+    /* The views point into the message */
+    if(q_useful_buf_compare(parsed.payload, s_input_payload) ||
+       (const uint8_t *)parsed.payload.ptr < (const uint8_t *)tagged_cose.ptr ||
+       (const uint8_t *)parsed.signature.ptr + parsed.signature.len !=
+           (const uint8_t *)tagged_cose.ptr + tagged_cose.len) {
+        return 2300;
+    }
+    if(t_cose_sign1_parsed_nth_tag(&parsed, 0) != CBOR_TAG_CWT ||
+       t_cose_sign1_parsed_nth_tag(&parsed, 1) != CBOR_TAG_INVALID64 ||
+       t_cose_sign1_parsed_nth_tag(&parsed, T_COSE_MAX_TAGS_TO_RETURN) != CBOR_TAG_INVALID64) {
+        return 2400;
+    }
+
+    /* --- Then verify it without decoding again --- */
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_verify_parsed(&verify_ctx, &parsed, aad);
+    if(result) {
+        return 3000 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify_parsed(&verify_ctx, &parsed, NULL_Q_USEFUL_BUF_C);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 3100 + (int32_t)result;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, 0);
+    result = t_cose_sign1_verify_parsed(&verify_ctx, &parsed, aad);
+    if(result != T_COSE_ERR_SHORT_CIRCUIT_SIG) {
+        return 3200 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify_parsed_detached(&verify_ctx, &parsed, aad, s_input_payload);
+    if(result != T_COSE_ERR_CBOR_FORMATTING) {
+        return 3300 + (int32_t)result;
+    }
+
+    /* --- Parsing checks the same options verifying does --- */
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_TAG_PROHIBITED);
+    result = t_cose_sign1_verifier_parse(&verifier, tagged_cose, &parsed);
+    if(result != T_COSE_ERR_INCORRECTLY_TAGGED) {
+        return 4000 + (int32_t)result;
+    }
+    result = t_cose_sign1_verifier_parse(&verifier, s_input_payload, &parsed);
+    if(result != T_COSE_ERR_SIGN1_FORMAT && result != T_COSE_ERR_CBOR_NOT_WELL_FORMED) {
+        return 4100 + (int32_t)result;
+    }
+
+    /* --- Detached --- */
+    result = t_cose_sign1_sign_detached(&sign_ctx,
+                                        aad,
+                                        s_input_payload,
+                                        signed_cose_buffer,
+                                       &signed_cose);
+    if(result) {
+        return 5000 + (int32_t)result;
+    }
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_verifier_parse(&verifier, signed_cose, &parsed);
+    if(result) {
+        return 5100 + (int32_t)result;
+    }
+    if(!q_useful_buf_c_is_null(parsed.payload) ||
+       t_cose_sign1_parsed_nth_tag(&parsed, 0) != CBOR_TAG_INVALID64) {
+        return 5200;
+    }
+    result = t_cose_sign1_verifier_verify_parsed_detached(&verifier,
+                                                          NULL,
+                                                         &parsed,
+                                                          aad,
+                                                          s_input_payload);
+    if(result) {
+        return 5300 + (int32_t)result;
+    }
+    result = t_cose_sign1_verifier_verify_parsed(&verifier, NULL, &parsed, aad);
+    if(result != T_COSE_ERR_SIGN1_FORMAT) {
+        return 5400 + (int32_t)result;
+    }
+
+    /* --- Candidate keys aren't needed for short-circuit --- */
+    result = t_cose_sign1_verifier_verify_parsed_any_key_detached(&verifier,
+                                                                  NULL,
+                                                                 &parsed,
+                                                                  aad,
+                                                                  s_input_payload,
+                                                                  NULL,
+                                                                  0,
+                                                                 &key_index);
+    if(result || key_index != SIZE_MAX) {
+        return 6000 + (int32_t)result;
+    }
+    t_cose_sign1_verifier_init(&verifier, 0);
+    result = t_cose_sign1_verifier_verify_parsed_any_key_detached(&verifier,
+                                                                  NULL,
+                                                                 &parsed,
+                                                                  aad,
+                                                                  s_input_payload,
+                                                                  NULL,
+                                                                  0,
+                                                                 &key_index);
+    if(result != T_COSE_ERR_SHORT_CIRCUIT_SIG) {
+        return 6100 + (int32_t)result;
+    }
+
+    return 0;
+}
+#endif /* T_COSE_DISABLE_SHORT_CIRCUIT_SIGN */
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_policy_test()
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_verifier   verifier;
+    struct t_cose_sign1_parsed     parsed;
+    struct t_cose_sign1_policy     policy;
+    struct t_cose_sign1_policy_alg algorithms[2];
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 200);
+    struct q_useful_buf_c          signed_cose;
+    struct q_useful_buf_c          payload;
+    enum t_cose_err_t              result;
+
+    /* Tagged, with the short-circuit kid */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = t_cose_sign1_sign(&sign_ctx, s_input_payload, signed_cose_buffer, &signed_cose);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_parse(&verify_ctx, signed_cose, &parsed);
+    if(result) {
+        return 1100 + (int32_t)result;
+    }
+
+    /* --- A policy with no limits changes nothing --- */
+    t_cose_sign1_policy_init(&policy);
+    t_cose_sign1_verify_set_policy(&verify_ctx, &policy);
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+
+    /* --- Each limit, just inside and just outside --- */
+    policy.max_message_size = signed_cose.len;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 3000 + (int32_t)result;
+    }
+    policy.max_message_size = signed_cose.len - 1;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_POLICY_SIZE) {
+        return 3100 + (int32_t)result;
+    }
+    t_cose_sign1_policy_init(&policy);
+
+    policy.max_tags = 1;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    policy.max_tags = 0;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_TOO_MANY_TAGS) {
+        return 4100 + (int32_t)result;
+    }
+    t_cose_sign1_policy_init(&policy);
+
+    policy.max_protected_size = parsed.protected_parameters.len;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 5000 + (int32_t)result;
+    }
+    policy.max_protected_size = parsed.protected_parameters.len - 1;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_POLICY_SIZE) {
+        return 5100 + (int32_t)result;
+    }
+    t_cose_sign1_policy_init(&policy);
+
+    algorithms[0].cose_algorithm_id = T_COSE_ALGORITHM_ES384;
+    algorithms[0].signature_size    = 0;
+    algorithms[1].cose_algorithm_id = T_COSE_ALGORITHM_ES256;
+    algorithms[1].signature_size    = parsed.signature.len;
+    policy.algorithms     = algorithms;
+    policy.num_algorithms = 2;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 6000 + (int32_t)result;
+    }
+    algorithms[1].signature_size = parsed.signature.len + 1;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_POLICY_SIGNATURE_SIZE) {
+        return 6100 + (int32_t)result;
+    }
+    policy.num_algorithms = 1;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_POLICY_ALGORITHM) {
+        return 6200 + (int32_t)result;
+    }
+    t_cose_sign1_policy_init(&policy);
+
+    policy.kid_size = parsed.parameters.kid.len;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 7000 + (int32_t)result;
+    }
+    policy.kid_size = 8;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_POLICY_KID) {
+        return 7100 + (int32_t)result;
+    }
+    t_cose_sign1_policy_init(&policy);
+
+    /* Parsing checks the policy too */
+    policy.max_payload_size = s_input_payload.len;
+    result = t_cose_sign1_parse(&verify_ctx, signed_cose, &parsed);
+    if(result) {
+        return 8000 + (int32_t)result;
+    }
+    policy.max_payload_size = s_input_payload.len - 1;
+    result = t_cose_sign1_parse(&verify_ctx, signed_cose, &parsed);
+    if(result != T_COSE_ERR_POLICY_SIZE) {
+        return 8100 + (int32_t)result;
+    }
+
+    /* --- A detached payload with a shared configuration --- */
+    result = t_cose_sign1_sign_detached(&sign_ctx,
+                                        NULL_Q_USEFUL_BUF_C,
+                                        s_input_payload,
+                                        signed_cose_buffer,
+                                       &signed_cose);
+    if(result) {
+        return 9000 + (int32_t)result;
+    }
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    t_cose_sign1_verifier_set_policy(&verifier, &policy);
+    result = t_cose_sign1_verifier_verify_detached(&verifier,
+                                                   NULL,
+                                                   signed_cose,
+                                                   NULL_Q_USEFUL_BUF_C,
+                                                   s_input_payload,
+                                                   NULL);
+    if(result != T_COSE_ERR_POLICY_SIZE) {
+        return 9100 + (int32_t)result;
+    }
+    result = t_cose_sign1_verifier_parse(&verifier, signed_cose, &parsed);
+    if(result) {
+        return 9200 + (int32_t)result;
+    }
+    result = t_cose_sign1_verifier_verify_parsed_detached(&verifier,
+                                                          NULL,
+                                                         &parsed,
+                                                          NULL_Q_USEFUL_BUF_C,
+                                                          s_input_payload);
+    if(result != T_COSE_ERR_POLICY_SIZE) {
+        return 9300 + (int32_t)result;
+    }
+    policy.max_payload_size = s_input_payload.len;
+    result = t_cose_sign1_verifier_verify_parsed_detached(&verifier,
+                                                          NULL,
+                                                         &parsed,
+                                                          NULL_Q_USEFUL_BUF_C,
+                                                          s_input_payload);
+    if(result) {
+        return 9400 + (int32_t)result;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_header_cache_test()
+{
+    struct t_cose_sign1_sign_ctx     sign_ctx;
+    struct t_cose_sign1_verify_ctx   verify_ctx;
+    struct t_cose_sign1_verify_ctx   uncached_ctx;
+    struct t_cose_header_cache       cache;
+    struct t_cose_header_cache_entry entries[2];
+    struct t_cose_sign1_parsed       parsed;
+    struct t_cose_parameters         parameters;
+    Q_USEFUL_BUF_MAKE_STACK_UB(      signed_cose_buffer, 200);
+    struct q_useful_buf_c            signed_cose;
+    struct q_useful_buf_c            payload;
+    enum t_cose_err_t                result;
+    int                              i;
+    size_t                           kid_offset;
+
+    t_cose_header_cache_init(&cache, entries, 2);
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    t_cose_sign1_verify_set_header_cache(&verify_ctx, &cache);
+    t_cose_sign1_verify_init(&uncached_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = t_cose_sign1_sign(&sign_ctx, s_input_payload, signed_cose_buffer, &signed_cose);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    /* --- The first time fills the cache, after that it is used --- */
+    for(i = 0; i < 3; i++) {
+        result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, &parameters);
+        if(result) {
+            return 2000 + (int32_t)result;
+        }
+        if(parameters.cose_algorithm_id != T_COSE_ALGORITHM_ES256 ||
+           q_useful_buf_compare(payload, s_input_payload)) {
+            return 2100;
+        }
+        /* Parameters from the cache still point into the message */
+        kid_offset = (size_t)((const uint8_t *)parameters.kid.ptr -
+                              (const uint8_t *)signed_cose.ptr);
+        if(kid_offset >= signed_cose.len) {
+            return 2200;
+        }
+    }
+    if(entries[0].protected_len == 0 || entries[1].protected_len != 0) {
+        return 2300;
+    }
+
+    /* A changed payload still fails from the saved hash state */
+    ((uint8_t *)signed_cose_buffer.ptr)[signed_cose.len - 70] ^= 0x01;
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 3000 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify(&uncached_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 3100 + (int32_t)result;
+    }
+    ((uint8_t *)signed_cose_buffer.ptr)[signed_cose.len - 70] ^= 0x01;
+
+    /* A parsed message uses the saved hash state too */
+    result = t_cose_sign1_parse(&verify_ctx, signed_cose, &parsed);
+    if(result) {
+        return 3200 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify_parsed(&verify_ctx, &parsed, NULL_Q_USEFUL_BUF_C);
+    if(result) {
+        return 3300 + (int32_t)result;
+    }
+
+    /* --- Different protected parameters take the other entry --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES384);
+    result = t_cose_sign1_sign(&sign_ctx, s_input_payload, signed_cose_buffer, &signed_cose);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    for(i = 0; i < 2; i++) {
+        result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, &parameters);
+        if(result) {
+            return 4100 + (int32_t)result;
+        }
+        if(parameters.cose_algorithm_id != T_COSE_ALGORITHM_ES384) {
+            return 4200;
+        }
+    }
+    if(entries[1].protected_len == 0) {
+        return 4300;
+    }
+
+    /* A third replaces the least recently used, the first one */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES512);
+    result = t_cose_sign1_sign(&sign_ctx, s_input_payload, signed_cose_buffer, &signed_cose);
+    if(result) {
+        return 5000 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, &parameters);
+    if(result) {
+        return 5100 + (int32_t)result;
+    }
+    if(entries[0].parameters.cose_algorithm_id != T_COSE_ALGORITHM_ES512 ||
+       entries[1].parameters.cose_algorithm_id != T_COSE_ALGORITHM_ES384) {
+        return 5200;
+    }
+
+    /* --- Critical parameters are never cached --- */
+    t_cose_header_cache_clear(&cache);
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = t_cose_test_message_sign1_sign(&sign_ctx,
+                                            T_COSE_TEST_UNKNOWN_CRIT_UINT_PARAMETER,
+                                            s_input_payload,
+                                            signed_cose_buffer,
+                                           &signed_cose);
+    if(result) {
+        return 6000 + (int32_t)result;
+    }
+    t_cose_sign1_verify_init(&uncached_ctx,
+                             T_COSE_OPT_ALLOW_SHORT_CIRCUIT | T_COSE_OPT_UNKNOWN_CRIT_ALLOWED);
+    t_cose_sign1_verify_set_header_cache(&uncached_ctx, &cache);
+    result = t_cose_sign1_verify(&uncached_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 6100 + (int32_t)result;
+    }
+    if(entries[0].protected_len != 0) {
+        return 6200;
+    }
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result != T_COSE_ERR_UNKNOWN_CRITICAL_PARAMETER) {
+        return 6300 + (int32_t)result;
+    }
+
+    t_cose_header_cache_clear(&cache);
+
+    return 0;
+}
+
+
+/* The most payloads short_circuit_merkle_test() signs in one tree */
+#define MERKLE_TEST_MAX_PAYLOADS 40
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_merkle_test()
+{
+    static const int32_t algs[] = {
+        T_COSE_ALGORITHM_ES256, T_COSE_ALGORITHM_ES384, T_COSE_ALGORITHM_ES512
+    };
+    static uint8_t                 tree_buffer[T_COSE_MERKLE_TREE_BUFFER_SIZE(MERKLE_TEST_MAX_PAYLOADS)];
+    uint8_t                        payload_bytes[MERKLE_TEST_MAX_PAYLOADS];
+    struct q_useful_buf_c          payloads[MERKLE_TEST_MAX_PAYLOADS];
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_verify_ctx uncached_ctx;
+    struct t_cose_receipt_cache    cache;
+    struct t_cose_merkle_tree      tree;
+    struct t_cose_parameters       parameters;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_root_buffer, 300);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    receipt_buffer, 800);
+    struct q_useful_buf_c          receipt;
+    enum t_cose_err_t              result;
+    size_t                         num_payloads;
+    size_t                         i;
+    size_t                         index_offset;
+    uint8_t                       *receipt_bytes;
+
+    /* Each payload is a different length so they're all different */
+    for(i = 0; i < MERKLE_TEST_MAX_PAYLOADS; i++) {
+        payload_bytes[i] = (uint8_t)i;
+        payloads[i] = (struct q_useful_buf_c){payload_bytes, i + 1};
+    }
+
+    t_cose_receipt_cache_init(&cache);
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    t_cose_sign1_verify_set_receipt_cache(&verify_ctx, &cache);
+    t_cose_sign1_verify_init(&uncached_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+
+    /* --- Every payload of every size of tree verifies --- */
+    for(num_payloads = 1; num_payloads <= MERKLE_TEST_MAX_PAYLOADS; num_payloads++) {
+        t_cose_sign1_sign_init(&sign_ctx,
+                               T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                               algs[num_payloads % 3]);
+        result = t_cose_sign1_sign_merkle(&sign_ctx,
+                                          payloads,
+                                          num_payloads,
+                                          Q_USEFUL_BUF_FROM_BYTE_ARRAY(tree_buffer),
+                                          signed_root_buffer,
+                                         &tree);
+        if(result) {
+            return 1000 + (int32_t)result;
+        }
+
+        for(i = 0; i < num_payloads; i++) {
+            result = t_cose_merkle_tree_receipt(&tree, i, receipt_buffer, &receipt);
+            if(result) {
+                return 2000 + (int32_t)result;
+            }
+            result = t_cose_sign1_verify_receipt(&verify_ctx,
+                                                 receipt,
+                                                 payloads[i],
+                                                &parameters);
+            if(result) {
+                return 3000 + (int32_t)result;
+            }
+            if(parameters.cose_algorithm_id != algs[num_payloads % 3]) {
+                return 3100;
+            }
+            result = t_cose_sign1_verify_receipt(&uncached_ctx,
+                                                 receipt,
+                                                 payloads[i],
+                                                 NULL);
+            if(result) {
+                return 3200 + (int32_t)result;
+            }
+
+            /* Not for any of the other payloads */
+            result = t_cose_sign1_verify_receipt(&verify_ctx,
+                                                 receipt,
+                                                 payloads[(i + 1) % MERKLE_TEST_MAX_PAYLOADS],
+                                                 NULL);
+            if(result != T_COSE_ERR_SIG_VERIFY) {
+                return 3300 + (int32_t)result;
+            }
+        }
+
+        result = t_cose_merkle_tree_receipt(&tree, num_payloads, receipt_buffer, &receipt);
+        if(result != T_COSE_ERR_INVALID_ARGUMENT) {
+            return 3400 + (int32_t)result;
+        }
+    }
+    if(cache.signed_root_len != tree.signed_root.len) {
+        return 3500;
+    }
+
+    /* --- Receipts with the wrong index or tree size --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = t_cose_sign1_sign_merkle(&sign_ctx,
+                                      payloads,
+                                      5,
+                                      Q_USEFUL_BUF_FROM_BYTE_ARRAY(tree_buffer),
+                                      signed_root_buffer,
+                                     &tree);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    result = t_cose_merkle_tree_receipt(&tree, 0, receipt_buffer, &receipt);
+    if(result) {
+        return 4100 + (int32_t)result;
+    }
+    /* The array head, the byte string head and the signed root */
+    index_offset = 3 + tree.signed_root.len;
+    receipt_bytes = (uint8_t *)receipt_buffer.ptr;
+    if(receipt_bytes[index_offset] != 0 || receipt_bytes[index_offset + 1] != 5) {
+        return 4200;
+    }
+
+    /* Index past the end of the tree */
+    receipt_bytes[index_offset] = 5;
+    result = t_cose_sign1_verify_receipt(&verify_ctx, receipt, payloads[0], NULL);
+    if(result != T_COSE_ERR_RECEIPT_FORMAT) {
+        return 4300 + (int32_t)result;
+    }
+    /* Another index with a path of the same length hashes wrong */
+    receipt_bytes[index_offset] = 1;
+    result = t_cose_sign1_verify_receipt(&verify_ctx, receipt, payloads[0], NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 4400 + (int32_t)result;
+    }
+    receipt_bytes[index_offset] = 0;
+
+    /* Tree sizes that need a longer and a shorter path */
+    receipt_bytes[index_offset + 1] = 9;
+    result = t_cose_sign1_verify_receipt(&verify_ctx, receipt, payloads[0], NULL);
+    if(result != T_COSE_ERR_RECEIPT_FORMAT) {
+        return 4500 + (int32_t)result;
+    }
+    receipt_bytes[index_offset + 1] = 2;
+    result = t_cose_sign1_verify_receipt(&verify_ctx, receipt, payloads[0], NULL);
+    if(result != T_COSE_ERR_RECEIPT_FORMAT) {
+        return 4600 + (int32_t)result;
+    }
+    receipt_bytes[index_offset + 1] = 5;
+
+    /* Truncated */
+    result = t_cose_sign1_verify_receipt(&verify_ctx,
+                                         (struct q_useful_buf_c){receipt.ptr, receipt.len - 1},
+                                         payloads[0],
+                                         NULL);
+    if(result != T_COSE_ERR_RECEIPT_FORMAT) {
+        return 4700 + (int32_t)result;
+    }
+
+    /* A changed signature is a different signed root, not a cache
+     * hit. Short-circuit signatures start with the hash. */
+    receipt_bytes[index_offset - 64] ^= 0x01;
+    result = t_cose_sign1_verify_receipt(&verify_ctx, receipt, payloads[0], NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 4800 + (int32_t)result;
+    }
+
+    /* Decode only verifies nothing */
+    t_cose_sign1_verify_init(&uncached_ctx, T_COSE_OPT_DECODE_ONLY);
+    result = t_cose_sign1_verify_receipt(&uncached_ctx, receipt, payloads[1], &parameters);
+    if(result || parameters.cose_algorithm_id != T_COSE_ALGORITHM_ES256) {
+        return 4900 + (int32_t)result;
+    }
+    receipt_bytes[index_offset - 64] ^= 0x01;
+    result = t_cose_sign1_verify_receipt(&verify_ctx, receipt, payloads[0], NULL);
+    if(result) {
+        return 5000 + (int32_t)result;
+    }
+
+    /* --- Signing errors --- */
+    result = t_cose_sign1_sign_merkle(&sign_ctx,
+                                      payloads,
+                                      0,
+                                      Q_USEFUL_BUF_FROM_BYTE_ARRAY(tree_buffer),
+                                      signed_root_buffer,
+                                     &tree);
+    if(result != T_COSE_ERR_INVALID_ARGUMENT) {
+        return 6000 + (int32_t)result;
+    }
+    /* Five payloads make 11 nodes */
+    result = t_cose_sign1_sign_merkle(&sign_ctx,
+                                      payloads,
+                                      5,
+                                      (struct q_useful_buf){tree_buffer, 10 * 32},
+                                      signed_root_buffer,
+                                     &tree);
+    if(result != T_COSE_ERR_TOO_SMALL) {
+        return 6100 + (int32_t)result;
+    }
+    result = t_cose_sign1_sign_merkle(&sign_ctx,
+                                      payloads,
+                                      5,
+                                      (struct q_useful_buf){tree_buffer, 11 * 32},
+                                      signed_root_buffer,
+                                     &tree);
+    if(result) {
+        return 6200 + (int32_t)result;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_hash_envelope_test()
+{
+    /* Stands in for the SHA-256 of a big file */
+    static const uint8_t           file_hash[32] = {
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20};
+    static const char              long_content_type[] =
+        "application/vnd.example.a-content-type-that-is-far-too-long+cbor";
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_signer     signer;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_sign1_verifier   verifier;
+    struct t_cose_parameters       parameters;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    plain_cose_buffer, 200);
+    struct q_useful_buf_c          signed_cose;
+    struct q_useful_buf_c          plain_cose;
+    struct q_useful_buf_c          payload;
+    uint8_t                        wrong_hash[sizeof(file_hash)];
+    enum t_cose_err_t              result;
+
+    /* --- Sign a hash envelope and verify it --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_hash_envelope(&sign_ctx, T_COSE_ALGORITHM_SHA_256, "text/plain");
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                               signed_cose_buffer,
+                              &signed_cose);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_verify_hash_envelope(&verify_ctx,
+                                               signed_cose,
+                                               T_COSE_ALGORITHM_SHA_256,
+                                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                                              &parameters);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+    if(parameters.payload_hash_alg != T_COSE_ALGORITHM_SHA_256 ||
+       q_useful_buf_compare(parameters.preimage_content_type_tstr,
+                            Q_USEFUL_BUF_FROM_SZ_LITERAL("text/plain")) ||
+       parameters.preimage_content_type_uint != T_COSE_EMPTY_UINT_CONTENT_TYPE) {
+        return 2100;
+    }
+
+    /* The two-step way when the hash algorithm isn't known first */
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, &parameters);
+    if(result) {
+        return 2200 + (int32_t)result;
+    }
+    if(parameters.payload_hash_alg != T_COSE_ALGORITHM_SHA_256 ||
+       q_useful_buf_compare(payload, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash))) {
+        return 2300;
+    }
+
+    /* --- Wrong hash algorithm and wrong hash --- */
+    result = t_cose_sign1_verify_hash_envelope(&verify_ctx,
+                                               signed_cose,
+                                               T_COSE_ALGORITHM_SHA_384,
+                                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                                               NULL);
+    if(result != T_COSE_ERR_PAYLOAD_HASH_ALG) {
+        return 3000 + (int32_t)result;
+    }
+
+    memcpy(wrong_hash, file_hash, sizeof(wrong_hash));
+    wrong_hash[31] ^= 0x01;
+    result = t_cose_sign1_verify_hash_envelope(&verify_ctx,
+                                               signed_cose,
+                                               T_COSE_ALGORITHM_SHA_256,
+                                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(wrong_hash),
+                                               NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 3100 + (int32_t)result;
+    }
+
+    /* --- A normal message is not a hash envelope --- */
+    t_cose_sign1_set_hash_envelope(&sign_ctx, T_COSE_UNSET_ALGORITHM_ID, NULL);
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                               plain_cose_buffer,
+                              &plain_cose);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    if(plain_cose.len >= signed_cose.len) {
+        return 4100;
+    }
+    result = t_cose_sign1_verify_hash_envelope(&verify_ctx,
+                                               plain_cose,
+                                               T_COSE_ALGORITHM_SHA_256,
+                                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                                               NULL);
+    if(result != T_COSE_ERR_PAYLOAD_HASH_ALG) {
+        return 4200 + (int32_t)result;
+    }
+
+#ifndef T_COSE_DISABLE_CONTENT_TYPE
+    /* --- No content type in a hash envelope --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_set_hash_envelope(&sign_ctx, T_COSE_ALGORITHM_SHA_256, NULL);
+    t_cose_sign1_set_content_type_uint(&sign_ctx, 60);
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                               signed_cose_buffer,
+                              &signed_cose);
+    if(result != T_COSE_ERR_BAD_CONTENT_TYPE) {
+        return 5000 + (int32_t)result;
+    }
+#endif /* T_COSE_DISABLE_CONTENT_TYPE */
+
+    /* --- Shared configuration --- */
+    result = t_cose_sign1_signer_init(&signer,
+                                      T_COSE_OPT_SHORT_CIRCUIT_SIG,
+                                      T_COSE_ALGORITHM_ES256);
+    if(result) {
+        return 6000 + (int32_t)result;
+    }
+    result = t_cose_sign1_signer_set_hash_envelope(&signer,
+                                                   T_COSE_ALGORITHM_SHA_256,
+                                                   long_content_type);
+    if(result != T_COSE_ERR_CBOR_FORMATTING) {
+        return 6100 + (int32_t)result;
+    }
+    result = t_cose_sign1_signer_set_hash_envelope(&signer,
+                                                   T_COSE_ALGORITHM_SHA_256,
+                                                   NULL);
+    if(result) {
+        return 6200 + (int32_t)result;
+    }
+    result = t_cose_sign1_signer_sign(&signer,
+                                      NULL,
+                                      NULL_Q_USEFUL_BUF_C,
+                                      Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                                      signed_cose_buffer,
+                                     &signed_cose);
+    if(result) {
+        return 6300 + (int32_t)result;
+    }
+
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_verifier_verify_hash_envelope(&verifier,
+                                                        NULL,
+                                                        signed_cose,
+                                                        T_COSE_ALGORITHM_SHA_256,
+                                                        Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(file_hash),
+                                                       &parameters);
+    if(result) {
+        return 6400 + (int32_t)result;
+    }
+    if(!q_useful_buf_c_is_null(parameters.preimage_content_type_tstr)) {
+        return 6500;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_cwt_template_test()
+{
+    /* The claims set from RFC 8392 A.1 */
+    static const uint8_t rfc8392_claims[] = {
+        0xa7, 0x01, 0x75, 0x63, 0x6f, 0x61, 0x70, 0x3a, 0x2f, 0x2f, 0x61,
+        0x73, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x63,
+        0x6f, 0x6d, 0x02, 0x65, 0x65, 0x72, 0x69, 0x6b, 0x77, 0x03, 0x78,
+        0x18, 0x63, 0x6f, 0x61, 0x70, 0x3a, 0x2f, 0x2f, 0x6c, 0x69, 0x67,
+        0x68, 0x74, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e,
+        0x63, 0x6f, 0x6d, 0x04, 0x1a, 0x56, 0x12, 0xae, 0xb0, 0x05, 0x1a,
+        0x56, 0x10, 0xd9, 0xf0, 0x06, 0x1a, 0x56, 0x10, 0xd9, 0xf0, 0x07,
+        0x42, 0x0b, 0x71};
+    static const uint8_t           cti[] = {0x0b, 0x71};
+    static const uint8_t           other_cti[] = {0xff, 0x00};
+    static const uint8_t           fixed_bytes[] = {0x01, 0x02, 0x03};
+    struct t_cose_cwt_template     tmpl;
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    QCBOREncodeContext             cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    template_buffer, 100);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    expected_buffer, 100);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 200);
+    struct q_useful_buf_c          template_payload;
+    struct q_useful_buf_c          expected;
+    struct q_useful_buf_c          signed_cose;
+    struct q_useful_buf_c          payload;
+    size_t                         exp_slot;
+    size_t                         nbf_slot;
+    size_t                         iat_slot;
+    size_t                         cti_slot;
+    enum t_cose_err_t              result;
+    int                            i;
+
+    /* --- The RFC 8392 example from a template --- */
+    t_cose_cwt_template_init(&tmpl, template_buffer);
+    t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_ISS, "coap://as.example.com");
+    t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_SUB, "erikw");
+    t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_AUD, "coap://light.example.com");
+    exp_slot = t_cose_cwt_template_add_uint_slot(&tmpl, T_COSE_CWT_CLAIM_EXP);
+    nbf_slot = t_cose_cwt_template_add_uint_slot(&tmpl, T_COSE_CWT_CLAIM_NBF);
+    iat_slot = t_cose_cwt_template_add_uint_slot(&tmpl, T_COSE_CWT_CLAIM_IAT);
+    cti_slot = t_cose_cwt_template_add_bstr_slot(&tmpl, T_COSE_CWT_CLAIM_CTI, sizeof(cti));
+    result = t_cose_cwt_template_finish(&tmpl, &template_payload);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    if(t_cose_cwt_template_set_uint(&tmpl, exp_slot, 1444064944) ||
+       t_cose_cwt_template_set_uint(&tmpl, nbf_slot, 1443944944) ||
+       t_cose_cwt_template_set_uint(&tmpl, iat_slot, 1443944944) ||
+       t_cose_cwt_template_set_bstr(&tmpl, cti_slot, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cti))) {
+        return 1100;
+    }
+    if(q_useful_buf_compare(template_payload,
+                            Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(rfc8392_claims))) {
+        return 1200;
+    }
+
+    /* --- Sign, change the slots in place and sign again --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    for(i = 0; i < 2; i++) {
+        result = t_cose_sign1_sign(&sign_ctx,
+                                   template_payload,
+                                   signed_cose_buffer,
+                                  &signed_cose);
+        if(result) {
+            return 2000 + (int32_t)result;
+        }
+        result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+        if(result) {
+            return 2100 + (int32_t)result;
+        }
+        if(q_useful_buf_compare(payload, template_payload)) {
+            return 2200;
+        }
+
+        if(t_cose_cwt_template_set_uint(&tmpl, exp_slot, 0xfedcba98) ||
+           t_cose_cwt_template_set_bstr(&tmpl, cti_slot, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(other_cti))) {
+            return 2300;
+        }
+    }
+    /* exp is the 4 bytes after its label and head */
+    if(((const uint8_t *)template_payload.ptr)[58] != 0x04 ||
+       ((const uint8_t *)template_payload.ptr)[60] != 0xfe ||
+       ((const uint8_t *)template_payload.ptr)[63] != 0x98 ||
+       ((const uint8_t *)template_payload.ptr)[template_payload.len - 1] != 0x00) {
+        return 2400;
+    }
+
+    /* --- Bad slot values --- */
+    if(t_cose_cwt_template_set_uint(&tmpl, exp_slot, (uint64_t)UINT32_MAX + 1) != T_COSE_ERR_INVALID_ARGUMENT ||
+       t_cose_cwt_template_set_uint(&tmpl, cti_slot, 1) != T_COSE_ERR_INVALID_ARGUMENT ||
+       t_cose_cwt_template_set_uint(&tmpl, 4, 1) != T_COSE_ERR_INVALID_ARGUMENT ||
+       t_cose_cwt_template_set_bstr(&tmpl, exp_slot, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cti)) != T_COSE_ERR_INVALID_ARGUMENT ||
+       t_cose_cwt_template_set_bstr(&tmpl, cti_slot, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(fixed_bytes)) != T_COSE_ERR_INVALID_ARGUMENT) {
+        return 3000;
+    }
+
+    /* --- The fixed claims encode as QCBOR does --- */
+    t_cose_cwt_template_init(&tmpl, template_buffer);
+    t_cose_cwt_template_add_int(&tmpl, -70000, -1);
+    t_cose_cwt_template_add_int(&tmpl, 300, INT64_MAX);
+    t_cose_cwt_template_add_bstr(&tmpl, 8, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(fixed_bytes));
+    result = t_cose_cwt_template_finish(&tmpl, &template_payload);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    QCBOREncode_Init(&cbor_encode, expected_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, -70000, -1);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 300, INT64_MAX);
+    QCBOREncode_AddBytesToMapN(&cbor_encode, 8, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(fixed_bytes));
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &expected)) {
+        return 4100;
+    }
+    if(q_useful_buf_compare(template_payload, expected)) {
+        return 4200;
+    }
+
+    /* --- Limits --- */
+    t_cose_cwt_template_init(&tmpl, (struct q_useful_buf){template_buffer.ptr, 20});
+    t_cose_cwt_template_add_tstr(&tmpl, T_COSE_CWT_CLAIM_ISS, "coap://as.example.com");
+    result = t_cose_cwt_template_finish(&tmpl, &template_payload);
+    if(result != T_COSE_ERR_TOO_SMALL) {
+        return 5000 + (int32_t)result;
+    }
+
+    t_cose_cwt_template_init(&tmpl, template_buffer);
+    for(i = 0; i <= T_COSE_CWT_TEMPLATE_MAX_CLAIMS; i++) {
+        t_cose_cwt_template_add_int(&tmpl, i, i);
+    }
+    result = t_cose_cwt_template_finish(&tmpl, &template_payload);
+    if(result != T_COSE_ERR_TOO_MANY_PARAMETERS) {
+        return 5100 + (int32_t)result;
+    }
+
+    t_cose_cwt_template_init(&tmpl, template_buffer);
+    for(i = 0; i <= T_COSE_CWT_TEMPLATE_MAX_SLOTS; i++) {
+        t_cose_cwt_template_add_uint_slot(&tmpl, i);
+    }
+    result = t_cose_cwt_template_finish(&tmpl, &template_payload);
+    if(result != T_COSE_ERR_TOO_MANY_PARAMETERS) {
+        return 5200 + (int32_t)result;
+    }
+
+    return 0;
+}
+
+
+/* The time for short_circuit_cwt_validate_test() */
+static int64_t cwt_test_now;
+
+static int64_t cwt_test_clock(void *clock_ctx)
+{
+    (void)clock_ctx;
+    return cwt_test_now;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_cwt_validate_test()
+{
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_cwt_validation   validation;
+    struct t_cose_cwt_claims       claims;
+    QCBOREncodeContext             cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    claims_buffer, 100);
+    struct q_useful_buf_c          signed_cose;
+    struct q_useful_buf_c          payload;
+    enum t_cose_err_t              result;
+
+    /* The claims set from RFC 8392 A.1. It is valid from 1443944944
+     * to 1444064944. */
+    static const uint8_t rfc8392_claims[] = {
+        0xa7, 0x01, 0x75, 0x63, 0x6f, 0x61, 0x70, 0x3a, 0x2f, 0x2f, 0x61,
+        0x73, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x63,
+        0x6f, 0x6d, 0x02, 0x65, 0x65, 0x72, 0x69, 0x6b, 0x77, 0x03, 0x78,
+        0x18, 0x63, 0x6f, 0x61, 0x70, 0x3a, 0x2f, 0x2f, 0x6c, 0x69, 0x67,
+        0x68, 0x74, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e,
+        0x63, 0x6f, 0x6d, 0x04, 0x1a, 0x56, 0x12, 0xae, 0xb0, 0x05, 0x1a,
+        0x56, 0x10, 0xd9, 0xf0, 0x06, 0x1a, 0x56, 0x10, 0xd9, 0xf0, 0x07,
+        0x42, 0x0b, 0x71};
+    /* A map followed by an extra byte */
+    static const uint8_t trailing_claims[] = {0xa1, 0x04, 0x01, 0x00};
+    /* nbf of 1443944944 and no exp */
+    static const uint8_t nbf_only_claims[] = {0xa1, 0x05, 0x1a, 0x56, 0x10, 0xd9, 0xf0};
+    /* exp twice */
+    static const uint8_t duplicate_claims[] = {0xa2, 0x04, 0x01, 0x04, 0x02};
+    /* exp as a text string */
+    static const uint8_t tstr_exp_claims[] = {0xa1, 0x04, 0x61, 0x31};
+    /* An array instead of a map */
+    static const uint8_t array_claims[] = {0x81, 0x04};
+
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(rfc8392_claims),
+                               signed_cose_buffer,
+                              &signed_cose);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    t_cose_cwt_validation_init(&validation, T_COSE_CWT_REQUIRE_EXP);
+    validation.issuer   = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://as.example.com");
+    validation.audience = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://light.example.com");
+    validation.clock    = cwt_test_clock;
+
+    /* --- A good CWT and its claims --- */
+    cwt_test_now = 1444000000;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+    if(q_useful_buf_compare(claims.sub, Q_USEFUL_BUF_FROM_SZ_LITERAL("erikw")) ||
+       claims.cti.len != 2 ||
+       ((const uint8_t *)claims.cti.ptr)[1] != 0x71 ||
+       claims.exp != 1444064944 ||
+       claims.nbf != 1443944944 ||
+       claims.iat != 1443944944 ||
+       claims.present != 0xfe ||
+       claims.num_other_claims != 0) {
+        return 2100;
+    }
+    /* The strings point into the message */
+    if((const uint8_t *)claims.sub.ptr < (const uint8_t *)signed_cose.ptr ||
+       (const uint8_t *)claims.sub.ptr >= (const uint8_t *)signed_cose.ptr + signed_cose.len) {
+        return 2200;
+    }
+
+    /* --- Expiration and not-before with leeway --- */
+    cwt_test_now = 1444064944;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_CWT_EXPIRED) {
+        return 3000 + (int32_t)result;
+    }
+    validation.leeway = 60;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result) {
+        return 3100 + (int32_t)result;
+    }
+    cwt_test_now = 1444064944 + 60;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_CWT_EXPIRED) {
+        return 3200 + (int32_t)result;
+    }
+    cwt_test_now = 1443944944 - 60;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result) {
+        return 3300 + (int32_t)result;
+    }
+    cwt_test_now = 1443944944 - 61;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_CWT_NOT_YET_VALID) {
+        return 3400 + (int32_t)result;
+    }
+    validation.leeway = 0;
+
+    /* --- Issuer and audience --- */
+    cwt_test_now = 1444000000;
+    validation.issuer = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://as.example.org");
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_CWT_ISSUER) {
+        return 4000 + (int32_t)result;
+    }
+    validation.issuer   = NULL_Q_USEFUL_BUF_C;
+    validation.audience = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://light.example");
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_CWT_AUDIENCE) {
+        return 4100 + (int32_t)result;
+    }
+    validation.audience = NULL_Q_USEFUL_BUF_C;
+
+    /* --- Claims checked before or after the signature --- */
+    /* Break the signature */
+    ((uint8_t *)signed_cose_buffer.ptr)[signed_cose.len - 64] ^= 0x01;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 5000 + (int32_t)result;
+    }
+    cwt_test_now = 1444064944;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 5100 + (int32_t)result;
+    }
+    validation.option_flags |= T_COSE_CWT_CHECK_BEFORE_SIGNATURE;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_CWT_EXPIRED) {
+        return 5200 + (int32_t)result;
+    }
+    /* Good claims still need a good signature */
+    cwt_test_now = 1444000000;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_SIG_VERIFY) {
+        return 5300 + (int32_t)result;
+    }
+    ((uint8_t *)signed_cose_buffer.ptr)[signed_cose.len - 64] ^= 0x01;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result) {
+        return 5400 + (int32_t)result;
+    }
+
+    /* --- No exp and other claims --- */
+    QCBOREncode_Init(&cbor_encode, claims_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_SUB, "erikw");
+    QCBOREncode_OpenMapInMapN(&cbor_encode, -70000);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_EXP, 1);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_AddSZStringToMap(&cbor_encode, "private", "claim");
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &payload)) {
+        return 6000;
+    }
+    result = t_cose_cwt_validate(&validation, payload, &claims);
+    if(result != T_COSE_ERR_CWT_MISSING_EXP) {
+        return 6100 + (int32_t)result;
+    }
+    validation.option_flags = 0;
+    result = t_cose_cwt_validate(&validation, payload, &claims);
+    if(result) {
+        return 6200 + (int32_t)result;
+    }
+    /* The exp in the nested map isn't the CWT's */
+    if(claims.present != (1U << T_COSE_CWT_CLAIM_SUB) || claims.num_other_claims != 2) {
+        return 6300;
+    }
+
+    /* --- A signed CWT with nbf but no exp --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = t_cose_sign1_sign(&sign_ctx,
+                               Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(nbf_only_claims),
+                               signed_cose_buffer,
+                              &signed_cose);
+    if(result) {
+        return 6400 + (int32_t)result;
+    }
+    validation.option_flags = T_COSE_CWT_REQUIRE_EXP;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result != T_COSE_ERR_CWT_MISSING_EXP) {
+        return 6500 + (int32_t)result;
+    }
+    validation.option_flags = 0;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, &claims, NULL);
+    if(result) {
+        return 6600 + (int32_t)result;
+    }
+
+    /* --- Not a claims set --- */
+    if(t_cose_cwt_validate(&validation, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(trailing_claims), NULL) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_cwt_validate(&validation, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(duplicate_claims), NULL) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_cwt_validate(&validation, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(tstr_exp_claims), NULL) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_cwt_validate(&validation, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(array_claims), NULL) != T_COSE_ERR_CWT_FORMAT) {
+        return 7000;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_claims_index_test()
+{
+    static const uint8_t nonce[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    static const uint8_t radio_nonce[] = {0xaa, 0xbb, 0xcc, 0xdd};
+    static const uint8_t modem_token[] = {0xd2, 0x84, 0x40, 0xa0, 0x40, 0x40};
+    /* Errors */
+    static const uint8_t duplicate[] = {0xa2, 0x01, 0x00, 0x01, 0x00};
+    static const uint8_t duplicate_tstr[] = {0xa2, 0x61, 0x61, 0x00, 0x61, 0x61, 0x00};
+    static const uint8_t top_array[] = {0x82, 0x01, 0x02};
+    static const uint8_t truncated[] = {0xa2, 0x01, 0x00, 0x02};
+    static const uint8_t indefinite[] = {0xa1, 0x01, 0xbf, 0xff};
+    static const uint8_t bstr_label[] = {0xa1, 0x41, 0x00, 0x00};
+    static const uint8_t trailing[] = {0xa1, 0x01, 0x00, 0x00};
+    static const uint8_t too_deep[] = {0xa1, 0x01, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x00};
+    /* A duplicate label in a map in an array is not an error */
+    static const uint8_t not_indexed[] = {0xa1, 0x01, 0x81, 0xa2, 0x01, 0x00, 0x01, 0x00};
+    struct t_cose_sign1_sign_ctx            sign_ctx;
+    struct t_cose_sign1_verify_ctx          verify_ctx;
+    struct t_cose_claims_index              index;
+    struct t_cose_claims_index_entry        entries[13];
+    const struct t_cose_claims_index_entry *submods;
+    const struct t_cose_claims_index_entry *radio;
+    const struct t_cose_claims_index_entry *entry;
+    QCBOREncodeContext                      cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(             payload_buffer, 150);
+    Q_USEFUL_BUF_MAKE_STACK_UB(             signed_cose_buffer, 300);
+    struct q_useful_buf_c                   payload;
+    struct q_useful_buf_c                   signed_cose;
+    struct q_useful_buf_c                   string;
+    struct q_useful_buf_c                   encoded;
+    int64_t                                 value;
+    size_t                                  count;
+    enum t_cose_err_t                       result;
+
+    /* An EAT with submodules, with the labels out of order */
+    QCBOREncode_Init(&cbor_encode, payload_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddBytesToMapN(&cbor_encode, 10, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(nonce));
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, -75000, "fw-1.2.3");
+    QCBOREncode_OpenMapInMapN(&cbor_encode, 266);
+    QCBOREncode_OpenMapInMap(&cbor_encode, "radio");
+    QCBOREncode_AddBytesToMapN(&cbor_encode, 10, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(radio_nonce));
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, -75010, 7);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_AddBytesToMap(&cbor_encode, "modem", Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(modem_token));
+    QCBOREncode_OpenArrayInMap(&cbor_encode, "gps");
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 10, 1);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_CloseArray(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_AddSZString(&cbor_encode, "private");
+    QCBOREncode_AddTag(&cbor_encode, 1);
+    QCBOREncode_AddInt64(&cbor_encode, 100);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_EXP, 1444064944);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 7, -500);
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &payload)) {
+        return 1000;
+    }
+
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = t_cose_sign1_sign(&sign_ctx, payload, signed_cose_buffer, &signed_cose);
+    if(result) {
+        return 1100 + (int32_t)result;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_verify(&verify_ctx, signed_cose, &payload, NULL);
+    if(result) {
+        return 1200 + (int32_t)result;
+    }
+
+    /* --- Index the verified payload --- */
+    result = t_cose_claims_index_build(&index, payload, entries, 13);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+    if(index.num_entries != 11) {
+        return 2100;
+    }
+
+    /* --- The outer claims --- */
+    if(t_cose_claims_index_get_string(&index, t_cose_claims_index_find(&index, NULL, 10), &string) ||
+       q_useful_buf_compare(string, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(nonce))) {
+        return 3000;
+    }
+    /* Zero copy */
+    if((const uint8_t *)string.ptr < (const uint8_t *)payload.ptr ||
+       (const uint8_t *)string.ptr >= (const uint8_t *)payload.ptr + payload.len) {
+        return 3100;
+    }
+    if(t_cose_claims_index_get_string(&index, t_cose_claims_index_find(&index, NULL, -75000), &string) ||
+       q_useful_buf_compare(string, Q_USEFUL_BUF_FROM_SZ_LITERAL("fw-1.2.3"))) {
+        return 3200;
+    }
+    if(t_cose_claims_index_get_int(&index, t_cose_claims_index_find(&index, NULL, T_COSE_CWT_CLAIM_EXP), &value) ||
+       value != 1444064944) {
+        return 3300;
+    }
+    if(t_cose_claims_index_get_int(&index, t_cose_claims_index_find(&index, NULL, 7), &value) ||
+       value != -500) {
+        return 3400;
+    }
+    entry = t_cose_claims_index_find_tstr(&index, NULL, Q_USEFUL_BUF_FROM_SZ_LITERAL("private"));
+    if(t_cose_claims_index_get_int(&index, entry, &value) || value != 100 || entry->tags_len != 1) {
+        return 3500;
+    }
+    encoded = t_cose_claims_index_encoded(&index, entry);
+    if(encoded.len != 3 || ((const uint8_t *)encoded.ptr)[0] != 0xc1) {
+        return 3600;
+    }
+
+    /* --- Submodules --- */
+    submods = t_cose_claims_index_find(&index, NULL, 266);
+    radio = t_cose_claims_index_find_tstr(&index, submods, Q_USEFUL_BUF_FROM_SZ_LITERAL("radio"));
+    if(radio == NULL || radio->major_type != CBOR_MAJOR_TYPE_MAP) {
+        return 4000;
+    }
+    /* {10: h'aabbccdd', -75010: 7} */
+    encoded = t_cose_claims_index_encoded(&index, radio);
+    if(encoded.len != 13 || ((const uint8_t *)encoded.ptr)[0] != 0xa2) {
+        return 4100;
+    }
+    if(t_cose_claims_index_get_string(&index, t_cose_claims_index_find(&index, radio, 10), &string) ||
+       q_useful_buf_compare(string, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(radio_nonce))) {
+        return 4200;
+    }
+    if(t_cose_claims_index_get_int(&index, t_cose_claims_index_find(&index, radio, -75010), &value) ||
+       value != 7) {
+        return 4300;
+    }
+    entry = t_cose_claims_index_find_tstr(&index, submods, Q_USEFUL_BUF_FROM_SZ_LITERAL("modem"));
+    if(t_cose_claims_index_get_string(&index, entry, &string) ||
+       q_useful_buf_compare(string, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(modem_token))) {
+        return 4400;
+    }
+
+    /* --- Going through maps --- */
+    count = 0;
+    for(entry = t_cose_claims_index_next(&index, NULL, NULL);
+        entry != NULL;
+        entry = t_cose_claims_index_next(&index, NULL, entry)) {
+        count++;
+    }
+    if(count != 6) {
+        return 4500;
+    }
+    /* radio, modem and gps */
+    count = 0;
+    for(entry = t_cose_claims_index_next(&index, submods, NULL);
+        entry != NULL;
+        entry = t_cose_claims_index_next(&index, submods, entry)) {
+        if(entry->label_type != T_COSE_CLAIMS_INDEX_LABEL_TSTR) {
+            return 4600;
+        }
+        count++;
+    }
+    if(count != 3) {
+        return 4700;
+    }
+    entry = t_cose_claims_index_next(&index, radio, NULL);
+    if(entry == NULL || entry->label != -75010 ||
+       t_cose_claims_index_next(&index, radio, t_cose_claims_index_next(&index, radio, entry)) != NULL) {
+        return 4800;
+    }
+
+    /* --- Things that aren't there --- */
+    entry = t_cose_claims_index_find_tstr(&index, submods, Q_USEFUL_BUF_FROM_SZ_LITERAL("gps"));
+    if(entry == NULL || entry->major_type != CBOR_MAJOR_TYPE_ARRAY ||
+       t_cose_claims_index_find(&index, entry, 10) != NULL) {
+        return 5000;
+    }
+    if(t_cose_claims_index_find(&index, NULL, 11) != NULL ||
+       t_cose_claims_index_next(&index, entry, NULL) != NULL ||
+       t_cose_claims_index_find(&index, submods, 10) != NULL ||
+       t_cose_claims_index_find_tstr(&index, NULL, Q_USEFUL_BUF_FROM_SZ_LITERAL("radio")) != NULL ||
+       t_cose_claims_index_get_int(&index, NULL, &value) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_get_int(&index, radio, &value) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_get_string(&index, submods, &string) != T_COSE_ERR_CWT_FORMAT) {
+        return 5100;
+    }
+
+    /* --- Errors --- */
+    if(t_cose_claims_index_build(&index, payload, entries, 10) != T_COSE_ERR_TOO_SMALL ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(duplicate), entries, 13) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(duplicate_tstr), entries, 13) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(top_array), entries, 13) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(truncated), entries, 13) != T_COSE_ERR_CBOR_NOT_WELL_FORMED ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(indefinite), entries, 13) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(bstr_label), entries, 13) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(trailing), entries, 13) != T_COSE_ERR_CWT_FORMAT ||
+       t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(too_deep), entries, 13) != T_COSE_ERR_CWT_FORMAT) {
+        return 6000;
+    }
+    if(index.num_entries != 0) {
+        return 6100;
+    }
+    if(t_cose_claims_index_build(&index, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(not_indexed), entries, 13) ||
+       index.num_entries != 1) {
+        return 6200;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_cddl_gen_test()
+{
+    /* The payload of the CWT in RFC 8392 appendix A.3 */
+    static const uint8_t rfc8392_payload[] = {
+        0xa7, 0x01, 0x75, 0x63, 0x6f, 0x61, 0x70, 0x3a, 0x2f, 0x2f, 0x61,
+        0x73, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x63,
+        0x6f, 0x6d, 0x02, 0x65, 0x65, 0x72, 0x69, 0x6b, 0x77, 0x03, 0x78,
+        0x18, 0x63, 0x6f, 0x61, 0x70, 0x3a, 0x2f, 0x2f, 0x6c, 0x69, 0x67,
+        0x68, 0x74, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e,
+        0x63, 0x6f, 0x6d, 0x04, 0x1a, 0x56, 0x12, 0xae, 0xb0, 0x05, 0x1a,
+        0x56, 0x10, 0xd9, 0xf0, 0x06, 0x1a, 0x56, 0x10, 0xd9, 0xf0, 0x07,
+        0x42, 0x0b, 0x71};
+    static const uint8_t cti[] = {0x0b, 0x71};
+    /* Errors */
+    static const uint8_t iss_not_tstr[] = {0xa1, 0x01, 0x01};
+    static const uint8_t duplicate[] = {0xa2, 0x04, 0x01, 0x04, 0x01};
+    static const uint8_t tstr_label[] = {0xa1, 0x61, 0x61, 0x01};
+    static const uint8_t truncated[] = {0xa2, 0x04, 0x01, 0x05};
+    static const uint8_t indefinite[] = {0xbf, 0x04, 0x01, 0xff};
+    static const uint8_t trailing[] = {0xa1, 0x04, 0x01, 0x00};
+    static const uint8_t cti_too_long[] = {0xa1, 0x07, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    /* hw without the required version */
+    static const uint8_t hw_no_version[] = {0xa1, 0x3a, 0x00, 0x01, 0x24, 0xf7, 0xa1, 0x01, 0x61, 0x78};
+    struct t_cose_sign1_sign_ctx   sign_ctx;
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct cwt_claims              claims;
+    struct cwt_claims              decoded;
+    QCBOREncodeContext             cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    payload_buffer, CWT_CLAIMS_MAX_SIZE);
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 300);
+    struct q_useful_buf_c          payload;
+    struct q_useful_buf_c          signed_cose;
+    enum t_cose_err_t              result;
+
+    /* --- Encoding gives the bytes in the RFC --- */
+    memset(&claims, 0, sizeof(claims));
+    claims.iss = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://as.example.com");
+    claims.sub = Q_USEFUL_BUF_FROM_SZ_LITERAL("erikw");
+    claims.aud = Q_USEFUL_BUF_FROM_SZ_LITERAL("coap://light.example.com");
+    claims.exp = 1444064944;
+    claims.nbf = 1443944944;
+    claims.iat = 1443944944;
+    claims.cti = Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cti);
+    claims.present = CWT_CLAIMS_ISS_PRESENT | CWT_CLAIMS_SUB_PRESENT | CWT_CLAIMS_AUD_PRESENT |
+                     CWT_CLAIMS_EXP_PRESENT | CWT_CLAIMS_NBF_PRESENT | CWT_CLAIMS_IAT_PRESENT |
+                     CWT_CLAIMS_CTI_PRESENT;
+    result = cwt_claims_encode(&claims, payload_buffer, &payload);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+    if(q_useful_buf_compare(payload, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(rfc8392_payload))) {
+        return 1100;
+    }
+
+    /* --- Sign and verify through the generated wrappers --- */
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    result = cwt_claims_sign1_sign(&sign_ctx, &claims, signed_cose_buffer, &signed_cose);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = cwt_claims_sign1_verify(&verify_ctx, signed_cose, &decoded, NULL);
+    if(result) {
+        return 2100 + (int32_t)result;
+    }
+    if(decoded.present != claims.present ||
+       q_useful_buf_compare(decoded.iss, claims.iss) ||
+       q_useful_buf_compare(decoded.sub, claims.sub) ||
+       q_useful_buf_compare(decoded.aud, claims.aud) ||
+       q_useful_buf_compare(decoded.cti, claims.cti) ||
+       decoded.exp != claims.exp || decoded.nbf != claims.nbf || decoded.iat != claims.iat) {
+        return 2200;
+    }
+    /* Zero copy */
+    if((const uint8_t *)decoded.iss.ptr < (const uint8_t *)signed_cose.ptr ||
+       (const uint8_t *)decoded.iss.ptr >= (const uint8_t *)signed_cose.ptr + signed_cose.len) {
+        return 2300;
+    }
+
+    /* --- Nested map and claims not in the schema, made by QCBOR --- */
+    QCBOREncode_Init(&cbor_encode, payload_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 4, -1);
+    QCBOREncode_OpenArrayInMapN(&cbor_encode, 500);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, 1, "not");
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_AddTag(&cbor_encode, 1);
+    QCBOREncode_AddInt64(&cbor_encode, 2);
+    QCBOREncode_CloseArray(&cbor_encode);
+    QCBOREncode_OpenMapInMapN(&cbor_encode, -75000);
+    QCBOREncode_AddBoolToMap(&cbor_encode, "secure", true);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 2, 70000);
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, 1, "model-x");
+    QCBOREncode_AddInt64ToMap(&cbor_encode, "lifecycle", -3);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, -600, 7);
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &payload)) {
+        return 3000;
+    }
+    result = cwt_claims_decode(payload, &decoded);
+    if(result) {
+        return 3100 + (int32_t)result;
+    }
+    if(decoded.present != (CWT_CLAIMS_EXP_PRESENT | CWT_CLAIMS_HW_PRESENT) ||
+       decoded.exp != -1 ||
+       decoded.hw.present != (HW_CLAIMS_MODEL_PRESENT | HW_CLAIMS_VERSION_PRESENT |
+                              HW_CLAIMS_SECURE_PRESENT | HW_CLAIMS_LIFECYCLE_PRESENT) ||
+       q_useful_buf_compare(decoded.hw.model, Q_USEFUL_BUF_FROM_SZ_LITERAL("model-x")) ||
+       decoded.hw.version != 70000 || !decoded.hw.secure || decoded.hw.lifecycle != -3 ||
+       !q_useful_buf_c_is_null(decoded.iss)) {
+        return 3200;
+    }
+
+    /* Encoding it again leaves out the claims not in the schema */
+    result = cwt_claims_encode(&decoded, signed_cose_buffer, &payload);
+    if(result) {
+        return 3300 + (int32_t)result;
+    }
+    claims = decoded;
+    if(cwt_claims_decode(payload, &decoded) ||
+       decoded.hw.version != claims.hw.version ||
+       decoded.hw.lifecycle != -3 || payload.len != 43) {
+        return 3400;
+    }
+
+    /* --- Encoding errors --- */
+    result = cwt_claims_encode(&claims, (struct q_useful_buf){signed_cose_buffer.ptr, 42}, &payload);
+    if(result != T_COSE_ERR_TOO_SMALL) {
+        return 4000 + (int32_t)result;
+    }
+    claims.hw.lifecycle = 3;
+    if(cwt_claims_encode(&claims, signed_cose_buffer, &payload) != T_COSE_ERR_PAYLOAD_SCHEMA) {
+        return 4100;
+    }
+    claims.hw.lifecycle = -3;
+    claims.hw.model = NULL_Q_USEFUL_BUF_C;
+    if(cwt_claims_encode(&claims, signed_cose_buffer, &payload) != T_COSE_ERR_PAYLOAD_SCHEMA) {
+        return 4200;
+    }
+
+    /* --- Decoding errors --- */
+    if(cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(iss_not_tstr), &decoded) != T_COSE_ERR_PAYLOAD_SCHEMA ||
+       cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(duplicate), &decoded) != T_COSE_ERR_PAYLOAD_SCHEMA ||
+       cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(tstr_label), &decoded) != T_COSE_ERR_PAYLOAD_SCHEMA ||
+       cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(truncated), &decoded) != T_COSE_ERR_CBOR_NOT_WELL_FORMED ||
+       cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(indefinite), &decoded) != T_COSE_ERR_PAYLOAD_SCHEMA ||
+       cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(trailing), &decoded) != T_COSE_ERR_PAYLOAD_SCHEMA ||
+       cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(cti_too_long), &decoded) != T_COSE_ERR_PAYLOAD_SCHEMA ||
+       cwt_claims_decode(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(hw_no_version), &decoded) != T_COSE_ERR_PAYLOAD_SCHEMA) {
+        return 5000;
+    }
+
+    return 0;
+}
+
+
+/* Counts the calls of nested_test_dispatch() */
+static size_t nested_test_dispatches;
+static size_t nested_test_items;
+
+/* A dispatch function for short_circuit_nested_verify_test(), as a
+ * worker pool would have */
+static enum t_cose_err_t
+nested_test_dispatch(void                                  *dispatch_ctx,
+                     const struct t_cose_sign1_verifier    *verifier,
+                     struct t_cose_sign1_verify_batch_item *items,
+                     size_t                                 num_items)
+{
+    struct t_cose_sign1_verify_call call;
+
+    (void)dispatch_ctx;
+    nested_test_dispatches++;
+    nested_test_items += num_items;
+    t_cose_sign1_verify_call_init(&call, NULL_Q_USEFUL_BUF);
+    return t_cose_sign1_verifier_verify_batch(verifier, &call, items, num_items);
+}
+
+
+/* Makes a short-circuit signed token for short_circuit_nested_verify_test() */
+static enum t_cose_err_t
+nested_test_token(QCBOREncodeContext    *cbor_encode,
+                  struct q_useful_buf    buffer,
+                  struct q_useful_buf_c *token)
+{
+    struct t_cose_sign1_sign_ctx sign_ctx;
+    struct q_useful_buf_c        payload;
+
+    if(QCBOREncode_Finish(cbor_encode, &payload)) {
+        return T_COSE_ERR_CBOR_FORMATTING;
+    }
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    return t_cose_sign1_sign(&sign_ctx, payload, buffer, token);
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_nested_verify_test()
+{
+    static const uint8_t nonce[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    static const uint8_t sim_nonce[] = {0x03};
+    static const struct t_cose_nested_label submods_path[] = {{266, {NULL, 0}}};
+    static const struct t_cose_nested_label nonce_path[] = {{10, {NULL, 0}}};
+    static const struct t_cose_nested_label int_path[] = {{7, {NULL, 0}}};
+    static const struct t_cose_nested_label missing_path[] = {{266, {NULL, 0}}, {0, {"gnss", 4}}};
+    struct t_cose_sign1_verify_ctx   verify_ctx;
+    struct t_cose_sign1_verifier     verifier;
+    struct t_cose_sign1_verifier     strict_verifier;
+    struct t_cose_sign1_verify_call  call;
+    struct t_cose_nested_path        paths[2];
+    struct t_cose_nested_config      config;
+    struct t_cose_claims_index_entry entries[10];
+    struct t_cose_nested_result      results[5];
+    const struct t_cose_nested_result *sim;
+    const struct t_cose_nested_result *modem;
+    QCBOREncodeContext               cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(      encode_buffer, 500);
+    Q_USEFUL_BUF_MAKE_STACK_UB(      sim_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(      modem_buffer, 300);
+    Q_USEFUL_BUF_MAKE_STACK_UB(      radio_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(      eat_buffer, 600);
+    Q_USEFUL_BUF_MAKE_STACK_UB(      bad_buffer, 600);
+    struct q_useful_buf_c            sim_token;
+    struct q_useful_buf_c            modem_token;
+    struct q_useful_buf_c            radio_token;
+    struct q_useful_buf_c            eat;
+    struct q_useful_buf_c            bad_eat;
+    size_t                           num_results;
+    size_t                           i;
+    enum t_cose_err_t                result;
+
+    /* An EAT with two submodule tokens, one with a token of its own */
+    QCBOREncode_Init(&cbor_encode, encode_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddBytesToMapN(&cbor_encode, 10, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(sim_nonce));
+    QCBOREncode_CloseMap(&cbor_encode);
+    result = nested_test_token(&cbor_encode, sim_buffer, &sim_token);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+
+    QCBOREncode_Init(&cbor_encode, encode_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 10, 2);
+    QCBOREncode_OpenMapInMapN(&cbor_encode, 266);
+    QCBOREncode_AddBytesToMap(&cbor_encode, "sim", sim_token);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    result = nested_test_token(&cbor_encode, modem_buffer, &modem_token);
+    if(result) {
+        return 1100 + (int32_t)result;
+    }
+
+    QCBOREncode_Init(&cbor_encode, encode_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 10, 1);
+    QCBOREncode_CloseMap(&cbor_encode);
+    result = nested_test_token(&cbor_encode, radio_buffer, &radio_token);
+    if(result) {
+        return 1200 + (int32_t)result;
+    }
+
+    QCBOREncode_Init(&cbor_encode, encode_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddBytesToMapN(&cbor_encode, 10, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(nonce));
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 7, -500);
+    QCBOREncode_OpenMapInMapN(&cbor_encode, 266);
+    QCBOREncode_AddBytesToMap(&cbor_encode, "radio", radio_token);
+    QCBOREncode_AddBytesToMap(&cbor_encode, "modem", modem_token);
+    /* A submodule that isn't a token is passed over */
+    QCBOREncode_OpenMapInMap(&cbor_encode, "gps");
+    QCBOREncode_AddInt64ToMapN(&cbor_encode, 10, 1);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    result = nested_test_token(&cbor_encode, eat_buffer, &eat);
+    if(result) {
+        return 1300 + (int32_t)result;
+    }
+
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    t_cose_sign1_verifier_init(&verifier, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    paths[0].labels     = submods_path;
+    paths[0].num_labels = 1;
+    paths[0].flags      = T_COSE_NESTED_EACH;
+    paths[0].verifier   = &verifier;
+    t_cose_nested_config_init(&config, paths, 1, entries, 10);
+
+    /* --- The submodule tokens --- */
+    result = t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 5, &num_results);
+    if(result || num_results != 3) {
+        return 2000 + (int32_t)result;
+    }
+    if(results[0].parent != SIZE_MAX || results[0].depth != 0 ||
+       results[1].parent != 0 || results[1].depth != 1 || results[1].path != 0 ||
+       results[2].parent != 0 || results[2].depth != 1) {
+        return 2100;
+    }
+    modem = NULL;
+    for(i = 1; i < num_results; i++) {
+        if(results[i].err != T_COSE_SUCCESS || results[i].payload.len == 0) {
+            return 2200;
+        }
+        if(!q_useful_buf_compare(results[i].label_tstr, Q_USEFUL_BUF_FROM_SZ_LITERAL("modem"))) {
+            modem = &results[i];
+        }
+    }
+    if(modem == NULL) {
+        return 2300;
+    }
+
+    /* --- Two deep, on a dispatch function --- */
+    config.max_depth    = 2;
+    config.dispatch     = nested_test_dispatch;
+    nested_test_dispatches = 0;
+    nested_test_items      = 0;
+    result = t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 5, &num_results);
+    if(result || num_results != 4) {
+        return 3000 + (int32_t)result;
+    }
+    /* One batch for each level */
+    if(nested_test_dispatches != 2 || nested_test_items != 3) {
+        return 3100;
+    }
+    sim = &results[3];
+    if(q_useful_buf_compare(sim->label_tstr, Q_USEFUL_BUF_FROM_SZ_LITERAL("sim")) ||
+       sim->depth != 2 ||
+       q_useful_buf_compare(results[sim->parent].label_tstr, Q_USEFUL_BUF_FROM_SZ_LITERAL("modem"))) {
+        return 3200;
+    }
+    /* {10: h'03'}, pointing into the outer token */
+    if(sim->payload.len != 4 ||
+       ((const uint8_t *)sim->payload.ptr)[3] != 0x03 ||
+       (const uint8_t *)sim->payload.ptr < (const uint8_t *)eat.ptr ||
+       (const uint8_t *)sim->payload.ptr >= (const uint8_t *)eat.ptr + eat.len) {
+        return 3300;
+    }
+
+    /* --- Too many tokens --- */
+    result = t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 3, &num_results);
+    if(result != T_COSE_ERR_TOO_SMALL || num_results != 3 || results[2].err != T_COSE_SUCCESS) {
+        return 4000 + (int32_t)result;
+    }
+
+    /* --- A shared configuration and inner tokens that don't verify --- */
+    t_cose_sign1_verifier_init(&strict_verifier, 0);
+    paths[0].verifier = &strict_verifier;
+    t_cose_sign1_verify_call_init(&call, NULL_Q_USEFUL_BUF);
+    result = t_cose_sign1_verifier_verify_nested(&verifier, &call, eat, &config, results, 5, &num_results);
+    if(result == T_COSE_SUCCESS || num_results != 3 ||
+       results[0].err != T_COSE_SUCCESS || results[1].err == T_COSE_SUCCESS ||
+       results[2].err == T_COSE_SUCCESS) {
+        return 5000 + (int32_t)result;
+    }
+    paths[0].verifier = &verifier;
+
+    /* --- Paths to claims that aren't tokens --- */
+    config.dispatch   = NULL;
+    config.max_depth  = 1;
+    paths[0].labels   = nonce_path;
+    paths[0].flags    = 0;
+    paths[1].labels     = int_path;
+    paths[1].num_labels = 1;
+    paths[1].flags      = 0;
+    paths[1].verifier   = &verifier;
+    config.num_paths    = 2;
+    result = t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 5, &num_results);
+    /* The nonce is a byte string that isn't a COSE_Sign1 */
+    if(result == T_COSE_SUCCESS || num_results != 3 ||
+       results[1].err == T_COSE_SUCCESS || results[1].label != 10 ||
+       results[2].err != T_COSE_ERR_CWT_FORMAT || results[2].path != 1) {
+        return 6000 + (int32_t)result;
+    }
+    paths[0].flags = T_COSE_NESTED_EACH;
+    result = t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 5, &num_results);
+    if(result != T_COSE_ERR_CWT_FORMAT || num_results != 3 || results[1].err != T_COSE_ERR_CWT_FORMAT) {
+        return 6100 + (int32_t)result;
+    }
+    paths[0].labels     = missing_path;
+    paths[0].num_labels = 2;
+    config.num_paths    = 1;
+    result = t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 5, &num_results);
+    if(result || num_results != 1) {
+        return 6200 + (int32_t)result;
+    }
+
+    /* --- The outer token doesn't verify --- */
+    bad_eat = q_useful_buf_copy(bad_buffer, eat);
+    /* In the hash at the start of the short-circuit signature */
+    ((uint8_t *)bad_buffer.ptr)[bad_eat.len - 40] ^= 0x01;
+    result = t_cose_sign1_verify_nested(&verify_ctx, bad_eat, &config, results, 5, &num_results);
+    if(result != T_COSE_ERR_SIG_VERIFY || num_results != 1 || results[0].err != T_COSE_ERR_SIG_VERIFY) {
+        return 7000 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify_nested(&verify_ctx, eat, &config, results, 0, &num_results);
+    if(result != T_COSE_ERR_TOO_SMALL || num_results != 0) {
+        return 7100 + (int32_t)result;
+    }
+
+    /* --- Its payload can't be indexed --- */
+    QCBOREncode_Init(&cbor_encode, encode_buffer);
+    QCBOREncode_AddSZString(&cbor_encode, "not claims");
+    result = nested_test_token(&cbor_encode, bad_buffer, &bad_eat);
+    if(result) {
+        return 7200 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify_nested(&verify_ctx, bad_eat, &config, results, 5, &num_results);
+    if(result != T_COSE_ERR_CWT_FORMAT || num_results != 1) {
+        return 7300 + (int32_t)result;
+    }
+    config.max_index_entries = 1;
+    result = t_cose_sign1_verify_nested(&verify_ctx, modem_token, &config, results, 5, &num_results);
+    if(result != T_COSE_ERR_TOO_SMALL || num_results != 1 || results[0].err != T_COSE_ERR_TOO_SMALL) {
+        return 7400 + (int32_t)result;
+    }
+
+    return 0;
+}
+
+
+/* The certificates for short_circuit_x5chain_test(), which only need
+ * to be byte strings for parsing. The third has a two-byte head. */
+static const uint8_t x5chain_test_cert1[] = {0x01, 0x02};
+static const uint8_t x5chain_test_cert2[] = {0x03, 0x04, 0x05};
+static const uint8_t x5chain_test_cert3[30] = {0x06};
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_x5chain_test()
+{
+    /* {1: -7} */
+    static const uint8_t protected_alg[] = {0xa1, 0x01, 0x26};
+    /* {1: -7, 33: [h'01', h'02']} */
+    static const uint8_t protected_x5chain[] = {0xa2, 0x01, 0x26, 0x18, 0x21, 0x82, 0x41, 0x01, 0x41, 0x02};
+    /* {1: -7, 34: [-16, h'aa']} */
+    static const uint8_t protected_x5t[] = {0xa2, 0x01, 0x26, 0x18, 0x22, 0x82, 0x2f, 0x41, 0xaa};
+    /* {} */
+    static const uint8_t no_parameters[] = {0xa0};
+    /* {33: h'0102'} */
+    static const uint8_t one_cert[] = {0xa1, 0x18, 0x21, 0x42, 0x01, 0x02};
+    /* {34: [-16, h'aa']} */
+    static const uint8_t x5t_only[] = {0xa1, 0x18, 0x22, 0x82, 0x2f, 0x41, 0xaa};
+    static const struct {
+        uint8_t           unprotected[12];
+        size_t            len;
+        bool              x5chain_protected;
+        enum t_cose_err_t err;
+    } bad[] = {
+        /* {33: []} */
+        {{0xa1, 0x18, 0x21, 0x80}, 4, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {33: 5} */
+        {{0xa1, 0x18, 0x21, 0x05}, 4, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {33: h''} */
+        {{0xa1, 0x18, 0x21, 0x40}, 4, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {33: [h'01', 6]} */
+        {{0xa1, 0x18, 0x21, 0x82, 0x41, 0x01, 0x06}, 7, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {33: [h'01', 24(h'02')]} */
+        {{0xa1, 0x18, 0x21, 0x82, 0x41, 0x01, 0xd8, 0x18, 0x41, 0x02}, 10, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {34: h'aa'} */
+        {{0xa1, 0x18, 0x22, 0x41, 0xaa}, 5, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {34: [-16]} */
+        {{0xa1, 0x18, 0x22, 0x81, 0x2f}, 5, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {34: [-16, h'aa', 1]} */
+        {{0xa1, 0x18, 0x22, 0x83, 0x2f, 0x41, 0xaa, 0x01}, 8, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {34: ["x", h'aa']} */
+        {{0xa1, 0x18, 0x22, 0x82, 0x61, 0x78, 0x41, 0xaa}, 8, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {34: [0, h'aa']} */
+        {{0xa1, 0x18, 0x22, 0x82, 0x00, 0x41, 0xaa}, 7, false, T_COSE_ERR_PARAMETER_CBOR},
+        /* {33: h'0102'} and x5chain protected too */
+        {{0xa1, 0x18, 0x21, 0x42, 0x01, 0x02}, 6, true, T_COSE_ERR_DUPLICATE_PARAMETER},
+    };
+    static const uint8_t signature[64] = {0};
+    struct t_cose_sign1_verify_ctx     verify_ctx;
+    struct t_cose_sign1_parsed         parsed;
+    struct t_cose_header_cache         header_cache;
+    struct t_cose_header_cache_entry   header_cache_entries[1];
+    struct t_cose_x5chain_cache        cache;
+    struct t_cose_x5chain_cache_entry  entries[2];
+    QCBOREncodeContext                 cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(        encode_buffer, 200);
+    Q_USEFUL_BUF_MAKE_STACK_UB(        message_buffer, 300);
+    Q_USEFUL_BUF_MAKE_STACK_UB(        copy_buffer, 300);
+    struct q_useful_buf_c              unprotected;
+    struct q_useful_buf_c              message;
+    struct q_useful_buf_c              copy;
+    struct q_useful_buf_c              cert;
+    struct q_useful_buf_c              payload;
+    enum t_cose_err_t                  result;
+    enum t_cose_err_t                  init_result;
+    size_t                             i;
+
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+
+    /* --- One certificate --- */
+    result = t_cose_test_message_sign1_from_parts(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_alg),
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(one_cert),
+                                                  s_input_payload,
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                                                  message_buffer,
+                                                  &message);
+    if(result) {
+        return 1000 + (int32_t)result;
+    }
+    result = t_cose_sign1_parse(&verify_ctx, message, &parsed);
+    if(result) {
+        return 1100 + (int32_t)result;
+    }
+    if(q_useful_buf_compare(parsed.parameters.x5chain_leaf, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert1)) ||
+       q_useful_buf_compare(parsed.parameters.x5chain, parsed.parameters.x5chain_leaf) ||
+       parsed.parameters.x5t_alg != T_COSE_UNSET_ALGORITHM_ID) {
+        return 1200;
+    }
+    cert = t_cose_x5chain_next_cert(&parsed.parameters, NULL_Q_USEFUL_BUF_C);
+    if(cert.ptr != parsed.parameters.x5chain_leaf.ptr ||
+       !q_useful_buf_c_is_null(t_cose_x5chain_next_cert(&parsed.parameters, cert))) {
+        return 1300;
+    }
+
+    /* --- A chain of three and x5t --- */
+    QCBOREncode_Init(&cbor_encode, encode_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_OpenArrayInMapN(&cbor_encode, 33);
+    QCBOREncode_AddBytes(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert1));
+    QCBOREncode_AddBytes(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert2));
+    QCBOREncode_AddBytes(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert3));
+    QCBOREncode_CloseArray(&cbor_encode);
+    QCBOREncode_OpenArrayInMapN(&cbor_encode, 34);
+    QCBOREncode_AddInt64(&cbor_encode, T_COSE_ALGORITHM_SHA_256);
+    QCBOREncode_AddBytes(&cbor_encode, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert3));
+    QCBOREncode_CloseArray(&cbor_encode);
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &unprotected)) {
+        return 2000;
+    }
+    result = t_cose_test_message_sign1_from_parts(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_alg),
+                                                  unprotected,
+                                                  s_input_payload,
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                                                  message_buffer,
+                                                  &message);
+    if(result) {
+        return 2100 + (int32_t)result;
+    }
+    result = t_cose_sign1_parse(&verify_ctx, message, &parsed);
+    if(result) {
+        return 2200 + (int32_t)result;
+    }
+    /* The span is the three with the heads of the last two */
+    if(parsed.parameters.x5chain.len != 2 + 1 + 3 + 2 + 30 ||
+       parsed.parameters.x5t_alg != T_COSE_ALGORITHM_SHA_256 ||
+       q_useful_buf_compare(parsed.parameters.x5t_hash, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert3))) {
+        return 2300;
+    }
+    cert = t_cose_x5chain_next_cert(&parsed.parameters, NULL_Q_USEFUL_BUF_C);
+    if(q_useful_buf_compare(cert, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert1))) {
+        return 2400;
+    }
+    cert = t_cose_x5chain_next_cert(&parsed.parameters, cert);
+    if(q_useful_buf_compare(cert, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert2))) {
+        return 2500;
+    }
+    cert = t_cose_x5chain_next_cert(&parsed.parameters, cert);
+    if(q_useful_buf_compare(cert, Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5chain_test_cert3)) ||
+       !q_useful_buf_c_is_null(t_cose_x5chain_next_cert(&parsed.parameters, cert))) {
+        return 2600;
+    }
+
+    /* --- Protected, and from the header cache in another buffer --- */
+    t_cose_header_cache_init(&header_cache, header_cache_entries, 1);
+    t_cose_sign1_verify_set_header_cache(&verify_ctx, &header_cache);
+    result = t_cose_test_message_sign1_from_parts(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_x5chain),
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(no_parameters),
+                                                  s_input_payload,
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                                                  message_buffer,
+                                                  &message);
+    if(result) {
+        return 3000 + (int32_t)result;
+    }
+    copy = q_useful_buf_copy(copy_buffer, message);
+    for(i = 0; i < 2; i++) {
+        result = t_cose_sign1_parse(&verify_ctx, i == 0 ? message : copy, &parsed);
+        if(result) {
+            return 3100 + (int32_t)result;
+        }
+        cert = t_cose_x5chain_next_cert(&parsed.parameters, parsed.parameters.x5chain_leaf);
+        if((const uint8_t *)parsed.parameters.x5chain.ptr < (const uint8_t *)(i == 0 ? message : copy).ptr ||
+           (const uint8_t *)parsed.parameters.x5chain.ptr >= (const uint8_t *)(i == 0 ? message : copy).ptr + message.len ||
+           parsed.parameters.x5chain.len != 3 ||
+           cert.len != 1 || *(const uint8_t *)cert.ptr != 0x02) {
+            return 3200;
+        }
+    }
+    t_cose_header_cache_clear(&header_cache);
+    t_cose_sign1_verify_set_header_cache(&verify_ctx, NULL);
+
+    /* --- Bad ones --- */
+    for(i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        result = t_cose_test_message_sign1_from_parts(
+                        bad[i].x5chain_protected ? Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_x5chain)
+                                                 : Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_alg),
+                        (struct q_useful_buf_c){bad[i].unprotected, bad[i].len},
+                        s_input_payload,
+                        Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                        message_buffer,
+                        &message);
+        if(result) {
+            return 4000 + (int32_t)i;
+        }
+        result = t_cose_sign1_parse(&verify_ctx, message, &parsed);
+        if(result != bad[i].err) {
+            return 4100 + (int32_t)(i * 100) + (int32_t)result;
+        }
+    }
+    result = t_cose_test_message_sign1_from_parts(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_x5t),
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5t_only),
+                                                  s_input_payload,
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                                                  message_buffer,
+                                                  &message);
+    if(result) {
+        return 5000 + (int32_t)result;
+    }
+    result = t_cose_sign1_parse(&verify_ctx, message, &parsed);
+    if(result != T_COSE_ERR_DUPLICATE_PARAMETER) {
+        return 5100 + (int32_t)result;
+    }
+
+    /* --- Verifying without a usable chain --- */
+    /* Only some crypto adapters can validate certificate chains */
+    init_result = t_cose_x5chain_cache_init(&cache, entries, 2, NULL, 0);
+    if(init_result != T_COSE_SUCCESS && init_result != T_COSE_ERR_X5CHAIN_UNSUPPORTED) {
+        return 6000 + (int32_t)init_result;
+    }
+    result = t_cose_test_message_sign1_from_parts(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_alg),
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(x5t_only),
+                                                  s_input_payload,
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                                                  message_buffer,
+                                                  &message);
+    if(result) {
+        return 6100 + (int32_t)result;
+    }
+    /* x5t of a chain that isn't cached */
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C, &payload, NULL);
+    if(result != T_COSE_ERR_NO_X5CHAIN) {
+        return 6200 + (int32_t)result;
+    }
+    result = t_cose_test_message_sign1_from_parts(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_alg),
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(no_parameters),
+                                                  s_input_payload,
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                                                  message_buffer,
+                                                  &message);
+    if(result) {
+        return 6300 + (int32_t)result;
+    }
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C, &payload, NULL);
+    if(result != T_COSE_ERR_NO_X5CHAIN) {
+        return 6400 + (int32_t)result;
+    }
+    result = t_cose_test_message_sign1_from_parts(Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(protected_alg),
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(one_cert),
+                                                  s_input_payload,
+                                                  Q_USEFUL_BUF_FROM_BYTE_ARRAY_LITERAL(signature),
+                                                  message_buffer,
+                                                  &message);
+    if(result) {
+        return 6500 + (int32_t)result;
+    }
+    /* h'0102' isn't a certificate */
+    result = t_cose_sign1_verify_x5chain(&verify_ctx, &cache, message, NULL_Q_USEFUL_BUF_C, &payload, NULL);
+    if(result != (init_result == T_COSE_SUCCESS ? T_COSE_ERR_X5CHAIN_INVALID : T_COSE_ERR_X5CHAIN_UNSUPPORTED)) {
+        return 6600 + (int32_t)result;
+    }
+    t_cose_x5chain_cache_free(&cache);
+
+    return 0;
+}
+
+
+/* Make a short-circuit signed CWT with an exp, if not 0, and a cti,
+ * if not NULL_Q_USEFUL_BUF_C */
+static enum t_cose_err_t
+replay_test_cwt(int64_t                exp,
+                struct q_useful_buf_c  cti,
+                struct q_useful_buf    buffer,
+                struct q_useful_buf_c *cwt)
+{
+    struct t_cose_sign1_sign_ctx sign_ctx;
+    QCBOREncodeContext           cbor_encode;
+    Q_USEFUL_BUF_MAKE_STACK_UB(  claims_buffer, 60);
+    struct q_useful_buf_c        claims;
+
+    QCBOREncode_Init(&cbor_encode, claims_buffer);
+    QCBOREncode_OpenMap(&cbor_encode);
+    QCBOREncode_AddSZStringToMapN(&cbor_encode, T_COSE_CWT_CLAIM_SUB, "erikw");
+    if(exp != 0) {
+        QCBOREncode_AddInt64ToMapN(&cbor_encode, T_COSE_CWT_CLAIM_EXP, exp);
+    }
+    if(!q_useful_buf_c_is_null(cti)) {
+        QCBOREncode_AddBytesToMapN(&cbor_encode, T_COSE_CWT_CLAIM_CTI, cti);
+    }
+    QCBOREncode_CloseMap(&cbor_encode);
+    if(QCBOREncode_Finish(&cbor_encode, &claims)) {
+        return T_COSE_ERR_CBOR_FORMATTING;
+    }
+
+    t_cose_sign1_sign_init(&sign_ctx, T_COSE_OPT_SHORT_CIRCUIT_SIG, T_COSE_ALGORITHM_ES256);
+    return t_cose_sign1_sign(&sign_ctx, claims, buffer, cwt);
+}
+
+
+/*
+ * Public function, see t_cose_test.h
+ */
+int_fast32_t short_circuit_replay_cache_test()
+{
+    struct t_cose_replay_cache     replay;
+    uint64_t                       slots[64];
+    struct t_cose_sign1_verify_ctx verify_ctx;
+    struct t_cose_cwt_validation   validation;
+    Q_USEFUL_BUF_MAKE_STACK_UB(    signed_cose_buffer, 200);
+    struct q_useful_buf_c          signed_cose;
+    enum t_cose_err_t              result;
+    const int64_t                  now = 1444000000;
+    const struct q_useful_buf_c    id_a = Q_USEFUL_BUF_FROM_SZ_LITERAL("a");
+    const struct q_useful_buf_c    id_b = Q_USEFUL_BUF_FROM_SZ_LITERAL("b");
+
+    /* --- Setting up --- */
+    if(t_cose_replay_cache_init(&replay, slots, 64, 0, 4) != T_COSE_ERR_INVALID_ARGUMENT ||
+       t_cose_replay_cache_init(&replay, slots, 64, 100, 0) != T_COSE_ERR_INVALID_ARGUMENT ||
+       t_cose_replay_cache_init(&replay, slots, 64, 100, T_COSE_REPLAY_MAX_BUCKETS + 1) != T_COSE_ERR_INVALID_ARGUMENT ||
+       t_cose_replay_cache_init(&replay, slots, 4, 100, 4) != T_COSE_ERR_TOO_SMALL) {
+        return 1000;
+    }
+
+    /* 100 second buckets, five of them with 8 slots each */
+    result = t_cose_replay_cache_init(&replay, slots, 64, 400, 4);
+    if(result) {
+        return 1100 + (int32_t)result;
+    }
+
+    /* --- Checking directly --- */
+    result = t_cose_replay_cache_check(&replay, id_a, now + 10, now);
+    if(result) {
+        return 2000 + (int32_t)result;
+    }
+    result = t_cose_replay_cache_check(&replay, id_a, now + 10, now);
+    if(result != T_COSE_ERR_CWT_REPLAYED) {
+        return 2100 + (int32_t)result;
+    }
+    /* Another id and the same id in another bucket are different */
+    result = t_cose_replay_cache_check(&replay, id_b, now + 10, now);
+    if(result) {
+        return 2200 + (int32_t)result;
+    }
+    result = t_cose_replay_cache_check(&replay, id_a, now + 300, now);
+    if(result) {
+        return 2300 + (int32_t)result;
+    }
+    if(t_cose_replay_cache_check(&replay, id_b, now, now) != T_COSE_ERR_CWT_EXPIRED ||
+       t_cose_replay_cache_check(&replay, id_b, now + 500, now) != T_COSE_ERR_REPLAY_CACHE_FULL ||
+       t_cose_replay_cache_check(&replay, id_b, 10, -10) != T_COSE_ERR_INVALID_ARGUMENT) {
+        return 2400;
+    }
+
+    /* --- Eviction when a bucket comes round again --- */
+    result = t_cose_replay_cache_check(&replay, id_a, now + 10 + 500, now + 500);
+    if(result) {
+        return 3000 + (int32_t)result;
+    }
+    /* A thread behind the others finds its bucket moved on */
+    result = t_cose_replay_cache_check(&replay, id_b, now + 20, now);
+    if(result != T_COSE_ERR_CWT_EXPIRED) {
+        return 3100 + (int32_t)result;
+    }
+    /* The one in the bucket that wasn't moved on is still there */
+    result = t_cose_replay_cache_check(&replay, id_a, now + 300, now + 100);
+    if(result != T_COSE_ERR_CWT_REPLAYED) {
+        return 3200 + (int32_t)result;
+    }
+
+    /* --- A full bucket --- */
+    /* One bucket of one slot */
+    result = t_cose_replay_cache_init(&replay, slots, 3, 400, 1);
+    if(result) {
+        return 4000 + (int32_t)result;
+    }
+    result = t_cose_replay_cache_check(&replay, id_a, now + 10, now);
+    if(result) {
+        return 4100 + (int32_t)result;
+    }
+    result = t_cose_replay_cache_check(&replay, id_b, now + 10, now);
+    if(result != T_COSE_ERR_REPLAY_CACHE_FULL) {
+        return 4200 + (int32_t)result;
+    }
+
+    /* --- A thread behind one that moved its bucket on --- */
+    /* One slot in each of two 400 second buckets */
+    result = t_cose_replay_cache_init(&replay, slots, 3, 400, 1);
+    if(result) {
+        return 4500 + (int32_t)result;
+    }
+    /* id_a goes in the next turn of the bucket for now + 10 */
+    result = t_cose_replay_cache_check(&replay, id_a, now + 810, now + 800);
+    if(result) {
+        return 4600 + (int32_t)result;
+    }
+    /* As if id_b's thread checked the bucket's time before it moved */
+    replay.bucket_times[((now + 10) / 400) % 2] = (uint64_t)(now + 10) / 400;
+    result = t_cose_replay_cache_check(&replay, id_b, now + 10, now);
+    if(result != T_COSE_ERR_CWT_EXPIRED) {
+        return 4700 + (int32_t)result;
+    }
+    /* id_a wasn't overwritten */
+    replay.bucket_times[((now + 10) / 400) % 2] = (uint64_t)(now + 810) / 400;
+    result = t_cose_replay_cache_check(&replay, id_a, now + 810, now + 800);
+    if(result != T_COSE_ERR_CWT_REPLAYED) {
+        return 4800 + (int32_t)result;
+    }
+
+    /* --- In CWT verification --- */
+    /* Only real signature checks may fill the cache; the rest of the
+     * CWT cases are in sign_verify_replay_cache_test() */
+    result = t_cose_replay_cache_init(&replay, slots, 64, 400, 4);
+    if(result) {
+        return 5000 + (int32_t)result;
+    }
+    t_cose_cwt_validation_init(&validation, 0);
+    validation.clock        = cwt_test_clock;
+    validation.replay_cache = &replay;
+    cwt_test_now            = now;
+
+    result = replay_test_cwt(now + 60, Q_USEFUL_BUF_FROM_SZ_LITERAL("cti-1"), signed_cose_buffer, &signed_cose);
+    if(result) {
+        return 5100 + (int32_t)result;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_DECODE_ONLY);
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_INVALID_ARGUMENT) {
+        return 5200 + (int32_t)result;
+    }
+    t_cose_sign1_verify_init(&verify_ctx, T_COSE_OPT_ALLOW_SHORT_CIRCUIT);
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result != T_COSE_ERR_INVALID_ARGUMENT) {
+        return 5300 + (int32_t)result;
+    }
+    /* Neither put cti-1 in the cache */
+    result = t_cose_replay_cache_check(&replay, Q_USEFUL_BUF_FROM_SZ_LITERAL("cti-1"), now + 60, now);
+    if(result) {
+        return 5400 + (int32_t)result;
+    }
+
+    /* Without a cache short-circuit verification still works */
+    validation.replay_cache = NULL;
+    result = t_cose_sign1_verify_cwt(&verify_ctx, signed_cose, &validation, NULL, NULL);
+    if(result) {
+        return 5500 + (int32_t)result;
+    }
+
+    return 0;
+}
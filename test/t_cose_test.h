@@ -155,4 +155,125 @@ int_fast32_t get_size_test(void);
 int_fast32_t indef_array_and_map_test(void);
 
 
+/*
+ * Test t_cose_sign1_sign_batch() and t_cose_sign1_verify_batch()
+ * with short-circuit signatures against signing and verifying one
+ * at a time, including per-item failures.
+ */
+int_fast32_t short_circuit_batch_test(void);
+
+
+/*
+ * Test signing and verifying with one t_cose_sign1_signer and
+ * t_cose_sign1_verifier and per-call state, including that the
+ * output matches a context and the signer isn't modified.
+ */
+int_fast32_t short_circuit_shared_config_test(void);
+
+
+/*
+ * Test t_cose_sign1_reserve_payload() and t_cose_sign1_sign_reserved()
+ * make the same message as signing in one go, including size
+ * calculation and a buffer that is too small.
+ */
+int_fast32_t short_circuit_reserve_payload_test(void);
+
+
+/*
+ * Test the header, payload and trailer from t_cose_sign1_sign_iovec()
+ * join up to the same message as signing in one go, including size
+ * calculation and buffers that are too small.
+ */
+int_fast32_t short_circuit_iovec_test(void);
+
+
+/*
+ * Test t_cose_sign1_parse() and t_cose_sign1_verify_parsed() with
+ * attached and detached payloads, tags and the verification options.
+ */
+int_fast32_t short_circuit_parse_test(void);
+
+
+/*
+ * Test each limit of a verification policy, just inside and just
+ * outside.
+ */
+int_fast32_t short_circuit_policy_test(void);
+
+
+/*
+ * Test that verifying with a header cache gives the same results,
+ * that entries are replaced least recently used first and that
+ * critical parameters are never cached.
+ */
+int_fast32_t short_circuit_header_cache_test(void);
+
+
+/*
+ * Test Merkle tree signing and receipt verification for trees of 1
+ * to 40 payloads and receipts with the wrong index, tree size or
+ * signed root.
+ */
+int_fast32_t short_circuit_merkle_test(void);
+
+
+/*
+ * Test signing hash envelopes and verifying them against the right
+ * and wrong hashes and hash algorithms.
+ */
+int_fast32_t short_circuit_hash_envelope_test(void);
+
+
+/*
+ * Test that a CWT template gives the RFC 8392 example claims, that
+ * slots can be changed between signings and the template limits.
+ */
+int_fast32_t short_circuit_cwt_template_test(void);
+
+
+/*
+ * Test checking CWT claims after and before the signature, with
+ * leeway, issuer and audience, and payloads that aren't claims sets.
+ */
+int_fast32_t short_circuit_cwt_validate_test(void);
+
+
+/*
+ * Test indexing a verified EAT with submodules, looking claims up in
+ * it and payloads that can't be indexed.
+ */
+int_fast32_t short_circuit_claims_index_test(void);
+
+
+/*
+ * Test the encoder and decoder generated from test/cddl/cwt_claims.cddl
+ * against the RFC 8392 example, through signing and verifying.
+ */
+int_fast32_t short_circuit_cddl_gen_test(void);
+
+
+/*
+ * Test verifying an EAT and the submodule tokens in it, two deep, on
+ * a dispatch function, and claims at the paths that aren't tokens.
+ */
+int_fast32_t short_circuit_nested_verify_test(void);
+
+
+/*
+ * Test decoding of the x5chain and x5t parameters, including from
+ * the header cache, and verifying with neither a cached nor a valid
+ * chain.
+ */
+int_fast32_t short_circuit_x5chain_test(void);
+
+
+/*
+ * Test the replay cache directly, with buckets being reused and
+ * filling up and a thread that falls behind another, and that CWT
+ * verification without a real signature check refuses a replay cache
+ * and leaves it empty.
+ */
+int_fast32_t short_circuit_replay_cache_test(void);
+
+
 #endif /* t_cose_test_h */
@@ -0,0 +1,196 @@
+/*
+ *  t_cose_x5chain_test_certs.h
+ *
+ * Copyright 2022, Laurence Lundblade
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * See BSD-3-Clause license in README.md
+ */
+
+#ifndef t_cose_x5chain_test_certs_h
+#define t_cose_x5chain_test_certs_h
+
+#include <stdint.h>
+
+
+/**
+ * DER X.509 certificates for testing x5chain verification. They are
+ * all P-256 and good for 100 years from October 2026. The device
+ * certificate is for the ES256 key from make_key_pair() and is
+ * issued by the intermediate, which is issued by the root.
+ *
+ * They were made by:
+ *
+ *   openssl req -new -x509 -key root.key -subj "/CN=t_cose test root" -days 36500 \
+ *       -addext "basicConstraints=critical,CA:TRUE" \
+ *       -addext "keyUsage=critical,keyCertSign,cRLSign" -out root.pem
+ *   openssl x509 -req -in inter.csr -CA root.pem -CAkey root.key -days 36500 \
+ *       -extfile ca.ext -out inter.pem
+ *   openssl x509 -req -in leaf.csr -CA inter.pem -CAkey inter.key -days 36500 \
+ *       -extfile leaf.ext -out leaf.pem
+ *   openssl x509 -in leaf.pem -outform DER | xxd -i
+ *
+ * with the extensions files having CA:TRUE and keyCertSign for the
+ * intermediate and CA:FALSE and digitalSignature for the device.
+ */
+
+/* CN=t_cose test root, self-signed */
+static const uint8_t x5chain_test_root[] = {
+    0x30, 0x82, 0x01, 0x9c, 0x30, 0x82, 0x01, 0x43, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x14, 0x6e, 0x30, 0x06, 0xf2, 0xa8, 0x7a, 0x1c, 0xb5, 0x3b,
+    0x99, 0xb7, 0x8c, 0x18, 0x98, 0xee, 0x55, 0x79, 0xcc, 0x65, 0xf1, 0x30,
+    0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x30,
+    0x1b, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x10,
+    0x74, 0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20,
+    0x72, 0x6f, 0x6f, 0x74, 0x30, 0x20, 0x17, 0x0d, 0x32, 0x36, 0x31, 0x30,
+    0x31, 0x39, 0x30, 0x33, 0x33, 0x31, 0x32, 0x31, 0x5a, 0x18, 0x0f, 0x32,
+    0x31, 0x32, 0x36, 0x30, 0x39, 0x32, 0x35, 0x30, 0x33, 0x33, 0x31, 0x32,
+    0x31, 0x5a, 0x30, 0x1b, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x10, 0x74, 0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x65,
+    0x73, 0x74, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x30, 0x59, 0x30, 0x13, 0x06,
+    0x07, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x02, 0x01, 0x06, 0x08, 0x2a, 0x86,
+    0x48, 0xce, 0x3d, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04, 0x27, 0x59,
+    0xb1, 0xb9, 0x1e, 0x33, 0x05, 0x1e, 0xb8, 0x25, 0x08, 0xc7, 0x40, 0x46,
+    0x4b, 0x2b, 0x8d, 0x63, 0x18, 0xb8, 0xa0, 0xfb, 0x3a, 0xab, 0x8b, 0x2f,
+    0x1d, 0xd7, 0xe4, 0x4f, 0x8a, 0x3d, 0xc4, 0x88, 0x40, 0xc7, 0xc7, 0x6e,
+    0xc8, 0xe1, 0x6b, 0xe5, 0x16, 0x2a, 0xaf, 0x6f, 0x79, 0x8c, 0x22, 0x70,
+    0x48, 0x2e, 0x78, 0x3e, 0xe7, 0xe2, 0x1e, 0x53, 0x12, 0xc6, 0x58, 0xa7,
+    0xb2, 0x6e, 0xa3, 0x63, 0x30, 0x61, 0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d,
+    0x0e, 0x04, 0x16, 0x04, 0x14, 0xc3, 0xf9, 0x6e, 0xfe, 0xef, 0x42, 0x99,
+    0x07, 0x0d, 0x14, 0x32, 0x1a, 0x4d, 0x55, 0x58, 0x32, 0xd2, 0xed, 0x70,
+    0xcd, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23, 0x04, 0x18, 0x30, 0x16,
+    0x80, 0x14, 0xc3, 0xf9, 0x6e, 0xfe, 0xef, 0x42, 0x99, 0x07, 0x0d, 0x14,
+    0x32, 0x1a, 0x4d, 0x55, 0x58, 0x32, 0xd2, 0xed, 0x70, 0xcd, 0x30, 0x0f,
+    0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x05, 0x30, 0x03,
+    0x01, 0x01, 0xff, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01,
+    0xff, 0x04, 0x04, 0x03, 0x02, 0x01, 0x06, 0x30, 0x0a, 0x06, 0x08, 0x2a,
+    0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x03, 0x47, 0x00, 0x30, 0x44,
+    0x02, 0x20, 0x39, 0xc7, 0xb9, 0x0b, 0x37, 0x30, 0x7a, 0xc1, 0xa0, 0xe7,
+    0xbf, 0x09, 0x7f, 0x7b, 0x7f, 0x24, 0xf1, 0x36, 0xee, 0x9c, 0x36, 0x63,
+    0xcb, 0x00, 0x68, 0xe7, 0x11, 0x01, 0x6e, 0xef, 0x30, 0x42, 0x02, 0x20,
+    0x50, 0x66, 0xf3, 0x80, 0x31, 0x68, 0x08, 0xfd, 0x59, 0x84, 0xa5, 0xa3,
+    0xbf, 0xdd, 0xa0, 0x91, 0x9f, 0xc2, 0xfe, 0xc7, 0x46, 0x8b, 0xea, 0x59,
+    0x5b, 0xc8, 0x67, 0xef, 0x30, 0x22, 0x35, 0xc6
+};
+
+/* CN=t_cose test intermediate, issued by the root */
+static const uint8_t x5chain_test_intermediate[] = {
+    0x30, 0x82, 0x01, 0xa6, 0x30, 0x82, 0x01, 0x4b, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x14, 0x4d, 0x33, 0x4d, 0x18, 0x6b, 0xf6, 0xfa, 0x57, 0x72,
+    0x78, 0x5e, 0x11, 0xa7, 0xf1, 0xe9, 0xb6, 0x9d, 0x72, 0x95, 0x79, 0x30,
+    0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x30,
+    0x1b, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x10,
+    0x74, 0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20,
+    0x72, 0x6f, 0x6f, 0x74, 0x30, 0x20, 0x17, 0x0d, 0x32, 0x36, 0x31, 0x30,
+    0x31, 0x39, 0x30, 0x33, 0x33, 0x31, 0x32, 0x31, 0x5a, 0x18, 0x0f, 0x32,
+    0x31, 0x32, 0x36, 0x30, 0x39, 0x32, 0x35, 0x30, 0x33, 0x33, 0x31, 0x32,
+    0x31, 0x5a, 0x30, 0x23, 0x31, 0x21, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x18, 0x74, 0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x65,
+    0x73, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69,
+    0x61, 0x74, 0x65, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2a, 0x86, 0x48,
+    0xce, 0x3d, 0x02, 0x01, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x03,
+    0x01, 0x07, 0x03, 0x42, 0x00, 0x04, 0x31, 0x0e, 0x2b, 0x9c, 0xb7, 0x49,
+    0xf4, 0xd0, 0x91, 0xb7, 0x19, 0x5e, 0x23, 0xed, 0xb1, 0xd8, 0xb0, 0x9e,
+    0x9e, 0x04, 0xae, 0x3b, 0x08, 0x89, 0xcc, 0x87, 0xa3, 0x3e, 0x61, 0xe2,
+    0x6d, 0x97, 0xf5, 0x17, 0x2c, 0x24, 0xbb, 0x49, 0x68, 0xe3, 0xa1, 0x2c,
+    0x19, 0x7e, 0x0b, 0xec, 0x8f, 0xc0, 0x27, 0xc1, 0xeb, 0xbc, 0x80, 0x19,
+    0xcf, 0xed, 0xdc, 0x0d, 0x1e, 0x7b, 0x8b, 0xdf, 0x50, 0xd1, 0xa3, 0x63,
+    0x30, 0x61, 0x30, 0x0f, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff,
+    0x04, 0x05, 0x30, 0x03, 0x01, 0x01, 0xff, 0x30, 0x0e, 0x06, 0x03, 0x55,
+    0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03, 0x02, 0x01, 0x06, 0x30,
+    0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x43, 0x63,
+    0xec, 0xf3, 0xa5, 0x2d, 0x6e, 0x60, 0x10, 0xcb, 0x01, 0xd0, 0x88, 0xa1,
+    0xa0, 0x33, 0x62, 0x9e, 0x77, 0x18, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x1d,
+    0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xc3, 0xf9, 0x6e, 0xfe, 0xef,
+    0x42, 0x99, 0x07, 0x0d, 0x14, 0x32, 0x1a, 0x4d, 0x55, 0x58, 0x32, 0xd2,
+    0xed, 0x70, 0xcd, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d,
+    0x04, 0x03, 0x02, 0x03, 0x49, 0x00, 0x30, 0x46, 0x02, 0x21, 0x00, 0xa4,
+    0x7c, 0x5d, 0xb4, 0x57, 0xee, 0x48, 0x4b, 0x8e, 0xc8, 0x52, 0x61, 0xde,
+    0x9a, 0x6a, 0x54, 0x53, 0x40, 0xdd, 0xe8, 0xdf, 0x4c, 0x2f, 0xae, 0xd1,
+    0x62, 0xc6, 0xf0, 0x40, 0x75, 0x83, 0xa9, 0x02, 0x21, 0x00, 0xd0, 0x0d,
+    0xd1, 0xc5, 0xb6, 0xa2, 0x2f, 0x52, 0xd2, 0xe7, 0x4d, 0x13, 0x06, 0xa0,
+    0xb2, 0xa8, 0x96, 0xbb, 0xb0, 0x19, 0xf2, 0xca, 0x48, 0x2a, 0x7c, 0x98,
+    0xa9, 0x8f, 0x15, 0x8a, 0x84, 0x21
+};
+
+/* CN=t_cose test device, issued by the intermediate */
+static const uint8_t x5chain_test_device[] = {
+    0x30, 0x82, 0x01, 0xa4, 0x30, 0x82, 0x01, 0x4a, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x14, 0x7c, 0x8b, 0xc4, 0x26, 0xa4, 0x36, 0x46, 0xbf, 0xd3,
+    0x63, 0xbf, 0x74, 0xc2, 0x1b, 0xb7, 0xff, 0xa4, 0x41, 0xe3, 0xd0, 0x30,
+    0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x30,
+    0x23, 0x31, 0x21, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x18,
+    0x74, 0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20,
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65,
+    0x30, 0x20, 0x17, 0x0d, 0x32, 0x36, 0x31, 0x30, 0x31, 0x39, 0x30, 0x33,
+    0x33, 0x31, 0x33, 0x34, 0x5a, 0x18, 0x0f, 0x32, 0x31, 0x32, 0x36, 0x30,
+    0x39, 0x32, 0x35, 0x30, 0x33, 0x33, 0x31, 0x33, 0x34, 0x5a, 0x30, 0x1d,
+    0x31, 0x1b, 0x30, 0x19, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x12, 0x74,
+    0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x64,
+    0x65, 0x76, 0x69, 0x63, 0x65, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2a,
+    0x86, 0x48, 0xce, 0x3d, 0x02, 0x01, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce,
+    0x3d, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04, 0x40, 0x41, 0x6c, 0x8c,
+    0xda, 0xa0, 0xf7, 0xa1, 0x75, 0x69, 0x55, 0x53, 0xc3, 0x27, 0x9c, 0x10,
+    0x9c, 0xe9, 0x27, 0x7e, 0x53, 0xc5, 0x86, 0x2a, 0xa7, 0x15, 0xed, 0xc6,
+    0x36, 0xf1, 0x71, 0xca, 0x32, 0xf1, 0x76, 0x43, 0x54, 0x96, 0x15, 0xe5,
+    0xc8, 0x34, 0x0d, 0x43, 0x32, 0xdd, 0x13, 0x77, 0x8a, 0xec, 0x87, 0x15,
+    0x76, 0xa3, 0x3c, 0x26, 0x08, 0x6c, 0x32, 0x0c, 0x9f, 0xf3, 0x3f, 0xc7,
+    0xa3, 0x60, 0x30, 0x5e, 0x30, 0x0c, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01,
+    0x01, 0xff, 0x04, 0x02, 0x30, 0x00, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d,
+    0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03, 0x02, 0x07, 0x80, 0x30, 0x1d,
+    0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x3d, 0x46, 0xbe,
+    0x74, 0xff, 0xf6, 0x5b, 0x94, 0xe8, 0x1a, 0x22, 0x9c, 0x23, 0x25, 0x86,
+    0x25, 0x2a, 0xec, 0xda, 0x0d, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23,
+    0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x43, 0x63, 0xec, 0xf3, 0xa5, 0x2d,
+    0x6e, 0x60, 0x10, 0xcb, 0x01, 0xd0, 0x88, 0xa1, 0xa0, 0x33, 0x62, 0x9e,
+    0x77, 0x18, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04,
+    0x03, 0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x20, 0x3a, 0xb8, 0x60,
+    0x7a, 0xf9, 0xe3, 0x70, 0x45, 0x36, 0x56, 0xeb, 0xa1, 0xab, 0xf1, 0x41,
+    0x14, 0x51, 0xd8, 0x1a, 0xde, 0x95, 0x6d, 0x28, 0x1c, 0xdb, 0x11, 0x64,
+    0x85, 0x63, 0xe6, 0x26, 0x47, 0x02, 0x21, 0x00, 0x91, 0x48, 0x55, 0xd5,
+    0x96, 0x25, 0x08, 0x42, 0x6b, 0x59, 0x18, 0xbe, 0xca, 0x07, 0xd3, 0xcc,
+    0x02, 0xda, 0x58, 0x6c, 0x9b, 0x1f, 0x39, 0xee, 0x25, 0x2a, 0x75, 0x3b,
+    0xa9, 0x49, 0xe1, 0x43
+};
+
+/* CN=t_cose other root, self-signed and unrelated to the others */
+static const uint8_t x5chain_test_other_root[] = {
+    0x30, 0x82, 0x01, 0x8f, 0x30, 0x82, 0x01, 0x35, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x14, 0x45, 0x4c, 0x8d, 0x96, 0x83, 0x27, 0x32, 0x86, 0x4d,
+    0x62, 0xbe, 0x95, 0x4d, 0xbb, 0x9c, 0x9c, 0x15, 0x7f, 0x8d, 0x9b, 0x30,
+    0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x30,
+    0x1c, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x11,
+    0x74, 0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+    0x20, 0x72, 0x6f, 0x6f, 0x74, 0x30, 0x20, 0x17, 0x0d, 0x32, 0x36, 0x31,
+    0x30, 0x31, 0x39, 0x30, 0x33, 0x33, 0x31, 0x32, 0x31, 0x5a, 0x18, 0x0f,
+    0x32, 0x31, 0x32, 0x36, 0x30, 0x39, 0x32, 0x35, 0x30, 0x33, 0x33, 0x31,
+    0x32, 0x31, 0x5a, 0x30, 0x1c, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03, 0x55,
+    0x04, 0x03, 0x0c, 0x11, 0x74, 0x5f, 0x63, 0x6f, 0x73, 0x65, 0x20, 0x6f,
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x30, 0x59, 0x30,
+    0x13, 0x06, 0x07, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x02, 0x01, 0x06, 0x08,
+    0x2a, 0x86, 0x48, 0xce, 0x3d, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04,
+    0xf3, 0xa1, 0xa3, 0x3c, 0x68, 0x08, 0x5c, 0xcf, 0xa0, 0x60, 0x79, 0x39,
+    0x35, 0x52, 0xbc, 0xb4, 0xbc, 0x7e, 0xb0, 0x5a, 0xdd, 0xe0, 0x4c, 0x78,
+    0x86, 0xc0, 0xc0, 0xa1, 0xc7, 0xe9, 0x52, 0x5d, 0x99, 0xaa, 0x4a, 0xfa,
+    0xdd, 0x16, 0x7b, 0x2d, 0xa6, 0xd3, 0xda, 0x9a, 0x14, 0x41, 0x7d, 0xe9,
+    0xcc, 0xd2, 0x83, 0xa8, 0x55, 0x97, 0xa0, 0x91, 0x7e, 0x0c, 0xb3, 0x8a,
+    0x47, 0x5c, 0xd9, 0x64, 0xa3, 0x53, 0x30, 0x51, 0x30, 0x1d, 0x06, 0x03,
+    0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x72, 0xbb, 0xd6, 0x73, 0xf1,
+    0xc9, 0xc0, 0x5d, 0x02, 0x1b, 0x17, 0x6f, 0x3e, 0x34, 0x68, 0xba, 0x99,
+    0xed, 0xd2, 0xf0, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23, 0x04, 0x18,
+    0x30, 0x16, 0x80, 0x14, 0x72, 0xbb, 0xd6, 0x73, 0xf1, 0xc9, 0xc0, 0x5d,
+    0x02, 0x1b, 0x17, 0x6f, 0x3e, 0x34, 0x68, 0xba, 0x99, 0xed, 0xd2, 0xf0,
+    0x30, 0x0f, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x05,
+    0x30, 0x03, 0x01, 0x01, 0xff, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48,
+    0xce, 0x3d, 0x04, 0x03, 0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x21,
+    0x00, 0x9d, 0x1b, 0x16, 0x0c, 0xe4, 0xe2, 0x06, 0x36, 0x63, 0x4d, 0xff,
+    0x39, 0xec, 0x2a, 0xa9, 0xdd, 0xc6, 0xaf, 0x08, 0x37, 0xf5, 0x57, 0x53,
+    0xb7, 0x95, 0x4d, 0xef, 0x58, 0x7f, 0x13, 0xae, 0x91, 0x02, 0x20, 0x39,
+    0xf2, 0x5c, 0xba, 0x21, 0x67, 0xb9, 0x5e, 0xb8, 0xc4, 0x5c, 0xab, 0x01,
+    0xa2, 0x70, 0xd8, 0xd7, 0xe6, 0x72, 0x49, 0x28, 0x54, 0x91, 0x70, 0xf1,
+    0x9f, 0x75, 0x1f, 0xe9, 0x9e, 0xfe, 0x88
+};
+
+
+#endif /* t_cose_x5chain_test_certs_h */
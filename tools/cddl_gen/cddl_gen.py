@@ -0,0 +1,1250 @@
+#!/usr/bin/env python3
+#
+#  cddl_gen.py
+#
+# Copyright 2022, Laurence Lundblade
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# See BSD-3-Clause license in README.md
+
+"""Generate C encoders and decoders for a CDDL claims map.
+
+Decoding a claims map with QCBOR is general: each item is decoded into
+a QCBORItem and then matched against the labels that are wanted. When
+the payload schema is known ahead of time all of that can be decided
+when the code is written. This reads a CDDL (RFC 8610) schema for a
+map and writes a C struct for it with an encoder and a decoder that do
+only what the schema says:
+
+  - The encoder writes each label as constant bytes and each value
+    with the shortest head. Nothing is allocated.
+  - The decoder reads each label head and dispatches on it with a
+    switch. Values are decoded straight into the struct, strings point
+    into the payload and nothing is allocated. Duplicate, missing and
+    mistyped claims are rejected.
+  - Wrappers sign a struct with t_cose_sign1_sign() and verify and
+    decode one with t_cose_sign1_verify().
+
+The generated code needs only t_cose headers, not QCBOR.
+
+The CDDL understood is the part used for claims sets like CWT and EAT:
+
+    cwt-claims = {
+        ? iss-label => tstr .size (0..64)    ; a label rule
+        ? exp-label => ~time                 ; an integer NumericDate
+        ? 7 => bstr .size 16                 ; a literal integer label
+        ? "debug" => bool                    ; a text label
+        ? hw => hw-claims                    ; a nested map
+        * int => any                         ; skip other int labels
+    }
+    iss-label = 1
+    exp-label = 4
+
+Labels are integers or text strings, given literally, as a rule that is
+one, or as a bare word, which is a text label. Value types are int,
+uint, nint, tstr/text, bstr/bytes, bool, ~time (an int64 NumericDate;
+floating point dates are rejected) and other map rules. A rule may
+name a type to use as an alias. tstr and bstr take a .size of one
+length or a range. Members are required or "?" optional. "* int => any"
+and "* tstr => any" let a map have other labels of that kind, which
+the decoder skips and the encoder never writes. Arrays, choices and
+groups are not supported; anything not understood is an error.
+
+Usage:
+
+    cddl_gen.py [--rule NAME] [--check] SCHEMA.cddl OUT_BASE
+
+writes OUT_BASE.h and OUT_BASE.c for the map rule NAME, by default the
+first one in the schema. With --check nothing is written; the exit
+status is 1 if the files differ from what would be generated.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+class CddlError(Exception):
+    pass
+
+
+# ---------------------------------------------------------------------------
+# Parsing
+
+TOKEN_RE = re.compile(r'''
+      (?P<space>\s+|;[^\n]*)
+    | (?P<string>"[^"\\]*")
+    | (?P<control>\.[a-z]+)
+    | (?P<range>\.\.\.?)
+    | (?P<arrow>=>)
+    | (?P<int>-?[0-9]+)
+    | (?P<name>[A-Za-z@_$](?:[A-Za-z0-9@_$.-]*[A-Za-z0-9@_$])?)
+    | (?P<punct>[=?*+~{}():,\[\]/])
+''', re.VERBOSE)
+
+
+def tokenize(text):
+    tokens = []
+    pos = 0
+    line = 1
+    while pos < len(text):
+        match = TOKEN_RE.match(text, pos)
+        if not match:
+            raise CddlError('line %d: can\'t parse "%s"' % (line, text[pos:pos + 20].split('\n')[0]))
+        kind = match.lastgroup
+        value = match.group(kind)
+        if kind != 'space':
+            tokens.append((kind, value, line))
+        line += value.count('\n')
+        pos = match.end()
+    tokens.append(('end', '', line))
+    return tokens
+
+
+class Parser:
+    def __init__(self, text):
+        self.tokens = tokenize(text)
+        self.pos = 0
+
+    def peek(self, offset=0):
+        return self.tokens[self.pos + offset]
+
+    def next(self):
+        token = self.tokens[self.pos]
+        self.pos += 1
+        return token
+
+    def error(self, message):
+        raise CddlError('line %d: %s' % (self.peek()[2], message))
+
+    def expect(self, value):
+        token = self.next()
+        if token[1] != value:
+            self.pos -= 1
+            self.error('expected "%s", not "%s"' % (value, token[1]))
+        return token
+
+    def accept(self, value):
+        if self.peek()[1] == value and self.peek()[0] != 'string':
+            self.pos += 1
+            return True
+        return False
+
+    def rules(self):
+        rules = {}
+        order = []
+        while self.peek()[0] != 'end':
+            kind, name, line = self.next()
+            if kind != 'name':
+                self.pos -= 1
+                self.error('expected a rule name')
+            self.expect('=')
+            if name in rules:
+                raise CddlError('line %d: rule "%s" is defined twice' % (line, name))
+            rules[name] = self.rule_value()
+            order.append(name)
+        return rules, order
+
+    def rule_value(self):
+        kind, value, _ = self.peek()
+        if kind == 'int':
+            self.next()
+            return ('int', int(value))
+        if kind == 'string':
+            self.next()
+            return ('tstr', value[1:-1])
+        if value == '{':
+            return self.map()
+        return self.type()
+
+    def map(self):
+        self.expect('{')
+        members = []
+        wildcards = set()
+        while not self.accept('}'):
+            if self.accept('*'):
+                key_type = self.next()[1]
+                self.expect('=>')
+                if self.next()[1] != 'any' or key_type not in ('int', 'tstr', 'text'):
+                    self.pos -= 1
+                    self.error('only "* int => any" and "* tstr => any" are supported')
+                wildcards.add('int' if key_type == 'int' else 'tstr')
+            else:
+                optional = self.accept('?')
+                if self.peek()[1] in ('*', '+'):
+                    self.error('only "?" occurrences are supported for members')
+                kind, value, line = self.next()
+                if kind == 'name' and self.accept(':'):
+                    key = ('tstr', value)
+                elif kind in ('int', 'string', 'name'):
+                    if kind == 'int':
+                        key = ('int', int(value))
+                    elif kind == 'string':
+                        key = ('tstr', value[1:-1])
+                    else:
+                        key = ('rule', value)
+                    self.expect('=>')
+                else:
+                    self.pos -= 1
+                    self.error('can\'t parse member starting with "%s"' % value)
+                members.append({'optional': optional, 'key': key, 'type': self.type(), 'line': line})
+            self.accept(',')
+        return ('map', members, wildcards)
+
+    def type(self):
+        unwrap = self.accept('~')
+        kind, name, _ = self.next()
+        if kind != 'name':
+            self.pos -= 1
+            self.error('expected a type, not "%s"' % name)
+        if unwrap:
+            if name != 'time':
+                self.pos -= 1
+                self.error('"~" is only supported on time')
+            name = '~time'
+        elif name == 'time':
+            self.pos -= 1
+            self.error('time is tagged; use ~time for a NumericDate')
+        size = None
+        if self.peek()[1] == '.size':
+            self.next()
+            if self.accept('('):
+                low = int(self.expect_int())
+                inclusive = self.next()[1] == '..'
+                high = int(self.expect_int()) - (0 if inclusive else 1)
+                self.expect(')')
+            else:
+                low = high = int(self.expect_int())
+            if low < 0 or high < low:
+                self.error('bad .size')
+            size = (low, high)
+        elif self.peek()[0] == 'control':
+            self.error('control "%s" is not supported' % self.peek()[1])
+        if self.peek()[1] in ('/', '//'):
+            self.error('choices are not supported')
+        return ('type', name, size)
+
+    def expect_int(self):
+        kind, value, _ = self.next()
+        if kind != 'int':
+            self.pos -= 1
+            self.error('expected an integer')
+        return value
+
+
+# ---------------------------------------------------------------------------
+# Resolving the rules into maps of C fields
+
+C_KEYWORDS = {
+    'auto', 'bool', 'break', 'case', 'char', 'const', 'continue', 'default',
+    'do', 'double', 'else', 'enum', 'extern', 'float', 'for', 'goto', 'if',
+    'inline', 'int', 'long', 'register', 'restrict', 'return', 'short',
+    'signed', 'sizeof', 'static', 'struct', 'switch', 'typedef', 'union',
+    'unsigned', 'void', 'volatile', 'while', 'present',
+}
+
+SCALAR_TYPES = {
+    'int': 'int', 'uint': 'uint', 'nint': 'nint', '~time': 'int',
+    'tstr': 'tstr', 'text': 'tstr', 'bstr': 'bstr', 'bytes': 'bstr',
+    'bool': 'bool',
+}
+
+INT64_MAX = (1 << 63) - 1
+
+
+def c_name(name):
+    ident = re.sub(r'[^A-Za-z0-9_]', '_', name)
+    if ident[0].isdigit():
+        ident = '_' + ident
+    if ident in C_KEYWORDS:
+        ident += '_'
+    return ident
+
+
+class Schema:
+    def __init__(self, rules):
+        self.rules = rules
+        self.maps = {}
+        self.map_order = []
+
+    def resolve_type(self, type_node, seen=()):
+        _, name, size = type_node
+        if name in SCALAR_TYPES:
+            kind = SCALAR_TYPES[name]
+            if size is not None and kind not in ('tstr', 'bstr'):
+                raise CddlError('.size is only supported on tstr and bstr')
+            return {'kind': kind, 'size': size}
+        if size is not None:
+            raise CddlError('.size is only supported on tstr and bstr')
+        if name not in self.rules:
+            raise CddlError('type "%s" is not defined' % name)
+        rule = self.rules[name]
+        if rule[0] == 'map':
+            return {'kind': 'map', 'map': self.resolve_map(name, seen)}
+        if rule[0] == 'type':
+            if name in seen:
+                raise CddlError('rule "%s" refers to itself' % name)
+            return self.resolve_type(rule, seen + (name,))
+        raise CddlError('rule "%s" is a value, not a type' % name)
+
+    def resolve_map(self, name, seen=()):
+        if name in self.maps:
+            return self.maps[name]
+        if name in seen:
+            raise CddlError('map "%s" contains itself' % name)
+        _, members, wildcards = self.rules[name]
+        fields = []
+        for member in members:
+            key = member['key']
+            if key[0] == 'rule':
+                rule = self.rules.get(key[1])
+                if rule is None or rule[0] not in ('int', 'tstr'):
+                    raise CddlError('line %d: label "%s" is not an integer or text value rule' %
+                                    (member['line'], key[1]))
+                field = re.sub(r'-(claim-)?label$', '', key[1])
+                key = rule
+            elif key[0] == 'tstr':
+                field = key[1]
+            else:
+                field = 'label_%d' % key[1] if key[1] >= 0 else 'label_m%d' % -key[1]
+            if key[0] == 'int' and not -INT64_MAX - 1 <= key[1] <= INT64_MAX:
+                raise CddlError('line %d: label out of range' % member['line'])
+            value = self.resolve_type(member['type'], seen + (name,))
+            fields.append({'name': c_name(field), 'key': key,
+                           'optional': member['optional'], 'value': value})
+        if len(fields) > 32:
+            raise CddlError('map "%s" has more than 32 members' % name)
+        for i, field in enumerate(fields):
+            for other in fields[:i]:
+                if other['key'] == field['key']:
+                    raise CddlError('map "%s" has label %r twice' % (name, field['key'][1]))
+                if other['name'] == field['name']:
+                    raise CddlError('map "%s" has two members named "%s"' % (name, field['name']))
+        result = {'rule': name, 'c': c_name(name), 'fields': fields, 'wildcards': wildcards}
+        self.maps[name] = result
+        self.map_order.append(result)
+        return result
+
+
+# ---------------------------------------------------------------------------
+# CBOR encoding done by the generator
+
+def head_bytes(major_type, argument):
+    if argument < 24:
+        return bytes([major_type << 5 | argument])
+    for additional, length in ((24, 1), (25, 2), (26, 4), (27, 8)):
+        if argument < 1 << (8 * length):
+            return bytes([major_type << 5 | additional]) + argument.to_bytes(length, 'big')
+    raise CddlError('argument too large')
+
+
+def head_size(argument):
+    return len(head_bytes(0, argument))
+
+
+def label_bytes(key):
+    if key[0] == 'int':
+        if key[1] >= 0:
+            return head_bytes(0, key[1])
+        return head_bytes(1, -1 - key[1])
+    encoded = key[1].encode('utf-8')
+    return head_bytes(3, len(encoded)) + encoded
+
+
+def c_bytes(data):
+    return '"' + ''.join('\\x%02x' % b for b in data) + '"'
+
+
+def label_comment(key):
+    return str(key[1]) if key[0] == 'int' else '"%s"' % key[1]
+
+
+def max_size(map_info):
+    """The most bytes a map can encode to or None if unbounded"""
+    total = head_size(len(map_info['fields']))
+    for field in map_info['fields']:
+        value = field['value']
+        kind = value['kind']
+        if kind in ('int', 'uint', 'nint'):
+            size = 9
+        elif kind == 'bool':
+            size = 1
+        elif kind == 'map':
+            size = max_size(value['map'])
+        elif value['size'] is not None:
+            size = head_size(value['size'][1]) + value['size'][1]
+        else:
+            size = None
+        if size is None:
+            return None
+        total += len(label_bytes(field['key'])) + size
+    return total
+
+
+# ---------------------------------------------------------------------------
+# C output
+
+RUNTIME_PARTS = {
+    'defines': r'''#define CDDL_MAJOR_TYPE_POSITIVE_INT 0
+#define CDDL_MAJOR_TYPE_NEGATIVE_INT 1
+#define CDDL_MAJOR_TYPE_BYTE_STRING  2
+#define CDDL_MAJOR_TYPE_TEXT_STRING  3
+#define CDDL_MAJOR_TYPE_ARRAY        4
+#define CDDL_MAJOR_TYPE_MAP          5
+#define CDDL_MAJOR_TYPE_TAG          6
+#define CDDL_MAJOR_TYPE_SIMPLE       7
+
+#define CDDL_SIMPLE_FALSE 20
+#define CDDL_SIMPLE_TRUE  21''',
+    'out': r'''/* Where the encoder is writing */
+struct cddl_out {
+    uint8_t          *ptr;
+    size_t            size;
+    size_t            len;
+    enum t_cose_err_t error;
+};''',
+    'in': r'''/* Where the decoder is reading */
+struct cddl_in {
+    const uint8_t *pos;
+    const uint8_t *end;
+};''',
+    'fail': r'''/* Keep the first error */
+static void
+cddl_fail(struct cddl_out *out, enum t_cose_err_t error)
+{
+    if(out->error == T_COSE_SUCCESS) {
+        out->error = error;
+    }
+}''',
+    'put_bytes': r'''static void
+cddl_put_bytes(struct cddl_out *out, const void *bytes, size_t len)
+{
+    if(out->size - out->len < len) {
+        cddl_fail(out, T_COSE_ERR_TOO_SMALL);
+        return;
+    }
+    if(len > 0) {
+        memcpy(out->ptr + out->len, bytes, len);
+        out->len += len;
+    }
+}''',
+    'put_head': r'''/* Write a head in its shortest form */
+static void
+cddl_put_head(struct cddl_out *out, uint8_t major_type, uint64_t argument)
+{
+    uint8_t head[9];
+    size_t  len;
+    int     shift;
+
+    if(argument < 24) {
+        head[0] = (uint8_t)(major_type << 5 | argument);
+        len = 1;
+    } else {
+        if(argument <= UINT8_MAX) {
+            head[0] = (uint8_t)(major_type << 5 | 24);
+            len = 2;
+        } else if(argument <= UINT16_MAX) {
+            head[0] = (uint8_t)(major_type << 5 | 25);
+            len = 3;
+        } else if(argument <= UINT32_MAX) {
+            head[0] = (uint8_t)(major_type << 5 | 26);
+            len = 5;
+        } else {
+            head[0] = (uint8_t)(major_type << 5 | 27);
+            len = 9;
+        }
+        for(shift = 0; shift < (int)len - 1; shift++) {
+            head[len - 1 - (size_t)shift] = (uint8_t)(argument >> (8 * shift));
+        }
+    }
+    cddl_put_bytes(out, head, len);
+}''',
+    'put_int': r'''static void
+cddl_put_int(struct cddl_out *out, int64_t value)
+{
+    if(value < 0) {
+        cddl_put_head(out, CDDL_MAJOR_TYPE_NEGATIVE_INT, (uint64_t)(-(value + 1)));
+    } else {
+        cddl_put_head(out, CDDL_MAJOR_TYPE_POSITIVE_INT, (uint64_t)value);
+    }
+}''',
+    'put_string': r'''static void
+cddl_put_string(struct cddl_out       *out,
+                uint8_t                major_type,
+                size_t                 min_len,
+                size_t                 max_len,
+                struct q_useful_buf_c  value)
+{
+    if(value.len < min_len || value.len > max_len) {
+        cddl_fail(out, T_COSE_ERR_PAYLOAD_SCHEMA);
+        return;
+    }
+    cddl_put_head(out, major_type, value.len);
+    cddl_put_bytes(out, value.ptr, value.len);
+}''',
+    'get_head': r'''/* Read a head. Indefinite lengths aren't supported. */
+static enum t_cose_err_t
+cddl_get_head(struct cddl_in *in, uint8_t *major_type, uint64_t *argument)
+{
+    uint8_t  additional;
+    size_t   len;
+    uint64_t value;
+
+    if(in->pos >= in->end) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    *major_type = *in->pos >> 5;
+    additional  = *in->pos & 0x1f;
+    in->pos++;
+
+    if(additional < 24) {
+        *argument = additional;
+        return T_COSE_SUCCESS;
+    }
+    if(additional == 31) {
+        return *major_type == CDDL_MAJOR_TYPE_SIMPLE ? T_COSE_ERR_CBOR_NOT_WELL_FORMED :
+                                                       T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    if(additional > 27) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    len = (size_t)1 << (additional - 24);
+    if((size_t)(in->end - in->pos) < len) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    value = 0;
+    while(len--) {
+        value = value << 8 | *in->pos++;
+    }
+    if(*major_type == CDDL_MAJOR_TYPE_SIMPLE && additional == 24 && value < 32) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    *argument = value;
+    return T_COSE_SUCCESS;
+}''',
+    'get_uint': r'''static enum t_cose_err_t
+cddl_get_uint(struct cddl_in *in, uint64_t *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+
+    return_value = cddl_get_head(in, &major_type, value);
+    if(return_value == T_COSE_SUCCESS && major_type != CDDL_MAJOR_TYPE_POSITIVE_INT) {
+        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    return return_value;
+}''',
+    'get_int': r'''static enum t_cose_err_t
+cddl_get_int(struct cddl_in *in, int64_t *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          argument;
+
+    return_value = cddl_get_head(in, &major_type, &argument);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    if(major_type > CDDL_MAJOR_TYPE_NEGATIVE_INT || argument > INT64_MAX) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    *value = major_type == CDDL_MAJOR_TYPE_POSITIVE_INT ? (int64_t)argument :
+                                                          -1 - (int64_t)argument;
+    return T_COSE_SUCCESS;
+}''',
+    'get_bool': r'''static enum t_cose_err_t
+cddl_get_bool(struct cddl_in *in, bool *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          argument;
+
+    return_value = cddl_get_head(in, &major_type, &argument);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    if(major_type != CDDL_MAJOR_TYPE_SIMPLE ||
+       (argument != CDDL_SIMPLE_FALSE && argument != CDDL_SIMPLE_TRUE)) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    *value = argument == CDDL_SIMPLE_TRUE;
+    return T_COSE_SUCCESS;
+}''',
+    'get_string': r'''/* The string points into the payload */
+static enum t_cose_err_t
+cddl_get_string(struct cddl_in        *in,
+                uint8_t                expected_major_type,
+                size_t                 min_len,
+                size_t                 max_len,
+                struct q_useful_buf_c *value)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          len;
+
+    return_value = cddl_get_head(in, &major_type, &len);
+    if(return_value != T_COSE_SUCCESS) {
+        return return_value;
+    }
+    if(major_type != expected_major_type) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    if(len > (uint64_t)(in->end - in->pos)) {
+        return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+    }
+    if(len < min_len || len > max_len) {
+        return T_COSE_ERR_PAYLOAD_SCHEMA;
+    }
+    value->ptr = in->pos;
+    value->len = (size_t)len;
+    in->pos += len;
+    return T_COSE_SUCCESS;
+}''',
+    'skip': r'''/* Skip one item of any type for a label the schema allows but doesn't
+ * name. Nesting is followed by counting the items still to skip, each
+ * of which takes at least a byte. */
+static enum t_cose_err_t
+cddl_skip(struct cddl_in *in)
+{
+    enum t_cose_err_t return_value;
+    uint8_t           major_type;
+    uint64_t          argument;
+    uint64_t          to_skip;
+
+    for(to_skip = 1; to_skip > 0; to_skip--) {
+        return_value = cddl_get_head(in, &major_type, &argument);
+        if(return_value != T_COSE_SUCCESS) {
+            return return_value;
+        }
+        switch(major_type) {
+        case CDDL_MAJOR_TYPE_BYTE_STRING:
+        case CDDL_MAJOR_TYPE_TEXT_STRING:
+            if(argument > (uint64_t)(in->end - in->pos)) {
+                return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+            }
+            in->pos += argument;
+            break;
+
+        case CDDL_MAJOR_TYPE_ARRAY:
+        case CDDL_MAJOR_TYPE_MAP:
+            if(argument > (uint64_t)(in->end - in->pos)) {
+                return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+            }
+            to_skip += major_type == CDDL_MAJOR_TYPE_MAP ? 2 * argument : argument;
+            break;
+
+        case CDDL_MAJOR_TYPE_TAG:
+            to_skip++;
+            break;
+
+        default:
+            /* Integers and simple values are all head */
+            break;
+        }
+        if(to_skip - 1 > (uint64_t)(in->end - in->pos)) {
+            return T_COSE_ERR_CBOR_NOT_WELL_FORMED;
+        }
+    }
+    return T_COSE_SUCCESS;
+}''',
+}
+
+# What each part of the runtime needs
+RUNTIME_NEEDS = {
+    'defines': [],
+    'out': [],
+    'in': [],
+    'fail': ['out'],
+    'put_bytes': ['fail'],
+    'put_head': ['put_bytes', 'defines'],
+    'put_int': ['put_head'],
+    'put_string': ['put_head'],
+    'get_head': ['in', 'defines'],
+    'get_uint': ['get_head'],
+    'get_int': ['get_head'],
+    'get_bool': ['get_head'],
+    'get_string': ['get_head'],
+    'skip': ['get_head'],
+}
+
+
+def runtime_parts(schema):
+    """The parts of the runtime the generated code calls, in order"""
+    wanted = {'put_head', 'get_head', 'out', 'in'}
+    for map_info in schema.map_order:
+        if map_info['wildcards']:
+            wanted.add('skip')
+        for field in map_info['fields']:
+            kind = field['value']['kind']
+            if kind in ('int', 'nint'):
+                wanted.update(('put_int', 'get_int'))
+            if kind == 'nint':
+                wanted.add('fail')
+            if kind == 'uint':
+                wanted.add('get_uint')
+            if kind == 'bool':
+                wanted.add('get_bool')
+            if kind in ('tstr', 'bstr'):
+                wanted.update(('put_string', 'get_string'))
+    pending = list(wanted)
+    while pending:
+        for need in RUNTIME_NEEDS[pending.pop()]:
+            if need not in wanted:
+                wanted.add(need)
+                pending.append(need)
+    return [RUNTIME_PARTS[name] for name in RUNTIME_PARTS if name in wanted]
+
+C_TYPES = {
+    'int': 'int64_t', 'uint': 'uint64_t', 'nint': 'int64_t',
+    'tstr': 'struct q_useful_buf_c', 'bstr': 'struct q_useful_buf_c', 'bool': 'bool',
+}
+
+STRING_MAJOR = {'tstr': 'CDDL_MAJOR_TYPE_TEXT_STRING', 'bstr': 'CDDL_MAJOR_TYPE_BYTE_STRING'}
+
+
+def c_type(value):
+    if value['kind'] == 'map':
+        return 'struct %s' % value['map']['c']
+    return C_TYPES[value['kind']]
+
+
+def bit_macro(map_info, field):
+    return '%s_%s_PRESENT' % (map_info['c'].upper(), field['name'].upper())
+
+
+def size_limits(value):
+    if value['size'] is None:
+        return '0', 'SIZE_MAX'
+    return str(value['size'][0]), str(value['size'][1])
+
+
+class Writer:
+    def __init__(self):
+        self.lines = []
+
+    def __call__(self, line='', *args):
+        self.lines.append((line % args if args else line).rstrip())
+
+    def text(self):
+        return '\n'.join(self.lines) + '\n'
+
+
+def columns(rows, indent):
+    """Align declarations the way the rest of t_cose does"""
+    width = max(len(row[0]) for row in rows)
+    return ['%s%-*s %s' % (indent, width + 1 - (len(row[1]) - len(row[1].lstrip('*'))) - 1,
+                            row[0], row[1]) for row in rows]
+
+
+def write_struct(w, map_info):
+    w('/**')
+    w(' * The \\c %s map. \\c present has a bit for each member', map_info['rule'])
+    w(' * in it; required members are always encoded.')
+    w(' */')
+    w('struct %s {', map_info['c'])
+    rows = []
+    for field in map_info['fields']:
+        rows.append((c_type(field['value']), field['name'] + ';'))
+    rows.append(('uint32_t', 'present;'))
+    for line in columns(rows, '    '):
+        w(line)
+    w('};')
+    w()
+    for i, field in enumerate(map_info['fields']):
+        w('#define %-40s 0x%08xU /* %s%s */', bit_macro(map_info, field), 1 << i,
+          label_comment(field['key']), '' if field['optional'] else ', required')
+    w()
+    w()
+
+
+def write_encode_map(w, map_info):
+    name = map_info['c']
+    fields = map_info['fields']
+    required = [f for f in fields if not f['optional']]
+    optional = [f for f in fields if f['optional']]
+    w('static void')
+    w('%s_encode_map(struct cddl_out *out, const struct %s *me)', name, name)
+    w('{')
+    count = ([str(len(required))] if required or not optional else []) + \
+        ['((me->present & %s) != 0)' % bit_macro(map_info, f) for f in optional]
+    w('    cddl_put_head(out, CDDL_MAJOR_TYPE_MAP,')
+    for i, term in enumerate(count):
+        w('                  %s%s%s', '(uint64_t)(' if i == 0 else '           ', term,
+          '));' if i == len(count) - 1 else ' +')
+    for field in fields:
+        w()
+        indent = '    '
+        if field['optional']:
+            w('    if(me->present & %s) {', bit_macro(map_info, field))
+            indent = '        '
+        label = label_bytes(field['key'])
+        w('%scddl_put_bytes(out, %s, %d); /* %s */', indent, c_bytes(label), len(label),
+          label_comment(field['key']))
+        value = field['value']
+        member = 'me->%s' % field['name']
+        kind = value['kind']
+        if kind == 'uint':
+            w('%scddl_put_head(out, CDDL_MAJOR_TYPE_POSITIVE_INT, %s);', indent, member)
+        elif kind == 'int':
+            w('%scddl_put_int(out, %s);', indent, member)
+        elif kind == 'nint':
+            w('%sif(%s >= 0) {', indent, member)
+            w('%s    cddl_fail(out, T_COSE_ERR_PAYLOAD_SCHEMA);', indent)
+            w('%s}', indent)
+            w('%scddl_put_int(out, %s);', indent, member)
+        elif kind == 'bool':
+            w('%scddl_put_bytes(out, %s ? "\\xf5" : "\\xf4", 1);', indent, member)
+        elif kind == 'map':
+            w('%s%s_encode_map(out, &%s);', indent, value['map']['c'], member)
+        else:
+            low, high = size_limits(value)
+            w('%scddl_put_string(out, %s, %s, %s, %s);', indent, STRING_MAJOR[kind], low, high, member)
+        if field['optional']:
+            w('    }')
+    w('}')
+    w()
+    w()
+
+
+def write_decode_value(w, indent, field):
+    value = field['value']
+    kind = value['kind']
+    if kind == 'uint':
+        w('%sreturn_value = cddl_get_uint(in, &me->%s);', indent, field['name'])
+    elif kind == 'int':
+        w('%sreturn_value = cddl_get_int(in, &me->%s);', indent, field['name'])
+    elif kind == 'nint':
+        w('%sreturn_value = cddl_get_int(in, &me->%s);', indent, field['name'])
+        w('%sif(return_value == T_COSE_SUCCESS && me->%s >= 0) {', indent, field['name'])
+        w('%s    return_value = T_COSE_ERR_PAYLOAD_SCHEMA;', indent)
+        w('%s}', indent)
+    elif kind == 'bool':
+        w('%sreturn_value = cddl_get_bool(in, &me->%s);', indent, field['name'])
+    elif kind == 'map':
+        w('%sreturn_value = %s_decode_map(in, &me->%s);', indent, value['map']['c'], field['name'])
+    else:
+        low, high = size_limits(value)
+        w('%sreturn_value = cddl_get_string(in, %s, %s, %s, &me->%s);', indent,
+          STRING_MAJOR[kind], low, high, field['name'])
+
+
+def write_int_switch(w, map_info, fields, major_type):
+    w('            switch(label) {')
+    for field in sorted(fields, key=lambda f: abs(f['key'][1])):
+        argument = field['key'][1] if major_type == 0 else -1 - field['key'][1]
+        if major_type == 0:
+            w('            case %d:', argument)
+        else:
+            w('            case %d: /* %d */', argument, field['key'][1])
+        w('                bit = %s;', bit_macro(map_info, field))
+        write_decode_value(w, '                ', field)
+        w('                break;')
+        w()
+    w('            default:')
+    w('                break;')
+    w('            }')
+
+
+def write_decode_map(w, map_info):
+    name = map_info['c']
+    fields = map_info['fields']
+    wildcards = map_info['wildcards']
+    positive = [f for f in fields if f['key'][0] == 'int' and f['key'][1] >= 0]
+    negative = [f for f in fields if f['key'][0] == 'int' and f['key'][1] < 0]
+    text = [f for f in fields if f['key'][0] == 'tstr']
+    required = ' | '.join(bit_macro(map_info, f) for f in fields if not f['optional'])
+    required_macro = '%s_REQUIRED' % name.upper()
+
+    if required:
+        w('/* The members of \\c %s that must be there */', map_info['rule'])
+        w('#define %s (%s)', required_macro, required)
+        w()
+    w('static enum t_cose_err_t')
+    w('%s_decode_map(struct cddl_in *in, struct %s *me)', name, name)
+    w('{')
+    for line in columns([('enum t_cose_err_t', 'return_value;'),
+                         ('uint8_t', 'major_type;'),
+                         ('uint64_t', 'count;'),
+                         ('uint64_t', 'label;'),
+                         ('uint32_t', 'bit;')] +
+                        ([('const uint8_t', '*label_bytes;')] if text else []), '    '):
+        w(line)
+    w()
+    w('    return_value = cddl_get_head(in, &major_type, &count);')
+    w('    if(return_value != T_COSE_SUCCESS) {')
+    w('        goto Done;')
+    w('    }')
+    w('    if(major_type != CDDL_MAJOR_TYPE_MAP) {')
+    w('        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;')
+    w('        goto Done;')
+    w('    }')
+    w()
+    w('    me->present = 0;')
+    w('    for(; count > 0; count--) {')
+    w('        return_value = cddl_get_head(in, &major_type, &label);')
+    w('        if(return_value != T_COSE_SUCCESS) {')
+    w('            goto Done;')
+    w('        }')
+    w('        bit = 0;')
+    w()
+    w('        switch(major_type) {')
+    for major, major_name, group in ((0, 'CDDL_MAJOR_TYPE_POSITIVE_INT', positive),
+                                     (1, 'CDDL_MAJOR_TYPE_NEGATIVE_INT', negative)):
+        if group:
+            w('        case %s:', major_name)
+            write_int_switch(w, map_info, group, major)
+            w('            break;')
+            w()
+    if text or 'tstr' in wildcards:
+        w('        case CDDL_MAJOR_TYPE_TEXT_STRING:')
+        w('            if(label > (uint64_t)(in->end - in->pos)) {')
+        w('                return_value = T_COSE_ERR_CBOR_NOT_WELL_FORMED;')
+        w('                goto Done;')
+        w('            }')
+        if text:
+            w('            label_bytes = in->pos;')
+        w('            in->pos += label;')
+        if text:
+            by_len = {}
+            for field in text:
+                by_len.setdefault(len(field['key'][1].encode('utf-8')), []).append(field)
+            w('            switch(label) {')
+            for length in sorted(by_len):
+                w('            case %d:', length)
+                for i, field in enumerate(by_len[length]):
+                    encoded = field['key'][1].encode('utf-8')
+                    w('                %sif(!memcmp(label_bytes, %s, %d)) { /* "%s" */',
+                      '' if i == 0 else '} else ', c_bytes(encoded), len(encoded), field['key'][1])
+                    w('                    bit = %s;', bit_macro(map_info, field))
+                    write_decode_value(w, '                    ', field)
+                w('                }')
+                w('                break;')
+                w()
+            w('            default:')
+            w('                break;')
+            w('            }')
+        w('            break;')
+        w()
+    w('        default:')
+    w('            break;')
+    w('        }')
+    w()
+    w('        if(return_value != T_COSE_SUCCESS) {')
+    w('            goto Done;')
+    w('        }')
+    w('        if(bit == 0) {')
+    not_allowed = []
+    if 'int' in wildcards:
+        not_allowed.append('major_type > CDDL_MAJOR_TYPE_NEGATIVE_INT')
+    if 'tstr' in wildcards:
+        not_allowed.append('major_type != CDDL_MAJOR_TYPE_TEXT_STRING')
+    if not_allowed:
+        w('            /* A label the schema allows but doesn\'t name */')
+        w('            if(%s) {', ' && '.join(not_allowed))
+        w('                return_value = T_COSE_ERR_PAYLOAD_SCHEMA;')
+        w('                goto Done;')
+        w('            }')
+        w('            return_value = cddl_skip(in);')
+        w('            if(return_value != T_COSE_SUCCESS) {')
+        w('                goto Done;')
+        w('            }')
+        w('            continue;')
+    else:
+        w('            return_value = T_COSE_ERR_PAYLOAD_SCHEMA;')
+        w('            goto Done;')
+    w('        }')
+    w('        if(me->present & bit) {')
+    w('            /* Duplicate label */')
+    w('            return_value = T_COSE_ERR_PAYLOAD_SCHEMA;')
+    w('            goto Done;')
+    w('        }')
+    w('        me->present |= bit;')
+    w('    }')
+    if required:
+        w()
+        w('    if((me->present & %s) != %s) {', required_macro, required_macro)
+        w('        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;')
+        w('    }')
+    w()
+    w('Done:')
+    w('    return return_value;')
+    w('}')
+    w()
+    w()
+
+
+def prototype(w, name, params, end):
+    """A function prototype with the parameters aligned in columns"""
+    width = max(len(param[0]) for param in params)
+    for i, (param_type, param_name) in enumerate(params):
+        lead = name + '(' if i == 0 else ' ' * (len(name) + 1)
+        stars = len(param_name) - len(param_name.lstrip('*'))
+        w('%s%-*s %s%s', lead, width + 1 - stars, param_type, param_name,
+          ',' if i < len(params) - 1 else ')' + end)
+
+
+def banner(w, file_name, schema_name):
+    w('/*')
+    w(' *  %s', file_name)
+    w(' *')
+    w(' * Generated by tools/cddl_gen/cddl_gen.py from %s.', schema_name)
+    w(' * Don\'t edit; change the schema and generate again.')
+    w(' *')
+    w(' * SPDX-License-Identifier: BSD-3-Clause')
+    w(' */')
+    w()
+
+
+def public_comment(w, header_name):
+    w('/*')
+    w(' * Public function. See %s', header_name)
+    w(' */')
+
+
+def generate(schema, root, schema_name, base_name):
+    root_map = schema.resolve_map(root)
+    name = root_map['c']
+    upper = name.upper()
+    size = max_size(root_map)
+    header_name = base_name + '.h'
+    guard = '__%s_H__' % c_name(base_name).upper()
+
+    encode_params = [('const struct %s' % name, '*me'),
+                     ('struct q_useful_buf', 'buffer'),
+                     ('struct q_useful_buf_c', '*encoded')]
+    decode_params = [('struct q_useful_buf_c', 'encoded'),
+                     ('struct %s' % name, '*me')]
+    sign_params = [('struct t_cose_sign1_sign_ctx', '*sign_ctx'),
+                   ('const struct %s' % name, '*me'),
+                   ('struct q_useful_buf', 'out_buf'),
+                   ('struct q_useful_buf_c', '*result')]
+    verify_params = [('struct t_cose_sign1_verify_ctx', '*verify_ctx'),
+                     ('struct q_useful_buf_c', 'sign1'),
+                     ('struct %s' % name, '*me'),
+                     ('struct t_cose_parameters', '*parameters')]
+
+    h = Writer()
+    banner(h, header_name, schema_name)
+    h('#ifndef %s', guard)
+    h('#define %s', guard)
+    h()
+    h('#include <stdint.h>')
+    h('#include <stdbool.h>')
+    h('#include "t_cose/q_useful_buf.h"')
+    h('#include "t_cose/t_cose_common.h"')
+    h('#include "t_cose/t_cose_sign1_sign.h"')
+    h('#include "t_cose/t_cose_sign1_verify.h"')
+    h()
+    h('#ifdef __cplusplus')
+    h('extern "C" {')
+    h('#endif')
+    h()
+    h()
+    for map_info in schema.map_order:
+        write_struct(h, map_info)
+    if size is not None:
+        h('/* The most bytes a \\c %s map encodes to */', root)
+        h('#define %s_MAX_SIZE %d', upper, size)
+        h()
+        h()
+    h('/**')
+    h(' * \\brief Encode a \\c %s map.', root)
+    h(' *')
+    h(' * \\param[in] me        The claims to encode.')
+    h(' * \\param[in] buffer    Where to encode them.')
+    h(' * \\param[out] encoded  The encoded map in \\c buffer.')
+    h(' *')
+    h(' * \\retval T_COSE_ERR_TOO_SMALL')
+    h(' *         \\c buffer is too small.')
+    h(' * \\retval T_COSE_ERR_PAYLOAD_SCHEMA')
+    h(' *         A value is outside what the schema allows.')
+    h(' * \\retval T_COSE_SUCCESS')
+    h(' *         \\c encoded is the map.')
+    h(' */')
+    h('enum t_cose_err_t')
+    prototype(h, name + '_encode', encode_params, ';')
+    h()
+    h()
+    h('/**')
+    h(' * \\brief Decode a \\c %s map.', root)
+    h(' *')
+    h(' * \\param[in] encoded  The encoded map, for example a verified payload.')
+    h(' * \\param[out] me      The claims. Strings point into \\c encoded.')
+    h(' *')
+    h(' * \\retval T_COSE_ERR_CBOR_NOT_WELL_FORMED')
+    h(' *         \\c encoded is not well-formed.')
+    h(' * \\retval T_COSE_ERR_PAYLOAD_SCHEMA')
+    h(' *         \\c encoded doesn\'t match the schema or has an indefinite')
+    h(' *         length.')
+    h(' * \\retval T_COSE_SUCCESS')
+    h(' *         \\c me has the claims.')
+    h(' */')
+    h('enum t_cose_err_t')
+    prototype(h, name + '_decode', decode_params, ';')
+    h()
+    h()
+    if size is not None:
+        h('/**')
+        h(' * \\brief Encode a \\c %s map and sign it as a \\c COSE_Sign1.', root)
+        h(' *')
+        h(' * The map is encoded on the stack and passed to t_cose_sign1_sign().')
+        h(' */')
+        h('enum t_cose_err_t')
+        prototype(h, name + '_sign1_sign', sign_params, ';')
+        h()
+        h()
+    h('/**')
+    h(' * \\brief Verify a \\c COSE_Sign1 and decode its \\c %s payload.', root)
+    h(' *')
+    h(' * This is t_cose_sign1_verify() then %s_decode().', name)
+    h(' */')
+    h('enum t_cose_err_t')
+    prototype(h, name + '_sign1_verify', verify_params, ';')
+    h()
+    h()
+    h('#ifdef __cplusplus')
+    h('}')
+    h('#endif')
+    h()
+    h('#endif /* %s */', guard)
+
+    c = Writer()
+    banner(c, base_name + '.c', schema_name)
+    c('#include <string.h>')
+    c('#include "%s"', header_name)
+    c()
+    c()
+    for part in runtime_parts(schema):
+        for line in part.split('\n'):
+            c(line)
+        c()
+        c()
+    for map_info in schema.map_order:
+        write_encode_map(c, map_info)
+        write_decode_map(c, map_info)
+
+    public_comment(c, header_name)
+    c('enum t_cose_err_t')
+    prototype(c, name + '_encode', encode_params, '')
+    c('{')
+    c('    struct cddl_out out;')
+    c()
+    c('    out.ptr   = buffer.ptr;')
+    c('    out.size  = buffer.len;')
+    c('    out.len   = 0;')
+    c('    out.error = T_COSE_SUCCESS;')
+    c()
+    c('    %s_encode_map(&out, me);', name)
+    c()
+    c('    if(out.error == T_COSE_SUCCESS) {')
+    c('        encoded->ptr = out.ptr;')
+    c('        encoded->len = out.len;')
+    c('    }')
+    c('    return out.error;')
+    c('}')
+    c()
+    c()
+    public_comment(c, header_name)
+    c('enum t_cose_err_t')
+    prototype(c, name + '_decode', decode_params, '')
+    c('{')
+    c('    struct cddl_in    in;')
+    c('    enum t_cose_err_t return_value;')
+    c()
+    c('    memset(me, 0, sizeof(*me));')
+    c('    in.pos = encoded.ptr;')
+    c('    in.end = in.pos + encoded.len;')
+    c()
+    c('    return_value = %s_decode_map(&in, me);', name)
+    c('    if(return_value == T_COSE_SUCCESS && in.pos != in.end) {')
+    c('        return_value = T_COSE_ERR_PAYLOAD_SCHEMA;')
+    c('    }')
+    c('    return return_value;')
+    c('}')
+    c()
+    c()
+    if size is not None:
+        public_comment(c, header_name)
+        c('enum t_cose_err_t')
+        prototype(c, name + '_sign1_sign', sign_params, '')
+        c('{')
+        c('    Q_USEFUL_BUF_MAKE_STACK_UB(payload_buffer, %s_MAX_SIZE);', upper)
+        c('    struct q_useful_buf_c      payload;')
+        c('    enum t_cose_err_t          return_value;')
+        c()
+        c('    return_value = %s_encode(me, payload_buffer, &payload);', name)
+        c('    if(return_value != T_COSE_SUCCESS) {')
+        c('        return return_value;')
+        c('    }')
+        c('    return t_cose_sign1_sign(sign_ctx, payload, out_buf, result);')
+        c('}')
+        c()
+        c()
+    public_comment(c, header_name)
+    c('enum t_cose_err_t')
+    prototype(c, name + '_sign1_verify', verify_params, '')
+    c('{')
+    c('    struct q_useful_buf_c payload;')
+    c('    enum t_cose_err_t     return_value;')
+    c()
+    c('    return_value = t_cose_sign1_verify(verify_ctx, sign1, &payload, parameters);')
+    c('    if(return_value != T_COSE_SUCCESS) {')
+    c('        return return_value;')
+    c('    }')
+    c('    return %s_decode(payload, me);', name)
+    c('}')
+
+    return h.text(), c.text()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate C for a CDDL claims map.')
+    parser.add_argument('--rule', help='the map rule to generate for; the first map by default')
+    parser.add_argument('--check', action='store_true',
+                        help='check the output files are up to date instead of writing them')
+    parser.add_argument('schema', help='the CDDL file')
+    parser.add_argument('out_base', help='the output files without .h or .c')
+    args = parser.parse_args()
+
+    try:
+        with open(args.schema, encoding='utf-8') as schema_file:
+            rules, order = Parser(schema_file.read()).rules()
+        root = args.rule
+        if root is None:
+            maps = [name for name in order if rules[name][0] == 'map']
+            if not maps:
+                raise CddlError('there is no map rule')
+            root = maps[0]
+        elif root not in rules or rules[root][0] != 'map':
+            raise CddlError('"%s" is not a map rule' % root)
+        header, source = generate(Schema(rules), root, os.path.basename(args.schema),
+                                  os.path.basename(args.out_base))
+    except CddlError as error:
+        sys.stderr.write('%s: %s\n' % (args.schema, error))
+        return 2
+
+    outputs = ((args.out_base + '.h', header), (args.out_base + '.c', source))
+    if args.check:
+        stale = []
+        for path, text in outputs:
+            try:
+                with open(path, encoding='utf-8') as existing:
+                    if existing.read() == text:
+                        continue
+            except OSError:
+                pass
+            stale.append(path)
+        for path in stale:
+            sys.stderr.write('%s is not up to date with %s\n' % (path, args.schema))
+        return 1 if stale else 0
+
+    for path, text in outputs:
+        with open(path, 'w', encoding='utf-8') as out_file:
+            out_file.write(text)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())